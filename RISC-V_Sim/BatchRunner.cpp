@@ -0,0 +1,368 @@
+#include "BatchRunner.h"
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ReadProgram.h"
+#include "RISCV_Program.h"
+#include "WorkStealingPool.h"
+
+namespace fs = std::filesystem;
+
+static bool WildcardMatch(const char* pattern, const char* text)
+{
+	//simple glob matching that only understands * and ?
+	if (*pattern == '\0')
+	{
+		return *text == '\0';
+	}
+	if (*pattern == '*')
+	{
+		return WildcardMatch(pattern + 1, text) || (*text != '\0' && WildcardMatch(pattern, text + 1));
+	}
+	if (*text != '\0' && (*pattern == '?' || *pattern == *text))
+	{
+		return WildcardMatch(pattern + 1, text + 1);
+	}
+	return false;
+}
+
+static std::string RemoveProgramExtension(const std::string& path)
+{
+	//a program can be given by any of its files,
+	//so shell globs like tests/*/* also work
+	for (const std::string extension : { ".bin", ".res", ".s" })
+	{
+		if (path.size() > extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0)
+		{
+			return path.substr(0, path.size() - extension.size());
+		}
+	}
+	return path;
+}
+
+std::vector<std::string> FindBatchPrograms(const std::string& pathOrPattern)
+{
+	std::vector<std::string> programs;
+
+	//@file is a list of programs with one program on each line
+	if (!pathOrPattern.empty() && pathOrPattern[0] == '@')
+	{
+		std::ifstream listFile(pathOrPattern.substr(1));
+		if (!listFile)
+		{
+			throw std::runtime_error("Failed to open program list: " + pathOrPattern.substr(1));
+		}
+		std::string line;
+		while (std::getline(listFile, line))
+		{
+			line.erase(line.find_last_not_of(" \t\r") + 1);
+			if (!line.empty() && line[0] != '#')
+			{
+				programs.push_back(RemoveProgramExtension(line));
+			}
+		}
+		return programs;
+	}
+
+	//a directory means every program in it or any of its sub directories
+	if (fs::is_directory(pathOrPattern))
+	{
+		for (const fs::directory_entry& entry : fs::recursive_directory_iterator(pathOrPattern))
+		{
+			if (entry.is_regular_file() && entry.path().extension() == ".bin")
+			{
+				programs.push_back(RemoveProgramExtension(entry.path().generic_string()));
+			}
+		}
+		std::sort(programs.begin(), programs.end());
+		return programs;
+	}
+
+	//a wildcard in the file name matches against the programs in that directory
+	const fs::path patternPath(RemoveProgramExtension(pathOrPattern));
+	const std::string filePattern = patternPath.filename().string();
+	if (filePattern.find_first_of("*?") != std::string::npos)
+	{
+		const fs::path directory = patternPath.has_parent_path() ? patternPath.parent_path() : fs::path(".");
+		for (const fs::directory_entry& entry : fs::directory_iterator(directory))
+		{
+			if (entry.is_regular_file() && entry.path().extension() == ".bin" &&
+				WildcardMatch(filePattern.c_str(), entry.path().stem().string().c_str()))
+			{
+				programs.push_back(RemoveProgramExtension(entry.path().generic_string()));
+			}
+		}
+		std::sort(programs.begin(), programs.end());
+		return programs;
+	}
+
+	programs.push_back(RemoveProgramExtension(pathOrPattern));
+	return programs;
+}
+
+//keeps the directory structure of the programs so programs with the same name
+//don't collide, but a path with .. in it can't put the result outside the directory
+static fs::path GetBatchOutputPath(const std::string& outputDirectory, const std::string& programPath)
+{
+	const fs::path relativePath = fs::path(programPath).relative_path().lexically_normal();
+	if (relativePath.empty() || *relativePath.begin() == "..")
+	{
+		throw std::runtime_error("Can't save the result of a program outside the output directory: " + programPath);
+	}
+	return fs::path(outputDirectory) / relativePath;
+}
+
+static BatchResult RunBatchProgram(const std::string& programPath, const std::string& outputDirectory, const RunLimits& limits)
+{
+	BatchResult result;
+	result.programPath = programPath;
+	result.status = BatchStatus::Error;
+	result.retiredInstructions = 0;
+
+	const auto startTime = std::chrono::steady_clock::now();
+	try
+	{
+		const bool hasExpectedResult = fs::exists(programPath + ".res");
+		//no output directory means that only the result is checked
+		const fs::path outputPath = outputDirectory.empty() ? fs::path() : GetBatchOutputPath(outputDirectory, programPath);
+		std::unique_ptr<RISCV_Program> program = LoadProgram(programPath, false);
+		const RunStatus runStatus = program->Run(limits);
+		result.retiredInstructions = program->GetRetiredInstructions();
+
+		if (!outputPath.empty())
+		{
+			fs::create_directories(outputPath.parent_path());
+			program->SaveProgramResult(outputPath.string());
+		}
+
+		if (runStatus == RunStatus::InstructionLimit)
+		{
+			result.status = BatchStatus::InstructionLimit;
+			result.message = "Program didn't stop within " + std::to_string(limits.maxInstructions) + " instructions";
+		}
+		else if (runStatus == RunStatus::Timeout)
+		{
+			result.status = BatchStatus::Timeout;
+			result.message = "Program didn't stop within " + std::to_string(limits.timeoutMilliseconds) + " ms";
+		}
+		else if (!hasExpectedResult)
+		{
+			result.status = BatchStatus::NoExpectedResult;
+		}
+		else if (program->CheckProgramResult())
+		{
+			result.status = BatchStatus::Passed;
+		}
+		else
+		{
+			result.status = BatchStatus::Failed;
+			result.message = "Registers doesn't match the expected result";
+		}
+	}
+	catch (const std::exception& e)
+	{
+		result.status = BatchStatus::Error;
+		result.message = e.what();
+	}
+	const auto endTime = std::chrono::steady_clock::now();
+
+	//a .xfail file next to the program marks it as known to fail.
+	//The file should contain the reason why it fails.
+	if (fs::exists(programPath + ".xfail"))
+	{
+		if (IsBatchFailure(result.status))
+		{
+			result.status = BatchStatus::ExpectedFailure;
+		}
+		else
+		{
+			result.status = BatchStatus::Failed;
+			result.message = "Program was expected to fail but didn't";
+		}
+	}
+	result.milliseconds = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+	return result;
+}
+
+std::vector<BatchResult> RunBatch(const std::vector<std::string>& programPaths, const std::string& outputDirectory, const size_t threadCount, const RunLimits& limits)
+{
+	std::vector<BatchResult> results(programPaths.size());
+	WorkStealingPool pool(threadCount);
+	pool.ParallelFor(programPaths.size(), [&](const size_t index, const size_t)
+	{
+		results[index] = RunBatchProgram(programPaths[index], outputDirectory, limits);
+	});
+
+	return results;
+}
+
+const char* BatchStatusName(const BatchStatus status)
+{
+	switch (status)
+	{
+		case BatchStatus::Passed:
+			return "passed";
+		case BatchStatus::Failed:
+			return "failed";
+		case BatchStatus::NoExpectedResult:
+			return "no_expected_result";
+		case BatchStatus::ExpectedFailure:
+			return "expected_failure";
+		case BatchStatus::InstructionLimit:
+			return "instruction_limit";
+		case BatchStatus::Timeout:
+			return "timeout";
+		case BatchStatus::Error:
+			return "error";
+		default:
+			throw std::runtime_error("Invalid batch status.");
+	}
+}
+
+bool IsBatchFailure(const BatchStatus status)
+{
+	return status == BatchStatus::Failed ||
+		   status == BatchStatus::InstructionLimit ||
+		   status == BatchStatus::Timeout ||
+		   status == BatchStatus::Error;
+}
+
+static std::string EscapeCSV(const std::string& text)
+{
+	std::string escaped = "\"";
+	for (const char c : text)
+	{
+		if (c == '"')
+		{
+			escaped += "\"\"";
+		}
+		else if (c == '\n' || c == '\r')
+		{
+			escaped += ' ';
+		}
+		else
+		{
+			escaped += c;
+		}
+	}
+	escaped += "\"";
+
+	return escaped;
+}
+
+void SaveBatchSummary(const std::vector<BatchResult>& results, const std::string& filepath)
+{
+	std::ofstream file(filepath);
+	if (!file)
+	{
+		throw std::runtime_error("Failed to create file: " + filepath);
+	}
+
+	file << "program,status,milliseconds,instructions,message\n";
+	for (const BatchResult& result : results)
+	{
+		file << EscapeCSV(result.programPath) << ',' << BatchStatusName(result.status) << ',' << result.milliseconds << ',' << result.retiredInstructions << ',' << EscapeCSV(result.message) << '\n';
+	}
+}
+
+static std::string EscapeJson(const std::string& text)
+{
+	std::string escaped = "\"";
+	for (const char c : text)
+	{
+		switch (c)
+		{
+			case '"':
+				escaped += "\\\"";
+				break;
+			case '\\':
+				escaped += "\\\\";
+				break;
+			case '\n':
+				escaped += "\\n";
+				break;
+			case '\r':
+				escaped += "\\r";
+				break;
+			case '\t':
+				escaped += "\\t";
+				break;
+			default:
+				escaped += c;
+				break;
+		}
+	}
+	escaped += "\"";
+
+	return escaped;
+}
+
+void SaveBatchSummaryJson(const std::vector<BatchResult>& results, const double wallMilliseconds, const std::string& filepath)
+{
+	std::ofstream file(filepath);
+	if (!file)
+	{
+		throw std::runtime_error("Failed to create file: " + filepath);
+	}
+
+	size_t statusCounts[BATCH_STATUS_COUNT] = { 0 };
+	for (const BatchResult& result : results)
+	{
+		statusCounts[static_cast<uint32_t>(result.status)]++;
+	}
+
+	file << "{\n";
+	file << "  \"total\": " << results.size() << ",\n";
+	for (uint32_t i = 0; i < BATCH_STATUS_COUNT; i++)
+	{
+		file << "  \"" << BatchStatusName(static_cast<BatchStatus>(i)) << "\": " << statusCounts[i] << ",\n";
+	}
+	file << "  \"wall_milliseconds\": " << wallMilliseconds << ",\n";
+	file << "  \"programs\": [";
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const BatchResult& result = results[i];
+		file << (i == 0 ? "\n" : ",\n");
+		file << "    { \"program\": " << EscapeJson(result.programPath) <<
+				", \"status\": \"" << BatchStatusName(result.status) << "\"" <<
+				", \"milliseconds\": " << result.milliseconds <<
+				", \"instructions\": " << result.retiredInstructions <<
+				", \"message\": " << EscapeJson(result.message) << " }";
+	}
+	file << "\n  ]\n";
+	file << "}\n";
+}
+
+void PrintBatchSummary(const std::vector<BatchResult>& results)
+{
+	size_t statusCounts[BATCH_STATUS_COUNT] = { 0 };
+	double totalMilliseconds = 0;
+	for (const BatchResult& result : results)
+	{
+		statusCounts[static_cast<uint32_t>(result.status)]++;
+		totalMilliseconds += result.milliseconds;
+
+		if (IsBatchFailure(result.status))
+		{
+			std::cout << BatchStatusName(result.status) << ": " << result.programPath << "\n" << result.message << "\n";
+		}
+	}
+
+	std::cout << "Ran " << results.size() << " programs" << "\n";
+	std::cout << "passed:             " << statusCounts[static_cast<uint32_t>(BatchStatus::Passed)] << "\n";
+	std::cout << "failed:             " << statusCounts[static_cast<uint32_t>(BatchStatus::Failed)] << "\n";
+	std::cout << "no expected result: " << statusCounts[static_cast<uint32_t>(BatchStatus::NoExpectedResult)] << "\n";
+	std::cout << "expected failures:  " << statusCounts[static_cast<uint32_t>(BatchStatus::ExpectedFailure)] << "\n";
+	std::cout << "instruction limit:  " << statusCounts[static_cast<uint32_t>(BatchStatus::InstructionLimit)] << "\n";
+	std::cout << "timeouts:           " << statusCounts[static_cast<uint32_t>(BatchStatus::Timeout)] << "\n";
+	std::cout << "errors:             " << statusCounts[static_cast<uint32_t>(BatchStatus::Error)] << "\n";
+	std::cout << "program time:       " << totalMilliseconds << " ms" << std::endl;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Processor.h"
+
+enum class BatchStatus
+{
+	Passed,
+	Failed,
+	NoExpectedResult,
+	ExpectedFailure,
+	InstructionLimit,
+	Timeout,
+	Error
+};
+const uint32_t BATCH_STATUS_COUNT = 7;
+
+struct BatchResult
+{
+	std::string programPath;
+	BatchStatus status;
+	std::string message;
+	double milliseconds;
+	uint64_t retiredInstructions;
+};
+
+std::vector<std::string> FindBatchPrograms(const std::string& pathOrPattern);
+std::vector<BatchResult> RunBatch(const std::vector<std::string>& programPaths, const std::string& outputDirectory, const size_t threadCount, const RunLimits& limits = RunLimits());
+void SaveBatchSummary(const std::vector<BatchResult>& results, const std::string& filepath);
+void SaveBatchSummaryJson(const std::vector<BatchResult>& results, const double wallMilliseconds, const std::string& filepath);
+void PrintBatchSummary(const std::vector<BatchResult>& results);
+const char* BatchStatusName(const BatchStatus status);
+bool IsBatchFailure(const BatchStatus status);
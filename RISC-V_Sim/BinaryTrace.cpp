@@ -0,0 +1,258 @@
+#include "BinaryTrace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <stdexcept>
+#include "InstructionDecode.h"
+#include "Register.h"
+
+TracePredictor::TracePredictor()
+{
+	//a program that starts at address 0 starts with a predicted pc
+	lastPc = static_cast<uint32_t>(-4);
+	lastMemoryAddress = 0;
+	std::fill(std::begin(registers), std::end(registers), 0);
+	//no instruction can be at an odd address
+	std::fill(std::begin(tablePcs), std::end(tablePcs), UINT32_MAX);
+	std::fill(std::begin(tableInstructions), std::end(tableInstructions), 0);
+	std::fill(std::begin(tableNextPcs), std::end(tableNextPcs), 0);
+}
+
+TraceWriter::TraceWriter(const std::string& path, const size_t bufferSize, const size_t ringSize) : file(path, std::ios::binary), filepath(path)
+{
+	if (!file)
+	{
+		throw std::runtime_error("Failed to create file: " + path);
+	}
+	buffer.resize(std::max(bufferSize, MAX_RECORD_SIZE));
+	bufferUsed = 0;
+	recordCount = 0;
+	bytesWritten = 0;
+
+	file.write(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+	bytesWritten += sizeof(TRACE_MAGIC);
+
+	stopWriter = false;
+	if (ringSize > 0)
+	{
+		ring = std::make_unique<SpscRing<TraceRecord>>(ringSize);
+		writerThread = std::thread(&TraceWriter::WriteRecordsFromRing, this);
+	}
+}
+
+TraceWriter::~TraceWriter()
+{
+	//a destructor can't throw, so call Close to find out if the trace was written
+	try
+	{
+		Close();
+	}
+	catch (...)
+	{
+	}
+}
+
+void TraceWriter::Flush()
+{
+	if (bufferUsed == 0)
+	{
+		return;
+	}
+
+	file.write(reinterpret_cast<const char*>(buffer.data()), bufferUsed);
+	if (!file)
+	{
+		throw std::runtime_error("Failed to write to file: " + filepath);
+	}
+	bytesWritten += bufferUsed;
+	bufferUsed = 0;
+}
+
+void TraceWriter::WriteRecordsFromRing()
+{
+	std::vector<TraceRecord> records(RING_BATCH_SIZE);
+	while (true)
+	{
+		//read the flag before the ring, so the records
+		//pushed before Close was called are still popped
+		const bool stopping = stopWriter.load(std::memory_order_acquire);
+		const size_t count = ring->TryPop(records.data(), records.size());
+		//after an error the records are still popped so the run loop doesn't wait forever
+		if (!writerError)
+		{
+			try
+			{
+				for (size_t i = 0; i < count; i++)
+				{
+					Encode(records[i]);
+				}
+			}
+			catch (...)
+			{
+				writerError = std::current_exception();
+			}
+		}
+
+		if (count == 0)
+		{
+			if (stopping)
+			{
+				return;
+			}
+			std::this_thread::sleep_for(std::chrono::microseconds(50));
+		}
+	}
+}
+
+void TraceWriter::Close()
+{
+	if (writerThread.joinable())
+	{
+		stopWriter.store(true, std::memory_order_release);
+		writerThread.join();
+	}
+	if (writerError)
+	{
+		//only throw it once
+		const std::exception_ptr error = writerError;
+		writerError = nullptr;
+		file.close();
+		std::rethrow_exception(error);
+	}
+	if (file.is_open())
+	{
+		Flush();
+		file.close();
+	}
+}
+
+uint64_t TraceWriter::GetRecordCount() const
+{
+	return recordCount;
+}
+
+uint64_t TraceWriter::GetByteCount() const
+{
+	if (writerThread.joinable())
+	{
+		throw std::runtime_error("The byte count of a trace written through a ring is only known after Close.");
+	}
+	return bytesWritten + bufferUsed;
+}
+
+TraceReader::TraceReader(const std::string& filepath) : file(filepath, std::ios::binary)
+{
+	if (!file)
+	{
+		throw std::runtime_error("Failed to open file: " + filepath);
+	}
+
+	char magic[sizeof(TRACE_MAGIC)];
+	if (!file.read(magic, sizeof(magic)) || !std::equal(std::begin(magic), std::end(magic), std::begin(TRACE_MAGIC)))
+	{
+		throw std::runtime_error("Not a trace file: " + filepath);
+	}
+}
+
+uint32_t TraceReader::ReadVarint()
+{
+	uint32_t value = 0;
+	for (uint32_t shift = 0; shift < 35; shift += 7)
+	{
+		const int byte = file.get();
+		if (byte == EOF)
+		{
+			throw std::runtime_error("Trace file is truncated.");
+		}
+		value |= static_cast<uint32_t>(byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0)
+		{
+			return value;
+		}
+	}
+	throw std::runtime_error("Trace file has an invalid varint.");
+}
+
+uint32_t TraceReader::ReadSignedVarint()
+{
+	const uint32_t value = ReadVarint();
+	return (value >> 1) ^ (0u - (value & 1));
+}
+
+bool TraceReader::Next(TraceRecord& record)
+{
+	const int flags = file.get();
+	if (flags == EOF)
+	{
+		return false;
+	}
+
+	record.pc = (flags & TRACE_PREDICTED_PC) ? predictor.PredictPc() : predictor.lastPc + ReadSignedVarint();
+	predictor.SetPc(record.pc);
+
+	const uint32_t tableIndex = GetTraceTableIndex(record.pc);
+	if (flags & TRACE_KNOWN_INSTRUCTION)
+	{
+		record.rawInstruction = predictor.tableInstructions[tableIndex];
+	}
+	else
+	{
+		uint8_t bytes[4];
+		if (!file.read(reinterpret_cast<char*>(bytes), sizeof(bytes)))
+		{
+			throw std::runtime_error("Trace file is truncated.");
+		}
+		record.rawInstruction = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+		predictor.SetInstruction(record.pc, record.rawInstruction);
+	}
+
+	//rd is in the same bits in every format that has it
+	record.rd = static_cast<uint8_t>((record.rawInstruction >> 7) & 31);
+	record.hasRegisterValue = (flags & TRACE_REGISTER_VALUE) != 0;
+	record.registerValue = 0;
+	if (record.hasRegisterValue)
+	{
+		record.registerValue = predictor.registers[record.rd] + ReadSignedVarint();
+		predictor.registers[record.rd] = record.registerValue;
+	}
+
+	record.hasMemoryAddress = (flags & TRACE_MEMORY_ADDRESS) != 0;
+	record.memoryAddress = 0;
+	if (record.hasMemoryAddress)
+	{
+		record.memoryAddress = predictor.lastMemoryAddress + ReadSignedVarint();
+		predictor.lastMemoryAddress = record.memoryAddress;
+	}
+
+	return true;
+}
+
+uint64_t ConvertTraceToText(const std::string& tracePath, std::ostream& output)
+{
+	TraceReader reader(tracePath);
+	TraceRecord record;
+	uint64_t recordCount = 0;
+	char text[64];
+	while (reader.Next(record))
+	{
+		snprintf(text, sizeof(text), "%08x: %08x ", record.pc, record.rawInstruction);
+		output << text;
+
+		Instruction instruction;
+		output << (TryDecodeInstruction(record.rawInstruction, instruction) && IsInstructionType(instruction.type) ? InstructionAsString(instruction) : "unknown");
+		if (record.hasRegisterValue)
+		{
+			snprintf(text, sizeof(text), "  %s=0x%08x", RegisterName(record.rd).c_str(), record.registerValue);
+			output << text;
+		}
+		if (record.hasMemoryAddress)
+		{
+			snprintf(text, sizeof(text), "  mem=0x%08x", record.memoryAddress);
+			output << text;
+		}
+		output << '\n';
+		recordCount++;
+	}
+	return recordCount;
+}
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Instruction.h"
+#include "HartState.h"
+#include "SpscRing.h"
+
+//A trace of every retired instruction with its pc, the raw instruction, the value it
+//wrote to rd and the memory address it used. Every record starts with a byte of flags
+//and only has the parts that can't be predicted from the records before it:
+// - the pc is left out when it's the pc that came after the last pc the last
+//   time it was traced, or the next pc for a pc that wasn't traced before.
+//   Otherwise the difference to the last pc is written as a zigzag varint
+// - the raw instruction is left out when it's the same as the last time the pc
+//   was traced
+//Both the writer and reader keep a small table of the last instructions to know this.
+// - the value of rd is written as the zigzag varint of how much it changed
+// - the memory address is written as the zigzag varint of the difference
+//   to the last memory address
+//A loop of simple instructions therefore takes two bytes per instruction
+const char TRACE_MAGIC[8] = { 'R', 'V', 'T', 'R', 'A', 'C', 'E', '1' };
+const uint8_t TRACE_PREDICTED_PC = 1;
+const uint8_t TRACE_KNOWN_INSTRUCTION = 2;
+const uint8_t TRACE_REGISTER_VALUE = 4;
+const uint8_t TRACE_MEMORY_ADDRESS = 8;
+const uint32_t TRACE_INSTRUCTION_TABLE_SIZE = 4096;
+
+struct TraceRecord
+{
+	uint32_t pc;
+	uint32_t rawInstruction;
+	bool hasRegisterValue;
+	uint8_t rd;
+	uint32_t registerValue;
+	bool hasMemoryAddress;
+	uint32_t memoryAddress;
+};
+
+inline uint32_t GetTraceTableIndex(const uint32_t pc)
+{
+	return (pc / 4) % TRACE_INSTRUCTION_TABLE_SIZE;
+}
+
+//The state that the writer and the reader both keep, so the
+//reader can fill in what the writer left out
+struct TracePredictor
+{
+	uint32_t lastPc;
+	uint32_t lastMemoryAddress;
+	uint32_t registers[32];
+	uint32_t tablePcs[TRACE_INSTRUCTION_TABLE_SIZE];
+	uint32_t tableInstructions[TRACE_INSTRUCTION_TABLE_SIZE];
+	uint32_t tableNextPcs[TRACE_INSTRUCTION_TABLE_SIZE];
+
+	TracePredictor();
+
+	uint32_t PredictPc() const
+	{
+		const uint32_t lastIndex = GetTraceTableIndex(lastPc);
+		return tablePcs[lastIndex] == lastPc ? tableNextPcs[lastIndex] : lastPc + 4;
+	}
+	//remembers that the pc came after the last pc
+	void SetPc(const uint32_t pc)
+	{
+		const uint32_t lastIndex = GetTraceTableIndex(lastPc);
+		if (tablePcs[lastIndex] == lastPc)
+		{
+			tableNextPcs[lastIndex] = pc;
+		}
+		lastPc = pc;
+	}
+	void SetInstruction(const uint32_t pc, const uint32_t rawInstruction)
+	{
+		const uint32_t index = GetTraceTableIndex(pc);
+		tablePcs[index] = pc;
+		tableInstructions[index] = rawInstruction;
+		tableNextPcs[index] = pc + 4;
+	}
+};
+
+//Writes the trace through a large buffer. It's given to Processor::SetTraceWriter,
+//and like the profilers it only runs in the instrumented version of the run loop.
+//With a ring size the run loop only copies the records into a ring buffer, and
+//a background thread encodes and writes them. The run loop then only waits
+//for that thread when the ring is full
+class TraceWriter
+{
+private:
+	//flags, a pc varint, the raw instruction and two varints
+	static constexpr size_t MAX_RECORD_SIZE = 1 + 5 + 4 + 5 + 5;
+	//how many records the background thread takes from the ring at a time
+	static constexpr size_t RING_BATCH_SIZE = 4096;
+
+	std::ofstream file;
+	std::string filepath;
+	std::vector<uint8_t> buffer;
+	size_t bufferUsed;
+	uint64_t recordCount;
+	uint64_t bytesWritten;
+	TracePredictor predictor;
+
+	std::unique_ptr<SpscRing<TraceRecord>> ring;
+	std::thread writerThread;
+	std::atomic<bool> stopWriter;
+	//an error from the background thread, thrown again by Close
+	std::exception_ptr writerError;
+
+	void WriteVarint(uint32_t value)
+	{
+		while (value >= 0x80)
+		{
+			buffer[bufferUsed++] = static_cast<uint8_t>(value | 0x80);
+			value >>= 7;
+		}
+		buffer[bufferUsed++] = static_cast<uint8_t>(value);
+	}
+	void WriteSignedVarint(const uint32_t difference)
+	{
+		//zigzag so small negative differences are small too
+		const int32_t value = static_cast<int32_t>(difference);
+		WriteVarint((static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31));
+	}
+
+	void Encode(const TraceRecord& record)
+	{
+		if (bufferUsed + MAX_RECORD_SIZE > buffer.size())
+		{
+			Flush();
+		}
+
+		const uint32_t tableIndex = GetTraceTableIndex(record.pc);
+		const bool knownInstruction = predictor.tablePcs[tableIndex] == record.pc && predictor.tableInstructions[tableIndex] == record.rawInstruction;
+
+		const size_t flagsIndex = bufferUsed++;
+		uint8_t flags = 0;
+		if (record.pc == predictor.PredictPc())
+		{
+			flags |= TRACE_PREDICTED_PC;
+		}
+		else
+		{
+			WriteSignedVarint(record.pc - predictor.lastPc);
+		}
+		predictor.SetPc(record.pc);
+
+		if (knownInstruction)
+		{
+			flags |= TRACE_KNOWN_INSTRUCTION;
+		}
+		else
+		{
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				buffer[bufferUsed++] = static_cast<uint8_t>(record.rawInstruction >> (i * 8));
+			}
+			predictor.SetInstruction(record.pc, record.rawInstruction);
+		}
+
+		if (record.hasRegisterValue)
+		{
+			flags |= TRACE_REGISTER_VALUE;
+			WriteSignedVarint(record.registerValue - predictor.registers[record.rd]);
+			predictor.registers[record.rd] = record.registerValue;
+		}
+		if (record.hasMemoryAddress)
+		{
+			flags |= TRACE_MEMORY_ADDRESS;
+			WriteSignedVarint(record.memoryAddress - predictor.lastMemoryAddress);
+			predictor.lastMemoryAddress = record.memoryAddress;
+		}
+
+		buffer[flagsIndex] = flags;
+	}
+	//only called by the thread that encodes the records
+	void Flush();
+	void WriteRecordsFromRing();
+
+public:
+	//a ring size of 0 encodes and writes the records on the thread that records them
+	TraceWriter(const std::string& path, const size_t bufferSize = 1 << 20, const size_t ringSize = 0);
+	TraceWriter(const TraceWriter&) = delete;
+	TraceWriter& operator=(const TraceWriter&) = delete;
+	~TraceWriter();
+
+	//the address a load, store or atomic instruction is going to use.
+	//Has to be read before the instruction is run, since it can change rs1
+	static uint32_t GetMemoryAddress(const HartState& hart, const Instruction& instruction)
+	{
+		const uint32_t opcode = static_cast<uint32_t>(instruction.type) & 127;
+		if (opcode == 0b0101111)
+		{
+			return hart.registers[instruction.rs1].uword;
+		}
+		return hart.registers[instruction.rs1].uword + static_cast<uint32_t>(instruction.immediate);
+	}
+
+	//called after the instruction at pc has been run
+	void Record(const uint32_t pc, const uint32_t rawInstruction, const Instruction& instruction, const HartState& hart, const uint32_t memoryAddress)
+	{
+		const uint32_t opcode = static_cast<uint32_t>(instruction.type) & 127;
+		TraceRecord record;
+		record.pc = pc;
+		record.rawInstruction = rawInstruction;
+		record.rd = static_cast<uint8_t>(instruction.rd);
+		//branches, stores, fences and the environment instructions don't write rd
+		record.hasRegisterValue = instruction.rd != 0 && opcode != 0b1100011 && opcode != 0b0100011 && opcode != 0b0001111 &&
+			instruction.type != InstructionType::ecall && instruction.type != InstructionType::ebreak;
+		record.registerValue = hart.registers[instruction.rd].uword;
+		record.hasMemoryAddress = opcode == 0b0000011 || opcode == 0b0100011 || opcode == 0b0101111;
+		record.memoryAddress = memoryAddress;
+
+		if (ring)
+		{
+			ring->Push(record);
+		}
+		else
+		{
+			Encode(record);
+		}
+		recordCount++;
+	}
+
+	//waits for the background thread to write everything that was recorded
+	void Close();
+	uint64_t GetRecordCount() const;
+	//including what is still in the buffer. With a ring the background thread
+	//owns the buffer, so this throws until Close has stopped it
+	uint64_t GetByteCount() const;
+};
+
+class TraceReader
+{
+private:
+	std::ifstream file;
+	TracePredictor predictor;
+
+	uint32_t ReadVarint();
+	uint32_t ReadSignedVarint();
+
+public:
+	TraceReader(const std::string& filepath);
+
+	//returns false at the end of the trace
+	bool Next(TraceRecord& record);
+};
+
+//writes a line of text for every record, and returns the number of records
+uint64_t ConvertTraceToText(const std::string& tracePath, std::ostream& output);
@@ -0,0 +1,192 @@
+#include "CallGraphProfiler.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+
+CallGraphProfiler::CallGraphProfiler()
+{
+	Clear();
+}
+
+void CallGraphProfiler::StartProgram(const uint32_t entryPc)
+{
+	callTree.Start(entryPc);
+}
+
+void CallGraphProfiler::UseProgram(const std::shared_ptr<const DecodedProgram>& program)
+{
+	if (program == countedProgram)
+	{
+		return;
+	}
+
+	countedProgram = program;
+	const Instruction* programInstructions = program->GetInstructions();
+	const size_t instructionCount = program->GetInstructionCount();
+	memoryAccessesBefore.assign(instructionCount + 1, 0);
+	for (size_t i = 0; i < instructionCount; i++)
+	{
+		memoryAccessesBefore[i + 1] = memoryAccessesBefore[i] + (IsMemoryAccess(programInstructions[i].type) ? 1 : 0);
+	}
+}
+
+CallGraphReport CallGraphProfiler::GetReport(const SymbolTable& symbols, const size_t pathCount) const
+{
+	CallGraphReport report = {};
+	const uint32_t nodeCount = static_cast<uint32_t>(callTree.GetNodeCount());
+
+	//children are always added after their parent, so going
+	//backwards adds every child to its parent before the parent is used
+	std::vector<uint64_t> inclusiveInstructions(nodeCount);
+	std::vector<uint64_t> inclusiveMemoryAccesses(nodeCount);
+	for (uint32_t i = nodeCount; i-- > 0;)
+	{
+		inclusiveInstructions[i] += instructions[i];
+		inclusiveMemoryAccesses[i] += memoryAccesses[i];
+		const uint32_t parent = callTree.GetParent(i);
+		if (parent != CallTree::NO_PARENT)
+		{
+			inclusiveInstructions[parent] += inclusiveInstructions[i];
+			inclusiveMemoryAccesses[parent] += inclusiveMemoryAccesses[i];
+		}
+	}
+	report.retiredInstructions = inclusiveInstructions[0];
+	report.memoryAccesses = inclusiveMemoryAccesses[0];
+
+	//functions are added up by name, since a symbol can have more than one entry
+	std::vector<std::string> names;
+	std::map<std::string, CallGraphFunction> functions;
+	for (uint32_t i = 0; i < nodeCount; i++)
+	{
+		names.push_back(symbols.GetName(callTree.GetAddress(i)));
+		CallGraphFunction& function = functions[names[i]];
+		if (function.name.empty())
+		{
+			function.name = names[i];
+			function.address = callTree.GetAddress(i);
+		}
+		function.calls += callTree.GetCalls(i);
+		function.exclusiveInstructions += instructions[i];
+		function.exclusiveMemoryAccesses += memoryAccesses[i];
+
+		//a recursive call is already included in the call further up
+		bool isRecursive = false;
+		for (uint32_t parent = callTree.GetParent(i); parent != CallTree::NO_PARENT && !isRecursive; parent = callTree.GetParent(parent))
+		{
+			isRecursive = names[parent] == names[i];
+		}
+		if (!isRecursive)
+		{
+			function.inclusiveInstructions += inclusiveInstructions[i];
+			function.inclusiveMemoryAccesses += inclusiveMemoryAccesses[i];
+		}
+	}
+	for (const auto& function : functions)
+	{
+		//a function that was only run outside of the trace windows
+		if (function.second.calls != 0 || function.second.inclusiveInstructions != 0)
+		{
+			report.functions.push_back(function.second);
+		}
+	}
+	std::stable_sort(report.functions.begin(), report.functions.end(), [](const CallGraphFunction& a, const CallGraphFunction& b)
+	{
+		return a.inclusiveInstructions > b.inclusiveInstructions;
+	});
+
+	std::vector<uint32_t> hottestNodes;
+	for (uint32_t i = 0; i < nodeCount; i++)
+	{
+		hottestNodes.push_back(i);
+	}
+	std::stable_sort(hottestNodes.begin(), hottestNodes.end(), [&](const uint32_t a, const uint32_t b)
+	{
+		return instructions[a] > instructions[b];
+	});
+	for (size_t i = 0; i < std::min<size_t>(pathCount, hottestNodes.size()); i++)
+	{
+		const uint32_t node = hottestNodes[i];
+		if (instructions[node] == 0)
+		{
+			break;
+		}
+		CallGraphPath path;
+		for (const uint32_t frame : callTree.GetPath(node))
+		{
+			path.frames.push_back(names[frame]);
+		}
+		path.calls = callTree.GetCalls(node);
+		path.exclusiveInstructions = instructions[node];
+		path.exclusiveMemoryAccesses = memoryAccesses[node];
+		report.paths.push_back(path);
+	}
+
+	return report;
+}
+
+void CallGraphProfiler::WriteFoldedStacks(std::ostream& stream, const SymbolTable& symbols) const
+{
+	//different paths can get the same names, so they are added up
+	const std::vector<std::string> foldedNames = callTree.GetFoldedNames(symbols);
+	std::map<std::string, uint64_t> folded;
+	for (size_t i = 0; i < foldedNames.size(); i++)
+	{
+		if (instructions[i] != 0)
+		{
+			folded[foldedNames[i]] += instructions[i];
+		}
+	}
+
+	for (const auto& line : folded)
+	{
+		stream << line.first << " " << line.second << "\n";
+	}
+}
+
+void CallGraphProfiler::Clear()
+{
+	callTree.Clear();
+	instructions.assign(1, 0);
+	memoryAccesses.assign(1, 0);
+	countedProgram = nullptr;
+	memoryAccessesBefore.clear();
+}
+
+static double GetPercent(const uint64_t count, const uint64_t total)
+{
+	return total == 0 ? 0.0 : 100.0 * static_cast<double>(count) / static_cast<double>(total);
+}
+
+void PrintCallGraphReport(const CallGraphReport& report)
+{
+	std::cout << "retired instructions: " << report.retiredInstructions << ", memory accesses: " << report.memoryAccesses << "\n";
+	std::cout << std::left << std::setw(24) << "function" << std::right <<
+		std::setw(10) << "calls" <<
+		std::setw(14) << "inclusive" << std::setw(9) << "" <<
+		std::setw(14) << "exclusive" << std::setw(9) << "" <<
+		std::setw(14) << "incl. memory" <<
+		std::setw(14) << "excl. memory" << "\n";
+	std::cout << std::fixed << std::setprecision(2);
+	for (const CallGraphFunction& function : report.functions)
+	{
+		std::cout << std::left << std::setw(24) << function.name << std::right <<
+			std::setw(10) << function.calls <<
+			std::setw(14) << function.inclusiveInstructions << std::setw(8) << GetPercent(function.inclusiveInstructions, report.retiredInstructions) << "%" <<
+			std::setw(14) << function.exclusiveInstructions << std::setw(8) << GetPercent(function.exclusiveInstructions, report.retiredInstructions) << "%" <<
+			std::setw(14) << function.inclusiveMemoryAccesses <<
+			std::setw(14) << function.exclusiveMemoryAccesses << "\n";
+	}
+
+	std::cout << "hottest call paths:\n";
+	for (const CallGraphPath& path : report.paths)
+	{
+		std::cout << std::setw(14) << path.exclusiveInstructions << std::setw(8) << GetPercent(path.exclusiveInstructions, report.retiredInstructions) << "%  ";
+		for (size_t i = 0; i < path.frames.size(); i++)
+		{
+			std::cout << (i == 0 ? "" : " > ") << path.frames[i];
+		}
+		std::cout << "  (" << path.calls << " calls, " << path.exclusiveMemoryAccesses << " memory accesses)\n";
+	}
+	std::cout << std::defaultfloat << std::flush;
+}
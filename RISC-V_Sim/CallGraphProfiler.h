@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Instruction.h"
+#include "DecodedProgram.h"
+#include "ElfSymbols.h"
+#include "CallTree.h"
+
+struct CallGraphFunction
+{
+	std::string name;
+	uint32_t address;
+	uint64_t calls;
+	//inclusive counts also have the functions it called, exclusive only its own.
+	//Recursive calls are only included once
+	uint64_t inclusiveInstructions;
+	uint64_t exclusiveInstructions;
+	uint64_t inclusiveMemoryAccesses;
+	uint64_t exclusiveMemoryAccesses;
+};
+
+struct CallGraphPath
+{
+	//the function names from the entry of the program to the function
+	std::vector<std::string> frames;
+	uint64_t calls;
+	uint64_t exclusiveInstructions;
+	uint64_t exclusiveMemoryAccesses;
+};
+
+struct CallGraphReport
+{
+	uint64_t retiredInstructions;
+	uint64_t memoryAccesses;
+	//the most instructions first
+	std::vector<CallGraphFunction> functions;
+	std::vector<CallGraphPath> paths;
+};
+
+//Counts every retired instruction and memory access and adds them to the function
+//they were run in. Calls and returns are followed with a CallTree, and the counts
+//are kept per node of it so the exact paths that were taken are known afterwards.
+//It's updated once per basic block which is where the jumps are, so it's cheap
+//enough to use for whole programs. The memory accesses of a block come from a
+//count made once per program
+class CallGraphProfiler
+{
+private:
+	CallTree callTree;
+	//the exclusive counts of every node in the call tree
+	std::vector<uint64_t> instructions;
+	std::vector<uint64_t> memoryAccesses;
+	std::shared_ptr<const DecodedProgram> countedProgram;
+	//the number of memory accesses before each instruction of the program
+	std::vector<uint32_t> memoryAccessesBefore;
+
+public:
+	CallGraphProfiler();
+
+	//makes the program entry the current function, done by the processor when a program is loaded
+	void StartProgram(const uint32_t entryPc);
+	//counts the memory accesses of the program if it hasn't been seen before
+	void UseProgram(const std::shared_ptr<const DecodedProgram>& program);
+	//called after a block of instructions has been run.
+	//nextPc is where the processor goes after the block
+	void ProfileBlock(const Instruction* block, const uint32_t firstIndex, const uint32_t length, const uint32_t nextPc)
+	{
+		const uint32_t node = callTree.GetCurrentNode();
+		instructions[node] += length;
+		memoryAccesses[node] += memoryAccessesBefore[firstIndex + length] - memoryAccessesBefore[firstIndex];
+
+		callTree.FollowJump(block[length - 1], nextPc);
+		if (callTree.GetNodeCount() > instructions.size())
+		{
+			instructions.resize(callTree.GetNodeCount());
+			memoryAccesses.resize(callTree.GetNodeCount());
+		}
+	}
+	//follows a call or return without counting anything, done outside of
+	//trace windows so the call stack is right when the next one opens
+	void FollowJump(const Instruction& instruction, const uint32_t nextPc)
+	{
+		callTree.FollowJump(instruction, nextPc, false);
+		if (callTree.GetNodeCount() > instructions.size())
+		{
+			instructions.resize(callTree.GetNodeCount());
+			memoryAccesses.resize(callTree.GetNodeCount());
+		}
+	}
+
+	CallGraphReport GetReport(const SymbolTable& symbols, const size_t pathCount) const;
+	//the exclusive instructions of every call path in the format flamegraph tools read
+	void WriteFoldedStacks(std::ostream& stream, const SymbolTable& symbols) const;
+	void Clear();
+};
+
+void PrintCallGraphReport(const CallGraphReport& report);
@@ -0,0 +1,118 @@
+#include "CallTree.h"
+#include <algorithm>
+
+//deep recursion would add a node for every level,
+//so calls past this depth stay in the deepest node
+static const uint32_t MAX_CALL_DEPTH = 512;
+
+CallTree::CallTree()
+{
+	Clear();
+}
+
+void CallTree::Start(const uint32_t entryPc)
+{
+	currentNode = 0;
+	depth = 0;
+	droppedCalls = 0;
+	nodes[0].address = entryPc;
+	nodes[0].calls++;
+}
+
+void CallTree::Call(const uint32_t address, const bool countCall)
+{
+	if (depth >= MAX_CALL_DEPTH)
+	{
+		droppedCalls++;
+		return;
+	}
+	depth++;
+
+	for (const uint32_t child : nodes[currentNode].children)
+	{
+		if (nodes[child].address == address)
+		{
+			currentNode = child;
+			nodes[child].calls += countCall ? 1 : 0;
+			return;
+		}
+	}
+
+	const uint32_t child = static_cast<uint32_t>(nodes.size());
+	nodes[currentNode].children.push_back(child);
+	CallNode node = {};
+	node.address = address;
+	node.parent = currentNode;
+	node.calls = countCall ? 1 : 0;
+	nodes.push_back(node);
+	currentNode = child;
+}
+
+void CallTree::Return()
+{
+	if (droppedCalls > 0)
+	{
+		droppedCalls--;
+	}
+	//a return from the entry function stays in the entry
+	else if (depth > 0)
+	{
+		currentNode = nodes[currentNode].parent;
+		depth--;
+	}
+}
+
+size_t CallTree::GetNodeCount() const
+{
+	return nodes.size();
+}
+
+uint32_t CallTree::GetAddress(const uint32_t node) const
+{
+	return nodes[node].address;
+}
+
+uint32_t CallTree::GetParent(const uint32_t node) const
+{
+	return nodes[node].parent;
+}
+
+uint64_t CallTree::GetCalls(const uint32_t node) const
+{
+	return nodes[node].calls;
+}
+
+std::vector<uint32_t> CallTree::GetPath(uint32_t node) const
+{
+	std::vector<uint32_t> path;
+	for (; node != NO_PARENT; node = nodes[node].parent)
+	{
+		path.push_back(node);
+	}
+	std::reverse(path.begin(), path.end());
+	return path;
+}
+
+std::vector<std::string> CallTree::GetFoldedNames(const SymbolTable& symbols) const
+{
+	//parents are always added before their children, so the
+	//names of the parent are there when a child needs them
+	std::vector<std::string> names(nodes.size());
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		const std::string name = symbols.GetName(nodes[i].address);
+		names[i] = nodes[i].parent == NO_PARENT ? name : names[nodes[i].parent] + ";" + name;
+	}
+	return names;
+}
+
+void CallTree::Clear()
+{
+	CallNode root = {};
+	root.parent = NO_PARENT;
+	nodes.clear();
+	nodes.push_back(root);
+	currentNode = 0;
+	depth = 0;
+	droppedCalls = 0;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Instruction.h"
+#include "Register.h"
+#include "ElfSymbols.h"
+
+//The tree of every call path a program has taken, and where in it the program is now.
+//jal and jalr that link through ra or t0 are calls and a jalr through them
+//that doesn't link is a return, like the calling convention in the RISC-V
+//specification. A node is made the first time a path is taken, so the
+//profilers can keep their counts per node instead of copying the call stack
+class CallTree
+{
+private:
+	struct CallNode
+	{
+		//the address of the first instruction of the function
+		uint32_t address;
+		uint32_t parent;
+		std::vector<uint32_t> children;
+		uint64_t calls;
+	};
+
+	std::vector<CallNode> nodes;
+	uint32_t currentNode;
+	uint32_t depth;
+	//calls that are deeper than the tree can be stay in the deepest node,
+	//and are counted so the returns from them don't leave it too early
+	uint64_t droppedCalls;
+
+	void Call(const uint32_t address, const bool countCall);
+	void Return();
+
+public:
+	static const uint32_t NO_PARENT = UINT32_MAX;
+
+	CallTree();
+
+	//makes the entry of the program the current function
+	void Start(const uint32_t entryPc);
+	//follows the instruction at the end of a block if it's a call or a return.
+	//nextPc is where the processor goes after it. The calls outside of
+	//trace windows are followed without being counted
+	void FollowJump(const Instruction& instruction, const uint32_t nextPc, const bool countCall = true)
+	{
+		if (instruction.type == InstructionType::jal || instruction.type == InstructionType::jalr)
+		{
+			if (IsLinkRegister(instruction.rd))
+			{
+				Call(nextPc, countCall);
+			}
+			else if (instruction.type == InstructionType::jalr && instruction.rd == 0 && IsLinkRegister(instruction.rs1))
+			{
+				Return();
+			}
+		}
+	}
+	static bool IsLinkRegister(const uint32_t reg)
+	{
+		return reg == static_cast<uint32_t>(Regs::ra) || reg == static_cast<uint32_t>(Regs::t0);
+	}
+
+	uint32_t GetCurrentNode() const
+	{
+		return currentNode;
+	}
+	size_t GetNodeCount() const;
+	uint32_t GetAddress(const uint32_t node) const;
+	uint32_t GetParent(const uint32_t node) const;
+	uint64_t GetCalls(const uint32_t node) const;
+	//the nodes from the entry of the program to the node
+	std::vector<uint32_t> GetPath(uint32_t node) const;
+	//for every node the names of the functions on its path, separated by ;
+	std::vector<std::string> GetFoldedNames(const SymbolTable& symbols) const;
+	void Clear();
+};
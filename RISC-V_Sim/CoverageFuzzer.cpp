@@ -0,0 +1,539 @@
+#include "CoverageFuzzer.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "BatchRunner.h"
+#include "DecodedProgram.h"
+#include "DecodeVerifier.h"
+#include "Instruction.h"
+#include "InstructionDecode.h"
+#include "InstructionEncode.h"
+#include "InstructionType.h"
+#include "Processor.h"
+#include "ProgramFileWriter.h"
+#include "RandomProgram.h"
+#include "ReadProgram.h"
+#include "RISCV_Program.h"
+#include "TSrandom.h"
+#include "WorkStealingPool.h"
+
+enum class FeatureKind : uint32_t
+{
+	Pc,
+	Edge,
+	DecodedType,
+	ExecutedType,
+	Outcome
+};
+
+//features are hashed into a map of this many bits, so two
+//features can share a bit but it's very unlikely to matter
+static const uint32_t FEATURE_MAP_BITS = 20;
+static const uint32_t FEATURE_MAP_SIZE = 1 << FEATURE_MAP_BITS;
+static const uint32_t VALID_OPCODES[] = { 0b0000011, 0b0001111, 0b0010011, 0b0010111, 0b0100011, 0b0101111, 0b0110011, 0b0110111, 0b1100011, 0b1100111, 0b1101111, 0b1110011 };
+static const int32_t INTERESTING_IMMEDIATES[] = { 0, 1, -1, 2, 4, 31, 32, 2047, -2048 };
+//the time limit and progress are only checked this often
+static const uint64_t EXECUTIONS_PER_CLOCK_CHECK = 256;
+
+struct FuzzerState
+{
+	std::unique_ptr<std::atomic<uint8_t>[]> features;
+	std::atomic<uint64_t> featureCounts[5];
+	std::mutex corpusLock;
+	std::vector<std::vector<uint32_t>> corpus;
+	std::atomic<uint64_t> executions;
+	std::atomic<uint64_t> findings;
+	std::atomic<bool> stop;
+	std::mutex findingLock;
+};
+
+static uint32_t HashFeature(const FeatureKind kind, const uint64_t value)
+{
+	//splitmix64 finalizer
+	uint64_t x = value + (static_cast<uint64_t>(kind) + 1) * 0x9e3779b97f4a7c15ull;
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+	x = x ^ (x >> 31);
+	return static_cast<uint32_t>(x) & (FEATURE_MAP_SIZE - 1);
+}
+
+//returns true if nobody had reached the feature before
+static bool AddFeature(FuzzerState& state, const FeatureKind kind, const uint64_t value)
+{
+	std::atomic<uint8_t>& feature = state.features[HashFeature(kind, value)];
+	//reading first means that features that are already known don't write to shared memory
+	if (feature.load(std::memory_order_relaxed) != 0 || feature.exchange(1, std::memory_order_relaxed) != 0)
+	{
+		return false;
+	}
+	state.featureCounts[static_cast<uint32_t>(kind)]++;
+	return true;
+}
+
+//every instruction type except ebreak, which RunInput replaces, and
+//the atomics that RandomizeInstruction can't create
+static const std::vector<InstructionType>& GetFuzzInstructionTypes()
+{
+	static const std::vector<InstructionType> types = []()
+	{
+		std::vector<InstructionType> found;
+		for (uint32_t i = 0; i < (1 << 16); i++)
+		{
+			const InstructionType type = static_cast<InstructionType>(i);
+			if (IsInstructionType(type) && type != InstructionType::ebreak && !IsAtomicInstruction(type))
+			{
+				found.push_back(type);
+			}
+		}
+		return found;
+	}();
+	return types;
+}
+
+static uint32_t RandomWord(FRandom::TCRandom& random)
+{
+	return static_cast<uint32_t>(FRandom::NextRandom(random));
+}
+
+static size_t RandomIndex(FRandom::TCRandom& random, const size_t size)
+{
+	return static_cast<size_t>(FRandom::NextRandom(random) % size);
+}
+
+static uint32_t RandomInstruction(FRandom::TCRandom& random)
+{
+	const std::vector<InstructionType>& types = GetFuzzInstructionTypes();
+	return RandomizeInstruction(types[RandomIndex(random, types.size())], random);
+}
+
+static void MutateOnce(std::vector<uint32_t>& input, const std::vector<uint32_t>& other, FRandom::TCRandom& random)
+{
+	//the mutations that change a word need a word to change
+	const uint32_t mutation = static_cast<uint32_t>(input.empty() ? RandomIndex(random, 3) : RandomIndex(random, 10));
+	const size_t position = RandomIndex(random, input.size() + 1);
+	const size_t index = input.empty() ? 0 : RandomIndex(random, input.size());
+	switch (mutation)
+	{
+		case 0:
+			input.insert(input.begin() + position, RandomInstruction(random));
+			break;
+		case 1:
+		{
+			//set a0 to 10 and exit, so inputs don't always end with an error
+			const uint32_t exit[] = { Create_addi(Regs::a0, Regs::x0, 10), Create_ecall() };
+			input.insert(input.begin() + position, std::begin(exit), std::end(exit));
+			break;
+		}
+		case 2:
+			//a part of another input
+			if (!other.empty())
+			{
+				const size_t first = RandomIndex(random, other.size());
+				const size_t count = 1 + RandomIndex(random, other.size() - first);
+				input.insert(input.begin() + position, other.begin() + first, other.begin() + first + count);
+			}
+			break;
+		case 3:
+			input[index] = RandomInstruction(random);
+			break;
+		case 4:
+			input[index] ^= 1u << RandomIndex(random, 32);
+			break;
+		case 5:
+		{
+			//mostly reaches the decoding of unknown funct fields
+			const uint32_t opcode = VALID_OPCODES[RandomIndex(random, std::size(VALID_OPCODES))];
+			input[index] = (RandomWord(random) & ~127u) | opcode;
+			break;
+		}
+		case 6:
+		{
+			//rd, rs1 or rs2
+			const uint32_t shift = std::array<uint32_t, 3>{ 7, 15, 20 }[RandomIndex(random, 3)];
+			input[index] = (input[index] & ~(31u << shift)) | (static_cast<uint32_t>(RandomIndex(random, 32)) << shift);
+			break;
+		}
+		case 7:
+		{
+			//the immediate of the I type instructions
+			const int32_t immediate = INTERESTING_IMMEDIATES[RandomIndex(random, std::size(INTERESTING_IMMEDIATES))];
+			input[index] = (input[index] & 0x000fffff) | (static_cast<uint32_t>(immediate) << 20);
+			break;
+		}
+		case 8:
+			input.erase(input.begin() + index);
+			break;
+		default:
+			input.insert(input.begin() + position, input[index]);
+			break;
+	}
+}
+
+static void MutateInput(std::vector<uint32_t>& input, const std::vector<uint32_t>& other, FRandom::TCRandom& random, const size_t maxWords)
+{
+	const uint32_t mutations = 1 + static_cast<uint32_t>(RandomIndex(random, 4));
+	for (uint32_t i = 0; i < mutations; i++)
+	{
+		MutateOnce(input, other, random);
+	}
+	if (input.size() > maxWords)
+	{
+		input.resize(maxWords);
+	}
+}
+
+//how a run ended, the details of an error are left
+//out so the same error at another address is the same outcome
+static std::string GetOutcome(const RunStatus status, const std::string& error)
+{
+	if (error.empty())
+	{
+		return std::to_string(static_cast<uint32_t>(status));
+	}
+	return error.substr(0, error.find_first_of(".\n"));
+}
+
+static std::string RunEngine(Processor& processor, const std::shared_ptr<const DecodedProgram>& program, const RunLimits& limits, RunStatus& status)
+{
+	try
+	{
+		processor.Load(program);
+		status = processor.Continue(limits);
+		return "";
+	}
+	catch (const std::exception& e)
+	{
+		return e.what();
+	}
+}
+
+static std::string CompareEngines(Processor& reference, Processor& threaded, const RunStatus referenceStatus, const RunStatus threadedStatus,
+								  const std::string& referenceError, const std::string& threadedError)
+{
+	if (referenceError != threadedError || (referenceError.empty() && referenceStatus != threadedStatus))
+	{
+		return "The engines stopped differently";
+	}
+	const HartState& referenceHart = reference.GetHartState();
+	const HartState& threadedHart = threaded.GetHartState();
+	if (referenceHart.pc != threadedHart.pc || referenceHart.retiredInstructions != threadedHart.retiredInstructions)
+	{
+		return "The engines stopped at a different place";
+	}
+	for (uint32_t i = 0; i < 32; i++)
+	{
+		if (referenceHart.registers[i].uword != threadedHart.registers[i].uword)
+		{
+			return "The engines ended with different registers";
+		}
+	}
+	return "";
+}
+
+//the first word that doesn't survive being decoded and encoded again
+static std::string CheckRoundTrip(const std::vector<uint32_t>& input)
+{
+	for (const uint32_t word : input)
+	{
+		if (VerifyInstructionWord(word) == DecodeVerdict::Mismatch)
+		{
+			return "A word doesn't encode back to the instruction it was decoded as: " + std::to_string(word);
+		}
+	}
+	return "";
+}
+
+static void SaveInput(const std::string& filepath, const std::vector<uint32_t>& input)
+{
+	//the input can have words that aren't instructions, so there is no assembly file
+	ProgramFileWriter writer(filepath, false);
+	writer.AddInstructions(input.data(), input.size());
+	writer.Close();
+}
+
+class FuzzWorker
+{
+private:
+	const CoverageFuzzOptions& options;
+	FuzzerState& state;
+	FRandom::TCRandom random;
+	Processor reference;
+	Processor threaded;
+	RunLimits limits;
+	std::vector<uint32_t> blockLog;
+	std::vector<uint32_t> programWords;
+
+	//adds the features of the run to the map and returns how many of them were new
+	uint32_t AddRunFeatures(const DecodedProgram& program, const std::string& outcome)
+	{
+		uint32_t newFeatures = AddFeature(state, FeatureKind::Outcome, std::hash<std::string>()(outcome));
+		const Instruction* instructions = program.GetInstructions();
+		uint64_t previousBlock = UINT32_MAX;
+		for (const uint32_t block : blockLog)
+		{
+			newFeatures += AddFeature(state, FeatureKind::Pc, block);
+			newFeatures += AddFeature(state, FeatureKind::Edge, (previousBlock << 32) | block);
+			previousBlock = block;
+			//the whole block counts as executed, even if the run stopped inside it
+			const uint32_t blockEnd = block + program.GetBlockLength(block);
+			for (uint32_t i = block; i < blockEnd; i++)
+			{
+				newFeatures += AddFeature(state, FeatureKind::ExecutedType, static_cast<uint16_t>(instructions[i].type));
+			}
+		}
+		return newFeatures;
+	}
+
+	//runs the input and returns why it's a finding, or an empty string if it isn't.
+	//ebreaks in the input are replaced with nops, both in mutated inputs and in
+	//seeds, as they would stop every run before it got to the code after them
+	std::string RunInput(std::vector<uint32_t>& input, uint32_t& newFeatures)
+	{
+		newFeatures = 0;
+		bool decodes = true;
+		for (uint32_t& word : input)
+		{
+			Instruction decoded;
+			if (TryDecodeInstruction(word, decoded))
+			{
+				if (decoded.type == InstructionType::ebreak)
+				{
+					word = Create_addi(Regs::x0, Regs::x0, 0);
+					decoded.type = InstructionType::addi;
+				}
+				newFeatures += AddFeature(state, FeatureKind::DecodedType, static_cast<uint16_t>(decoded.type));
+			}
+			else
+			{
+				decodes = false;
+			}
+		}
+		//throwing is much slower than running a short program, so the
+		//errors that are expected to be common are avoided up front
+		if (!decodes)
+		{
+			newFeatures += AddFeature(state, FeatureKind::Outcome, std::hash<std::string>()("Invalid opcode"));
+			return "";
+		}
+
+		//runs that get to the end of the input exit instead of throwing
+		programWords.assign(input.begin(), input.end());
+		programWords.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+		programWords.push_back(Create_ecall());
+		const std::shared_ptr<const DecodedProgram> program = DecodeProgram(programWords.data(), programWords.size());
+
+		blockLog.clear();
+		RunStatus referenceStatus = RunStatus::Exited;
+		RunStatus threadedStatus = RunStatus::Exited;
+		const std::string referenceError = RunEngine(reference, program, limits, referenceStatus);
+		const std::string threadedError = RunEngine(threaded, program, limits, threadedStatus);
+		newFeatures += AddRunFeatures(*program, GetOutcome(referenceStatus, referenceError));
+
+		return CompareEngines(reference, threaded, referenceStatus, threadedStatus, referenceError, threadedError);
+	}
+
+	void AddToCorpus(const std::vector<uint32_t>& input)
+	{
+		size_t corpusIndex;
+		{
+			std::lock_guard<std::mutex> guard(state.corpusLock);
+			corpusIndex = state.corpus.size();
+			state.corpus.push_back(input);
+		}
+		if (!options.corpusDirectory.empty())
+		{
+			SaveInput(options.corpusDirectory + "/input_" + std::to_string(options.seed) + "_" + std::to_string(corpusIndex), input);
+		}
+	}
+
+	void SaveFinding(const std::vector<uint32_t>& input, const std::string& reason)
+	{
+		std::lock_guard<std::mutex> guard(state.findingLock);
+		const std::string name = "finding_" + std::to_string(options.seed) + "_" + std::to_string(state.findings++);
+		std::filesystem::create_directories(options.findingsDirectory);
+		SaveInput(options.findingsDirectory + "/" + name, input);
+		std::ofstream(options.findingsDirectory + "/findings.txt", std::ios::app) << name << ": " << reason << "\n";
+		std::cout << "Finding: " << name << ": " << reason << std::endl;
+	}
+
+public:
+	FuzzWorker(const CoverageFuzzOptions& fuzzOptions, FuzzerState& fuzzerState, const uint64_t workerIndex) :
+		options(fuzzOptions), state(fuzzerState), random(FRandom::CreateTCRandom(fuzzOptions.seed, workerIndex))
+	{
+		threaded.SetEngine(ExecutionEngine::Threaded);
+		reference.SetBlockLog(&blockLog);
+		limits.maxInstructions = options.maxInstructions;
+	}
+
+	void RunSeed(std::vector<uint32_t>& input)
+	{
+		uint32_t newFeatures;
+		RunInput(input, newFeatures);
+	}
+
+	//returns false when the fuzzer should stop
+	bool RunOnce()
+	{
+		const uint64_t execution = state.executions++;
+		if (state.stop || (options.executions != 0 && execution >= options.executions))
+		{
+			return false;
+		}
+
+		std::vector<uint32_t> input;
+		std::vector<uint32_t> other;
+		{
+			std::lock_guard<std::mutex> guard(state.corpusLock);
+			input = state.corpus[RandomIndex(random, state.corpus.size())];
+			other = state.corpus[RandomIndex(random, state.corpus.size())];
+		}
+		MutateInput(input, other, random, options.maxInputWords);
+
+		uint32_t newFeatures;
+		std::string finding = RunInput(input, newFeatures);
+		if (newFeatures != 0)
+		{
+			//checking the round trip of every word is too slow to do for every input
+			if (finding.empty())
+			{
+				finding = CheckRoundTrip(input);
+			}
+			AddToCorpus(input);
+		}
+		if (!finding.empty())
+		{
+			SaveFinding(input, finding);
+		}
+		return true;
+	}
+};
+
+static std::vector<std::vector<uint32_t>> CreateSeedInputs(const CoverageFuzzOptions& options)
+{
+	std::vector<std::vector<uint32_t>> seeds;
+	seeds.push_back({ Create_addi(Regs::a0, Regs::x0, 10), Create_ecall() });
+
+	if (!options.corpusDirectory.empty() && std::filesystem::is_directory(options.corpusDirectory))
+	{
+		for (const std::string& path : FindBatchPrograms(options.corpusDirectory))
+		{
+			try
+			{
+				seeds.push_back(LoadProgram(path, false)->GetInstructions());
+			}
+			catch (const std::exception& e)
+			{
+				std::cout << "Skipping " << path << ": " << e.what() << std::endl;
+			}
+		}
+	}
+	return seeds;
+}
+
+CoverageFuzzReport RunCoverageFuzzer(const CoverageFuzzOptions& options)
+{
+	FuzzerState state;
+	state.features = std::unique_ptr<std::atomic<uint8_t>[]>(new std::atomic<uint8_t>[FEATURE_MAP_SIZE]());
+	for (std::atomic<uint64_t>& count : state.featureCounts)
+	{
+		count = 0;
+	}
+	state.executions = 0;
+	state.findings = 0;
+	state.stop = false;
+	if (!options.corpusDirectory.empty())
+	{
+		std::filesystem::create_directories(options.corpusDirectory);
+	}
+
+	WorkStealingPool pool(options.threadCount);
+	const size_t workerCount = pool.GetThreadCount();
+
+	//the seeds are always kept, even if they don't reach anything new
+	{
+		FuzzWorker seedRunner(options, state, workerCount);
+		for (std::vector<uint32_t>& seed : CreateSeedInputs(options))
+		{
+			seedRunner.RunSeed(seed);
+			state.corpus.push_back(seed);
+		}
+	}
+
+	const auto startTime = std::chrono::steady_clock::now();
+	const auto elapsedSeconds = [&]()
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+	};
+	const auto printProgress = [&]()
+	{
+		const double seconds = elapsedSeconds();
+		const uint64_t executions = std::min<uint64_t>(state.executions, options.executions == 0 ? UINT64_MAX : options.executions);
+		std::lock_guard<std::mutex> guard(state.corpusLock);
+		std::cout << executions << " executions, " << executions / seconds << " exec/s, corpus " << state.corpus.size() <<
+			", pcs " << state.featureCounts[static_cast<uint32_t>(FeatureKind::Pc)] <<
+			", edges " << state.featureCounts[static_cast<uint32_t>(FeatureKind::Edge)] <<
+			", findings " << state.findings << std::endl;
+	};
+
+	//every task is a worker that runs until the fuzzer stops
+	pool.ParallelFor(workerCount, [&](const size_t workerIndex, const size_t)
+	{
+		FuzzWorker worker(options, state, workerIndex);
+		auto lastProgress = std::chrono::steady_clock::now();
+		for (uint64_t i = 1; worker.RunOnce(); i++)
+		{
+			if (i % EXECUTIONS_PER_CLOCK_CHECK != 0)
+			{
+				continue;
+			}
+			if (options.seconds != 0 && elapsedSeconds() >= options.seconds)
+			{
+				state.stop = true;
+			}
+			const auto now = std::chrono::steady_clock::now();
+			if (workerIndex == 0 && options.printProgress && now - lastProgress >= std::chrono::seconds(1))
+			{
+				lastProgress = now;
+				printProgress();
+			}
+		}
+	});
+
+	CoverageFuzzReport report;
+	report.executions = std::min<uint64_t>(state.executions, options.executions == 0 ? UINT64_MAX : options.executions);
+	report.corpusSize = state.corpus.size();
+	report.pcs = state.featureCounts[static_cast<uint32_t>(FeatureKind::Pc)];
+	report.edges = state.featureCounts[static_cast<uint32_t>(FeatureKind::Edge)];
+	report.decodedTypes = state.featureCounts[static_cast<uint32_t>(FeatureKind::DecodedType)];
+	report.executedTypes = state.featureCounts[static_cast<uint32_t>(FeatureKind::ExecutedType)];
+	report.outcomes = state.featureCounts[static_cast<uint32_t>(FeatureKind::Outcome)];
+	report.findings = state.findings;
+	report.seconds = elapsedSeconds();
+	return report;
+}
+
+void PrintCoverageFuzzReport(const CoverageFuzzReport& report)
+{
+	std::cout << "executions:     " << report.executions << "\n";
+	std::cout << "exec/s:         " << report.executions / report.seconds << "\n";
+	std::cout << "corpus:         " << report.corpusSize << "\n";
+	std::cout << "pcs:            " << report.pcs << "\n";
+	std::cout << "edges:          " << report.edges << "\n";
+	std::cout << "decoded types:  " << report.decodedTypes << "\n";
+	std::cout << "executed types: " << report.executedTypes << "\n";
+	std::cout << "outcomes:       " << report.outcomes << "\n";
+	std::cout << "findings:       " << report.findings << "\n";
+	std::cout << "time:           " << report.seconds << " s" << std::endl;
+}
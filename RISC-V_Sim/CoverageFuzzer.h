@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct CoverageFuzzOptions
+{
+	uint64_t seed = 1;
+	//the fuzzer stops when either limit is reached, 0 means no limit
+	uint64_t executions = 0;
+	double seconds = 0;
+	//inputs are cut to this many words after they are mutated
+	size_t maxInputWords = 64;
+	//inputs can loop forever, so every run is stopped after this many instructions
+	uint64_t maxInstructions = 1000;
+	//0 means one thread per hardware thread
+	size_t threadCount = 0;
+	//inputs that reach new coverage are saved here, and the programs already
+	//in it are used as the first inputs. Nothing is saved when it's empty
+	std::string corpusDirectory;
+	//inputs that make the engines disagree or break the decoder round trip
+	std::string findingsDirectory = "fuzz_findings";
+	bool printProgress = true;
+};
+
+struct CoverageFuzzReport
+{
+	uint64_t executions;
+	uint64_t corpusSize;
+	//the number of distinct guest pcs, block transitions and instruction types that were reached
+	uint64_t pcs;
+	uint64_t edges;
+	uint64_t decodedTypes;
+	uint64_t executedTypes;
+	uint64_t outcomes;
+	uint64_t findings;
+	double seconds;
+};
+
+//Runs arbitrary instruction words through the decoder and short runs on the
+//reference and threaded engines. Inputs are mutated from a corpus, and an input
+//is added to the corpus when it reaches coverage that no input reached before.
+//A finding is an input where the engines end in a different state, or where
+//a word doesn't encode back to what it was decoded from.
+CoverageFuzzReport RunCoverageFuzzer(const CoverageFuzzOptions& options);
+void PrintCoverageFuzzReport(const CoverageFuzzReport& report);
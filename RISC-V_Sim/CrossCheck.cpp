@@ -0,0 +1,259 @@
+#include "CrossCheck.h"
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Instruction.h"
+#include "Processor.h"
+#include "ReadProgram.h"
+#include "RISCV_Program.h"
+#include "Register.h"
+#include "WorkStealingPool.h"
+
+//how an engine has stopped running the program, if it has
+struct EngineState
+{
+	bool stopped;
+	RunStatus status;
+	std::string error;
+};
+
+static void StepEngine(Processor& processor, const uint64_t instructions, EngineState& state)
+{
+	try
+	{
+		state.status = processor.Continue(instructions);
+		state.stopped = state.status != RunStatus::InstructionLimit;
+	}
+	catch (const std::exception& e)
+	{
+		state.stopped = true;
+		state.error = e.what();
+	}
+}
+
+static std::string DescribeState(const EngineState& state)
+{
+	if (!state.error.empty())
+	{
+		return "threw \"" + state.error + "\"";
+	}
+	if (!state.stopped)
+	{
+		return "is still running";
+	}
+	switch (state.status)
+	{
+		case RunStatus::Exited:
+			return "exited";
+		case RunStatus::InstructionLimit:
+			return "reached the instruction limit";
+		case RunStatus::Timeout:
+			return "timed out";
+		case RunStatus::AtomicPending:
+			return "stopped before an atomic instruction";
+		case RunStatus::BreakpointReached:
+			return "stopped at a breakpoint";
+		case RunStatus::WatchpointReached:
+			return "stopped at a watchpoint";
+		default:
+			return "stopped";
+	}
+}
+
+//the memory buffers are passed in so they aren't allocated for every comparison
+static std::string FindDifference(Processor& reference, Processor& threaded, const EngineState& referenceState, const EngineState& threadedState,
+								  const bool compareMemory, std::vector<uint8_t>& referenceMemory, std::vector<uint8_t>& threadedMemory)
+{
+	if (referenceState.stopped != threadedState.stopped ||
+		referenceState.status != threadedState.status ||
+		referenceState.error != threadedState.error)
+	{
+		return "reference " + DescribeState(referenceState) + ", threaded " + DescribeState(threadedState);
+	}
+
+	const HartState& referenceHart = reference.GetHartState();
+	const HartState& threadedHart = threaded.GetHartState();
+	if (referenceHart.pc != threadedHart.pc)
+	{
+		return "pc: reference " + std::to_string(referenceHart.pc) + ", threaded " + std::to_string(threadedHart.pc);
+	}
+	for (uint32_t i = 0; i < 32; i++)
+	{
+		if (referenceHart.registers[i].uword != threadedHart.registers[i].uword)
+		{
+			return RegisterName(i) + ": reference " + std::to_string(referenceHart.registers[i].uword) + ", threaded " + std::to_string(threadedHart.registers[i].uword);
+		}
+	}
+	if (referenceHart.retiredInstructions != threadedHart.retiredInstructions)
+	{
+		return "retired instructions: reference " + std::to_string(referenceHart.retiredInstructions) + ", threaded " + std::to_string(threadedHart.retiredInstructions);
+	}
+
+	if (compareMemory)
+	{
+		reference.CopyMemoryTo(0, Processor::GetMemorySize(), referenceMemory.data());
+		threaded.CopyMemoryTo(0, Processor::GetMemorySize(), threadedMemory.data());
+		const auto mismatch = std::mismatch(referenceMemory.begin(), referenceMemory.end(), threadedMemory.begin());
+		if (mismatch.first != referenceMemory.end())
+		{
+			const size_t address = mismatch.first - referenceMemory.begin();
+			return "memory at address " + std::to_string(address) + ": reference " + std::to_string(*mismatch.first) + ", threaded " + std::to_string(*mismatch.second);
+		}
+	}
+
+	return "";
+}
+
+//Runs both engines again from the start up to where they last agreed and then one
+//instruction at a time, comparing everything, until they diverge
+static void FindDivergentInstruction(const std::shared_ptr<const DecodedProgram>& program, const uint64_t agreedInstructions, const uint64_t maxInstructions,
+									 Processor& reference, Processor& threaded, std::vector<uint8_t>& referenceMemory, std::vector<uint8_t>& threadedMemory, CrossCheckResult& result)
+{
+	EngineState referenceState = {};
+	EngineState threadedState = {};
+	reference.Load(program);
+	threaded.Load(program);
+	if (agreedInstructions > 0)
+	{
+		StepEngine(reference, agreedInstructions, referenceState);
+		StepEngine(threaded, agreedInstructions, threadedState);
+	}
+
+	while (!referenceState.stopped && reference.GetHartState().retiredInstructions < maxInstructions)
+	{
+		const uint32_t pc = reference.GetHartState().pc;
+		const uint64_t retired = reference.GetHartState().retiredInstructions;
+		StepEngine(reference, 1, referenceState);
+		StepEngine(threaded, 1, threadedState);
+
+		const std::string difference = FindDifference(reference, threaded, referenceState, threadedState, true, referenceMemory, threadedMemory);
+		if (!difference.empty())
+		{
+			result.retiredInstructions = retired;
+			result.pc = pc;
+			result.difference = difference;
+			const uint32_t instructionIndex = pc / 4;
+			if (instructionIndex < program->GetInstructionCount())
+			{
+				result.instruction = InstructionAsString(program->GetInstructions()[instructionIndex]);
+			}
+			return;
+		}
+	}
+}
+
+CrossCheckResult CrossCheckProgram(const std::shared_ptr<const DecodedProgram>& program, const CrossCheckOptions& options, Processor& reference, Processor& threaded)
+{
+	reference.SetEngine(ExecutionEngine::Reference);
+	threaded.SetEngine(ExecutionEngine::Threaded);
+	reference.Load(program);
+	threaded.Load(program);
+
+	CrossCheckResult result = {};
+	std::vector<uint8_t> referenceMemory(Processor::GetMemorySize());
+	std::vector<uint8_t> threadedMemory(Processor::GetMemorySize());
+	EngineState referenceState = {};
+	EngineState threadedState = {};
+	uint64_t agreedInstructions = 0;
+
+	while (true)
+	{
+		const HartState& hart = reference.GetHartState();
+		const uint64_t remaining = options.maxInstructions - hart.retiredInstructions;
+		uint64_t step = options.interval;
+		if (step == 0)
+		{
+			//a pc outside the program throws no matter how many instructions are run
+			const uint32_t instructionIndex = hart.pc / 4;
+			step = instructionIndex < program->GetInstructionCount() ? program->GetBlockLength(instructionIndex) : 1;
+		}
+		step = std::min(step, remaining);
+
+		StepEngine(reference, step, referenceState);
+		StepEngine(threaded, step, threadedState);
+		result.comparisons++;
+
+		//the instruction limit counts as stopping, so the memory is compared at the end
+		const bool stopped = referenceState.stopped || reference.GetHartState().retiredInstructions >= options.maxInstructions;
+		const std::string difference = FindDifference(reference, threaded, referenceState, threadedState, options.compareMemory || stopped, referenceMemory, threadedMemory);
+		if (!difference.empty())
+		{
+			result.diverged = true;
+			result.difference = difference;
+			result.retiredInstructions = agreedInstructions;
+			FindDivergentInstruction(program, agreedInstructions, options.maxInstructions, reference, threaded, referenceMemory, threadedMemory, result);
+			break;
+		}
+
+		agreedInstructions = reference.GetHartState().retiredInstructions;
+		if (stopped)
+		{
+			result.retiredInstructions = agreedInstructions;
+			break;
+		}
+	}
+
+	result.status = referenceState.stopped ? referenceState.status : RunStatus::InstructionLimit;
+	result.error = referenceState.error;
+	return result;
+}
+
+std::vector<CrossCheckResult> CrossCheckPrograms(const std::vector<std::string>& programPaths, const CrossCheckOptions& options, const size_t threadCount)
+{
+	WorkStealingPool pool(threadCount);
+	std::vector<std::unique_ptr<Processor>> processors(pool.GetThreadCount() * 2);
+	for (std::unique_ptr<Processor>& processor : processors)
+	{
+		processor = std::make_unique<Processor>();
+	}
+
+	std::vector<CrossCheckResult> results(programPaths.size());
+	pool.ParallelFor(programPaths.size(), [&](const size_t index, const size_t workerIndex)
+	{
+		try
+		{
+			std::unique_ptr<RISCV_Program> program = LoadProgram(programPaths[index], false);
+			results[index] = CrossCheckProgram(program->GetDecodedProgram(), options, *processors[workerIndex * 2], *processors[workerIndex * 2 + 1]);
+		}
+		catch (const std::exception& e)
+		{
+			//a program that can't be loaded can't diverge, but it shouldn't look like it passed either
+			results[index] = {};
+			results[index].loadError = e.what();
+		}
+		results[index].programPath = programPaths[index];
+	});
+
+	return results;
+}
+
+void PrintCrossCheckResult(const CrossCheckResult& result)
+{
+	if (!result.loadError.empty())
+	{
+		std::cout << result.programPath << ": failed to load: " << result.loadError << std::endl;
+		return;
+	}
+	if (!result.diverged)
+	{
+		std::cout << result.programPath << ": no divergence in " << result.retiredInstructions << " instructions";
+		//both engines threw the same error, which is only interesting if it wasn't expected
+		if (!result.error.empty())
+		{
+			std::cout << ", stopped with: " << result.error.substr(0, result.error.find('\n'));
+		}
+		std::cout << std::endl;
+		return;
+	}
+
+	std::cout << result.programPath << ": diverged after " << result.retiredInstructions << " instructions" << std::endl;
+	if (!result.instruction.empty())
+	{
+		std::cout << "  pc " << result.pc << " (instruction " << result.pc / 4 << "): " << result.instruction << std::endl;
+	}
+	std::cout << "  " << result.difference << std::endl;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Processor.h"
+#include "DecodedProgram.h"
+
+struct CrossCheckOptions
+{
+	//number of instructions between each comparison,
+	//0 means that they are compared after every basic block
+	uint64_t interval = 0;
+	uint64_t maxInstructions = 10'000'000;
+	//memory is always compared when the program stops,
+	//this also compares it every time the registers are compared
+	bool compareMemory = false;
+};
+
+struct CrossCheckResult
+{
+	std::string programPath;
+	bool diverged;
+	//how the reference engine stopped the program, error is set if it threw
+	RunStatus status;
+	std::string error;
+	//set if the program couldn't be loaded, then it wasn't run at all
+	std::string loadError;
+	uint64_t retiredInstructions;
+	uint64_t comparisons;
+	//where the engines diverged, only set if they did
+	uint32_t pc;
+	std::string instruction;
+	std::string difference;
+};
+
+//Runs a program on the reference engine and the threaded engine side by side
+//and compares their state as they go. When they diverge, both are run again
+//up to the last point where they agreed and then one instruction at a time,
+//so the result says exactly which instruction was run differently.
+CrossCheckResult CrossCheckProgram(const std::shared_ptr<const DecodedProgram>& program, const CrossCheckOptions& options, Processor& reference, Processor& threaded);
+std::vector<CrossCheckResult> CrossCheckPrograms(const std::vector<std::string>& programPaths, const CrossCheckOptions& options, const size_t threadCount = 0);
+void PrintCrossCheckResult(const CrossCheckResult& result);
@@ -0,0 +1,239 @@
+#include "DecodeVerifier.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Instruction.h"
+#include "InstructionDecode.h"
+#include "InstructionEncode.h"
+#include "InstructionType.h"
+#include "WorkStealingPool.h"
+
+static const size_t MAX_REPORTED_MISMATCHES = 16;
+//words are checked in chunks this big so the threads can steal work from each other
+static const uint64_t WORDS_PER_CHUNK = 1 << 16;
+//the type is 16 bits, so every type has its own counter
+static const size_t TYPE_COUNT = 1 << 16;
+
+//the operands that the instruction doesn't use are still decoded,
+//but they can't be expected to survive being encoded again
+static bool IsSameInstruction(const Instruction& a, const Instruction& b)
+{
+	if (a.type != b.type)
+	{
+		return false;
+	}
+	switch (a.type)
+	{
+		case InstructionType::fence:
+		case InstructionType::fence_i:
+		case InstructionType::ecall:
+		case InstructionType::ebreak:
+			return true;
+		case InstructionType::lr_w:
+			return a.rd == b.rd && a.rs1 == b.rs1 && a.immediate == b.immediate;
+		default:
+			return a.rd == b.rd && a.rs1 == b.rs1 && a.rs2 == b.rs2 && a.immediate == b.immediate;
+	}
+}
+
+static DecodeVerdict VerifyDecodedWord(const uint32_t word, const Instruction& decoded)
+{
+	uint32_t encoded;
+	try
+	{
+		encoded = EncodeInstruction(decoded);
+	}
+	catch (const std::exception&)
+	{
+		return DecodeVerdict::NotEncodable;
+	}
+	if (encoded == word)
+	{
+		return DecodeVerdict::RoundTrip;
+	}
+
+	Instruction decodedAgain;
+	if (TryDecodeInstruction(encoded, decodedAgain) && IsSameInstruction(decoded, decodedAgain))
+	{
+		return DecodeVerdict::IgnoredBits;
+	}
+	return DecodeVerdict::Mismatch;
+}
+
+static DecodeVerdict VerifyWord(const uint32_t word, Instruction& decoded)
+{
+	//most words don't have a valid opcode, so they have to be rejected without throwing
+	if (!TryDecodeInstruction(word, decoded))
+	{
+		return DecodeVerdict::InvalidOpcode;
+	}
+	if (!IsInstructionType(decoded.type))
+	{
+		return DecodeVerdict::UnknownInstruction;
+	}
+	return VerifyDecodedWord(word, decoded);
+}
+
+DecodeVerdict VerifyInstructionWord(const uint32_t word)
+{
+	Instruction decoded;
+	return VerifyWord(word, decoded);
+}
+
+static DecodeVerifyReport CreateEmptyReport()
+{
+	DecodeVerifyReport report = {};
+	report.roundTrips.resize(TYPE_COUNT);
+	report.ignoredBits.resize(TYPE_COUNT);
+	return report;
+}
+
+static void AddToReport(DecodeVerifyReport& report, const DecodeVerdict verdict, const uint32_t word)
+{
+	const uint32_t index = static_cast<uint32_t>(verdict);
+	//words are checked in increasing order within a report, so the first one is the lowest
+	if (report.verdicts[index] == 0)
+	{
+		report.examples[index] = word;
+	}
+	report.verdicts[index]++;
+	if (verdict == DecodeVerdict::Mismatch && report.mismatches.size() < MAX_REPORTED_MISMATCHES)
+	{
+		report.mismatches.push_back(word);
+	}
+}
+
+static void VerifyWords(const uint64_t firstWord, const uint64_t lastWord, DecodeVerifyReport& report)
+{
+	for (uint64_t i = firstWord; i < lastWord; i++)
+	{
+		const uint32_t word = static_cast<uint32_t>(i);
+		Instruction decoded;
+		const DecodeVerdict verdict = VerifyWord(word, decoded);
+		if (verdict == DecodeVerdict::RoundTrip)
+		{
+			report.roundTrips[static_cast<uint16_t>(decoded.type)]++;
+		}
+		else if (verdict == DecodeVerdict::IgnoredBits)
+		{
+			report.ignoredBits[static_cast<uint16_t>(decoded.type)]++;
+		}
+		AddToReport(report, verdict, word);
+	}
+}
+
+static void MergeReport(DecodeVerifyReport& into, const DecodeVerifyReport& from)
+{
+	into.words += from.words;
+	for (uint32_t i = 0; i < DECODE_VERDICT_COUNT; i++)
+	{
+		if (from.verdicts[i] != 0 && (into.verdicts[i] == 0 || from.examples[i] < into.examples[i]))
+		{
+			into.examples[i] = from.examples[i];
+		}
+		into.verdicts[i] += from.verdicts[i];
+	}
+	for (size_t i = 0; i < TYPE_COUNT; i++)
+	{
+		into.roundTrips[i] += from.roundTrips[i];
+		into.ignoredBits[i] += from.ignoredBits[i];
+	}
+	into.mismatches.insert(into.mismatches.end(), from.mismatches.begin(), from.mismatches.end());
+}
+
+DecodeVerifyReport VerifyEncodeDecode(const uint64_t firstWord, const uint64_t wordCount, const size_t threadCount)
+{
+	const uint64_t lastWord = std::min(firstWord + wordCount, uint64_t(1) << 32);
+	const uint64_t chunkCount = (lastWord - firstWord + WORDS_PER_CHUNK - 1) / WORDS_PER_CHUNK;
+	const auto startTime = std::chrono::steady_clock::now();
+
+	//each worker has its own report so nothing is shared while checking
+	WorkStealingPool pool(threadCount);
+	std::vector<DecodeVerifyReport> workerReports(pool.GetThreadCount(), CreateEmptyReport());
+	pool.ParallelFor(chunkCount, [&](const size_t chunk, const size_t workerIndex)
+	{
+		const uint64_t chunkFirst = firstWord + chunk * WORDS_PER_CHUNK;
+		const uint64_t chunkLast = std::min(chunkFirst + WORDS_PER_CHUNK, lastWord);
+		VerifyWords(chunkFirst, chunkLast, workerReports[workerIndex]);
+		workerReports[workerIndex].words += chunkLast - chunkFirst;
+	});
+
+	DecodeVerifyReport report = CreateEmptyReport();
+	for (const DecodeVerifyReport& workerReport : workerReports)
+	{
+		MergeReport(report, workerReport);
+	}
+	std::sort(report.mismatches.begin(), report.mismatches.end());
+	if (report.mismatches.size() > MAX_REPORTED_MISMATCHES)
+	{
+		report.mismatches.resize(MAX_REPORTED_MISMATCHES);
+	}
+	report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+	return report;
+}
+
+const char* DecodeVerdictName(const DecodeVerdict verdict)
+{
+	switch (verdict)
+	{
+		case DecodeVerdict::RoundTrip:
+			return "round trip";
+		case DecodeVerdict::IgnoredBits:
+			return "ignored bits";
+		case DecodeVerdict::InvalidOpcode:
+			return "invalid opcode";
+		case DecodeVerdict::UnknownInstruction:
+			return "unknown instruction";
+		case DecodeVerdict::NotEncodable:
+			return "not encodable";
+		case DecodeVerdict::Mismatch:
+			return "mismatch";
+		default:
+			return "unknown";
+	}
+}
+
+static std::string WordAsHex(const uint32_t word)
+{
+	std::ostringstream stream;
+	stream << "0x" << std::hex << std::setw(8) << std::setfill('0') << word;
+	return stream.str();
+}
+
+void PrintDecodeVerifyReport(const DecodeVerifyReport& report)
+{
+	std::cout << "Checked " << report.words << " words in " << report.seconds << " s" << std::endl;
+	for (uint32_t i = 0; i < DECODE_VERDICT_COUNT; i++)
+	{
+		std::cout << std::left << std::setw(21) << DecodeVerdictName(static_cast<DecodeVerdict>(i)) << std::right << std::setw(12) << report.verdicts[i];
+		if (report.verdicts[i] != 0)
+		{
+			std::cout << "  first: " << WordAsHex(report.examples[i]);
+		}
+		std::cout << std::endl;
+	}
+
+	std::cout << "\nper instruction:          round trip   ignored bits" << std::endl;
+	for (size_t i = 0; i < TYPE_COUNT; i++)
+	{
+		if (report.roundTrips[i] != 0 || report.ignoredBits[i] != 0)
+		{
+			std::cout << std::left << std::setw(21) << GetNameOfInstructionType(static_cast<InstructionType>(i)) << std::right
+					  << std::setw(15) << report.roundTrips[i] << std::setw(15) << report.ignoredBits[i] << std::endl;
+		}
+	}
+
+	for (const uint32_t word : report.mismatches)
+	{
+		Instruction decoded;
+		TryDecodeInstruction(word, decoded);
+		const uint32_t encoded = EncodeInstruction(decoded);
+		std::cout << "mismatch: " << WordAsHex(word) << " " << InstructionAsString(decoded) << " encodes as " << WordAsHex(encoded) << std::endl;
+	}
+}
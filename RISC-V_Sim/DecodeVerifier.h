@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class DecodeVerdict
+{
+	//decodes to an instruction that encodes back to the same word
+	RoundTrip,
+	//decodes to an instruction, but the word has bits set that the decoder ignores,
+	//so encoding the instruction gives a different word that decodes to the same instruction
+	IgnoredBits,
+	//the opcode isn't one the decoder knows
+	InvalidOpcode,
+	//the opcode is known but the funct fields don't belong to any instruction
+	UnknownInstruction,
+	//decodes to an instruction that the encoder refuses to encode
+	NotEncodable,
+	//encoding the decoded instruction gives a word that decodes to something else.
+	//This is always a bug in the encoder or the decoder
+	Mismatch
+};
+const uint32_t DECODE_VERDICT_COUNT = 6;
+
+struct DecodeVerifyReport
+{
+	uint64_t words;
+	uint64_t verdicts[DECODE_VERDICT_COUNT];
+	//the lowest word with each verdict, only set when there is one
+	uint32_t examples[DECODE_VERDICT_COUNT];
+	//round trips and ignored bits for each instruction type, indexed by the type
+	std::vector<uint64_t> roundTrips;
+	std::vector<uint64_t> ignoredBits;
+	//the lowest mismatching words, at most MAX_REPORTED_MISMATCHES of them
+	std::vector<uint32_t> mismatches;
+	double seconds;
+};
+
+DecodeVerdict VerifyInstructionWord(const uint32_t word);
+//Checks every word in [firstWord, firstWord + wordCount), which is
+//the whole 32 bit instruction space by default, on all threads
+DecodeVerifyReport VerifyEncodeDecode(const uint64_t firstWord = 0, const uint64_t wordCount = uint64_t(1) << 32, const size_t threadCount = 0);
+void PrintDecodeVerifyReport(const DecodeVerifyReport& report);
+const char* DecodeVerdictName(const DecodeVerdict verdict);
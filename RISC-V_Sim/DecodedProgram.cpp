@@ -0,0 +1,115 @@
+#include "DecodedProgram.h"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "Instruction.h"
+#include "InstructionDecode.h"
+
+bool EndsBasicBlock(const InstructionType type)
+{
+	switch (type)
+	{
+		case InstructionType::beq:
+		case InstructionType::bne:
+		case InstructionType::blt:
+		case InstructionType::bge:
+		case InstructionType::bltu:
+		case InstructionType::bgeu:
+		case InstructionType::jalr:
+		case InstructionType::jal:
+		case InstructionType::ecall:
+		case InstructionType::ebreak:
+			return true;
+		default:
+			return false;
+	}
+}
+
+bool IsAtomicInstruction(const InstructionType type)
+{
+	return InstructionTypeGetOpCode(type) == 0b0101111;
+}
+
+bool IsMemoryAccess(const InstructionType type)
+{
+	const uint32_t opcode = InstructionTypeGetOpCode(type);
+	return opcode == 0b0000011 || opcode == 0b0100011 || opcode == 0b0101111;
+}
+
+DecodedProgram::DecodedProgram(const uint32_t* rawProgram, const size_t instructionCount)
+{
+	rawInstructions.assign(rawProgram, rawProgram + instructionCount);
+	instructions = std::move(*DecodeInstructions(rawProgram, instructionCount));
+	threadedInstructions.reserve(instructionCount);
+	for (const Instruction& instruction : instructions)
+	{
+		threadedInstructions.push_back(CreateThreadedInstruction(instruction));
+	}
+
+	//go backwards through the program so the length of each
+	//block can be found from the block after it
+	blockLengths.resize(instructionCount);
+	blockCount = 0;
+	uint32_t blockLength = 0;
+	for (size_t i = instructionCount; i > 0; i--)
+	{
+		//atomic instructions get a block of their own so
+		//a hart can be stopped right before one
+		const InstructionType type = instructions[i - 1].type;
+		const bool nextIsAtomic = i < instructionCount && IsAtomicInstruction(instructions[i].type);
+		if (EndsBasicBlock(type) || IsAtomicInstruction(type) || nextIsAtomic)
+		{
+			blockLength = 0;
+			blockCount++;
+		}
+		blockLength++;
+		blockLengths[i - 1] = blockLength;
+	}
+	//the last block doesn't have to end with a jump
+	if (instructionCount > 0 && !EndsBasicBlock(instructions[instructionCount - 1].type) && !IsAtomicInstruction(instructions[instructionCount - 1].type))
+	{
+		blockCount++;
+	}
+}
+
+size_t DecodedProgram::GetInstructionCount() const
+{
+	return instructions.size();
+}
+
+const Instruction* DecodedProgram::GetInstructions() const
+{
+	return instructions.data();
+}
+
+const ThreadedInstruction* DecodedProgram::GetThreadedInstructions() const
+{
+	return threadedInstructions.data();
+}
+
+const uint32_t* DecodedProgram::GetRawInstructions() const
+{
+	return rawInstructions.data();
+}
+
+uint32_t DecodedProgram::GetBlockLength(const uint32_t instructionIndex) const
+{
+	return blockLengths[instructionIndex];
+}
+
+size_t DecodedProgram::GetBlockCount() const
+{
+	return blockCount;
+}
+
+bool DecodedProgram::IsSameProgram(const uint32_t* rawProgram, const size_t instructionCount) const
+{
+	return rawInstructions.size() == instructionCount &&
+		   std::memcmp(rawInstructions.data(), rawProgram, sizeof(uint32_t) * instructionCount) == 0;
+}
+
+std::shared_ptr<const DecodedProgram> DecodeProgram(const uint32_t* rawInstructions, const size_t instructionCount)
+{
+	return std::make_shared<const DecodedProgram>(rawInstructions, instructionCount);
+}
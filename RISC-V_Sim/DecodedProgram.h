@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Instruction.h"
+#include "ThreadedEngine.h"
+
+//A decoded program that never changes after it has been created.
+//It can therefore be shared between any number of processors,
+//also when they run on different threads.
+class DecodedProgram
+{
+private:
+	std::vector<uint32_t> rawInstructions;
+	std::vector<Instruction> instructions;
+	//the same instructions prepared for the threaded engine
+	std::vector<ThreadedInstruction> threadedInstructions;
+	//for each instruction, the number of instructions up to and including
+	//the next instruction that can change the control flow.
+	//Atomic instructions are always in a block of their own
+	std::vector<uint32_t> blockLengths;
+	size_t blockCount;
+
+public:
+	DecodedProgram(const uint32_t* rawProgram, const size_t instructionCount);
+	DecodedProgram(const DecodedProgram&) = delete;
+	DecodedProgram& operator=(const DecodedProgram&) = delete;
+
+	size_t GetInstructionCount() const;
+	const Instruction* GetInstructions() const;
+	const ThreadedInstruction* GetThreadedInstructions() const;
+	const uint32_t* GetRawInstructions() const;
+	uint32_t GetBlockLength(const uint32_t instructionIndex) const;
+	size_t GetBlockCount() const;
+	bool IsSameProgram(const uint32_t* rawProgram, const size_t instructionCount) const;
+};
+
+bool EndsBasicBlock(const InstructionType type);
+bool IsAtomicInstruction(const InstructionType type);
+//loads, stores and atomic instructions
+bool IsMemoryAccess(const InstructionType type);
+std::shared_ptr<const DecodedProgram> DecodeProgram(const uint32_t* rawInstructions, const size_t instructionCount);
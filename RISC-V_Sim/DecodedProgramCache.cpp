@@ -0,0 +1,84 @@
+#include "DecodedProgramCache.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "DecodedProgram.h"
+
+uint64_t HashProgram(const uint32_t* rawInstructions, const size_t instructionCount)
+{
+	//FNV-1a over the instruction words
+	uint64_t hash = 14695981039346656037ull;
+	for (size_t i = 0; i < instructionCount; i++)
+	{
+		hash ^= rawInstructions[i];
+		hash *= 1099511628211ull;
+	}
+	hash ^= instructionCount;
+
+	return hash;
+}
+
+DecodedProgramCache::DecodedProgramCache(const size_t maxCachedPrograms)
+{
+	maxPrograms = maxCachedPrograms;
+	useCounter = 0;
+}
+
+std::shared_ptr<const DecodedProgram> DecodedProgramCache::GetOrDecode(const uint32_t* rawInstructions, const size_t instructionCount)
+{
+	const uint64_t hash = HashProgram(rawInstructions, instructionCount);
+	{
+		std::lock_guard<std::mutex> guard(cacheLock);
+		auto range = programs.equal_range(hash);
+		for (auto it = range.first; it != range.second; it++)
+		{
+			//the hash can collide so make sure it's actually the same program
+			if (it->second.program->IsSameProgram(rawInstructions, instructionCount))
+			{
+				it->second.lastUse = ++useCounter;
+				return it->second.program;
+			}
+		}
+	}
+
+	//decode without holding the lock so other threads aren't blocked by it.
+	//Two threads may decode the same program at the same time but
+	//that only costs a bit of extra work
+	std::shared_ptr<const DecodedProgram> decoded = DecodeProgram(rawInstructions, instructionCount);
+
+	std::lock_guard<std::mutex> guard(cacheLock);
+	if (maxPrograms == 0)
+	{
+		return decoded;
+	}
+	if (programs.size() >= maxPrograms)
+	{
+		RemoveLeastRecentlyUsed();
+	}
+	programs.emplace(hash, CacheEntry{ decoded, ++useCounter });
+
+	return decoded;
+}
+
+void DecodedProgramCache::RemoveLeastRecentlyUsed()
+{
+	auto oldest = programs.begin();
+	for (auto it = programs.begin(); it != programs.end(); it++)
+	{
+		if (it->second.lastUse < oldest->second.lastUse)
+		{
+			oldest = it;
+		}
+	}
+	if (oldest != programs.end())
+	{
+		programs.erase(oldest);
+	}
+}
+
+size_t DecodedProgramCache::GetProgramCount()
+{
+	std::lock_guard<std::mutex> guard(cacheLock);
+	return programs.size();
+}
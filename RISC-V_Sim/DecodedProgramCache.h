@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "DecodedProgram.h"
+
+//Thread safe cache of decoded programs, so a program that is
+//run many times only has to be decoded the first time.
+//When the cache is full the least recently used program is removed.
+class DecodedProgramCache
+{
+private:
+	struct CacheEntry
+	{
+		std::shared_ptr<const DecodedProgram> program;
+		uint64_t lastUse;
+	};
+
+	std::mutex cacheLock;
+	size_t maxPrograms;
+	uint64_t useCounter;
+	std::unordered_multimap<uint64_t, CacheEntry> programs;
+
+	void RemoveLeastRecentlyUsed();
+
+public:
+	DecodedProgramCache(const size_t maxCachedPrograms = 1024);
+	DecodedProgramCache(const DecodedProgramCache&) = delete;
+	DecodedProgramCache& operator=(const DecodedProgramCache&) = delete;
+
+	std::shared_ptr<const DecodedProgram> GetOrDecode(const uint32_t* rawInstructions, const size_t instructionCount);
+	size_t GetProgramCount();
+};
+
+uint64_t HashProgram(const uint32_t* rawInstructions, const size_t instructionCount);
@@ -0,0 +1,152 @@
+#include "ElfSymbols.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <cstdio>
+#include <stdexcept>
+
+void SymbolTable::Add(const GuestSymbol& symbol)
+{
+	const auto position = std::upper_bound(symbols.begin(), symbols.end(), symbol.address, [](const uint32_t address, const GuestSymbol& other)
+	{
+		return address < other.address;
+	});
+	symbols.insert(position, symbol);
+}
+
+const GuestSymbol* SymbolTable::Find(const uint32_t address) const
+{
+	auto position = std::upper_bound(symbols.begin(), symbols.end(), address, [](const uint32_t value, const GuestSymbol& symbol)
+	{
+		return value < symbol.address;
+	});
+	//look back past symbols that are too small, like an
+	//empty symbol that is at the same address as a function
+	while (position != symbols.begin())
+	{
+		--position;
+		if (position->size == 0 || address - position->address < position->size)
+		{
+			return &*position;
+		}
+	}
+	return nullptr;
+}
+
+std::string SymbolTable::GetName(const uint32_t address) const
+{
+	const GuestSymbol* symbol = Find(address);
+	if (symbol)
+	{
+		return symbol->name;
+	}
+
+	//called for every frame of every sample, which is too often for a stringstream
+	char name[16];
+	snprintf(name, sizeof(name), "0x%x", address);
+	return name;
+}
+
+size_t SymbolTable::GetSymbolCount() const
+{
+	return symbols.size();
+}
+
+static uint32_t ReadUInt(const std::vector<uint8_t>& file, const uint64_t offset, const uint32_t size)
+{
+	if (offset + size > file.size())
+	{
+		throw std::runtime_error("ELF file is truncated.");
+	}
+	uint32_t value = 0;
+	for (uint32_t i = 0; i < size; i++)
+	{
+		value |= static_cast<uint32_t>(file[offset + i]) << (i * 8);
+	}
+	return value;
+}
+
+SymbolTable ReadElfSymbols(const std::string& filepath, const uint32_t baseAddress)
+{
+	std::ifstream stream(filepath, std::ios::binary);
+	if (!stream)
+	{
+		throw std::runtime_error("Failed to open file: " + filepath);
+	}
+	const std::vector<uint8_t> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+	const uint32_t ELF_CLASS_32 = 1;
+	const uint32_t ELF_LITTLE_ENDIAN = 1;
+	if (file.size() < 52 || file[0] != 0x7f || file[1] != 'E' || file[2] != 'L' || file[3] != 'F')
+	{
+		throw std::runtime_error("Not an ELF file: " + filepath);
+	}
+	if (file[4] != ELF_CLASS_32 || file[5] != ELF_LITTLE_ENDIAN)
+	{
+		throw std::runtime_error("Only 32 bit little endian ELF files are supported: " + filepath);
+	}
+
+	const uint32_t sectionHeadersOffset = ReadUInt(file, 0x20, 4);
+	const uint32_t sectionHeaderSize = ReadUInt(file, 0x2e, 2);
+	const uint32_t sectionCount = ReadUInt(file, 0x30, 2);
+
+	const uint32_t SECTION_SYMBOL_TABLE = 2;
+	const uint32_t SYMBOL_SIZE = 16;
+	const uint32_t SYMBOL_NO_TYPE = 0;
+	const uint32_t SYMBOL_FUNCTION = 2;
+	const uint32_t UNDEFINED_SECTION = 0;
+	std::vector<GuestSymbol> functions;
+	std::vector<GuestSymbol> labels;
+	for (uint32_t section = 0; section < sectionCount; section++)
+	{
+		const uint64_t header = sectionHeadersOffset + static_cast<uint64_t>(section) * sectionHeaderSize;
+		if (ReadUInt(file, header + 4, 4) != SECTION_SYMBOL_TABLE)
+		{
+			continue;
+		}
+		const uint32_t symbolsOffset = ReadUInt(file, header + 16, 4);
+		const uint32_t symbolsSize = ReadUInt(file, header + 20, 4);
+		//the string table with the names is the section that sh_link points to
+		const uint32_t stringSection = ReadUInt(file, header + 24, 4);
+		const uint64_t stringHeader = sectionHeadersOffset + static_cast<uint64_t>(stringSection) * sectionHeaderSize;
+		const uint32_t stringsOffset = ReadUInt(file, stringHeader + 16, 4);
+		const uint32_t stringsSize = ReadUInt(file, stringHeader + 20, 4);
+
+		for (uint32_t offset = 0; offset + SYMBOL_SIZE <= symbolsSize; offset += SYMBOL_SIZE)
+		{
+			const uint64_t symbol = static_cast<uint64_t>(symbolsOffset) + offset;
+			const uint32_t nameOffset = ReadUInt(file, symbol + 0, 4);
+			const uint32_t type = ReadUInt(file, symbol + 12, 1) & 0xf;
+			const uint32_t sectionIndex = ReadUInt(file, symbol + 14, 2);
+			if (sectionIndex == UNDEFINED_SECTION || nameOffset == 0 || nameOffset >= stringsSize)
+			{
+				continue;
+			}
+
+			GuestSymbol guestSymbol;
+			guestSymbol.address = ReadUInt(file, symbol + 4, 4) - baseAddress;
+			guestSymbol.size = ReadUInt(file, symbol + 8, 4);
+			const uint64_t nameStart = static_cast<uint64_t>(stringsOffset) + nameOffset;
+			for (uint64_t i = nameStart; i < file.size() && file[i] != 0; i++)
+			{
+				guestSymbol.name += static_cast<char>(file[i]);
+			}
+			//assemblers make local labels that start with a dot
+			if (type == SYMBOL_FUNCTION)
+			{
+				functions.push_back(guestSymbol);
+			}
+			else if (type == SYMBOL_NO_TYPE && guestSymbol.name[0] != '.' && guestSymbol.name[0] != '$')
+			{
+				labels.push_back(guestSymbol);
+			}
+		}
+	}
+
+	SymbolTable table;
+	for (const GuestSymbol& symbol : functions.empty() ? labels : functions)
+	{
+		table.Add(symbol);
+	}
+	return table;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct GuestSymbol
+{
+	uint32_t address;
+	//0 for labels that don't have a size
+	uint32_t size;
+	std::string name;
+};
+
+//The function symbols of a guest program, used to give
+//guest addresses a name when printing profiles
+class SymbolTable
+{
+private:
+	//sorted by address
+	std::vector<GuestSymbol> symbols;
+
+public:
+	void Add(const GuestSymbol& symbol);
+	//the symbol that the address is in, or nullptr if there is none.
+	//A symbol without a size goes on until the next symbol
+	const GuestSymbol* Find(const uint32_t address) const;
+	//the name of the symbol the address is in, or the address in hex
+	std::string GetName(const uint32_t address) const;
+	size_t GetSymbolCount() const;
+};
+
+//Reads the function symbols from the symbol table of a 32 bit little endian ELF file.
+//Programs that only have labels, like hand written assembly, use those instead.
+//baseAddress is subtracted from every symbol, for programs that were linked to run
+//somewhere else than at address 0 where the simulator starts them
+SymbolTable ReadElfSymbols(const std::string& filepath, const uint32_t baseAddress = 0);
@@ -0,0 +1,175 @@
+#include "ExecutionStats.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include "Instruction.h"
+
+void ExecutionStats::AddCountsToTypes()
+{
+	if (!countedProgram)
+	{
+		return;
+	}
+
+	const Instruction* instructions = countedProgram->GetInstructions();
+	for (size_t i = 0; i < instructionCounts.size(); i++)
+	{
+		if (instructionCounts[i] != 0)
+		{
+			typeCounts[instructions[i].type] += instructionCounts[i];
+			instructionCounts[i] = 0;
+		}
+	}
+}
+
+void ExecutionStats::StartProgram(const std::shared_ptr<const DecodedProgram>& program)
+{
+	//the processor calls this every time it continues, which
+	//mostly is with the same program as the last time
+	if (program == countedProgram)
+	{
+		return;
+	}
+
+	AddCountsToTypes();
+	countedProgram = program;
+	instructionCounts.assign(program->GetInstructionCount(), 0);
+}
+
+//the width in bytes of a load or store, or 0 if it isn't one
+static uint32_t GetAccessWidth(const InstructionType type)
+{
+	switch (type)
+	{
+		case InstructionType::lb:
+		case InstructionType::lbu:
+		case InstructionType::sb:
+			return 1;
+		case InstructionType::lh:
+		case InstructionType::lhu:
+		case InstructionType::sh:
+			return 2;
+		case InstructionType::lw:
+		case InstructionType::sw:
+			return 4;
+		default:
+			return 0;
+	}
+}
+
+static uint32_t GetAccessWidthIndex(const uint32_t width)
+{
+	return width == 1 ? 0 : (width == 2 ? 1 : 2);
+}
+
+ExecutionStatsReport ExecutionStats::GetReport()
+{
+	AddCountsToTypes();
+
+	ExecutionStatsReport report = {};
+	report.takenBranches = takenBranches;
+	report.notTakenBranches = notTakenBranches;
+	for (const auto& typeCount : typeCounts)
+	{
+		const InstructionType type = typeCount.first;
+		const uint64_t count = typeCount.second;
+		report.typeCounts.push_back(typeCount);
+		report.retiredInstructions += count;
+
+		const uint32_t width = GetAccessWidth(type);
+		if (width != 0)
+		{
+			const bool isLoad = InstructionTypeGetOpCode(type) == 0b0000011;
+			(isLoad ? report.loads : report.stores)[GetAccessWidthIndex(width)] += count;
+		}
+		if (IsAtomicInstruction(type))
+		{
+			report.atomics += count;
+		}
+	}
+
+	std::stable_sort(report.typeCounts.begin(), report.typeCounts.end(), [](const auto& a, const auto& b)
+	{
+		return a.second > b.second;
+	});
+
+	return report;
+}
+
+void ExecutionStats::Clear()
+{
+	countedProgram = nullptr;
+	instructionCounts.clear();
+	typeCounts.clear();
+	takenBranches = 0;
+	notTakenBranches = 0;
+}
+
+static const char* ACCESS_WIDTH_NAMES[ACCESS_WIDTH_COUNT] = { "byte", "half", "word" };
+
+static double GetPercent(const uint64_t count, const uint64_t total)
+{
+	return total == 0 ? 0.0 : 100.0 * static_cast<double>(count) / static_cast<double>(total);
+}
+
+void PrintExecutionStats(const ExecutionStatsReport& report)
+{
+	std::cout << "retired instructions: " << report.retiredInstructions << "\n";
+	for (const auto& typeCount : report.typeCounts)
+	{
+		std::cout << "  " << std::left << std::setw(10) << GetNameOfInstructionType(typeCount.first) <<
+			std::right << std::setw(14) << typeCount.second << "  " <<
+			std::fixed << std::setprecision(2) << std::setw(6) << GetPercent(typeCount.second, report.retiredInstructions) << "%\n";
+	}
+	std::cout << std::defaultfloat;
+
+	const uint64_t branches = report.takenBranches + report.notTakenBranches;
+	std::cout << "branches: " << branches << ", taken " << report.takenBranches << ", not taken " << report.notTakenBranches << "\n";
+	std::cout << "loads:";
+	for (uint32_t i = 0; i < ACCESS_WIDTH_COUNT; i++)
+	{
+		std::cout << " " << ACCESS_WIDTH_NAMES[i] << " " << report.loads[i];
+	}
+	std::cout << "\nstores:";
+	for (uint32_t i = 0; i < ACCESS_WIDTH_COUNT; i++)
+	{
+		std::cout << " " << ACCESS_WIDTH_NAMES[i] << " " << report.stores[i];
+	}
+	std::cout << "\natomics: " << report.atomics << std::endl;
+}
+
+void SaveExecutionStatsJson(const ExecutionStatsReport& report, const std::string& filepath)
+{
+	std::ofstream file(filepath);
+	if (!file)
+	{
+		throw std::runtime_error("Failed to create file: " + filepath);
+	}
+
+	//the names of the instructions never have to be escaped
+	file << "{\n";
+	file << "  \"retired_instructions\": " << report.retiredInstructions << ",\n";
+	file << "  \"instructions\": {";
+	for (size_t i = 0; i < report.typeCounts.size(); i++)
+	{
+		file << (i == 0 ? "\n" : ",\n");
+		file << "    \"" << GetNameOfInstructionType(report.typeCounts[i].first) << "\": " << report.typeCounts[i].second;
+	}
+	file << "\n  },\n";
+	file << "  \"branches\": { \"taken\": " << report.takenBranches << ", \"not_taken\": " << report.notTakenBranches << " },\n";
+	const auto writeWidths = [&](const char* name, const uint64_t* counts)
+	{
+		file << "  \"" << name << "\": {";
+		for (uint32_t i = 0; i < ACCESS_WIDTH_COUNT; i++)
+		{
+			file << (i == 0 ? " " : ", ") << "\"" << ACCESS_WIDTH_NAMES[i] << "\": " << counts[i];
+		}
+		file << " },\n";
+	};
+	writeWidths("loads", report.loads);
+	writeWidths("stores", report.stores);
+	file << "  \"atomics\": " << report.atomics << "\n";
+	file << "}\n";
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "InstructionType.h"
+#include "DecodedProgram.h"
+
+//loads and stores are counted per access width, one, two and four bytes
+const uint32_t ACCESS_WIDTH_COUNT = 3;
+
+struct ExecutionStatsReport
+{
+	//only the types that were run, the most run type first
+	std::vector<std::pair<InstructionType, uint64_t>> typeCounts;
+	uint64_t retiredInstructions;
+	uint64_t takenBranches;
+	uint64_t notTakenBranches;
+	uint64_t loads[ACCESS_WIDTH_COUNT];
+	uint64_t stores[ACCESS_WIDTH_COUNT];
+	//the atomic instructions aren't counted as loads or stores
+	uint64_t atomics;
+};
+
+//Counts what a processor runs when it's given to Processor::SetExecutionStats.
+//The processor only adds to the count of each instruction of the program,
+//they are added up by type when the program changes or the report is made.
+//A processor without stats runs a version of the run loop that doesn't count anything
+class ExecutionStats
+{
+private:
+	std::shared_ptr<const DecodedProgram> countedProgram;
+	std::vector<uint64_t> instructionCounts;
+	uint64_t takenBranches = 0;
+	uint64_t notTakenBranches = 0;
+	std::map<InstructionType, uint64_t> typeCounts;
+
+	void AddCountsToTypes();
+
+public:
+	void StartProgram(const std::shared_ptr<const DecodedProgram>& program);
+	void CountInstructions(const uint32_t firstIndex, const uint32_t count)
+	{
+		uint64_t* counts = instructionCounts.data() + firstIndex;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			counts[i]++;
+		}
+	}
+	void CountBranch(const bool taken)
+	{
+		takenBranches += taken ? 1 : 0;
+		notTakenBranches += taken ? 0 : 1;
+	}
+	ExecutionStatsReport GetReport();
+	void Clear();
+};
+
+void PrintExecutionStats(const ExecutionStatsReport& report);
+void SaveExecutionStatsJson(const ExecutionStatsReport& report, const std::string& filepath);
@@ -0,0 +1,212 @@
+#include "FuzzCampaign.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "CrossCheck.h"
+#include "Processor.h"
+#include "ProcessorPool.h"
+#include "RandomProgram.h"
+#include "TSrandom.h"
+#include "WorkStealingPool.h"
+
+std::unique_ptr<RISCV_Program> CreateFuzzProgram(const uint64_t seed, const uint64_t programIndex, const size_t programSize, const InstructionMix& mix)
+{
+	FRandom::TCRandom random = FRandom::CreateTCRandom(seed, programIndex);
+	return CreateRandomProgram(mix, programSize, random);
+}
+
+static std::string CheckProgramRuns(RISCV_Program& program, const RunLimits& limits, Processor& processor, Processor& otherProcessor)
+{
+	if (program.Run(processor, limits) != RunStatus::Exited)
+	{
+		return "Program didn't exit";
+	}
+	uint32_t firstResult[32];
+	std::copy(program.GetProgramResult(), program.GetProgramResult() + 32, firstResult);
+	const uint64_t firstRetired = program.GetRetiredInstructions();
+	std::vector<uint8_t> firstMemory(Processor::GetMemorySize());
+	processor.CopyMemoryTo(0, Processor::GetMemorySize(), firstMemory.data());
+
+	//the other processor has run other programs before, so this finds state that
+	//isn't reset between programs. It also uses the other engine, so a wrong
+	//result that is the same every time it's run is found too
+	if (program.Run(otherProcessor, limits) != RunStatus::Exited)
+	{
+		return "Program didn't exit on the threaded engine";
+	}
+	std::vector<uint8_t> otherMemory(Processor::GetMemorySize());
+	otherProcessor.CopyMemoryTo(0, Processor::GetMemorySize(), otherMemory.data());
+	if (!std::equal(firstResult, firstResult + 32, program.GetProgramResult()) ||
+		firstRetired != program.GetRetiredInstructions() || firstMemory != otherMemory)
+	{
+		//the first line of the reason doesn't change with the program,
+		//so the minimizer can keep it the same
+		CrossCheckOptions options;
+		options.maxInstructions = limits.maxInstructions;
+		const CrossCheckResult result = CrossCheckProgram(program.GetDecodedProgram(), options, processor, otherProcessor);
+		std::string reason = "Program gave a different result on the threaded engine of another processor";
+		if (result.diverged)
+		{
+			reason += "\nThe engines diverged at " + result.instruction + " at pc " + std::to_string(result.pc) + ": " + result.difference;
+		}
+		return reason;
+	}
+
+	return "";
+}
+
+std::string CheckFuzzProgram(RISCV_Program& program, const RunLimits& limits, Processor& processor, Processor& otherProcessor)
+{
+	const ExecutionEngine engine = processor.GetEngine();
+	const ExecutionEngine otherEngine = otherProcessor.GetEngine();
+	processor.SetEngine(ExecutionEngine::Reference);
+	otherProcessor.SetEngine(ExecutionEngine::Threaded);
+	std::string reason;
+	try
+	{
+		reason = CheckProgramRuns(program, limits, processor, otherProcessor);
+	}
+	catch (const std::exception& e)
+	{
+		reason = e.what();
+	}
+	processor.SetEngine(engine);
+	otherProcessor.SetEngine(otherEngine);
+	return reason;
+}
+
+FuzzReport RunFuzzCampaign(const FuzzOptions& options)
+{
+	WorkStealingPool pool(options.threadCount);
+	std::vector<std::unique_ptr<Processor>> processors(pool.GetThreadCount() * 2);
+	for (std::unique_ptr<Processor>& processor : processors)
+	{
+		processor = std::make_unique<Processor>();
+	}
+
+	//the random programs can't loop forever, so this is only reached if the simulator is broken
+	RunLimits limits;
+	limits.maxInstructions = GetMaxExecutedInstructions(options.mix, options.programSize);
+
+	std::atomic<uint64_t> failures(0);
+	std::atomic<uint64_t> instructions(0);
+	std::mutex failureLock;
+	const auto saveFailure = [&](RISCV_Program& program, const uint64_t index, const std::string& reason)
+	{
+		std::lock_guard<std::mutex> guard(failureLock);
+		std::filesystem::create_directories(options.failureDirectory);
+		const std::string name = "fuzz_" + std::to_string(options.seed) + "_" + std::to_string(index);
+		program.ActualToExpectedRegisters();
+		program.Save(options.failureDirectory + "/" + name);
+		std::ofstream(options.failureDirectory + "/failures.txt", std::ios::app) << name << ": " << reason << "\n";
+		std::cout << "Failed: " << name << ": " << reason << std::endl;
+	};
+
+	//programs are run in batches so the time limit
+	//and the progress can be checked between them
+	const uint64_t batchSize = 256 * pool.GetThreadCount();
+	const auto startTime = std::chrono::steady_clock::now();
+	auto lastProgress = startTime;
+	uint64_t programs = 0;
+	const auto elapsedSeconds = [&]()
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+	};
+
+	while ((options.programCount == 0 || programs < options.programCount) &&
+		   (options.seconds == 0 || elapsedSeconds() < options.seconds))
+	{
+		const uint64_t firstIndex = programs;
+		const uint64_t count = options.programCount == 0 ? batchSize : std::min(batchSize, options.programCount - programs);
+		pool.ParallelFor(count, [&](const size_t i, const size_t worker)
+		{
+			const uint64_t index = firstIndex + i;
+			std::unique_ptr<RISCV_Program> program;
+			try
+			{
+				program = CreateFuzzProgram(options.seed, index, options.programSize, options.mix);
+				const std::string reason = CheckFuzzProgram(*program, limits, *processors[worker * 2], *processors[worker * 2 + 1]);
+				//every program runs on both engines, and a program that
+				//passes retires as many instructions on each of them
+				instructions += 2 * program->GetRetiredInstructions();
+				if (!reason.empty())
+				{
+					failures++;
+					saveFailure(*program, index, reason);
+				}
+			}
+			catch (std::exception& e)
+			{
+				failures++;
+				if (program)
+				{
+					saveFailure(*program, index, e.what());
+				}
+			}
+		});
+		programs += count;
+
+		const auto now = std::chrono::steady_clock::now();
+		if (options.printProgress && now - lastProgress >= std::chrono::seconds(5))
+		{
+			lastProgress = now;
+			const double seconds = elapsedSeconds();
+			std::cout << programs << " programs, " << failures << " failures, " << programs / seconds << " programs/s, " << (instructions / seconds) / 1'000'000 << " MIPS" << std::endl;
+		}
+	}
+
+	FuzzReport report;
+	report.programs = programs;
+	report.failures = failures;
+	report.instructions = instructions;
+	report.seconds = elapsedSeconds();
+	return report;
+}
+
+//only the first line, the rest of an error has details
+//like addresses that change when instructions are removed
+static std::string CheckInstructions(const std::vector<uint32_t>& instructions, const RunLimits& limits)
+{
+	RISCV_Program program("minimize");
+	for (const uint32_t instruction : instructions)
+	{
+		program.AddInstruction(instruction);
+	}
+	ProcessorPool::Lease processor = ProcessorPool::Shared().Acquire();
+	ProcessorPool::Lease otherProcessor = ProcessorPool::Shared().Acquire();
+	const std::string reason = CheckFuzzProgram(program, limits, *processor, *otherProcessor);
+	return reason.substr(0, reason.find('\n'));
+}
+
+MinimizeResult MinimizeFuzzFailure(const std::vector<uint32_t>& instructions, const RunLimits& limits, const size_t threadCount)
+{
+	const std::string reason = CheckInstructions(instructions, limits);
+	if (reason.empty())
+	{
+		throw std::runtime_error("The program doesn't fail, so there is nothing to minimize.");
+	}
+
+	return MinimizeProgram(instructions, [&](const std::vector<uint32_t>& candidate)
+	{
+		return CheckInstructions(candidate, limits) == reason;
+	}, threadCount);
+}
+
+void PrintFuzzReport(const FuzzReport& report)
+{
+	std::cout << "programs:     " << report.programs << "\n";
+	std::cout << "failures:     " << report.failures << "\n";
+	std::cout << "instructions: " << report.instructions << "\n";
+	std::cout << "time:         " << report.seconds << " s\n";
+	std::cout << "programs/s:   " << report.programs / report.seconds << "\n";
+	std::cout << "MIPS:         " << (report.instructions / report.seconds) / 1'000'000 << std::endl;
+}
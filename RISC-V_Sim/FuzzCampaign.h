@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Processor.h"
+#include "RISCV_Program.h"
+#include "ProgramMinimizer.h"
+#include "RandomProgram.h"
+
+struct FuzzOptions
+{
+	uint64_t seed = 1;
+	//the campaign stops when either limit is reached, 0 means no limit
+	uint64_t programCount = 0;
+	double seconds = 0;
+	size_t programSize = 100;
+	InstructionMix mix;
+	//0 means one thread per hardware thread
+	size_t threadCount = 0;
+	//only programs that fail are saved here
+	std::string failureDirectory = "fuzz_failures";
+	bool printProgress = true;
+};
+
+struct FuzzReport
+{
+	uint64_t programs;
+	uint64_t failures;
+	//the instructions of the runs on both engines
+	uint64_t instructions;
+	double seconds;
+};
+
+//Generates, runs and checks random programs on all threads without
+//touching the disk, except for saving the programs that fail.
+//Program i of a campaign only depends on the seed and i, so any
+//program can be created again with CreateFuzzProgram.
+FuzzReport RunFuzzCampaign(const FuzzOptions& options);
+std::unique_ptr<RISCV_Program> CreateFuzzProgram(const uint64_t seed, const uint64_t programIndex, const size_t programSize, const InstructionMix& mix);
+//Runs a program on the reference engine of the first processor and the threaded engine of the
+//second and returns why it failed, or an empty string if it didn't. It fails if it doesn't
+//exit, throws or if the registers or memory are different after the second run.
+std::string CheckFuzzProgram(RISCV_Program& program, const RunLimits& limits, Processor& processor, Processor& otherProcessor);
+//Shrinks a program that fails CheckFuzzProgram to the fewest instructions
+//that still fail it for the same reason. Throws if the program doesn't fail
+MinimizeResult MinimizeFuzzFailure(const std::vector<uint32_t>& instructions, const RunLimits& limits, const size_t threadCount = 0);
+void PrintFuzzReport(const FuzzReport& report);
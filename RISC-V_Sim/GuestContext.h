@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include "HartState.h"
+#include "DecodedProgram.h"
+#include "GuestMemory.h"
+
+enum class GuestStatus
+{
+	//hasn't finished yet and can be scheduled again
+	Runnable,
+	//the program stopped itself with an exit ecall
+	Exited,
+	//the program used all the instructions it was allowed to run
+	InstructionLimit,
+	//the program ran for longer than it was allowed to
+	Timeout,
+	//the program threw an exception, the reason is in error
+	Error
+};
+
+//Everything needed to pause a guest program and
+//continue it later, possibly on another processor.
+struct GuestContext
+{
+	HartState hart;
+	std::shared_ptr<const DecodedProgram> program;
+	std::shared_ptr<GuestMemory> memory;
+	GuestStatus status;
+	std::string error;
+};
@@ -0,0 +1,91 @@
+#include "GuestMemory.h"
+
+GuestMemory::GuestMemory(const int32_t memorySize)
+{
+	if (memorySize <= 0)
+	{
+		throw std::runtime_error("Invalid memory size: " + std::to_string(memorySize));
+	}
+
+	//memory starts out zeroed so nothing is dirty yet.
+	//Allocated as words so atomic words are aligned
+	memory = reinterpret_cast<uint8_t*>(new uint32_t[(memorySize + 3) / 4]());
+	size = memorySize;
+	dirtyMemoryLow = size;
+	dirtyMemoryHigh = 0;
+	storeLog = nullptr;
+}
+
+void GuestMemory::CopyTo(const int32_t address, const int32_t copySize, uint8_t* copyTo) const
+{
+	Verify(address, copySize);
+	std::copy(memory + address, memory + address + copySize, copyTo);
+}
+
+void GuestMemory::CopyFrom(const int32_t address, const int32_t copySize, const uint8_t* copyFrom)
+{
+	Verify(address, copySize);
+	MarkDirty(address, copySize);
+	std::copy(copyFrom, copyFrom + copySize, memory + address);
+}
+
+void GuestMemory::CopyFrom(const GuestMemory& other)
+{
+	if (other.size != size)
+	{
+		throw std::runtime_error("Can't copy memory of a different size.");
+	}
+	MarkAllDirty();
+	std::copy(other.memory, other.memory + size, memory);
+}
+
+void GuestMemory::SetStoreLog(std::vector<GuestStore>* log)
+{
+	storeLog = log;
+}
+
+void GuestMemory::ApplyStores(const std::vector<GuestStore>& stores)
+{
+	for (const GuestStore& store : stores)
+	{
+		switch (store.size)
+		{
+			case 1:
+				StoreByte(store.address, static_cast<int8_t>(store.value));
+				break;
+			case 2:
+				StoreHalfWord(store.address, static_cast<int16_t>(store.value));
+				break;
+			default:
+				StoreWord(store.address, static_cast<int32_t>(store.value));
+				break;
+		}
+	}
+}
+
+int32_t GuestMemory::GetSize() const
+{
+	return size;
+}
+
+void GuestMemory::MarkAllDirty()
+{
+	dirtyMemoryLow = 0;
+	dirtyMemoryHigh = size;
+}
+
+void GuestMemory::Clear()
+{
+	//only clear the memory that was actually used
+	if (dirtyMemoryLow < dirtyMemoryHigh)
+	{
+		std::fill(memory + dirtyMemoryLow, memory + dirtyMemoryHigh, 0);
+	}
+	dirtyMemoryLow = size;
+	dirtyMemoryHigh = 0;
+}
+
+GuestMemory::~GuestMemory()
+{
+	delete[] reinterpret_cast<uint32_t*>(memory);
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+//a store to guest memory that was recorded so it can be replayed later
+struct GuestStore
+{
+	int32_t address;
+	int32_t size;
+	uint32_t value;
+};
+
+//The memory of a guest program. It's separate from the processor
+//so a processor can switch between programs that each have their
+//own memory. The accessors are in the header because they are
+//called for every load and store.
+class GuestMemory
+{
+private:
+	uint8_t* memory;
+	int32_t size;
+	//range of memory that has been written to since the last clear.
+	//Only this part has to be zeroed again which makes it cheap
+	//to reuse the memory for many small programs
+	int32_t dirtyMemoryLow;
+	int32_t dirtyMemoryHigh;
+	//when set all stores are also added to this log
+	std::vector<GuestStore>* storeLog;
+
+	void MarkDirty(const int32_t index, const int32_t accessSize)
+	{
+		//only write when the range grows, so memory that is
+		//all dirty can be shared by harts on different threads
+		if (index < dirtyMemoryLow)
+		{
+			dirtyMemoryLow = index;
+		}
+		if (index + accessSize > dirtyMemoryHigh)
+		{
+			dirtyMemoryHigh = index + accessSize;
+		}
+	}
+
+	//Harts on other threads can use the same memory at the same time, so every load
+	//and store is a relaxed host atomic like the atomic instructions. On the hosts this
+	//is meant for they are the same instructions as plain loads and stores.
+	//Only aligned values can be atomic, so the others are done a byte at a time
+	template<typename T>
+	T LoadRelaxed(const int32_t index) const
+	{
+		static_assert(sizeof(std::atomic<T>) == sizeof(T), "atomic values must have the same layout as values");
+		return reinterpret_cast<const std::atomic<T>*>(memory + index)->load(std::memory_order_relaxed);
+	}
+	template<typename T>
+	void StoreRelaxed(const int32_t index, const T value)
+	{
+		static_assert(sizeof(std::atomic<T>) == sizeof(T), "atomic values must have the same layout as values");
+		reinterpret_cast<std::atomic<T>*>(memory + index)->store(value, std::memory_order_relaxed);
+	}
+
+public:
+	GuestMemory(const int32_t memorySize);
+	GuestMemory(const GuestMemory&) = delete;
+	GuestMemory& operator=(const GuestMemory&) = delete;
+
+	void Verify(const int32_t index, const int32_t accessSize) const
+	{
+		//calculate with 64 bits so index + size can't overflow
+		if (index < 0 || accessSize < 0 || static_cast<int64_t>(index) + accessSize > size)
+		{
+			throw std::runtime_error("Memory access out of range.\nTried to access memory address " + std::to_string(index));
+		}
+	}
+
+	uint8_t GetByte(const int32_t index) const
+	{
+		Verify(index, 1);
+
+		return LoadRelaxed<uint8_t>(index);
+	}
+	uint16_t GetHalfWord(const int32_t index) const
+	{
+		Verify(index, 2);
+		if (index % 2 == 0)
+		{
+			return LoadRelaxed<uint16_t>(index);
+		}
+
+		const uint16_t t1 = static_cast<uint16_t>(LoadRelaxed<uint8_t>(index + 0));
+		const uint16_t t2 = static_cast<uint16_t>(LoadRelaxed<uint8_t>(index + 1));
+
+		return (t1 << 0) |
+			   (t2 << 8);
+	}
+	uint32_t GetWord(const int32_t index) const
+	{
+		Verify(index, 4);
+		if (index % 4 == 0)
+		{
+			return LoadRelaxed<uint32_t>(index);
+		}
+
+		const uint32_t t1 = static_cast<uint32_t>(LoadRelaxed<uint8_t>(index + 0));
+		const uint32_t t2 = static_cast<uint32_t>(LoadRelaxed<uint8_t>(index + 1));
+		const uint32_t t3 = static_cast<uint32_t>(LoadRelaxed<uint8_t>(index + 2));
+		const uint32_t t4 = static_cast<uint32_t>(LoadRelaxed<uint8_t>(index + 3));
+
+		return (t1 <<  0) |
+			   (t2 <<  8) |
+			   (t3 << 16) |
+			   (t4 << 24);
+	}
+
+	void StoreByte(const int32_t index, const int8_t byte)
+	{
+		Verify(index, 1);
+		MarkDirty(index, 1);
+		if (storeLog)
+		{
+			storeLog->push_back({ index, 1, static_cast<uint8_t>(byte) });
+		}
+
+		StoreRelaxed(index, static_cast<uint8_t>(byte));
+	}
+	void StoreHalfWord(const int32_t index, const int16_t halfWord)
+	{
+		Verify(index, 2);
+		MarkDirty(index, 2);
+		if (storeLog)
+		{
+			storeLog->push_back({ index, 2, static_cast<uint16_t>(halfWord) });
+		}
+
+		if (index % 2 == 0)
+		{
+			StoreRelaxed(index, static_cast<uint16_t>(halfWord));
+			return;
+		}
+		StoreRelaxed(index + 0, static_cast<uint8_t>(static_cast<uint16_t>(halfWord) >> 0));
+		StoreRelaxed(index + 1, static_cast<uint8_t>(static_cast<uint16_t>(halfWord) >> 8));
+	}
+	void StoreWord(const int32_t index, const int32_t word)
+	{
+		Verify(index, 4);
+		MarkDirty(index, 4);
+		if (storeLog)
+		{
+			storeLog->push_back({ index, 4, static_cast<uint32_t>(word) });
+		}
+
+		if (index % 4 == 0)
+		{
+			StoreRelaxed(index, static_cast<uint32_t>(word));
+			return;
+		}
+		StoreRelaxed(index + 0, static_cast<uint8_t>(static_cast<uint32_t>(word) >>  0));
+		StoreRelaxed(index + 1, static_cast<uint8_t>(static_cast<uint32_t>(word) >>  8));
+		StoreRelaxed(index + 2, static_cast<uint8_t>(static_cast<uint32_t>(word) >> 16));
+		StoreRelaxed(index + 3, static_cast<uint8_t>(static_cast<uint32_t>(word) >> 24));
+	}
+
+	//Atomic instructions are done directly on the memory with host atomics,
+	//so harts on different threads never have to take a lock.
+	//The memory is little endian like the hosts this is meant to run on
+	std::atomic<uint32_t>& GetAtomicWord(const int32_t index)
+	{
+		static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "atomic words must have the same layout as words");
+		Verify(index, 4);
+		if (index % 4 != 0)
+		{
+			throw std::runtime_error("Atomic memory access isn't aligned.\nTried to access memory address " + std::to_string(index));
+		}
+		MarkDirty(index, 4);
+
+		return *reinterpret_cast<std::atomic<uint32_t>*>(memory + index);
+	}
+
+	void CopyTo(const int32_t address, const int32_t copySize, uint8_t* copyTo) const;
+	void CopyFrom(const int32_t address, const int32_t copySize, const uint8_t* copyFrom);
+	void CopyFrom(const GuestMemory& other);
+	//atomic instructions aren't added to the log
+	void SetStoreLog(std::vector<GuestStore>* log);
+	void ApplyStores(const std::vector<GuestStore>& stores);
+	int32_t GetSize() const;
+	void MarkAllDirty();
+	void Clear();
+
+	~GuestMemory();
+};
@@ -0,0 +1,98 @@
+#include "GuestProfiler.h"
+#include <algorithm>
+#include <stdexcept>
+
+GuestProfiler::GuestProfiler(const uint64_t sampleInterval)
+{
+	if (sampleInterval == 0)
+	{
+		throw std::runtime_error("The sample interval has to be at least one instruction.");
+	}
+	interval = sampleInterval;
+	Clear();
+}
+
+void GuestProfiler::StartProgram(const uint32_t entryPc)
+{
+	callTree.Start(entryPc);
+}
+
+void GuestProfiler::SampleBlock(const uint32_t firstIndex, const uint32_t length)
+{
+	//sample the exact instruction the interval ended on.
+	//Small intervals can end more than once in a block
+	uint32_t offset = 0;
+	while (length - offset >= instructionsUntilSample)
+	{
+		offset += static_cast<uint32_t>(instructionsUntilSample);
+		samples[{ callTree.GetCurrentNode(), (firstIndex + offset - 1) * 4 }]++;
+		sampleCount++;
+		instructionsUntilSample = interval;
+	}
+	instructionsUntilSample -= length - offset;
+}
+
+uint64_t GuestProfiler::GetSampleCount() const
+{
+	return sampleCount;
+}
+
+std::vector<std::pair<std::string, uint64_t>> GuestProfiler::GetNamedSamples(const SymbolTable& symbols, const bool onlyLastFunction) const
+{
+	const std::vector<std::string> foldedNames = callTree.GetFoldedNames(symbols);
+	std::vector<std::pair<std::string, uint64_t>> named;
+	for (const auto& sample : samples)
+	{
+		const uint32_t node = sample.first.first;
+		const std::string called = symbols.GetName(callTree.GetAddress(node));
+		std::string name = onlyLastFunction ? called : foldedNames[node];
+		//with symbols the function the pc is in is known, which is
+		//different from the last call after a jump to another function
+		const GuestSymbol* symbol = symbols.Find(sample.first.second);
+		if (symbol && symbol->name != called)
+		{
+			name = onlyLastFunction ? symbol->name : name + ";" + symbol->name;
+		}
+		named.push_back({ name, sample.second });
+	}
+	return named;
+}
+
+void GuestProfiler::WriteFoldedStacks(std::ostream& stream, const SymbolTable& symbols) const
+{
+	//different call stacks can get the same names, so they are added up
+	std::map<std::string, uint64_t> folded;
+	for (const auto& sample : GetNamedSamples(symbols, false))
+	{
+		folded[sample.first] += sample.second;
+	}
+
+	for (const auto& line : folded)
+	{
+		stream << line.first << " " << line.second << "\n";
+	}
+}
+
+std::vector<std::pair<std::string, uint64_t>> GuestProfiler::GetHottestFunctions(const SymbolTable& symbols) const
+{
+	std::map<std::string, uint64_t> functionSamples;
+	for (const auto& sample : GetNamedSamples(symbols, true))
+	{
+		functionSamples[sample.first] += sample.second;
+	}
+
+	std::vector<std::pair<std::string, uint64_t>> hottest(functionSamples.begin(), functionSamples.end());
+	std::stable_sort(hottest.begin(), hottest.end(), [](const auto& a, const auto& b)
+	{
+		return a.second > b.second;
+	});
+	return hottest;
+}
+
+void GuestProfiler::Clear()
+{
+	instructionsUntilSample = interval;
+	callTree.Clear();
+	samples.clear();
+	sampleCount = 0;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Instruction.h"
+#include "ElfSymbols.h"
+#include "CallTree.h"
+
+//Samples the guest pc every few retired instructions when it's given to
+//Processor::SetProfiler. Calls and returns are followed with a CallTree,
+//so every sample knows the functions it was called from.
+//Like the stats, it only runs in the instrumented version of the run loop
+class GuestProfiler
+{
+private:
+	uint64_t interval;
+	uint64_t instructionsUntilSample;
+	CallTree callTree;
+	//the call tree node and the sampled pc, and how many samples had them
+	std::map<std::pair<uint32_t, uint32_t>, uint64_t> samples;
+	uint64_t sampleCount;
+
+	void SampleBlock(const uint32_t firstIndex, const uint32_t length);
+	//the names of the functions of every sample, with the function
+	//the pc is in last when the symbols know a better one
+	std::vector<std::pair<std::string, uint64_t>> GetNamedSamples(const SymbolTable& symbols, const bool onlyLastFunction) const;
+
+public:
+	GuestProfiler(const uint64_t sampleInterval);
+
+	//starts a new call stack, done by the processor when a program is loaded
+	void StartProgram(const uint32_t entryPc);
+	//called after a block of instructions has been run.
+	//nextPc is where the processor goes after the block
+	void ProfileBlock(const Instruction* block, const uint32_t firstIndex, const uint32_t length, const uint32_t nextPc)
+	{
+		if (length >= instructionsUntilSample)
+		{
+			SampleBlock(firstIndex, length);
+		}
+		else
+		{
+			instructionsUntilSample -= length;
+		}
+		callTree.FollowJump(block[length - 1], nextPc);
+	}
+	//follows a call or return without sampling, done outside of
+	//trace windows so the call stack is right when the next one opens
+	void FollowJump(const Instruction& instruction, const uint32_t nextPc)
+	{
+		callTree.FollowJump(instruction, nextPc, false);
+	}
+
+	uint64_t GetSampleCount() const;
+	//Writes a line for each distinct stack with the frames separated by ;
+	//followed by the number of samples, which is what flamegraph tools read.
+	//Frames are named from the symbols, or by their address if there are none
+	void WriteFoldedStacks(std::ostream& stream, const SymbolTable& symbols) const;
+	//the functions that most samples were in, with their number of samples
+	std::vector<std::pair<std::string, uint64_t>> GetHottestFunctions(const SymbolTable& symbols) const;
+	void Clear();
+};
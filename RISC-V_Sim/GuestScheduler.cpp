@@ -0,0 +1,88 @@
+#include "GuestScheduler.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+GuestScheduler::GuestScheduler(const uint64_t instructionQuantum)
+{
+	if (instructionQuantum == 0)
+	{
+		throw std::runtime_error("The instruction quantum has to be larger than 0.");
+	}
+	quantum = instructionQuantum;
+}
+
+size_t GuestScheduler::AddProgram(const std::shared_ptr<const DecodedProgram>& program, const uint32_t* initialRegisters, std::shared_ptr<GuestMemory> memory)
+{
+	if (!memory)
+	{
+		memory = std::make_shared<GuestMemory>(Processor::GetMemorySize());
+	}
+
+	GuestContext context;
+	context.hart = Processor::CreateHartState(initialRegisters, memory->GetSize());
+	context.program = program;
+	context.memory = std::move(memory);
+	context.status = GuestStatus::Runnable;
+	contexts.push_back(std::move(context));
+
+	return contexts.size() - 1;
+}
+
+void GuestScheduler::RunAll(const uint64_t maxInstructionsPerProgram)
+{
+	std::vector<size_t> runnable;
+	for (size_t i = 0; i < contexts.size(); i++)
+	{
+		if (contexts[i].status == GuestStatus::Runnable)
+		{
+			runnable.push_back(i);
+		}
+	}
+
+	//round robin over the runnable programs. Finished
+	//programs are removed from the list as it's traversed
+	while (!runnable.empty())
+	{
+		size_t stillRunnable = 0;
+		for (const size_t index : runnable)
+		{
+			GuestContext& context = contexts[index];
+
+			RunLimits limits;
+			limits.maxInstructions = std::min(quantum, maxInstructionsPerProgram - context.hart.retiredInstructions);
+			try
+			{
+				if (processor.Continue(context, limits) == RunStatus::Exited)
+				{
+					context.status = GuestStatus::Exited;
+				}
+				else if (context.hart.retiredInstructions >= maxInstructionsPerProgram)
+				{
+					context.status = GuestStatus::InstructionLimit;
+				}
+			}
+			catch (std::runtime_error& e)
+			{
+				context.status = GuestStatus::Error;
+				context.error = e.what();
+			}
+
+			if (context.status == GuestStatus::Runnable)
+			{
+				runnable[stillRunnable++] = index;
+			}
+		}
+		runnable.resize(stillRunnable);
+	}
+}
+
+size_t GuestScheduler::GetProgramCount() const
+{
+	return contexts.size();
+}
+
+const GuestContext& GuestScheduler::GetContext(const size_t index) const
+{
+	return contexts.at(index);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Processor.h"
+#include "GuestContext.h"
+#include "DecodedProgram.h"
+
+//Runs many guest programs on a single thread by switching between
+//them after a fixed number of instructions. Every program has its
+//own registers and memory but they all share one processor, so the
+//decoded programs and the processor stay in the cache, and switching
+//program is only a copy of the registers.
+class GuestScheduler
+{
+private:
+	Processor processor;
+	std::vector<GuestContext> contexts;
+	uint64_t quantum;
+
+public:
+	GuestScheduler(const uint64_t instructionQuantum = 10'000);
+	GuestScheduler(const GuestScheduler&) = delete;
+	GuestScheduler& operator=(const GuestScheduler&) = delete;
+
+	//memory can be given to let programs share memory,
+	//otherwise each program gets its own
+	size_t AddProgram(const std::shared_ptr<const DecodedProgram>& program, const uint32_t* initialRegisters = nullptr, std::shared_ptr<GuestMemory> memory = nullptr);
+	//runs until every program has exited, failed or
+	//used all the instructions it's allowed to run
+	void RunAll(const uint64_t maxInstructionsPerProgram = UINT64_MAX);
+	size_t GetProgramCount() const;
+	const GuestContext& GetContext(const size_t index) const;
+};
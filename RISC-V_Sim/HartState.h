@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include "Register.h"
+
+//the mutable state of a single hart.
+//Everything a hart needs to continue executing
+//a program, except for the memory it uses.
+struct HartState
+{
+	uint32_t pc;
+	Register registers[32];
+	uint64_t retiredInstructions;
+	//the value of the mhartid csr
+	uint32_t hartId;
+	//address reserved by lr.w, or -1 when there is no reservation.
+	//sc.w only succeeds if the word still has the value lr.w loaded
+	int32_t reservationAddress;
+	uint32_t reservationValue;
+};
@@ -81,7 +81,7 @@ std::string InstructionToBits(const uint32_t n)
 	}
 }
 
-static std::string GetNameOfInstructionType(const InstructionType type)
+std::string GetNameOfInstructionType(const InstructionType type)
 {
 	switch (type)
 	{
@@ -195,6 +195,28 @@ static std::string GetNameOfInstructionType(const InstructionType type)
 			return "rem";
 		case InstructionType::remu:
 			return "remu";
+		case InstructionType::lr_w:
+			return "lr.w";
+		case InstructionType::sc_w:
+			return "sc.w";
+		case InstructionType::amoswap_w:
+			return "amoswap.w";
+		case InstructionType::amoadd_w:
+			return "amoadd.w";
+		case InstructionType::amoxor_w:
+			return "amoxor.w";
+		case InstructionType::amoand_w:
+			return "amoand.w";
+		case InstructionType::amoor_w:
+			return "amoor.w";
+		case InstructionType::amomin_w:
+			return "amomin.w";
+		case InstructionType::amomax_w:
+			return "amomax.w";
+		case InstructionType::amominu_w:
+			return "amominu.w";
+		case InstructionType::amomaxu_w:
+			return "amomaxu.w";
 		default:
 			throw std::runtime_error("Invalid instruction type. Type: " + NumberToBits(static_cast<uint32_t>(type)));
 	}
@@ -219,7 +241,19 @@ std::string InstructionAsString(const Instruction& instruction)
 			sprintf(text, "%s %s %s %i", type.c_str(), rdText.c_str(), rs1Text.c_str(), instruction.immediate);
 			break;
 		case 0b0111'0011:
-			sprintf(text, "%s", type.c_str());
+			if (instruction.type == InstructionType::ecall || instruction.type == InstructionType::ebreak)
+			{
+				sprintf(text, "%s", type.c_str());
+			}
+			//the immediate versions store an unsigned immediate instead of rs1
+			else if (InstructionTypeFunct3(instruction.type) >= 0b101)
+			{
+				sprintf(text, "%s %s %i %i", type.c_str(), rdText.c_str(), instruction.immediate & 0xfff, instruction.rs1);
+			}
+			else
+			{
+				sprintf(text, "%s %s %i %s", type.c_str(), rdText.c_str(), instruction.immediate & 0xfff, rs1Text.c_str());
+			}
 			break;
 		case 0b0001'0111:
 		case 0b0011'0111:
@@ -237,6 +271,20 @@ std::string InstructionAsString(const Instruction& instruction)
 		case 0b0110'1111:
 			sprintf(text, "%s %s %i", type.c_str(), rdText.c_str(), instruction.immediate);
 			break;
+		case 0b0010'1111:
+		{
+			//the aq and rl bits are kept in the immediate
+			const std::string ordering = std::string((instruction.immediate & 0b10) ? ".aq" : "") + ((instruction.immediate & 0b01) ? ".rl" : "");
+			if (instruction.type == InstructionType::lr_w)
+			{
+				sprintf(text, "%s%s %s (%s)", type.c_str(), ordering.c_str(), rdText.c_str(), rs1Text.c_str());
+			}
+			else
+			{
+				sprintf(text, "%s%s %s %s (%s)", type.c_str(), ordering.c_str(), rdText.c_str(), rs2Text.c_str(), rs1Text.c_str());
+			}
+			break;
+		}
 		default:
 			throw std::runtime_error("Invalid opcode. opcode: " + std::to_string(InstructionTypeGetOpCode(instruction.type)));
 	}
@@ -15,4 +15,5 @@ struct Instruction
 
 std::string NumberToBits(const uint32_t n);
 std::string InstructionToBits(const uint32_t n);
+std::string GetNameOfInstructionType(const InstructionType type);
 std::string InstructionAsString(const Instruction& instruction);
\ No newline at end of file
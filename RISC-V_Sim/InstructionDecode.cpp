@@ -38,6 +38,7 @@ static uint16_t GetInstructionIdentifierMask(uint16_t instructionIdentifier)
 		case 0b000000'110'0110011:
 		case 0b000000'111'0110011:
 		case 0b000000'000'1110011:
+		case 0b000000'010'0101111:
 			return wholeidentifier;
 		default:
 			return onlyOpCodeAndFunct3;
@@ -58,7 +59,7 @@ static InstructionType GetInstructionType(const uint32_t opcode, const uint32_t
 static Instruction DecodeRType(const uint32_t rawInstruction)
 {
 	RType rType(rawInstruction);
-	Instruction decoded;
+	Instruction decoded = { 0 };
 	decoded.rd   = rType.rd.GetAsInt();
 	decoded.rs1  = rType.rs1.GetAsInt();
 	decoded.rs2  = rType.rs2.GetAsInt();
@@ -67,6 +68,21 @@ static Instruction DecodeRType(const uint32_t rawInstruction)
 	return decoded;
 }
 
+static Instruction DecodeAtomicType(const uint32_t rawInstruction)
+{
+	RType rType(rawInstruction);
+	Instruction decoded = { 0 };
+	decoded.rd   = rType.rd.GetAsInt();
+	decoded.rs1  = rType.rs1.GetAsInt();
+	decoded.rs2  = rType.rs2.GetAsInt();
+	//funct7 is funct5 followed by the aq and rl bits.
+	//Keep aq and rl in the immediate which isn't used otherwise
+	decoded.immediate = rType.funct7.GetAsInt() & 0b11;
+	decoded.type = GetInstructionType(rType.opcode.GetAsInt(), rType.funct3.GetAsInt(), rType.funct7.GetAsInt() >> 2);
+
+	return decoded;
+}
+
 static Instruction DecodeIType(const uint32_t rawInstruction)
 {
 	const IType iType(rawInstruction);
@@ -75,7 +91,11 @@ static Instruction DecodeIType(const uint32_t rawInstruction)
 	decoded.rd         = iType.rd.GetAsInt();
 	decoded.rs1        = iType.rs1.GetAsInt();
 	decoded.immediate  = SignExtend<12>(iType.immediate.GetAsInt());
-	decoded.type       = GetInstructionType(iType.opcode.GetAsInt(), iType.funct3.GetAsInt(), iType.immediate.GetAsInt() >> 5);
+	//ecall and ebreak are told apart by the lowest bit of the immediate,
+	//the other instructions by the upper bits of it
+	const bool isEnvironmentCall = iType.opcode.GetAsInt() == 0b1110011 && iType.funct3.GetAsInt() == 0;
+	const uint32_t funct7OrImmediate = isEnvironmentCall ? iType.immediate.GetAsInt() : iType.immediate.GetAsInt() >> 5;
+	decoded.type       = GetInstructionType(iType.opcode.GetAsInt(), iType.funct3.GetAsInt(), funct7OrImmediate);
 	decoded.immediate &= GetImmediateMask((iType.funct3.GetAsInt() << 7) | iType.opcode.GetAsInt());
 
 	return decoded;
@@ -127,7 +147,7 @@ static Instruction DecodeUType(const uint32_t rawInstruction)
 	return decoded;
 }
 
-Instruction DecodeInstruction(const uint32_t rawInstruction)
+bool TryDecodeInstruction(const uint32_t rawInstruction, Instruction& decoded)
 {
 	//opcode is the first 7 bits
 	const uint32_t opcode = rawInstruction & 127;
@@ -139,21 +159,40 @@ Instruction DecodeInstruction(const uint32_t rawInstruction)
 		case 0b0010011:
 		case 0b1100111:
 		case 0b1110011:
-			return DecodeIType(rawInstruction);
+			decoded = DecodeIType(rawInstruction);
+			return true;
 		case 0b0010111:
 		case 0b0110111:
-			return DecodeUType(rawInstruction);
+			decoded = DecodeUType(rawInstruction);
+			return true;
 		case 0b0100011:
-			return DecodeSType(rawInstruction);
+			decoded = DecodeSType(rawInstruction);
+			return true;
 		case 0b0110011:
-			return DecodeRType(rawInstruction);
+			decoded = DecodeRType(rawInstruction);
+			return true;
+		case 0b0101111:
+			decoded = DecodeAtomicType(rawInstruction);
+			return true;
 		case 0b1100011:
-			return DecodeSBType(rawInstruction);
+			decoded = DecodeSBType(rawInstruction);
+			return true;
 		case 0b1101111:
-			return DecodeUJType(rawInstruction);
+			decoded = DecodeUJType(rawInstruction);
+			return true;
 		default:
-			throw std::runtime_error("Invalid opcode. opcode: " + std::to_string(opcode));
+			return false;
+	}
+}
+
+Instruction DecodeInstruction(const uint32_t rawInstruction)
+{
+	Instruction decoded;
+	if (!TryDecodeInstruction(rawInstruction, decoded))
+	{
+		throw std::runtime_error("Invalid opcode. opcode: " + std::to_string(rawInstruction & 127));
 	}
+	return decoded;
 }
 
 std::unique_ptr<std::vector<Instruction>> DecodeInstructions(const uint32_t* rawInstructions, const size_t instructionsCount)
@@ -176,7 +215,8 @@ std::string GetProgramAsString(const uint32_t* rawInstructions, const size_t ins
 	for(size_t i = 0; i < instructionCount; i++)
 	{
 		const Instruction instruction = DecodeInstruction(rawInstructions[i]);
-		program += InstructionAsString(instruction) + "\n";
+		program += InstructionAsString(instruction);
+		program += '\n';
 	}
 
 	return program;
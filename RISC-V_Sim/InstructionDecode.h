@@ -7,5 +7,9 @@
 #include "Instruction.h"
 
 Instruction DecodeInstruction(const uint32_t rawInstruction);
+//same as DecodeInstruction but returns false instead of throwing when the opcode
+//is invalid, which is a lot faster when most of the words aren't instructions.
+//Like DecodeInstruction it doesn't check that the type is an instruction, see IsInstructionType
+bool TryDecodeInstruction(const uint32_t rawInstruction, Instruction& decoded);
 std::unique_ptr<std::vector<Instruction>> DecodeInstructions(const uint32_t* rawInstructions, const size_t instructionsCount);
 std::string GetProgramAsString(const uint32_t* rawInstructions, const size_t instructionCount);
\ No newline at end of file
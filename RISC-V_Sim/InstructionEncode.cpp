@@ -21,6 +21,22 @@ static uint32_t EncodeRType(const InstructionType type, const Regs rd, const Reg
 	return rType.ToRawInstruction();
 }
 
+static uint32_t EncodeAtomicType(const InstructionType type, const Regs rd, const Regs rs1, const Regs rs2, const bool acquire, const bool release)
+{
+	RType rType;
+	rType.opcode.FromInt(InstructionTypeGetOpCode(type));
+	rType.rd    .FromInt(static_cast<uint32_t>(rd));
+	rType.funct3.FromInt(InstructionTypeFunct3(type));
+	rType.rs1   .FromInt(static_cast<uint32_t>(rs1));
+	rType.rs2   .FromInt(static_cast<uint32_t>(rs2));
+	//for atomic instructions the type only contains funct5
+	rType.funct7.FromInt((InstructionTypeFunct7(type) << 2) |
+						 (static_cast<uint32_t>(acquire) << 1) |
+						 (static_cast<uint32_t>(release) << 0));
+
+	return rType.ToRawInstruction();
+}
+
 static uint32_t EncodeIType(const InstructionType type, const Regs rd, const Regs rs1, const uint32_t immediate)
 {
 	IType iType;
@@ -117,11 +133,12 @@ uint32_t Create_lhu(const Regs rd, const Regs rs1, const uint32_t immediate)
 }
 uint32_t Create_fence()
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	//fence iorw, iorw which orders all memory accesses
+	return EncodeIType(InstructionType::fence, Regs::x0, Regs::x0, 0b0000'1111'1111);
 }
 uint32_t Create_fence_i()
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	return EncodeIType(InstructionType::fence_i, Regs::x0, Regs::x0, 0);
 }
 uint32_t Create_addi(const Regs rd, const Regs rs1, const uint32_t immediate)
 {
@@ -235,32 +252,32 @@ uint32_t Create_lui(const Regs rd, const uint32_t immediate)
 }
 uint32_t Create_beq(const Regs rs1, const Regs rs2, const uint32_t immediate)
 {
-	VerifyRange(-2047, 4095, immediate);
+	VerifyRange(-4096, 8191, immediate);
 	return EncodeSBType(InstructionType::beq, rs1, rs2, immediate);
 }
 uint32_t Create_bne(const Regs rs1, const Regs rs2, const uint32_t immediate)
 {
-	VerifyRange(-2047, 4095, immediate);
+	VerifyRange(-4096, 8191, immediate);
 	return EncodeSBType(InstructionType::bne, rs1, rs2, immediate);
 }
 uint32_t Create_blt(const Regs rs1, const Regs rs2, const uint32_t immediate)
 {
-	VerifyRange(-2047, 4095, immediate);
+	VerifyRange(-4096, 8191, immediate);
 	return EncodeSBType(InstructionType::blt, rs1, rs2, immediate);
 }
 uint32_t Create_bge(const Regs rs1, const Regs rs2, const uint32_t immediate)
 {
-	VerifyRange(-2047, 4095, immediate);
+	VerifyRange(-4096, 8191, immediate);
 	return EncodeSBType(InstructionType::bge, rs1, rs2, immediate);
 }
 uint32_t Create_bltu(const Regs rs1, const Regs rs2, const uint32_t immediate)
 {
-	VerifyRange(-2047, 4095, immediate);
+	VerifyRange(-4096, 8191, immediate);
 	return EncodeSBType(InstructionType::bltu, rs1, rs2, immediate);
 }
 uint32_t Create_bgeu(const Regs rs1, const Regs rs2, const uint32_t immediate)
 {
-	VerifyRange(-2047, 4095, immediate);
+	VerifyRange(-4096, 8191, immediate);
 	return EncodeSBType(InstructionType::bgeu, rs1, rs2, immediate);
 }
 uint32_t Create_jalr(const Regs rd, const Regs rs1, const uint32_t immediate)
@@ -270,7 +287,7 @@ uint32_t Create_jalr(const Regs rd, const Regs rs1, const uint32_t immediate)
 }
 uint32_t Create_jal(const Regs rd, const uint32_t immediate)
 {
-	VerifyRange(-524288, 1048575, immediate);
+	VerifyRange(-1048576, 2097151, immediate);
 	return EncodeUJType(InstructionType::jal, rd, immediate);
 }
 uint32_t Create_ecall()
@@ -279,31 +296,46 @@ uint32_t Create_ecall()
 }
 uint32_t Create_ebreak()
 {
-	return EncodeIType(InstructionType::ebreak, Regs::x0, Regs::x0, 0);
+	//the type of ebreak has the 1 where funct7 would be, but in the
+	//instruction it's the lowest bit of the immediate, so encode it as
+	//ecall with that immediate
+	return EncodeIType(InstructionType::ecall, Regs::x0, Regs::x0, 1);
 }
-uint32_t Create_csrrw()
+uint32_t Create_csrrw(const Regs rd, const Regs rs1, const uint32_t csr)
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	VerifyRange(0, 4095, csr);
+	return EncodeIType(InstructionType::csrrw, rd, rs1, csr);
 }
-uint32_t Create_csrrs()
+uint32_t Create_csrrs(const Regs rd, const Regs rs1, const uint32_t csr)
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	VerifyRange(0, 4095, csr);
+	return EncodeIType(InstructionType::csrrs, rd, rs1, csr);
 }
-uint32_t Create_csrrc()
+uint32_t Create_csrrc(const Regs rd, const Regs rs1, const uint32_t csr)
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	VerifyRange(0, 4095, csr);
+	return EncodeIType(InstructionType::csrrc, rd, rs1, csr);
 }
-uint32_t Create_csrrwi()
+uint32_t Create_csrrwi(const Regs rd, const uint32_t zimm, const uint32_t csr)
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	//the unsigned immediate is stored where rs1 normally is
+	VerifyRange(0, 31, zimm);
+	VerifyRange(0, 4095, csr);
+	return EncodeIType(InstructionType::csrrwi, rd, static_cast<Regs>(zimm), csr);
 }
-uint32_t Create_csrrsi()
+uint32_t Create_csrrsi(const Regs rd, const uint32_t zimm, const uint32_t csr)
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	//the unsigned immediate is stored where rs1 normally is
+	VerifyRange(0, 31, zimm);
+	VerifyRange(0, 4095, csr);
+	return EncodeIType(InstructionType::csrrsi, rd, static_cast<Regs>(zimm), csr);
 }
-uint32_t Create_csrrci()
+uint32_t Create_csrrci(const Regs rd, const uint32_t zimm, const uint32_t csr)
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	//the unsigned immediate is stored where rs1 normally is
+	VerifyRange(0, 31, zimm);
+	VerifyRange(0, 4095, csr);
+	return EncodeIType(InstructionType::csrrci, rd, static_cast<Regs>(zimm), csr);
 }
 uint32_t Create_mul(const Regs rd, const Regs rs1, const Regs rs2)
 {
@@ -337,6 +369,50 @@ uint32_t Create_remu(const Regs rd, const Regs rs1, const Regs rs2)
 {
 	return EncodeRType(InstructionType::remu, rd, rs1, rs2);
 }
+uint32_t Create_lr_w(const Regs rd, const Regs rs1, const bool acquire, const bool release)
+{
+	return EncodeAtomicType(InstructionType::lr_w, rd, rs1, Regs::x0, acquire, release);
+}
+uint32_t Create_sc_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire, const bool release)
+{
+	return EncodeAtomicType(InstructionType::sc_w, rd, rs1, rs2, acquire, release);
+}
+uint32_t Create_amoswap_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire, const bool release)
+{
+	return EncodeAtomicType(InstructionType::amoswap_w, rd, rs1, rs2, acquire, release);
+}
+uint32_t Create_amoadd_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire, const bool release)
+{
+	return EncodeAtomicType(InstructionType::amoadd_w, rd, rs1, rs2, acquire, release);
+}
+uint32_t Create_amoxor_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire, const bool release)
+{
+	return EncodeAtomicType(InstructionType::amoxor_w, rd, rs1, rs2, acquire, release);
+}
+uint32_t Create_amoand_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire, const bool release)
+{
+	return EncodeAtomicType(InstructionType::amoand_w, rd, rs1, rs2, acquire, release);
+}
+uint32_t Create_amoor_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire, const bool release)
+{
+	return EncodeAtomicType(InstructionType::amoor_w, rd, rs1, rs2, acquire, release);
+}
+uint32_t Create_amomin_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire, const bool release)
+{
+	return EncodeAtomicType(InstructionType::amomin_w, rd, rs1, rs2, acquire, release);
+}
+uint32_t Create_amomax_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire, const bool release)
+{
+	return EncodeAtomicType(InstructionType::amomax_w, rd, rs1, rs2, acquire, release);
+}
+uint32_t Create_amominu_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire, const bool release)
+{
+	return EncodeAtomicType(InstructionType::amominu_w, rd, rs1, rs2, acquire, release);
+}
+uint32_t Create_amomaxu_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire, const bool release)
+{
+	return EncodeAtomicType(InstructionType::amomaxu_w, rd, rs1, rs2, acquire, release);
+}
 
 MultiInstruction Create_li(const Regs rd, const uint32_t immediate)
 {
@@ -371,4 +447,90 @@ MultiInstruction Create_li(const Regs rd, const uint32_t immediate)
 	}
 
 	return mInstruction;
-}
\ No newline at end of file
+}
+
+uint32_t EncodeInstruction(const Instruction& instruction)
+{
+	const Regs rd = static_cast<Regs>(instruction.rd);
+	const Regs rs1 = static_cast<Regs>(instruction.rs1);
+	const Regs rs2 = static_cast<Regs>(instruction.rs2);
+	const uint32_t immediate = static_cast<uint32_t>(instruction.immediate);
+	//the upper immediate is decoded as the value it adds, not the 20 bits in the instruction
+	const uint32_t upperImmediate = immediate >> 12;
+	//csrs are unsigned but decoded like any other immediate
+	const uint32_t csr = immediate & 0xfff;
+	const bool acquire = (instruction.immediate & 0b10) != 0;
+	const bool release = (instruction.immediate & 0b01) != 0;
+
+	switch (instruction.type)
+	{
+		case InstructionType::lb:        return Create_lb(rd, rs1, immediate);
+		case InstructionType::lh:        return Create_lh(rd, rs1, immediate);
+		case InstructionType::lw:        return Create_lw(rd, rs1, immediate);
+		case InstructionType::lbu:       return Create_lbu(rd, rs1, immediate);
+		case InstructionType::lhu:       return Create_lhu(rd, rs1, immediate);
+		case InstructionType::fence:     return Create_fence();
+		case InstructionType::fence_i:   return Create_fence_i();
+		case InstructionType::addi:      return Create_addi(rd, rs1, immediate);
+		case InstructionType::slli:      return Create_slli(rd, rs1, immediate);
+		case InstructionType::slti:      return Create_slti(rd, rs1, immediate);
+		case InstructionType::sltiu:     return Create_sltiu(rd, rs1, immediate);
+		case InstructionType::xori:      return Create_xori(rd, rs1, immediate);
+		case InstructionType::srli:      return Create_srli(rd, rs1, immediate);
+		case InstructionType::srai:      return Create_srai(rd, rs1, immediate);
+		case InstructionType::ori:       return Create_ori(rd, rs1, immediate);
+		case InstructionType::andi:      return Create_andi(rd, rs1, immediate);
+		case InstructionType::auipc:     return Create_auipc(rd, upperImmediate);
+		case InstructionType::sb:        return Create_sb(rs1, rs2, immediate);
+		case InstructionType::sh:        return Create_sh(rs1, rs2, immediate);
+		case InstructionType::sw:        return Create_sw(rs1, rs2, immediate);
+		case InstructionType::add:       return Create_add(rd, rs1, rs2);
+		case InstructionType::sub:       return Create_sub(rd, rs1, rs2);
+		case InstructionType::sll:       return Create_sll(rd, rs1, rs2);
+		case InstructionType::slt:       return Create_slt(rd, rs1, rs2);
+		case InstructionType::sltu:      return Create_sltu(rd, rs1, rs2);
+		case InstructionType::xor_:      return Create_xor(rd, rs1, rs2);
+		case InstructionType::srl:       return Create_srl(rd, rs1, rs2);
+		case InstructionType::sra:       return Create_sra(rd, rs1, rs2);
+		case InstructionType::or_:       return Create_or(rd, rs1, rs2);
+		case InstructionType::and_:      return Create_and(rd, rs1, rs2);
+		case InstructionType::lui:       return Create_lui(rd, upperImmediate);
+		case InstructionType::beq:       return Create_beq(rs1, rs2, immediate);
+		case InstructionType::bne:       return Create_bne(rs1, rs2, immediate);
+		case InstructionType::blt:       return Create_blt(rs1, rs2, immediate);
+		case InstructionType::bge:       return Create_bge(rs1, rs2, immediate);
+		case InstructionType::bltu:      return Create_bltu(rs1, rs2, immediate);
+		case InstructionType::bgeu:      return Create_bgeu(rs1, rs2, immediate);
+		case InstructionType::jalr:      return Create_jalr(rd, rs1, immediate);
+		case InstructionType::jal:       return Create_jal(rd, immediate);
+		case InstructionType::ecall:     return Create_ecall();
+		case InstructionType::ebreak:    return Create_ebreak();
+		case InstructionType::csrrw:     return Create_csrrw(rd, rs1, csr);
+		case InstructionType::csrrs:     return Create_csrrs(rd, rs1, csr);
+		case InstructionType::csrrc:     return Create_csrrc(rd, rs1, csr);
+		case InstructionType::csrrwi:    return Create_csrrwi(rd, instruction.rs1, csr);
+		case InstructionType::csrrsi:    return Create_csrrsi(rd, instruction.rs1, csr);
+		case InstructionType::csrrci:    return Create_csrrci(rd, instruction.rs1, csr);
+		case InstructionType::mul:       return Create_mul(rd, rs1, rs2);
+		case InstructionType::mulh:      return Create_mulh(rd, rs1, rs2);
+		case InstructionType::mulhsu:    return Create_mulhsu(rd, rs1, rs2);
+		case InstructionType::mulhu:     return Create_mulhu(rd, rs1, rs2);
+		case InstructionType::div:       return Create_div(rd, rs1, rs2);
+		case InstructionType::divu:      return Create_divu(rd, rs1, rs2);
+		case InstructionType::rem:       return Create_rem(rd, rs1, rs2);
+		case InstructionType::remu:      return Create_remu(rd, rs1, rs2);
+		case InstructionType::lr_w:      return Create_lr_w(rd, rs1, acquire, release);
+		case InstructionType::sc_w:      return Create_sc_w(rd, rs1, rs2, acquire, release);
+		case InstructionType::amoswap_w: return Create_amoswap_w(rd, rs1, rs2, acquire, release);
+		case InstructionType::amoadd_w:  return Create_amoadd_w(rd, rs1, rs2, acquire, release);
+		case InstructionType::amoxor_w:  return Create_amoxor_w(rd, rs1, rs2, acquire, release);
+		case InstructionType::amoand_w:  return Create_amoand_w(rd, rs1, rs2, acquire, release);
+		case InstructionType::amoor_w:   return Create_amoor_w(rd, rs1, rs2, acquire, release);
+		case InstructionType::amomin_w:  return Create_amomin_w(rd, rs1, rs2, acquire, release);
+		case InstructionType::amomax_w:  return Create_amomax_w(rd, rs1, rs2, acquire, release);
+		case InstructionType::amominu_w: return Create_amominu_w(rd, rs1, rs2, acquire, release);
+		case InstructionType::amomaxu_w: return Create_amomaxu_w(rd, rs1, rs2, acquire, release);
+		default:
+			throw std::runtime_error("Invalid instruction type. Type: " + NumberToBits(static_cast<uint32_t>(instruction.type)));
+	}
+}
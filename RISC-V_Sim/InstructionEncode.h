@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include "Register.h"
+#include "Instruction.h"
 
 struct MultiInstruction
 {
@@ -50,12 +51,12 @@ uint32_t Create_jalr(const Regs rd, const Regs rs1, const uint32_t immediate);
 uint32_t Create_jal(const Regs rd, const uint32_t immediate);
 uint32_t Create_ecall();
 uint32_t Create_ebreak();
-uint32_t Create_csrrw();
-uint32_t Create_csrrs();
-uint32_t Create_csrrc();
-uint32_t Create_csrrwi();
-uint32_t Create_csrrsi();
-uint32_t Create_csrrci();
+uint32_t Create_csrrw(const Regs rd, const Regs rs1, const uint32_t csr);
+uint32_t Create_csrrs(const Regs rd, const Regs rs1, const uint32_t csr);
+uint32_t Create_csrrc(const Regs rd, const Regs rs1, const uint32_t csr);
+uint32_t Create_csrrwi(const Regs rd, const uint32_t zimm, const uint32_t csr);
+uint32_t Create_csrrsi(const Regs rd, const uint32_t zimm, const uint32_t csr);
+uint32_t Create_csrrci(const Regs rd, const uint32_t zimm, const uint32_t csr);
 uint32_t Create_mul(const Regs rd, const Regs rs1, const Regs rs2);
 uint32_t Create_mulh(const Regs rd, const Regs rs1, const Regs rs2);
 uint32_t Create_mulhsu(const Regs rd, const Regs rs1, const Regs rs2);
@@ -64,4 +65,20 @@ uint32_t Create_div(const Regs rd, const Regs rs1, const Regs rs2);
 uint32_t Create_divu(const Regs rd, const Regs rs1, const Regs rs2);
 uint32_t Create_rem(const Regs rd, const Regs rs1, const Regs rs2);
 uint32_t Create_remu(const Regs rd, const Regs rs1, const Regs rs2);
+
+uint32_t Create_lr_w(const Regs rd, const Regs rs1, const bool acquire = false, const bool release = false);
+uint32_t Create_sc_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire = false, const bool release = false);
+uint32_t Create_amoswap_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire = false, const bool release = false);
+uint32_t Create_amoadd_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire = false, const bool release = false);
+uint32_t Create_amoxor_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire = false, const bool release = false);
+uint32_t Create_amoand_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire = false, const bool release = false);
+uint32_t Create_amoor_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire = false, const bool release = false);
+uint32_t Create_amomin_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire = false, const bool release = false);
+uint32_t Create_amomax_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire = false, const bool release = false);
+uint32_t Create_amominu_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire = false, const bool release = false);
+uint32_t Create_amomaxu_w(const Regs rd, const Regs rs1, const Regs rs2, const bool acquire = false, const bool release = false);
 MultiInstruction Create_li(const Regs rd, const uint32_t immediate);
+
+//encodes a decoded instruction with the Create_ function for its type,
+//so decoding the result gives the same instruction back
+uint32_t EncodeInstruction(const Instruction& instruction);
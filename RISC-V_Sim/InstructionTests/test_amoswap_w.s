@@ -0,0 +1,9 @@
+addi s0 x0 200
+addi s1 x0 1234
+lui s2 1
+addi s2 s2 225
+sw s1 0(s0)
+amoswap.w t0 s2 (s0)
+lw t1 0(s0)
+addi a0 x0 10
+ecall
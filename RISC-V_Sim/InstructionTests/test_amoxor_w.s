@@ -0,0 +1,8 @@
+addi s0 x0 200
+addi s1 x0 12
+addi s2 x0 10
+sw s1 0(s0)
+amoxor.w t0 s2 (s0)
+lw t1 0(s0)
+addi a0 x0 10
+ecall
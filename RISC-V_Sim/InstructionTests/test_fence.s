@@ -0,0 +1,6 @@
+addi s0 x0 77
+sw s0 100(x0)
+fence x0 x0 255
+lw t0 100(x0)
+addi a0 x0 10
+ecall
@@ -5,5 +5,9 @@ addi a0 x0 -4
 jalr t1 a0 28
 addi s0 x0 -1
 addi s1 x0 1
+addi a1 x0 32
+jalr a1 a1 8
+addi s0 x0 -1
+addi s2 x0 1
 addi a0 x0 10
 ecall
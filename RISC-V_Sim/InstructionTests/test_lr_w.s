@@ -0,0 +1,7 @@
+addi s0 x0 200
+lui s1 524289
+addi s1 s1 564
+sw s1 0(s0)
+lr.w t0 (s0)
+addi a0 x0 10
+ecall
@@ -30,15 +30,15 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-xori tp t6 -900
-addi a4 t6 -962
-andi s7 a3 -51
-ori s3 s10 1351
-xor s1 t1 s10
-mulhsu t6 s5 s0
-sra tp s5 x0
-lui s7 132054
-divu t3 a0 t3
-sll s2 tp t1
+sltu t0 s5 t0
+mulhsu x0 s7 t5
+addi tp a1 1850
+mulhsu s0 t5 s1
+slti ra a0 -949
+sra a5 a0 t6
+sltu s8 t3 gp
+srli gp a5 31
+xori t2 a6 1512
+srai t0 a5 3
 addi a0 x0 10
 ecall
@@ -30,10005 +30,10005 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-slli t6 s4 16
-add a1 s9 a7
-srai gp s0 21
-srai s6 t6 25
-mulhsu a0 ra x0
-srai s2 a2 10
-auipc a6 76504
-sltu s7 t1 a7
-srli t5 a2 14
-mul x0 s6 a2
-srai s2 t0 7
-srai s9 t1 6
-divu s9 a4 a0
-sltiu x0 ra -1948
-addi a6 a2 -1852
-mul s5 t5 ra
-mulhsu a4 a4 t4
-mul s2 t1 t4
-ori s11 s4 -1589
-rem t3 tp s8
-sra a1 s3 s5
-ori a7 a3 1780
-divu s5 a1 a2
-auipc tp 474436
-slli ra s1 11
-mulh s7 a3 t5
-div t0 gp a7
-auipc a6 895475
-rem a2 s7 s0
-or t2 t1 s2
-srai s6 s2 2
-sltiu s5 a0 528
-srai t4 a4 19
-sra t0 a4 t4
-andi a7 a7 -2031
-xori s7 s4 -1601
-sltu t1 s1 s7
-sltu s6 s10 s2
-mulhsu t6 s10 s11
-or t6 t1 s6
-auipc s11 648380
-xori a1 t6 -327
-slti s7 a6 -396
-auipc x0 653434
-srl s10 a0 s2
-slt s7 a2 a1
-lui t4 921652
-xor ra gp a5
-divu s10 gp t6
-div ra t3 t2
-rem a5 s0 s3
-xori a1 t6 156
-and t1 a5 s3
-slli a6 a7 13
-srli a4 x0 6
-sra t2 a1 s0
-sll tp a4 a6
-andi s8 s6 -1541
-sub ra t1 t1
-mulhsu a4 a1 t4
-slti t3 s6 -104
-sll s4 gp a0
-sra s11 s1 x0
-xori t1 s0 -862
-div a7 s4 t4
-slti s4 a2 240
-divu tp x0 t6
-ori s4 s9 -983
-mul a1 s6 s5
-sra t1 ra s3
-div s8 t3 a5
-xori a0 s6 -1177
-sub t3 a1 t6
-srli s3 t1 2
-slti x0 a7 202
-andi a6 x0 -242
-mul tp a1 t4
-sll a5 a7 tp
-sltu a0 t4 a5
-or s8 s11 t0
-add s8 gp s7
-mulh a2 t0 s8
-and t0 gp x0
-divu s2 a7 a3
-sub s10 s8 t0
-div s3 t2 a1
-slti s7 gp -1162
-divu tp gp x0
-mulh t6 s9 a4
-and s9 a0 s0
-slti t3 x0 -1182
-ori a3 s2 -494
-ori a1 a4 1682
-slt t0 s6 a5
-mulhu s1 a4 ra
-add s11 s9 s1
-slt a4 tp t3
-sltu s2 t1 t4
-sll x0 s0 s1
-sltu s6 gp ra
-rem s11 t0 t6
-or s0 gp s8
-lui s3 217754
-addi t1 s10 455
-mul x0 a5 a5
-mulhsu a7 s4 a2
-slti t6 ra -1210
-ori s3 t1 -888
-addi t2 a2 -1445
-and s5 s2 a5
-xor gp s3 a6
-mulhsu s10 s4 s11
-divu t5 t4 s3
-sub s2 x0 t0
-mulhsu s9 a3 tp
-xor a4 s5 a0
-sll s5 a3 t4
-mulh a2 s4 s10
-addi tp s4 -290
-div s2 t0 a0
-addi a6 s10 280
-slt t4 a2 a7
-slt s0 ra a4
-mulhu s7 t6 t4
-sub x0 s11 t6
-slti t4 s6 -2025
-srl s1 t3 t6
-sltu s2 s9 s6
-sub s11 t3 a0
-addi a4 t4 -1257
-rem a5 s6 s8
-and a0 s0 x0
-mulh t5 s5 s0
-or s8 gp s1
-slti x0 s8 -1459
-add s0 a1 s6
-xor t6 s6 s11
-ori a5 t4 -984
-div s1 a1 s2
-rem a6 x0 a5
-mulh a4 tp s9
-mulh t5 s1 t5
-divu s6 t4 s1
-sub x0 tp t4
-xor s5 t5 a7
-slt s9 t2 a6
-or s5 s10 s4
-auipc tp 850037
-divu s8 t4 a2
-slti s0 s7 -690
-div a5 s4 s0
-slli t0 s4 1
-or s4 a5 s1
-slli x0 a0 13
-slt a7 s5 t4
-and a5 t5 s9
-sra x0 s0 t6
-srl s7 a0 s6
-srli t3 a6 11
-slli a4 s7 28
-sltu s10 t5 s4
-or t6 s10 t4
-srli a5 ra 11
-srli x0 s9 22
-and s3 a1 s9
-mulhu a1 x0 t5
-slt s11 s11 t6
-lui a1 444174
-sltu t1 a0 s3
-lui s8 746859
-auipc t5 749454
-addi s8 s3 -1633
-div s1 a5 x0
-rem t3 a3 a2
-addi s11 s5 -368
-xori t3 s7 1154
-sltu a0 t6 t2
-sra t5 t3 gp
-rem a0 s0 a3
-srli tp t3 20
-sll gp s11 t5
-remu a0 s10 tp
-lui t4 141989
-or x0 ra s11
-add s0 s0 x0
-xori t4 tp 987
-mul x0 s0 s10
-andi ra a7 -1565
-auipc a5 381642
-andi s8 t5 -451
-sltiu a1 a1 -1700
-sltu t5 t4 t2
-mul t3 t6 x0
-auipc t0 293966
-slti a5 s2 -1843
-sll a5 s6 a4
-slti t2 t4 1892
-slti a1 t4 -1707
-mulh t2 s4 t0
-slli tp x0 3
-sra a6 s6 gp
-xori t1 s4 -1282
-lui t6 811646
-sra t5 t6 s3
-div t0 a4 s4
-divu s3 gp tp
-srli t4 s7 7
-mulh s7 ra tp
-srli t6 s11 12
-xori t6 tp 1998
-slt a6 s10 s10
-remu s0 t1 s5
-srai s8 s4 21
-sltu x0 s8 a0
-div x0 s5 s6
-mulhsu t4 a7 s7
-srli s10 tp 22
-remu s1 x0 a2
-mul s9 s2 a4
-sub a2 t4 t4
-add t3 t2 tp
-divu a5 tp t3
-remu t6 s0 a2
-remu a6 s10 s8
-divu s4 x0 x0
-sub s8 t1 t1
-div a0 x0 a1
-sltu a2 s10 a5
-andi a2 tp -566
-slti t6 s8 -633
-sub x0 x0 a6
-srai a2 t5 23
-and ra s10 s0
-srli t6 s8 6
-srai t5 a2 15
-srai t5 s2 15
-sltu a7 s4 s4
-slt a2 a3 a6
-mul s1 t0 t4
-sltu t6 s9 a3
-sltu gp tp s8
-auipc t2 526060
-add a5 a7 s4
-srl s8 s3 s6
-sltu t0 x0 s10
-and a0 s3 a2
-divu s3 a0 a2
-slt s10 a4 a1
-srai t4 s2 25
-or ra s9 t3
-mulhsu s3 t6 a6
-div s1 s2 s0
-mulhu t2 s7 t3
-mulh a5 t4 s4
-slli s4 a1 13
-slt s5 t3 s8
-mulhu s8 s11 s4
-andi t6 tp 1380
-sltu s7 a1 s2
-slli s10 ra 1
-mulhsu a7 s9 a3
-sub t1 s1 t3
-add a6 t6 a4
-or t4 a7 s4
-slt t3 s3 s5
-slti s1 gp 164
-sll a1 t6 ra
-sll a4 t3 tp
-xor s4 x0 a0
-ori t4 s3 88
-sra ra tp a1
-slti a2 t2 1296
-andi s10 t1 -495
-divu s8 a7 tp
-mulhsu s5 a6 a6
-mulh t5 s3 t0
-divu s3 a0 t4
-slti t4 t5 1249
-auipc s5 91826
-lui ra 498608
-mulh t0 s6 s4
-auipc t0 720934
-and s4 s8 a5
-srai tp t4 12
-auipc a5 665334
-slt a5 s6 gp
-srai a5 a1 19
-add a4 s10 s6
-and x0 x0 t3
-mulh a1 a2 a6
-slti s8 t4 -183
-mul s11 s8 s4
-mulh t5 s5 s9
-slti a3 t5 -1048
-xor a1 s1 t6
-slti a6 s0 -1922
-mulhsu a2 a4 x0
-andi s3 s3 602
-mulh a1 s10 x0
-rem s6 x0 x0
-auipc x0 608689
-sltiu s7 s10 1057
-mul s11 t3 s4
-mul s8 a0 a1
-slt s9 a1 ra
-srli s1 a5 19
-sltu t1 s10 a3
-sltu s10 s3 s3
-sltu s10 a1 s2
-sra tp a3 s2
-sub t4 t3 t3
-slt t0 t3 s5
-andi a3 s4 -1810
-and ra s8 gp
-srl s9 ra t5
-addi a0 t6 -1204
-slt s10 s0 s3
-xori x0 s1 -388
-slli s1 gp 25
-sltiu x0 a3 -168
-sub a4 s7 s2
-and ra a4 s4
-mulhsu gp a7 t2
-divu x0 t2 t4
-addi t4 ra -788
-mulhu s3 a6 t1
-mulh a1 x0 t0
-slti t3 s2 -1632
-mulhu s8 t6 gp
-mulhu x0 s11 s9
-sll tp x0 t1
-or a7 t0 t6
-srl a1 s2 t0
-xori s3 s11 1279
-remu s10 s8 x0
-add a1 s7 x0
-srli a1 x0 22
-and s3 a7 t4
-sub a5 t5 t1
-xori x0 s10 534
-sltiu a6 a4 -405
-mulhsu s8 a1 t0
-slli tp s3 24
-and t3 t2 a0
-div s11 t1 s5
-addi s2 a2 -1343
-slti a7 gp -291
-slt s10 gp a2
-ori t6 a2 -1064
-mulhsu a5 s8 t5
-xor s3 a7 t5
-srai t6 s8 26
-sra s0 t2 x0
-sra t6 gp x0
-andi x0 t5 1769
-and tp a5 s10
-xor tp a6 s2
-div a0 s9 t1
-slti s3 t3 1074
-mulhu a1 s8 t4
-sub a6 a3 t0
-mul x0 s10 x0
-div t2 s9 tp
-xor gp t0 s4
-mul ra s8 s8
-srl a5 gp t2
-divu t2 s1 x0
-mulhsu a3 a3 s9
-rem s11 tp s3
-div a3 s3 a2
-mul gp s5 t2
-srli s3 s10 6
-srai s10 s8 23
-srai gp s4 21
-ori s6 s10 1934
-sltiu a3 s5 -263
-div t3 s0 a6
-srl x0 s7 s0
-add a7 gp t0
-and s2 a5 gp
-divu a6 t0 x0
-slli a2 ra 2
-sltiu tp s3 287
-lui s1 11486
-mulhsu ra t5 ra
-mulhsu s1 t5 t5
-lui s7 580363
-div t0 t4 gp
-slt a1 a6 s3
-srl s4 t5 a0
-mul x0 a0 t1
-xori a2 a6 1348
-srl a1 s8 s2
-rem s6 s8 a0
-andi s11 s4 -1175
-slt s0 ra a3
-mul s7 s4 s4
-lui t3 4318
-or t1 a1 s2
-sra a3 a0 a4
-srai x0 x0 10
-remu s0 t2 ra
-sltiu tp a4 1391
-divu t4 s0 a0
-addi t1 s8 1813
-rem s5 a3 s9
-srl a7 x0 s7
-or x0 a7 a1
-add t6 s11 a2
-auipc s4 817987
-mulhu s2 tp t1
-mulhsu t4 a7 s11
-mulh s1 tp s1
-slli gp a5 6
-ori s8 t3 -597
-xor s6 s3 s6
-srli t6 s5 19
-sltu s10 ra a4
-sra gp s3 t5
-rem s10 a4 s6
-mulh s3 a6 a4
-slt a4 t3 a6
-auipc s0 60588
-sra t6 t6 a1
-div s11 x0 x0
-div gp x0 s4
-sra s6 t5 a4
-srli x0 s11 25
-rem t5 s5 t2
-div a4 t1 s5
-srli s6 t0 17
-mulh s11 ra x0
-mulhsu s9 t1 ra
-sub a3 x0 x0
-sltiu s5 s1 1048
-auipc s3 686448
-addi s1 s6 1969
-remu a2 s0 s9
-sltu t4 t6 t3
-lui s7 1009375
-mulh s5 s2 s4
-srai a3 t4 28
-sra t1 s0 a3
-srai a2 a3 23
-xori tp a7 1027
-remu s4 s11 s6
-mulh ra s10 ra
-xori s7 gp -638
-sltiu gp a5 1720
-xori s5 t2 371
-slti t4 a4 999
-auipc s9 582484
-srli a0 t5 1
-srai s7 s8 10
-slt a1 s0 t5
-slli s7 t2 23
-sltu t2 s8 s5
-sltiu a2 t3 295
-lui s0 141490
-xori s7 t1 328
-xori t4 a6 -98
-rem s8 t2 a3
-xor ra s7 s2
-or s7 s9 ra
-sltu a7 t1 s10
-xori a4 t5 -636
-remu a6 x0 s0
-addi t3 s8 -1309
-and s3 s10 a1
-add s4 s0 t6
-mulh s9 s9 s1
-mulh x0 a3 a0
-sll s8 a4 t6
-auipc a6 27111
-srli a3 s9 27
-sltiu gp gp -1118
-mulhu t3 a0 a2
-sltu a6 x0 s9
-remu a5 s8 a1
-addi s1 a7 1901
-ori s10 t5 -1274
-rem s10 a5 t6
-divu s10 t0 ra
-srai a6 s6 12
-auipc a0 344956
-sll x0 s11 s3
-slt s6 a4 a1
-remu s4 t3 a5
-xori s6 a4 1002
-slli gp tp 26
-mul a2 a5 a3
-srl s5 t6 s2
-addi s11 a0 260
-srai t4 t5 10
-xori t5 s3 -1258
-sra s9 a5 t0
-or a5 t3 s4
-sra t6 s0 x0
-slti t5 t4 -1706
-add a1 s11 s2
-xor s10 a1 t6
-rem a6 s9 a7
-xori t3 a5 -825
-srai t3 s7 18
-div s10 a0 s6
-div x0 s8 t5
-sltu t2 t2 s8
-sub t3 s5 tp
-xor s0 a5 s2
-andi s7 t0 -163
-rem tp t3 a7
-slti a1 a0 -78
-ori s9 t5 -861
-rem a6 t4 t4
-divu s7 a5 t0
-mulh a4 s5 a0
-andi t6 s2 -1832
-remu s1 x0 t6
-mulhu s8 x0 a7
-slt t1 gp a6
-srli s4 a2 25
-ori s5 a0 -743
-divu a7 s8 a5
-srli t3 a7 30
-sltiu tp s11 -1946
-srli x0 t4 31
-mulhu s4 s8 a3
-sll t6 s2 s2
-sltiu x0 s11 74
-remu s8 a7 a5
-rem s10 a4 x0
-sra gp s10 t2
-slti s10 x0 343
-mulh s3 a5 a0
-div a4 s4 t3
-addi t5 s6 -743
-mul a2 s5 x0
-mulhsu a2 s0 s5
-srli ra s11 24
-auipc s3 552060
-divu a0 tp a3
-mulhsu t4 s10 tp
-slti s1 s5 -748
-rem a2 t4 a6
-sra s4 s9 s10
-sltu a2 t2 a7
-sll t0 gp t5
-xor a2 t0 a3
-sltiu s0 a6 -639
-sltu a1 s7 t2
-srai a5 s0 29
-sra a1 s3 s10
-slli s11 tp 23
-slti a3 a2 -1061
-srai s1 s11 15
-add t0 a2 a2
-sub a1 s6 a0
-srai x0 s0 18
-mul s11 a1 s4
-mulh a1 s5 a3
-auipc t3 655904
-or t0 tp s11
-add x0 s0 s11
-slt a3 x0 t5
-srai x0 a7 7
-srai s7 s3 13
-mulhsu s5 a2 tp
-mulhsu t6 t0 x0
-xor t3 s5 a6
-or t4 s9 a7
-rem t0 t5 a7
-sll t2 gp s0
-div s4 s10 t3
-remu s7 s6 a7
-mulh s10 s10 s3
-slli t5 x0 25
-xor a3 x0 a6
-andi gp x0 -362
-sltu s1 tp s3
-slt t3 tp tp
-rem s4 gp s2
-rem a5 a5 s6
-add t0 t2 s8
-lui a3 610551
-mul a1 s4 s4
-sltiu s8 s6 -787
-xori a2 t6 -102
-ori x0 s9 293
-srl s9 s8 s4
-divu s0 s0 s11
-or t6 s5 ra
-slt s4 s7 t4
-slti a7 s1 -1775
-auipc s10 83672
-sltiu t6 s2 -1919
-addi x0 a4 159
-addi s0 t2 197
-sub a7 tp a5
-mulhu a6 s2 t1
-srl gp t6 s0
-mulhu a3 t0 s8
-sll a6 s2 s9
-remu a6 a5 t2
-slt t6 s7 t0
-srl x0 s9 s4
-div t6 s9 x0
-srai a0 s4 28
-add s5 s1 a0
-auipc s9 383845
-and a5 tp s4
-sub gp tp tp
-srai s8 t0 12
-mulh a3 t4 s0
-mulh s7 t0 t4
-remu s11 s7 t3
-mulhu t0 s7 t0
-slli t5 a0 10
-add s2 gp t6
-slti tp s3 1175
-srai t3 s9 29
-div t4 a3 a7
-addi s3 t6 -1489
-andi t5 a4 1075
-srli ra a1 27
-remu s4 s9 s2
-sub s8 t5 x0
-xori s8 t3 1759
-slt s7 a1 s9
-divu s5 t1 x0
-sltu s6 t5 a4
-add s10 s3 a4
-srl s6 t3 s11
-slti s7 s0 -1706
-slli a4 s0 6
-xor t1 a2 s1
-mul x0 a7 t1
-div t0 s1 t2
-slt s1 s1 s6
-lui s4 803390
-mulhsu t2 s2 s9
-mulh t1 a2 a1
-lui s4 800969
-xori s11 gp -331
-slt tp s5 s7
-mulh s2 a0 a7
-mulhsu t6 t2 t2
-xor s1 ra t5
-rem tp t1 s1
-sra s4 s2 s7
-xori s7 s0 -1144
-xori a0 s9 1245
-slli t4 x0 12
-slti x0 s3 -1258
-srli gp tp 31
-xor s6 a4 s2
-xor a5 a5 s9
-sltiu s8 a1 -1958
-lui t0 257815
-sltu t3 s9 s10
-sra t3 t6 gp
-slt tp s7 a3
-srai gp s8 13
-srai a4 s7 24
-addi t4 s11 -280
-slli t2 s2 0
-xori s8 t5 -1178
-srai s5 a4 9
-sll s3 s8 a3
-sltu s0 s3 t3
-xori ra t5 1362
-or t2 a5 t4
-mulh a0 s5 t6
-sll a1 a5 s10
-div s2 s2 s0
-div s3 s9 t2
-add t6 s5 s2
-addi t6 s5 -998
-mulhu a6 a3 a6
-sltiu s11 s1 145
-addi a5 t3 654
-add t0 s9 s6
-divu s1 a1 s0
-add s8 s9 t2
-div t0 a2 a7
-slt a4 s5 t5
-or gp t2 t2
-xori a7 a1 -1434
-mul s4 a0 s6
-andi a0 a2 -1470
-or t3 s3 t2
-rem s7 gp s9
-ori ra s6 -1700
-remu t0 x0 s11
-remu t5 a4 x0
-remu t2 gp s8
-sra a3 t1 a2
-and a4 s1 a1
-xori gp x0 1922
-srl a5 gp t3
-or s8 t3 a1
-sltu s1 t2 t2
-rem t4 a6 s10
-div a4 s1 t3
-sra s0 t4 t2
-mulh s10 t6 t3
-sll s3 t2 a7
-ori t0 s8 518
-srli s5 a3 20
-srai s6 x0 2
-divu a2 a2 a1
-mulh t1 t0 x0
-sra s3 t3 a5
-sll gp s1 s8
-slt tp t2 s10
-srl s6 a4 x0
-or t6 t2 s7
-sltu a7 s9 a7
-andi x0 a2 -2020
-srl s5 ra t5
-srai s10 t6 18
-sltiu t2 a4 1414
-mulhu a1 s10 t5
-sltiu a3 t3 484
-mulh s1 t1 ra
-sll a6 a1 s11
-andi tp a5 -1400
-div a1 t0 t1
-xori s9 s8 -1750
-div s0 a7 s1
-rem a5 a4 a0
-addi t5 s9 -1459
-divu t4 s2 s1
-srai s1 s2 0
-mulhsu t6 s5 a1
-auipc s6 47145
-srl s8 x0 s5
-xori t5 s0 915
-remu s7 t4 a7
-srl s3 x0 t6
-sra s8 s9 a3
-or a5 a6 s6
-slt s9 s9 x0
-lui s11 360021
-xori t6 s11 -1444
-mul s10 t5 x0
-slt x0 a6 a2
-srli s11 a7 5
-sra s7 s11 a7
-and a7 s5 t4
-srl tp tp a1
-remu s4 s11 s1
-remu s2 s3 x0
-and s1 t0 s9
-divu a0 s11 t0
-srli tp a5 7
-remu s2 t0 tp
-mulh s4 x0 a0
-auipc s8 422428
-sll s6 s8 t4
-sll s4 a3 t6
-mulhu s0 s1 t2
-srli s4 t4 16
-sra s11 t1 a3
-rem a7 s7 t2
-xori a1 tp -327
-mul s3 s3 t1
-add s3 a6 t2
-add s8 t2 a7
-mulhu s5 t4 s9
-or s1 a1 t0
-slti s7 t3 -1707
-sra x0 t5 s7
-ori t3 t1 616
-auipc t6 575292
-ori s6 a2 -1109
-and s1 t1 a5
-mulhu t3 a4 t4
-sltu t1 s2 a1
-and x0 t5 gp
-or t6 t4 a5
-xor a6 ra a5
-slt a1 a5 t4
-mulhsu s8 s2 a4
-addi t3 a6 797
-slt s10 a6 t6
-rem x0 t1 t2
-sra t6 s0 s5
-xor x0 s9 a7
-addi t6 s6 886
-rem t1 s0 s3
-mulhu a5 a7 s11
-mulh s4 s3 tp
-div a7 s0 t6
-rem t6 gp s10
-or a7 a6 s8
-add t5 s5 s5
-remu a5 s3 t5
-lui a6 231642
-or a0 s9 t0
-remu a6 a7 s4
-auipc ra 225363
-mulhsu s4 t0 s9
-slli t3 ra 16
-add a0 s3 t4
-divu s8 a2 t1
-slti s3 a4 1017
-srli x0 s0 28
-sll s3 s11 a0
-remu s6 t4 s9
-or s8 a5 tp
-srli s11 s5 4
-xori s2 a5 -1818
-remu a1 x0 a3
-srli ra s8 29
-slt tp t4 s0
-srai t6 s6 28
-andi t5 a3 1633
-mul s8 x0 x0
-sra a3 s0 gp
-xor a5 s5 t3
-add s2 s0 t2
-slli s5 s0 17
-sltu s9 gp tp
-xori s6 t4 -741
-div s4 a0 s5
-srl s9 t3 a1
-srl s9 s9 a7
-slt t0 s5 s8
-sub t1 t6 a4
-or s6 s0 s0
-sub x0 s2 s2
-divu s3 t5 a4
-xor s6 x0 s6
-add s5 ra s8
-sltiu s1 t3 -710
-div t5 x0 x0
-remu t4 a4 s7
-mulh a6 s0 a1
-lui x0 910100
-andi a2 x0 -1907
-mulhsu s10 a4 s2
-sll s10 s5 t6
-mul a2 a3 t4
-xori s2 t5 -1008
-mul t3 a3 tp
-auipc a7 43902
-add s11 t2 a2
-slli t6 s5 1
-andi a3 s8 -1698
-mulhsu s5 t6 t4
-xori s2 s8 -194
-auipc s10 349812
-andi gp t0 -1378
-sll x0 t1 s3
-mulhsu a0 s10 x0
-sub a0 s9 s2
-rem s11 s4 a4
-divu s11 a6 s7
-or a1 t0 a3
-or a2 t4 tp
-div s6 t5 s1
-mulhu a1 a5 a1
-slti a3 ra 614
-divu s4 s9 s7
-rem x0 gp tp
-mulhu t5 ra a0
-slti s10 tp -555
-sltu t2 s6 a6
-sll a5 a1 t2
-mul s7 s4 gp
-lui a2 307415
-srli ra t4 3
-srli t5 s2 15
-mulhu a5 s8 s5
-sltiu s6 a5 1029
-slli t6 s4 13
-and s1 t4 x0
-srl s5 t3 a4
-or t0 t3 a0
-andi a1 a3 1777
-add s7 t2 a1
-sltiu s9 a1 -1721
-rem a4 x0 s5
-sltiu s3 s11 -1445
-sltu t2 s1 t3
-auipc s2 436194
-srl ra a7 a2
-sltiu x0 s1 1071
-xor s1 a2 s1
-lui a0 559867
-lui ra 317523
-rem t5 s9 s2
-and ra gp a5
-sltiu s5 ra -1054
-mul a0 a2 s0
-divu s5 a2 a3
-srli a1 a6 0
-sub a4 a3 s5
-slti s6 t6 598
-div s2 x0 t6
-div s11 t3 x0
-sll s5 a6 a3
-and a5 s0 s2
-div x0 a5 s0
-slti s9 a6 -422
-div s1 a1 s4
-lui s10 32174
-or x0 s0 s7
-xor s7 s11 t3
-remu x0 s8 a6
-mulh s9 a3 s0
-slli ra a5 14
-add a6 s3 a1
-slti t4 t1 -1423
-auipc a5 473061
-auipc a7 877853
-sll s5 a2 t1
-ori a4 s1 127
-add s7 t4 s10
-lui s3 870056
-mul t6 t3 a2
-slli s7 s9 0
-remu a6 a0 s9
-div a5 a6 s5
-and s7 s8 s11
-sltu t5 ra a0
-srli s9 a7 24
-and s4 s10 t6
-andi t5 t4 -1041
-add ra gp a2
-remu tp a4 t2
-lui tp 817911
-mul a7 t0 t6
-xori s2 x0 -2003
-mulhsu a1 s5 a3
-xori s0 gp -341
-remu s11 gp a4
-mul t2 s1 t2
-sltu t0 t3 tp
-auipc t6 220243
-sra a5 s2 s6
-addi s4 t3 -766
-rem s8 s0 t5
-rem t4 a2 s11
-slt t3 a3 t4
-rem tp t4 s0
-srli s7 t6 28
-slli gp a3 31
-rem a1 a3 a6
-auipc a5 745961
-xori a2 s7 -1153
-addi x0 s4 1864
-lui x0 344283
-ori a4 ra -873
-add s4 s8 s4
-mulhu s5 t1 a4
-divu t5 tp a0
-ori tp x0 -54
-mul t0 t6 s4
-sub tp s7 t0
-sra a2 s1 s4
-add t4 s3 s7
-remu a2 s2 s11
-and tp a1 t1
-xor t6 tp ra
-divu ra a4 s4
-and a7 a1 s8
-rem s6 a0 t6
-and s9 s4 s0
-ori a1 t1 162
-add a3 t1 t6
-ori a2 tp -1300
-slti s5 s6 1709
-mulhu a7 s9 a5
-sll t5 t3 s0
-sub s4 s8 a6
-srli a6 t1 12
-remu s7 tp t5
-mulhu s7 s8 t4
-slti a0 x0 1686
-mulhu a5 a2 ra
-and s1 s0 x0
-andi s0 a0 -1764
-mulhu s11 s5 ra
-rem a6 s1 s11
-rem s5 s9 t2
-mulh s4 s7 t3
-sltiu s5 a7 -1412
-add tp a4 t6
-auipc s6 244990
-div t2 s10 t0
-rem gp a3 t3
-mulhsu s11 tp s6
-sll a6 gp a0
-rem a3 t5 s1
-mulhu a3 t3 s11
-add t2 a7 s6
-mulh a4 a3 a3
-ori t3 t1 -587
-addi t4 a7 -542
-sra s9 s6 a3
-slli s6 a2 28
-and s2 s11 tp
-mulh s10 tp t5
-sll a3 s10 t4
-lui t1 391431
-srli s6 ra 1
-mulh s6 a6 s0
-slt s9 a6 s3
-ori t3 t5 -294
-sltu a3 t1 t3
-mulh s1 s8 s4
-slli a0 ra 7
-srai a3 t3 2
-div a6 s8 s9
-and a1 s0 a0
-rem a4 x0 t4
-addi s2 a3 1601
-sltiu s3 gp -1996
-slt s11 a7 s8
-sltiu s5 t6 -1612
-sll s7 x0 a6
-sll s6 gp tp
-slt t5 a7 s3
-srli t1 a2 28
-sll a6 s3 s6
-sra s8 t3 s4
-and t5 a4 s3
-add t4 gp t4
-div a5 a4 a5
-mul a5 s3 t6
-remu s9 t6 t4
-ori s9 s3 -1026
-rem t2 t1 t5
-mulhsu a4 a6 a1
-slt s4 a3 x0
-addi t5 a6 -774
-srl s10 a2 a2
-xori t3 s3 1315
-lui s7 338512
-add s4 t1 s9
-div s2 tp t6
-remu a1 ra a4
-and s9 s8 t6
-srli s1 ra 30
-div s3 t6 t0
-div s6 t2 s0
-xori t4 s0 -620
-slli t3 a7 29
-lui s6 911034
-auipc s10 860034
-andi s2 a6 -1729
-ori tp ra -1825
-sltu a7 x0 s10
-add t5 a3 x0
-add tp a0 a2
-mulhu t5 s7 t1
-mulh s10 t1 t2
-sub t1 t5 x0
-mulh a5 a3 x0
-slli a5 a4 22
-andi s8 t3 -1548
-mulh s4 ra a2
-sltiu s11 a3 -208
-xor t6 a4 s2
-xori t0 s10 -347
-mulhu s0 s10 a0
-srli s5 t2 24
-mulh t4 gp s1
-mul s8 tp a0
-or a3 gp tp
-auipc s10 519166
-divu t1 x0 a6
-sltu s6 s0 t5
-lui s0 664374
-andi a1 t2 -2041
-srl a0 a1 ra
-xor x0 s8 x0
-auipc ra 176292
-srli s8 tp 14
-ori a4 a6 -1129
-xor s9 s0 a7
-sra tp a4 x0
-slt t0 a2 a6
-sltu s10 x0 a6
-slti s8 t1 -1840
-slli s2 s10 0
-mulh s1 s2 x0
-ori s9 a2 -355
-auipc s4 762051
-and s9 a6 s10
-or s10 t2 ra
-slti s1 s3 -1896
-srl t5 t6 s10
-srai a6 t4 17
-slti t1 x0 -42
-auipc s1 736329
-mulhsu s1 x0 s2
-srl x0 s4 x0
-remu s10 ra x0
-or x0 t5 t5
-andi a0 t2 1585
-or t2 s2 a2
-and s11 t2 a6
-slt x0 gp s11
-lui a2 932633
-addi t4 s8 -515
-srl s1 t5 s2
-sll a4 s0 t2
-mulhu s11 t3 a7
-sra s9 a7 s6
-xor s8 s1 s3
-mul s2 t3 a0
-slli x0 t1 4
-add ra a3 t4
-sltiu tp t0 1283
-rem ra t2 ra
-remu t6 x0 a2
-sll t2 a5 s10
-mul a3 a0 gp
-ori a7 t1 -330
-ori x0 tp -1571
-add s1 t6 s4
-sltu ra s3 a4
-div tp t4 s1
-mulhu ra s10 t2
-srli s7 t3 1
-lui tp 76093
-sra t1 s5 a6
-ori a5 s8 -1529
-rem t5 s0 t4
-sra s4 s3 a3
-rem s3 x0 s1
-mulhsu t2 s4 a5
-remu s3 t1 t5
-srli tp a2 27
-srl t2 s1 a2
-andi s4 a3 -67
-andi s10 a2 1287
-mulhsu a3 t5 t0
-div gp s4 t4
-xori s0 t2 64
-slli t6 s0 1
-or t2 t6 s3
-and a4 s7 s2
-sub a0 s4 a5
-sub t4 t3 a4
-or t5 a7 a0
-srai a7 s11 7
-xori s7 s3 1004
-andi s11 a0 -522
-mul s1 s9 a2
-mulhu s4 a0 a7
-slli gp a3 15
-mulh a0 a1 s1
-srai t2 a1 30
-add s6 s6 t1
-slli tp t5 8
-lui s6 424087
-remu t6 tp s0
-or x0 tp x0
-or s4 ra t1
-and a7 t4 s2
-slli s7 t3 2
-divu s6 t0 s11
-lui t4 169689
-xori s10 a2 -1071
-lui t6 169452
-sra s2 a0 a1
-srli s10 s8 4
-div s11 s4 tp
-mulhsu s3 s6 t3
-lui t6 762717
-srl x0 a3 s1
-sub x0 t0 a7
-sub a1 t4 a0
-sub t3 s4 t5
-rem t4 tp t2
-mulh t3 x0 x0
-sltiu t0 s10 -1717
-sll s11 t0 s9
-slti s7 s7 -902
-mulhsu a6 a1 a1
-slli s4 a5 13
-ori a0 gp -202
-mulhu t2 s9 a5
-slt t2 s0 a0
-sll x0 s8 s0
-slti s5 t3 1920
-xor x0 s7 x0
-divu t2 x0 a4
-remu s3 a4 s6
-addi a6 t3 527
-sub x0 t1 a5
-srai s10 t4 19
-sltu s9 s3 tp
-div tp a1 s3
-addi x0 a2 -2001
-srai s3 s7 15
-add a0 a3 s3
-add s4 s3 s5
-addi t6 a6 -1725
-slt a5 tp t0
-slli a0 a2 21
-sub gp s7 a1
-remu ra t6 gp
-add a7 t1 a6
-srli gp s4 13
-mulh s10 s9 s6
-sltu s0 s4 t4
-sra s2 s8 gp
-srl a0 a1 t5
-remu s5 ra gp
-sltu s10 s10 t6
-add t6 s0 s9
-and s7 a6 s8
-sub s3 s8 gp
-mulhu s0 a1 t2
-and a0 a3 s1
-div x0 t4 gp
-slli gp s9 18
-andi s11 s8 -865
-srli s2 t4 2
-rem x0 a6 t1
-ori s0 s9 628
-slti s0 x0 19
-slli s1 a1 27
-sll s4 a5 t4
-or t3 s10 s2
-slti t5 s9 -1418
-sltu a1 s2 t1
-sra ra s10 s8
-add a0 a4 s11
-mulh x0 s11 s11
-or x0 a1 tp
-xori s11 s10 -2040
-sra s3 t3 s3
-ori a0 s4 -660
-divu s4 s2 t2
-mulhu s7 s4 s4
-addi x0 a3 -161
-div s6 s2 x0
-srai a1 s4 17
-ori a2 s3 -152
-slli s1 t3 11
-add x0 a7 s1
-div s1 a5 s1
-rem s1 a3 t1
-sltiu s4 t0 -187
-mulhu a6 s2 a5
-div ra t2 s2
-xori t5 s10 -891
-ori x0 s2 -525
-srai s5 a1 19
-add s5 ra s3
-sll s11 x0 s0
-andi a5 s8 -1689
-srai x0 s3 12
-slli a6 s8 8
-and gp s1 t5
-xor x0 s4 s5
-slt s10 s11 s5
-xor a0 a2 s0
-sll t3 s6 a0
-sra s10 t0 a7
-mulh s10 tp gp
-sub t6 s9 t3
-remu s10 s6 gp
-slt a4 t2 s11
-andi s10 s4 -1846
-srli x0 s1 0
-remu s0 tp a3
-remu s9 s8 a5
-mulhu ra s5 s11
-andi x0 a6 -243
-divu s8 s9 a4
-srli t5 a0 2
-add s5 t2 a1
-srl s4 t6 a3
-rem a5 gp x0
-srli t1 s7 23
-divu s8 t4 tp
-mulhsu s6 x0 t4
-addi a0 a4 137
-and s8 s9 x0
-div t4 s3 gp
-div s6 ra s10
-mulh t5 a1 s11
-mulh gp a4 a0
-slti s2 a7 -1813
-sub s1 s0 a6
-srl s5 s3 gp
-srai tp s0 7
-srai s10 t0 24
-rem s5 t6 s11
-sub a3 t2 s4
-slti a4 s8 -1688
-div a1 t2 a7
-remu a4 t0 t1
-or s2 gp gp
-mulhu a2 t1 a0
-sub s7 ra a4
-xor a1 s11 t1
-mulhu x0 x0 s6
-sltiu s6 s2 -994
-andi s5 x0 1650
-andi s10 x0 -1935
-slt a2 ra tp
-srai s11 s7 9
-mulhsu a4 s0 a0
-andi x0 s1 -1262
-add a1 a3 t5
-sltu t3 a6 t4
-divu a0 a1 t3
-sltiu s2 a1 -2040
-div s0 t6 s3
-remu a7 s5 t0
-slti t0 s0 335
-sltu s9 a4 x0
-ori a2 gp -1005
-xor s4 t5 a6
-lui s6 494440
-div s7 s3 a1
-srai a3 a4 19
-addi s1 s5 434
-sltiu s9 gp -16
-srai s0 t0 13
-auipc s10 307550
-sltu t6 a0 t2
-mulhu a7 s0 s4
-slli t5 t6 8
-sub x0 t5 t6
-divu t5 x0 t2
-sltu a0 a1 s7
-add s3 a3 a1
-andi s10 s11 -609
-lui s7 199952
-add s0 t6 t6
-slti t5 s2 -643
-addi t0 s9 -191
-srai gp t3 16
-mulhsu x0 a6 s5
-ori x0 s3 416
-mul gp a1 t3
-rem gp x0 t3
-or s7 a1 a0
-addi t4 s7 690
-mulh a3 s11 s5
-mulhu t3 x0 s5
-lui s3 951374
-ori t3 s0 -580
-slt s11 s7 a6
-mulhsu a1 x0 tp
-sub s10 a2 a2
-srai s9 t5 25
-mul t1 t0 s7
-div a7 s4 s11
-slti a3 t6 1842
-ori s6 s3 414
-mulhsu tp s5 a2
-mul t6 a5 s6
-addi a3 ra -832
-mulhsu a4 t0 s0
-andi s11 s7 -1212
-srl s9 s6 t0
-rem t2 t6 t1
-sll s8 s11 t6
-srai s10 x0 19
-divu s4 s10 a3
-ori tp tp -971
-divu ra s2 x0
-sltiu t5 s5 134
-andi s8 a6 -347
-xori x0 a4 1229
-and tp s10 x0
-sltu tp s6 a4
-srai s5 a7 4
-sra s6 s9 s0
-xor a2 a4 t4
-auipc a4 672868
-ori a5 x0 232
-xor s6 tp s10
-mulhu ra t2 x0
-ori ra s7 -616
-mulh s3 a3 s8
-mul gp s2 x0
-slli s7 a2 14
-xor t1 t5 s9
-slti a4 a6 533
-auipc t0 313105
-sra a7 a3 gp
-or t1 s2 a6
-lui t1 1000052
-xor a3 s3 t3
-addi s0 s1 643
-mul t4 s2 s2
-andi s5 t6 -894
-divu s8 a3 s8
-slt t4 s9 a0
-slti s3 t4 -666
-sra a4 a7 t4
-rem s0 s3 s6
-slti a4 s3 1956
-sub s10 s2 a4
-div a3 s10 a6
-div tp s7 a6
-mulhu s7 s0 t2
-sub gp ra t0
-remu s3 s3 t5
-mulh t2 s3 t2
-xori x0 a2 755
-srli a1 x0 18
-and s8 t0 s2
-auipc t1 838090
-ori s9 s4 791
-slt x0 s0 t2
-sltu gp s8 t6
-and t2 t4 t4
-mulh tp tp s8
-mul s7 ra s5
-sub t0 s6 a3
-addi a3 a3 278
-slti s0 s0 1720
-mulhu a1 s11 t5
-mulh gp s1 x0
-slt s8 s9 t5
-andi t0 a3 -97
-rem a2 t0 x0
-srli s3 a7 27
-div a4 a7 a6
-slt s0 gp s4
-xor a5 s5 s4
-sltiu s6 s2 837
-slti s5 gp -984
-sra a6 x0 s11
-slt t5 t4 s2
-sra t0 s11 t0
-lui a2 298021
-mul s8 s1 t3
-mulh a2 a1 a2
-addi a0 s9 479
-divu a0 t6 a7
-lui a2 762492
-ori a4 t2 1374
-srai s10 s4 6
-sll x0 t4 x0
-and s0 t2 s3
-sra s4 x0 ra
-slti a2 x0 1169
-sltiu x0 a5 1561
-andi a6 t4 -1271
-srl s4 t4 t5
-slt a4 s10 t3
-srai s7 ra 23
-or s4 tp s0
-slti tp x0 -683
-xor t6 t3 a4
-remu ra x0 s1
-mul s6 s5 a0
-sll gp a1 s1
-add s0 s9 t4
-slti s2 s3 829
-sltiu t0 t5 -1232
-srli t2 s3 4
-srai s10 t3 13
-sub a0 ra s4
-auipc a6 874650
-add t6 a7 a7
-and s7 s9 a2
-or a3 s7 t5
-remu s4 a6 s5
-div s5 s4 s4
-add x0 gp t1
-mulhu a7 a4 s11
-or s5 x0 s10
-andi s5 a6 1404
-and s10 gp a5
-mul s10 t2 a3
-mul s11 a7 s8
-divu t3 s7 s8
-xor a6 a7 s4
-sra s2 a5 s7
-and a0 s5 s6
-sub a1 a1 a1
-mulh a5 gp s0
-auipc a2 471591
-mulhu t4 t4 s1
-mulh tp t2 s0
-sub a0 t5 s6
-or tp s6 t6
-ori a2 s1 270
-div s8 s4 s5
-srl s1 t0 t2
-mulhsu s5 t2 s0
-slti a4 a7 -1663
-slti s3 s11 603
-ori s5 a1 -1709
-sra gp a2 s3
-srai a6 s5 3
-mulh s1 t3 a0
-sub tp tp a1
-mulhsu t3 ra x0
-remu ra a3 s5
-ori x0 s6 -1517
-ori t0 t3 -68
-slli t3 s4 7
-and t3 s11 s5
-lui ra 566189
-remu s6 s10 s4
-addi t2 a4 -13
-srl a6 tp s8
-srai a3 a5 14
-addi s4 t6 1997
-srai a0 s8 1
-srai s5 t1 19
-add s9 a5 s3
-srli s7 x0 11
-sub s6 ra t1
-mulh a3 s7 a1
-srl s10 a2 ra
-sra gp t6 a0
-ori t5 x0 219
-mul t0 a5 a4
-divu s6 s11 a2
-sra s10 t4 t3
-andi s8 s7 -885
-mul t0 a0 t6
-andi t6 s9 -113
-remu a5 s9 s0
-auipc a1 633292
-mulhsu s5 x0 a1
-xor s9 s0 tp
-sll t5 s9 a1
-mulh tp x0 x0
-slt a5 a1 s6
-mulhu t6 x0 t1
-mulhu s9 tp s0
-srl t2 a4 s9
-divu a0 s1 s3
-auipc t0 15474
-divu s6 tp t3
-sll a2 s2 s9
-addi a6 a0 -1752
-and t2 s6 a0
-mul t5 s5 s11
-sll x0 s1 a7
-xor x0 ra t0
-mul t2 tp a4
-slli t5 t3 14
-sra t4 tp s1
-sra a1 s11 a7
-mulh s0 a6 s10
-mulhu s1 gp s10
-sub s0 s7 a7
-remu a4 s11 a7
-mulhu s6 t2 gp
-addi s2 s7 -1882
-sltiu t0 s3 1303
-mulh a3 s8 t3
-remu a4 s0 s3
-sra s3 x0 a4
-slli x0 a4 2
-srl tp a7 s6
-xor s2 t0 s11
-divu a5 a2 t1
-mulhu ra s10 s1
-sll s10 a1 tp
-ori s5 x0 -1321
-divu a5 t4 a1
-sll gp s6 t2
-mulh t3 t5 s7
-mulh s10 s8 s4
-and a2 ra t3
-srl t5 a0 a3
-sub t0 s2 s2
-divu a5 t2 s11
-or t5 a2 a4
-xor s7 a5 s11
-srli t2 a3 9
-mulhu t4 s1 a3
-slt x0 t6 tp
-sra tp t2 s2
-ori t0 x0 -710
-srli t1 s2 15
-ori t3 t1 -428
-srl a2 s4 a4
-auipc a0 750885
-sra t5 t5 gp
-div t4 tp a3
-sltiu a2 x0 -766
-ori t6 t6 483
-andi t5 t0 791
-lui s9 111429
-slti s0 a3 100
-slti t4 s1 -833
-sll t6 s6 s9
-slli s10 t5 23
-sra s1 a5 s3
-or s2 t0 a0
-ori t2 a5 -1373
-andi a2 s8 -9
-sll s7 a7 s3
-srai s3 t4 2
-add s10 gp t1
-sll a5 a7 a4
-add a3 a7 t5
-mulhu s5 s5 s5
-slti s2 a5 471
-divu x0 s9 s6
-ori x0 t6 -1934
-add t6 s8 t0
-sub s4 t4 s1
-xor t6 ra t4
-divu a3 s0 tp
-srai s2 tp 2
-andi s11 x0 -1365
-slti a3 s3 -818
-rem s9 s8 a4
-mulhu gp s10 s1
-sltu x0 t0 a5
-addi s9 s6 640
-slti a1 x0 -1793
-slt s0 a6 t6
-mul s3 s2 s3
-ori s11 t0 -581
-andi s10 a6 1567
-srli a1 s3 18
-xori t5 s10 -203
-xor x0 t3 s1
-sra x0 a6 t5
-mulhsu s10 a5 t1
-lui s0 972507
-xori a3 tp -2012
-addi a5 t4 1272
-slt s8 a7 s10
-xori a4 s10 -795
-remu s11 a7 s6
-mulhsu tp x0 s3
-sra t3 s11 s9
-sltiu s8 t1 -960
-lui t5 548706
-lui a1 710335
-sltu a5 s7 t0
-xor a4 s4 s4
-andi t4 gp -908
-srai s11 x0 28
-sll s0 x0 s7
-or s8 x0 s6
-mulh t1 s10 a5
-xor a6 a0 a1
-slli a2 s9 6
-sub a6 t3 a2
-or gp ra s9
-slli t2 s9 30
-srli a5 a2 25
-sltu s1 a6 s4
-sra s0 gp t1
-xori s4 s5 1839
-sub s10 a0 t1
-slt t6 a3 a7
-or t6 a4 s11
-rem s11 a4 s9
-sub s0 x0 t6
-mulhsu s6 s7 gp
-xor a1 a0 s0
-sub s3 a1 t0
-slt s10 s9 t6
-remu t1 a1 s9
-add t4 a4 a1
-slt gp s5 a0
-srai t2 x0 23
-slli s7 s0 22
-xori s4 t4 -362
-addi s6 a3 -1539
-mul a5 t3 t6
-mulhsu s6 s1 s7
-mulhsu t2 tp x0
-slli s3 a0 4
-slt s9 tp t3
-xor tp t0 t6
-auipc s4 876400
-divu t6 a3 x0
-srl s6 t5 a0
-and s11 tp s4
-andi s4 s6 1864
-slt s1 s9 s9
-sra s9 x0 t0
-srl t4 a7 a4
-lui a5 932251
-or x0 s10 s2
-slli a7 s2 11
-mulhu a7 a5 a6
-mulh s0 s8 t4
-srl s0 t3 t3
-srl s10 s9 a4
-andi ra x0 -1100
-div a5 t6 s3
-xor t1 s0 x0
-mul s3 s5 a4
-srai s4 t5 11
-lui x0 1002461
-xori a0 x0 -1206
-slli t6 t0 11
-and t3 t5 s5
-mul s4 tp t3
-slti s3 gp -1991
-sll x0 t2 x0
-mul s5 s9 a5
-sltiu x0 t6 -139
-mul tp ra x0
-srli a6 a4 11
-and x0 s7 ra
-rem t1 t2 s0
-sltu s7 s2 s4
-rem s9 tp s10
-sll a5 s9 ra
-sra ra s1 s3
-mulh a5 s9 s3
-andi t0 a4 -1253
-rem t5 a0 s9
-divu x0 a3 s5
-sltiu s4 t1 -1820
-or a2 t4 x0
-slti a6 s4 -217
-mulh s0 s5 t5
-sltu s6 ra s3
-add s0 x0 tp
-remu s4 a5 t4
-sltiu s0 s0 -119
-mulhu s2 s3 x0
-rem s4 a6 t4
-add s8 t4 t6
-xor s2 a5 s3
-sll s3 a6 s6
-ori tp s3 -1933
-mulh s8 t4 gp
-div s1 a1 s10
-mulh s3 a3 t5
-auipc t6 506372
-rem t0 t6 ra
-slti t2 s11 -682
-divu t4 a4 s1
-and x0 s10 tp
-srl t3 a3 s7
-auipc tp 13210
-remu a4 a7 s0
-or a5 s5 s4
-mul tp gp s4
-div s6 s2 t2
-mul a6 t3 s2
-divu a4 x0 a3
-and t3 s2 t6
-xori s11 a4 390
-andi a6 ra 557
-remu s5 s8 s6
-mulhsu t2 s6 a4
-ori s5 s8 -1063
-mulhu t1 a0 t6
-addi a7 x0 -1383
-sra ra a1 a5
-lui a5 304734
-sub t4 s2 s2
-sll a2 x0 s2
-srl s8 ra x0
-srli s6 s7 15
-remu s9 s2 s3
-srl s2 t3 s6
-andi s11 s5 -547
-mul s7 s9 x0
-slti t3 s6 1114
-slt gp gp a7
-remu s10 t0 t6
-rem s11 s3 a0
-mul s5 a5 a2
-addi s1 s6 -1596
-mulh t1 x0 t0
-slti s0 s5 -21
-srli t5 s4 5
-mulh s1 t6 x0
-lui a2 983722
-ori t0 a0 -176
-mul tp a0 a7
-divu t5 a3 x0
-addi s1 a4 987
-sltu t3 s6 t1
-srl s0 a7 t4
-slt gp a7 t4
-xori a0 a4 1465
-slli s11 s7 29
-xor s3 a4 tp
-lui x0 57541
-auipc s5 682547
-mul s11 s9 tp
-div s6 a2 s0
-xori t0 s2 888
-sll a5 s10 t6
-slti t0 a3 -311
-divu a2 s4 t4
-sub a6 t2 tp
-div t6 a1 a4
-andi s2 a7 -780
-srl a1 t6 a2
-sltiu a5 gp -1123
-sltu tp t1 t5
-srli s8 s9 9
-srli t3 ra 21
-slt t0 t3 t0
-mulh a1 x0 s5
-mul t4 a3 t2
-and t3 s7 s10
-mulhsu s0 a1 s8
-or s8 s3 a4
-mulhu a2 s10 a6
-mulhsu x0 a0 s2
-mulhu s2 a7 t3
-slti s10 s10 -217
-xori t3 t6 -1104
-sra ra ra s2
-slt a2 a7 s10
-sltiu s5 a7 261
-lui t6 698445
-divu a5 t1 s3
-srl s11 s5 t6
-mulhsu s1 ra t0
-ori s3 a5 -1666
-and tp t1 x0
-sra a7 a4 s7
-srl s11 t6 t2
-rem t1 a4 s1
-mul t4 s10 x0
-mul s10 t4 ra
-mul t6 s4 t4
-andi t4 s6 666
-ori s9 a7 -975
-divu ra s5 a6
-mulhu s1 a6 s0
-sub x0 t0 a0
-srli t5 s4 19
-ori a5 a6 -202
-mul a5 s0 gp
-mulhsu a2 t6 s5
-xor a2 s3 a0
+srl s3 a6 s4
+slt t2 t4 s10
+or s6 a2 t4
+mul s0 t1 a0
+slti a7 s7 -1614
+srl a0 t6 x0
+ori a3 tp -1074
+auipc s10 339464
+remu t0 s3 a0
+slli t1 tp 14
+andi s1 s0 -461
+addi a4 t0 -1982
+lui t3 819192
+sltu s0 a5 a4
+slti tp a4 432
+add ra t5 t2
+addi a4 a6 -1553
+slli s8 t1 1
+mulhu s7 t6 s2
+slti s11 s8 63
+sra t4 a4 a4
+mulhu ra a3 a5
+mulhu t1 tp gp
+sub ra s11 s10
+xor s6 t4 a2
+slli tp t5 31
+andi a4 s1 -228
+xori tp s7 -960
+or s5 tp s7
+or s3 a5 a0
+mulh a4 a7 t1
+xor t5 gp s5
+srai s2 s6 1
+slti s6 s0 1074
+lui a2 760458
+mulhsu gp t1 s6
+mul s0 a7 s6
+sltiu s8 s1 -784
+or t0 a5 a0
+srl a2 a2 s1
+mul s5 a4 t5
+remu s6 t5 s2
+divu a0 s5 a7
+addi a0 s2 -1880
+sra a0 ra t4
+mulhu s0 x0 x0
+sub gp s8 t3
+rem s2 a1 t3
+addi s2 x0 1823
+mulhsu s10 tp t5
+auipc s10 545835
+lui a7 588287
+remu t5 s7 a6
+slt s5 t4 s0
+or t3 s9 a5
+xor s9 gp s5
+sub a1 t3 gp
+sltiu a3 a5 -998
+and a2 a6 s4
+mul a1 t0 a4
+xori a7 tp 1956
+sltu a4 ra a1
+add s11 t0 x0
+slli a6 s4 6
+sltiu t6 s7 -385
+ori s11 s6 1003
+slt s1 s1 t5
+slti s4 s10 45
+xori gp t5 -2020
+or s3 s0 s9
+div ra a1 t0
+srai a2 a0 17
+slt a1 a6 a0
+xori a6 t6 1314
+slli tp s11 14
+mulhu s5 ra a7
+srl tp s1 s11
+and a3 s0 s5
+div gp s6 t2
+srl t4 s6 s9
+sra t6 tp a5
+sltu a6 s10 a6
+and s7 a1 s0
+slt t1 a5 x0
+and a5 t6 a7
+mulh a2 gp x0
+lui s6 939414
+andi t4 a3 -1807
+sltiu s11 ra 367
+andi a0 a3 1635
+rem t6 tp a2
+sltu t5 x0 s9
+xor s8 gp t1
 div a1 s9 s3
-div t3 t0 gp
-remu gp ra s0
-slti t6 a3 -674
-mulhu x0 s10 s6
-auipc t0 480123
-slli t3 a7 3
-srli t1 gp 11
-mulhsu s1 t3 t4
-add s8 t6 s11
-srai a0 s11 4
-srl a6 s8 a0
-sltiu s1 t6 423
-srai s9 a3 4
-rem tp a0 s2
-or s3 t4 t5
-srl ra t2 a4
-srai s5 a3 22
-lui a4 432731
-slli t5 a1 11
-add t1 s2 a7
-ori t2 t6 -932
-andi t1 a1 -1581
-srli t3 s0 13
-mulhu s11 s8 a2
-ori t0 tp -694
-srai t0 t3 7
-auipc a4 621463
-mul s11 t4 a1
-ori t6 x0 -1758
-div a4 s5 t1
-add tp s11 s5
-auipc t3 446087
-lui a3 549074
-xori t4 a7 -919
-xor tp t5 t1
-sltiu s8 tp -863
-mulh x0 a3 s4
-andi s5 tp 1936
-div a2 t3 x0
-lui s7 114102
-sll a2 t2 a2
-rem a0 s5 a6
-srai gp a5 23
-mulhsu ra t5 s8
-auipc a5 63846
-div s3 a0 s9
-mulhu a2 t1 s4
-srai a6 t0 15
-lui s0 259988
-auipc t5 101909
-div a6 gp a5
-xori s5 s3 -347
-mulhu s9 s2 t1
-slti s10 t4 486
-addi a3 tp -1203
-lui s4 206728
-sra t1 t4 t0
-mul t1 a5 s10
-srli t4 gp 16
-auipc x0 555323
-div s0 t5 a2
-sra a3 s1 t1
-sra a3 a7 t0
-div s10 s5 s6
-sub t0 a6 s1
-auipc t1 635822
-addi t2 t1 -521
-slt s7 a0 s8
-lui s8 316181
-sll x0 a0 s3
-srli t4 gp 2
-divu s11 t1 t2
-or a2 a3 a3
-lui a3 223087
-sra gp s5 s1
-slli t2 a2 14
-andi s1 gp 457
-ori gp a1 -64
-andi s3 s1 1432
-srai t6 t5 1
-xor t0 ra s10
-xor x0 x0 s0
-slt t3 s9 a4
-remu s9 s9 s10
-mul s0 a5 x0
-xori x0 t4 793
-or a5 s8 s11
-xori gp s6 1985
-lui s4 958801
-addi t2 s3 -1448
-srl a2 s5 s1
-lui x0 757838
-slt ra x0 t3
-mulh s8 a1 gp
-sra s9 t4 s10
-srli tp s8 0
-divu s3 a7 x0
-sra gp gp t4
-mulh t3 a6 x0
-remu t6 s4 s10
-mul s11 t6 t3
-or a4 s2 s5
-slti s4 a0 -484
-srli gp a1 24
-sll s4 x0 s3
-srl t3 s9 a5
-slli gp t3 26
-auipc s6 211778
-and a5 t3 t0
-slti s4 s9 -1970
-lui a6 630127
-or a7 a1 a2
-sll t6 x0 a1
-xori a3 s6 -1816
-add s8 s1 a3
-srli t0 t3 12
-lui t2 122333
-mul s7 t6 t3
-xori t5 a6 -771
-mul s3 a2 a6
-mulhu a3 x0 gp
-mulh x0 s9 t4
-xor s0 s9 s9
-sltu t5 a5 s7
-divu x0 a7 a5
-sltu t4 a4 a3
-sll a0 s9 a4
-srl t5 s2 s3
-slt t4 s7 a2
-sltu a4 s7 ra
-srai t1 s2 21
-auipc a5 1004275
-slti s8 s5 -395
-xori t5 a0 1569
-slti s11 gp -1712
-slt t4 s2 t3
-mulh a7 a7 a5
-sra x0 t1 gp
-sra a7 a5 a4
-remu a7 ra a7
-addi a3 a6 1225
-lui s2 122231
-mulhsu t1 s1 t3
-srli s8 t2 8
-addi s2 t0 -1420
-srai a3 a4 19
-xori s10 s6 1442
-remu t0 s8 s4
-mulhsu a5 t3 t1
-add s10 t3 t5
-slti a2 t0 -1960
-xori s3 a7 -257
-divu t6 s10 s8
-div s0 s8 s3
-mulh s9 s1 s6
-mulhu s3 a5 a0
-mulh a3 tp s2
-slti s0 a3 -1310
-and s9 a5 t0
-srl t5 s11 s3
-ori t3 t6 -208
-sll a5 s1 t6
-remu a4 a4 s4
-mulhsu s1 s9 gp
-xori s10 a5 -1743
-lui s11 671483
-remu a7 s10 a2
-sll a3 t2 t0
-mulhu s2 s1 s9
-srli s9 t5 12
-slt ra s0 s4
-mulhsu a0 t0 s9
-slli s8 s3 12
-xor a0 a3 s0
-sub ra t0 s2
-mul s8 s3 a0
-andi gp s3 -1872
-srli tp s0 1
-srl a3 a6 x0
-andi s4 x0 -889
-and a5 a6 x0
-lui t5 20136
-sub a3 a7 x0
-mulhsu tp s10 a2
-srli s4 s6 7
-slti a0 t0 -348
-mulhu t0 s8 a6
-mulhsu s1 s10 t0
-srl tp ra s0
-sub t1 a2 a3
-andi s10 s1 -481
-xor a4 a2 s11
-sltiu t4 s9 -926
-sltu t5 x0 ra
-sltiu t5 tp -1189
-div s1 t0 s6
-srl x0 t5 s6
-mulhsu t4 s8 s11
-or s3 t5 s10
-sll tp s2 t5
-and s5 x0 s1
-xori t2 s4 1221
-remu gp s10 x0
-andi a4 s4 14
-addi x0 s0 -1277
-rem s0 a2 x0
-and s8 s1 ra
-sltu t3 s4 s8
-auipc s6 435117
-auipc s8 510651
-div a6 t4 a0
-srl s1 a4 a6
-ori ra a2 -1880
-or a4 gp a3
-slti s9 a5 995
-addi t4 s8 -59
-srl t1 s1 a6
-div s5 x0 a0
-or t6 a4 t4
-ori s10 a5 -1923
-srl x0 tp a6
-slti s1 t2 1869
-lui t6 547948
-mul a3 s10 a5
-mulh s4 s7 t2
-sra s3 x0 gp
-andi s0 s6 193
-sub tp gp t3
-sltiu s0 gp -744
-sltiu s7 s11 -105
-srl a4 s5 x0
-slli ra a3 20
-slt s6 t3 x0
-andi a3 t3 -896
-srl t0 s8 s10
-addi t3 t4 744
-and s11 s7 s5
-mulh s2 a3 s6
-srl t6 s3 s0
-slli t1 a3 6
-mul t6 s11 s11
-div s8 a2 s7
-mulhu a2 s4 t3
-rem s3 s4 a6
-xori t5 s8 -113
-sltiu a7 s4 -1195
-slli s10 a2 19
-div a5 a3 t0
-addi a3 s5 -370
-addi a2 s9 -1802
-xor a1 a3 a7
-slt s4 s4 s4
-ori a7 a3 279
-slti tp s9 -1000
-ori t2 ra -1225
+xor x0 s6 s8
+mul a7 t0 t4
+andi t6 t6 -300
+srl t4 gp t0
+xori s7 a7 -1470
+srli s2 s1 26
+remu a1 t0 ra
+slt s9 s10 a2
+slti t5 t0 -894
+mul a4 t4 a0
+mulh s6 t1 s11
+auipc s7 897991
+div a0 s8 s9
+mul gp tp tp
+divu s11 s7 t1
+xor x0 s8 s1
+srai s8 a4 19
+srl s3 s8 gp
+rem x0 a7 tp
+mulhu a1 t3 a7
+mulh gp a0 s9
+rem s7 a2 tp
+lui s4 905404
+div s1 x0 s5
+sra t6 t4 t0
+sltiu x0 s5 -637
+remu t5 t3 s6
+xori s5 a1 -1142
+div t1 a2 s11
+and s6 a5 s8
+sll s4 a2 s6
+mulhu s9 s9 s8
+xori a6 s6 -1237
+divu s5 a7 s7
+div a6 t1 t0
+xor tp s6 t0
+or a7 s5 t0
+mulhsu a1 t3 s8
+xor a2 a2 a2
+slti a7 s9 -470
+divu ra t1 a4
+srl tp a6 s3
+xori a4 a6 478
+div a1 s3 s2
+sltiu t3 a3 -1018
+mulh s10 a7 t5
+sra s0 s0 t1
+and t6 a5 s6
+add s3 a7 s2
+slti s2 s6 -1348
+addi a2 gp -820
+remu a5 t2 a2
+xor t1 a7 s1
+mulh s10 a2 a1
+slli s2 a7 28
+mulhsu t5 tp t3
+sra gp x0 s2
+sll s5 t6 t5
+sra tp s5 a0
+slli a2 a0 29
+srli s9 a3 5
+srl s5 x0 t3
+sltiu a3 s9 -181
+sll a7 s11 s9
+srl a2 t2 t0
+or a5 tp a1
+xor s5 s6 a5
+remu tp t6 s9
+div a5 s8 a3
+slt s1 a7 a3
+slti s0 s0 -1164
+mul t4 ra s5
+xor s5 a5 t4
+mulhu ra s1 a5
+ori t4 a1 877
+div s8 t4 a7
+ori s10 a7 1497
+auipc t0 684151
+and s4 t2 a7
+sra a7 s10 ra
+add t1 a2 a5
+mulhsu a4 s2 a0
+rem a3 s4 a3
+sltu a3 s1 s9
+div t2 a1 t3
+add s2 t6 a3
+div s10 t0 s1
+div a5 s10 s3
+sra s6 a4 t0
+slti s8 s2 -1415
+sltiu t4 s6 -1958
+slli t1 a2 17
+srai a3 s1 0
+div x0 t5 a5
+remu s5 gp s8
+srl a2 s2 t1
+div t4 s8 t6
+or t5 a3 a6
+mulh a5 gp a6
+sltiu s7 a2 1379
+mul s3 t5 t0
+addi s2 x0 -294
+mulhsu a4 t6 ra
+and a1 s2 t4
+srli a6 s3 3
+xori a0 s7 -507
+auipc s11 837956
+add t4 t0 s2
+andi s3 t0 390
+xor t2 t5 a3
+auipc t4 994727
+add tp tp t2
+slli s10 s4 26
+srli a7 a0 3
+div s7 t5 s2
+or s9 t3 t2
+srli t6 s5 1
+sltu a5 t2 t0
+sub a2 a0 s9
+mulhu s8 s9 s11
+mulhsu a7 gp s6
+add s4 t6 t3
+srli a7 a7 20
+or s6 a3 a3
+sra s1 x0 s9
+ori a7 a2 251
+rem a1 s10 gp
+rem t5 t1 s3
+srli a4 s6 28
+sra s3 s10 x0
+mulhsu s7 t0 s5
+mul s10 s0 a2
+div s4 s10 t4
+lui t1 597740
+srli a5 a1 20
+mul t0 a6 s0
+xori s3 s11 -769
+slli s2 t4 26
+div s11 t6 s0
+mul gp t0 t6
+remu s3 s3 t0
+andi t5 s9 -662
+lui a4 296827
+srl t6 tp s11
+slli s0 t4 21
+xori a6 s0 -1825
+slt s10 a3 s2
+remu s3 s3 s10
+or a1 s1 a7
+srli a5 t6 16
+srai a7 s10 23
+sub gp a4 gp
+srli a5 s0 23
+andi a4 t1 -1187
+mul s11 a1 ra
+addi t3 gp -1423
+andi a2 t5 1505
+or s6 s4 s7
+rem s6 s2 s5
+sltiu t1 t4 -1305
+xori a3 s3 -1928
+xori t1 s7 -371
+add t5 s1 a5
+and s4 s9 ra
+add a0 a4 t1
+remu t2 s5 a0
+addi s9 a5 129
+xori s4 a4 -598
+sltu a3 s10 a1
+srli s2 gp 27
+mulhu s11 a0 t3
+srai a3 t1 29
+mulh a3 t4 a3
+mulhu t0 s6 a1
+srai s2 a5 6
+and t4 a4 s6
+andi a1 a4 -1100
+sltu t5 a1 t4
+mul t1 s9 s7
+mulhsu s4 t4 s8
+auipc a0 860598
+mulhu s3 a4 a6
+and s1 s7 t5
+mul a6 s8 a0
+divu s0 a6 t6
+mulhsu a1 s8 a5
+srl x0 t3 s8
+sub s3 ra s0
+slt s0 t3 t1
+auipc s6 145618
+add t6 t5 a6
+rem ra gp t0
+sltiu a0 a1 -1069
+remu s7 t4 a6
+rem t1 a1 s10
+xor s1 tp s7
+mulhu t6 s8 s6
+slt s8 a0 a1
+mulhsu a0 s11 s9
+srai a0 s11 19
+andi s10 s6 -1171
+and x0 a7 tp
+mulhu s8 s4 a3
+remu t6 s0 s2
+sub s4 a4 a6
+add a0 a1 x0
+mulh t4 s4 s1
+srai a3 t2 10
+andi x0 a3 259
+sltu s4 a5 gp
+sltu s7 t5 s1
+sll s8 t2 a3
+mulhu a4 s3 s4
+srl t5 s7 t6
+lui t4 209594
+sub s7 a1 tp
+remu t1 s0 t5
+andi s3 t2 1426
+and s10 a5 x0
+andi a3 x0 -1272
+mulhu s7 a1 tp
+or x0 t2 s10
+sltu a5 t1 t1
+srli t0 a7 9
+lui t2 277517
+slt s9 s2 t2
+div t3 a1 s7
+div a1 t2 s11
+srai a2 a2 20
+sll a5 t5 a4
+andi a3 s8 -818
+xor s10 ra s1
+mulh s3 s3 t2
+sltu a7 s6 t1
+sra s3 t5 t2
+addi a4 t2 895
+srli s7 a0 8
+sltu t0 s6 s3
+ori gp s10 -150
+andi s5 a1 -86
+auipc s8 761374
+srai a7 s11 20
+xori t6 s11 -1922
+sra a1 a5 a5
+add s2 ra a1
+lui a6 660901
+addi a0 s8 1772
+slli t0 a5 8
+slti s6 s7 1846
+slli t3 s6 19
+add t0 t1 t6
+slti x0 s8 -84
+slti t4 s6 1419
+andi t2 a4 -500
+srl s10 a0 t0
+sub t3 s7 s5
+ori s1 t1 181
+slt t6 t1 a6
+add s1 s8 gp
+div t2 s3 a6
+or a7 s11 s2
+add gp a7 gp
+mul x0 a7 a3
+mulh t3 s10 s7
+slli t2 s2 2
+and s8 s3 s11
+divu s11 t1 s0
+sub s6 a5 t1
+srai s3 t6 30
+slt s0 a3 a0
+and t0 a3 ra
+rem s3 a4 t0
+mulhsu s7 a1 x0
+add s10 s3 x0
+mulh ra x0 t3
+andi s10 a5 -1219
+sltiu s4 s5 720
+mulhu s8 s2 t0
+srli a5 t3 5
+auipc t0 679969
+srli s4 t1 16
+srli a2 s3 13
+srai s2 s9 16
+slli a7 t1 3
+or s7 ra x0
+slti s11 s7 -229
+ori a0 s2 -769
+rem ra t5 t1
+sub t2 a3 t5
+slt t0 gp s0
+mulhu s2 s2 s11
+slt a7 t1 s0
+sltiu a6 s5 267
+remu t5 a2 s7
+and t0 t3 s11
+sll s10 s3 s5
+mulhsu a2 t4 s2
+srl s5 s7 t0
+xor t0 a3 s6
+lui s4 22027
+add s3 t0 s9
 div t2 s10 s2
-slti s9 s7 1404
-ori s9 s5 -1825
-and ra t6 t6
-sra s4 t1 a7
-ori t5 s3 689
-lui a4 395349
-rem t5 s5 t3
-rem t0 s6 a5
-mulhu s0 a6 t0
-xor x0 s8 s2
-mul s2 a5 a3
-slt s6 s1 t6
-xori a4 tp 1003
-slti t2 t1 462
-and a6 s4 t3
-xori s10 s0 -1888
-ori s8 s11 -1238
-add t5 a7 s9
-mul t4 ra a0
-auipc s1 379338
-sub s3 s3 s3
-auipc s4 287830
-sll t1 a5 a2
-mulhsu s5 a2 a0
-xori s9 s5 324
-sra tp a6 ra
-slli a2 a1 16
-add t3 t4 a7
-mulhu t2 t4 t4
-addi s6 s2 -44
-slt t1 s9 s2
-xori a3 a1 -1855
-mulhu t0 a2 s7
-divu t4 a4 t6
-sltu s10 s10 t0
-andi s0 s7 126
-divu a5 s11 a4
-addi s1 s2 726
-and a1 a1 ra
-div s2 t6 t4
-mulh s0 a5 s0
-srl a4 s2 s0
-slt t5 ra s5
-slli a2 s10 17
-or s11 gp s0
-sub t2 t6 a0
-rem s11 ra t3
-addi x0 t4 -1893
-sra s9 gp x0
-div x0 a7 t2
-slt x0 a6 a7
-srai s10 a1 11
-xori tp t1 -1565
-srli a3 a1 23
-xori x0 s7 -232
-srl s7 t2 t1
-rem s1 s2 a1
-sll s0 s9 s9
-mulh gp s3 s3
-xori a4 a1 -1051
-xori ra a7 -1623
-xori gp a5 -236
-sltu t2 s9 t5
-addi t5 x0 -1970
-mul ra s1 t3
-ori s1 t5 1531
-lui t2 469838
-sub a3 s4 s0
-div a2 s1 x0
-slt s6 x0 s7
-xor a3 gp t6
-andi s9 a7 -1858
-mul a1 t4 s3
-and s0 s10 s9
-auipc t4 719211
-xor ra s4 t2
-sra a7 ra s6
-sltu a3 s5 s3
-srai tp s11 20
-lui t4 602710
-sll a6 x0 s3
-addi t6 s6 -865
-sll ra s4 a6
-mulhu s0 x0 a0
-slti a0 x0 -18
-srli s2 t4 19
-srai a6 t4 5
-sltu s0 s4 x0
-slt s0 t1 s5
-or s7 s8 s11
-lui s5 218963
-mulh s3 t1 x0
-xor x0 t4 a5
-andi s11 gp 1736
-xor a4 t5 x0
-mul a5 a5 t4
-or a5 s11 x0
-sltiu s9 t0 -1499
-auipc t3 323487
-slt a5 s11 s10
-mulhsu t4 a6 t2
-auipc s1 601940
-slti s5 t4 -382
-sub s0 tp s3
-xori a7 s11 -82
-slt t1 t4 s11
-sltiu s8 a2 -1411
-sll s7 a2 t0
-slt s3 s6 a5
-or a2 x0 s1
-slt s9 s8 s6
-srli a4 t6 3
-slli s10 x0 24
-sra a1 x0 t2
-srai a0 ra 31
-add s7 s0 a1
-slti s4 s7 687
-ori tp s4 -1868
-andi s6 a0 -1327
-sra a0 t2 a0
-slli t0 s9 29
-ori t0 a1 -1197
-ori x0 a6 -141
-lui t2 238731
-rem t6 t5 t2
-remu s11 t5 a6
-sra s8 t3 t3
-mulhu t3 a7 s2
-xori s0 s1 -1061
-add x0 s1 s10
-ori t5 s5 -1313
-ori s7 s5 -1693
-slli t1 a5 20
-or t5 t6 s2
-divu a0 s10 t4
-div ra s9 a0
-srli t3 a3 26
-divu t5 x0 a3
-and t1 a3 t1
-andi t0 s10 -1038
-divu s4 t5 s8
-mul a1 x0 t6
-sra t3 s0 t6
-or a3 a6 a4
-andi s9 t2 -154
-addi ra s2 -1827
-slli a7 t2 31
-rem a2 t5 s2
-lui s0 482443
-div ra a7 s7
-and s5 s6 a5
-addi ra a6 -1250
-or s8 a4 s2
-divu a3 s8 a5
-sra s9 a0 gp
-sltiu a5 s8 -1888
-slti a4 x0 -784
-remu s6 s6 a3
-sltiu a2 s1 1167
-lui s5 604089
-sltu s2 a1 s0
-sltiu a5 s6 -666
-add gp a6 t6
-or a2 t1 s11
-addi a0 a7 -1784
-xori x0 s1 -1916
-xori s7 s1 1381
-divu t5 s11 a3
-mul gp t1 t4
-slti t6 a4 999
-lui s9 236509
-ori t4 s8 -1172
-slli t0 s9 20
-xori x0 s11 -1769
-auipc s5 48898
-ori a3 s9 -1721
-or t1 a4 s10
-sltiu a2 t1 -138
-div s3 ra a1
-slli a5 s9 6
-mulh s1 s10 s7
-srai tp a6 31
-xor t1 a7 s2
-mulhu s0 tp s9
-auipc a7 510285
-srl ra gp s7
-sll s3 s8 a3
-or s9 a5 a4
-divu s1 a0 a3
-srli tp s3 0
-slli a5 s10 18
-sll ra s9 t3
-divu a4 s11 t5
-srai s6 a2 29
-sub s3 t4 gp
-remu x0 tp tp
-mulhu s1 a0 t6
-rem s8 s8 a1
-remu t3 s10 t4
-div s5 a3 s6
-lui a7 926023
-sltiu a4 a4 -641
-srai gp ra 12
-andi s9 s7 -362
-sub s5 t5 s1
-srl tp x0 s6
-sll a2 x0 a7
-srli ra a0 28
-and t4 t6 t6
-mul a4 t0 a0
-mul t6 s5 t4
-ori t6 t2 -1077
-sltu x0 a4 a0
-sub t3 s5 t0
-or a6 t4 a7
-sltu s5 t4 s0
-remu a1 t3 s8
-auipc s6 43047
-or ra a2 s11
-addi s9 t3 -1972
-add x0 s8 s6
-div s10 s3 s6
-andi s3 t6 -48
-xori t3 s1 -601
-mulhu t6 s0 a0
-remu t2 s3 s1
-divu s2 a4 s8
-auipc s4 275360
-auipc t2 993714
-and a2 s2 a1
-divu a4 gp t2
-xor s4 x0 s7
-sll x0 s1 s6
-sll t2 x0 a3
-slt t5 tp a4
-slt s7 x0 s11
-srai a1 s11 17
-slti s6 gp -1144
-add s6 x0 s11
-sra a4 t2 t3
-srai tp s10 26
-mulh s5 t5 a2
-srli t6 t2 17
-lui a3 628528
-divu t2 t3 s7
-divu t0 t4 a3
-sub s9 s8 s0
-ori t6 s5 1159
-srli a5 gp 30
-sll ra a4 ra
-sub s4 t1 t2
-divu gp ra s11
-rem t3 a5 a3
-slt s1 ra t2
-slli s0 a2 3
-slti s3 t5 -1983
-andi a3 t6 -2045
-remu s8 s11 x0
-sub s11 t3 a2
-addi s9 s7 776
-sltu a0 a1 t3
-srl a5 s3 a3
-add a4 a5 t0
-andi a3 t4 -595
-srli t4 tp 13
-slti a7 s3 -955
-srl s10 a3 s8
-sltu tp gp x0
-srai t5 t3 25
-sltu t3 x0 a0
-auipc s3 1045742
-mulh a4 ra a4
-and a5 s11 s4
-or tp t2 gp
-lui ra 754069
-andi a6 s9 -1126
-remu t0 s0 a0
-sll ra s1 a3
-andi t2 s1 -454
-rem s11 a5 s4
-ori t0 s5 1354
-mulh t6 gp s6
-sltiu s9 a4 1420
-divu t4 s9 tp
-divu s0 t1 tp
-slli s10 s11 13
-xor tp t1 t6
-xor t1 t1 x0
-divu a5 s3 t4
-or a4 x0 a7
-divu s1 s3 gp
-mulh x0 s4 s10
-and a2 s7 t3
-mulh s1 t3 a6
-srai a3 t5 6
-and a1 a2 x0
-mulhsu s2 t1 s0
-slli tp t5 17
-ori a3 s6 -308
-srli x0 a7 14
-divu a5 t3 a0
-srli tp ra 16
-sll s0 ra s8
-divu t1 ra a1
-remu a3 a1 s9
-sltu s0 t4 t0
-srl a6 s10 s4
-slti x0 s5 -852
-xori s11 a6 -1523
-mulh a3 s7 a5
-divu s5 a7 x0
-slt s11 s1 s6
-lui ra 549891
-and a4 a2 s3
-mulhsu s10 s5 s2
-slti t5 gp 542
-auipc ra 906245
-slli a5 a2 17
-remu t6 ra x0
-ori s6 s2 -567
-slti s0 x0 581
-sltu s11 x0 s9
-mulh s4 gp t4
-mul t0 a7 s0
-andi a4 s0 395
-sltiu s4 a7 -1993
-lui s6 933807
-xori tp a6 -1880
-srli a1 s4 30
-sra a1 ra s8
-slli a1 s7 8
-sra s5 t1 a2
-or s11 t1 a6
-mul s0 a5 t2
-sltu s5 s1 t1
-srl t3 x0 s8
-srai t4 s7 4
-mul s7 x0 s7
-rem x0 s5 a1
-divu t5 t1 s3
-div a5 a6 s7
-mulhu s10 a3 x0
-srli s3 a7 23
-ori s8 s4 1884
-mulhu t0 t6 tp
-xor a7 a2 ra
-sltu t6 a5 s8
-slt tp x0 s1
-slli a6 gp 1
-sra x0 s1 a6
-addi s4 t0 -351
-sltu s4 s11 s2
-remu tp a3 s0
-slli t0 t1 15
-slt s6 s2 a7
-mulhsu t3 a7 x0
-xori a4 x0 1192
-ori t4 s4 1946
-mul s4 t6 a6
-or tp s2 s6
-srl a5 x0 s2
-slli x0 a0 27
-sltu s10 a2 a0
-and tp t5 s2
-or a7 a6 a1
-addi s5 t0 1678
-remu s11 t2 a3
-lui t4 78774
-sra s11 a4 x0
-sra s3 a5 t3
-slti a1 t5 -1154
-sll t4 a1 a6
-xori a4 s2 780
-sra tp t1 gp
-slti s2 t6 -1251
-mulhsu x0 s0 x0
-srl s7 a6 t2
-or s6 s11 s10
-xori s3 s0 -763
-and t6 s10 a3
-lui a1 525242
-srl a6 ra a7
-slli s10 a4 15
-srai a5 t6 10
-sub s2 t6 gp
-sra gp a3 s8
-mulh s10 s4 t3
-srai x0 a3 13
-mulhu a0 x0 a5
-sltiu gp ra 1388
-sra t1 s7 t1
-srl s0 t3 s3
-mul t1 ra s1
-mulh t4 a6 t1
-sltu s4 t5 a6
-addi s10 tp -1455
-srli a7 x0 15
-lui t6 16552
-xori t6 s4 -1108
-srli x0 ra 1
-slli a5 ra 17
-slt t1 t4 t0
-sltiu t2 a6 1238
-auipc a1 458460
-divu t3 s11 t6
-sltu s2 a2 s10
-mulhsu a0 gp gp
-div t6 t4 t5
-auipc s6 674469
-slti t5 s10 -1562
-divu t2 x0 t5
-lui a3 169539
-srli x0 a7 8
-or a4 s8 a0
-remu s0 t0 a1
-divu a2 s7 s1
-auipc t0 503071
-auipc s9 421315
-remu s1 t6 a4
-auipc t0 290721
-slti a4 t3 -217
-or a3 a6 a1
-sltiu x0 tp 1372
-sltu a5 t0 s7
-sltiu s7 a0 -1513
-xori s6 a1 510
-rem s11 s5 a6
-remu ra t3 s1
-auipc t5 907887
-slt a7 x0 s5
-slli s10 a0 26
-mul s11 a2 t2
-srai s6 x0 30
-remu a2 s3 t1
-mulh t0 s0 a5
-srai a2 x0 20
-rem ra s9 s7
-xori t3 gp -1496
-srli s6 a7 12
-slt x0 s0 a4
-rem s7 t0 x0
-andi t1 s1 564
-mulhu x0 t0 a1
-slt x0 s7 s3
-srl s7 t0 s5
-mul s8 t5 gp
-and s6 ra a7
-div s9 a0 s5
-mulh t6 s0 s3
-mul t1 s10 t4
-divu a7 s4 s8
-ori t6 t1 640
-sll s6 s8 t6
-ori t2 s8 -1750
-xori a3 a7 898
-lui s11 763569
-sll gp x0 s4
-rem s11 t6 s3
-divu a3 gp s6
-rem s11 s2 a1
-sltu a3 s8 t0
-sub s11 s11 s3
-xori a1 s3 -423
-sll t6 a4 a1
-add a7 gp s9
-add a3 a2 a5
-mulh s3 t2 s8
-lui s10 513294
-remu t6 a6 t2
-slt s8 t2 a7
-srl a4 x0 s5
-sltiu s11 s2 -1156
-remu t6 tp t0
-or a2 s3 a0
-andi s11 s2 -1919
-remu x0 a5 s3
-sltiu s5 s9 1807
-add t2 a4 t4
-and t3 s6 t4
-sll a6 a7 t0
-div a0 a6 s3
-slt s6 s9 s8
-lui s9 853913
-div a2 t4 a4
-srli s4 s4 6
-auipc s9 472111
-add t5 tp s2
-add s0 t4 x0
-and a3 s3 x0
-addi s0 t3 -1037
-remu s11 gp s9
-remu a3 t5 s7
-sub t0 t6 s8
-and s3 ra s2
-and a4 t2 a1
-mulhu a5 a5 a5
-add x0 s3 s2
-mul t2 s4 a3
-and t6 s6 s7
-mulhu a4 s2 s6
-ori a4 a1 814
-div gp s2 a7
-slti t6 x0 -669
-addi gp t2 -1669
-xori x0 a4 -391
-srai a0 t2 12
-andi x0 t1 -1385
-add s10 ra t2
-and tp a7 s10
-slli t6 t2 7
-mulhu a6 s0 s7
-slt s7 s10 a5
-mul t3 x0 s8
-and a0 s6 s2
-sra a0 a2 s7
-mulh s5 t4 t2
-srli x0 s5 27
-slti s9 a7 -551
-or s9 s5 s4
-slti s6 a6 -1545
-slt x0 ra t1
-divu x0 s8 s5
-add gp a5 a7
-rem ra s8 s3
-sub t0 x0 t0
-slti x0 s10 -503
-add t0 t0 s11
-sltu s8 s10 s6
-sub a5 ra a4
-sltiu a2 gp -382
-andi t1 t2 -68
-auipc x0 574225
-xori t0 t0 -1537
-slli s7 s0 0
-slt a3 s3 t2
-sltu gp x0 s3
-sltu a0 s4 t2
-rem s9 a3 s2
-lui a0 375851
-div a0 t3 x0
-ori t6 s3 -337
-addi tp a4 273
-srl s8 x0 a7
-and a1 t5 s0
-or a2 t3 t2
-remu gp t1 gp
-lui s3 286652
-addi s4 a4 -217
-mul t4 a3 a7
-ori a6 t5 1385
-or a4 t2 x0
-mulhsu t6 s0 a1
-addi s10 x0 -508
-sub t1 x0 x0
-sra t0 t2 a7
-sltiu x0 a5 -1310
-rem s8 t3 a4
-srl s6 s1 tp
-auipc ra 11519
-div s3 s6 t6
-and a2 t4 t1
-sltiu a0 s1 1160
-xor t5 s5 s9
-ori s6 s8 -882
-sub a6 t1 s10
-xori s3 s8 -440
-divu s0 s2 s10
-srli t3 t3 17
-mulh s4 s9 ra
-sltu gp s2 a6
-div a7 a3 s11
-lui t3 267004
-xori ra s0 1887
-add s0 s11 x0
-ori t2 s3 -630
-slli a4 t5 18
-slti a7 s10 1028
-sltu gp a5 t4
-slli s9 s3 13
-or a0 x0 a2
-auipc x0 720559
-mulhsu t3 s9 x0
-sll s5 a4 t3
-addi s2 a6 -1011
-mul t5 s11 s3
-xori t3 a7 1041
-slt s11 gp s2
-xori s0 s1 -807
-xori a6 s6 -688
-div a1 s9 s2
-addi s4 ra -1632
-slti s6 a6 -1515
-srli t1 a7 21
-addi s7 s5 1784
-rem s4 a0 s5
-andi s5 gp -1531
-auipc a1 368634
-slt a5 a0 t3
-divu a4 a3 gp
-slli a6 s5 10
-slti s3 s11 -85
-auipc a5 431542
-sub x0 ra s11
-sub t1 t4 a6
-add x0 s2 a7
-srl tp s9 s1
-xori a2 ra 230
-sltiu t3 a1 1825
-sltiu a1 s11 1885
-slt a5 s1 t4
-mulh s9 t1 x0
-or s4 a1 x0
-slt tp a3 s11
-sll a0 a5 t0
-remu t5 s6 s4
-divu t4 tp s1
-add t0 t1 a6
-sltu a4 gp ra
-srai s1 t1 11
-sltu s11 s2 ra
-ori tp s9 -1832
-andi s5 x0 229
-sll s7 s4 a6
-rem a7 s6 a3
-divu s7 t5 t1
-mulh t3 s6 a3
-divu t5 a2 a2
-div s9 t6 a6
-slli t0 s11 28
-lui ra 791385
-slli s1 t0 18
-sltiu t0 t4 766
-rem a3 s10 t6
-lui s5 80973
-srl s3 t2 s7
-div t0 tp s1
-or s4 s11 tp
-lui t4 832718
-addi t0 a0 -1080
-slli s11 a2 29
-slt t0 s6 a7
-or s0 gp tp
-mulhu t4 s7 ra
-andi tp s1 -553
-slt s2 ra s10
-sll s7 a2 gp
-slti x0 t6 1315
-rem a2 ra gp
-rem s2 s5 a3
-xori s8 a3 -568
-srl t5 s1 a0
-sll a5 t2 tp
-divu x0 t4 a1
-andi a4 s1 -1316
-remu s4 a4 tp
-sltu tp t0 t3
-or x0 s11 t1
-lui s8 792861
-mulhsu s8 a2 s4
-divu s10 s0 t1
-xori s7 a7 805
-rem s3 tp s3
-mulhu t0 a5 s9
-andi tp a0 -947
-rem s4 s6 s4
-add t2 ra x0
-slli gp a5 18
-sra s2 gp a1
-sltu t3 s7 s6
-sub a1 a5 gp
-mulh t3 s8 s6
-slt a5 t5 s0
-mul a2 a6 t6
-mulhsu x0 t0 t2
-slli s1 s5 7
-addi x0 s6 -310
-slli t4 s8 28
-divu s5 t5 a3
-mulh s1 ra gp
-div ra a4 x0
-sll s11 tp a5
-rem t3 t2 ra
-mulh s6 a7 t4
-rem a4 t6 s5
-andi s2 a3 -1600
-srai a0 a1 20
-sra a3 a3 t3
-slli s6 t1 2
-sll t2 a7 ra
-slt s5 s4 s11
-srl tp s11 t4
-add s11 s9 s4
-slt s0 s11 t6
-ori t0 x0 878
-xor s4 t0 t6
-srai t4 t3 2
-remu s10 x0 s11
-mul ra t1 gp
-sub t5 s4 t4
-xor gp t0 s1
-slli a6 s10 18
-div s11 gp s6
-slli s1 s10 20
-sltu s6 a4 t5
-or a1 a7 a7
-lui s11 130909
-mulhu s8 s7 a2
-xor a6 s2 t4
-sub a7 t5 s6
-sub s3 s9 gp
-mulhsu s9 x0 s11
-mulhsu s7 tp s7
-slti a1 s1 -79
-lui s0 350067
-lui t3 699805
-xor t6 t5 t5
-slti x0 t1 -428
-auipc a1 56338
-sltiu s8 s10 1291
-srai x0 s7 27
-mulhu t6 a2 a3
-sltu x0 s11 x0
-andi tp a3 1843
-mulhsu s10 s10 s11
-or s7 tp a3
-slt a0 s5 a2
-sub t5 s1 a5
-rem s3 a7 ra
-sll a6 a0 s9
-sltu a3 t6 t6
-ori a3 a5 -561
-mul s3 a7 a4
-sltiu t2 s2 1447
-auipc a0 288231
-srai s4 t5 31
-ori a6 s6 -1148
-mulhsu a0 x0 a5
-auipc ra 52822
-mulhsu a0 t3 ra
-divu t2 a4 s8
-mul s2 s2 t1
-and t1 s10 x0
-mulh a4 t5 s11
-andi a3 a1 1680
-or t3 gp t2
-div a4 s9 t5
-slti x0 a1 -1609
-slti s10 s6 -1552
-slt s8 t2 s8
-addi s11 t5 1131
-add s5 t2 t1
-sra s4 a3 x0
-rem t3 t5 s6
-remu s9 s9 t0
-and s5 s10 s5
-remu a4 s3 s7
-rem a0 t5 s6
-mul a7 s6 s7
-addi a4 t5 -282
-lui s10 173871
-sltu t3 t5 tp
-xori s5 t2 -940
-srli tp t0 30
-divu x0 a6 t4
-rem a3 a6 t5
-sra x0 t5 a2
-andi a0 s7 -1970
-sub s5 tp a1
-mul t1 t3 t3
-addi tp a6 -1589
-or a7 tp s9
-srli s8 s1 6
-mulhu tp t0 s10
-sub a7 t6 a2
-and a3 s9 s11
-mulh a2 a3 gp
-srli x0 a1 4
-slti t2 s11 -717
-or gp s8 s10
-lui t1 251174
-slti x0 a4 747
-xori s1 s4 552
-srai gp a3 25
-addi s0 a1 -1438
-srl t3 x0 t3
-mulh s4 s3 t6
-lui a1 756568
-mulhu t1 tp x0
-mulhsu s7 s9 s3
-addi s11 t0 -233
-sra x0 t5 tp
-slti a2 s6 -1742
-andi a7 a1 -2031
-rem t1 t3 a1
-mulhsu x0 s4 s9
-div t0 a1 a5
-addi t4 s6 1513
-addi t3 x0 -1474
-xor s5 s1 a0
-lui a1 264111
-slli t3 s1 1
-srli a5 a5 7
-xor s10 a0 s4
-div s1 s6 ra
-xori t0 tp -1068
-xori t1 a1 1097
-srai x0 a7 19
-slli s4 ra 18
-addi s3 s1 -203
-slli x0 x0 10
-and tp s1 s0
-rem ra t2 s4
-srl a5 s11 s3
-div a3 a2 s3
-divu s3 tp tp
-auipc s1 235853
-ori a6 t4 1328
-sub s5 s2 a6
-srli s3 a1 5
-mul t3 s3 ra
-mulhu s5 s5 a2
-lui t5 323896
-srli a3 t4 31
-rem a0 a5 s4
-sra s7 a2 t2
-remu a0 s4 x0
-sltu s0 a1 s9
-srli t0 a1 30
-sub s5 s9 t0
-slli t0 a3 4
-xori a6 t6 -1729
-mulhsu s3 s6 a5
-ori s4 s4 -1657
-sltiu a0 a4 1234
-lui s11 1035766
-srai t0 s9 26
-srl ra a0 t1
-sub s1 t3 a5
-ori s5 x0 1958
-add s4 a5 s11
-slti s2 t2 -1656
-remu s4 s9 s5
-srli t3 s2 17
-mulhu a2 s9 s4
-rem x0 a6 gp
-xor a3 s7 x0
-rem a6 s4 t3
-and a5 a6 s5
-slli a5 a1 29
-xori gp s5 -2007
-slli x0 s9 6
-or s11 t3 s3
-slt s11 s5 ra
-ori t5 s7 -1236
-srli s4 s4 24
-slli s9 x0 28
-xori t5 gp 244
-sll a3 s11 t1
-div s6 a5 ra
-divu t1 x0 s1
-and s4 s9 s0
-rem a6 t5 t1
-rem s0 a0 s5
-slt a7 s2 s1
-addi tp s2 33
-add t0 a5 a0
-sra s6 s2 gp
-slti t2 s5 1838
-mulhu t6 s10 a1
-slli s11 t3 8
-slli tp t2 1
-or a1 a3 x0
-and gp s2 a3
-sltu s9 a0 gp
-remu s5 s8 x0
-andi x0 t0 1550
-xori s2 s11 424
-slli s3 tp 23
-sltu x0 t6 s4
-ori s0 a4 -1661
-auipc a4 33099
-div s5 a3 s5
-lui s6 477257
-slt s8 a1 s1
-xori s1 t2 -1237
-or t3 a1 a3
-divu s4 a3 a4
-sra s0 s8 t0
-lui t2 914056
-mulhsu x0 s0 s5
-mulhsu a3 gp a5
-xor s9 s9 x0
-or s3 x0 a5
-and s8 gp s7
-mulhu s11 s1 a7
-srli s0 x0 17
-addi a6 s10 -1679
-auipc s1 663956
-xor gp a7 a0
-sll a4 s1 a7
-sra ra t3 t4
-or gp t2 a5
-mulh s6 s5 s3
-srl a2 a2 s5
-div s8 s7 s7
-sltu x0 x0 a1
-mul s7 s2 t4
-sll a3 ra t5
-remu a5 a5 s3
-div s5 s3 a1
-slli s7 t1 23
-divu ra t0 s9
-rem x0 t2 a7
-slli a4 t0 26
-add gp t6 t6
-slti gp s9 1897
-srai s10 s5 30
-mulhu t6 s8 a1
-mulhu t6 t2 s10
-add a1 gp a2
-sltu s9 a0 t0
-mulhu t4 s11 t1
-slt s1 s11 s8
-ori s1 s11 1219
-mulh a4 gp t2
-sub t1 tp s10
-andi t6 a3 -475
-sub t0 s9 t4
-slti ra t4 504
-sra s4 s0 t6
-add x0 s9 s0
-sub x0 t5 s7
-srl x0 t0 x0
-slli a0 a5 1
-mul a4 t1 t0
-xori ra x0 148
-xor t1 a5 x0
-sltu s1 a0 t1
-mul s3 s1 ra
-xori t0 t3 460
-remu t1 s9 gp
-or t5 t0 a5
-slt s1 t6 s11
-sltu s4 s3 tp
-div ra s3 a2
-addi s9 t6 -522
-xori gp a4 -918
-andi a5 a5 -1500
-add s8 a5 s0
-add s7 t1 s6
-sll s5 s1 s7
-srl t6 t0 s0
-remu t5 x0 a1
-slt s2 s2 t3
-srai a3 t1 24
-xor s3 ra a3
-ori t5 a4 -1194
-remu ra x0 t1
-srl a7 a3 s6
-and t6 t4 t5
-ori s11 s3 -1712
-slt a5 s7 a2
-ori x0 gp -862
-or s9 s7 t6
-srai s4 s5 1
-mul a6 a1 x0
-srl ra s6 s4
-ori t6 s5 739
-remu a1 s9 s3
-srl a4 t3 a5
-sltu a2 s10 s7
-remu a1 x0 s2
-sub t0 t1 gp
-andi s10 s10 2032
-sltiu a0 a5 -216
-slti a2 a6 -1348
-rem s6 t4 a7
-and t6 s10 s0
-and s3 a4 s10
-or tp s5 s8
-mulhu s10 a0 s8
-xor s11 t3 t3
-sltu a3 s9 s10
-srai t5 x0 29
-mulhsu ra s5 t3
-srl x0 a6 t3
-srli t4 a3 23
-add a6 a2 a3
-sll s11 t2 x0
-ori s8 s0 -1240
-remu t4 s6 s1
-div s3 s8 s10
-div x0 s1 s6
-xor s5 t2 a1
-add s2 t5 s4
-srl s3 s5 s4
-xori s7 s4 -953
-slt s3 ra t3
-lui s4 207567
-sltu s6 a2 t6
-add t0 s11 x0
-xor t0 s6 a7
-divu t4 ra s5
-ori t3 a4 -428
-slt a3 a7 s3
-xori s3 t1 330
-slli s6 a6 23
-auipc s11 661278
-rem x0 a4 tp
-sll a5 t6 s8
-and s8 a0 s0
-srl a2 a6 a0
-sltiu s6 a2 -1184
-andi ra a5 990
-divu a1 a3 s2
-slli a6 s3 1
-mul a0 s10 s6
-slt s4 t3 s7
-div a2 s0 t5
-xori s11 s11 601
-sra t1 s10 s5
-lui s1 827868
-andi s9 s10 836
-mulh ra s10 t1
-auipc gp 1033867
-slli x0 a3 12
-xori t4 a7 179
-mul s7 t5 gp
-rem a5 t2 a7
-rem x0 t3 s9
-xor a6 s1 gp
-div t4 s4 s4
-remu s11 s1 s8
-sra s6 s2 a5
-xor s0 s8 t6
-add s3 t3 s1
-sub x0 s10 t0
-mul gp s10 s2
-slli a3 s5 13
-srl a0 ra a2
-mulhu t5 gp s1
-sub t1 s10 tp
-sltu t3 a7 s6
-remu gp s4 t2
-andi s8 t0 -244
-remu a0 t5 t6
-ori s6 a6 -89
-or s9 s6 s4
-sll s6 a7 tp
-srai a6 a5 17
-sltiu a0 x0 1263
-sltiu s6 t1 -508
-divu s10 s1 s1
-lui ra 889214
-sll t0 a7 t1
-slti gp s3 -499
-and s7 s5 a6
-sll a6 t0 s4
-mulh a7 t4 s0
-sra t6 s5 a3
-srli s10 s1 11
-lui a7 560662
-sub gp s6 t2
-mulhu s10 a5 s10
-addi t4 s7 -1545
-mulhu x0 a1 s3
-andi s3 gp -1343
-mulhsu a0 a1 s6
-mulh s4 a1 s1
-slt s0 t5 a2
-slt a1 t5 x0
-auipc gp 569554
-ori gp s3 1507
-mulhu ra s7 a7
-remu tp x0 s5
-rem s11 a6 t4
-slli s5 t0 4
-slli a2 a4 28
-mul a4 a7 tp
-xori s4 t2 374
-mulhu t0 t4 s6
-srl t1 a3 s1
-rem s5 x0 s9
-xori a6 s1 -1253
-slti t5 s6 1923
-sra s1 s11 a5
-sub s1 s0 s6
-slt a3 t4 gp
-mul s3 tp a5
-mulhsu tp s5 ra
-add a2 a4 x0
-rem a0 s11 s7
-or a5 t3 s7
-srai s11 a1 31
-sra s2 a7 s3
-xor s11 s10 t0
-xor a3 gp s3
-slt s10 s11 ra
-divu s11 a6 s8
-srl s11 t1 a2
-andi s6 t5 -736
-rem s9 s11 a7
-slli t6 gp 12
-and a1 t2 s7
-sra a4 s7 a3
-div t1 s9 s7
-slli s8 t3 10
-srl a7 s11 s5
-andi a2 s6 505
-addi s0 t0 1549
-rem s10 a7 s2
-srai t0 t0 18
-ori s5 s8 -1447
-auipc s7 357262
-sra s10 s1 a1
-lui a4 399021
-mulh a4 s5 a5
-slt s7 a5 ra
-divu s10 ra a0
-srli t2 a4 4
-sub s10 a7 a7
-sra a2 t0 t3
-mulhu s5 gp s9
-div a0 a2 a3
-sll s6 t2 a2
-lui s5 205574
-remu s8 tp a3
-mulhsu s11 a2 a7
-andi x0 t1 -1847
-sltu tp t0 s9
-slt s1 s7 s1
-srli a7 ra 3
-sub s0 s0 t1
-mulhu ra a4 s8
-rem s11 s6 a1
-srl a1 a6 s1
-divu a5 gp a4
-div ra s2 s5
-xori t3 s11 360
-div x0 s3 t4
-slti s5 s2 -1256
-srli a6 a5 15
-sltu a6 a2 s7
-sra x0 s9 gp
-or a0 s8 t2
-auipc a7 261265
-andi s8 s4 -1686
-add x0 t1 ra
-slli a5 a4 23
-addi s2 s5 -1264
-or a7 s4 s2
-srl t2 a4 a3
-xori a1 t1 -254
-mul t6 tp a5
-sltu t6 x0 a3
-sll t3 t5 a6
-slli x0 a4 7
-auipc s6 168517
-sra s1 a6 s10
-slli s2 s2 9
-slli t1 a6 27
-xor s3 s1 x0
-lui s5 999661
-and a1 ra t2
-slli s7 a6 22
-srl a3 tp s2
-slti t1 x0 -802
-and x0 a6 s1
-rem x0 gp a7
-ori a1 x0 -84
-srli s8 ra 1
-and s5 s9 s6
-srai s11 x0 2
-sub s8 t1 t3
-srl a2 x0 a5
-mulhsu t3 s8 a0
-xori t4 t4 1417
-auipc a5 763308
-sltiu ra a1 -1488
-auipc s4 374035
-xori s5 x0 -295
-andi a7 s8 875
-sll s3 s7 s9
-addi t1 s0 -526
-srai s0 s1 20
-slti s3 a4 -657
-sra t6 s2 a3
-rem x0 gp s3
-slt a4 t3 s6
-mul s9 t6 a4
-or a6 s7 s10
-sra a0 s9 s1
-or x0 t6 t1
-sltiu t1 a6 468
-slli s6 ra 18
-and a6 a2 s11
-sll s6 t2 tp
-addi s10 a4 896
-xor s6 s11 s1
-slti a2 s6 -514
-srl a3 ra t4
-ori t3 gp -89
-srl a3 s11 t5
-sltiu s10 s8 -898
-mulhsu s10 a3 a0
-mulh s11 s6 x0
-sltiu t3 s6 230
-lui a1 493185
-sltiu s6 a0 1721
-rem s7 s6 ra
-divu a7 ra s5
-remu t3 t0 s4
-remu a4 gp a2
-xori a6 a5 2009
-andi s4 gp -1135
-andi t3 gp -854
-mulhsu a4 a3 t6
-srai t5 tp 20
-sub t5 a2 s8
-sltiu a1 s2 -248
-slli s9 gp 4
-sltu a2 a7 t4
-xor a5 a7 a7
-srai t0 t1 7
-divu gp t6 a2
-sll tp tp a1
-div a0 t0 a3
-srai s1 tp 19
-mulh a2 t0 s3
-slti ra x0 113
-slli s8 s4 2
-srli s2 t2 0
-remu a4 s7 t3
-mulh s3 s5 x0
-sub a7 t0 a6
-mulhsu t6 a7 s5
-auipc s0 1005646
-sltu s2 a4 s1
-slli s2 ra 11
-srli s5 x0 1
-sll a5 gp s2
-sltu tp s1 t5
-srli t4 s10 0
-addi ra s4 -779
-srai a5 s2 22
-div gp a1 a1
-addi a0 s10 -1846
-sltiu s11 a2 -1671
-mulhu s4 s9 tp
-sra a3 s11 a4
-slti s0 s1 -176
-add a2 s4 x0
-xori t0 a5 -702
-auipc s9 673613
-andi s3 s5 -1253
-andi s1 t2 -1722
-or a5 ra s2
-div a1 a1 a2
-rem ra s10 s1
-mulhsu t4 t2 a4
-srai x0 a2 12
-divu t4 a0 t4
-srli s7 t1 28
-add x0 a1 s2
-addi s7 x0 98
-mulh t4 s11 s10
-slt s6 s9 s1
-sll x0 a5 gp
-or s8 s0 a5
-lui t4 149888
-sltu t2 tp t6
-xori a1 a7 -909
-addi t0 s6 618
-slli a5 x0 23
-add s6 a4 t0
-rem t5 t4 x0
-mulhu a6 s5 a1
-or s10 s6 a0
-slt s4 s6 x0
-div gp t2 t1
-lui t2 865559
-slti s9 s11 -427
-srl x0 a3 a4
-xor s11 s8 x0
-and s9 s1 x0
-xori s4 a0 -476
-mul a7 s7 a1
-auipc a4 1037619
-and t2 x0 s9
-and s10 tp a0
-slt a0 t0 s9
-andi t2 a6 -1602
-mulhsu s4 a4 a5
-add t2 t5 s2
-and a7 tp s10
-sll a5 t4 a5
-rem t0 s10 a0
-sltiu a1 t4 559
-srli s9 a7 19
-mul s6 s4 s2
-add s11 s4 x0
-addi a0 a2 662
-xor t1 a1 x0
-sltiu s0 s4 190
-slli s1 a5 31
-lui s1 268566
-mulhu s4 s9 s8
-divu t1 t4 t1
-sltiu s1 s9 -1535
-mul tp a3 a3
-rem t5 x0 t0
-xor s2 x0 s10
-slt t3 t1 s6
-remu a6 s11 t2
-auipc t1 390499
-sll s0 s8 t6
-srl s7 a1 x0
-mul x0 ra s10
-andi tp a7 -720
-mulhsu a2 a3 s8
-mulhsu t3 a7 t2
-div t4 a4 a2
-slli t4 a0 26
-lui s7 307475
-div x0 a5 t6
-slti s5 t2 1144
-slti s1 s9 1242
-or t6 a1 t5
-lui a4 926299
-mul s3 s0 s7
-slli a3 a6 15
-div gp gp a3
-sltiu a1 a7 -1152
-mul s7 a2 s8
-mul s5 ra t5
-andi s6 t4 1086
-slti s11 a2 1735
-xor t6 s0 a1
-sltu x0 s1 s4
-div a2 gp t3
-sll s6 s0 s7
-srl t1 a5 s11
-sltu a0 ra a2
-sub s9 tp t5
-slt s7 a2 s6
-xori t2 t4 -1870
-slt t2 s3 t6
-addi s0 s2 -918
-srl a7 s2 t0
-sltu t6 t6 s0
-srai t1 s7 5
-slli s8 s9 16
-srli a6 s8 5
-srli t2 t4 3
-mulh s8 a2 x0
-sub x0 s10 a7
-slli s6 t2 20
-sll a0 s11 s9
-div s1 t6 s0
-sll ra s2 ra
-mul s1 s0 a6
-divu a5 t5 a3
-slli s6 tp 22
-andi s1 s1 -1212
-xor a1 x0 a3
-slt s11 s1 gp
-sll a1 x0 a6
-srl x0 s2 a7
-slt gp a1 s1
-add s6 a5 a1
-sll t5 s9 a6
-mulhsu s3 s8 s2
-sub s7 a2 s5
-auipc tp 653855
-xori t3 s2 -1947
-mulh t1 a2 a5
-ori s8 gp 72
-addi s6 t0 1674
-srli t0 s9 30
-mulhsu t2 s5 a6
-xor s11 s8 t4
-mulh x0 s9 gp
-divu s10 t3 gp
-srli s11 ra 4
-xori t6 a5 -1115
-lui a0 792087
-divu a3 a6 a5
-and t4 s1 s1
-rem s4 a2 s4
-slli t5 t4 29
-divu s9 a6 s2
-auipc t1 318560
-add a1 a2 a2
-lui s4 39246
-sll a7 s0 a4
-add s6 ra tp
-sltu s1 a6 s0
-sltu t5 t3 s6
-lui s1 394356
-mulhsu t3 t3 t6
-remu s11 s11 t5
-sra a4 s1 a2
-mul gp ra x0
-and gp s2 a0
-sra s5 s0 s1
-remu a0 s5 a0
-andi t3 s8 -1150
-and s1 t4 s9
-auipc a6 948271
-divu a5 a3 s2
-sra a4 s9 x0
-xori t1 t4 -830
-addi a4 s1 -244
-sub s1 t1 t4
-slt s11 s6 a3
-slt s8 s1 s8
-mulhsu s9 a5 s4
-lui s1 254933
-ori s3 s2 -729
-divu s6 t1 t3
-and t1 s5 s5
-srai gp s11 5
-slti t0 t5 -14
-divu a4 s3 t4
-sltu s3 s3 t6
-mulh t6 s9 t6
-lui a7 193857
-andi s1 a0 -26
-or a3 t2 a1
-srai a2 a3 29
-sra t6 t1 a7
-rem a4 t2 t3
-mulh s0 a5 s2
-or a7 t1 a0
-xori s11 t0 -1097
-mul t1 ra x0
-addi t4 a2 326
-mulh a5 a4 s6
-xor a6 s11 ra
-ori t3 x0 618
-addi t5 s9 -181
-sll s7 a5 t1
-slti s5 x0 -1758
-addi s4 ra 914
-and s2 t2 a0
-sltu t5 a5 t6
-auipc tp 698686
-auipc a3 319128
-mulh t6 s8 s7
-srai s8 a3 16
-srl s0 s5 t6
-sltiu t2 a7 -394
-slti t6 a3 -48
-andi s5 s6 743
-and a1 t6 s2
-slt s8 tp t3
-srai s2 t2 0
-xori a6 a6 -821
-andi x0 s3 1199
-srai gp t2 2
-xor t5 gp a1
-ori a7 a5 -425
-div t0 a1 a7
-xori a7 s8 -1914
-slt t6 t6 t2
-mulh a1 s8 a1
-remu t2 a1 s4
-slli tp s3 1
-srl s1 s11 x0
-div a7 a2 a2
-add t2 s5 s9
-lui s5 413380
-addi t6 s3 1934
-div s5 a0 x0
-remu s3 t5 t5
-sltu t0 s9 s9
-div a1 s1 s9
-div x0 s8 a2
-or a4 a1 s4
-or tp a5 s4
-mulhsu s1 a2 s6
-remu a1 s5 a2
-sltiu t4 a5 -166
-sltu s11 t2 ra
-mulhu a7 s0 s7
-sltu x0 x0 ra
-mulh a5 gp t6
-srli s1 s3 16
-andi s0 s5 -1257
-sub a2 s0 t4
-sll s1 a2 a3
-ori x0 a0 -1770
-slt a6 x0 ra
-sub t3 s10 a7
-sll a0 x0 s10
-xori a5 tp -453
-andi s3 gp -1039
-sltu s1 x0 x0
-sra s3 s7 tp
-srli s3 a7 24
-addi s2 t4 1580
-add tp x0 x0
-addi t5 s9 -1497
-mul t6 t2 s0
-or a4 s4 a2
-sltiu s1 x0 302
-slli s6 x0 1
-slt t6 a6 s2
-add a7 a1 a3
-slt t2 a6 s8
-xori s5 s4 -648
-srai a7 s0 11
-mulhu s7 a3 t4
-or a0 a0 ra
-and t0 s1 x0
-mulhsu a2 t2 s6
-srai tp s5 14
-sll gp ra t4
-xor a4 a6 t0
-sltu s0 t2 s11
-mul s7 a6 t2
-remu x0 a7 t0
-sltiu x0 s10 -1809
-srai a7 gp 23
-and t0 s10 t6
-slti s2 a3 -682
-mul x0 s9 a0
-remu a4 s6 s7
-sltiu s0 s7 -868
-rem t3 a4 a3
-slti a4 s8 -1296
-sra a5 a0 t3
-sltiu t2 a3 220
-srl a5 s11 s3
-and x0 s5 t4
-sltu t6 s2 s3
-divu s7 gp a1
-xori a7 t3 -963
-sltiu s3 t0 -2008
-mulh a5 t5 t3
-divu s8 t1 a7
-srl s3 t4 s3
-sra t5 t1 tp
-rem s6 t0 s5
-srl a2 a2 s5
-ori a1 s10 -1185
-or s1 s7 ra
-mulhu x0 a5 a5
-div t2 s1 gp
-and x0 s1 t3
-mulhu s11 s5 a7
-ori s3 a2 -1260
-srai s8 t0 3
-remu a7 a6 s6
-rem gp a0 s11
-add s11 s0 s4
-ori s2 a4 407
-xori t6 s9 -822
-mulhsu gp s9 t3
-mulhu t4 a6 t2
-slli a4 s2 5
-add t4 a2 s8
-slti t2 tp -1076
-andi t2 t5 -346
-xor x0 s11 t4
-add s2 t3 t4
-xori a0 s5 -1174
-sltu s3 tp ra
-add x0 s3 a3
-slti s11 t4 925
-srli a7 x0 2
-xori s3 a0 -1900
-lui a4 707924
-srai t0 x0 10
-mulhu a1 x0 s6
-srl gp gp t1
-addi gp a4 -967
-remu ra t5 t2
-slti s4 t3 -425
-srli s6 x0 26
-slli s0 t4 16
-srai a3 t5 10
-mul a4 s2 t6
-rem a5 t0 a5
-auipc a4 518960
-mulhsu s2 a5 s0
-slt s11 t0 s1
-xor s9 t5 a1
-slti s1 t0 1050
-xor tp s3 t0
-srai s9 a7 22
-mul a3 a5 ra
-ori s4 s3 -266
-ori s9 t4 -39
-xori s0 a3 -769
-divu t0 ra a3
-xori s3 s9 -1120
-mulhu s2 s9 a5
-xor t0 gp tp
-sub x0 t3 s2
-xori t5 t2 1277
-or t4 s4 s10
-mulh a4 ra t6
-slt t6 s5 s9
-mulh a2 t0 s9
-divu s2 x0 t1
-mul s7 s10 a3
-slti ra tp -907
-ori a2 ra 219
-sll tp s1 a7
-sub x0 t2 s8
-sra x0 t0 s9
-srai s5 s2 21
-auipc t4 14516
-xor a3 t2 a7
-mulhsu t5 x0 a2
-div ra t6 s7
-mulhu a6 x0 t1
-slt t3 s10 s11
-sltu s2 s2 s8
-mulhu s10 s0 s6
-mulh s3 x0 t2
-sll a2 x0 t0
-ori a1 t5 -1108
-xor a2 x0 t0
-auipc a5 1034059
-srl gp a0 a5
-lui t4 846742
-sltu a7 s8 s10
-sra t4 s5 s9
-divu s6 s2 gp
-div a2 t1 s1
-div ra gp t4
-andi t1 gp -1799
-mulh x0 s1 s9
-sll s6 t5 ra
-rem t5 t6 a1
-ori s2 a6 1830
-mulhu t0 x0 ra
-slt tp a0 t6
-slt t5 a3 s3
-srl a7 gp tp
-srli s10 gp 3
-sub a0 s10 ra
-slt tp a6 s5
-srai s6 x0 29
-sub s5 a7 s10
-srai s9 a2 29
-xori tp t2 -831
-divu s3 s7 s6
-and s11 x0 a2
-auipc a5 722665
-sll a1 s8 a1
-addi s5 a6 -1413
-sll a7 s0 a0
-mulhsu a4 x0 a1
-slli s11 a1 6
-srli tp a6 16
-remu t4 s8 s5
-or s4 a3 a0
-mul s3 a1 s3
-addi t0 s6 1140
-mul a4 t0 s3
-mulh a1 t2 s2
-slt s7 t6 s8
-mulhsu s9 a3 s5
-remu t1 a4 t6
-sltu t4 tp a2
-sub ra a1 s10
-remu x0 t5 x0
-mulhsu a6 s9 s5
-sra s5 x0 s4
-lui s1 439247
-mul x0 a1 a5
-mul t4 a2 a3
-sll t5 s4 t3
-srai t6 a3 19
-xor a7 t1 s2
-sra a0 s11 a1
-rem t4 t5 a6
-sll s11 a4 a0
-rem x0 s1 t5
-divu s5 s8 t3
-auipc s5 537065
-sltiu s1 a3 -971
-sll t1 s6 t4
-auipc a4 617483
-srli a4 t1 24
-xor s1 t5 s4
-mulhu ra t1 s3
-srl s0 x0 tp
-add s4 x0 gp
-or t5 t3 s5
-srl s4 s9 a0
-xori s7 s5 917
-xor a3 s9 s10
-xori gp gp -1923
-slti s5 s7 -358
-rem s6 t5 t4
-div t5 gp gp
-remu x0 t4 s1
-div t5 a2 s0
-lui a2 190190
-srli s6 a7 29
+remu s6 gp tp
+slt s6 a7 a6
+auipc s1 738565
+sltu t0 t0 s6
+xor t5 s4 t0
+div ra a5 s1
+slt a2 t4 s4
+lui gp 357867
+slti t5 a0 -1214
+mulhu a2 t1 s0
+sltu s1 x0 s1
+div a5 t6 a1
+slti a5 gp 1795
+sltu s0 s1 a1
+lui a7 416675
+sra s3 s3 a4
+xor t2 ra s3
+sltu s0 tp t0
+slti s4 t1 -354
+andi s3 a2 -1000
+slt s1 s2 s9
+xor a0 a0 s2
+lui t6 150788
+and t6 ra t0
+add a3 a5 s5
+srai tp a5 20
+sltiu tp t1 71
+sltu a4 a2 t1
+remu s11 a1 s6
+xor x0 t6 t0
+srai x0 gp 20
+sra s1 s7 a2
+slli s5 ra 5
+andi s0 s9 -1955
+auipc t5 302213
+add t6 s4 a6
+andi t4 t4 -631
+or t5 s8 a4
+divu gp t6 a3
+lui ra 982176
+lui s6 219855
+srai s5 s9 16
+srl t4 s5 a7
+slt s1 a2 a0
+sltiu tp s9 -1729
+mul a6 x0 s1
+xori t0 s2 -883
+add s11 t3 a5
+srai s7 s0 22
+sll s4 a5 a3
+lui s9 682851
+sltiu a4 a0 -1525
+and a4 a3 s5
+srai t4 a3 9
+mulhsu t5 t1 t4
+mulh a6 a4 s3
+auipc t4 733706
+mulhsu t0 t1 s2
+slt s10 a4 t0
+sub t6 s6 s9
+and s10 a3 a4
+mul a4 a4 s5
+xor tp s0 s2
+divu a7 s4 t0
+remu a2 s11 a1
+sltiu a7 a3 304
+rem s8 t5 t5
+xor a2 a7 t4
+sltiu t2 t3 -776
+sra a0 tp ra
+xori a6 t5 1281
+xori s8 a3 715
+auipc a6 344976
+div t1 t5 a0
+divu a2 a4 a4
+mul s8 t3 t2
+andi s0 s8 1781
+slt a1 t0 a4
+slti s9 a5 516
+srl gp a2 t2
+xori gp s6 -1287
+auipc a6 43714
+sra a2 s8 s1
+ori t1 s5 -936
+addi s5 a2 -846
+xor s0 a4 a3
+sub t6 s7 x0
+sll a0 s6 a4
+sra s3 t1 a4
+auipc s1 458300
+andi s0 s6 -1009
+xori s0 t3 658
+slt s11 s6 s9
+srl a0 a0 tp
+div a7 s5 t1
+sltiu a5 s3 1682
+mulhsu s1 s1 s4
+sub a0 t0 t0
+sll s4 t6 t6
+sub s7 s1 t6
+sub t4 s6 s7
+sltu tp s6 s3
+rem t5 s4 t4
+and s8 a1 a2
+or t6 s0 s9
+sll s2 s9 ra
+slt a7 s5 t4
+xori ra s6 1590
+slli a3 a0 30
+srai t2 t1 12
+sll a2 a3 s7
+slt s6 a0 a7
+sra a2 t6 t2
+sra s7 s3 s3
+remu a1 a3 gp
+slli t1 s11 29
+srl a6 s5 s0
+mulhsu a6 t4 t1
+sltu t6 t4 a1
+andi a1 t2 -201
+rem tp s4 tp
+andi s2 a5 -1866
+rem a6 x0 t3
+sll t5 s7 a1
+mulh a1 a6 t5
+srli s6 t0 31
+xori t0 gp -1845
+xor a3 s10 t0
+divu a3 s7 a1
+andi tp a7 -1794
+addi t1 t1 1742
+mul a4 a1 t0
+mulhu s5 t4 ra
+mulhsu s4 t1 t6
+remu s9 a0 s8
+mulh s3 s11 a2
+rem ra t5 ra
+lui a5 1018309
+or a4 s7 t5
+mulh a7 s4 a5
+or s1 s8 t5
+xori s9 s2 -1983
+or t6 a5 s11
+xori s0 t6 -1283
+andi a2 s8 -1044
+mulhsu s7 s0 t1
+srli t2 s7 1
+sub s1 a7 s8
+mul s5 a5 s8
+add a4 s3 a6
+mulh a1 s1 t2
+or x0 s9 gp
+remu t4 tp s5
+slli s3 t0 28
+remu t0 t2 a5
+sra a0 s1 x0
+sub s5 a1 s4
+srl gp s9 ra
+and s7 s4 t0
+mulhsu a6 s7 a2
+auipc t4 733510
+andi t5 s4 1991
+xor t5 s7 s3
+slt a2 t0 a0
+slti a7 t3 1093
+andi gp s8 -1962
+srai t4 tp 13
+slli s6 s3 19
+or tp s11 t4
+remu a6 t0 t5
+mulhu a2 tp t0
+lui x0 17532
+slli t4 s9 15
+and ra t4 a4
+sra t3 a2 a7
+sra s3 a2 t6
+slti t2 t6 -1885
+and s9 s3 t1
+xor gp t3 ra
+div t5 s4 t6
+remu s5 s10 s6
+lui s8 983524
+or s3 x0 a3
+srl s0 s5 a4
+sra s9 s9 s8
+and tp a5 t2
+div t0 s9 s2
+rem ra s8 t3
+remu s3 s0 a3
+add t2 t4 t1
+mulhsu s10 gp a7
+slli t0 t3 14
+mulh t3 s11 x0
+or a0 a5 a7
+sll s1 a1 a1
+xor s5 s9 t1
+slti a3 t4 -171
+ori s4 t4 -1578
+or a5 t4 s9
+auipc t2 134223
+mulh s9 t2 ra
+sra a2 x0 s0
+andi s3 a5 2014
+addi t6 gp -1460
+sll t3 t0 s1
+sub t3 a3 s5
+srai s0 t5 3
+sltu s4 s5 s2
+mulhu t5 s9 s10
+xori a7 t1 -1871
+srai a5 t4 9
+srai x0 a4 29
+mul s6 t3 t5
+ori s2 t1 -729
+ori s7 t2 -280
+sra s2 t3 s10
+add x0 a4 s5
+mulhsu a2 a3 t3
+div s5 t6 s6
+divu ra a3 a2
+srai s2 x0 13
+srl s6 t5 a2
+add a3 t1 t5
+sub s0 t6 a3
+andi a5 s9 574
+mulhsu s6 tp t1
+sra t1 a4 s8
+srli a2 t2 13
+divu a4 a6 s3
+xori a4 a4 726
+xori a0 s1 16
+srli ra t3 26
+srai a7 s8 31
+sub t0 t2 a4
+mul s5 s0 s11
+remu a3 a7 s3
+sltu s2 s5 a3
+mul s2 s2 a2
+mul s0 gp gp
+xori s7 s6 -1731
+srli a0 t3 16
+srai gp s9 0
+divu gp gp a3
+andi s0 s8 -1892
+mul a1 a7 t6
+srl a3 s8 s2
+srli gp x0 7
+xori t3 s3 -401
+xori s10 a5 -728
+divu s3 t5 s4
+auipc a2 957231
+add s0 s6 t2
+xor x0 s8 gp
+div a7 ra t0
+auipc ra 209233
+xori t5 s4 725
+auipc t2 721693
+lui a6 977244
+sll x0 s1 x0
+addi s0 t0 -1502
+andi s0 s0 -457
+sltiu t2 t0 -1269
+or ra a3 t1
+and t4 s10 s6
+andi s5 s10 1463
+mulh a5 x0 s9
+sra t2 s3 t1
+mulhu s8 a1 s2
+rem t0 s9 t3
+or s7 s1 s3
+slli t5 a4 16
+auipc t4 84232
+slti t5 s10 -1508
+add t4 t2 t3
+div s1 tp s4
+sltu a2 s0 t2
+lui s1 577855
+divu s0 a6 a7
+rem a4 s10 s5
+auipc a2 140989
+lui t5 731636
+srl a2 s3 s11
+srli t2 s2 16
+andi t4 x0 -919
+add a1 a2 s10
+slli ra s5 17
+xori t2 tp 103
+sltiu a2 s11 -676
+mulhu s0 tp s11
+auipc t1 813151
+xori s11 t0 1327
+sub t3 t1 s10
+slt s5 a1 a4
+and t0 s1 s6
+mulhsu s4 t5 t1
+sub s4 t0 x0
+mulhu a5 a6 t0
+rem s1 t4 tp
+auipc a4 61998
+slti s11 s1 -979
+andi a2 t0 -1870
+sll a0 s11 s0
+and a6 t0 s1
+mulh s4 s6 t0
+sub s3 a4 s2
+mulhu x0 s5 t1
+mulhsu s2 a5 t2
+sll s2 s11 s10
+sll t1 t1 s10
+mulhu a7 s11 s10
+srai s9 a2 30
+sra t1 gp a0
+rem t4 a4 a4
+lui s9 641949
+divu tp s9 a1
+sub a7 s4 s4
+xori a5 a1 -469
+mulhu t3 s9 a1
+lui ra 619131
+lui s6 325789
+mulhsu s4 s1 x0
+slt s6 a3 s11
+add a1 t0 a3
+slt s1 s8 s10
+slti a3 t2 -1035
+rem t0 ra a6
+sll s0 s11 tp
+slt a7 t2 s4
+lui x0 405307
+addi t2 a6 -1402
+slli s1 x0 11
+sltiu gp s6 -32
+sll a2 s1 a0
+xor tp t4 x0
+slli t3 a0 31
+mulhsu t2 a4 t1
+auipc t1 882450
+auipc s0 850431
+andi a7 t2 -1084
+add a6 t3 s4
+slli s4 a2 9
+mulh t5 t5 gp
+andi s11 a1 -676
+remu t2 a0 t6
+ori s1 a6 2035
+lui s3 643529
+sltiu tp s3 -2001
+remu a5 t3 t0
+srli a1 s3 9
+add s10 gp s1
+mulhu s4 tp a3
+mul t2 s5 t1
+slt t1 s9 a4
+ori s0 a4 -1986
+or s1 s8 tp
+addi s10 tp -495
+mulhsu a7 gp a5
+and s3 s11 s3
+ori t6 s3 -725
+div s8 s6 s6
+sltu t1 t3 tp
+mulhu a4 a4 s10
+mulhsu s11 tp s3
+xor a2 s2 s0
+slli s6 tp 1
+sltiu s11 s7 -1841
+srli s1 s7 27
+srai t1 a3 11
+andi s10 x0 -155
+andi a6 t3 -1612
+mulhsu tp t3 s6
+slti a5 t6 -1428
+sltu s6 s9 ra
+auipc t4 448961
+srai t2 s2 6
+slt ra s8 s10
+slt t6 s4 gp
+rem a1 t4 s10
+remu t5 ra a5
+and s9 s8 gp
+sll t5 a7 s8
+slli s5 t1 1
+xor ra t3 x0
+slti t0 t4 -88
+rem a5 s9 a0
+and s3 s9 s10
+divu s7 a5 s11
+auipc s5 1007172
+addi s6 s7 -528
+addi t1 a3 -809
+sra t6 s9 t3
+sub t4 a7 t6
+slli s7 gp 3
+srli t4 s9 27
+sub x0 s6 x0
+div gp s5 ra
+slt t3 s8 t6
+ori t0 t6 67
+mulhsu t1 s11 s6
+slli s4 s3 2
+sltu s4 a6 a2
+lui t0 964372
+sltiu t4 tp -288
+lui s0 743870
+ori s10 a2 -1286
+or t2 ra s10
+remu gp a6 t5
+slti s1 a1 239
+divu s10 s2 a6
+slt t6 t2 a0
+srl s3 t2 s4
+slt s0 a4 s1
+slti a0 s1 -1680
+or s11 s9 a0
+auipc a0 541472
+sll a3 tp s1
+add t1 s10 s11
+mul s6 a5 s7
+srai t0 s7 7
+slti s6 gp -114
+slt a4 t4 s3
+auipc s1 133895
+mulhu a0 t0 t5
+slt ra t3 a6
+lui a3 780707
+sra t1 t4 x0
+mul s11 a2 s8
+slli t0 t6 4
+sra a7 t5 a6
+mulhsu s7 a7 a3
+slti s1 s0 1065
+andi s9 s6 1812
+lui s9 872209
+div s6 a1 a3
+remu tp s6 t0
+mulh a5 a3 t1
+sub t2 s9 ra
+or tp t6 x0
+rem t4 t3 s1
+mulhsu a6 t0 t6
+srli a7 t6 2
+or gp gp s7
+srl s4 x0 a1
+divu t5 s8 a6
+andi t1 a5 -1357
+sltu s2 s8 t5
+srai s3 s3 29
+srli x0 s5 19
+or t0 tp s0
+xori a1 a3 -1034
+lui a1 328701
+sltiu s3 t2 -1790
+rem s10 ra t1
+sltiu gp s4 -1745
+mulhsu t5 a0 t1
+sltiu s0 a1 -1328
+srli t2 a0 9
+xor s3 a3 s4
+xori s10 ra -672
+andi a7 ra -1803
+sltiu s5 t4 2006
+divu t1 t0 a6
+sll t5 t0 a1
+and t6 s4 t6
+sll t2 t5 s9
+mulhsu ra s11 tp
+srai a1 t5 26
+mulhsu a7 gp t2
+ori s10 s11 -673
+mulhu s2 s3 a3
+mulhu t3 t4 t5
+addi t2 gp -29
+mulhu tp a0 gp
+srl a4 a7 s2
+srli a0 s11 0
+ori a6 s11 -1736
+sra s8 s11 gp
+sra s4 t3 a4
+slti t1 s1 1448
+srl s0 s1 s3
+mul a7 a7 gp
+sub s0 s5 a3
+sltiu a1 s4 -895
+rem s4 s11 t1
+xori x0 x0 -1746
+remu s5 a0 s0
+auipc s6 840160
+lui s9 150866
+mul s6 t5 a5
+sll s5 t2 s5
+mulhsu a3 s3 s7
+sltu s10 ra t3
+slti ra ra 509
+mulh s2 s7 s11
+mulhsu s11 s8 t2
+or t2 x0 a2
+remu a1 t4 s10
+slli t5 ra 12
+slli gp a3 1
+divu a7 a4 t5
+rem t1 t3 s6
+srai t0 s8 24
+sll a4 a7 a3
+mulhu a1 s11 s7
+slti s11 s5 1037
+xor t6 a7 a7
+remu gp s7 a5
+srai s6 s3 17
+div a6 s1 s10
+sll ra a2 a6
+rem a4 t1 ra
+srl a0 a4 s10
+addi gp tp -1350
+sub a0 s7 s9
+sll t3 t6 x0
+xor a7 t2 a7
+sll s10 s9 s5
+sll s8 gp a2
+sra a5 t3 s3
+addi s11 s3 543
+add s9 a7 tp
+srli a6 s4 29
+addi a4 a6 -996
+sra s5 s1 gp
+srai t5 ra 15
+ori s3 t6 -1093
+srai t1 gp 27
+mul t0 a4 a7
+lui x0 433010
+slt a4 s4 s7
+slt t3 s6 s5
+mulhu s2 s6 s7
+srli a3 s4 21
+mul a7 s1 a6
+srl t6 s3 s1
+ori x0 t6 -147
+slli t0 t1 8
+srai t4 a3 13
+mulhsu a6 a4 s5
+xor gp gp s5
+sra s7 s4 gp
+srl s1 s10 s9
+div s1 ra s11
+or s5 a5 a3
+mulhu a3 a3 s6
+andi s6 tp -2040
+sltu s6 s7 s1
+and t2 a7 x0
+sub t2 a5 gp
+add a4 s7 s8
+mulhu s0 t3 t2
+sltu a2 ra t3
+sltiu t6 s8 5
+sra t1 t3 s2
+srl x0 s4 t4
+lui s11 278790
+auipc a5 936167
+ori s8 s9 -553
+sll s0 gp gp
+mulhsu s5 t2 ra
+divu s8 s10 t3
+sltu s8 s2 a0
+sll x0 gp t1
+sra a1 t2 a0
+or s11 s5 gp
+slli t2 s11 4
+add s0 a6 s6
+addi ra s5 543
+srai ra t0 7
+mulhsu s3 s1 t3
+xor s11 a5 a7
+mulh a3 a4 s11
+srai s11 s2 4
+div s5 a7 s0
+mulhsu ra s4 s1
+sltu s9 x0 t1
+mulhsu t4 s8 s10
+or a1 a7 s2
+sub s0 s10 a2
+srli s8 s9 17
+xor a7 t4 s3
+sll a3 x0 s3
+div gp s3 s5
+slt x0 s7 s7
+xor a3 s10 s7
+andi a3 t0 1286
+addi t5 s11 -382
+mulhu s0 gp t3
+slt a3 s9 t1
+xori s2 s4 1365
+slt s11 t4 s2
+add t3 a2 t4
+srli ra a3 30
+andi t3 a3 224
+xor gp s0 tp
+divu s10 a1 s8
+xori s0 a5 -997
+remu s11 x0 t1
+sltiu a7 s2 -871
+srai s5 a5 4
+divu ra a6 t0
+srai t4 a4 18
+andi s5 a1 -961
+srai s5 a2 9
+sll a1 a5 a3
+addi a6 t2 -690
+mul a7 s8 ra
+or t6 s1 s9
+sltiu a7 s7 -401
+srl s1 s8 s10
+mulhu a3 s7 ra
+xor a1 a1 s8
+and t5 a1 t6
+mulhsu x0 s7 s5
+auipc s4 997138
+slti a4 a1 95
+andi a6 s10 -1874
+slti s1 t4 -561
+auipc a4 851876
+mul s2 gp s8
+addi t1 t3 816
+srai t2 t2 30
+sra s6 s1 a5
+or x0 s0 a0
+add s8 x0 s4
+divu s1 s1 ra
+mul s9 s1 t0
+or s0 s0 s6
+mulh s5 a5 a1
+add t4 a3 s0
+mul gp s9 t1
+xori a7 s7 -165
+addi s11 s5 -1130
+sub a6 s5 ra
+ori s3 s3 -114
+auipc s0 84114
+remu t4 s5 a0
+lui t6 279568
+mulhu s9 s0 t0
+sra t1 a7 s7
+or s5 a4 a1
+mulh gp a7 a0
+slt t4 x0 s3
+addi t4 t1 497
+divu t1 t6 t3
+lui s11 183810
+sub a7 t3 s0
+mulhu s8 t4 s2
+sra s3 t1 t4
+sra a3 x0 s11
+mulhsu t0 s11 s7
+rem s4 gp a6
+sll s2 a5 t2
+mulh s11 s2 tp
+mul s5 a5 s6
+mulhu a4 s0 t5
+sub t6 s4 s7
+mul s9 s5 s7
+or a2 s1 x0
+sltu s9 s1 tp
+lui tp 691574
+slt t0 t6 t6
+srl s7 s9 s1
+add a3 ra s8
+auipc s11 932208
+ori t3 a1 -1576
+or s11 s5 s6
+srai s3 t0 30
+and s1 s11 s2
+sltiu a1 s11 -1615
+slli a5 t1 15
+divu s6 t5 s5
+sra s6 s7 x0
+andi s2 ra -1439
+remu t6 t4 a6
+add a1 t1 tp
+xori a4 s8 -287
+ori a7 a3 -761
+sll a5 s4 a7
+mul x0 t3 t1
+srli a2 a3 14
+mul s4 ra t1
+mulhsu a0 s6 s10
+and a3 s6 a3
+slt s10 t1 s9
+mulh tp gp t5
+slt t0 s8 s0
+remu t2 t3 s8
+addi a1 t5 -48
+mulhsu s2 t2 a7
+xor s0 a4 t5
+andi x0 a6 935
+lui s9 900399
+addi x0 t0 304
+mulh a3 x0 t2
+ori s11 s6 -8
+mulh a3 s10 gp
+sltiu a5 t2 -1642
+remu a7 t6 a4
+srl t3 a0 t6
+mulhsu t2 s0 t2
+srai s10 s1 4
+mul a6 s1 s11
+slt s0 tp s8
+sltu s6 tp s9
+srli a3 s9 15
+or a7 t6 t5
+divu s0 gp s4
+divu x0 s11 x0
+ori s7 a5 -1813
+xor s9 t1 s11
+auipc t4 469250
+slti t0 s7 -19
+mulh t1 s2 t5
+srai a4 s4 25
+sll tp a7 a3
+sltu a0 a0 gp
+mulh s3 t3 t5
+slt ra s5 t1
+and a0 t6 ra
+remu a2 s0 tp
+lui x0 508681
+sub a5 s3 t2
+rem s3 a2 t6
+sll a3 x0 t0
+or t0 s5 t0
+srl t1 s1 s2
+divu a7 s9 s1
+mulhu s10 a0 x0
+or gp t2 t4
+remu s10 t1 t4
+div a2 ra t3
+andi a2 s5 923
+slli t4 a5 25
 rem x0 s2 t2
-srl s6 ra a1
-lui s6 876556
-mulh s1 t6 s10
-mul ra t3 s9
-slli s7 t4 20
-mulhu a0 s5 gp
-slti t5 t5 217
-srai a3 s0 2
-sltu t4 a2 a1
-mulhu a1 x0 t1
-srli s3 s4 7
-xori s0 a7 40
-xor s1 a5 t2
-slli tp s7 11
-slt s0 s9 x0
-add a2 s3 t6
-xori s10 s6 -1453
-addi s8 x0 -1369
-srl a5 s6 t1
-ori a4 s10 -562
-srai t3 s8 22
-mulhsu s8 t3 a4
-sra t4 a1 s10
-auipc t6 521779
-lui ra 893710
-mulhsu a4 s0 x0
-and a7 s1 ra
-divu s10 s2 s5
-xor a6 t6 s0
-mul s3 s0 t5
-sltiu a4 a4 -1129
-sub s9 a4 a0
-rem s0 s0 t3
-addi s3 a1 218
-addi a1 t1 2015
-sltu s5 a7 s2
-ori s9 t5 -735
-sra s3 t6 s8
-sra t4 s8 a7
-lui a2 144117
-sll gp a5 t5
-sub a7 x0 s8
-xori a0 t3 1470
-srli s9 s6 9
-auipc s9 284723
-rem a4 s11 s6
-srl t0 a7 a7
-remu s3 x0 s11
-slt x0 t1 a2
-sltiu s9 s4 2033
-srl s3 s5 a7
-slti x0 s11 -1052
-srli s5 gp 4
-addi a3 a4 539
-and x0 a1 t0
-mulhsu s9 a5 s8
-mulh t1 x0 s7
-sll gp s0 x0
-sltiu s10 t2 -1368
-addi s2 a7 -1614
+andi s2 a0 1603
+sltu a7 a4 t5
+slli s7 a2 10
+divu s5 t6 a2
+slli tp a0 2
+or s7 s8 t1
+sll a7 tp s4
+sltiu t2 t6 590
+mulh gp s1 s9
+or a0 s3 s9
+srai a6 a3 8
+lui s4 752321
+slti s5 s10 -1207
+rem a5 s9 a7
+slti s1 s4 394
+divu s0 s4 t5
+div gp s10 a5
+remu a4 t2 s4
+xori t0 a6 -1228
+slti s0 gp 764
+sltiu t1 s2 -45
+lui t4 576172
+srli t3 a2 7
+auipc s11 28218
+xori s8 s2 2028
+mulhsu t1 a7 gp
+srli ra s9 13
 srli a0 a2 15
-divu x0 s3 a6
-sltu s1 a4 t1
-and t4 ra tp
-divu a4 a0 s4
-slli s2 gp 12
-rem a2 t4 t6
-lui a0 597473
-add a6 s5 t5
-andi t5 t1 -1295
-auipc ra 43924
-sub a7 t0 a7
-lui a2 141442
-slli a2 x0 29
-srai t2 t1 1
-mulh s2 t1 s10
-div s4 t5 a0
-remu t4 s0 a4
-xor s9 t0 a5
-mul s9 s6 tp
-addi t4 x0 -1580
-slli s2 a5 15
-lui t0 526280
-add s9 a0 t0
-remu x0 a2 s4
-slti s4 t0 -2009
-div s0 s6 a6
-mulhu s10 t2 a3
-andi s5 t1 1836
-slti s11 t5 -891
-srai s2 s1 13
-mulhu t0 tp a2
-auipc gp 304392
-auipc s6 804157
-rem x0 s5 t5
-andi s0 s2 -672
-div t5 t0 t3
-sltu s5 s0 x0
-mulhsu a3 t5 ra
-mulh t6 s7 t3
-xori t6 x0 -514
-or s10 t1 s7
-sltiu a5 t5 -1074
-lui a3 459832
-sub x0 t6 a1
-sll a6 s5 s7
-slti a5 x0 -1341
-slt s4 a4 gp
-mulhsu a1 t6 tp
-divu s3 a1 s9
-sltiu gp s9 -264
-srai tp t4 4
-mul a3 s1 s8
-slli ra t5 21
-sll s11 a5 tp
-srli s0 ra 4
-lui tp 17473
-xori x0 t4 1425
-sltu tp a6 a0
-srl a1 a1 ra
-rem s3 a1 x0
-sll a7 s7 gp
-sra x0 a3 s6
-srai s7 t4 22
-sltu a0 a7 a3
-xor s4 a3 t2
-xor t0 a3 ra
-mul s4 s2 s4
-or x0 s0 t4
-auipc t5 297357
-mulh s6 s8 s0
-srli s11 s4 27
-sltu s9 x0 s4
-srli s8 t2 2
-div a6 a5 a0
-sra t4 a6 s8
-xor s7 s10 x0
-divu t6 t4 s0
-srai t0 a0 10
-mulh a4 s10 x0
-slli s5 s9 5
-sltiu s1 s7 758
-div a1 t5 s11
-andi s3 gp 776
-ori s6 tp -182
-and t0 a5 a5
-srl s4 t3 a4
-lui x0 695275
-mulhsu t3 t3 ra
-slli t5 s10 17
-addi t3 a1 733
-add x0 t1 x0
-or a7 t3 t4
-slt t2 tp s5
-remu t0 a0 ra
-or tp a7 t3
-slt a6 t6 gp
-xori t4 x0 -977
-sub a7 s1 a5
-rem a1 x0 ra
-rem t6 tp s0
-ori x0 x0 -252
-srai t4 s4 21
-mulhsu x0 a6 t5
-srli s0 a0 12
-ori a3 s8 849
-mulhsu t3 a4 t2
-sltu s0 t4 t1
-auipc t6 497653
-addi tp a5 -434
-sra s1 a5 a6
-andi s4 t4 -1182
-auipc t1 891034
-and t0 t2 t6
-ori s0 gp -138
-add x0 s10 s5
-remu t5 a5 x0
-add a6 s6 a5
-and x0 ra x0
-xor s8 s3 a6
-slli s3 s1 15
-slti a0 x0 -1176
-mulhsu s2 a3 s9
-sub t2 t1 x0
-and t3 a7 a4
-andi t3 a4 -198
-sltu s8 a3 gp
-or s8 tp a6
-mulhu s5 t1 s8
-srai t5 s9 14
-srai t3 s10 19
-auipc s3 855416
-remu s1 a4 s10
-mulhsu s6 s3 s8
-sltiu s9 t2 482
-slt t2 s9 s3
-andi a2 s7 -1045
-sub x0 t6 s9
-srai a1 a4 19
-addi a1 x0 -504
-ori t5 t3 -296
-sltiu a6 t6 497
-auipc a2 513867
-addi s3 t6 1985
-div s8 t3 s2
-or t6 a1 s1
-divu s9 s2 a6
-mul s8 t6 a4
-sra t1 a1 a7
-sltiu t3 s5 -384
-mul a2 a5 t3
-remu t1 s4 a4
-sltu t6 ra ra
-andi t5 a7 -353
-div s3 s8 t6
-sub a5 tp x0
-lui s0 358415
-add a6 s9 a3
-remu t1 t1 ra
-sll gp t3 t6
-srl s11 s9 s7
-srli a6 t4 14
-addi a3 s3 1223
-xori s6 t0 175
-srl s9 t6 s10
-xor x0 ra t0
-rem s0 t1 ra
-lui x0 388120
-remu s9 t3 s2
-addi x0 t3 -5
-mulh t2 x0 t1
-sltiu x0 x0 -1232
-sra gp a3 a7
-srl ra t2 tp
-ori tp a6 -937
-add a7 s7 t4
-srai t1 t1 10
-auipc t0 650997
-div s10 t0 s8
-slli t1 a7 31
-ori s5 t6 -1382
-srai s7 s4 29
-sltu t6 tp t5
-divu t4 gp gp
-sltiu t6 t4 1817
-and a6 gp a1
-divu a3 s8 t4
-rem gp ra a4
-sltiu a7 a5 -990
-srai a7 t3 9
-lui a2 90213
-add x0 t1 tp
-div t6 s3 s0
-srli gp t6 27
-andi t4 a3 -1155
-srai t0 s0 20
-srli s2 s2 6
-xor x0 a2 x0
-div s2 a3 s5
-lui gp 656258
-xori s6 s4 -1549
-div s10 t3 a0
-add a1 x0 tp
-srli s6 s2 24
-srai a7 s7 6
-srli ra a4 28
-xor s3 s9 a2
-or a0 s5 s5
-sll a6 s5 a0
-and t2 s3 s8
-div s5 s10 a4
-slti t4 x0 1676
-slli t0 t6 21
-sll s5 ra s9
-slti a5 s2 1145
-mulh a5 a7 a0
-mulh tp t3 s1
-sub s8 a4 t3
-srl t2 s9 t6
-xor ra a0 t2
-sub t1 a2 t3
-auipc s4 650462
-add a4 t6 a3
-lui s11 16372
-rem t1 tp t2
-slt t1 ra a4
-rem s10 x0 t4
-div s3 gp s5
-divu s8 a6 a3
-srai a0 s5 24
-add t2 t4 t6
-slli s11 s10 16
-slti t4 s3 -240
-srl a6 t3 x0
-xor s10 a2 s9
-xori a5 s11 -1807
-add s11 s5 t5
-slt a7 x0 s2
-mulh tp gp s1
-mulhu a0 s4 t3
-xori t5 s2 -569
-remu s11 ra s2
-remu t6 x0 s2
-slt t4 x0 s0
-and s5 s11 tp
-addi s3 t1 -1059
-xor s2 a0 s9
-auipc t3 668912
-srli t6 s2 20
-divu t0 s9 s7
-xor s9 a6 s1
-addi s10 a7 -171
-sra s4 s10 t3
-addi s1 t3 1354
-divu x0 s9 ra
-xor x0 ra t3
-rem a1 s9 s10
-sub t4 tp s8
-slti tp t3 -315
-sltu s4 x0 s10
-xori ra t0 -319
-div s10 a3 s7
-mul a7 t2 x0
-mulhu s3 s0 s3
-xor s5 s2 s4
-srai s7 x0 4
-auipc t2 974291
-auipc t3 407749
-sltu t5 s5 s4
-srai ra a6 12
-div gp s4 s2
-add tp tp a3
-addi s2 s10 -830
-addi t5 a6 -1710
-mulhsu t3 s10 a2
-ori t1 t1 -1796
-divu s3 a7 a7
-mulh s8 t0 s9
-xori t5 a7 1482
-sll s9 s4 ra
-mulh a7 t6 s5
-ori a6 s7 -1181
-mulhu s10 s11 t6
-sra s4 a1 t3
-srli s7 a5 10
-rem s11 a0 s8
-sll s8 s4 gp
-sub s5 a6 s1
-mul t6 a0 x0
-mulhu x0 s6 t2
-add s10 s4 t0
-sub x0 gp a6
-xori t2 s11 1522
-sltiu a4 t3 1872
-or s2 a1 t0
-addi s11 a0 -47
-slti t1 s9 -927
-auipc s2 570091
-remu t0 s0 s8
-or s8 t2 a5
-addi s7 s1 1439
-and a2 t6 a4
-slli a7 s10 20
-xori t0 a5 -680
-mulhu s7 t4 a0
-auipc t6 137359
-and t2 s2 s7
-slli a3 a0 0
-ori s2 x0 -1778
-srl s2 gp a7
-mulhu a7 s3 t5
-sub t6 s3 t4
-srli a4 s3 18
-sll gp s8 a0
-sub s8 t2 s0
-xor t0 s11 ra
-sltu t3 tp s10
-auipc s7 442
-remu a0 s11 a2
-mulhu a1 t1 a2
-ori a3 s1 1616
-slti s0 s6 -1633
-xori gp a1 -1119
-sub s6 s10 s1
-sra t3 t1 s11
-sltu s3 s5 t0
-and s0 a6 a3
-divu t0 a7 s6
-slli s2 x0 22
-remu s2 s2 t6
-xori t3 t3 -1440
-ori t0 s7 -1705
-mulhsu gp a7 s2
-mulhsu s0 t6 s7
-srli s3 x0 23
-sltu t0 s3 t6
-mulhu t5 t2 s3
-srai t5 s11 11
-srai s2 tp 23
-and a7 a1 t4
-sltiu x0 s0 -1100
-slti t0 t5 136
-divu s9 a0 tp
-sltiu ra t3 -529
-sltu t5 t5 x0
-sltiu a1 a6 -1943
-slli a0 t4 11
-andi t0 a4 1608
-andi a4 t6 1715
-div s11 a6 s8
-slti a6 t3 1427
-slli a7 a6 16
-srl s5 x0 s11
-sltiu s4 s2 -1909
-srl x0 a1 a4
-sra s10 a1 a2
-mul t4 a2 s1
-srli t1 t6 15
-sltu s0 s5 s7
-lui x0 159930
-slt x0 s1 x0
-rem s7 s9 s10
-lui a0 197225
-and s10 t2 s2
-divu t3 a1 x0
-remu t5 t3 s8
-slt a6 a2 s2
-sra s6 s9 t6
-srl t1 s3 s8
-sltiu s10 tp 906
-divu a5 a2 a0
-or t3 s8 a5
-or ra s8 t0
-add s7 a1 a0
-or t2 ra a6
-ori s5 a1 -1581
-sltu s11 a1 s10
-srli a4 ra 29
-divu s0 a0 s5
-srl t1 a6 t3
-divu a7 tp a0
-auipc s4 955419
-or a3 a5 gp
-sub gp t2 gp
-sub t2 s10 t3
-and t1 s10 s1
-addi a7 x0 887
-xori a6 a1 1373
-add s11 a6 a3
-sra s11 a1 a7
-slli s11 gp 1
-srai s7 s4 25
-add x0 s1 a1
-and t3 s6 s7
-mul a7 ra s7
-or a2 tp gp
-xori gp a4 1532
-sub t1 s9 gp
-andi t6 s2 827
-divu a1 t5 t1
-auipc s11 323954
-slli t1 t1 25
-remu s6 s0 x0
-xori t3 a0 -1542
-addi a0 t6 -1164
-slt s8 t4 a3
-auipc t5 876466
-rem x0 s10 a3
-xor gp s3 a0
-andi s7 s1 699
-mulhu t4 a5 x0
-srli a6 t1 7
-sub s2 s9 s7
-add s10 s7 s3
-addi a6 tp -1687
-addi t5 s8 -303
-auipc t4 664554
-mulh t1 s0 s6
-ori s10 t2 1311
-xor t6 t4 t6
-lui s0 353235
-addi a4 s10 -1302
-and a6 s5 t4
-xori s10 x0 -876
-mulhsu tp s9 a3
-sra s2 t5 s2
-ori s2 gp -1316
-ori t2 t2 -229
-mulh t2 t1 a7
-or t5 t4 a0
-slt t4 s9 t4
-mul s6 t0 t2
-srai s9 t6 18
-andi s5 s7 -1061
-rem a1 s5 s3
-srli a3 a0 25
-sltu s0 s5 s7
-sltiu t5 a6 -1951
-srli t6 s7 2
-remu s5 s3 s5
-sra t4 s10 a3
-srl a1 t5 x0
-slti s2 s4 1953
-slli s5 s11 18
-addi a7 s1 1799
-slti s7 a5 -243
-srl t2 gp gp
-and a4 t0 t5
-slti s4 a5 1395
-mulh s5 s8 s7
-slti ra s9 -972
-srl s6 tp ra
-sltu a7 a6 a6
-xor t5 s11 s5
-lui a1 808369
-mulhu x0 s6 s0
-ori a2 s11 -658
-addi s7 s8 -159
-mulh a2 a2 a4
-auipc s3 224477
-slt a5 x0 a2
-sltu s10 a3 a5
-mul a7 t3 ra
-add t4 s10 x0
-div a3 a3 x0
-or a3 a0 s10
-xori a7 s7 -1140
-mulhsu a1 t6 a2
-auipc t1 771465
-xor s8 x0 a2
-mul t0 t6 s8
-divu tp t1 t3
-lui a7 695189
-or s11 s9 t4
-sub a1 t2 ra
-rem x0 s2 s11
-slt s3 s8 a3
-sltu a7 x0 s2
-xor s1 s6 a5
-remu s2 s5 a6
-andi a5 x0 -1341
-sltu t1 t0 t0
-mul a6 t3 s6
-sltiu s0 s7 -1424
-and s11 a2 t4
-ori tp t0 -1247
-div t5 s9 s5
-sltu t2 t4 s5
-mulh a5 s11 s9
+sub t1 t5 a1
+xori a5 t5 -1710
+and a4 s1 s1
+srl t3 a3 t0
+srl s0 t3 t5
+sra s6 s1 t3
+xori t1 t6 -1010
+ori s0 a7 -999
+div s0 s9 t6
+sub s9 a0 t4
+sltu s5 x0 s6
+div a5 s11 s1
+and t4 s3 t1
+div a5 gp a0
+srai t2 s5 14
+or t2 gp t0
+addi s1 ra 951
+mulhsu t2 s5 s8
+add a6 ra t6
+mulh s7 t4 s5
+sll x0 s11 t5
+divu s6 t2 s10
+sll s11 t4 a0
+add t1 s11 a2
+slli t1 t5 13
+mulhsu s5 s11 s7
+sll tp a0 t3
+remu s4 a0 s4
+sll a2 a1 s7
+add t2 x0 s6
+srai s1 t4 17
+srl t3 s7 ra
+addi a0 t4 -136
+lui t6 167035
+srli t6 a2 13
+and x0 t2 a2
+srli x0 s11 12
+remu a1 t3 t3
+mulhu s10 t3 s0
+addi s8 a2 752
+slt s8 ra s2
+srli t6 tp 14
+and tp a7 ra
+sub s10 s4 a3
+divu a3 t0 a2
+remu t5 s10 tp
+div s6 s8 t4
+sltu s0 t6 s8
+divu t2 a1 a6
+slli a3 t0 20
+slti t1 s0 1905
+divu a3 t6 s0
+slti s4 tp 1489
+addi t3 ra -850
+and t0 t4 t4
+mulhu a5 a2 s0
+xor a4 s0 t4
+slt t4 s5 s4
+ori t4 s9 1273
+or t5 a5 t4
+andi t6 gp -461
+ori s2 t0 -1084
+lui t3 660144
+sra gp a4 s7
+srli t5 t6 25
+mul s0 a4 t0
+lui a7 45022
+xori t0 s9 -413
+sll s5 s9 a1
+addi s1 gp -1699
+srai t4 s8 9
+remu t6 t5 gp
+slt s5 s0 s1
+mulhu t6 s6 tp
+sltu a3 s0 t6
+or s1 t1 a2
+srli s11 s7 14
+addi t2 a1 1642
+div s6 s4 a2
+slli t2 t5 22
+sra a1 s5 gp
+ori a4 t4 -186
+sub x0 s10 t0
+mul a7 a5 t1
+divu a7 s11 tp
+sll ra gp s11
+or s0 a0 s4
+or s7 s11 a7
+slt s6 a1 a4
+slt s8 s6 t4
+srl gp s2 s0
+sll s1 ra a5
+auipc s11 534880
+sll s3 a2 s2
+srl a3 t0 s8
+sltu t6 s11 s4
+and s6 a1 s7
+slt s2 a0 s2
+andi s3 s2 -487
+addi a1 gp -1650
+slli s3 ra 22
+slli tp s1 29
+andi a3 s3 1189
+sub s5 s5 s2
+or tp a7 a3
+rem s2 s11 a2
+divu a4 t2 a0
+addi s2 a2 -1901
+add s4 s0 a2
+lui t5 93931
+sra s0 t3 t0
+srli a3 tp 20
+xor tp t0 a1
+sltiu s10 s5 -310
+auipc t6 1013196
+lui ra 177112
+mulhu s2 s0 a6
+sltiu t2 a7 -921
+auipc a3 162913
+or s8 s10 s8
+slli a7 a1 6
+ori t5 s5 -1718
+sra a5 x0 gp
+div t2 s1 s9
+add s0 s4 x0
+srli t4 s1 27
+ori a5 s10 -393
+sub x0 gp t6
+div ra a1 s5
+addi a2 t0 -1218
+xor a7 s3 gp
+srai s0 s4 13
+xor gp s9 t0
+sra a0 s1 s1
+and ra a7 a4
+sra a2 s8 s0
+auipc s7 983963
+ori a3 t6 1413
+addi a5 gp -1444
+auipc s2 503224
+and s3 s3 a6
+xor a5 t4 s4
+srli s1 t0 27
+lui s1 164726
+lui a2 1044279
+xori a0 s8 -330
+auipc a0 668239
+sll s0 t4 a7
+sra s5 t1 s5
+slti t3 s1 -1323
 mulhsu a3 t3 tp
-mulh ra ra gp
-rem a7 a2 t5
-add a0 a1 a3
-lui a0 402157
-lui t6 457249
-sltu t6 ra s3
-sltu t5 x0 t0
-add a4 a0 x0
-sll x0 t5 s10
-sub tp s5 s11
-auipc a0 107636
-xori s9 t6 576
-mulh a1 a3 t2
-andi t1 a7 -1976
-andi x0 s2 -1810
-auipc gp 642671
-rem a7 t4 a7
-srli a4 s10 22
-add t3 s1 t3
-mulhu t1 x0 x0
-and a2 a0 t3
-divu s11 s5 t3
-rem a0 tp s5
-divu t2 s1 a6
-slti a5 a0 -894
-mul a6 s0 ra
-remu gp s5 t4
-mul t5 s3 s1
-andi a6 s7 -1940
-auipc s1 634366
-ori t0 tp 1923
-mulh a7 t4 a5
-div t2 s6 t0
-srl s10 x0 t5
-remu s3 s9 s0
-addi s1 x0 -92
-sra s9 gp s5
-xori t3 t4 -1953
-srli tp s4 29
-sll s7 a0 tp
-divu a5 a7 t4
-slti a5 a2 634
-sra a7 a7 s2
-slti s7 a0 -1070
-xor a4 gp a7
-slt s3 s8 s9
-div s6 ra t5
-rem s9 s5 s4
-div s2 t1 ra
-sra s4 s11 s10
-mulhsu t5 a4 t0
-sltu a3 a0 t5
-sltiu a1 a7 1806
-rem a3 t0 s2
-xor s8 t4 s8
-xor s5 a1 a5
-srli s10 s4 4
-addi a3 ra -1427
-slt t4 t1 x0
-mulhsu a7 a5 gp
-srl gp t6 t2
-xor gp t2 a3
-div s3 t1 t6
-srai x0 t4 9
-srli s0 x0 7
-sltiu t6 s1 -344
-slti s5 a2 -837
-srli s4 tp 13
-andi a5 s11 1934
-srli a6 a6 11
-divu s4 x0 s0
-ori gp t3 1592
-sltiu a3 s2 -414
-sra t5 a4 x0
-remu s0 t6 gp
-xor s11 s6 t5
-rem s2 x0 a0
-slli t5 t3 23
-srai a1 s0 11
-xor x0 a5 x0
-sra t4 x0 s5
-remu s5 s11 t6
-addi s10 s0 953
-sltiu t0 s11 -2015
-srli t4 x0 15
-mul s0 t3 s10
-sra a4 s1 s6
-mulhu gp s1 t1
-srai a0 a2 3
-sltiu s0 a4 -1120
-xor s5 t1 a2
-mulhu s5 s9 s8
-sra ra a7 gp
-srai gp s5 14
-srl s11 t3 a5
-div ra s0 a6
-slli t1 ra 19
-sltu t2 t6 s2
-xori s0 s5 -1440
-div s5 t4 s2
-auipc t6 300920
-sll t4 tp s8
-auipc s11 766941
-mul s7 s11 t4
-sltiu s5 s3 -140
-xori s10 a6 -1802
-srli tp s10 23
-slli s7 s0 3
-sltiu x0 a1 475
-slli s4 x0 20
-andi s6 t0 -1271
-srl s4 a6 t2
-mulh s6 s10 s9
-srli s2 t5 28
-auipc a0 501838
-rem x0 s9 a3
-sub s7 s0 a6
-sltiu a1 tp -1182
-sltu a0 s6 s11
-sltu s5 a5 s5
-xor s2 ra s3
-div s1 a0 s1
-mulhsu s3 s6 a6
-and a4 t3 a7
-srl a2 x0 s9
-mul s6 s3 s1
-mulh s6 s2 t4
-mul a1 x0 ra
-auipc a3 118798
-and x0 a5 x0
-or a0 s9 s7
-addi a0 a5 -59
-sub x0 s0 s7
-slti s10 s0 492
-lui s7 526633
-auipc t0 898323
-addi s1 t0 -134
-andi a5 s6 1073
-addi a4 s6 -1806
-sltiu s6 s3 -1671
-sll a4 s7 s3
-divu t3 a4 t1
-xori t4 a4 -1624
-remu t3 x0 a5
-xor t6 s7 a2
-sltiu gp s2 1209
-srai s11 a7 30
-xor t5 a7 a4
-and a2 tp gp
-remu t5 tp s7
-addi s0 t2 -1793
-add s7 s10 ra
-mulhu t3 t2 s4
-mulhu ra a7 s1
-sub a5 t1 s2
-slt t3 a5 gp
-sra s8 s7 a0
-divu t6 a6 s1
-sll s9 a2 a5
-srai a5 gp 8
-divu s7 a7 a5
-addi a0 a2 -554
-sra gp a5 s4
-and a4 a4 a4
-ori a1 s10 -788
-slli t1 s10 27
-sub s2 s5 s5
-sub a3 s10 t1
-mulhu s2 s11 t5
-ori s9 t5 -119
-srai t4 s5 15
-xori x0 x0 -1304
-mulh s10 x0 a7
-mulh a2 a1 a3
-mulh tp s7 s9
-sra a7 x0 s7
-slt s4 s11 t6
-sltu s8 s10 s7
-sub s5 x0 s8
-slli s7 s8 6
-remu a2 a2 a2
-xori x0 s9 1379
-xor a6 t2 s11
-lui t3 400167
-addi s11 x0 -463
-add a2 a3 x0
-mulh a5 t0 x0
-andi a1 a2 1695
-divu t0 t0 a1
-sub gp s5 a3
-mulhu a4 ra a1
-srai s7 s11 24
-andi s10 s6 -388
-auipc s8 993731
-and s0 a4 s4
-srl t5 t2 s10
-andi a6 t3 -1385
-and s0 a2 t4
-xor t0 s2 s8
-and gp t5 s0
-mulhu x0 s6 s4
-divu a3 gp t2
-mulhu s5 s0 x0
-sub s2 s1 a6
-auipc a6 868177
-mul a3 s4 t4
-slli s11 a0 2
-srai ra a5 21
-slti s8 a7 -1865
-sll t1 s0 a4
-sub a2 a6 s1
-xor tp a6 gp
-mulhsu s2 s11 s0
-lui t6 14854
-divu gp s8 s8
-slt s8 t4 t2
-divu t6 a2 t1
-addi s6 t4 -71
-srli a5 s10 30
-divu a6 s3 a2
-rem s9 a5 a7
-rem s1 a7 a5
-mulh s6 t5 s8
-remu x0 t5 a2
-mulhsu t0 s8 a6
-remu s1 t2 a3
-remu s8 x0 s7
-mul a7 a6 s11
-srai a3 x0 8
-mulhu s10 ra x0
-srl t1 t6 t1
-auipc a4 314912
-sub s7 t0 s3
-xori tp ra -1419
-mulhu ra t3 x0
-divu ra s7 a4
-lui t2 242064
-slli s5 a6 28
-srli a3 s3 23
-slt x0 a5 t2
-or a1 a0 s2
-rem a6 s7 a1
-auipc s2 571350
-divu t5 s1 s0
-sra s8 a3 s0
-slli gp s4 6
-slli s6 s0 1
-slti tp a0 -1519
-divu a3 s10 a3
-addi s7 s11 2038
-slt a4 a3 s3
-slli s3 s10 29
-addi t5 a4 -250
-add a1 t5 a2
-andi t1 t4 -29
-xori x0 a7 -155
-div gp a7 ra
-add a5 a6 t1
-divu x0 a1 t4
-auipc tp 187345
-or s9 t4 a7
-slt a4 s8 s9
-slli s6 x0 10
-andi a0 s7 -120
-or a2 a7 s11
-srai s10 s9 22
-rem s6 s10 a7
-andi t5 s9 -1176
-andi s0 t6 -356
-slli t5 ra 18
-divu a3 a6 a7
-auipc s6 652577
-srai t1 s1 0
-sra s0 a3 s7
-sltu t3 x0 s5
-mulhu gp a7 x0
-srli a2 t1 7
-and a0 t1 ra
-mulhsu x0 s2 a6
-remu a3 s10 s11
-sll a5 a2 t0
-or s3 a3 s8
-srli s4 t0 17
-mulhu t5 t4 s6
-ori s4 a0 2046
-slti x0 s10 74
-auipc a6 156693
-sltu t1 s9 x0
-remu s8 s6 gp
-lui a3 52225
-auipc a5 1024521
-ori s3 s3 -1779
-xor a4 a5 s0
-ori s10 s10 -20
-and a2 a2 t4
-slli s3 a5 22
-auipc s10 789898
-sra t5 t3 x0
-xor a4 a3 t2
-xor t3 t0 ra
-xor t6 s8 s6
-mulh s8 t3 t1
-srai s9 s1 2
-remu a5 gp gp
-srl t6 t6 s6
-sra s8 a2 a0
-add a4 s9 t0
-add a6 x0 ra
-sltu s10 ra s10
-div s6 s3 s9
-srai ra s9 30
-sltiu gp a3 1202
-slti s6 gp 1115
-rem a4 s1 a5
-mulhu gp t4 s10
-mulh a5 t6 s11
-ori a1 x0 -2008
-sltiu t3 s2 192
-sltu s8 t3 s8
-remu t4 ra s11
-srai s4 s10 2
-lui t0 374462
-sll s5 t4 s10
-xori t5 a3 1599
-slt a7 s4 s10
-addi t2 s3 -153
-divu t6 x0 s2
-srl tp t5 a6
-slli a2 s1 29
-add t3 a2 a5
-sltu t2 x0 t1
-srl t5 t5 a3
-srl a2 s7 t2
-lui s11 137653
-sll t4 t0 t3
-sll t6 t1 s3
-srli t6 a5 21
-sra ra a0 s11
-sltiu a7 x0 1495
-xor t1 s10 t2
-mulh a2 s6 t0
-srl a2 a5 a7
-add s11 s11 s2
-xori a3 s1 -1034
-mulhsu t5 a2 ra
-srai a0 a0 24
-sra tp a3 a1
-slti s3 s1 -939
-slti s1 t4 -699
-mulhu x0 s1 a7
-sub s10 s11 s4
-lui gp 821177
-sll s9 x0 t2
-and t6 t6 a1
-div s0 t1 x0
-and s5 t1 t0
-and t4 x0 a3
-slli s3 s8 29
-ori x0 s5 -1496
-srl t5 gp a1
-ori t1 a4 -744
-sltu ra a5 s2
-sra s6 s2 s1
-lui s5 803007
-xori a6 gp -1802
-div a4 gp t5
-srai t3 a0 19
-sltu ra s9 gp
-mulhsu x0 t1 t4
-sll s0 s9 s1
-slt s8 s3 a2
-xori s6 t6 -1597
-mulhu t5 s8 s8
-sra s1 t0 s7
-auipc t3 437238
-and t4 a6 a4
-and a3 s2 a6
-slli s0 t5 10
-sll a0 s7 gp
-add a4 s9 s9
-slti a5 a4 -733
-xor tp ra t6
-remu s5 t5 s0
-addi s3 x0 -1450
-srli s10 a2 16
-divu t4 t5 s5
-xori t2 a2 -1788
-add s8 s2 s5
-ori a4 t4 -1910
-div a1 x0 s8
-divu a6 s9 tp
-xori x0 x0 1827
-sll s10 s9 a3
-mulhu a7 t6 s4
-xori a2 a3 -93
-sub t4 a6 t6
-ori x0 x0 -1635
-lui t3 476226
-srli s7 t2 23
-sra s4 x0 a6
-slt a3 t2 t5
-slti a5 a2 -740
-mulh x0 tp t6
-divu s7 s2 a0
-auipc x0 760754
-andi s8 t0 1443
-sra a3 t3 s7
-sltiu a3 a7 -1707
-srai s6 t0 7
-auipc gp 611416
-div t1 s6 a1
-or s10 s3 t3
-remu a0 t3 a3
-mulhu t3 t2 s10
-or a5 s5 x0
-sltu t6 t5 s3
-and t1 gp t2
-ori s6 tp -1694
-slti x0 s4 -299
-sub x0 a7 a1
-sub a2 s5 s11
-auipc gp 490845
-addi s0 s0 -643
-sra tp t0 s5
-and s9 x0 s0
-sltu a4 tp t4
-andi a4 a5 -1611
-andi t2 s1 805
-mulhsu x0 x0 x0
-sltu s5 a0 a1
-andi s4 a2 -474
-srai a5 a5 17
-add t6 t1 s3
-auipc x0 51769
-mulhsu t6 a4 s5
-and s3 a3 s1
-and s11 ra s8
-slt a2 s1 a2
-srli t3 tp 7
-remu t1 a5 s4
-addi tp gp -1141
-remu a1 a5 t2
-srai a6 gp 28
-rem s8 a4 t6
-mul s7 s9 t5
-xori s7 a3 -1574
-divu a1 t5 tp
-div a1 a7 t5
-sll s0 a2 s2
-sra s5 t2 a1
-remu t5 s0 a4
-srl a1 ra x0
-mulhsu t0 t4 s4
-slti t1 a0 -767
-and gp s1 t6
-mulh a0 a2 t6
-srli s6 s10 6
-auipc t1 913083
-rem t6 a4 t4
-lui a7 602246
-mulhu s9 s2 t4
-sll a3 s1 a3
-slt s0 tp t5
-xor a6 t0 x0
-remu tp s9 t2
-andi x0 a0 -611
-xori s3 a7 -1459
-divu a3 ra s5
-sub s6 s11 a5
-sll s8 t3 s7
-mulhsu s6 s7 tp
-mulhsu a2 t1 a1
-rem s8 ra s7
-andi s11 t2 668
-sra t0 t6 t5
-andi a0 s0 -931
-sltiu s3 t0 -698
-auipc a5 174585
-slli s7 tp 5
-divu a5 a1 s8
-lui t5 844495
-sub s3 a6 s8
-add t1 x0 t5
-sll a1 gp s9
-srl ra t4 t0
-srli a3 a4 7
-sltiu x0 s5 1637
-sltiu s5 s7 909
-xori a0 s5 487
-xori s6 t5 -571
-sra s3 s0 a1
-slt t0 t1 x0
-xor x0 s0 s2
-slt t2 s5 a1
-remu a1 t5 t3
-sltiu s2 a1 -447
-sltu x0 a1 t0
-srli gp a2 7
-and t1 t6 s5
-add a3 a4 t0
-or s6 s5 s2
-mul t0 ra t2
-sltiu s8 s0 -1029
-srai s3 s6 15
-divu t4 s10 t4
-sltiu ra t4 1661
-sra a5 s8 s9
-srl a6 gp t3
-xor t5 s1 s4
-lui x0 924791
-addi x0 ra -1824
-srl t0 tp s5
-remu t0 s3 s9
-srli s3 x0 24
-divu a7 a3 t3
-sra t6 s4 t1
-rem s3 a6 x0
-srai s5 t5 9
-xor s7 s11 s9
-slli a6 a3 6
-addi t1 a0 -1901
-slli tp a4 9
-srai a2 s4 24
-auipc t0 275415
-sltu t6 s9 t6
-slt a1 s10 x0
-slti t4 s5 -1567
-xori a0 s5 461
-mulh a6 s5 t2
-sll a2 t3 s11
-rem t2 s1 a5
-add a6 t2 s7
-sltiu a6 s5 -1602
-ori s11 t2 -1993
-and s6 s1 s3
-mulh a7 t3 t3
-sltu s0 s0 s9
-ori t6 a1 -1333
-lui t1 515758
-remu s5 t0 t3
-xori x0 s0 -1783
-divu t5 s10 s0
-remu gp s7 a1
-div s9 s7 a6
-rem ra t5 s5
-slt a5 t3 t5
-rem s1 s4 a1
-auipc t2 309911
-xori a3 a5 623
-mulhsu s4 t4 s9
-andi gp a5 -669
-mulhu s5 s1 s0
-rem s4 s8 a4
-add a4 a0 t1
-add s8 ra a3
-remu t4 a1 s11
-xor t1 s5 t1
-ori s4 ra -991
-srai s10 a2 11
-div t3 t1 a2
-slli t0 s3 6
-mulhu s8 a7 s5
-sltu t5 s8 tp
-srl s2 s9 s1
-slli s10 x0 18
-slli t4 a2 7
-xor tp gp a2
-div t0 a3 s2
-xor t3 a3 s2
-andi a1 a5 -359
-lui t6 592841
-slti s11 t4 223
-srai a6 ra 7
-sra s4 a6 gp
-srli t5 s1 12
-div t0 s10 x0
-add t1 t1 a1
-addi t1 a7 -230
-ori gp t5 1191
-remu a3 s9 s5
-mulhu s3 s8 s7
-xor a0 s5 t1
-slli t0 a7 22
-and s9 t3 a2
-xor t6 a4 s0
-add gp s5 a3
-xori t1 s6 -1599
-or s1 a2 t2
-sra s6 t4 s11
-mulhsu x0 a5 s9
-mulh s3 gp ra
-xor a5 a3 a0
-srai a7 a5 8
-xori a4 a7 -1701
-srl x0 a2 t0
-div s5 gp t2
-srai s9 a5 17
-and a6 s4 t4
-div s4 t2 s0
-sltiu tp s2 28
-srli a0 gp 9
-rem a1 t2 a2
-sra a4 s1 t2
-srl t0 x0 t0
-xori s11 t0 -1815
-sub ra t4 a1
-sra a2 x0 s1
-auipc s5 353880
-mulhu a0 a1 s8
-xor ra a3 t1
-remu a5 ra s9
-slti s2 s1 -407
-slti s7 s6 -559
-remu a3 ra s10
-ori s6 t5 -633
-andi t4 t1 1354
-or x0 a6 a4
-xor s3 s9 s10
-addi a5 s6 323
-sll s1 t4 s6
-remu a2 s9 s3
-auipc t2 479839
-srli a6 x0 11
-srai a7 t4 28
-sll a0 s7 a5
-xori a7 t4 -967
-lui t4 986817
-slli s4 a7 12
-mulh a3 a3 x0
-mulhsu a4 s6 a5
-mulhsu a3 s3 a1
-or x0 ra s11
-divu a2 s11 x0
-andi a7 x0 1214
-xori s4 a0 -211
-sltu a1 a1 s6
-or t3 t1 s3
-xor t5 s1 a1
-ori t2 s7 449
-mul s3 a0 tp
-srli s8 a3 0
-addi s4 s2 1439
-mulh s11 a5 tp
-sltu x0 t1 a4
-sra a4 a3 s4
-or a0 s6 s8
-mulhu a4 t3 a1
-addi s10 gp -1765
-remu t4 t4 a7
-mulhsu s0 gp a4
-sltu a1 a7 t2
-remu s5 a5 x0
-sra s8 s8 tp
-and t2 s0 s4
-div s1 a1 s9
-srai t1 t5 8
-sra t2 a0 t5
-srl s8 a1 s3
-add gp tp ra
-sub ra t2 t2
-add ra t5 t0
-mulhu t3 a7 t5
-addi s2 t1 1461
-rem a6 s4 s5
-andi ra gp -1563
-srl s10 x0 x0
-mul a3 s0 t2
-mulh t5 ra t4
-andi a6 t4 -1939
-div a2 s3 s3
-sll a1 a3 t5
-xor gp s11 gp
-mulhsu s11 a0 s11
-xori a2 s4 -1675
-auipc t0 101297
-srli s3 s3 18
-auipc a2 883478
-andi s1 s9 441
-rem t1 s3 s7
-slli t5 a0 26
-xori s11 t1 -1348
-xori gp a6 1737
-or gp t3 ra
-sltu s1 a1 s9
-mulhsu s2 a6 a3
-mulh tp a0 t5
-srli s11 t4 16
-andi s5 a4 -1388
-rem s11 a5 a2
-srli x0 a4 9
-addi a1 a7 -579
-lui t3 708990
-srai gp t0 6
-slli t4 s1 16
-mulh s6 x0 s2
-mulhu s7 t1 x0
-sltu t2 s0 s8
-lui s0 715032
-mulhu s3 a2 s4
-sub s1 s1 s6
-addi s9 x0 -1591
-mulhsu s7 a2 t6
-divu s9 s5 s5
-slt s0 s4 t6
-div s5 a2 a1
-add s10 x0 tp
-srl s8 a5 a7
-xor t0 a3 a7
-auipc s0 319007
-div t0 s9 s2
-mulhsu s10 t3 a6
-divu s4 x0 s0
-divu s5 a3 a3
-srai x0 gp 23
-sra a4 s3 s1
-auipc x0 601068
-and ra s0 a4
-remu s9 tp s5
-mulhu s0 x0 s5
-sra a1 t0 t2
-addi t5 s4 1934
-xor s2 a0 t4
-mulhsu a1 x0 s4
-divu a3 s9 s1
-sltu t2 t4 s10
-sra s5 s4 s9
-mul ra ra t5
-srli t1 a6 28
-lui ra 857679
-lui a4 153195
-sltu s6 x0 s4
-sll a5 s7 a0
-mulhu t2 s5 s4
-srai t0 a7 3
-slti t0 t6 -817
-xor tp ra s6
-sll t3 t2 x0
-and a3 s9 s10
-andi t6 s5 -114
-xori s5 s0 -211
-or s0 a6 a7
-slt a0 t2 a6
-sll t5 t3 a1
-rem a6 t5 a4
-sub a5 s2 s2
-mul t1 x0 a7
-slt a6 tp s7
-sll t0 t5 x0
-xor ra t1 s9
-mulhu t5 s10 t5
-slli a5 a0 0
-slli s10 a0 23
-srl a7 t1 s10
-slt t1 a6 s7
-auipc t2 208115
-ori ra t2 -1640
-mulhsu t3 gp s9
-slli t5 a5 31
-xor s1 s0 s9
-mulh s10 s9 t1
-xor s8 a4 t1
-divu a4 a6 t4
-slli gp gp 15
-slt gp t0 a4
-slt gp a2 t4
-add a7 s8 a4
-mul a1 t2 a6
-divu t3 a3 tp
-srai s2 s11 11
-xor t5 s1 a0
-divu t0 t4 a4
-divu a2 s1 s11
-add s5 a3 s1
-ori x0 s5 -1346
-addi t0 t2 1594
-xor x0 a7 gp
-andi t0 a1 -287
-sltiu t6 a4 1433
-slt s8 a0 s5
-sub t2 s1 s1
-lui s7 552198
-or t4 a2 s8
-sub gp s7 x0
-rem t6 s3 t1
-rem s1 a6 s5
-mulh t6 t2 s11
-sltu gp x0 s4
-ori a1 s7 -378
-mulhu a6 a6 x0
-rem s1 s7 gp
-mul s5 a4 a1
-lui s4 338870
-mulh s9 s0 tp
-mulhu s7 a0 t2
-mulh s0 a3 t1
-ori t2 s0 104
-sub s2 t6 a0
-srli x0 s7 8
-and t2 s4 a7
-slli t1 t6 11
-mulhu t3 s9 s7
-slt a2 s6 s11
-rem s4 s9 s1
-srl a6 s2 tp
-or a5 t0 s2
-mulhu gp s5 s7
-srl t0 ra a1
-and s0 t2 a1
-xori t3 s0 -1082
-slli t4 a7 29
-div s4 s3 s4
-srl gp a0 a5
-mul a1 s4 s9
-addi x0 t2 1682
-addi x0 s0 1678
-slt a0 s9 a3
-auipc t1 738628
-slt a4 a0 a2
-rem a4 s4 gp
-andi t0 s8 -247
-ori a3 a2 1092
-add s3 t1 s9
-or t5 x0 a2
-slt s3 s1 s3
-add t3 a4 ra
-srai a4 s11 27
-add s8 s2 s3
-divu t2 t6 x0
-sra s0 t1 s3
-rem a7 s3 s8
-sub s9 a0 ra
-mulh a5 a5 a4
-slli s5 s2 8
-sub s6 t1 s8
-mul a4 s3 s8
-addi a4 a4 997
-sll a2 a4 a0
-srai ra x0 3
-slli a3 a2 0
-sltu t4 t3 a7
-sra t6 t6 x0
-ori s2 a5 -2039
-slli a5 t2 25
-slti s5 s4 53
-sltu s1 t2 a3
-or s7 a1 s3
-slli t4 s7 13
-mulh s3 t0 a5
-sll a7 t3 gp
-remu gp t6 s7
-auipc t3 1026586
-mul s9 s2 tp
-addi a2 s3 -1316
-div t4 a4 s3
-slli s3 s3 7
-sll ra ra t2
-sub x0 t1 t2
-srai t2 x0 4
-or t4 t3 s3
-xori s8 s2 -547
-slti s4 s7 -894
-addi s9 ra -467
-ori s0 a6 -1049
-srl s1 s2 s11
-srli s11 tp 14
-and t0 x0 t5
-auipc t2 527648
-mulhsu t6 x0 s7
-lui s4 995483
-srli s5 s5 3
-rem a5 t4 tp
-rem a6 a5 s3
-mulhsu s7 t6 t5
-xor s7 s1 a3
-divu t5 s6 s9
-div t5 s7 s6
-slt s1 a4 s5
-ori x0 t4 -254
-srli t3 t1 9
-sub tp a3 s1
-sra t2 t2 a7
-xor a3 s9 s10
-sltiu a7 s1 -1232
-xori a0 a0 -728
-sltiu s1 t5 -1002
-lui t1 492374
-rem a1 t5 s5
-slli s9 tp 14
-srl t4 gp s4
-divu a7 s11 a0
-add a2 s3 ra
-sll a1 s4 a4
-ori s6 t2 -1224
-slt s5 ra t2
-slt s4 t1 t6
-lui ra 754664
-srl t5 s7 a1
-and t5 s10 a3
-srai a6 t1 9
-sra a6 a7 a6
-slli t3 x0 0
-srli tp t5 6
-sub t4 t4 gp
-rem s7 s5 s0
-sltu a1 a1 a4
-or a1 a1 s9
-xori s3 gp -700
-sltiu a6 a5 -165
-add s1 a0 ra
-mulh s6 s2 t3
-ori t1 s3 -1484
-and ra s4 s9
-sub t5 a0 t5
-sltu a1 s0 s4
-mulhu gp t4 a3
-ori a0 t3 -1877
-ori s11 s6 1204
-div a3 a0 s8
-and s1 gp t5
-andi a7 a5 -339
-ori a5 t6 -1703
-mul t6 s8 t2
-addi ra s1 776
-auipc t3 815345
-sltu t5 s11 a2
-slti t2 tp 599
-divu t3 a4 a1
-mul gp t4 a7
-auipc s11 994356
-srli t2 s6 20
-divu tp a2 s3
-auipc s9 909269
-addi s9 s7 -545
-rem s7 tp s7
-sra a5 s2 t0
-lui s8 6677
-div t0 t5 tp
-mulh t0 t3 s1
-srai s3 s9 25
-sll s0 a4 s1
-slt gp s11 tp
-sra s4 s6 tp
-mulhu s11 a4 s11
-xori tp t6 -591
-andi t5 s9 -727
-auipc t5 661750
-auipc t4 483128
-sltiu t1 t3 1495
-sll s11 a3 s6
-div a0 s2 a7
-srli s11 s6 25
-slti s6 s4 -1656
-rem s3 x0 a4
-sltiu a7 s4 1369
-add t6 t6 x0
-slli s2 a1 30
-sll t5 s6 a4
-or s7 a5 a2
-auipc s0 695442
-slt s3 s2 s2
-mulh gp s9 s3
-lui tp 175561
-ori gp s6 -1944
-sra x0 a4 s8
-and s11 a5 t6
-srl s4 s0 t1
-sub a4 s8 s0
-slt t5 x0 s1
-slti a5 t0 178
-slt s0 s4 a5
-remu tp a7 a7
-srli s7 a0 16
-ori s11 t3 -148
-xori t6 a7 -52
-andi s0 x0 2039
-slti t6 s8 -219
-add s6 s5 ra
-xori t1 a3 -502
-sra s10 s4 s7
-lui a1 870446
-and s8 t4 s5
-addi tp a3 99
-xor t2 tp s9
-auipc s8 865776
-mulhsu s4 s6 s1
-sltiu t1 a6 646
-rem s3 t6 s10
-mulhsu a7 a2 t5
-auipc t5 351099
-andi tp s8 391
-rem x0 a0 tp
-slt s8 s4 a1
-ori a6 s5 -1153
-xor s0 s0 t4
-sll ra t5 x0
-sltiu ra t1 -1982
-rem t1 a0 a6
-div s9 s9 a0
-srl t1 a5 t5
-lui t0 989465
-srli a7 s3 11
-slti s10 a6 82
-slti s4 gp -632
-slti t3 s11 -1826
-mulhsu s8 t3 tp
-sltu a7 t1 s11
-divu s4 a4 t6
-auipc s8 520242
-add s5 a1 t0
-divu a4 t3 s8
-mul a2 s7 x0
-sll s3 s8 s7
-slt t1 a1 s11
-div s2 s6 a0
-remu a4 a7 t1
-srli x0 s2 20
-srli s6 s1 13
-mulhsu x0 s9 a0
-andi s11 s5 -80
-sltu s6 s2 t1
-auipc t2 490973
-addi s10 s2 -283
-add a4 s10 t2
-xori t2 s11 -1532
-srai a4 s0 1
-xori t1 s1 824
-auipc a0 603150
-mulh ra s4 gp
-sll a3 ra s4
-mulh t4 s1 s8
-auipc s9 67964
-sra a6 a5 a4
-divu s1 t2 s4
-sltu a1 a2 t5
-add s10 a3 a3
-mulhu a2 a7 ra
-and t5 s5 a7
-or a4 s0 a0
-remu t5 a0 s11
-xor a2 a1 s10
-slt a2 a2 t2
-auipc t0 102879
-mulh t4 s7 a3
-sra t5 s3 a3
-srai a2 s0 21
-divu s7 t4 s6
-add s5 s4 s4
-andi t1 s2 -1314
-sltiu t5 s7 -1663
-sll a7 s7 a6
-lui s9 504339
-divu s6 x0 s6
-auipc tp 133100
-sub s10 s3 s5
-lui s0 651164
-rem a7 t0 a4
-mulh gp s11 s5
-mulhu t3 s6 t4
-ori s8 t2 -82
-slt t1 x0 x0
-sll s0 s1 tp
-mulhsu a4 s6 s9
-slti s0 s4 241
-srai t1 a1 9
-sub t2 s9 t4
-auipc t5 221976
-xor s3 s9 s8
-ori s9 t4 1759
-and a7 s1 a2
-addi a7 t6 -885
-add s11 a4 gp
-srai t0 x0 24
-srl s3 x0 s2
-slli a7 s11 26
-mulhsu s3 s6 s5
-mulhu a2 t5 tp
-mulhsu t0 a3 s3
-xor gp s9 a5
-slti t6 s2 -1231
-lui a7 119212
-addi s6 tp -1827
-sub s7 x0 t5
-or a3 a6 s0
-mulh s5 a3 s6
-sub s2 s1 a1
-slti a4 s4 1183
-auipc a3 893986
-xori s9 x0 -376
-ori t5 s4 1734
-rem a7 s3 s5
-sltiu a0 a4 476
-sltiu a7 s9 -1862
-addi gp a7 -960
-remu t0 gp a5
-srl t5 t3 x0
-srli a1 a2 18
-addi s8 x0 456
-sll s9 a7 s1
-remu a3 s4 gp
-mul t6 t6 a7
-div x0 ra t2
-and t6 s7 t5
-divu s5 t1 gp
-srl a7 x0 a4
-addi t3 s8 -1039
-mulhu t0 s5 a7
-sll t0 ra s4
-rem s0 a5 s1
-remu a5 s8 s9
-slli a4 s1 26
-srai t4 a1 22
-add a6 s7 t5
-mul t4 t0 a0
-srai s10 s10 8
-mulhu t4 s9 s5
-sltu t0 x0 ra
-div ra a1 a5
-addi s5 a7 -567
-mulh t5 s3 s7
-slt a0 s10 x0
-slt x0 ra t3
-srl s4 a6 ra
-addi t3 a1 -1794
-mul ra s1 t0
-lui t1 177048
-slti x0 t2 -196
-srli x0 tp 18
-auipc tp 310511
-mulh a6 s2 s0
-div t0 s1 s5
-sltu t0 gp x0
-remu ra t4 a2
-srli t2 a7 27
-auipc t0 95000
-srai t6 a5 0
-mulh s6 x0 s7
-xor s6 s7 x0
-andi x0 t0 202
-remu gp s3 s10
-add ra s11 s2
-sltiu t3 a2 -1536
-xor s1 s9 s6
-mulhu s1 x0 a6
-lui x0 757179
-addi a4 a6 -1284
-andi tp t6 -193
-or a7 t2 s6
-sll s7 t5 x0
-divu s9 a2 t4
-srl t4 a7 a0
-slt a2 t2 ra
-sll s6 t0 s0
-sltiu t1 s9 1896
-and s5 t5 t6
-xor s11 s4 gp
-mulhsu s10 a4 a1
-slt s9 a1 gp
-ori s8 s1 -1156
-addi s2 t5 -241
-lui s6 686092
-or s5 t1 x0
-slli tp t3 8
-lui a6 418789
-and a6 t3 a2
-sltiu s5 a1 860
-auipc s0 344738
-srl gp s5 a1
-srl a6 t0 tp
-lui t1 945952
-slli a2 tp 20
-slt t1 a4 a1
-srl a7 t2 ra
-srai s6 x0 13
-sltu x0 gp s5
-auipc s0 907460
-addi tp s9 -887
-slt t2 x0 a3
-and s4 ra a6
-mulhsu x0 s10 a4
-add s9 a1 s2
-sra x0 a6 a0
-sltu s2 s3 s6
-sltu t1 x0 s4
-xor t1 s11 s2
-ori a0 s9 -523
-mulh s8 s11 a7
-auipc s5 903637
-srl t0 a6 t5
-mul a6 a6 s6
-srai a2 s11 26
-mulhu s0 s11 s5
-srli s6 t0 7
-auipc t2 407497
-addi s5 gp -149
-mul s8 s9 ra
-xori t5 s11 -394
-slti s3 t2 415
-xori s4 t1 -234
-srli tp s5 11
-slti t4 s9 -1300
-slti a2 s4 50
-rem x0 s10 t4
-mulhu x0 s11 t4
-srai t3 x0 1
-mul a0 a3 s0
-xori t5 x0 -925
-slt x0 a5 a5
-ori s3 a5 1682
-remu s0 a4 a6
-and t2 a0 t6
-xori t1 s5 -1040
-and a5 x0 x0
-slli s9 a6 20
-addi a3 t2 1530
-sra t2 s11 s1
-sub a7 s3 s10
-or t4 s5 a7
-div t2 s10 t2
-srli a3 a3 3
-or a0 s1 a1
-xor x0 x0 a3
-andi t3 a0 791
-addi s0 ra 1773
-div s1 s3 s6
-sll s1 gp s11
-srli x0 a0 5
-sll t2 s1 s10
-lui t0 800354
-auipc t2 227850
-mulhu t5 t0 s3
-sra s11 a7 s6
-slt s4 s4 a0
-srl s5 s5 s9
-rem s5 a4 t3
-sra s7 s10 s10
-divu a0 t0 t2
-sltu a0 t3 s4
-add s1 s5 t4
-add a3 s1 gp
-slli s11 t1 5
-auipc s9 244771
-ori s9 s10 -1256
-div s3 a4 tp
-rem t6 s7 gp
-slli s8 s8 30
-lui a4 179316
-xori s3 a6 -1570
-srai s6 s1 19
-rem s3 s3 s5
-add a3 a7 s5
-slti ra s6 -1282
-ori s5 t2 492
-ori a1 t2 -533
-xor s11 t2 ra
-lui ra 869518
-ori a4 s4 1942
-sra s4 s7 a4
-xori s10 a4 880
-xor a2 s11 x0
-xor s3 a0 a5
-ori s5 tp -526
-andi tp x0 -1784
-addi s4 s9 -1621
-addi ra x0 -263
-addi a0 a4 -202
-rem x0 a1 t1
-mulhu s7 s10 t1
-sltu a1 ra s7
-xori t5 a1 -44
-sltu s3 s3 s5
-xori a7 t0 -1807
-ori gp a1 -1670
-mulhsu s4 a7 t1
-xor x0 s4 t2
-andi s6 a1 1112
+ori s7 s4 2005
+ori a3 a1 -34
+andi t3 x0 1360
+sltiu ra t5 -36
+and s7 t2 s9
+and a0 a3 a1
+andi s5 gp -1669
+andi s0 tp -161
+divu a5 gp s9
+sll a7 a0 t4
+andi a3 x0 -1428
+xori s0 s6 -1958
+addi a2 a1 962
+mulhu s4 t2 s11
+auipc t0 335434
+remu a4 s2 s6
+srli s4 a2 14
+and s6 a4 t6
+slti t1 a1 -1490
+and t1 t2 t3
+srai a3 s1 0
+lui t1 676705
+sltiu t2 a0 1019
+mul s7 s0 s9
+sra t3 t3 s11
+lui s10 71769
+divu a7 a6 s8
+slti a1 s6 1770
+slli t4 t5 21
+mulhu s8 gp a7
+xor t4 s0 t4
+andi s1 s8 974
+andi t5 a6 -311
+xori s3 s3 316
+lui a4 157358
+mulhsu s7 a3 a7
+srai s8 gp 9
+addi a7 a3 -172
+sub a0 t6 x0
+ori a2 a5 -811
+sll a5 a4 s9
+andi s5 ra -1964
+sll s6 s5 s8
+or a2 a5 s8
+slli s10 a6 13
+divu x0 a7 s5
+add tp s8 s10
+sltu s10 s0 t1
+sltu a4 s4 a3
+srai s11 s6 30
+mulh s0 a3 a3
+mulhsu s8 a7 a0
+and ra tp s11
+srl s4 s9 gp
+mulh a4 a7 x0
+slti t3 s2 -838
+or a7 s10 s6
+xor tp s10 s3
+mulhsu s10 a7 t1
+divu a2 t4 gp
+ori t3 s7 885
+slt t3 t5 a5
+srli t6 s2 24
+or t5 tp a2
+sltiu a5 s2 -1606
+rem a0 t3 a7
+andi s0 t2 -1393
+mulh s8 a2 t1
+sll x0 s6 gp
+mul gp gp a4
+mulh a0 a2 t4
+sltiu s7 a7 1176
+sltiu a6 a3 1240
+and s5 s9 t1
+div s8 a5 a0
+andi a2 a6 -1055
+sll ra s10 a7
+sltiu a7 a0 -60
+sra s5 a7 s4
+auipc t5 892487
 mulhsu t3 s1 a2
-or a2 s11 x0
-sll a0 s5 s2
-mulh a7 t5 a0
-sltiu s11 t0 -131
-mulh s1 s7 s5
-auipc s0 619854
-remu x0 s2 a6
-slli t0 s6 12
-and t1 a0 s11
-div s3 s7 t1
-ori t5 t3 -1870
-auipc a0 878946
-add t1 a4 a0
-sll a2 s5 s6
-and s2 s2 s10
-sub s9 s8 a0
-div s11 t0 a7
-sll s8 gp a6
-div s0 a6 a7
-auipc a2 340676
-addi t4 t1 1805
-sra s9 s11 t3
-sub a6 t1 s2
-xori s7 s2 -1130
-divu s4 t4 x0
-lui s9 542666
-sltiu s9 t0 1016
-mulhsu s11 a3 s9
-or s3 t6 x0
-ori ra gp -1899
-or a1 x0 s10
-or x0 a1 s10
-auipc t4 550761
-div s8 tp s7
-rem a1 ra t2
-srl t6 a5 a5
-div s5 s11 a2
-mulh s8 t4 s7
-xor x0 x0 s1
-mulhsu t6 t5 t2
-div a1 a0 ra
-sltiu a5 gp -109
-addi t5 s11 370
-divu tp tp t6
-mulhu tp s11 s1
-mulh t2 s2 a2
-sra t3 t3 a2
-mulhu x0 s6 ra
-and t1 gp t1
-auipc a7 751227
-mulh s6 a2 x0
-sltu a6 t4 s1
-slli s0 s8 31
-sra ra s2 a7
-addi s11 s10 1150
-div s4 s3 s5
-slti t0 a1 -1290
-mulh t2 x0 s0
-slt s9 s10 tp
-slti s3 t4 -788
-srai s4 s11 16
-sub s6 t5 x0
-slti s0 a1 -1194
-srai s5 a5 12
-sll x0 s10 t3
-mulhsu a0 t3 t5
-sra tp a6 x0
-mulh t2 a0 a7
-rem a1 s1 x0
-mulhu a2 gp a3
-auipc t2 658295
-divu s3 a4 t6
-slti s2 a6 1664
-xor s11 ra x0
-or s0 tp gp
-sltu ra s2 s3
-xor s4 ra s1
-mulhsu a6 s4 tp
-srai ra gp 24
-lui a1 770152
-slli s4 a6 27
-sltiu s10 x0 -1653
-and a1 s1 a4
-sll gp s11 x0
-mulhsu a4 a1 s8
-auipc s0 279744
-rem s4 t0 t2
-addi a3 t2 1653
-auipc a7 264725
-remu a6 t4 s0
-slti a2 s1 1847
-mulh s4 a1 t5
-rem t5 t6 t2
-sll a2 s3 x0
-mulhsu s0 s7 x0
-lui a7 941095
-auipc t5 459928
-slt s6 s5 x0
-divu a6 s6 s9
-add t5 a5 s0
-add a4 a1 gp
-slti s0 t4 -537
-divu x0 gp a4
-and a3 a6 s10
-and a7 ra tp
-srli x0 a4 2
-slli t4 tp 19
-srl t6 a4 x0
-slti tp gp -80
-sra a5 t0 s7
-mulh t0 a2 s10
-sub t6 s8 a0
-srai ra t1 11
-srai s8 s5 11
-srli gp a5 21
-slti s0 s11 -349
-ori t4 t6 679
-srai a5 t1 16
-addi s5 ra -1036
-mulh a0 a1 s1
-mulhu a1 s6 a3
-mulhsu x0 tp t6
-sltiu s5 s0 -588
-mulh s4 t5 x0
-add a1 t4 s11
-or s5 s7 s10
-andi s3 s8 -704
-ori s11 a7 1667
-mulh a7 t2 t1
-slti a3 t1 -870
-srl s7 tp tp
-rem t6 t3 s9
-lui a1 518439
-lui s2 1029808
-sub t5 s7 t6
-mulhu s2 s4 s4
-lui s9 336942
-slti x0 t2 -134
-slti t6 t2 -278
-sub s0 x0 s4
-slli t6 t4 9
-andi s4 t5 -151
-ori t0 s5 -181
-sra t2 s5 ra
-xori s6 t4 -1427
-sub ra s1 a5
-sll a1 a3 tp
-sltu x0 a5 s11
-xor t0 s4 ra
-lui s7 402691
-addi gp a5 -905
-andi s1 s5 -1621
-xori t4 s0 -818
-divu ra t4 gp
-ori ra t3 -1521
-mulhsu t6 a7 a4
-auipc t1 875970
-mulhu a3 s8 s5
-and t0 s7 a7
-srli s5 t6 27
-addi s0 x0 -1688
-mul a2 t0 t1
-ori x0 a6 -1247
-mul a0 x0 t3
-sltu s2 s4 s10
-mulhu s0 a4 s2
-addi t6 t6 -1967
-slli t5 t5 29
-divu s0 s11 t6
-ori a5 a7 -1311
-add s11 a3 s3
-andi a7 s11 -1114
-sltiu a1 s1 1445
-xor s4 t4 t2
-and s1 s2 a2
-divu s7 t2 s11
-srai s6 s3 11
-add s2 s2 s3
-addi s11 t2 926
-and a7 t4 s5
-mul s8 a3 t0
-ori ra a4 33
-srli s7 s11 7
-divu gp t4 gp
-xor s1 t5 a4
-ori s11 s11 -226
-slt a1 a1 a4
-slt t4 t4 t4
-and t6 t1 gp
-remu a6 tp gp
-sra t0 t2 gp
-mulhsu tp s11 s11
-and a3 tp x0
-or t4 tp s4
-sltu ra s1 a2
-mulh a2 s2 s8
-divu t0 t6 s10
-srli t2 a4 23
-auipc a1 1040196
-srli a3 s0 16
-and a5 t5 x0
-auipc s1 106456
-slt a2 a2 s7
-and t5 s7 s3
-add t4 ra s8
-xori s6 a2 -926
-slli a6 s9 15
-andi t4 t0 1456
-slli a2 x0 4
-srli s10 t1 26
-mul t0 a0 s11
-sltiu a1 x0 -928
-addi a7 s2 -691
-andi t0 t4 1439
-mulhsu s4 a7 t6
-slli t5 t0 31
-sltiu s9 s4 -881
-srai s7 a1 7
-divu s8 t1 t5
-rem s2 s9 a6
-remu s10 s7 s9
-ori t6 s6 1828
-add t0 t3 s1
-sub a5 s6 s2
-or t6 ra tp
-slli a2 gp 31
-ori s0 a2 1837
-xor t3 a6 t0
-mulh tp gp t0
-or s6 s9 a6
-sub t6 s0 s7
-sltiu s8 s9 1346
-slti t6 a5 551
-auipc a4 801881
-or t1 gp t4
-div s11 ra x0
-srli s6 s0 10
-srai s7 s4 11
-slt ra ra t0
-mulhsu x0 a2 a2
-sub s4 s2 s10
-lui t1 318042
-sll s2 x0 s8
-mulhu t0 s5 s6
-slli s11 a3 11
-divu a1 a6 x0
-mulhu x0 a6 x0
-or s4 ra t0
-sll a5 x0 t6
-xori s7 ra 1017
-remu t0 a0 a7
-rem s11 s5 t1
-addi t3 s3 -1758
-auipc a3 1028833
-mulhu t4 t4 a7
-div s0 ra t5
-srli s9 s1 21
-div a3 t0 x0
-lui s10 471839
-remu t6 s6 ra
-mulhu t2 x0 a7
-mul a1 a0 a1
-addi a7 a4 -1742
-mulh a2 tp s5
-andi t6 a0 -838
-sra x0 t2 a6
-divu s7 s11 a4
-slli a5 a0 11
-andi a6 s10 -206
-and tp s1 tp
-srl t5 a7 a2
-ori x0 s4 72
-srai t6 t3 31
-rem x0 t5 s5
-div a4 s5 a3
-srai a0 a5 15
-div s7 gp a4
-divu t2 s6 s10
-mulhu s7 tp a0
-rem s0 t1 a4
-slli s3 s6 4
-rem s4 x0 t2
-mulhu t5 a3 gp
-lui t1 860220
-auipc t1 289433
-remu a6 a3 s6
-sll s6 s0 s2
-auipc s4 783402
-add s8 s3 s6
-auipc t2 330485
-mulhsu s1 t3 s9
-and a1 a3 t1
-addi a2 t3 -904
-srli s11 x0 10
-mul s10 t5 s11
-lui gp 537727
-div t1 t4 t2
-and x0 a6 a2
-and s7 x0 ra
-addi t2 t4 1830
-sltiu a3 s1 -1805
-sltiu s8 s5 -1503
-mulhu s6 a6 t3
-or t0 t0 s7
-slti a2 a1 -1172
-srli t1 s2 31
-mulh a1 s4 s11
-mulh a4 a5 s11
-div a3 x0 s10
-addi s3 t6 -1845
-sra x0 a2 t3
-rem t4 x0 gp
-ori s0 x0 -1265
-and s8 a0 s6
-mulhsu ra t0 s3
-sub a7 s9 s3
-xori x0 a4 -1362
-mulhsu s7 s1 a5
-add tp a7 a1
-xori t0 s2 -78
-sltu s2 x0 a7
-divu tp s6 s1
-srl s4 s0 t5
-xor tp t2 tp
-srl s10 s2 a2
-auipc x0 997958
-mulhu tp t0 s6
-auipc s4 561633
-xori a3 s2 -48
-mulh s3 s4 s10
-or gp t4 a0
-divu tp a0 a6
-andi s1 x0 -1154
-or ra s4 t0
-sll s8 s2 gp
-mulhu s9 s10 t0
-xori ra a0 -1501
-rem s1 s1 tp
-auipc t1 795277
-addi s5 t2 331
-sra s0 a4 a5
-srli s9 a0 2
-add a6 t6 s8
-addi gp t4 -660
-srli t3 a2 18
-and s3 s6 a3
-mulh s3 t3 s10
-slti s11 a6 -406
-mulh a3 s10 tp
-mulh s3 s6 t1
-ori s3 s8 -11
-ori gp t1 2026
-auipc x0 239634
-or s4 a3 a2
-sltiu t0 s7 596
-divu t6 s0 t6
-sltiu s2 t0 -1590
-and t2 t4 s4
-addi t1 s11 816
-sll s5 a3 t6
-mulh gp s11 s7
-mulh s2 t3 s11
-divu ra s2 a1
-mulhu a3 t5 t5
-srl x0 x0 s11
-slt s1 s3 s7
-mulhu t1 t5 a2
-remu gp s7 t1
-xor s10 t6 t6
-slti s2 a7 -1046
-sltiu a6 t6 -824
-xor x0 gp gp
-sra s4 s2 t0
-slt x0 s10 s8
-xori a4 x0 -633
-srai t4 a4 2
-div a2 t5 a7
-add a5 s11 a1
-mulh s2 s7 t2
-sra a1 s1 t0
-sub a5 x0 t3
-lui t0 654845
-rem x0 t2 s10
-xor x0 s2 s7
-remu t4 s8 s1
-lui t2 246206
-addi gp a6 1350
-sub t6 a3 t2
-slt t2 ra s9
-mulh tp s10 gp
-sltiu s10 a4 1740
-sltiu t3 s9 900
-sltiu a3 t2 713
-divu t6 a6 s7
-auipc a1 62986
-mul a3 a6 t3
-rem s7 a2 t1
-sltiu a5 a7 -1274
-ori a2 s4 -1445
-mulh t1 a3 t6
-sub t5 t6 tp
-mulh x0 a5 t2
-mulhu a7 s0 a0
-slt s4 a6 s7
-andi a2 tp -1211
-mulhu t4 t3 t2
-srl s11 t4 t0
-div tp s3 t4
-xor t2 a4 a2
-sltu x0 ra a2
-srli t0 a5 9
-sra gp a7 a7
-rem s10 t2 a5
-sll s10 s2 ra
-xori gp a1 -1410
-sltiu a0 a6 851
-rem s3 a0 x0
-xori s6 a0 1308
-sltu a0 s9 x0
-mulh s5 gp s6
-slt a7 s9 s1
-lui t5 813558
-xori s7 tp 1526
-lui gp 452739
-sltiu a1 t2 -658
-auipc t0 93110
-remu t5 a3 a4
-xori tp a5 -1803
-sltu tp a7 a2
-sll s8 a4 t1
-sll a1 a2 s10
-mul s8 x0 a7
-remu a0 x0 s8
-mulh s6 s3 a5
-add x0 s10 s0
-sltiu s7 s5 964
-sll s7 s11 t4
-xor a3 a1 s4
-remu s6 gp a1
-sltiu t3 s6 -1867
-sra t0 s4 t2
-auipc ra 49583
-remu ra s1 s2
-or t6 t1 s8
-div ra a4 s3
-xori t5 s1 -241
-mulh a3 a2 a5
-slli ra t2 16
-sll s3 s1 s10
-addi a6 x0 1903
-xor s3 a4 t2
-sra gp a6 a2
-mulh t6 s1 a5
-xori t2 s4 -981
-sra a3 t5 a2
-mulh s8 s9 a2
-sltiu s0 a5 921
-sra a2 s9 t4
-andi a2 s2 1693
-or ra gp a0
-div a6 a6 s4
-ori t2 s7 -1427
-mulh t0 a5 ra
-xori t5 s7 823
-sub s3 a4 a7
-addi t2 s7 -14
-srl s4 s10 s5
-srai a7 a7 26
-slt s5 t5 s8
-srl gp a2 s7
-and a0 s5 a6
-remu s11 ra s7
-remu a4 a3 ra
-ori t1 s2 -1994
-sra t6 t3 s9
-or a6 s8 s4
-mulhu s6 t4 s5
-andi t5 x0 -589
-sra t1 t0 t3
-and t3 t6 ra
-auipc t0 182483
-andi s1 s7 -998
-sltu x0 a6 t0
-slti s9 a0 -1919
-sll a3 s9 a2
-slt tp s2 x0
-div a6 a3 s0
-addi t6 x0 682
-mulh s0 s10 a0
-xor x0 x0 a1
-xori s1 s8 -768
-auipc a2 43735
-srl t6 s10 tp
-ori s5 s4 -213
-sra a5 ra t2
-mul s5 s0 t5
-srl t6 a0 a3
-mulhsu s9 s4 t3
-sltu x0 t1 t6
-div a4 a5 a0
-mul s6 s0 s8
-addi x0 a0 1684
-sra t1 s7 t6
-mulhsu ra t1 s3
-srli a1 t5 17
-slt s4 a3 x0
-xor s3 t3 a0
-lui a4 299838
-lui s3 166275
-or a4 a4 s6
-sltu s5 a2 gp
-remu t1 a6 tp
-divu t3 s5 t2
-div gp s9 t2
-slli tp s10 8
-mul x0 t2 a1
-mulhu a3 s0 x0
-auipc s7 957030
-sltu a7 a4 t0
-and tp s0 s0
-mulh t3 t5 s0
-mulhsu a2 a0 t0
-addi s3 a6 -269
-srai tp s8 3
-div t5 s6 t6
-srai gp s7 27
-slti x0 ra -1546
-addi s8 s11 232
-or t3 t3 t5
-andi a7 gp -1642
-sra ra s9 s1
-addi a1 a0 -1923
-ori gp s11 -243
-srli x0 s9 10
-mulhu a7 s9 a4
-mulhsu s9 s5 s4
-sub s3 x0 a0
-slli a2 a1 30
-rem a2 s10 t1
-div t1 s3 a2
-xori x0 x0 103
-slt a5 t2 x0
-div s4 t2 s0
-sub t1 a7 x0
-auipc t2 69299
-and s2 a2 gp
-add tp a4 a7
-srl t2 s10 a0
-and s8 t0 s4
-slti x0 ra -1382
-mul a7 s9 s2
-mulhu s2 s0 gp
-srli x0 a6 26
-addi a2 s6 894
-mulhu s3 t4 a2
-rem s7 s1 ra
-rem t5 s11 a7
-sra s6 t1 t3
-xor a4 a6 t0
-xori t5 t0 721
-mulhsu a3 a4 a3
-add a1 a0 tp
-mul s2 x0 a0
-srl s9 a4 t1
-slti t3 s7 194
-rem s8 t4 tp
-xori s2 t5 907
-mulhu a3 a5 a4
-auipc t5 743031
-sll s9 t2 a5
-div s10 a4 ra
-sra t5 a6 s3
-sll t1 a6 s9
+addi t2 s5 -577
+slli s9 s7 31
+xor t0 t6 s2
+or a1 s8 t2
+ori s9 a1 -376
+slti s10 a5 -1242
+srl a3 t2 ra
+srl a1 s2 s5
+slti s1 a3 1247
+auipc s11 720670
+sll gp a0 s3
+slti a7 t2 -1736
+mulhu a2 s9 s7
+slli t0 s9 20
+mul a0 s9 t3
+add s10 s5 a1
+div tp s2 s3
+srli s10 s11 25
+remu s5 gp a7
+mulhu a1 gp a3
+remu s3 t3 t3
+xori a5 t1 652
+slli s0 t1 26
+mul gp s7 a5
+mulhsu s3 a3 x0
+divu t5 tp t6
+ori s6 s7 -283
+rem t0 t1 s7
+and s5 s6 s7
+ori a0 s3 1217
+auipc s10 143832
+sub a1 t0 t5
+slt a5 s7 t4
+srai s10 s3 6
+mulhu a3 a6 a4
+auipc s5 278429
+lui a3 11431
+mulhsu t1 s5 s3
+auipc s1 477414
+mul t1 a7 t6
+auipc s11 332126
+mulh a6 a6 a1
+div a5 s2 s11
+slti s2 t4 1934
+sra a3 a0 s8
+mulh a1 ra a3
+xor s7 a1 s10
+remu a6 t6 t5
+srli s8 s7 11
+or t4 s6 s2
+auipc t2 10783
+addi t5 s3 -646
+sltu t5 a2 a6
+addi s6 tp -1275
+srli a1 t3 0
+andi a7 a0 -100
+remu a4 s9 a6
+sll a6 tp t1
+sub s1 ra s0
+srli a6 a4 28
+addi a2 a5 -513
+srl a3 a7 s9
+sub s3 t0 s10
+srli t6 tp 28
+slt a3 s4 tp
+add s11 a7 s0
+srli a5 t3 2
+srli s10 gp 30
+lui a4 6514
+mulh t2 s6 s6
+div t5 tp s8
+remu s7 a4 a3
+xori s4 tp 451
+mulh s3 s8 tp
+or s11 t0 t2
+mul a1 s0 a6
+andi t5 t2 -1013
+div s6 s6 s8
+auipc s1 115669
+slt a3 t0 s10
+remu s7 a4 s5
+sltiu a0 s11 -1061
+addi s10 s4 1869
+mulh t0 t3 s9
+remu s2 ra s5
+srli s1 a5 17
+srli s6 s8 23
+slti a3 t4 216
+sll t3 t4 a0
+mulh s3 t0 t5
+and s7 s6 t0
+xori t5 s1 -839
+andi x0 s3 -1343
+mulh a1 s3 s10
+div s3 gp a5
+sub ra ra s9
+add t2 s11 s4
+sub x0 x0 t0
+addi s10 s11 761
+xori t2 tp -159
+mulh s9 t3 t6
+sltu t0 ra a2
+addi a3 s3 -936
+andi t1 s0 -1777
+andi x0 t1 1090
+slti gp t3 1206
+mulh t2 t1 t4
+srli ra s2 5
+mulhu ra t5 s2
+mul s0 s0 a5
+add s8 a7 t4
+and s2 s11 a7
+sll t0 s7 s2
+lui s3 223522
+addi a5 s6 1397
+andi a7 s5 -1277
+srl s3 s3 t3
+mulh s1 t6 s11
+andi a7 t4 -474
+mulhu t3 a6 s9
+auipc a6 561131
+div s1 ra a1
+divu s0 s10 a0
+div a0 s3 s7
+srli t2 t3 15
+mulhsu t2 tp t5
+xori t6 s6 -1696
+srl s10 a5 t5
+slli s3 a0 11
+sltu s5 t1 a0
+srai x0 a4 31
+div s4 t6 t1
+lui t1 808986
+add s10 s10 s8
+xor s9 a7 t2
+mulh t4 s2 a4
+sra a7 s8 a0
+xori s9 s4 304
+and gp t6 s4
+add a2 gp s7
+add ra a4 s4
+slti a1 t0 1454
+andi t2 s9 -744
+or a0 t6 s11
+lui s4 413096
+slli t2 t1 5
+mulhu s7 t3 s3
+xori s6 a1 -699
+div s0 gp a7
+andi s8 s2 -1317
+xori a5 a4 1523
+ori a5 a4 -979
+or ra s1 s11
+mulh t2 ra t2
+srl s10 t6 s8
+mulhsu s6 s6 s8
+addi t5 ra 883
+sra t0 s6 t3
+and s4 t4 a2
+divu a0 s3 s10
+divu s0 a0 t6
+div t1 a6 t6
+slti t3 a5 -1595
+sltu s11 t4 a1
+sltu t6 t3 a5
+sll x0 s6 a3
+andi t3 s2 -446
+div a0 a1 s6
+sll t6 s10 a7
+lui t6 694283
+mulh t3 t5 a5
+sll s6 s1 s5
+add gp x0 s8
+lui s8 543135
+xori s11 t4 -1744
+and s0 a4 t6
+sub a4 s11 a6
+sltu t2 tp s1
+lui a2 994275
+lui t0 775081
+lui a6 1038993
+mulhu s10 s4 a5
+slli a6 ra 11
+or a0 t6 s1
+ori a5 t1 35
+add t4 a0 s10
+divu s6 a0 s3
+xor tp s11 a0
+andi s1 gp -1361
+divu t0 s5 t6
+rem a4 t3 t4
+or a1 a0 t3
+sltiu s3 s11 311
+sra s5 t0 s7
+ori a3 t5 -1093
+andi s9 t0 -1414
+rem t3 s2 a5
+or a6 x0 tp
+xori a6 a2 1466
+sll s2 ra x0
+add t5 tp s9
+sll a7 s6 s6
+mulhu s10 t0 s10
+xor s0 a2 a3
+mulh a4 a3 a5
+remu t2 t2 t1
+xor a0 x0 s0
+div s10 s7 s3
+sll ra a0 t3
+and a2 t6 t2
+remu a2 t4 ra
+mul t2 t6 a1
+remu s2 s6 a5
+sltu s7 s3 s2
+divu t4 a3 t0
+sll s0 s7 t1
+auipc a7 708753
+div a6 t1 a7
+slli s11 t1 25
+sltu a2 tp a1
+mul s10 t2 a5
+xori t0 s0 -417
+sltiu a3 s8 -104
+srai a4 ra 16
+addi s5 x0 -1683
+slti s8 a7 -568
+div s6 s2 s5
+add s7 s11 t3
+srl s3 t5 s6
+rem s7 t2 a7
+addi s10 tp -240
+divu a4 a4 a5
+mulh t1 a5 a0
+xori t0 t3 -1070
+auipc s2 391504
+and t3 t3 s2
+mulhu a2 t4 s5
+sra s7 a0 a6
+srai s1 a1 15
+sra t2 t1 s5
+sltiu t5 s5 150
+mulh s6 t5 s0
+lui a5 953559
+slt x0 a5 a6
+xor t4 s7 a5
+ori s6 a0 148
+sltiu a4 a1 -1607
+mul x0 s9 gp
+slt s0 t0 t0
+sra s5 x0 a1
+xori gp s10 658
+xor t3 gp ra
+mul a6 s7 a2
+add a2 s7 s9
+remu a5 a4 t2
+srl gp gp t2
+lui s5 353413
+xori x0 a7 398
+xori a7 s5 202
+and ra s1 a5
+addi s10 a7 -474
+sltiu a7 s4 -1307
+slti t6 s7 -1577
+srai a7 a7 29
+andi s9 s7 74
+slli ra s0 6
+lui a0 652041
+slti t6 t4 -1839
+mulh a4 a7 tp
+rem a7 t3 s3
+mulh s5 s8 a0
+sra t2 s11 s1
+sub t4 a5 a6
+mulhsu s1 a6 tp
+mulhsu s10 s4 t3
+andi t6 t2 -1166
+xori tp s2 504
+add s10 s1 a2
+xor ra a2 a5
+rem s11 a5 t1
+srl gp t6 x0
+andi s7 s6 -110
+addi t2 a1 -1224
+srli t3 t3 10
+xori s10 s2 -516
+mulh t1 t0 a0
+sltiu s1 x0 -864
+xori s5 s0 1518
+sra t1 a6 s9
+srai tp t6 10
+mulh t3 ra t0
+mul a4 s8 s8
+andi a6 ra -240
+add a4 a7 t0
+addi tp a6 -1097
+and a1 a3 t0
+srli tp a5 15
+ori t0 t0 -1420
+div s10 t4 a4
+div t0 tp a3
+addi s3 a6 -571
+mulhu s2 s5 a1
+sltu a1 a7 s2
+srai t5 t6 0
+slt t0 s2 t4
+sll t0 s1 t6
+rem t1 s5 s9
+sra a7 t1 ra
+sltu x0 t4 s4
+andi t5 a4 -1483
+mulhsu a4 tp s10
+xori a6 a4 -50
+srl a1 t0 x0
+lui t2 861729
+slti a4 s10 -988
+div t3 s1 s10
+slti a1 a4 206
+srai t3 ra 29
+srli a5 a3 25
+ori s7 s0 -364
+or s0 a7 s3
+sub t3 s10 s11
+mul s4 t4 s3
+remu s0 x0 s0
+addi s5 a5 -2021
+mulhu t2 a1 s11
+mulhsu a7 a1 gp
+xori t0 s2 668
+xori tp s2 1590
+sltu s10 s8 s10
+and s4 tp s1
+mulhu t5 a1 t1
+auipc a3 827958
+srli s0 t0 2
+rem s0 t0 s0
+xori s9 tp -2010
+xor t6 a6 s10
+mulhsu a0 s3 a3
+mulhsu s4 t4 t6
+addi a7 t0 -649
+ori s1 t6 -950
+lui t1 888558
+lui s4 908058
+addi a7 a6 -832
+remu t6 a5 a6
+auipc s5 16151
+ori s7 a7 -1268
+slli t6 a3 27
+mulhu s2 s2 t1
+auipc a0 609827
+divu s8 t4 s11
+srli t4 a1 16
+addi ra s4 635
+mulhsu t0 a0 t0
+srli ra s4 17
+srl ra a2 a4
+addi s2 s7 366
+sra s10 a3 tp
+sltu s11 s6 s5
+ori gp s7 1329
+xor gp s5 s2
+lui t0 883137
+xori s9 s11 1562
+sra t1 s2 a2
+ori t1 a0 487
+slli a3 t6 1
+sra a0 t3 tp
+sra t2 s11 gp
+div t0 a0 s0
+mulhu t6 s9 a1
+lui s1 1012090
+mul s5 s11 a1
+slti s1 s11 -1794
+sltiu s4 s8 -89
+div s11 a5 s3
+srli t2 a1 14
+slti t5 a6 -1394
+slt a6 a2 s3
+xori t3 x0 -96
+ori a0 s0 -546
+sub a3 t1 tp
+mul a0 t1 tp
+auipc x0 1035050
+rem gp t1 s7
+mulhu gp s11 a3
+sra tp a1 a0
+sltu t0 s4 s3
+sll s1 s6 t2
+xor a6 s10 s0
+sub ra a3 a3
+auipc x0 268610
+sltu gp s9 ra
+and t5 t1 s7
+srai tp s4 11
+and tp s2 a5
+addi a1 s8 -719
+andi gp ra -660
+xori a5 s4 -785
+add gp s4 s3
+rem t6 a5 t5
+lui t3 1034152
+divu s7 a4 ra
+slt a2 tp a0
+slt s9 t1 a5
+mul s5 s1 a2
+srli s5 tp 30
+mulhu x0 s11 ra
+and t6 t4 ra
+mulhsu s9 t5 a2
+remu s5 x0 s9
+sra a7 t0 a2
+sra a7 t6 s7
+or tp a6 s0
+lui a6 984350
+div s5 s1 s4
+xori s6 s9 -156
+ori a2 a5 1851
+slti a1 s8 1111
+ori ra s5 1311
+mul s6 x0 s4
+add s11 t3 a1
+srli s11 a4 4
+srai s7 a1 6
+mul s8 s8 s1
+sltu s0 s8 s0
+mul t6 s1 a4
+slli a2 a5 2
+lui t3 966592
+or s1 t3 s5
+srl s2 ra a4
+xor a2 s4 s2
+auipc t0 874753
+srl s11 s5 t5
+addi a3 a0 1119
+remu s4 t0 s1
+auipc t5 139434
+slt gp s11 t0
+remu a0 a3 s6
+slti s3 a6 -1556
+or t1 a4 gp
+slt s4 a2 a4
+srl t2 s11 s6
+div s0 t1 s3
+lui s7 923016
+sltu a1 s10 t6
+mulh gp a0 a4
+mul a0 s7 a6
+and t0 tp gp
+add s5 a3 s7
+mulhu x0 gp a2
+sltu s1 t4 s8
+xori s10 s6 1389
+sltu t5 a7 tp
+slt s11 a7 s8
+auipc a4 112115
+rem t5 t4 s0
+srli s6 t0 27
+addi t3 s11 434
+slli s9 a7 8
+auipc s11 604078
+sltiu s1 a5 1917
+slt gp a4 t5
+slt t1 t3 x0
+ori s8 tp 367
+xori t2 a4 -847
+andi s3 tp 1690
+ori s1 a4 1880
+srl s4 t6 s9
+lui a7 163365
+or a1 ra a7
+xor s10 a6 s10
+sub t1 t6 s10
+mul t2 s11 s0
+lui a4 786847
+xori a1 a7 -534
+remu s4 a1 s11
+sltiu s6 a0 1009
+sub ra s4 a2
+xori s8 t3 -1164
+auipc t6 925334
+mulhsu t4 ra s5
+andi a0 a3 -654
+sra t3 a2 s3
+sra s11 t1 t4
+sltu a0 a3 a5
+slti a5 s8 -568
+andi a1 t4 -1994
+sra a1 t5 s6
+sub a2 a7 t3
+div s0 s4 a2
+remu tp s8 t6
+slti s9 s6 -1114
+sll s1 a2 a1
+sltu a2 t0 s4
+mulhsu s6 a1 s2
+srai s2 t5 11
+mul t4 x0 x0
+divu s5 s11 a0
+srai t1 s3 22
+lui s7 979009
+add a0 s2 s0
+srli ra s8 26
+xor t2 s2 s10
+sltu t3 s11 t4
+sll a1 s0 t1
+auipc t0 73975
+srl s4 t2 t5
+sltu s10 s4 t6
+srl a7 s1 s9
+sll a6 a0 s0
+sub t0 s1 s10
+andi t1 s9 -1802
+sll s8 t1 s6
+sltu t1 a2 s1
+mulh s4 t0 ra
+mulhsu t6 t2 a4
+lui t6 136376
+mul t0 s2 s2
+or a2 s11 s3
+sra s4 t1 ra
+xori ra a3 -1044
+xori gp t0 1726
+addi a1 x0 -1356
+srli t3 s7 31
+sll t5 s11 t3
+slt a5 s3 t5
+srl t2 s3 a4
+srl s0 gp t3
+mul x0 a0 s11
+srl s3 x0 t2
+sub s0 a7 s6
+sltiu gp t1 137
+sltu a5 t1 a3
+andi t5 s8 -1812
+sltiu a4 t4 1945
+sltiu s3 a5 -1568
+xor s6 t6 s11
+and s11 a6 s1
+sra t6 s6 t2
+divu s6 t5 t5
+sub a4 s0 a6
+lui gp 8390
+and s8 s3 s2
+sra s1 a0 s1
+xori t5 a5 -1613
+sltu ra s5 s4
+or s1 gp t4
+sltiu x0 s9 -1553
+sltu s3 s1 t3
+sltiu gp s5 -105
+mulhsu t3 s2 s8
+srl s0 s10 a3
+or s10 ra a3
+mulh a2 a3 s11
+andi a2 a6 889
+srli a7 gp 5
+sltiu t4 a0 -495
+srl a4 a1 a3
+srl t5 t2 s3
+mulhsu a7 s9 s8
+sra s10 s2 t4
+xor t4 a1 t6
+sub s0 s4 a4
+mulh s3 a7 t0
+addi s7 a5 938
+slt a7 t0 a3
+slt x0 s9 t3
+sltu t5 s1 s11
+addi a5 t5 1294
+slli s8 s2 3
+sra s1 x0 a7
+and t5 s10 s7
+srl s6 a2 x0
+srl tp a3 s5
+ori s1 t0 1197
+rem s0 t6 s7
+mulhsu s6 t6 s4
+sra tp s4 t3
+srai tp s0 20
+mul gp t5 t4
+sll s8 t5 s6
+xori t0 s5 -1649
+and a7 ra a4
+xori tp a2 -1140
+sub s7 s9 t1
+remu a4 x0 s11
+add x0 gp t0
+slti a3 ra 92
+andi t3 a3 -1088
+mul t1 s9 x0
+andi s3 s10 -1055
+slli a2 s9 18
+srli a2 t4 0
+mulh a4 t1 s2
+mulhu s8 t2 s0
+sll s10 t5 a2
+slli s7 a4 11
+addi s10 t0 -533
+sltu t4 a1 a4
+mulhsu s5 a5 a2
+or s6 t4 a6
+mulh a4 a3 ra
+add a5 s0 a5
+or s3 gp t4
+remu a3 s10 t0
+slli a1 tp 4
+and a4 s4 s2
+mul t5 t6 gp
+ori s2 a6 -1330
+xori tp s2 -797
+sra a4 a5 t5
+slti t3 t6 403
+srl t5 s10 t5
+and s1 s9 t2
+or a1 a5 t1
+divu s10 t0 t4
+slli a4 s8 23
+andi s1 a5 -1178
+slt a7 t0 s5
+slt a2 t6 s4
+mulhsu s0 t0 s2
+divu a2 t2 s8
+mulh s0 s1 s9
+slt a1 s11 s2
+auipc t0 144636
+srl s9 s7 t4
+andi x0 s11 -827
+rem s5 a4 t0
+xori t1 s0 521
+mulhu t3 s10 a1
+srli t5 s9 7
+slti t0 a3 804
+remu a6 s7 a6
+xori a4 s11 1303
+mulhu t6 a0 tp
+sltiu a0 s1 -277
+mulhsu t2 gp a4
+sra s10 a4 s8
+xor t3 t1 a7
+slti x0 s8 -1568
+slt a5 s1 s4
+xori t0 s7 12
+sltu s11 a0 tp
+div s5 s7 s3
+mul s1 s1 s5
+or s0 a3 s8
+xor s8 tp t4
+mulh a4 t4 ra
+slt s9 t1 x0
+sub t6 s2 s11
+div ra s7 t3
+xor t3 a1 t3
+xor t3 s8 s5
+mulhsu a4 a6 s9
+sltu t6 s7 s1
+ori t2 t0 -1618
+sub a5 s0 s9
+remu a6 t1 a6
+andi s1 a2 -1234
+add t5 t4 s7
+xori s10 s10 -1065
+sll a2 tp gp
+div s9 t4 s8
+xori s5 a2 437
+slt s4 s2 t6
+and s0 t0 s4
+mulhsu s2 a7 s7
+sra s3 a6 s2
+slt a3 s6 t0
+slt a7 t2 t6
+srl s10 t0 s3
+sltiu t2 a3 1651
+add t0 a7 t6
+sltiu a0 a3 1787
+sra ra s3 s3
+ori s0 s2 -1693
+mulhu t0 s2 t3
+xor t6 s6 s6
+xor s9 s0 s1
+slli t4 s11 19
+sub ra s10 a7
+or a5 s0 s9
+sra a1 t4 s2
+sltiu a4 ra 1167
+divu gp a1 gp
+divu s9 s8 t4
+lui a2 233437
+and a4 gp s11
+and t0 s8 x0
+srli t3 s6 21
+slli s2 s9 19
+sll s0 s4 a1
+sltiu a1 tp -255
+mulhsu t5 s8 a3
+auipc a7 27693
+slt s9 s3 s5
+slt t0 a3 x0
+sra t2 a3 s0
+mul a4 t2 t0
+slti t0 s0 -1613
+xor t6 a7 s11
+sll t1 t5 s2
+ori s2 a7 -9
+srai s9 a6 7
+xori t0 a6 1101
+sltiu t6 a2 -1120
+srl t0 a0 t2
+and ra s7 s4
+sra t3 a6 tp
+sltiu t6 s10 -770
+mulhu s9 t5 a5
+sltiu t5 s3 -2017
+sltiu s8 a5 -1531
+sub a4 t3 s3
+div s3 t1 t1
+divu t6 a6 t6
+slli t2 a0 7
+lui a3 544502
+sub gp s5 s8
+slt tp s2 s2
+slli s0 s8 6
+slt a7 s10 a5
+srai s7 a3 12
+mulh a2 s9 a7
+rem s4 a1 t2
+slt s1 t0 a7
+sub t4 t5 s9
+srai s4 a3 20
+xori a7 s10 1820
+lui t3 15569
+div ra s11 a0
+sra s5 t2 a3
+slti a0 t3 -211
+div a5 t6 s1
+sll t3 s4 t2
+xori s11 a3 -745
+ori a2 s10 250
+div s6 t6 a5
+srai s0 t5 12
+xori ra a6 -1835
+lui s9 117480
+srl s4 s5 x0
+slli x0 x0 16
+slti s10 t0 547
+srli s7 t4 14
+slt s4 s7 a3
+slli a3 s9 15
+sra s1 ra s3
+mul s11 s1 t4
+remu a1 a6 s5
+divu a5 x0 a5
+andi s0 t5 2011
+sltu s9 a4 s5
+sub a3 s7 s4
+rem x0 s8 a4
+mulhsu tp t6 ra
+sub t0 s1 a1
+remu a3 a7 s11
+mulhsu s4 tp s0
+srl t1 s0 t0
+divu s3 a7 a4
+remu s2 a0 a1
+rem a6 a3 s5
+sll a3 ra t1
+divu t3 t4 t0
+xori s10 t4 -1016
+mulhsu t0 a0 s0
+sltiu t5 a1 670
+div t1 s11 a2
+xor a1 s3 t2
+mul s6 t0 t1
+srai gp t1 31
+or s0 a2 t0
+andi x0 s9 -1013
+rem a7 s5 t1
+srli t2 t3 3
+mulhsu a6 s3 gp
+divu s6 s1 ra
+andi a2 a4 1960
+mulhsu a2 s5 s7
+xori s3 ra 1775
+mulhu s1 s10 ra
+mulhsu s1 s8 a4
+srli a0 s7 25
+sltu t0 a4 t1
+auipc t0 887885
+divu t2 a0 s1
+mulhsu s4 s7 a4
+srli s11 a5 18
+srli t2 t5 14
+div x0 t5 s3
+srli t1 t5 30
+sltiu a0 t3 845
+addi x0 t4 -1505
+slt t4 s5 t6
+add a0 tp s2
+sll a0 s3 tp
+slt a6 t3 t5
+lui t2 86904
+addi a3 s11 -721
+or a2 ra tp
+add a7 tp s3
+mulh a0 tp ra
+or s11 t3 a6
+slt ra a2 a1
+mul a2 s5 gp
+mulhu a7 s0 t6
+mulhu s6 a2 a3
+auipc t6 276909
+mul a0 a4 s10
+slli t3 a5 5
+xor s4 s1 s5
+srai a0 t6 10
+andi a0 t3 -1030
+addi a3 a5 1883
+srai t3 s9 15
+and a5 x0 s2
+and t0 tp x0
+sub s10 s3 t5
+mulhsu s1 a5 t2
+or ra a4 a0
+slli s10 a0 17
+sltiu a1 ra -227
+slli t5 t6 30
+sra s2 t2 t5
+mul t5 s2 s6
+slt s5 s6 s11
+auipc t6 834059
+sll s1 t1 tp
+div s11 t0 a2
+rem s3 a0 a4
+slli a7 a6 9
+rem s4 a4 t2
+div t1 t4 s11
+and s9 t4 s2
+mulhsu s5 t4 s3
+lui t6 153845
+sltiu t3 s2 173
+div t4 x0 s1
+or s10 a1 s1
+xori a1 s7 -1507
+div s11 t6 s8
+mulhsu a5 t2 x0
+srai tp s1 0
+sltu s0 t1 tp
+add t5 s11 t0
+add a4 a3 a7
+add t1 a4 s1
+addi a5 s5 159
+sltu s9 s1 t2
+divu s10 s3 gp
+slti s1 t2 1245
+sltu x0 t3 s1
+mulhu t4 t4 a5
+ori s4 ra 1618
+or t0 t6 t5
+rem tp t2 a0
+remu t6 t2 s9
+sltiu s0 s5 -1738
+add gp tp a3
+srli s7 a1 19
+andi a4 s1 -389
+and x0 s1 s1
+and s1 t5 a2
+srl a7 s6 s3
+andi t0 t5 -1380
+sltiu s5 t6 -1063
+andi s5 s11 -657
+srli s0 a4 28
+remu t3 s10 s6
+sltu t1 t4 a2
+xori a3 a4 -1397
+div t4 s11 a7
+remu s3 s1 x0
+slt s10 s7 t3
+mulhsu t5 tp a5
+sltu a5 a7 a3
+sra t3 t1 a6
+mul s5 a4 a1
+lui a1 1048545
+div a6 s1 a6
+mulh a3 a4 a1
+div t4 s3 a1
+sra t4 t1 s10
+mul s1 t2 s9
+sra s6 t4 s7
+mulhu a0 s11 ra
+srli gp t0 14
+add s8 t2 t6
+sra s9 ra s9
+and s8 t0 s6
+sltu t1 s9 gp
+andi a4 s4 -1975
+slt t0 a7 s2
+ori s7 t6 -366
+slti t2 s7 -1447
+remu s2 t4 a5
+xori a1 a2 -1626
+and s2 a6 s8
+sll t2 a5 s9
+auipc s4 639793
+sll t2 a5 t6
+auipc a3 783846
+sra a5 t5 x0
+lui s5 807178
+sll gp a6 s4
+and a3 t2 s1
+mulh a2 a2 s3
+remu s5 a3 t0
+xori a5 s6 2004
+or a5 a5 s0
+sll t2 s7 s0
+divu s2 a3 a4
+slt s0 t4 s0
+divu s6 x0 s9
+slt a6 s3 s8
+sll t2 a4 a0
+slt t2 t3 s2
+rem t4 gp s0
+mulhsu t3 a0 s5
+srai t2 a4 19
+sub a2 t0 tp
+div a3 gp a4
+div a5 t0 a6
+lui ra 660537
+div ra s5 gp
+sub x0 s8 s2
+auipc t0 228688
+mulh s1 s0 s5
+xor s7 t4 a2
+mulh s3 t1 a3
+lui s2 934631
+mulhsu s1 a1 tp
+add gp s1 a4
+divu tp a2 s10
+or t4 t3 s11
+sub s8 x0 a1
+srl a5 s11 t5
+remu s5 t3 s9
+remu s4 a6 s5
+lui s2 777204
+srai t4 s4 30
+rem a5 t3 a7
+slt t1 x0 gp
+mulhu s7 s4 a3
+mulh a5 s3 t5
+add s7 t3 s0
+sub tp s9 s3
+or gp t0 gp
+addi s0 a1 1063
+sll t4 s1 s8
+sra ra s9 t1
+sltiu a0 s6 889
+lui a6 35123
+sltu s3 s6 t2
+divu tp ra s9
+srai ra s6 25
+srai t1 t0 0
+addi s11 t1 -1504
+slli s9 a3 7
+sll a5 tp s3
+ori a1 s1 -2016
+mulh s8 gp x0
+sll a7 a2 t0
+mulhu a4 s2 x0
+ori gp a1 607
+sltu s9 a2 gp
+andi a7 t2 -1894
+andi s9 t1 -893
+and a3 a0 s4
+remu s10 t5 s7
+or s3 t0 t5
+sltiu a4 s9 -1251
+srai s0 s1 2
+sll t5 a2 a1
+xori s1 s3 2021
+srai t6 s1 9
+sra t6 s7 s1
+and t6 t5 a2
+mulhu a7 s8 t5
+sltu a0 tp s6
+mulhu s1 s8 s1
+or t4 t6 t0
+slt x0 t1 t5
+div t4 gp t2
+sll a3 s3 s4
+rem a7 x0 a4
+divu a3 a0 t2
+srli s9 s5 24
+sub t0 s2 t3
+lui a1 53393
+ori t3 a0 18
+sra s5 s7 a6
+and s8 s1 s5
+slt a5 s6 t3
+and s7 t2 a2
+mulh s2 s0 s2
+sub ra s0 a6
+srli t0 s7 6
+mulhsu tp a4 tp
+mul t5 s2 s7
+add t2 x0 t5
+sltu tp a2 t1
+rem t1 a6 s2
+sltu a4 gp t6
+sltu s5 x0 s6
+mulhu s5 s8 s2
+lui s2 749346
+sub t3 x0 t6
+rem a3 t0 s1
+sll s7 t2 a0
+auipc s4 701442
+div s0 t1 s10
+sltiu t6 t3 -1420
+ori s4 x0 985
+ori a1 s3 -4
+xor x0 a0 ra
+srai s2 t1 16
+sra s9 a4 s8
+sub gp s3 s9
+sltu s1 x0 s11
+sltu t2 s4 s0
+rem s1 s10 s10
+sra s4 t6 t5
+sltiu gp t2 461
+auipc t6 44257
+remu s4 s10 t1
+auipc s2 69386
+or s7 tp a1
+sltiu s7 a0 839
+sll a2 a3 s1
+and a3 t3 t3
+slli t5 t5 12
+mulhu s9 a2 t6
+srli s3 t4 6
+slli a0 t2 7
+slli s9 a2 6
+div t5 s0 s8
+remu s6 s2 a0
+divu s4 s5 tp
+add a6 a3 a3
+sltu s1 s7 t6
+mulh s3 s11 t4
+sltiu a6 s3 -1291
+mulh ra t0 s1
+sltu s0 a4 t0
+srli t2 s7 12
+sll s1 s4 a7
+mulh s4 s8 a0
+srli s9 t4 8
+slti a2 s6 691
+divu t5 a3 s9
+sltu s1 s3 a1
+mul t1 t0 s4
+srai t0 t5 30
+ori t0 t3 1837
+sltiu s5 s2 -91
+sltiu t6 s7 -1040
+sltiu s5 s9 -148
+div ra t3 s3
+srli t2 tp 31
+slti t0 s9 1415
+addi a2 s9 672
+xori t4 tp -1655
+mulhu a7 s3 x0
+slli s7 a2 21
+auipc a3 560534
+divu s2 a6 a1
+mulhsu t3 s7 a3
+mul t1 s11 tp
+xor s9 t2 s2
+add x0 a5 a1
+or a6 t6 t0
+andi s10 s8 -1873
+sub t4 a6 s2
+auipc s3 612618
+add a5 t1 a0
+div a2 a5 s1
+div t5 t1 a1
+andi a4 a4 1073
+div s9 t0 t4
+rem s10 t1 s10
+srai ra s8 1
+xori s6 t0 -912
+srli x0 t0 30
+and a7 a3 s7
+add s10 s9 s8
+mulh t5 a1 s4
+or s7 a0 t4
+divu a0 a2 tp
+divu s3 s6 s0
+rem a7 s10 a1
+sll s4 a1 s1
+srli t2 ra 17
+lui a0 56403
+andi s1 a2 -1215
+srli s6 s7 21
+mulhu s11 tp s10
+sub x0 a5 s2
+sub a1 t6 t2
+auipc a5 1046651
+sltiu s8 ra -59
+xor tp ra s0
+sra t2 s1 t3
+xor s10 tp t1
+xori s2 s6 -431
+sltu s6 s3 s5
+slli s0 gp 19
+slli s11 s6 23
+and s1 t6 s8
+sra ra gp s8
+srli s10 s8 11
+add s2 t5 s10
+or a5 x0 s2
+srai t0 gp 0
+rem t5 s5 s4
+ori tp t6 1087
+slt t6 t3 t2
+slli s11 s5 22
+rem s1 t6 s8
+sub gp a5 s9
+or t3 tp a5
+mulhu tp s5 t2
+sltiu s10 t6 -1560
+andi t2 s5 368
+auipc t5 845202
+xori t4 s9 -781
+sra t1 a2 a7
+div a3 t5 a2
+lui tp 851620
+divu a7 a3 s3
+xori a3 s0 1574
+ori s9 a7 857
+mulhu a2 s9 x0
+sub s9 a7 a1
+lui ra 363071
+slti t2 t2 1672
+sub s4 gp s5
+slli a6 a6 31
+and a7 s4 a5
+slt s7 s11 t0
+mulh s7 s1 a3
+xori ra a4 -1615
+xori t6 s9 322
+lui s5 541255
+sll a4 s5 s6
+or s7 t2 s2
+slli s9 t2 16
+srl tp ra s8
+div t3 a5 a3
+and x0 a2 s7
+auipc s5 122063
+slli s8 s1 23
+slli s7 s1 28
+and t1 a2 tp
+sltu ra a5 s10
+andi tp t0 -54
+lui t5 696486
+add a4 a2 gp
+mulhsu s10 tp ra
+mulh t6 s2 s11
+auipc t2 550612
+xori a6 s3 511
+lui a1 919087
+sltiu a2 t3 -113
+divu s0 x0 t5
+sltiu t1 a1 -1452
+and a4 gp s9
+srl s10 t0 t0
+mulhu s6 t3 x0
+div s8 tp x0
+sltu a1 s5 a7
+xor s8 t4 s10
+lui t4 432037
+addi s5 ra -582
+mulhu a5 s3 s1
+and ra s3 a3
+auipc a5 888874
+mul a2 x0 s3
+xor a1 t3 a1
+sll gp a4 s10
+slt a1 s6 s9
+srli a6 s1 7
+addi s1 a4 -1742
+slli t3 s2 25
+srl a6 s9 a0
+srli s7 s6 21
+slt gp ra t6
+sltu s3 s1 a7
+mulhu x0 t1 s9
+and a0 t2 t4
+remu a7 a2 t2
+remu s2 tp s6
+or s7 s3 t2
+andi t4 t0 -1975
+sltiu a0 ra -297
+sltu t4 s5 a6
+mulhu x0 a7 s10
+addi x0 t5 973
+sltu a2 s8 a0
+lui s9 912558
+mulhsu a4 t6 s1
+sltiu s11 t5 -1961
+mulhu t6 t4 s3
+div tp s4 s4
+div s2 s5 s1
+addi s0 s6 -384
+mulhsu s1 s9 t1
+andi t5 a7 -316
+slli s6 s0 3
+srl s5 t2 s11
+and s3 a5 a6
+ori s5 a1 -559
+mulhu a6 a6 s5
+and a1 a4 s3
+sub s2 a5 t2
+andi t5 s0 -1327
+slt a2 s9 s4
+srl s3 tp a1
+add t6 s8 s5
+div gp x0 t1
+rem ra tp a2
+or a5 s8 a4
+ori t6 s1 -1370
+slti a3 s1 1171
+sra t0 s4 s3
+srli s5 a2 12
+slt t2 a7 t2
+sra a6 ra ra
+slt a6 t3 s5
+sub a0 s5 a5
+sltiu a1 t2 1340
+remu a4 s5 a1
+srli t4 x0 20
+add s3 s10 s8
+andi t3 a4 -876
+div s8 s1 t1
+ori a6 s7 -1040
+auipc s8 721032
+xori s6 s10 -120
+ori t0 a1 98
+and tp a6 gp
+mul a4 t4 ra
+sra s8 t4 t4
+sltiu a3 s3 338
+and t4 s0 s5
+mulhu t2 a3 t5
+divu t2 a4 gp
+and t1 a6 s0
+ori s0 s0 -1114
+auipc a5 992179
+sll s2 s11 s11
+sltu t1 t4 s8
+srai s6 gp 20
+srli s8 gp 18
+slli a3 a1 21
+or t4 a0 s10
+sltu a5 s6 ra
+or s11 t6 tp
+lui a0 368572
+andi t5 t6 -1270
+auipc s3 289990
+srli a2 tp 29
+mulh a1 gp s6
+remu a2 ra s0
+and t4 s11 s0
+lui x0 398728
+sll s3 s4 ra
+and s0 a4 s2
+srai t4 a4 24
+and a4 s11 tp
+xori s1 a1 -1533
+mulhu a0 a6 t6
+srli a1 tp 20
+auipc a7 71077
+remu a7 t3 a5
+srl t0 t0 a6
+ori s9 a1 243
+lui s8 447032
+auipc a5 791923
+mulh a7 ra t3
+mulhsu gp s0 a1
+sltu t6 s7 s1
+xor t5 a1 s2
+rem t6 a5 a7
+sra a7 a5 s8
+slti s6 a2 -2014
+xori s1 s2 527
+slli a3 a3 28
+or s10 a3 s2
+mulhu t1 s7 x0
+add ra s10 a2
+mulhsu gp s8 x0
+add a4 s1 s9
+sltiu s9 s4 -987
+mulh a5 t2 t0
+rem s7 s1 t5
+auipc s7 940658
+remu gp t6 t2
+srli s5 tp 31
+addi t1 s1 -275
+ori a5 t2 -1702
+addi s8 s0 497
+mulhsu s8 t1 a5
+xor s2 t3 s11
+remu t0 s5 gp
+mulhsu s3 t6 s3
+rem s1 a6 t1
+addi a5 t2 -791
+slt s0 s10 s8
+add ra s11 a3
+or a0 s4 gp
+div s11 a6 a2
+sll s5 s9 gp
+mul s3 t4 a3
+rem s10 t2 a4
+slti a0 a0 1581
+slt t1 s8 s7
+slli t4 t0 29
+lui s7 213220
+add a7 a3 s5
+lui s5 130369
+sll a6 a4 t0
+sra t6 a1 s2
+sltiu s4 a4 296
+sub a4 t3 a7
+sub t6 a1 ra
+sub t2 s8 x0
+sltu s6 a7 a0
+srli s1 s5 18
+sltiu t5 a6 -312
+mulhu t4 s1 tp
+sltu x0 s2 s6
+addi s0 a3 1316
+or t2 ra s2
+ori s0 s4 1034
+andi s7 a2 712
+srli t2 gp 27
+srli t4 a3 30
+sub a6 s8 a4
+srli s4 t4 16
+mulhu t3 gp s1
+or s0 s2 s7
+mulhsu a1 a5 a3
+sub s0 ra s10
+mulh a7 s10 t1
+sltu t1 s10 t0
+mulhu t6 ra s4
+remu s8 s9 s10
+xor t4 s1 t5
+sra tp a7 t4
+div x0 t6 s3
+sltu t1 a0 s10
+andi a0 t5 -323
+add a6 a0 a7
+rem a3 a7 a6
+addi x0 s11 134
+add s3 a6 s8
+srl s10 s7 s6
+sltu ra s10 a1
+divu t0 s3 gp
+sltu a7 s6 t6
+xor t4 s5 tp
+mul a0 a3 a0
+or gp ra a0
+slt a0 s3 a5
+slti tp t4 -1674
+rem s3 t1 a6
+slti a5 s8 1586
+divu t2 s2 a3
+auipc a7 287023
+slt s0 a0 t4
+addi t4 s5 -47
+srli t0 tp 26
+srl ra s1 s4
+or a6 x0 a2
+lui a4 13821
+divu s10 x0 s7
+sll s7 t3 a5
+srai s5 x0 9
+div ra tp x0
+remu t1 a5 a3
+divu s9 t5 s0
+srai s0 t2 25
+srli s9 s3 1
+mulhu a7 t5 a2
+srli s4 s8 25
+auipc s7 1042429
+lui s9 162953
+sltu a3 s9 a1
 sltu t4 a1 t4
-sll gp a5 s2
-sub t5 a3 t1
-div t0 gp s9
-and s5 a6 s11
-remu s1 s3 x0
-andi x0 t4 -251
-slli ra s7 10
-mulh t3 t2 s3
-xori t5 t2 -911
-mulh t2 t4 t5
-rem a1 a4 s1
-lui a5 629996
-ori s5 s4 1245
-slti s1 s3 -1697
-sra s5 t0 a5
-andi gp s0 747
-srl s4 s0 a3
-sra a7 s3 ra
-divu s2 t2 s7
-and s6 s3 a4
-and t1 a2 t0
-slt t6 s2 a2
+remu s1 gp a7
+slli s4 t4 24
+slli s4 t0 22
+auipc s8 645636
+slti s3 a4 -480
+srl t5 s2 a0
+srli a3 a7 24
+or t0 s3 s8
+addi s10 s3 -1380
+div s1 t6 a1
+sll a3 a4 t1
+mulh a5 s8 a7
+and s8 t6 s10
+slt t1 s3 s9
+add t5 a0 ra
+mul a3 t2 s7
+srai s4 a5 14
+add s11 a4 s0
+mul a1 a4 gp
+slli a1 gp 16
+remu t5 s7 t0
+mulh x0 t5 t1
+ori t5 a1 320
+auipc t3 83394
+or t2 s7 t0
+sll a1 tp t1
+add t6 s3 t1
+andi a3 ra 50
+addi a2 t5 -1182
+divu a6 a6 s6
+ori s8 s9 276
+slli s1 a4 8
+lui s7 1048198
+srl gp t1 t1
+xori s8 t5 -1756
+remu t5 a0 t2
+sra s10 a2 s7
+auipc s10 221406
+srl t4 t1 s1
+xor t1 s2 t4
+auipc a5 426186
+slti t2 s9 -503
+and t3 s4 t3
+xor s10 s10 t1
+remu a4 a5 t5
+sll t3 a6 s9
+srai a5 t5 23
+sub s5 ra t4
+mulhsu a6 s2 s11
+mul a7 s6 a4
+xori a2 a0 -1140
+rem a5 t3 a3
+mul a6 s11 s4
+addi a3 s2 -1836
+div s3 t4 t0
+slli a4 t5 16
+mulh s2 a3 s3
+addi t0 t1 -927
+srai ra s3 14
+mul x0 tp a7
+mulhu s10 s6 t2
+div s8 a6 t5
+slli t3 t3 12
+sra t4 a6 ra
+slti t1 s1 1607
+mulh a1 a0 s9
+sltu a0 t6 s4
+sltu s4 a3 a1
+lui a0 159523
+xor s0 a0 x0
+sll a1 s4 tp
+mulhsu t1 a0 tp
+mul t6 t2 s7
+srai t5 s6 8
+mulhsu s8 t0 t6
+sra t6 ra s8
+add s4 s0 a4
+addi a1 t6 1394
+mulh s2 t2 s0
+slt s0 t4 a2
+srli s6 x0 24
+rem gp a4 s4
+mul a5 t1 tp
+xori a7 a3 1230
+mulh t4 t0 a2
+srai t6 s3 6
+srl tp s8 t2
+remu t5 a0 a6
+auipc t4 115169
+mulhu tp s6 x0
+sll a1 t2 t6
+mulh ra t2 s11
+remu s5 gp s11
+sltiu s8 s7 227
+remu a3 a5 t2
+xori t3 t4 1261
+ori s5 t5 -6
+ori t2 a4 710
+slli t3 a4 25
+and a0 s7 s5
+mulhu s8 s11 gp
+div ra a0 a6
+add s10 a1 s7
+auipc x0 754546
+sra t5 s6 a2
+lui t3 1009352
+xori t4 a3 446
+xori a6 a3 -1926
+and a5 s5 s3
+and s10 s8 t6
+xor t5 a3 t1
+xori s5 a7 -635
+slli gp a5 31
+xor tp tp tp
+addi a0 a5 137
+srli t3 a2 26
+auipc s7 985544
+sltu a3 a2 s8
+srli t6 a2 27
+divu s0 s3 t0
+slti s7 a0 -548
+rem s5 s7 ra
+srl a7 a0 s2
+ori t5 s2 635
+xori ra a3 -1051
+mulhu s8 s4 gp
+srli t0 s8 13
+ori s2 s7 -48
+slli t6 s2 0
+slli gp x0 11
+srai a0 t0 8
+andi t6 x0 875
+div a3 tp a4
+sra t1 s10 s9
+mulhu s8 t4 t3
+mulhu a4 a3 s6
+xor a4 t4 t0
+rem s0 t1 s2
+add t1 a4 s9
+addi s5 a2 1245
+ori a5 a1 -1778
+xor s0 t3 s5
+sltu a5 s1 ra
+slti s8 t5 1385
+rem a2 a4 a3
+srl a2 a4 s9
+ori a4 a7 -690
+andi s9 s4 339
+mulhsu a1 s8 a0
+add t2 t4 s3
+sub s4 a6 tp
+slli gp s2 21
+sub t3 s4 t4
+sltu t1 s4 a2
+or s3 t6 t1
+remu tp a2 a2
+auipc gp 840996
+add t6 s6 x0
+srli s5 ra 22
+mulhsu a5 s10 t0
+andi s7 s2 -1155
+sub a7 s5 t6
+mulhsu a7 s3 s11
+remu a2 ra a4
+sltiu t4 t0 -229
+and t5 s10 ra
+addi tp t4 -1122
+divu s2 s3 gp
+sra s2 t6 s1
+sltu tp s8 s11
+andi t2 a3 -697
+lui s11 992140
+xori a2 s5 -61
+and s4 gp a5
+sll t5 s4 s4
+auipc a5 734903
+auipc a6 1020684
+andi tp a5 -402
+slt a2 s6 s3
+srai a3 t3 10
+ori t2 a4 366
+slt t0 a4 ra
+mulhu t5 s3 s7
+mulhu s0 t4 a5
+slli s10 s3 9
+andi s9 t2 -405
+slti s6 s10 -1934
+or t1 a3 ra
+remu t6 t3 t0
+srl tp s0 t1
+sltiu s10 s4 -1349
+slti t6 t4 -465
+auipc a5 892775
+lui a3 1011510
+div a2 a0 a1
+add gp s0 a7
+sll s9 a1 s8
+rem x0 t5 t3
+slti a7 a5 521
+or s8 a1 s9
+slli s8 s1 30
+divu t1 a0 t3
+mulhsu gp s9 s4
 divu t4 ra s0
-srli s2 s8 8
-slti ra s8 1975
-lui s5 389273
-remu s4 a1 a7
-lui s9 953203
-auipc a1 390925
-lui t3 478721
-remu s1 s11 t1
-addi t0 gp -1800
-andi x0 s8 1098
-and t5 t6 s7
-srai x0 s4 31
-addi t6 a1 226
-or s0 a2 a3
-rem a5 s4 s2
-remu t2 s6 t4
-mulhsu t5 ra t5
-sra x0 s3 t0
-slti a5 s2 -946
-mulhu s11 s7 a0
-divu a1 x0 s3
-mulh s4 a1 t5
-lui a3 459536
-div s8 s10 t6
-mulhu s1 a4 s2
-auipc a4 952012
-addi t4 t1 -1939
-ori s4 a5 -1170
-ori x0 a0 -1438
-sll t5 t0 s5
-sltiu a3 t4 -1602
-xori s6 a0 450
-div a7 s2 s8
-remu ra s8 a3
-div t0 t5 s3
-remu s0 a3 s7
-xor s2 s8 ra
-lui gp 309684
-mulhu a5 s5 a2
-sra s10 t0 a2
-lui t0 517933
-sltiu s0 ra -1799
-or a3 t4 t0
-mulhu t1 s4 t4
-srai a3 t5 28
-slt x0 t5 s4
-mulhu t5 s6 s3
-ori tp tp -1997
-slt s7 x0 s7
-xor t3 s11 a1
-srli t3 gp 30
-lui a6 964147
-mulh a4 t2 s11
-ori s8 a6 -1680
-div s0 t1 s8
-xor s11 a2 gp
-mulhu t1 s5 s0
-andi s2 a6 -277
-sltiu a7 a2 673
-xor t1 ra t0
-add a3 s5 s4
-mulh a4 t1 s11
-sltiu t1 s4 -1546
-sltiu s4 s6 -2006
-sltiu a0 a1 1534
-divu a0 a1 s7
-addi s11 t4 -867
-xori tp x0 1383
-addi a7 a3 -112
-xori t6 t2 -225
-sltu s4 a1 a2
-and a0 a7 s8
-sll a6 t2 a2
-divu x0 s3 a2
-ori t1 s11 -1550
-srli tp s2 17
-divu a7 s9 a2
-ori gp s11 -1724
-xor tp t2 s11
-sltiu t1 t0 1579
-slli a0 t0 4
-and a0 ra a6
-mulhsu a0 a1 t1
-div s11 s3 t1
-add a1 t5 t1
-mulhu s4 s4 gp
-lui s4 1003309
-andi t6 s2 1570
-mul a4 gp a2
-srli t1 s8 0
-mulhsu t3 s7 t1
-addi s9 a5 -333
-slli t1 s10 0
-xori tp t2 -545
-srl s11 t6 s1
-lui ra 552567
-srli t0 x0 25
-sltu a2 t1 s3
-div s6 x0 s4
-srl t4 a2 a7
-andi a7 tp 758
-xori t6 s11 -1952
-mulh x0 t6 s8
-lui s1 879461
-sra t6 ra s5
-add a2 t1 s4
-div a4 gp t2
-lui s0 853196
-ori s2 a0 1288
-srl a0 s4 a6
-srli s5 a0 13
-mulhu x0 s5 s11
-auipc s3 294689
-mulhu a6 a4 gp
-mulhsu a7 s2 a5
-srli t5 gp 31
-mul s6 x0 s7
-mul t6 t4 a4
-srli s5 s11 17
-srl x0 tp s8
-sra t1 a7 s6
-and t6 t6 s10
-ori t1 t3 -634
-srli t4 tp 30
-sltiu tp s0 692
-rem t2 a0 s4
-slti t6 s9 2047
-divu a6 t2 a0
-xori x0 a7 93
-srl a5 t3 tp
-sub s10 t4 a2
-or s6 a5 t0
-lui t1 600516
-sltiu tp s9 -2040
-and a6 ra t6
-srai a1 a0 14
-ori t5 a0 -659
-slli a5 t6 2
-mulhsu a7 t5 a4
-sll s7 a6 s1
-srai x0 t0 19
-mulhsu a0 s10 x0
-slli a3 a4 4
-slti s9 ra -1411
-mulhsu t4 a4 a7
-sltu s10 s0 a3
-slti s10 s5 1796
-auipc s9 959195
-sltiu t0 x0 -12
-srl s6 s2 ra
-div a1 a2 a1
-rem x0 a3 x0
-add s2 s3 s3
-andi a0 s3 -895
-slli t6 t4 26
-sltiu s7 tp 1939
-sltiu a2 s8 -700
-srl t1 gp x0
-slt s6 s5 s2
-sub s0 t2 s5
-mulhsu s11 x0 s6
-srai t5 s2 22
-sra tp t1 s9
-srl a5 x0 a4
-andi s10 t6 -672
-div s10 t2 a5
-addi s3 a4 1331
-slt a6 s6 a1
-mulhu a7 ra s2
-slli a7 t4 13
-slti ra s1 1680
-div t2 s5 a4
-add tp a0 x0
-srli a4 a1 23
-add s1 s7 a5
-remu a1 a0 s7
-and a5 t6 tp
-lui gp 186497
-divu s10 s10 a3
-and s3 s7 tp
-auipc s8 340004
-or t5 a3 a2
-mulhu x0 a0 t3
-mul a2 ra a7
-and s0 t6 t5
-srl t1 s3 t1
-xori s1 t0 -1920
-sltiu s10 a6 -1462
-divu s9 tp t3
-ori s10 a4 -915
-divu s8 s11 t5
-or s9 a0 t5
-or s0 a2 x0
-sub s5 t4 s9
-srai s2 a3 11
-sub s11 s1 t0
-div a7 a3 s6
-auipc s1 841848
-slti t6 t3 -434
-divu t2 t2 tp
-slli s2 t5 31
-slli a5 t6 4
-srl a1 a7 a0
-addi x0 tp -1392
-divu t6 t5 s7
-andi a6 s1 -1567
-and s2 a4 a0
-mulh a1 t6 s0
-sltiu a0 a3 176
-addi t6 s7 823
-xori a0 s10 -842
-mulhsu s2 s3 tp
-xori s5 tp -1080
-andi a7 s0 -983
-remu tp gp t5
-mulhsu ra a7 a2
-lui s0 450747
-mulhsu s11 t4 t0
-sltu a0 s8 x0
-sltu tp s7 t3
-div x0 t4 a6
-xor s1 x0 s11
-mulhu tp s10 a7
-srl s9 t2 t0
-remu a4 a6 s4
-sra ra s5 t3
-addi a6 x0 -182
-mulhsu s10 s11 a6
-sll s1 s1 s0
-srai a7 s7 6
-and gp s3 x0
-mul x0 s11 a3
-sltiu s8 s11 -605
-xori t3 a4 -429
-srai s1 a6 27
-divu a1 tp s5
-sltiu t5 a6 -160
-slti s3 a7 1385
-mul x0 s11 s11
-sltiu s5 a4 -595
-addi s6 s8 -1827
-slli t0 s9 4
-srl a1 s0 s11
-or s10 s7 tp
-mulh a4 gp s10
-andi s8 s5 937
-srl ra gp t6
-lui s0 585013
-slt t3 t2 s5
-sltiu s7 t4 1623
-divu ra t1 s9
-or x0 x0 s8
-auipc s11 853076
-auipc a2 123506
-srai t5 a5 30
-sra tp s2 a3
-srli a2 ra 29
-slti s5 t5 -1147
-srl x0 t1 a1
-add s6 t0 t2
-mulhsu x0 ra s1
-sub a0 ra s11
-addi a6 a7 -424
-div a4 tp tp
-xori gp t5 -870
-rem x0 gp a1
-srai t0 s0 22
-ori s1 a3 -335
-mulhu s0 a1 s2
-add tp s8 s5
-remu a3 a4 s8
-lui ra 874701
-or ra s0 s0
-xori a6 a6 -1620
-and s6 s11 t0
-rem s1 s11 s2
-or tp a1 s6
-xor a3 t2 s5
-sll s5 a4 s10
-sub t1 t3 s10
-xor a7 t0 a6
-and a0 t3 tp
-sll tp tp ra
-mul t5 s10 s7
-divu a3 s2 s10
-addi x0 t1 -631
-addi t2 s3 -1719
-slt t3 s9 t6
-sub t0 a5 t6
-slti s2 s4 1137
-or t1 s9 t5
-xor gp s2 s0
-mulhu t4 gp t1
-auipc tp 1046778
-div t5 s1 t4
-div a3 ra a4
-sltiu t4 t1 655
-or s7 a4 ra
-sub t2 gp t5
-mulhu a6 s1 ra
-mulh s1 gp gp
-xori a4 t6 -1748
-sub t5 t2 a3
-sll gp t6 a6
-sll x0 a0 s6
-srai a6 t4 5
-or x0 s8 a0
-addi t1 s11 -215
-xori s5 a2 1442
-sltu t1 t3 t3
-add s7 s10 t6
-addi s7 a0 -543
-sll a4 gp a4
-srai s1 a2 2
-and t5 gp t0
-or a4 t2 x0
-slti tp x0 38
-mulhu t5 a4 t4
-slli a2 x0 25
-slli t3 s0 11
-sll a2 t5 tp
-slti t3 s10 -910
-mulhsu s5 s9 gp
-mul t6 ra a3
-sll t4 t3 a5
-sltu a1 t3 s6
-or a7 s9 a4
-sub t1 s9 s8
-sra a5 a5 t2
-sltu t6 s9 s6
-auipc a7 430982
-xor a3 s0 s8
-sltu a3 gp a2
-sll tp s6 a2
-sltu s10 t4 x0
-sub a7 a2 t6
-addi t4 t3 -2019
-slli a7 s3 13
-remu a1 t3 ra
-sub t4 tp s6
-slt t3 t2 a0
-mul s11 t6 x0
-lui x0 3794
-add t5 a1 s9
-auipc ra 931499
-sub ra s5 t3
-andi s2 ra -1817
-slli t2 s4 8
-div tp s3 t4
-srai ra t3 26
-srli ra s10 29
-mul ra s4 ra
-add s5 s0 s2
-srai gp t4 2
-srli x0 s11 4
-auipc a7 517449
-sll a3 ra s5
-srli t2 s9 25
-div t3 gp gp
-mulhsu a6 t1 s5
-div t0 s8 a1
-divu s11 s5 s11
-auipc s1 826248
-srl s4 x0 ra
-andi ra s11 1247
-sltu t6 t1 a7
-mulh t3 s6 t6
-srl s1 s3 s10
-xor t4 s2 a4
-addi t3 a5 -139
-ori gp s0 -1638
-srli s2 s8 9
-lui t6 476
-rem ra s9 t0
-slti a4 t1 -1807
-or t4 t5 gp
-slti s9 t4 -50
-xori tp s0 1813
-and t2 a2 s11
-ori s2 x0 -182
-lui tp 110137
-slti a3 a1 -1912
-srl t3 a7 s5
-sltiu s3 a6 -99
-lui t0 932302
-mulh t3 t1 s0
-slti s7 s10 -95
-mulhu tp a4 s6
-remu a2 a2 a0
-div s7 tp s10
-slt t2 t4 s8
-div tp x0 tp
-addi a6 ra -1627
-divu t6 s6 a0
-sra a5 s0 t0
-or t3 gp s1
-mul x0 s6 s7
-mulh s2 t0 s8
-ori t1 x0 173
-xor a7 s1 a6
-srl s3 a2 s4
-remu t5 s6 s2
-srai s4 ra 17
-srli a1 s4 26
-ori gp s0 -1920
-mul s4 t6 t3
-mul x0 x0 a3
-slt t4 s6 t2
-sltiu s3 t4 813
-slli a0 a7 12
-sra s2 a3 s10
-remu s5 t1 s6
-mul s5 t4 x0
-add x0 s2 t4
-sub a7 t0 x0
-mul t5 s11 a6
-sll s4 a0 s5
-sll t3 t6 t4
-lui a3 875856
-mulhsu s3 a4 t1
-sll s1 s11 a2
-srl s10 t5 t5
-sltiu s7 t3 167
-srl t2 tp s10
-mulhu s10 t2 a6
-addi a0 s6 808
-srli a3 s0 18
-mulhu a2 s6 ra
-ori t5 tp -1399
-xor t0 s3 s10
-mulh a7 s5 s7
-lui tp 145907
-mulh a4 a2 s6
-srli s7 t3 19
-ori tp s2 -1963
-sub s2 s3 t0
-slti x0 s10 -1079
-or s10 t2 s7
-rem s5 a7 a0
-add t1 t3 a3
-sll a2 s10 tp
-remu a1 t4 t4
-sltu x0 t3 t1
-divu a1 ra t5
-mulh s1 t2 ra
-mulhsu gp a6 tp
-sra s6 tp s0
-lui s9 535187
-slti s4 s6 -635
-slti s7 a4 -1355
-srai s9 a7 8
-slt s1 s5 s6
-remu t3 s7 a6
-auipc a5 352181
-slti ra a7 -77
-slti s1 a0 -396
-remu a1 s11 t3
-mul s10 ra x0
-mulh t6 s8 s1
-srl a1 s3 a2
-xor a7 a1 gp
-sltu s6 a5 s5
-divu s1 t1 s3
-auipc s3 135300
-xori s9 a1 694
-mulhsu tp a5 ra
-srl gp a5 a3
-and s0 a6 tp
-div s1 x0 s0
-auipc x0 408745
-addi a6 ra 1512
-or s0 t5 a2
-srli x0 a0 22
-slli t0 s1 5
-divu t1 a5 t5
-sub gp t1 s2
-sltu s9 a5 a5
-slli t3 a0 6
-xori t0 s7 -1972
-or a4 x0 s3
-lui x0 608953
-srai a2 s7 16
-mul t6 a2 x0
-xor s2 s8 t6
-rem s4 a3 t3
-auipc a1 545775
-div a4 t6 s0
-sub s9 s11 a1
-mul t1 s0 s9
-sltiu a0 s9 1650
+sll a5 a6 ra
+mulhsu s7 a7 a4
+xori s0 t0 -785
+andi s1 s10 -1722
+sub x0 t4 s7
+srai s1 gp 22
+add a2 a7 a5
+remu t4 a6 t0
+add s4 t4 s3
+sltiu t4 s3 -44
+addi a1 t1 -1810
+srli s4 a5 22
+auipc s3 58621
+slt s7 t4 t4
+remu s10 t4 t6
+slt t3 x0 t2
+srl a5 ra s4
+remu s9 ra a6
+remu s6 s4 tp
+xor s1 a2 s9
+mulh s3 ra tp
+add x0 a0 a2
+slli s4 a2 1
+addi t5 t6 -119
+sltu s3 a4 t6
+addi s8 a2 1472
+sll gp t4 tp
+srl t0 t6 t2
+add a1 s11 s5
+srl t0 s9 s9
+sub t4 a7 s5
+slti a0 s7 -1948
+andi s8 a6 -551
+div t6 a6 s4
+slli a4 a1 26
+slt t4 s4 t1
+slti s11 s10 1234
+sll s6 s8 a0
+mulhu s1 t1 t4
+xori t4 s2 -692
+ori s3 t0 -1324
+and s10 tp s2
+auipc t3 348720
+sra s10 s1 tp
+and t3 s8 a3
+xor t0 a1 s2
+andi t4 a7 569
+srli s4 a3 22
+sltu t0 t6 a4
+div s10 a3 s4
+srli t6 s3 1
+sub t6 tp s8
+add a2 t2 a3
+ori ra t2 -1508
+sll t5 a7 a2
+or s2 t2 a3
+slt s0 s4 t2
+srai s5 gp 4
+andi s6 t2 -1229
+div a3 a0 t2
+lui a3 541920
+slli s2 s3 6
+and a4 a4 ra
+and s1 a4 a0
+auipc t1 976430
+mulhsu a4 a7 s1
+ori t0 t0 338
+or t4 a0 t3
+sll t3 x0 a0
+xor a5 s10 a5
+slli a4 t4 16
+auipc gp 88861
+sltu t0 s5 s7
+sll a4 s11 a4
+mulh t3 a3 a0
+ori a4 t2 -1593
+xor gp t4 a6
+xor t0 s1 s8
+sltiu t1 s9 134
+xori a7 s6 -1220
+rem gp s9 t5
+slt s8 gp s9
+sub a1 a2 t5
+add s7 s8 a4
+sra t4 t2 a0
+xor s9 gp tp
+ori x0 s2 -119
+sra a2 ra s11
+xor tp s8 s2
+slli t5 s8 2
+xor s4 t4 s8
+auipc a5 309841
+add x0 tp gp
+mulhu tp ra gp
+and a4 tp s7
+rem s3 s6 a3
+srai ra t5 6
+sub s1 s4 a1
+andi t6 s11 1365
+sltiu s0 gp -230
+mulhsu a1 t5 t6
+sltiu a4 s2 -1788
+addi x0 s1 -1132
+srli t3 a7 5
+mulh t0 gp s2
+mulhsu x0 t2 s11
+slti t4 t0 -1968
+add x0 t3 t2
+xori x0 s8 -1327
+srai t4 a7 3
+srl s5 a2 x0
+rem a2 t6 s2
+srli s4 tp 18
+addi x0 s0 429
+srai t0 a0 30
+divu a3 s4 t6
+mulhu s2 t1 a0
+slt a6 t2 ra
+addi s11 s9 -1203
+sub x0 a7 a5
+sll a4 s9 t0
+or t4 a4 t3
+remu ra s0 s0
+sub a0 t5 s11
+or ra t3 s3
+addi s7 a6 -129
+or t6 s8 s9
+srai s2 a7 11
+mulhu s6 x0 ra
+sll a6 a1 s8
+sltiu a5 t5 432
+slti x0 a6 -1565
+ori a6 a5 1282
+add a2 a4 t0
+ori a5 t3 -1065
+divu s5 a5 s0
+add t1 t3 t0
+sll s10 a1 t3
+ori gp a1 1797
+slti t3 s8 722
+divu a5 a0 s8
+rem s11 a7 tp
+and s9 s0 t2
+divu x0 a4 s3
+divu x0 s8 s10
+auipc s10 646249
+sub a6 s5 a6
+add t1 s9 s11
+mulh a6 s2 ra
+auipc s2 666395
+srl a5 s6 t3
+remu s4 t6 a5
+auipc a7 589554
+remu s7 t1 s9
+rem x0 ra a7
+mulhsu s11 x0 s0
+slli t1 s10 8
+mul s11 s3 t4
+sltu gp t5 x0
+slt s9 s7 s2
+mulh ra a2 s6
+sltiu s0 s8 -1468
+addi s3 a0 -111
+auipc s3 412454
+srai t6 gp 5
+xor s5 s1 a7
+sll s3 a3 a2
+lui a7 418109
+rem t1 s3 t0
+lui s6 704258
+xori tp s11 -880
+xori s8 a1 1978
+rem s10 t1 t6
+mul a6 s11 s4
+andi t4 a2 -1726
+rem t3 a5 t2
+ori s7 s0 862
+addi s2 s1 -802
+rem a5 s2 s4
+auipc x0 468201
+slli ra a1 6
+or tp x0 s6
+slli s9 tp 13
+auipc s2 760231
+lui s8 216540
+slti t6 t2 -1383
+sll t3 s11 a4
+add t0 t1 ra
+auipc s1 826119
+andi a3 a2 -735
+xori s3 a7 1196
+mulhu s6 t2 s4
+lui s2 686126
+addi s11 s6 67
+sra a2 s7 s0
+slti s6 t3 -1697
+srli gp t6 8
+mulhsu a0 s4 t0
+sltu s3 s0 gp
+srl a3 s1 t2
+xor s4 gp t3
+addi ra t3 -1108
+divu s9 a6 a2
+slli t1 s5 5
+srli t4 t5 13
+srai a3 t4 18
+auipc t0 299547
+ori s3 x0 836
+div a4 s6 tp
+or s11 s9 s3
+mul s8 a3 s3
+mul s4 s3 ra
+mulhsu x0 s10 s5
+and a2 a0 tp
+div s6 a6 ra
+slli ra s8 0
+mulhu gp s9 s10
+div s1 s9 s7
+srl a5 a0 a2
+divu x0 a4 s0
+xor tp s0 a7
+mulhsu a6 s4 tp
+xori s2 a7 -869
+mulh ra t3 t1
+sub a1 a5 s4
+auipc x0 794685
+add t4 a0 gp
+andi t6 s1 -731
+or t4 s9 t2
+srl s11 t0 s4
+auipc t6 974413
+mulh x0 a4 x0
+srai s3 s6 22
+andi s7 t1 -559
+auipc a2 226513
+sltiu s5 s10 -131
+mulh ra s4 t4
+remu s10 t5 t3
+sub a6 s1 t0
+sra t3 s10 t4
+div gp t6 a5
+srai s5 gp 5
+remu a1 s7 x0
+sll t6 tp a3
+slt a3 gp s8
+addi s2 s11 -1706
+mulhu s2 t3 a4
+remu t6 tp s10
+mulhsu s5 a5 t0
+div t5 t3 s7
+auipc s7 827201
+lui ra 243499
+slt t0 t5 x0
+rem a5 t2 a5
+sltu a3 s1 t1
+rem t2 s11 t6
+srl t6 s7 gp
+slti t1 s8 -37
+sltu t0 t4 s10
+srli s10 s11 31
+sra t1 t0 a4
+sub s8 s5 s4
+xor s6 t1 s0
+ori s11 s0 -1534
+slli s7 a0 28
+srai s5 a3 27
+srli a2 x0 4
+slt s0 s5 t6
+slt a5 ra s3
+sltiu s2 ra 964
+ori s5 a1 941
+or gp a2 a7
+addi s5 a6 -464
+rem t3 s6 a4
+slti gp s9 1480
+sra s1 t4 s8
+sltu s9 x0 s9
+or a3 t1 s3
+sub a1 s8 tp
+mul a1 s4 tp
+xori a7 t6 392
+xori t6 s7 4
+slti ra t4 -1891
+remu t0 ra t6
+andi x0 a1 -1166
+and s5 s4 s3
+sll a6 a6 gp
+slt t4 s11 s10
+srai s5 s7 7
+xor t2 s6 s1
+slli tp s2 30
+sra t1 s10 s2
+auipc a1 551692
+slli s6 t6 22
+and s7 gp a0
+srai s5 gp 4
+srli t2 t4 15
+ori a6 s4 -943
+xor s0 s2 a4
+slt t6 a3 tp
+mulhu a2 ra s1
+sltiu a5 a3 371
+andi t0 a0 -2027
+divu t6 s6 t1
+addi a1 s5 -195
+rem s1 x0 t0
+remu gp s9 s5
+mulhsu s5 gp s8
+sll a0 a4 s6
+xori a0 s7 -779
+srli tp s0 27
+or s0 s4 s2
+rem t5 s1 t1
+andi t1 t3 -647
+divu s0 s3 ra
+and s2 a5 t1
+mulhu s2 a1 a7
+xor s2 t5 a1
+and t4 t4 tp
+div ra gp ra
+xor tp t1 t6
+remu s10 t1 a2
+slli gp s3 27
+sll s7 s8 a7
+mul s8 s2 a1
+andi tp s10 -1155
+mulh s1 a5 s10
+slli a0 s3 31
+xor s2 ra ra
+slli gp a5 14
+divu s9 x0 a6
+slli ra s9 0
+sltu a0 tp s2
+xor s4 a3 s1
+auipc t5 453480
+sll a7 t5 a3
+auipc a1 31802
+xori t1 t5 1245
+remu a6 tp a5
+mulhsu a1 s9 t4
+sub a7 t5 a5
+mulhsu a7 s4 s3
+srai tp t1 9
+slli x0 s10 14
+divu a7 a0 a4
+mulhu s8 t5 a6
+ori ra s8 -81
+and a3 t0 a2
+mul t0 a2 s1
+div s8 ra s1
+mulhsu a6 t4 a0
+add s1 a4 s5
+andi a6 a7 -410
+remu s7 t3 a5
+slli t1 s10 2
+div s0 t4 a6
+sltiu a0 gp -341
+sltiu a4 s1 -1576
+remu a7 s1 gp
+auipc s4 319862
+ori t6 s5 -355
+mul a0 a5 s2
+slli s11 a3 9
+sra a7 s10 x0
+ori s0 s5 -1079
+or s7 t3 a3
+srai t6 t3 0
+remu tp s7 t2
+div s8 a5 a5
+andi s8 s1 -2028
+sll t4 t6 t5
+slli t5 s3 28
+mul a1 tp t3
+sra t5 a7 s11
+and s7 t1 s0
+srl a5 t1 s9
+slti a0 s6 -261
+sub s3 s3 s6
+divu s4 x0 t1
+sra a1 t2 a1
+divu t1 s6 tp
+mulh s8 t2 a7
+sub s3 a5 s10
+or s7 s6 tp
+mulh a4 a0 a2
+or t4 a1 t5
+mulhu x0 t6 s3
+srl t6 s5 s8
+srl s10 s8 t4
+add a4 t4 s10
+andi t2 a2 -918
+mulhu t5 s0 a1
+sra a1 s5 s7
+mulhsu t0 s11 t3
+srl s0 a4 t4
+divu a5 a2 a3
+srli t5 s2 19
+auipc x0 373121
+srl t0 a5 a7
+lui s5 796651
+and a5 a0 x0
+or a7 a2 a2
+div t4 s1 a7
+andi a2 t0 -621
+andi s4 a6 -1551
+mul a1 a5 s10
+rem t6 s9 s5
+sra s3 ra s11
+slt s3 a1 s7
+auipc gp 241556
+lui a5 670848
+auipc t1 650721
+mulh s1 t6 s6
+xori a3 s1 -1715
+srai t0 s1 27
+remu t1 ra tp
+srli a4 gp 30
+srli s1 t3 12
+or a3 s1 s7
+slti t2 a4 594
+sltu s10 s3 t1
+lui s10 505131
+slli a5 a4 16
+lui a4 271996
+mulhu s11 t1 s2
+ori s7 s11 -1821
+sltu a2 a2 a1
+sra t5 s1 t5
+srli t3 a4 9
+div t2 t6 s7
+slli a4 a3 10
+sub s0 a7 t6
+slli s3 a4 2
+mulhu a5 s7 t0
+andi s3 s6 -1012
+xor a1 s11 x0
+rem t2 t3 t5
+xori t3 s5 -991
+srl t4 t1 a3
+slt ra a3 a6
+sltiu s0 t2 -1454
+or a2 s1 t0
+mulhu s7 tp a1
+xor s4 s7 t5
+and gp s10 ra
+rem s6 t3 a3
+auipc s0 974980
+mulh s4 a7 t3
+sltiu t4 s7 1208
 sub s6 s2 a0
-sra s9 ra x0
-xor s10 s0 t0
-rem t0 s4 a6
-mulh gp tp a3
-andi a7 a7 -488
-rem a7 a1 s9
-sra s4 a0 s9
-sub x0 t2 gp
-add s2 s3 t3
-or a2 t3 s0
-and a6 a6 a3
-divu t2 t1 t0
-lui a7 102393
-slli s10 s5 2
-div a0 s11 s7
-xor s5 s1 ra
-and a7 s7 s1
-div s8 s10 a2
-mul a6 s10 tp
-sub a2 t5 t6
-srli t2 t6 21
-auipc gp 135605
-srl t6 t0 t6
-divu a0 a0 t2
-sltu t1 t5 s5
-srai s3 t6 31
-rem s0 t1 a3
-lui t6 831674
-lui s7 1024303
-slt t3 s3 t5
-sub ra s1 t5
-auipc s10 1031106
-lui s8 775847
-rem t3 a3 a0
-lui a2 536670
-auipc s9 15987
-sltu a7 s7 a4
-ori x0 a2 300
-srai a5 s8 21
-lui t1 685295
-mulhu a1 x0 s2
-mulhsu a5 s5 t4
-addi a2 s11 -1431
-div t0 a7 a4
-or a2 s9 s1
-ori s5 s7 -600
-slti a5 a4 636
-addi t2 a7 1320
-xori s7 a7 -1921
-div s4 x0 t3
-slt s10 t3 t5
-mul a1 x0 x0
-ori t6 s5 -1228
-ori t3 t2 -349
-lui s11 159989
-sltiu tp t0 2036
-srl x0 t3 a6
-and a3 a7 tp
-xori t3 s7 -713
-addi x0 x0 -1105
-div s1 a5 ra
-rem s7 t6 a7
-mulhsu a4 x0 a6
-mul x0 t2 a0
-slti s9 a1 -937
-div x0 s1 a5
-srli s6 s5 9
-mulhsu a3 a6 a7
-or s1 s2 t6
-xor t5 a7 a0
-mulhsu a0 t4 x0
-xor s10 s1 tp
-div s6 gp s4
-andi s0 a5 -889
-mulh ra a3 a7
-remu a3 a2 s6
-andi s5 x0 -696
-andi t0 s11 -1409
-and s7 a1 t4
-add s10 gp t1
-slti x0 s8 -1671
-mulhsu t4 gp s3
-ori x0 a1 514
-add t3 a5 s11
-rem s2 t6 a4
-div t5 s9 a2
-slti a2 t5 1551
-srl t6 t6 t1
-xori s5 a2 1647
-andi a0 s8 1947
-and s9 t6 a5
-rem s8 s10 a0
-sltiu a5 s2 498
-sltu a3 t4 s10
-sltu s10 ra t5
-mul a7 x0 t3
-srl s11 a0 a0
-sll ra s5 s8
-mulhu s9 t6 t3
-ori s3 s9 -512
-slli gp a4 2
-divu s1 t1 a3
-mulhu a7 t6 tp
-sub s7 t0 x0
-and tp ra t3
-sub s7 s0 s1
-addi t0 a3 -1756
-sub t5 s7 a5
-or a7 t0 s4
-div s3 a7 t1
-srl s11 x0 tp
-xori s4 t0 -41
-rem t5 s10 x0
-or a2 s2 s4
-xori a6 a1 -717
-slti s9 t3 -530
-div t2 a6 t2
-srl s9 s4 t1
-sltiu s0 a5 -1649
-srai s10 a5 9
-mul a1 s3 a2
-sub s9 a5 x0
-remu gp tp s11
-and a0 t4 t3
-mul s5 ra a3
-add s9 s8 t5
-slli t4 t6 30
-xor t2 t2 a7
-or x0 gp s10
-xor a6 s1 a6
-sltu s11 a3 t5
-or t0 t0 a2
-sltiu s10 t5 -951
-auipc a5 174487
-add a0 s10 a6
-andi s3 a2 -1623
-andi a7 a2 -1167
-div t4 s0 a2
-sltu s9 s8 tp
-addi t0 s9 -1783
-srl tp s10 a0
-divu a5 s10 s10
-or x0 t1 t2
-sltiu s5 t5 -142
-srai a3 s1 7
-sll s5 a3 t4
-mul s3 t2 a1
-sltiu a1 t0 -438
-mul s4 x0 x0
-slti x0 s9 1784
-srl a4 s10 s3
-auipc x0 588314
-divu s6 a3 a4
-sltu t3 s10 a1
-mul t1 t1 s0
-add t0 s1 a5
-sltu a4 s11 x0
-divu s4 t4 s10
-auipc t2 840587
-slli a6 s0 4
-slti a4 t3 902
-slti s6 t3 807
-add a3 s11 t5
-rem s3 s4 s10
-add tp a0 s10
-slt s1 x0 t5
-divu a1 a1 ra
-andi tp a0 -1261
-srai a4 a4 10
-sub a5 s10 s3
-xor t4 s10 s3
-divu s8 s2 a4
-mulhsu t0 a7 s7
-sub s2 s7 t1
-and x0 s9 a0
-srl a6 s1 x0
-mulhu a5 t4 x0
-sra s10 a5 a0
-sra s3 tp t1
-mul t2 x0 s8
-mul s1 a2 a3
-remu s1 t6 t2
-slti a1 a2 -1143
-sra a7 t1 ra
-lui tp 452202
-slti t3 s10 -299
-divu s6 s11 a5
-xor x0 tp ra
-divu a3 s11 gp
-mulh a0 a0 t0
-srli s5 a6 22
-xor x0 s0 s10
-remu s8 s2 t2
-srai s10 s9 31
-sltu t2 x0 s7
-sub s6 s11 s8
-mulhu x0 s7 s9
-div a1 x0 a5
-slti s10 t6 -86
-mulhu s10 s0 t2
-divu a4 a3 s2
-sltu s10 s8 a6
-xor t4 x0 a3
-sltu a1 a3 x0
-sltu t5 x0 s0
-mulhsu a7 a4 a1
-srli a0 t0 29
-add a3 tp a3
-sra a2 s7 s10
-addi s6 s8 -1196
-xori a0 s1 -1094
-sltu s8 t3 t3
-slli a6 s3 19
-sra s2 a4 s0
-slti a2 s3 -79
-sltu s0 t3 s0
-addi t1 t6 -153
-slti s11 s5 186
-slli a1 s1 8
-mulhsu a7 tp s0
-andi a1 a0 1653
-slli t2 t3 26
-mulh s8 gp t1
-xori t5 a6 -1436
-divu s4 s7 ra
-slti x0 t4 -1560
-addi ra t3 -881
-srai x0 s11 10
-andi s8 x0 1941
-srl a3 s3 s4
-auipc a3 486110
-auipc tp 475391
-sltu a6 t0 s5
-slli t0 a1 0
-slt s1 t6 s11
-xor a3 a7 t4
-srai s11 x0 30
-divu tp s10 a0
-xori t6 a3 -917
-andi s11 a6 -1265
-sltiu t2 s0 -1303
-addi s11 a7 -483
-sltiu a5 t3 -2044
-ori tp a4 -876
-rem s3 t3 a2
-slt a4 s2 a4
-srai s7 s8 30
-auipc s6 470741
-sltiu s1 t2 -613
-xor s5 t3 x0
-sub t2 t0 s5
-sra s9 s6 x0
-xori a7 s1 1408
-or t2 s1 a1
-div x0 gp s0
-addi a7 t1 180
-xori a7 x0 604
-mulhu s0 gp tp
-srli s7 t1 9
-lui s7 508122
-andi a1 s10 -1783
-lui gp 975345
-ori s3 ra -885
-div s7 s10 a6
-mulhsu a4 s3 a2
-add a1 s6 x0
-slt t5 s4 s9
-auipc s5 289216
-slt a3 a3 s9
-addi t3 s0 -1312
-rem t2 s3 x0
-xori s4 t5 -44
-mulh a7 s9 a0
-div ra t2 a5
-srl a7 s9 a5
-mulh s4 t3 s11
-sub x0 s11 s6
-div s0 a2 s0
-mulh s0 t5 a0
-sltu t3 s6 a5
-sub t5 a2 a0
-sltu s8 s7 t0
-remu ra a5 a1
-addi a7 s10 -45
-srli t6 t1 29
-mulhsu s9 s4 t6
-sll gp a3 a1
-sub s5 a7 ra
-slli t1 t1 17
-slti a7 s10 1728
-mul s9 ra gp
-div t3 a7 a3
-or a2 s2 s0
-srl a1 t0 a2
-addi t1 s4 -866
-ori s4 s6 -1730
-add gp s7 s7
-addi s9 t6 -1267
-auipc a3 460463
-xor t4 t4 a5
-ori s2 x0 -807
-auipc a1 891168
-ori a2 s10 -1662
-sltiu s9 a4 1886
-auipc tp 623641
-srai s3 s10 0
-srli x0 s8 8
-slt t1 tp s10
-add s8 a6 s5
-sra a4 t5 a1
-andi s4 a2 1349
-addi s6 s1 -218
-div a6 x0 s6
-remu gp s2 x0
-add x0 t2 s3
-or ra tp gp
-sltu s0 a7 t3
-addi s0 ra -432
-rem a0 t1 a1
-divu s2 s6 a3
-remu s7 tp a2
-divu s2 s6 t6
-slli ra x0 26
-srl a3 a5 gp
-xori t5 a1 -1644
-srai tp t5 30
-srai t3 a6 22
-andi s11 t5 1434
-slli t2 s8 0
-xor tp t2 tp
-and a2 x0 s11
+slti x0 t0 362
+xori s0 a2 -1160
+slt s6 t1 a5
+srai t3 t2 20
+srai s9 s7 14
+add t2 s8 x0
+sra t2 s8 s5
+sltu a2 t0 s11
+addi t6 a2 299
+and s3 s9 t3
+lui s5 1017256
+ori gp s4 701
+rem x0 a4 s3
+addi t5 s0 -1342
+or s11 s11 a0
+and a1 x0 s10
+sra a0 t6 s9
+remu a1 t4 s11
+sltiu s8 s4 -26
+srli a7 a4 24
+and s7 a6 x0
+rem s10 tp tp
+mulhsu s6 ra s6
+mulh a7 tp ra
+sltiu s11 a6 -1016
+divu s9 a3 t6
+auipc s3 724419
+or t3 a0 ra
+remu a5 s0 t2
+ori a7 s1 671
+sra s11 t4 x0
+mulhu s9 t3 s7
+divu a5 a7 s4
+srai s6 s2 30
+slti a2 s8 -1504
+addi a3 t6 -498
+div s7 tp s5
+mulhsu a4 s5 t0
+ori s10 s3 -1382
+ori s4 tp 516
+sll t3 a0 a1
+add s9 a5 s0
+mul t5 s11 a0
+sltiu tp t3 486
+srai x0 s1 18
+andi ra s5 -1387
+mul a3 s5 t3
+divu a3 a5 tp
+addi a0 x0 1650
+slli s0 t1 14
+xor s4 s10 s7
+mul x0 s11 s7
+sub s1 t5 s4
+rem s4 a3 tp
+xor s3 t6 t3
+mulh a0 t6 a3
+xor s2 s7 ra
+xor t2 s5 s7
+slt a3 s10 a2
+xori s0 t3 -1886
+add a7 t5 s9
+divu a7 s4 s1
+remu s10 s6 t1
+slti s11 s5 1795
+srl s8 t2 t6
+srli t6 t0 4
+mulh s10 gp s2
+andi s0 gp 1868
+sub s0 a2 s8
+sra s11 t4 a1
+div t5 gp t2
+add a0 a5 s9
+slli s0 t2 21
+ori s2 t1 986
+sltu s9 s1 a6
+lui s3 6525
+ori s0 t5 -28
+auipc a5 37190
+rem a7 a6 a7
+lui a6 566582
+xori s0 tp 1885
+auipc s2 196187
+rem a3 t5 s10
+remu a6 t2 s7
+lui s4 135708
+slt s9 a0 x0
+andi a5 s9 -519
+divu t3 s6 a0
+xori a6 s10 -54
+divu s10 s9 s3
+xori ra t6 -1317
+srai tp a3 23
+sra gp gp a7
+addi s6 s0 -1059
+auipc tp 707558
+div t1 s6 a6
+or s9 t3 t0
+lui a7 236907
+or a3 a7 t3
+andi a1 x0 -1672
+div a4 a7 s3
+mul s8 s8 a7
+auipc s5 304484
+or s0 s6 gp
+and s0 a6 a7
+div s5 s10 a2
+div s9 s6 t5
+slt s2 t3 a0
+srli s4 t2 26
+remu t6 a0 t1
+rem t3 s11 s4
+and s7 t4 a1
+sub a3 s6 s11
+divu a0 t5 s11
+sra a7 t1 gp
+addi t6 s4 -1968
+div t0 a7 x0
+or s2 a2 s0
+xori a7 tp -1363
+srli x0 gp 3
+sltiu t3 t0 1191
+mul a3 a2 s5
+mulhu a7 s7 a5
+mul x0 s8 s5
+sra a0 s2 t1
+lui s5 156695
+srl t2 a6 t3
+slli s10 s9 21
+remu t3 s10 a4
+slli s2 s8 4
+lui a2 356062
+auipc a6 109754
+srai s7 a4 3
+mulhsu t0 a4 s5
+sll s8 a6 s0
+auipc s5 922230
+sll s3 t2 gp
+mulhsu t3 x0 t1
+sub s11 t0 s3
+slt x0 a1 tp
+remu s11 t4 s11
+srai t5 s6 20
+slt a7 s10 t2
+sra s1 s11 t6
+slti t0 s2 1592
+andi a1 gp 1228
+mulh s9 a2 s9
+sll t5 t4 a6
+srli t1 t3 11
+rem a7 t6 a7
+remu s3 s5 x0
+slli t2 t0 18
+xori tp gp -1578
+sll t3 s9 tp
+andi a6 t4 909
+slti s4 t0 1660
+sltiu s8 s0 -1855
+lui a4 100250
+sltiu t2 s3 -1994
+slti t1 x0 284
+slti t4 a4 -735
+mulh a1 t6 ra
+andi a5 s0 544
+srai s6 s3 29
+xor a2 a3 gp
+add t2 a4 s8
+rem a4 tp s9
+or ra t1 a6
+addi a0 s8 -2032
+mulhsu t5 t3 s10
+addi tp t3 -175
+slli s4 s6 4
+mulh a2 a3 t3
+or t1 t5 s2
+slli s10 s11 0
+slt s4 a7 s9
+mulh a7 a4 a1
+and s8 a3 a3
+slli t5 t4 11
+andi a6 a1 -818
+div a4 t0 s2
+slti a4 a5 -1036
+andi a6 tp -656
+xori s0 s1 -1266
+slti s1 a6 -1835
+or t6 s9 a7
+sub s9 t1 t1
+mulhsu s0 x0 gp
+auipc t3 685128
+srli s1 s5 24
+andi s9 t0 -1593
+mul a1 t0 a5
+mulhu t2 x0 t1
+srl s3 a3 t0
+mulhu t1 a7 t5
+mul a0 gp a4
+addi ra s2 -1281
+or s11 a1 x0
+div t2 s2 gp
+sub s10 s11 t4
+slli s8 a6 10
+srai s5 t5 8
+mulhsu s10 a1 a4
+slti a7 tp 356
+div t5 t6 a5
+sltu t2 a3 s5
+mul s9 a5 s9
+mulhsu s9 t3 s8
+lui s6 872679
+sra s3 t5 a2
+xor a2 t1 s11
+sra ra a6 s2
+rem s7 a7 a0
+mul s0 tp t5
+addi s3 x0 1028
+and a3 s7 tp
+or a2 s1 t0
+sltiu s4 a2 1200
+sub s3 s3 s10
+slti ra x0 -538
+srli ra a2 1
+auipc t0 26026
+auipc t3 288178
+srli t0 tp 12
+sub s8 s10 a2
+sub a3 a7 a0
+mulhu s5 a6 s11
+ori s7 s6 489
+div s3 s11 tp
+mulhu s8 s1 t5
+mulh t1 a7 s5
+sll a4 s10 a0
+xori t2 s6 -1119
+ori t0 a1 -1116
+slli s3 s2 7
+or s6 tp t5
+mulhu s7 a3 t1
+slt s11 a7 s8
+srli s10 s3 14
+mulh t1 s3 s5
+mulhu x0 x0 s1
+or x0 t2 gp
+sll t6 a6 t6
+xor a7 gp s5
+and a0 a6 s4
+srl s10 a6 x0
+lui a1 904025
+srl ra s6 t2
+addi t5 t3 -1059
+srli s11 s0 31
+sltu s2 s4 s5
+lui a3 939133
+remu a5 s11 a3
+mul a3 a7 t6
+mul a2 ra s9
+sra s7 s5 gp
+add s4 t5 t1
+mul t6 s1 s0
+srl t3 a0 t2
+remu t3 a5 a4
+auipc s9 761535
+mulhu t0 s10 s0
+ori s5 t5 -171
+xori a4 s0 -1108
+slt s1 a7 s0
+andi a7 a2 502
+andi t1 s10 -89
+xori a6 s2 -1097
+slt s3 x0 a1
+xor t1 t4 a2
+srli tp ra 23
+slt a3 a5 a4
+div gp s1 s8
+srl s1 a4 a2
+srl s10 a2 s8
+slti a5 s1 -830
+xor a7 s7 s3
+and a1 a0 a5
+xori s6 tp -976
+divu gp t3 s9
+rem t5 s6 s2
+srl gp s6 t3
+addi a7 t0 -716
+or a7 t3 s9
+srli s3 gp 5
+and s2 a2 s1
+slt a1 tp t2
+srli s8 a5 28
+or s3 tp s1
+or a7 s1 s2
+or t0 a0 a6
+srl tp s8 s4
+xor a5 s11 tp
+sll ra s3 s9
+mulh s5 a3 t4
+srli t1 x0 3
+add t3 a1 a0
+xor ra a1 s7
+sltiu s2 s10 -992
+mul ra t1 a0
+slt ra tp tp
+sra t4 s9 s0
+xori t0 s6 1483
+add t6 s2 s10
+remu a1 s8 s8
+srai s8 t6 14
+sltu a2 a3 s4
+divu s1 s0 s11
+mulhsu a6 a0 ra
+divu s11 a7 s3
+slt s2 a5 a7
+or tp s8 s4
+mul a3 s8 a6
+add s7 s2 t6
+sub t0 x0 s4
+add s11 tp t2
+remu s0 a0 t5
+remu a4 gp s6
+auipc s10 260217
+xori x0 s3 -1363
+mulhsu a7 tp a5
+xor t6 t2 s9
+and s8 a6 t6
+addi s5 t2 -1284
+mulhu s9 s10 s0
+sltu a3 t6 a6
+slli t3 t5 7
+mulhsu t6 ra s1
+remu s8 s5 t6
+sltiu ra t4 -1353
+xor s3 a2 s5
+xor a0 t6 t6
+auipc t4 387358
+divu s11 a4 a6
+andi s5 s6 -33
+div a2 s10 gp
+srli s5 t2 2
+addi a2 a6 441
+sub t1 s11 a2
+add t6 s10 t0
+divu s9 t6 a2
+srai a5 s2 31
+andi s11 s2 -1219
+sltu s1 t1 s3
+sltu t1 a6 s8
+xor s11 s8 a6
+rem t5 s1 s2
+sll a7 a1 s8
+srli s6 x0 10
+srli a6 s0 11
+mulhsu s7 a1 t3
+srl a3 tp t4
+srl a2 s10 a4
+slli gp s5 8
+ori a5 s10 -1559
+mulhsu s8 s3 a2
+divu a2 a4 x0
+sltiu a1 tp -239
+mulh s6 a2 s7
+slt t6 s3 a0
+slli a0 s9 1
+divu tp t6 gp
+slt s8 s7 a5
+sra a1 s1 a5
+div t4 s1 s9
+andi t6 s5 -814
+ori s6 s2 1362
+sltu s0 a6 a2
+add a2 t5 a7
+auipc a1 859079
+rem s5 s4 x0
+rem tp s4 t6
+andi s2 a1 -476
+sll s11 t3 s11
+addi s9 a1 -1872
+slt t6 t0 a1
+remu a6 s2 s1
+mul a1 tp tp
+sltu tp s5 a3
+addi a7 s9 -1376
+and s8 s3 a0
+slti t3 s10 -1339
+mulhu x0 a2 s7
+xori ra s5 -490
+addi a1 s11 -767
+auipc s4 758537
+auipc a7 311813
+sltiu s5 s8 -1057
+and s10 a6 a5
+auipc t4 723481
+srli s2 t0 15
+sub x0 t2 t4
+mulhu s5 s3 t1
+mulhsu s8 a7 a6
+add a7 s7 s1
+slt s4 s5 t6
+slt s8 s1 t4
+xori x0 t6 -1985
+sub s7 t2 a2
+srl s3 s4 a1
+andi s9 a4 -752
+xori t0 ra -2010
+auipc t5 444646
+auipc x0 279618
+mulh s1 a7 s11
+mulh s9 s0 a3
+divu s5 t0 s7
+sltiu gp s1 -987
+srai s11 s10 27
+add tp gp s8
+mul s3 a6 s5
+sltu tp s10 a1
+mulh s0 a4 s8
+xor t1 t1 t0
+mulh s2 a6 a0
+mulh s11 a2 t2
+sltiu a4 t5 50
+srai a6 t6 12
+ori s8 t2 -88
+auipc a3 573673
+srai t4 ra 6
+or a0 tp t5
+slt t2 s6 s1
+or s4 a2 t1
+lui t4 247752
+slt s7 s9 t2
+sll gp a0 s5
+srli s9 a1 18
+mulh t5 s3 ra
+srai s2 a4 24
+rem a4 s4 s9
+slli s10 t1 4
+slti s0 s6 -1442
+sltu s10 t0 s0
+slli a7 s2 20
+sll s9 t6 s2
+sub s6 s7 t1
+sub a7 s9 t5
+and s5 a1 tp
+rem x0 a3 s4
+andi x0 s1 -456
+or s9 x0 s7
+xori a2 a1 -979
+srai t5 s5 15
+divu t3 a6 s10
+srli a7 t3 18
+slti a7 a0 -1872
+xori s7 s2 377
+add a6 a7 s5
+xori a7 s8 -1901
+andi s7 t0 -1105
+srli s10 x0 9
+sub t5 s6 s4
+xori t0 t2 -839
+srai s9 s3 11
+sub a0 a5 a6
+divu t0 t6 t1
+sra t2 t5 a5
+mulhsu s11 a4 t2
+rem s4 s11 s5
+slti a3 a7 -266
+remu t3 s2 s1
+sltu t3 x0 s5
+sub s4 s5 t3
+slt t0 t5 t0
+slli t5 s1 22
+remu s4 t0 t5
+sra a3 t4 a2
+andi s0 gp -1540
+sll x0 t6 s2
+andi t5 s10 -502
+slt gp s11 tp
+andi a2 t1 -1412
+ori t2 s9 -1273
+srl gp a3 s4
+sltu s10 s9 a1
+rem s10 t1 t2
+srli t4 ra 17
+mulhsu s5 s2 s5
+srli ra t1 8
+xor a5 a4 a5
+and s2 s5 s8
+slli s9 s6 6
+ori t6 t5 -1562
+sll s11 a7 ra
+xori t0 t6 -181
+srl s8 s6 ra
+andi s4 s9 -1293
+slti t2 s7 -801
+xor s8 a5 s5
+slti gp t3 -466
+slli tp s8 9
+remu x0 s8 gp
+mulhsu a5 t5 s0
+sltiu s10 s4 1730
+sra ra s5 s3
+lui s2 1019061
+mul t5 t2 a1
+remu a7 s9 s7
+rem s4 s1 t2
+sll t6 t4 s5
+add s3 s3 tp
+rem a5 a7 t6
+add t4 t4 a7
+add t6 t5 s7
+mulh s8 x0 s4
+auipc t6 837759
+or a0 s7 s0
+sltiu s6 t4 -1470
+sltu a2 s2 s4
+andi gp a5 848
+sltu t4 s1 s0
+lui t3 971195
+or s10 t4 tp
+rem a0 t6 s11
+mul a1 s8 s2
+ori s6 t6 -1976
+add t1 t2 gp
+lui tp 621469
+lui x0 89592
+sltiu t5 t4 -1539
+lui s9 288551
+auipc t2 301053
+xor s5 a0 a1
+andi s10 t1 -1242
+lui a4 54127
+sltu a7 s0 a2
+sll s1 t5 s11
+rem t3 s10 s5
+sltu gp t6 gp
+slli t5 s2 20
+auipc s8 852531
+divu s8 s6 a4
+div s8 tp t1
+srai a2 s10 1
+mul x0 x0 s7
+lui s7 261584
+div s10 s1 a3
+sub s6 tp s4
+div s1 t5 s11
+srai a0 s5 23
+rem s10 tp a0
+mul s8 s4 a4
+and s7 a5 ra
+remu t5 t6 t4
+srli s8 s11 6
+rem t4 t3 a6
+sltu a6 s11 s8
+slt a2 s4 x0
+remu t5 t3 s11
+auipc t0 84472
+ori a7 gp 471
+srai t2 s0 30
+mulhsu ra s1 t1
+slt x0 gp t3
+auipc t5 343932
+lui a4 817501
+divu a7 a0 x0
+remu a7 t1 x0
+xori a0 s6 -100
+sltu s5 ra a6
+slli s9 a6 24
+sll s11 ra s2
+addi s3 s0 -1623
+srl ra ra t4
+remu t1 t5 a0
+srli x0 a5 22
+slti a5 a3 621
+slt s0 x0 t6
+div a3 tp s6
+add a5 t6 s4
+divu a5 s9 a5
+xor tp a2 s1
+mul s5 t5 t4
+or t1 s7 s11
+div a2 a4 a1
+slt a1 s5 gp
+mulhsu gp t3 t1
+remu a3 s6 t5
+mulh a1 ra a5
+mulhu a0 s7 s3
+mulhsu s1 a6 a1
+addi s11 a7 2043
+mulh a6 s9 s1
+mulh t0 s7 s6
+mulhsu s2 a6 tp
+divu x0 s3 gp
+mulhu s1 gp a2
+srai s0 s4 25
+ori t5 s3 -1106
+add a5 x0 t1
+sll t1 a5 s0
+mulhsu gp s3 t6
+and s3 t5 s10
+sra t0 a0 s0
+addi x0 a6 -1323
+srli gp s1 2
+sltu a3 s6 s10
+rem s9 a0 t6
+mulhu t0 a2 s2
+srl s10 s8 a4
+and a5 s0 x0
+add a2 s6 t4
+slti s6 s7 -106
 mulhsu s2 s0 s1
-div t2 t4 s0
-remu t1 s4 ra
-slt a4 t6 t2
-sltu x0 s9 t3
-mulhsu t0 s10 s11
-sltiu s1 s1 871
-sll t4 s3 a0
-slli a2 a4 17
-auipc a6 65629
-div a0 a2 x0
-srl a3 a4 s0
-srai a2 t5 3
-slt s6 a4 t2
-slti s2 a0 -1114
-slli s5 s11 25
-slti s5 gp -1066
-sra a6 s9 t2
-slt s10 gp s2
-slli t4 s5 6
-addi t4 t0 -1097
-divu a3 gp s9
-ori s4 s2 -644
-xor t6 a2 a2
-sll s0 x0 t5
-addi s7 a4 -1885
-srai x0 a4 0
-auipc ra 733607
-div s10 t6 a6
-and ra a2 a6
-div s2 gp s10
-mulhsu s8 s11 s6
-sra s11 s9 tp
-mulhu s9 s7 a6
-mulh s4 s7 s0
-sra tp s3 s4
-mulh s7 s10 a4
-srai t6 t6 24
-add a0 a6 x0
-div s7 t0 t4
-srli x0 a6 15
-srli s5 s5 15
-sltiu x0 s1 675
-sltu s0 a2 s4
-sra a1 a4 a2
-xori x0 x0 -420
-mulh s7 s6 a3
-slti s7 t4 -2005
-sub a1 s9 tp
-srl t1 ra s4
-slli a2 t4 14
-lui t6 677228
-sub t2 s2 s11
-add tp a4 x0
-slt s0 a7 t4
-srli ra x0 26
-xori t3 x0 -2036
-slti s2 a7 -641
-slt s8 a1 s4
-srai t0 ra 10
-div s9 t3 a6
-addi s6 s7 -1450
-lui a6 1018880
-xor tp a3 a2
-mulhsu t4 s4 t5
-or t2 a0 s1
-sub a2 t6 a0
-sltu s4 t0 s3
-or s2 s7 s8
-div x0 a3 s5
-mulhsu t5 a7 a1
-slli s2 a6 31
-lui a3 448785
-xori t2 s4 -1937
-div t3 a1 s11
-sltu a6 s1 s4
-sra x0 tp s5
-sll tp t6 a7
-add s0 ra s7
-addi t1 s5 -1414
-remu gp s10 s7
-sltu a3 t5 s10
-xori a7 a7 500
-xor t2 x0 s5
-mulh s10 s5 s10
-srl t0 gp s10
-sltu s11 t0 t1
-srai s7 t5 8
-lui tp 296892
-srl a2 t4 a4
-srai t3 ra 30
-slli t6 t3 11
-mulh s5 x0 t3
-sltiu s11 t4 -174
-lui a0 310523
-xor ra s6 x0
-and s1 t1 s8
-ori s6 gp -201
-sll s4 a0 tp
-rem x0 s9 s4
-and ra a2 t0
-rem gp s10 s10
-mulhsu t1 s7 x0
-sll s8 s10 a1
-sra a0 s7 s9
-ori t1 x0 306
-sra a1 x0 x0
-mulhu s2 a1 s10
-addi t1 a4 -1787
-div a5 ra s5
-remu s5 s1 tp
-div a0 s5 a1
-rem a7 t3 s6
-sub t1 x0 s6
-sub t5 x0 s11
-mulhsu s2 s4 s2
-rem a0 a0 a0
-srl t0 a0 s1
-addi s1 gp -145
-lui a1 648806
-remu t2 t3 s6
-sub s10 a2 s9
-sll t4 t1 t4
-sra ra s1 s4
-or t1 s10 t5
-mulh s2 s10 s5
-or t5 s9 s3
-remu gp a4 s5
-ori s11 s8 -415
-slt ra s1 s10
-sltu ra a5 s3
-mul gp t3 s7
-slt tp a6 gp
-slt s1 s6 a6
-lui s7 504257
-mulhu a3 s5 a4
-srl s10 s11 a4
-mulhu t0 a1 s11
-mulh x0 t5 a6
-srl a0 s11 gp
-sll s1 t6 s9
-add a0 s0 t3
-srai s1 s2 31
-mulhu s10 a6 tp
-auipc a7 806976
-sra s0 a3 t1
-slti s9 tp -928
-mul t4 s4 tp
-lui s7 423478
-div t0 a7 s8
-sub s1 gp t2
-mulhu s4 x0 a5
-add s7 a0 s7
-mulhu a4 ra s6
-srai s7 a7 12
-mulhsu t1 s4 a6
-remu s11 s5 gp
-slli s0 x0 21
-mulhsu x0 s10 x0
-slti tp a3 683
-sra a0 s4 s5
-add a5 t3 a6
-mul x0 t3 a7
-mulh a5 a5 s1
-xori a5 a0 -1828
-mulhsu t3 a5 ra
-sub s5 s3 s9
-srai a6 s2 26
-add t5 a4 s3
-andi a6 s6 -710
-andi s3 s1 1776
-remu gp t5 t3
-and s9 s9 t2
-ori s2 x0 -1562
-mulhu t3 a4 t3
-add s7 s5 x0
-remu s10 s7 s6
-div t6 ra a3
-rem s4 t3 a6
-sra a7 x0 tp
-slt a2 s7 s4
-mul gp a5 ra
-sltu t3 x0 s1
-xori s5 s3 1486
-srai s0 tp 13
-remu x0 x0 s6
-andi x0 s1 1156
-xor s8 t3 t5
-or gp s3 t2
-srai s0 a4 12
-xori t0 a1 -1561
-sub s6 s11 ra
-srli a7 x0 10
-addi s8 a3 -1773
-rem a2 a5 a6
-lui s6 84324
-mul t2 t5 s0
-ori a1 t2 525
-sll s4 s11 s7
-mulh t3 s4 s8
-or x0 tp s3
-remu t2 s7 a4
-mulh s11 t4 t3
-slti s2 s11 -1208
-rem t1 t0 a3
-srai s8 s0 6
-srli t2 s11 14
-remu x0 a4 a0
-sra s7 t1 t1
-mulh s3 ra t0
-slli s9 t4 17
-slt s11 t6 s8
-or s10 t3 t5
-lui x0 800276
-divu s8 t5 a0
-slti t2 s1 -1286
-srai t6 s10 25
-mulhu s3 s9 s2
-sll tp s5 a6
-mulh t6 a2 t3
-slli s1 t1 2
-srl t3 a7 t4
-remu t6 a4 s1
-or t4 a7 t3
-sll a5 t5 t1
-sltu s1 s6 t1
-slli t0 s6 27
-ori a2 s11 -919
-sll s2 s6 s1
-divu t5 t2 a0
-auipc gp 62921
-sltiu t3 s8 -1901
-xori a3 x0 -1896
-mulhsu a7 t5 a7
-lui s1 713245
-sub a3 s8 a1
-remu a1 a2 s2
-slt s7 t5 s8
-srli gp s6 31
-xori t6 t2 -937
-sll s0 tp s4
-mulh a7 a1 tp
-rem x0 x0 a0
-xori s3 s1 -794
-divu t5 s9 t6
-sltiu a3 a0 -541
-divu s1 s7 s10
-sra t4 t2 t3
-mulhsu gp s1 s5
-rem s4 s2 a1
-sra s5 gp a7
-sra s11 a5 t0
-and a4 a5 t5
-auipc a6 676743
-sltu s6 a6 a5
-add x0 x0 x0
-rem t6 s9 a0
-sub s0 a6 s7
-sll t2 a0 s11
-slli a6 s6 25
-slti t2 t4 -1040
-rem s6 t6 s0
-mulh s10 a7 x0
-srai a2 s9 5
-sub s5 s10 t3
-div s8 s10 t2
-rem a4 t5 tp
-addi x0 s11 -575
-sll a3 a6 s4
-slli s11 a0 21
-auipc s6 470689
-slti t3 s0 -1674
-srai t5 t0 20
-mul a3 t3 a4
-slli x0 s3 6
-divu s0 x0 a0
-ori a2 a0 -913
-divu s0 t2 s11
-ori t4 s10 905
-lui tp 659173
-mulhsu s8 a6 t2
-srli s3 s9 13
-sub s0 s0 t3
-rem a2 x0 a6
-mulhu a0 gp t5
-andi s2 t5 -767
-sub s10 s3 a6
-andi a0 s11 -919
-sra t5 s9 s8
-add t6 s7 a7
-addi s11 t3 -633
-sltu x0 a1 t6
-xor s8 t5 s2
-or a3 a2 s5
-sub s9 x0 s4
-srli s11 a5 0
-slti s6 gp -1684
-sll s11 x0 t0
-srai s11 t0 9
-mulhu s0 s5 ra
-sub s10 t4 s5
-srl a6 x0 t3
-mulhu s8 a3 a3
-auipc s10 567278
-xori a3 s0 1314
-andi a0 t0 -1794
-remu t5 tp s5
-auipc a1 1002372
-srli t0 t5 17
-mulhu t0 t6 s6
-rem t6 t1 x0
-srai x0 s7 9
-addi t3 t2 -379
-slli t3 s4 21
-lui a4 654069
-remu s6 a1 tp
-mulh a3 ra s3
-sub x0 s10 s3
-and a5 t2 s8
-sltiu t2 t1 -308
-slli t2 t2 11
-lui t4 432428
-mul x0 a7 t6
-mulhsu x0 t5 a2
-srli s9 s9 23
-ori tp tp -1591
-rem s6 tp a4
-add s11 a2 a6
-and ra t6 a0
-mulh s4 t3 x0
-andi s9 gp -667
-sra x0 x0 s11
-slti a5 s6 -1968
-ori t2 gp -11
-lui s6 61197
-srl s5 s4 a2
-addi a0 t1 1017
-srai t1 s6 5
-sra a4 a2 a5
-sub a6 a6 x0
-xori s7 s7 -744
-mulhu s4 a1 t2
-mul s1 a1 s7
-slt ra s5 x0
-and s6 t1 t3
-mul a3 s10 s0
-add a5 t0 t1
-srl s7 t0 t2
-auipc a2 643858
-mulhsu s0 ra t6
-rem t6 a7 a1
-srai t4 a0 15
-remu s9 s3 s7
-mul a3 s3 s4
-srai s0 a4 7
-lui t6 944255
-slti s0 a6 2036
-add s6 t2 s7
-add t2 s10 x0
-slli s7 s6 10
-sra x0 x0 a3
-sltu t6 x0 s4
-and s11 x0 s5
-slti x0 s4 29
-mulhsu a2 t6 t3
-mul s6 t5 tp
-slt s9 s3 a3
-srl t3 s1 s6
-srl x0 s8 x0
-sltiu s8 s10 -1044
-andi s9 t2 -1984
-sltiu t0 t4 -298
-xor a0 s4 tp
-rem s1 a6 a4
-sltiu s8 s2 2045
-and gp s1 a5
-xori s2 t6 -1878
-or a7 s2 t4
-ori s11 a3 -1149
-srli a7 a2 20
-sll gp t3 a3
-xori t5 s0 -1921
-rem a6 a0 t4
-xori s6 a5 1798
-addi t4 s4 -638
-slti s5 tp -484
-slti t6 t2 60
-div tp x0 s1
-mul s6 s10 s4
-sll x0 t2 t6
-mulh t4 s11 s10
-slt t0 a0 s2
-rem s9 a5 s10
-xori a0 t4 -1408
-or a2 a5 s7
-mulh s2 s7 x0
-sra s6 tp t1
-slli t4 x0 9
-sra s5 x0 s4
-slti x0 a0 -939
-sltu t0 t3 x0
-mulhu x0 t4 tp
-sra t3 s4 s6
-mulh t0 s3 a0
-divu tp t0 t2
-addi s10 t5 996
-auipc a4 799226
-srl s1 gp s5
-divu t5 a5 a5
-mul s1 a1 t5
-sub s4 t2 gp
-and a6 gp a5
-sltu t1 t0 a7
-remu s5 a1 a7
-div s8 s7 ra
-and a6 a2 s5
-srl s6 s5 s0
-lui a0 228810
-mulhsu gp s10 s2
-addi a5 s11 -1224
-srli s8 t6 21
-auipc s7 826558
-auipc t4 274832
-lui tp 207490
-xor a4 x0 t6
-rem t2 s0 a4
-ori a7 gp 509
-remu t5 a2 s0
-srli a1 s0 21
-remu x0 s6 s9
-xor s4 s2 a4
-mulhsu a3 a5 t2
-mulhu t1 x0 s2
-mul s10 s2 a6
-slt s7 a0 s7
-srl x0 a0 t3
-slti s2 s1 1014
-ori s6 s9 385
-andi x0 a4 -1879
-mulhu t5 s10 ra
-srli t0 t1 8
-xor a4 t3 s6
-mulhsu s6 a1 tp
-addi s8 a5 -1634
-mulhu t6 t3 s7
-divu t5 t4 x0
-srl s6 a6 s10
-xori s4 ra -953
-andi t0 a4 1117
-mulhsu s9 s1 s2
-srl ra t0 ra
-sltu s4 t1 a1
-andi s3 s1 736
-addi a7 t0 -1644
-auipc a0 1002032
-sltu gp ra t5
-srl t1 x0 s8
-addi a4 s11 -1930
-andi s11 s2 -110
-mulhu s4 t6 t2
-mulh gp s1 t5
-slli a0 t3 24
-mulhsu a7 s4 s11
-sltu s7 a2 s2
-sub s2 s7 t2
-mulhsu t2 a6 s1
-mulhu t4 a4 a2
-xor s5 t5 t4
-mulhsu s9 t6 a4
-slt a3 a2 s3
-rem s6 t3 x0
-xori t2 t3 -1905
-lui t5 225114
-xor s1 x0 a3
-srai s8 ra 3
-or s10 gp a1
-mulhsu gp s2 s5
-slli t0 a4 25
-slli tp a7 8
-slli s7 s4 30
-and a4 s10 t6
-mulhsu s1 t6 a6
-slt ra gp s5
-sub a5 a3 s7
-sra t5 s6 s8
-slti a5 s1 -1519
-srai t6 s9 7
-and s4 gp a6
-mulhsu x0 a5 a5
-xor s10 t5 a3
-mulh s7 t4 a2
-xor t4 tp s10
-xori s5 a7 -815
-xori tp x0 -169
-slti t3 t0 -1913
-addi s8 t1 -624
-add s6 ra a3
-add a5 s6 tp
-slli t0 s7 14
-lui ra 363443
-add a2 s5 s9
-sub t2 s7 t3
-mulh s5 s11 t6
-addi t0 s9 -1166
-sltu t5 t1 s5
-remu t1 t5 s0
-ori t3 ra 1529
-auipc a6 838415
-addi tp s10 -343
-xori a7 a4 348
-slli a1 tp 17
-mulhsu t4 t5 t2
-andi s0 s11 1949
-xori t3 s2 417
-rem s6 a7 ra
-auipc s11 669490
-mulhu a6 a7 s2
-sra t5 t1 s4
-divu s1 s10 s6
-remu s1 s6 s10
-addi a0 a7 -1842
-sltiu x0 x0 2032
-slti a4 a5 -1014
-and gp t0 a5
-rem gp ra s4
-sltu gp a6 a5
-divu a4 a0 a3
-and t1 a0 t5
-sub s8 t3 t3
-addi t6 s5 1555
-lui a6 430605
-lui t5 309041
-sltu t6 s2 a1
-xori tp s11 -1493
-auipc a2 501540
-mul s1 ra a3
-slti t1 s0 982
-sltiu t2 s6 -907
-sltiu s3 s10 57
-sltiu a2 x0 -1222
-lui a7 773380
-lui s6 127437
-xori s9 t3 -1886
-mulh t0 t3 a7
-and t4 s9 ra
-xor gp t1 s7
-mulh s10 t6 s4
-sub s6 s9 a7
-srl ra a3 x0
-sll s1 a3 a2
-and a4 s5 t5
-div s11 a0 s5
-srli a4 ra 17
-mulh s8 a2 t5
-mulhu t6 gp s0
-divu ra ra s4
-addi s10 t2 -75
-sub t5 s0 a4
-mulhu a1 s6 gp
-div s11 s4 t5
-sltiu t6 a5 293
-sll a5 x0 a7
-rem tp s4 gp
-slt s7 a4 x0
-auipc s10 694384
-div a0 s2 a5
-divu x0 a1 s7
-mul s10 t4 t6
-slt x0 s5 s5
-sra a5 t2 a4
-srli gp t1 10
-remu x0 tp tp
-and a1 a4 t1
-xori ra s7 -1773
-and s0 x0 s9
-remu t4 s9 gp
-sub t3 s3 s7
-xori s11 a3 822
-addi a2 a2 1146
-xori t6 tp 220
-lui s8 951596
-xori a6 a5 -1767
-srl s4 s7 a3
-or x0 t1 t6
-mul s11 s6 a7
-slt s2 ra x0
-srli a7 s8 29
-divu x0 s4 gp
-slt t6 a5 s0
-ori t4 s4 533
-xor a6 s5 s8
-divu s4 t4 t2
-sll t3 s3 t4
-slt t3 t2 x0
-andi gp t5 -1003
-sub s5 a5 s9
-rem s2 s4 s3
-slti t0 s9 -670
-sra s0 a4 a2
-slt s5 s7 s0
-rem t0 t4 a0
-add s11 t5 gp
-mulhsu s11 a5 s1
-xori a4 t6 -1104
-mulhsu s11 t5 t0
-ori t4 a6 -216
-sub t1 t2 a5
-ori s6 a6 -170
-slt s3 t6 a3
-mul a6 a6 tp
-div s2 s10 x0
-ori a1 ra 689
-or gp a1 s11
-sll a6 t1 a2
-srai s11 t2 17
-div s9 s6 s11
-sub s5 gp s2
-srl ra a3 t4
-slli a2 s6 0
-mulhsu gp s6 t5
-srl s11 gp a2
-mul t0 x0 a3
-mulh x0 t3 x0
-or s4 tp s9
-lui s11 323774
-slt s3 tp t3
-lui s7 323719
-or s1 s10 s6
-mul a2 a4 s7
-addi t2 ra 237
-mulh s6 s1 s3
-divu gp a1 s10
-mulhsu t3 s4 x0
-srl t2 a1 x0
-mulh s2 a5 s11
-sltiu s11 s9 -1851
-sra s8 t3 t3
-slli s0 t6 25
-addi s9 gp -1991
-srai tp t4 31
-mulhsu s0 s1 t6
-ori s2 s1 -1888
-xor x0 a0 tp
-xori t4 t0 -1842
-rem t2 s4 a5
-sll s2 s3 x0
-andi tp a6 -1218
-slti x0 t5 -1210
-mulh a1 s11 s5
-ori s6 s2 -759
-xori s5 a2 -322
-mulhu t5 a3 a6
-sltiu a4 s3 1362
-sltu s5 s3 gp
-sltu s8 t0 t0
-divu s8 a6 tp
-rem s0 t0 tp
-andi a5 tp -120
-xori a5 a2 -1958
-or s1 s9 a2
-rem s7 tp a4
-sll a6 s2 t0
-ori t5 t1 -1677
-srai a2 tp 5
-add a2 s11 t4
-lui s8 650793
-sltiu s5 a4 1973
-srl ra s0 s0
-srli a4 gp 11
-and a5 gp s7
-slt t3 gp s9
-and s3 s4 s4
-sltiu x0 s3 -951
-sltiu gp ra -511
-sub s9 ra x0
-xor a2 a3 a5
-or a3 s0 a0
-xor t4 a6 s5
-srai s6 tp 30
-lui x0 461878
-sub t5 s1 s7
-add s5 x0 tp
-add s0 s11 x0
-lui gp 637263
-divu s7 a0 a0
-srl a2 s4 gp
-sltu s9 a2 t5
-sll t1 x0 a5
-xor a5 s4 t2
-or s1 s8 x0
-xori ra s6 -455
-srai s3 s2 8
-mulhsu a3 t5 s0
-addi t0 s0 -208
-srl a6 s3 s3
-srl a4 s11 gp
-sra a1 s6 t6
-remu s1 t5 s11
-divu t5 s3 a5
-mul s4 a5 s7
-auipc t3 860779
-mulhu s11 tp s11
-sltiu s0 a6 -1858
-slli s11 a2 17
-remu a2 a5 a6
-sltiu t1 t4 427
-srai x0 x0 9
-rem s0 t2 gp
-slt ra s11 gp
-slt s5 t6 a0
-mulhsu a3 a4 a4
-mulhu a0 s6 t5
-or t3 t5 a1
-xori s1 s3 -1014
-srli a5 s0 7
-slti s2 t5 -214
-slt a4 t2 tp
-sltiu a2 t0 660
-andi a5 a7 -121
-andi s0 s8 -1622
-sltiu t3 s5 -720
-ori t1 a2 335
-ori t1 a3 -1791
-addi t5 gp -1888
-mul t3 s7 t3
-auipc tp 288210
-xori s8 s5 550
-sub a7 s7 a2
-sub s7 s3 a1
-xori a6 ra 1503
-andi s11 tp -1858
-sub s8 s10 x0
-xori s11 s0 795
-ori tp t6 -659
-sltiu t1 t6 -1469
-divu a4 s7 s0
-auipc s2 544336
-rem tp a1 ra
-mul a7 ra a2
-sltu s5 t4 t4
-and t2 s9 a3
-mulh a0 s3 t4
-sltiu a4 s11 -1118
-sub s2 x0 s10
-remu s1 s11 a6
-slli t1 a4 25
-sltiu s11 a2 576
-divu a4 s0 t3
-slt s0 tp x0
-sltiu t1 t0 -395
-or s0 s7 x0
-ori t5 t4 -1719
-divu x0 gp s0
-add s11 t6 a0
-srli t3 s5 28
-addi s6 s1 -898
-srai s1 s0 26
-add a4 s10 s2
-mulhu s11 t5 s3
-ori a5 t1 -1965
-and s8 tp s8
-add s2 x0 s6
-or t4 s7 s1
-or s1 a2 t3
-sub a7 s7 s2
-div t1 tp x0
-addi s6 t2 -1138
-srli s9 t3 24
-auipc s9 501952
-xori t3 t1 1362
-rem s10 t5 t5
-divu x0 s6 s4
-ori a2 s3 -315
-slli a0 s11 17
-slti t6 a2 1233
-srai t2 t2 24
-xor s10 s2 s0
-and a0 a5 t6
-rem a7 ra a4
-sll s9 a1 s9
-auipc s0 405538
-rem x0 t2 a7
-mulhsu t2 s6 a7
-xori a2 s4 1192
-mulhu t0 s4 s10
-sltiu s10 a1 -1174
-srai t2 a6 20
-divu s10 t0 s6
-mulhsu tp a4 ra
-slt t4 s8 x0
-rem ra t3 t4
-xor x0 x0 t1
-and t2 s1 s3
-auipc tp 797564
-xori s11 s0 793
-mulhu s0 s10 a0
-rem a6 a5 s11
-mulhsu s5 s11 s6
-div s10 a5 a0
-div t3 tp s11
-sltiu tp s7 -1955
-sub s7 t3 ra
-sra s6 a4 s7
-divu s5 t4 a0
-srai x0 a3 30
-addi s1 s11 -1567
-lui s5 297014
-sltu s7 s5 t6
-mulh s6 t2 t0
-sra s5 t4 a0
-slti s6 a0 -1577
-sll s2 t1 a0
-slli t4 s6 30
-sltu a5 a2 t4
-slti s1 a0 -108
-srl s5 a1 a3
-mulhu s11 s0 s9
-slli ra t2 12
-remu s4 s11 a5
-sll x0 a5 s9
-add s3 s8 s2
-srai s7 t3 16
-mulh s8 t5 s5
-sub t5 s11 t5
-mulhu x0 s4 s1
-sll s2 s7 s10
-sltiu x0 s7 896
-slt s11 s11 s6
-or a2 x0 s10
-andi s5 s10 -1053
-srl t6 t0 gp
-andi a0 t1 -525
-sll s0 s5 s1
-addi x0 ra -1255
-mulhsu a0 s1 a7
-slli tp ra 8
-mul t1 s9 s5
-srli a2 s1 10
-mul a1 s11 s7
-rem a6 s10 a4
-andi a5 ra -451
-slli t1 s2 7
-sltiu s1 s9 -877
-remu s9 ra s10
-slt s6 t3 a1
-xori ra x0 -328
-mulh s8 s1 s7
-slt s1 s10 s11
-and a6 s7 t4
-slli s0 a4 7
-xori a5 t0 -111
-sra ra t2 t6
-mulh s5 x0 s3
-ori a5 a4 -1641
-or s6 t0 s4
-sltiu ra s5 2023
-slti a1 a5 -1052
-div t3 t0 x0
-auipc s5 44031
-sltiu s4 a6 -1263
-auipc a7 750425
-slt a2 s3 a0
-and a0 t3 s4
-mulhsu a0 t1 a3
-slt a2 a4 s5
-mulh s10 s9 s2
-sub s0 s9 a4
-srl s0 s1 a5
-mul a5 s3 a1
-srai t5 s1 15
-sra s10 t3 a5
-srli a5 x0 8
-sltiu s10 t6 -894
-sra s3 a3 s2
-lui t4 601617
-mul t5 t1 a5
-slli a4 gp 30
-xori a6 tp -513
-sltiu s6 tp -631
-sub t2 t5 t4
-add a6 a2 ra
-sltiu s11 a0 -1027
-srli s4 s5 6
-andi a5 s1 -646
-rem s7 s8 s0
-mulh a0 a5 s2
-div t2 t6 s10
-divu a3 s9 s5
-and s10 s0 s3
-sltiu s8 s2 -958
-andi t1 a5 -1612
-srai s0 t3 25
-divu s3 a7 s3
-slti s4 t3 -462
-xor t2 t4 x0
-sltu t5 a6 s5
-rem gp t0 t0
-mulh s3 s3 s9
-ori x0 s1 -1144
-xori t4 t6 -1628
-mul tp s3 tp
-xor s9 a0 t1
-ori a5 s4 -380
-slt a2 s11 a0
-slli x0 s5 23
-andi a3 t4 -2025
-or a0 s9 t5
-auipc s0 175255
-divu a0 gp s7
-srai s3 t4 12
-and t4 s7 s8
-and s3 s6 tp
-xori t3 s6 730
-mul tp s1 s10
-srli tp ra 30
-auipc a4 852887
-lui a2 311256
-add t3 s4 a5
-ori a7 t6 -292
-andi a2 x0 1356
-and t2 x0 s7
-xor s7 s4 s8
-srli s8 x0 9
-srli s8 s7 29
-sra s0 t1 s3
-lui gp 985868
-srai s6 gp 28
-add s0 s3 s5
-sub t3 a0 x0
-rem t2 s0 s8
-remu a4 t5 a0
-mulhsu s1 gp tp
-slli s9 s10 14
-sub tp a7 s2
-rem s4 t5 x0
-remu t3 s0 t2
-ori ra t6 -1387
-mulhu x0 a6 a1
-sltu s8 s11 t2
-remu s11 s2 a6
-srl s9 gp a4
-mulhsu s8 t3 s11
-addi s7 a6 -1120
-or s9 s0 s11
-div t5 t6 t4
-auipc a2 220798
-slli s10 t1 31
-andi s7 t5 -405
-addi tp s5 1597
-sra x0 s8 a5
-srl s1 s8 a6
-and t6 t0 a1
-add a4 x0 s10
-srl a4 s6 s11
-divu a7 a4 a5
-xori a5 s11 1732
-divu gp s6 t0
-srai a0 t2 20
-xor t1 t2 tp
-sub a5 a1 t1
-sltu s0 s3 a1
-addi ra s8 -1420
-or s2 t3 s1
-div s2 a2 s5
-andi s4 t6 1405
-mul a1 gp a0
-mulhsu s10 t3 t4
-addi a2 a7 -1354
-mulhsu a6 s7 x0
-andi x0 a5 -966
-sltiu t2 s8 448
-mul s8 s10 tp
-and s4 t2 a2
-remu s7 s8 t0
-and s8 s0 t1
-slti s0 a4 -2006
-srl s8 s9 s3
-or s7 ra s5
-lui a2 301422
-xor s6 t0 s2
-mul s1 gp t1
-mulh t3 s6 t1
-or a0 s7 x0
-srl s1 ra ra
-xori gp s1 526
-srli ra t1 0
-srl x0 s10 t5
-mulh gp a2 s0
-remu a1 t2 a1
-sltiu t4 s10 440
-addi s1 t0 -1542
-lui s6 230486
-sra t0 t3 a6
-slli t3 a7 4
-remu s5 x0 s7
-ori a3 ra 917
-rem t5 t3 t0
-sub t5 s3 s8
-auipc a7 869162
-slti t3 a2 1386
-andi s10 s7 -737
-slti ra s6 -1925
-srai t4 a1 18
-addi t0 x0 -1989
-andi s2 t6 -322
-mulhsu gp s1 s10
-and a0 s7 a6
-xori s1 t2 -18
-remu t6 t1 s1
-andi s6 s8 -346
-sub t6 t4 s0
-mul s5 s10 x0
-ori t2 t6 -636
-andi a4 a4 -873
-slli a3 s11 7
-rem a2 a7 tp
-ori x0 t2 -1295
-addi t1 s4 6
-or a5 s9 s2
-xor s1 x0 x0
-srai s7 ra 3
-mul s5 x0 s2
-remu s4 gp x0
-sll a5 s2 t4
-mulhsu a6 a2 s6
-lui s10 590534
-slti gp a3 -1589
-addi s3 t3 1916
-add t1 a0 x0
-lui s2 722889
-div t2 t1 s2
-slt a0 ra s1
-srli a0 x0 14
-srl a1 s0 s0
-srl t5 a7 s11
-xor t2 a4 a5
-sub t1 s5 x0
-rem a2 s7 a6
-sll a2 a2 s11
-andi t0 a2 -1154
-and s2 t3 a0
-sll t0 s0 gp
-mul s7 x0 s11
-remu s5 s9 t6
-sra t2 tp a7
-slti a6 a7 -335
-auipc s10 1000039
-xor x0 x0 s1
-andi a4 a6 2029
-ori s2 s5 1254
-sll x0 s1 s5
-mulhu s1 s7 s10
-sub s0 s4 gp
-rem s1 s0 a2
-sltu s9 a0 tp
-auipc t3 135066
-mul s5 gp t5
-div t0 t1 a3
-sub t1 s1 t4
-and a2 t6 s0
-or gp x0 a1
-div t0 s11 x0
-lui s9 285361
-andi a4 t4 -1290
-ori a2 s11 1692
-slti s9 x0 428
-sltu s8 s6 s11
-sra t2 ra t4
-mulhsu t0 s2 s9
-xori s3 a3 -173
-sltiu s3 t2 -1277
-slli s9 t2 17
-sltu tp s1 a2
-add a0 a7 s6
-and x0 s0 tp
-remu a1 x0 x0
-remu ra gp gp
-xori s11 s0 -1722
-addi s6 x0 -802
-sll s2 s9 s7
-ori a4 a2 -67
-auipc x0 301004
-divu x0 x0 s8
-and a1 t0 t6
-srl t6 s10 s9
-slli s7 s9 4
-add a0 ra t5
-rem a7 a3 t6
-andi t3 s5 -186
-slt s7 s8 a6
-sub a2 s3 s9
-andi s4 a2 -991
-sltu tp s5 x0
-andi s7 t6 -359
-srl a7 a0 t6
-slli x0 x0 13
-mulh s6 s4 t2
-sltiu s10 a0 -2031
-slli ra t0 0
-xor tp x0 a1
-andi a4 t1 -884
-mulhsu s1 t1 s6
-and a6 t6 t1
-mulhu a3 s1 t4
-ori ra a4 66
-sra tp a5 s6
-and ra a4 a5
-mulhu t6 s2 a1
-and x0 a0 a6
-lui a4 43337
-div a0 a4 t1
-mulhsu t6 s10 a6
-sll tp ra s4
-mulhsu s1 a3 a2
-xori a2 s4 1457
-sltiu tp s11 171
-sub t0 x0 t0
-rem a5 a1 s2
-mulh s11 t1 s4
-slli a2 x0 14
-remu t6 a5 s8
-remu a3 x0 a6
-mulhu tp a1 s9
-auipc s6 195164
-mulhsu a6 a6 t5
-mulhsu t3 a3 s0
-mul s7 t1 t4
-slt s2 s5 s9
-mulhsu s4 t0 a7
-rem s0 a6 a0
-sra tp s3 s11
-rem s9 t2 t2
-addi t6 s1 -1144
-mulhu gp a6 s7
-sll a1 t6 s5
-srli a4 x0 31
-srl t5 s8 a3
-add a0 s6 tp
-or x0 s8 t5
-slli gp s5 17
-mulhu s5 a6 t4
-mulhsu s9 s9 s9
-mulhu s1 s0 s7
-xori a2 a5 -985
-sltu t2 tp t4
-srai s9 tp 11
-mul a4 s8 s6
-slli x0 s11 17
-auipc a0 148691
-and s3 t1 x0
-add t1 s6 s8
-slli gp s6 31
-sltiu s7 s4 1069
-mulhu s7 t4 s8
-slti a4 t0 -550
-xori t4 s0 -765
-and s11 a2 a3
-divu t6 a0 a2
-addi a1 s2 -840
-mulhu s5 t4 s8
-sra s9 ra s11
-div a5 s4 a1
-slli s6 t0 28
-sltiu s0 s4 -347
-srai a7 s0 20
-mulh x0 a4 x0
-xor a6 a1 s3
-mulhu s8 s5 s2
-sltu x0 x0 s10
-slti gp x0 463
-ori t0 s4 791
-srl a6 s4 s5
-and x0 a4 s9
-sltiu s10 s1 -570
-sub s2 ra tp
-divu s8 s7 x0
-lui s3 200458
-srli s4 s5 27
-andi s2 s0 -1183
-lui s11 171962
-divu t0 a5 gp
-sra gp a7 t0
-xor s3 t5 a5
-xori t5 x0 -1104
-mulh a3 gp t6
-srai s6 a2 2
-mulhu t1 a6 t1
-lui a6 918624
-add a7 gp gp
-xor s9 s5 a1
-mulhsu a4 s7 tp
-sltu s11 s10 t5
-slli a3 s2 26
-srai s10 s6 4
-mulhu a0 s0 t4
-xori tp s6 -661
-div s3 a2 t2
-srl t3 a2 s6
-div a3 gp t1
-srai a2 s0 11
-sltu s6 s1 tp
-srai a7 x0 3
-ori x0 a3 -1763
-auipc s4 493517
-sra x0 s2 a7
-sltiu t6 s0 56
-mulhsu a4 tp a4
-andi a1 s9 -198
-and t6 tp a2
-srli s6 t2 7
-rem a2 a1 s9
-auipc s5 153819
-andi ra gp -497
-addi s3 a2 -602
-remu a0 s0 t1
-sltiu s8 tp 718
-and s3 t3 s10
-sltiu s3 ra -611
-rem s10 t5 s0
-slli s10 s10 28
-sll s8 t0 t1
-srli s8 a1 12
-rem s1 s6 a4
-srl a0 a7 a4
-or a1 a3 a6
-add tp a7 t4
-sltu a0 s11 t5
-sll a1 s6 s2
-sll a6 t4 a7
-mulhu t1 s7 s9
-lui ra 881056
-or t1 s2 s5
-mulhu t0 a0 s11
-slli a5 t3 29
-ori a2 a2 -568
-xori s1 a5 -487
-mul t0 s5 s0
-or s9 s0 s9
-xor ra gp s1
-srai s8 x0 30
-ori t3 ra 1813
-sltu a7 t3 s2
-lui a5 696160
-srai a3 t0 18
-slti a3 a1 1469
-addi gp t6 -2016
-ori t4 a7 -134
-divu s5 t0 t2
-auipc t0 961895
-mulhsu s1 a7 tp
-sll s4 s4 s2
-slli a3 t1 26
-mulhsu s7 s7 s0
-sll t0 a0 t2
-srli s2 gp 23
-srai a5 a4 17
-sltu s7 t6 t2
-slti s4 gp -343
-srl x0 t0 s4
-div s1 s9 a0
-sra gp a1 s9
-sltu t3 s7 a5
-xori s6 s4 728
-rem s11 s0 a1
-mulh t6 t3 tp
-sub gp t0 a6
-rem s5 s1 t0
-remu a3 a4 a2
-xor a2 s6 t6
-remu t6 a0 ra
-mul t0 t5 a2
-sltu s5 s10 t5
-add s0 s3 t0
-mulh s0 x0 t0
-sll a2 a7 t2
-slti a2 t6 -136
-sltiu s2 tp -1477
-andi s11 s4 -967
-srl a3 s3 x0
-sub t5 s0 s1
-sra ra s8 s5
-auipc t4 536357
-or s8 a4 s7
-mulh a5 ra a1
-sra s10 s6 a7
-add a0 x0 s6
-lui t3 713961
-rem a0 s9 s5
-slti x0 s11 -629
-remu a3 t2 s10
-mulhu s0 s6 s8
-remu a2 t2 a7
-add s3 x0 s1
-slti a0 t3 673
-mulhu s10 gp a6
-sra x0 a7 a5
-rem t1 a1 tp
-ori a5 t0 -1116
-mul s6 t2 tp
-mulhsu s6 t3 s5
-or t0 a6 ra
-div x0 a2 t5
-auipc s4 814121
-mulhu s8 t5 a7
-andi x0 a1 -1037
-remu s7 t1 ra
-sub a5 a6 t3
-div s10 a6 gp
-sra s0 tp s10
-srli a3 s5 26
-sub a3 t2 s11
-andi t0 t0 -982
-remu t2 s11 x0
-mulhu a1 t2 t1
-mulhu a4 s1 s2
-slli x0 a6 20
-addi s2 s0 1439
-addi tp ra -814
-slt s10 ra gp
-auipc x0 877401
-div t3 s2 s0
-srai a2 s10 19
-xor a5 s10 t4
-slli t5 s7 31
-ori s0 a6 -704
-slli x0 tp 5
-divu s8 s11 s2
-add s10 t2 ra
-andi s0 gp -90
-mulh a2 gp s2
-mulhu t3 t3 x0
-sltiu tp a7 -1656
-sltiu t1 x0 639
-xor s10 a1 a5
-ori t1 a1 -1914
-ori t5 x0 -455
-divu t3 tp s3
-add t6 a6 a1
-and s7 a5 t1
-rem t1 a5 t5
-lui a1 88299
-remu t5 a0 t6
-srai s2 t6 29
-srl s6 x0 s3
-lui t2 50667
-srai s2 x0 8
-sub s7 t2 s11
-lui a1 946554
-mul x0 a1 a7
-sra a0 ra t2
-addi x0 s0 -1459
-xor tp a4 s0
-srl a5 t1 s8
-sub t2 s7 tp
-srai tp s10 11
-sltiu s5 s9 460
-sltiu a3 t0 334
-or tp s10 gp
-remu s7 s10 ra
-slti ra s4 -1569
-xori s4 s9 -161
-and s2 s5 a5
-mulh t6 gp t1
-andi t1 a6 862
-andi s11 t6 341
-xori a2 s10 -1414
-sltiu t1 s8 -650
-add a6 t1 s7
-addi tp s10 524
-sltiu x0 t3 271
-sra a3 s10 s8
-div ra s7 x0
-slti s4 ra -1842
-divu a5 t6 t5
-mul s6 s1 t1
-ori s0 s10 398
-add ra t1 s2
-addi s5 s1 -855
-xori t2 a2 -1352
-xor s7 t2 s7
-sub a2 s4 a1
-srl t1 s11 a0
-andi ra s5 -290
-div s9 s2 t5
-xor x0 a1 s10
-divu s1 a1 t2
-slli x0 ra 0
-xor t3 s10 s4
-div a3 s7 s8
-div t6 s3 t4
-sll t0 tp a6
-xor a1 s1 s9
-div t3 s10 gp
-slt a4 a0 s4
-xor t4 t2 s4
-slt tp s6 ra
-slt t2 a2 s4
-sltu t3 t1 a6
-xori tp s0 168
-srl s5 t1 t3
-andi s4 s7 -1801
-slli t4 s8 27
-srl s3 s7 s8
-divu t3 a3 t0
-div a3 t4 a3
-xor x0 s5 tp
-and t6 s10 t3
-slti s1 a1 -143
-slli t2 a1 22
-remu ra t2 a1
-srli s6 a5 9
-mul s4 a6 s9
-mulh s10 gp a0
-sll s2 t1 s0
-xor s8 s8 a0
-slt s10 t0 s0
-sltiu s9 s5 -911
-sub t6 a4 s0
+auipc s2 573700
+sltu s0 s5 a5
+remu s10 s10 s7
+xori a5 a1 -1638
+sltu s1 a2 a2
+slli s10 t3 16
+slli t0 tp 6
+sltu a3 ra s3
+mul t6 x0 t6
+ori s3 a7 1449
+srli a3 a0 27
+srai s3 ra 3
+mulhu s0 s7 tp
+remu t6 gp s4
+or a2 s6 ra
+rem s4 x0 a1
+mulhu a5 s3 s11
+divu a6 s10 tp
+mulhsu a5 t2 s5
+and a2 s8 a1
+lui s3 966074
+mulhu a5 s11 s3
+andi t2 s4 -34
+sra s11 s8 s8
+sub t0 x0 x0
+addi t3 s0 838
+or s1 x0 a0
+srli a7 s9 13
+divu s7 a5 t4
+srai s1 t4 23
+slt s3 gp s9
+add t5 a5 s0
+xor s11 s8 a4
+slti s2 s4 -696
+auipc gp 664557
+mulh a4 a5 ra
+srli t6 a6 3
+sltiu tp gp -1271
+auipc t6 934696
+and a0 t1 s7
+lui s11 870193
+rem a6 a3 s1
+divu s2 t1 a6
+addi a1 a4 -1108
+slti ra gp -986
+andi t5 ra -1215
+lui s4 707291
+mulh s1 a7 s9
+xori s3 ra 301
+mulhu t5 s5 gp
+sltu s8 s0 s7
+rem s5 s0 tp
+ori a1 a4 -1640
+div t2 a6 s10
+xori s0 s5 1278
+sra t6 s6 a4
+mulhu t3 t0 a7
+remu a3 t6 t1
+xor s4 s5 gp
+srli s6 t2 9
+sub t3 s9 a4
+div s8 s3 s6
+mulhsu s9 s6 s3
+and t3 s1 s4
+lui s8 684538
+addi t4 gp -812
+divu s2 t1 a2
+rem s0 a2 a5
+or s0 s7 s10
+slti s7 a1 -429
+and t1 s3 a7
+andi t6 s10 940
+slti s5 s7 1076
+sub s3 gp t3
+andi ra ra -1204
+sub s0 s3 a4
+andi gp s6 -1385
+sltu s3 a5 s6
+rem s5 t3 s8
+ori a6 a6 1282
+slli s2 t6 3
+or s10 a7 s2
+or s3 tp t6
+srl s3 t4 tp
+srli s4 s3 23
+mulh s0 a4 a0
+or s4 s5 a2
+xori s7 t1 -201
+slli a0 a0 6
+srai s4 gp 13
+slti a3 s3 -1293
+xori a5 s6 -790
+add s0 x0 s9
+ori a4 s5 -924
+xori s6 s3 -829
+sltiu t0 a3 -1306
+mulhsu gp gp a5
+div s5 t0 a6
+sll a2 t0 s11
+srai s2 s6 4
+sub s4 t3 t4
+mulhu gp s2 t1
+or gp a1 tp
+addi s4 s11 -364
+mulhsu t6 s10 a4
+and s4 s6 gp
+srli t0 a4 9
+xori s3 ra -678
+sltiu a4 s9 -1585
+rem s0 a4 t1
+sll gp t2 t4
+slli t0 t2 16
+auipc s10 806882
+or a4 a5 s2
+sltiu x0 a4 631
+addi s1 a7 421
+mulhsu s4 s4 a7
+or x0 s8 a0
+div a5 a5 s9
+srli s9 a7 14
+or t3 a5 s3
+sub t4 s6 s10
+ori a3 ra 1759
+sll gp a7 s7
+srli s7 t1 2
+sltu a3 s4 a0
+sub s8 s1 s11
+slti t1 t3 698
+slti ra a2 -1555
+auipc s9 596115
+remu s0 s2 gp
+div s6 a5 t4
+sll t6 s2 s0
+sll tp gp a4
+andi s9 s4 -54
+lui s2 892102
+rem t3 s8 s2
+sltu s6 x0 a5
+mul a3 s4 s11
+srli s4 t5 23
+ori gp s8 1124
+slli a0 a0 8
+sltu s7 a3 s9
+div s8 s1 a5
+xor s8 s4 a4
+srli s4 s6 15
+mul t4 s10 s2
+or s0 gp s9
+rem a3 s9 t6
+auipc t6 323383
+or ra s6 s3
+remu a7 ra s2
+sltiu gp a3 -1561
+div s3 t6 a4
+add a3 a0 t2
+div s3 x0 t3
+divu s0 s3 a6
+srl tp a5 s9
+mulhsu t6 s2 a0
+slt t5 a1 a3
+mulhu s11 s4 s10
+slti t5 tp 1812
+div s10 s9 ra
+and s6 s3 a6
+sub s7 a1 s10
+addi s7 s6 -1930
+sltu gp s7 s11
+mulh s3 s2 a2
+divu s7 a2 s1
+sll t0 a6 s5
+sub x0 t0 s0
+sltu t2 s9 s2
+andi s5 a7 -115
+sra a6 s3 s9
+srl s2 s7 tp
+addi s8 t0 -1903
+srai a3 ra 16
+remu t2 t3 s0
+and s11 s4 t6
+auipc a0 802937
+ori a4 t6 569
+auipc s1 836661
+ori gp ra -148
+srli gp s8 16
+mulh x0 a2 a1
+lui s7 703871
+mulhu s3 t5 t4
+srl s2 s4 s7
+sltu s6 s9 tp
+srli s0 gp 11
+sltiu s0 a0 1923
+addi t0 a6 -1961
+sll s1 a3 s11
+divu s11 a1 a1
+srl s7 a4 t5
+ori t1 x0 1282
+xori a4 t1 1006
+srli t4 a1 4
+slli gp t5 24
+rem s3 a5 gp
+xori t0 s6 -996
+srl a7 s5 s1
+srai t6 s4 12
+remu t5 s10 s7
+ori t2 ra 1071
+rem t0 s10 a3
+srli t6 s4 0
+lui a3 831933
+div a2 a0 t0
+srli gp s2 29
+addi s6 x0 1742
+rem s2 t4 s5
+srl gp s2 a6
+addi s0 tp 84
+andi s3 t5 -1055
+or t3 tp s5
+sra a1 ra t2
+mulhu ra t0 s10
+slt a1 s10 x0
+srli t4 s0 13
+or x0 s8 t0
+sra s8 t6 t3
+slt s7 a2 ra
+remu s6 s9 s11
+ori ra a7 -209
+sll a3 s9 s6
+add s1 s2 a7
+slli s7 s0 14
+srai t0 s11 2
+rem ra t3 tp
+slli a4 s11 14
+add s1 a5 tp
+auipc s7 1012684
+or ra x0 s7
+mulhsu a4 s5 t5
+rem a4 gp t4
+auipc s11 15645
+mulh a0 t1 s9
+sra t1 t5 s2
+sra a3 s3 ra
+divu t2 t2 x0
+and s1 s1 a5
+slli s8 a5 24
+mulh ra t2 t2
+addi s2 s5 -1431
+andi tp a4 -213
+add a1 t4 t0
+xor a7 t1 t1
+mul a5 t2 t2
+addi s1 a3 -1256
+mul s7 gp a2
+auipc s8 246575
+divu s5 s8 s5
+slti gp a2 -117
+or a7 a6 a6
+slti x0 t2 1184
+lui t3 1015132
+slt a4 s4 t3
+slti a3 t0 -326
+slli a1 s8 6
+slt gp s4 t3
+srai t5 s5 31
+add a2 a0 a0
+or s4 s5 t2
+rem t3 s5 x0
+mulh t3 s5 a3
+srli a2 s3 11
+mulhsu a1 s2 t4
+andi t2 a7 -345
+add a7 gp s6
+and s0 s1 t3
+srl s9 a3 a0
+xori s3 a4 -828
+rem s4 t0 s4
+auipc s2 1046136
+div t1 s9 s5
+auipc s10 765707
+addi gp t3 -1591
+divu s3 s1 s1
+srai t3 s3 7
+lui x0 483156
+sltiu a6 s8 -1285
+remu t1 a1 a7
+mulh t3 s7 s2
+sltu tp a6 t0
+mulhsu a2 x0 ra
+mul t3 a6 a3
+div t6 a3 gp
+add a0 tp s2
+xori s1 a1 -1132
+and s4 a2 gp
+srli t5 a1 9
+xor t1 t4 s3
+and s10 t6 s1
+andi s4 a1 823
+srl s7 s2 a3
+addi t4 t2 -607
+srl tp s3 s0
+add s4 t3 t6
+sltiu t3 t0 1569
+slli gp t3 25
+andi a3 a2 -237
+lui tp 951083
+lui s10 291009
+sltiu t4 t0 -1424
+sra t3 t3 s3
+sltu s11 a3 tp
+slli a7 ra 30
+remu t2 a0 s9
+ori a1 t6 -682
+slt s8 s4 s1
+mulhu x0 s3 s4
+sra a5 a1 s2
+mulhsu a6 s11 s1
+or a3 s5 t4
+sll t0 gp t5
+auipc t3 915326
+xor s5 a3 ra
+srai s1 t4 12
+remu t5 s2 a4
+div s7 ra s0
+mulhsu a2 s0 t6
+lui gp 831307
+xor ra t5 s10
+lui t1 634563
+add a1 s0 a4
+sra a2 a2 a2
+div a6 x0 a6
+mulhu s0 s9 s3
+slt s9 s11 s1
+lui a4 1018541
+srl ra a1 s6
+mul a2 t3 t4
+rem s2 t4 t1
+remu s9 s1 s2
+andi a1 t5 -1566
+mulhu s6 a0 s6
+srli t3 t2 16
+auipc a6 459563
+mul tp s0 a5
+add a4 a3 a4
+and x0 a2 s0
+slt s8 x0 s10
+slti gp s3 -78
+sltu a6 s0 a6
+slli t0 tp 31
+slli x0 tp 0
+srli s10 gp 25
+add s6 s10 t1
+rem a5 t1 s1
+lui s11 337883
+srai ra s4 7
+sltu t5 s1 s11
+add a2 a5 a0
+srai s5 s5 14
+srli s2 a2 13
+rem t6 a7 s11
+divu a6 s3 a6
+rem s0 s7 t1
+sra s11 a3 s1
+and a0 tp x0
+mulh s0 s11 t6
+slti a0 t3 923
+remu a7 t3 a0
+mulh a0 s3 s10
+addi t3 a0 -399
+or s1 tp a0
+xori s9 a3 854
+sll s9 s1 s6
+addi a1 s7 -580
+ori s9 a6 -1967
+rem a1 a5 s11
+mul t1 a7 a7
+lui ra 590914
+sll s8 tp s3
+slti t6 s4 -1300
+sltiu a1 ra 1981
+mulhu t0 a6 a2
+sub t6 ra t6
+mulhsu a0 s7 s7
+remu s0 s5 a5
+xori t6 s7 1896
+srl s9 a5 t2
+or s6 s0 s0
+lui t4 414325
+add a0 gp a7
+sltu tp tp tp
+sll s11 s9 a6
+divu s1 s8 x0
+sra s10 s2 s0
+rem s9 gp s1
+srli a4 s6 13
+ori ra a7 123
+srl a5 t4 gp
+sltiu x0 a1 -1024
+srli s2 s9 22
+and t1 a3 t4
+mulh s1 s6 s10
+rem ra s10 t2
+slli a1 t4 29
+sll t4 s3 t4
+lui t5 725122
+sltu gp s4 t4
+slli a6 t4 9
+ori s6 a4 -998
+sll a1 s10 s9
+sltiu a0 t0 767
+sll a5 s2 a4
+slti t4 s11 1257
+sub tp s6 a1
+xor s6 t3 t0
+rem s2 s7 a5
+mul t3 s9 t2
+slti a3 t3 -1557
+sub gp a3 t2
+lui a1 983955
+xori s10 tp -1168
+slt a1 s5 s8
+sltiu a7 t3 -380
+slli t5 s3 1
+and t6 s7 s7
+slti s5 s10 -1698
+rem s7 a2 t2
+auipc t1 240963
+div s2 s1 ra
+addi t1 x0 -35
+divu tp s4 t6
+sltu a4 s5 t2
+slli a0 s10 11
 mulhsu s1 s6 s0
-add tp a7 a4
-sub t6 s4 t0
-andi s10 s3 1318
-and t3 s9 t5
-sub s7 gp s1
-auipc s7 696648
-divu t5 s5 ra
-auipc gp 840734
-or a3 ra t1
-slt tp s1 t6
-mulh ra t2 t0
-srli x0 a3 3
-or s4 s5 s9
-div t3 tp s9
-sub a1 gp s3
-mulh a7 x0 s11
-add s3 a0 s0
-slli a5 s7 25
-remu x0 s2 a4
-ori t3 t0 1020
-auipc gp 453028
-xor s5 a2 s0
-add s0 x0 s0
-mulhu t3 a2 s7
-mulhsu s10 a6 t4
-addi s4 t5 155
-mulhsu s4 t3 s5
-div a7 t6 ra
-slti t3 a5 -285
-slli s0 s9 13
-sub s9 t1 a0
-slti a5 t3 -896
-andi a0 t3 -343
-ori gp a3 -841
-div s2 x0 s8
-sra a0 gp a4
-or s6 s0 s9
-mulh a7 s5 x0
-slli s2 t6 18
-mul x0 a0 s2
-lui x0 496830
-andi s3 t1 1689
-mulhsu s3 x0 ra
-rem gp a7 s1
-mulh t6 tp s4
-mul t5 s0 a3
-srl s3 x0 a4
-andi a0 s6 1163
-sltiu tp a3 1477
-mul s2 s2 a7
-or s11 x0 a7
-slli s4 s8 4
-mulhu a6 s3 a4
-andi t4 a2 -650
-auipc s8 555970
-slli ra t4 2
-lui s10 617818
-xori a4 x0 -700
-sra t2 t1 s0
-div t1 a6 tp
-sra s2 a5 s10
-lui x0 27488
-andi s9 a1 -1168
-slli s11 t5 24
-add a5 t6 a4
-add a0 a7 s6
-xor s3 s7 t1
-divu t3 t2 a1
-or t5 t2 ra
-srai s9 x0 2
-remu s0 a6 s11
-andi s10 s4 230
-sra t5 a0 a6
-divu t4 gp x0
-mul a7 s6 t1
+add a7 t6 s2
+divu a3 s10 s0
+sltu ra t3 a3
+mulhsu s7 s5 ra
+andi s10 x0 1946
+andi a0 gp -440
+srli a0 t1 9
+sltiu s7 a5 -1890
+lui a3 554095
+lui s1 967074
+xori a5 s5 -1960
+rem t1 s3 s1
+sltu ra tp s1
+rem t6 a5 a6
+rem s10 t3 s4
+sltiu s6 s8 529
+sltu s10 a2 ra
+slli s0 t1 4
+srli a4 t1 7
+sll s10 t3 s0
+div t1 t1 t2
+andi t1 a4 -229
+srli a4 s10 1
+addi a1 t0 187
+slli t4 x0 18
+andi s11 tp -887
+slli t1 a1 13
+mulhsu t0 t3 t4
+ori s3 s7 -1419
+mulhu t1 a4 a0
+sll s8 s6 s4
+remu s1 a3 ra
+srl a5 ra a0
+and s0 a1 a4
+srli t4 s0 11
+srl a4 a5 a2
+srli a2 t6 8
+remu s4 ra t4
+srl a0 s8 s10
+slti a5 t1 909
+mulhu s10 s8 t5
+auipc a3 282092
+srai t2 a0 1
+sltu a2 x0 s10
+rem s11 a5 s9
+sra s11 a5 t5
+sub a1 gp t5
+mulhsu a2 t5 a2
+srl s11 s11 t4
+div a5 s7 s8
+srl t5 a5 a0
+div a4 a3 x0
+auipc x0 45190
+sltu s11 t1 s8
+auipc a0 31438
+mulh s0 t3 a1
+mulhsu a4 s9 a2
+sll a5 s11 s11
+xor s11 t2 t0
+add s4 s7 a4
+srli s6 s4 3
+and s6 t1 a6
+addi a4 s8 -467
+mulhsu t0 a0 s5
+mulhsu a4 t1 s10
+addi x0 gp -81
+add t0 t2 s1
+and s6 s5 t3
+sltu s9 ra tp
+mulhu a1 s10 a1
+or a0 t1 t5
+ori s3 t2 1357
+auipc gp 1042625
+sra t2 s11 tp
+div a6 a1 s4
+addi tp s8 -114
+mulh a7 s0 a4
+slt s1 x0 s1
+addi s7 s5 -1606
+sub s1 a5 a3
+addi a0 s8 1951
+rem s2 s9 s10
+andi x0 t4 -472
+sub tp s11 s11
+sub a0 s1 t1
+srai gp s1 0
+and a1 ra t6
+auipc a6 201456
+slti a2 t1 -1832
+andi s2 s11 -719
+or tp s0 gp
+sltiu t5 s5 -1535
+mulhu s8 s4 s4
+andi a6 t3 -1082
+sll a4 s5 s7
+sltiu a0 a6 -425
+lui s10 954940
+remu a0 t3 s5
+srli a6 a0 30
+or s3 s7 a7
+divu s4 a6 t4
+mulhu s3 s2 a3
+auipc s9 665224
+div s7 a4 a1
+rem a5 ra a0
+ori a4 a5 -1014
+slt s10 a6 a3
+sltiu a1 a1 1944
+or a4 s3 s8
+mulh a5 s3 a3
+auipc t2 262749
+andi s8 a7 1471
+slli s4 s1 1
+srl s9 s10 s7
+sll t2 t5 a6
+mulh gp a6 a5
+add s3 a6 s3
+slti t6 t2 -1200
+srai a2 t5 21
+srl x0 s1 ra
+mulh s11 s9 s8
+divu a6 a0 tp
+sltu s10 s10 s1
+andi s4 s11 -1604
+mulhsu a4 s8 s7
+divu s1 t3 a1
+sub s8 t4 s0
+sltiu a0 t6 -1228
+rem s9 t4 x0
+divu t1 s4 s8
+mulhsu s9 t5 t0
+divu a0 x0 s5
+sltu s0 t1 t1
+lui a6 577476
+slti s6 s11 180
+divu t5 t6 gp
+srli t3 tp 3
+slti s5 s8 -150
+sltiu s10 a1 -1946
+addi t2 t4 1331
+mulhu a0 a2 gp
+xori t6 t2 -1527
+mulhu a5 s0 t5
+srai s5 a0 26
+div ra t5 t4
+rem s9 t0 s0
+remu t4 s6 s5
+sra a1 tp s10
+sltu s9 t6 s1
+addi s5 s5 -1815
+sll tp t4 t6
+sltiu a7 s8 1181
+addi a3 s6 -1555
+andi s8 a7 232
+add a1 s9 t2
+srai s2 s6 26
+srai s9 a5 22
+lui t1 1040481
+srli t6 s8 26
+sra a4 s11 t0
+divu s8 a2 a4
+rem t1 a1 s10
+addi gp s2 -630
+slti a5 tp -320
+xor s1 s1 s5
+divu s0 tp a3
+mulhu s0 s7 s4
+rem s6 t5 s9
+lui s10 470463
+sub a7 t3 s6
+sll a1 a4 t5
+slli a5 s9 18
+mul a1 s6 a7
+rem s7 s7 t2
+sltiu a5 gp -1886
+slt a6 s10 s7
+sltiu t1 s2 -1158
+remu s10 t5 s9
+xor s7 a3 a6
+sub tp s7 s5
+ori t3 t6 -2009
+sra a7 gp a2
+add ra s3 t3
+xor t1 t4 a7
+lui s7 932514
+mulh a4 t5 s4
+slt a2 a7 s10
+andi s7 a6 -1630
+mulhu a4 t1 a4
+mul s10 a2 t1
+rem s10 t1 s0
+lui s3 917881
+rem s9 s0 gp
+ori s11 t2 -1499
+remu s7 a5 a7
+and ra t0 a2
+add a0 a7 a3
+srai s0 a7 11
+rem s7 a5 s0
+sub t1 t3 t3
+xor s6 s11 a0
+mulhu s7 s11 a2
+mulhsu t5 a0 t1
+and a3 s6 a7
+mulhu a6 t1 t6
+sub s1 a4 s5
+slli a7 s3 0
+srl s5 gp s0
+mulh t1 ra t2
+slti t0 s11 -192
+slti a2 s7 371
+srl t1 tp s5
+andi a2 a5 941
+slti x0 s5 -1177
+slt a0 a5 s0
+mulhu a0 s4 t2
+and s0 s7 x0
+ori s4 a2 -342
+mulhu s9 s6 s9
+lui t1 452442
+mul a5 s5 a1
+srli t6 t1 5
+mulhsu a3 s2 x0
+auipc s8 266480
+slt s0 ra s8
+srli s2 a1 13
+srai x0 a5 18
+xori s4 gp -982
+remu s11 s9 s8
+xori s9 s3 -1572
+slti s4 a3 1919
+sll t1 s6 s10
+sltiu a3 t3 -1435
+slti t2 s10 204
+srl s4 s4 a1
+xori tp t3 1764
+xori a5 a2 -1863
+ori t2 s0 -785
+sltiu t1 t0 1357
+mulh a6 s6 t0
+sub a5 a1 a0
+sll s7 s10 t4
+sub a0 a0 gp
+or a4 s9 gp
+xori t0 s4 -412
+divu s9 t2 x0
+divu t4 s10 t6
+remu t0 gp t5
+ori a1 a3 -1949
+xori a0 s3 -2010
+sltiu a7 gp -698
+srl t0 a0 s9
+ori t2 a2 -998
+add x0 s6 t6
+mulh s6 a6 t6
+rem x0 s11 t0
+mulh t4 s4 a7
+mulh s9 t2 tp
+sub s1 t2 x0
+srli tp s6 12
+auipc a3 989209
+xor s2 a1 a6
+auipc s11 303866
+or s2 a2 a7
+xor a6 s4 s10
+mulhu s0 t3 t3
+srai s8 a5 30
+xori s7 t3 1784
+sltiu a0 s9 -812
+ori gp a6 -1620
+or s10 s6 a0
+slti s8 ra -1335
+addi ra s0 -590
+sra s10 s8 t2
+lui a5 433715
+or t6 t3 s3
+mulhu s3 s8 s1
+sltu x0 ra s2
+sltu t5 a5 t4
+rem s7 a7 t0
+srli s9 t0 16
+mulhsu s8 a4 s11
+xori s10 s7 -540
+srl ra s7 t3
+rem tp a7 s1
+sub t0 a1 s6
+xor s2 a1 a5
+sra tp a7 t3
+mulhu s6 a5 t5
+rem t5 s5 s10
+slti t2 a2 -756
+mulhu s7 a1 t5
+mulhsu s11 ra s1
+sltiu tp s2 -120
+mul t1 t2 a3
+sltu s2 t1 a1
+srli a3 a3 25
+auipc t4 400172
+andi a1 tp -1342
+srai s4 a7 8
+sltu tp s9 t3
+mulhsu x0 tp s2
+slt a2 t5 a0
+rem t4 ra t1
+andi a5 a0 997
+sltiu a2 s9 -999
+lui s1 964277
+sub s0 s10 t4
+xor a2 s9 s2
+div s10 a5 t2
+mulhu a0 t0 s6
+or s10 s10 a7
+sltiu a7 s10 -736
+or s5 s1 t0
+addi s11 t6 -16
+sltu gp a1 s8
+addi s2 t0 56
+add t0 t6 s10
+mul t5 a6 s9
+srai t0 s1 3
+slli t2 t1 28
+add a4 s0 a2
+mul s9 a4 t3
+sra t5 gp a3
+mulhsu t5 s9 s9
+lui x0 193307
+slti s2 a0 -455
+sltiu t6 a6 741
+andi a4 a3 -853
+mulhsu t6 s3 ra
+ori t4 a5 -640
+slti t0 t2 -1208
+add a0 a0 t5
+mul a7 s3 a6
+srli a1 a4 29
+ori t2 s2 1752
+sra t4 a7 x0
+rem s8 t0 s5
+rem s5 s5 t0
+ori a6 s1 997
+mulh x0 tp a7
+xori s2 tp -249
+andi t5 s11 -1170
+mulhsu t1 t4 s9
+sltu t6 t3 t4
+slli t6 s3 0
+sltu s8 t0 t2
+mulhsu s6 a3 t0
+rem s2 a6 s2
+slti t5 s0 956
+auipc t3 699867
+ori a7 s5 702
+sltiu t5 s8 -468
+sltu t6 a3 a0
+xori t0 ra -1935
+srl s10 t2 t4
+xori t0 a5 -3
+slt s0 a3 a4
+addi s2 t0 1022
+remu s3 s10 s9
+andi t3 s3 -1473
+lui ra 138170
+and t4 a0 s0
+or x0 t6 s4
+sub s10 t3 tp
+sra s8 t1 t5
+mulh t6 a5 s1
+remu s0 s8 t6
+addi t0 t2 -378
+div a3 a7 s4
+slt t5 s4 a7
+divu gp s9 s6
+divu s9 s5 a6
+srai a6 ra 30
+ori gp t5 -592
+mul x0 a2 s4
+div t1 a0 s4
+lui x0 123359
+divu tp a7 s1
+auipc s5 261072
+srl s4 t3 t4
+remu t5 s7 t6
+mulhu a0 ra t5
+slt t0 s0 s10
+addi a6 s10 -1875
+andi ra s10 543
+slli s9 s0 26
+srl s6 s5 s1
+rem t5 s9 a1
+div t6 t4 gp
+sltu ra s0 t2
+xori tp s4 -1520
+addi s6 t2 -367
+or s0 t4 ra
+add s2 s3 t4
+xor a4 a0 s11
+xori s4 s10 -1413
+slli s8 ra 31
+sltu s11 gp s2
+remu s1 s5 a4
+sltiu t6 s10 -1201
+and s1 s1 t6
+xori s5 s5 -120
+srai tp t6 8
+sra tp s10 x0
+mulh t2 a1 a4
+sltiu t1 t1 -1840
+addi s9 a6 -2015
+and s1 s2 a5
+sltu t0 a3 s2
+or s4 a7 a0
+remu a5 s9 t1
+and s4 s11 a1
+slli s3 s4 15
+or s4 a1 s7
+mulh s4 gp s6
+divu t3 t3 a7
+sub s0 s8 x0
+rem t1 t6 s0
+mul s3 s4 t0
+sub s10 gp a5
+mul a6 a7 a7
+xori s6 s7 -672
+xori s6 a1 -566
+remu t2 s4 s3
+rem ra s5 ra
+mulh t6 t4 s2
+slli s0 s1 7
+mul tp s11 t6
+add x0 s6 s3
+srai t6 gp 16
+rem s5 a0 s6
+sub s6 t6 a3
+addi x0 t4 620
+mulh s8 s3 tp
+sub s6 tp s7
+ori s1 a5 -1119
+mulhu s8 a4 tp
+sll a5 t4 a3
+auipc a3 993576
+srli t1 x0 20
+mulhsu s7 t4 s2
+auipc s3 999325
+addi s4 t1 -1686
+andi s7 s6 -539
+and s3 s3 t2
+rem x0 a7 t6
+srli s8 a6 14
+xori gp a1 1670
+lui a3 31702
+sra s1 s11 a0
+mulhsu s1 s6 s11
+sll t0 s9 a1
+srli t2 t0 23
+mulh s1 s9 a7
+mul s3 s8 s1
+and t4 ra s0
+sra x0 x0 gp
+and t5 s9 s10
+mul s6 t5 s2
+mul a6 a3 a6
+lui a0 470537
+mulhsu t0 t2 t3
+remu a2 s1 t6
+andi ra a1 296
+mulhsu a6 a2 s8
+slli s11 a7 9
+mulh s0 s6 a1
+sll tp t2 a0
+srl s3 s4 s1
+addi s11 s6 378
+remu a6 s1 t6
+srli s5 a7 19
+or a6 s0 a5
+auipc a2 154792
+divu s1 s0 tp
+div x0 x0 s3
+ori s4 s10 1021
+or a5 t4 x0
+mul t6 a0 t6
+andi s0 t6 -1302
+slt t2 t2 s5
+divu a4 s5 s4
+slt s11 a0 a7
+and t2 gp a2
+srai a2 s6 27
+ori s0 tp -1495
+sll s0 ra s7
+andi t4 a1 75
+xor a3 s7 a4
+sll s6 s6 t3
+or s10 s0 s7
+srli t5 t4 11
+sub s0 t5 a1
+mul s5 t2 s11
+srl a1 s1 s0
+sub s2 s2 ra
+xor gp s0 s6
+add t0 x0 a2
+sub s11 a6 t4
+sra t4 s11 s1
+slli s9 t6 5
+sll t3 a1 s9
+remu s1 t2 ra
+sltu t2 a6 t2
+div s3 s7 t2
+sltiu x0 s11 2017
+and ra s7 s11
+sll a5 s6 t0
+mulhsu a3 a3 s4
+slti x0 a4 139
+lui a4 1008910
+xor t3 s2 t4
+or s9 s11 a3
+addi a1 a5 362
+ori s0 s8 -1885
+xori t3 s11 -108
+slt a2 a4 s0
+sltiu s10 t1 1215
+div s6 t3 t6
+slli s10 t4 0
+mulhu t1 s2 tp
+srai a4 a4 20
+mulhu s11 s3 s10
+sltiu s11 x0 -1460
+srli s10 tp 18
+sra gp s8 s11
+slti t4 s11 913
+xori t5 a5 -866
+sra ra a0 a0
+sub a4 s3 t0
+mulh s5 a5 t4
+rem s9 a4 a3
+xor a6 a0 s0
+srai s0 t6 15
+slt s10 a3 a3
+sub t5 s8 s11
+slli x0 s2 1
+xori t4 t0 1041
+srli tp a1 28
+slli a5 t5 3
+auipc s7 711601
+div s7 a4 t4
+mulhsu s0 s6 a4
+mul gp t1 ra
+xor a7 a5 s9
+mulhu t6 a7 a0
+mulh t1 t3 tp
+xori t0 t5 1201
+add s6 a3 t3
+addi s8 a7 -1567
+mulh t1 s11 s2
+and s8 s10 s9
+mulhu s4 s11 a4
+divu s6 gp a7
+div s7 t4 s5
+remu s8 s4 s11
+mulhsu a5 s0 s7
+lui tp 168102
+srai t5 t5 22
+or t0 t4 t1
+div x0 s6 t2
+remu x0 t2 s9
+sra t6 gp s5
+rem a0 t2 s9
+mulhu s10 t1 t0
+slt t5 s8 s7
+mulh s6 tp s7
+add s7 t6 a1
+andi s7 a0 -532
+lui s9 632701
+lui s2 347923
+addi ra s4 -123
+sub s5 t1 a6
+div t0 t5 s0
+or s4 a6 ra
+lui s9 800131
+add s2 x0 a0
+xori s0 a4 1410
+mul s0 a5 x0
+slli ra t2 15
+sub a1 a6 a3
+sra a6 a2 a6
+srl t1 t5 ra
+div s3 tp s5
+lui s9 327086
+sltu a4 a3 a3
+srai t6 s4 20
+slt s2 a0 a3
+mulhsu t3 t0 gp
+ori s7 a4 -1119
+lui a1 219387
+mulhu s11 a6 t3
+srai s7 a5 19
+andi s1 a2 -88
+sra a3 a6 t2
+sltiu t5 a1 -148
+add s3 s6 tp
+slti t5 ra -2008
+sra a5 s3 a4
+sub t2 s0 s9
+srai a0 a0 19
+slti s1 x0 -252
+xori t3 ra 1459
+sra s0 s2 s9
+slti a6 a1 1814
+mulhsu a4 s6 s9
+add s0 t2 t0
+addi tp s1 -197
+sll a7 t1 s11
+xor s8 s9 t5
+addi t1 ra -1761
+sltiu s0 s6 -1534
+srl t1 s9 x0
+mulhsu t3 ra s6
+and a4 x0 a7
+sll t1 s5 s2
+remu s2 a3 s3
+slt t5 t3 s7
+srli s3 t6 30
+add a3 a1 a3
+auipc s11 56436
+sltu t0 s10 s6
+remu s2 s7 s10
+sll t6 s3 a7
+slli tp a4 7
+or gp s0 s6
+andi t1 s0 -1094
+lui t3 484587
+sltu t3 ra tp
+slt s3 s0 a1
+mul a2 s5 t0
+addi t4 a0 -791
+mul s7 t0 a1
+mulhsu s5 a6 s6
+rem s6 t0 t4
+sltu t0 s7 s6
+remu s5 a3 s7
+mulhu x0 t5 a7
+mul t2 s10 s5
+slti s4 s7 -1534
+slt gp a7 s8
+or tp s9 a0
+sltu t3 a1 t0
+srai s7 s8 16
+sltu t4 ra s2
+div s9 t1 s10
+remu a3 t3 s4
+mulhu a2 s2 a6
+remu s1 s10 s9
+ori a7 s10 -1520
+remu s5 t1 a2
+srli a2 t0 18
+and a4 a0 a4
+or a4 s2 s6
+srli a4 a4 14
+or tp a6 s4
+xori s7 s8 -1925
+remu s2 t6 s4
+div a7 s11 x0
+xori t6 s11 -374
+slti s4 s0 -2027
+srai t4 t6 22
+slti s9 s0 -398
+sub s7 s6 s0
+divu s5 t1 s10
+mulhsu s9 s8 s9
+mulhu gp s0 s3
+slti s4 s9 -1898
+addi gp a6 -1908
+slli s4 ra 19
+mul s9 s5 s7
+slti a2 t0 -797
+sltu a2 tp s4
+sra s11 s5 s6
+auipc s7 854148
+andi t1 a3 -1996
+sltu s4 gp a3
+sub a6 x0 s0
+remu s1 s8 a1
+slli s4 t0 4
+slt a6 t4 s9
+andi s7 a0 -631
+remu s6 s4 a5
+sll gp s11 t3
+or x0 s9 s1
+sltu t4 s10 s3
+sltu s3 s0 t1
+or s0 s9 s0
+or tp t1 t1
+mulhu s5 a7 t4
+rem t3 t0 t6
+and x0 s11 a5
+srai a2 x0 10
+andi s1 gp -759
+or a3 t0 tp
+ori t1 a2 1212
+ori a3 s3 -1539
+xori a1 gp -1450
+mulhu ra a4 a1
+slti a0 a3 -1088
+or t2 s6 a5
+addi a5 a4 -1670
+srl a0 x0 t0
+div s0 s11 t2
+sra t3 s1 s5
+auipc ra 431418
+mulh a1 ra s8
+mulhu a5 t4 t6
+auipc s10 131430
+mulh s10 a3 s3
+sub s7 t2 t2
+andi s3 a7 -1006
+sltu s0 s3 a4
+sub s4 t0 a1
+sltiu a6 a2 -1777
+slti t0 a5 -1859
+ori a6 s10 -717
+rem s5 a4 gp
+slti t4 t5 1986
+mulhsu a0 s0 a6
+mulhsu s3 s11 tp
+mul a4 a6 tp
+ori ra s6 1669
+andi ra t4 1815
+addi a1 s11 -703
+xori s6 s1 -1901
+auipc s0 973818
+or s2 ra s11
+srai s8 t1 24
+rem a2 a5 t0
+slli s2 s11 22
+or s5 t4 t0
+slt s6 t1 t5
+remu t4 s9 t4
+sltu t1 a6 s11
+sra tp a4 t0
+rem s10 t2 a1
+divu t2 t1 a3
+ori t1 s7 -1685
+slli a1 a6 5
+sltiu s9 s4 -1435
+mulhu t1 a3 tp
+rem s10 s3 s5
+add s3 a6 s3
+mulh t0 ra gp
+slt t1 a5 tp
+xori t2 s7 1339
+mul s4 a6 t4
+xori t1 a6 -76
+divu a2 s7 t6
+sltu t6 t4 a1
+divu ra s2 t6
+sll s11 gp s9
+slt s5 gp s8
+xori tp a6 764
+slli a3 t0 12
+or s0 a7 t0
+sltiu s9 s5 -1276
+srai s3 s2 29
+divu t1 s6 s10
+mulhsu a6 ra a0
+sub a5 a6 s8
+slt s4 s7 t1
+mulh s7 a1 s10
+div a1 a1 s3
+lui a7 330956
+sltiu t0 s4 851
+xori s11 x0 278
+srl s3 a1 s0
+mul s2 a3 t6
+srai s4 t1 6
+ori t4 s1 1969
+slt s4 tp t4
+divu a5 s8 t1
+and a6 s6 t6
+xori gp s2 -1030
+or s1 t6 s5
+add a1 s11 x0
+mulhsu s3 s1 x0
+slt s8 s8 s5
+mulhsu t4 a7 t5
+mul t2 ra a6
+auipc t3 808298
+div s0 t3 a5
+xor s6 s6 t4
+add t5 s0 tp
+mulhsu a5 s11 t4
+slt a5 s9 a6
+mulh t5 t4 t6
+slli t2 t4 20
+div x0 s10 a3
+sub s9 x0 t6
+slli a7 tp 22
+remu s8 s1 tp
+mulhu t4 s0 s1
+rem tp s10 a3
+lui a7 569508
+divu s3 s5 t5
+lui gp 111263
+lui a0 925160
+or s9 t3 a4
+xor s5 s3 gp
+slti a3 s6 -300
+mulhsu s0 s3 t2
+addi s2 s7 598
+srli t6 t2 21
+rem s11 a3 s2
+srl s6 s2 s9
+slt a4 a3 ra
+sltiu t3 t3 1672
+sub t5 t4 t2
+mul s3 a2 s7
+slli s2 t2 20
+sltu s2 s6 t6
+mulhu s3 t1 s11
+mulh t2 t2 t1
+add s8 s0 s9
+sltiu s9 ra -501
+remu ra s8 a7
+sltu t3 t0 t0
+add s6 t2 t4
+srai a0 s3 20
+ori gp a2 1420
+srl a2 a1 s6
+sra s7 s9 a7
 sltu t5 s6 s2
-remu s2 t2 a4
-sltiu a6 s2 265
-sra s10 a5 s4
-and s7 s7 a7
-remu a6 x0 x0
-srai t4 s5 30
-slli a7 t0 16
-add a4 t5 a3
-div s8 gp s4
-sltu x0 gp s8
-xori gp a2 -1496
-sltu s8 s6 t5
-div s7 s2 a7
-mulhu x0 ra s5
-sra ra t2 s3
-srai a3 s10 24
-auipc a7 26460
-sltu t0 s9 t3
-add x0 x0 s4
-divu x0 s2 s3
-remu t1 s0 a4
-mulhsu gp s6 s9
-srai x0 x0 14
-sll t6 t6 a6
-sltu a7 a0 a0
-remu s11 t5 s0
-sra s4 s2 tp
-srl a3 t5 s5
-ori s8 a3 252
-or tp gp s6
-xor t3 t4 a0
-slti s4 t3 -644
-slt a0 a3 x0
-slli a3 s6 18
-lui t6 109259
-slt a3 a2 t4
-remu ra s3 s0
-srai t2 t3 27
-mulhu t4 t0 t0
-ori a4 t6 -1747
-sra gp x0 t5
-sltiu s4 gp -2040
-or t2 s2 s0
-xor x0 t4 tp
-or a2 s11 s1
-xori s0 x0 953
-slt a7 s1 s11
-div a2 t3 a0
-srai a6 s7 3
-slli gp a3 16
-ori a0 s0 -2022
-mulhu x0 gp a6
-addi x0 a2 134
-lui t2 432472
-xori s10 t2 953
-mul a0 t6 a4
-remu s5 t5 s8
-xor t0 t4 s11
-mulh s3 s0 a2
-addi a3 s1 -1830
-xori t4 a6 -1644
-and t0 s4 t6
-mul s1 t0 x0
-slti s2 gp 261
-ori t6 s1 -144
-mulhu s8 s9 a3
-rem s11 s1 tp
-srli a1 a5 8
-slti s2 s8 2003
-slt t3 a4 t0
-addi s0 s5 -1678
-mul a3 t5 s3
-addi t4 s5 -1184
-srli s10 x0 27
-rem s6 s5 t5
-mulhu s6 a7 a3
-xori s1 s11 30
-srai s11 t1 29
-mulh t3 s9 a5
-sub t0 s2 x0
-ori a6 s0 -682
-divu s11 x0 x0
-slt s3 a1 s9
-xor t4 t2 s6
-xori s7 s3 -883
-addi a4 s9 -256
-auipc s6 373632
-sltu a6 s0 s8
-mulhu a3 s4 t6
-divu s10 a1 a1
-divu a4 a6 s5
-sltiu t6 s7 -1254
-auipc s2 328711
-slli s8 a3 28
-sltiu t3 s4 -862
-mulh t3 s10 s0
-sub s11 s0 a5
-div s0 s10 gp
-xor s0 t1 a7
-slli a2 t1 5
-sub s2 s6 t2
-sra t0 t3 ra
-andi s5 s8 -1931
-srl s10 t1 tp
-sra s5 s8 a6
-sub a0 t0 x0
-and a1 a1 s9
-slti t3 a6 -1265
-slli s0 s11 18
-srai t6 a7 24
-slli s4 s6 15
-ori a6 a7 -2007
-remu ra s1 s9
-add t6 t4 t4
+sub s9 a4 s8
+srl s7 s9 ra
+srai ra tp 1
+sll t0 a1 a5
+mulh a5 a1 a2
+auipc t1 582828
+xor s0 s7 a1
+sltiu s6 a3 -738
+srli t6 s9 17
+sltiu s5 s10 -1930
+rem t1 s2 t0
+sub s3 gp a6
+ori a2 gp -1107
+srli s1 s0 19
+srai a2 s5 14
+ori t3 t3 -398
+sltu t5 t4 a3
+andi a2 s2 1785
+xor s3 s3 s0
+auipc s2 842605
+rem s3 s4 s8
+add s5 t0 s1
+mul s5 s11 a7
+xor s5 s7 a6
+and a0 a0 s2
+sub t1 t0 t5
+addi t6 s1 927
+divu a6 t2 a1
+andi a3 a7 -876
+divu s7 s10 s2
+add a1 a0 t1
+sra a6 t2 s7
+sltiu s8 a4 1884
+xor a0 gp tp
+mulhu s6 t0 tp
+sra a7 t0 a7
+addi s7 tp -1964
+or t6 a2 s3
+sltiu t1 s10 -1027
+lui t6 850769
+lui s10 37693
+mulh a5 s4 a2
+sltiu t1 t3 -647
+xor t6 t5 a1
+sltu t2 a7 ra
+ori s9 t5 -1980
+ori s3 a2 -1288
+mulh t3 s5 ra
+slti t3 ra -414
+xor t1 t4 t2
+xor s11 tp s2
+srai s2 ra 26
+srl s8 a2 s0
+div s10 a7 t6
+slli s2 t4 0
+auipc s2 983321
+rem gp s4 a1
+slli s10 tp 23
+xori s10 s6 -1065
+addi t5 t2 1898
+lui a5 715475
+mulhsu a6 s6 s8
+andi gp a6 -206
+divu s8 t3 s5
+rem s5 s11 s8
+and t3 a5 s5
+slt a5 s9 t0
+sltu s4 s9 s1
+rem t3 a2 tp
+lui a0 352379
+sll a5 s4 a6
+slti t5 s6 940
+sub x0 s5 gp
+slt s1 a4 a3
+mulhsu t2 tp t4
+mulh t4 a2 a6
+srli a3 s5 6
+sll a7 a3 a3
+mul a7 a0 s2
+slt a7 a1 tp
+andi s4 t2 830
+sll s10 a2 s8
+lui a7 717032
+mulh s7 s10 s8
+auipc ra 786016
+srai s9 a7 14
+andi t4 t1 -606
+sll a6 s5 ra
+mulhu ra t3 a7
+add s4 s7 t0
+mulhsu a4 s10 a1
+mul s8 gp s1
+sub t0 a7 a1
+sltu s3 s7 t1
+slt a5 a6 t2
+mulhu s11 gp a6
+mulhu s4 t3 t2
+srl a7 a0 s11
+mulh s8 t4 t6
+xor a6 gp s5
+mulhsu s0 s6 s0
+or a4 a2 gp
+sra a3 s9 s5
+mulhsu ra a5 ra
+andi a7 s8 -660
+addi t1 tp -1435
+slt ra t6 t1
+sltu s0 ra a3
+addi s2 t4 953
+addi t6 s10 -1734
+lui t5 486051
+sltiu a3 s7 1058
+addi a0 t5 -403
+xor a3 t3 t3
+xori t6 s11 370
+and s6 t3 gp
+divu s7 a6 s3
+srl a7 t2 t0
+sub s4 t4 tp
+sltiu a4 t2 -280
+and s4 s6 s11
+add a5 s9 t2
+sub ra s1 s2
+or t3 s1 s5
+xori x0 s5 -610
+rem t0 gp s5
+sltu t3 t4 t4
+sra s9 x0 s4
+div s6 t6 s0
+srl s5 t2 a6
+or s10 t5 s1
+mulhu s6 t3 a3
+xori a7 s5 -1649
+slli a4 t6 27
+add s5 t2 a3
+mulh t2 a1 s0
+rem t2 a4 s7
+remu s4 ra s11
+slti s9 s9 123
+ori s6 s9 -1238
+auipc t3 534644
+and a5 s7 s5
+srai a6 gp 1
+sub s5 s0 gp
+mulhsu a2 t6 a2
+ori s8 gp -328
+and t4 t3 t1
+ori ra a1 -678
+slti a0 a4 -668
+auipc a6 782623
+or t0 t0 s11
+srl t1 a0 s7
+sltu t5 t0 s4
+sub a5 a5 s1
+or a6 s3 s0
+xor s10 s10 s9
+srai t1 s0 6
+xor s1 x0 s5
+addi s8 a3 -1934
+or s11 x0 t4
+srl ra a5 s10
+srli a4 s1 2
+mulh s3 tp a4
+srl s0 s0 t6
+mulhsu s1 s7 s4
+remu a2 a6 t5
+srl t2 s10 x0
+mulhsu s9 a3 s6
+xor ra t1 ra
+auipc tp 204834
+mulh s10 s9 s9
+mulhu t6 a4 t4
+sll tp a0 a6
+srai x0 a4 5
+or t1 s3 s3
+lui a5 1035298
+sra s1 s1 s9
+or t2 t0 t6
+xori a5 t2 2029
+slli s11 a0 19
+add s6 a4 a6
+sll s6 a2 s8
+add a7 a3 s10
+srai a6 a0 28
+xori s1 s9 -652
+divu x0 a6 a0
+srai s2 t1 26
+ori t4 s1 582
+slt s1 tp s7
+mulh t5 a7 a5
+slli s9 s6 19
+slli s3 a2 5
+sltu s3 s7 s11
+sltu s3 a0 t1
+andi gp a2 -1605
+divu s8 tp s0
+sll a6 s9 a1
+xori a5 t4 -1575
+or s1 a2 a5
+andi a5 t4 -538
+srai t6 a7 10
+xor a2 s7 ra
+sltu s0 a1 t3
+srli a5 s11 3
+srl s8 s10 s0
+auipc s8 578214
+addi t1 s5 -1492
+xor t2 a7 a4
+auipc x0 658146
+sltiu a4 t4 -360
+sll s6 s1 s10
+srai t5 t5 7
+andi t2 a0 -1318
+ori t2 t6 -1940
+srl s11 s5 a4
+remu s1 a3 s6
+sltu a0 s5 s4
+div t6 a7 s3
+ori a4 t1 -1686
+srai gp a2 19
+slli t5 a2 2
+srai s1 a4 24
+sll s10 s6 ra
+sra t3 s5 s7
+slli s10 s11 23
+add a7 t2 s3
+div s8 t5 ra
+mulhu s11 s7 a2
+divu x0 s6 s10
+slti gp a2 930
+slt a0 x0 x0
+div gp t4 t3
+mulhsu s1 s4 tp
+lui a1 886527
+srai ra s0 27
+srai s0 s7 13
+srai a3 a1 28
+sra t2 s6 s7
+xor a3 t1 t5
+sltiu a7 a5 -644
+sub a3 s11 t3
+add s0 s0 a1
+srl s11 tp t0
+sltiu t3 s2 -1180
+remu gp a1 s0
+add s3 a3 a6
+srli t2 s9 17
+lui tp 881740
+add a4 gp gp
+mulhu t6 s1 s11
+sltiu s6 t4 163
+mulhu a0 s6 t6
+mulhu s0 t2 s5
+lui x0 889094
+srl s9 a1 s10
+mulhu a6 t4 a4
+slt s2 a0 gp
+addi s7 s7 -493
+sltu s6 s8 s0
+sub s6 ra t6
+or a7 s7 gp
+mulh s0 t4 s1
+srl t4 s2 tp
+remu s0 s3 a7
+mulhsu tp a2 ra
+auipc t0 1020456
+mulh s2 s0 a0
+mulhsu ra s6 t2
+slli s2 gp 3
+xori s0 t4 -1536
+div tp t3 t1
+div s0 a0 a7
+remu s9 tp t6
+andi t4 t6 -942
+slli a0 a0 28
+ori x0 gp -209
+andi s10 s8 -801
+srl a4 s2 s7
+slt a3 a5 s4
+ori t2 s7 837
+auipc s6 225158
+divu s9 a7 a3
+mul s7 s9 s1
+remu a1 ra a0
+mulh a7 s2 t2
+sltiu a6 s5 -1463
+auipc t6 821513
+add a4 ra t1
+sub a5 s9 s2
+mulhsu t5 s2 a5
+mulh t3 t5 s10
+ori s11 a2 361
+srli a6 s7 16
+lui a2 188587
+add a1 a5 s3
+auipc s5 589890
+xor t4 t0 gp
+sltiu t0 s5 1782
+and a2 s0 gp
+sltiu t5 s9 -592
+mulh s7 s11 t6
+srli t4 x0 11
+slli s11 a3 22
+mulhu s11 gp x0
+mulh s8 s1 gp
+srai s3 s9 17
+xor a6 t3 a7
+sltiu a3 s4 -1043
+sra a4 s1 t0
+mulhsu a2 s9 s7
+srl t2 tp t1
+mulh s6 s11 t2
+sub s1 a2 s1
+slt s2 a2 a7
+and s2 t1 s1
+remu s2 s3 s0
+or tp t2 t1
+auipc ra 289386
+slti a6 t1 -1757
+addi s10 a5 -1033
+div x0 tp t5
+ori tp a1 1631
+add t4 t1 t6
+addi gp t0 -200
+andi s5 gp -1500
+or t0 s7 t2
+sub t0 x0 a6
+remu s2 a4 a6
+sub s0 a7 x0
+div s8 s11 t1
+mul t5 s2 t1
+lui a1 270845
+andi a1 a5 -1439
+div gp x0 s3
+rem s0 s3 s8
+mulh a0 t2 x0
+div s2 s7 t5
+or s11 a6 s2
+sra a2 t2 s3
+sll t0 a1 s5
+sra ra t1 s4
+mulhsu s8 s1 a3
+sra t4 a5 a7
+remu t2 s7 t3
+div gp t4 s5
+mulhsu t5 s11 t2
+or a5 ra a4
+sltiu t1 t5 -73
+or a7 s5 s10
+srl ra s1 a4
+add s1 t5 s2
+mul a6 a1 a6
+add a6 s9 s0
+mulhsu a0 s6 x0
+div s3 t5 a6
+slti s5 s4 -1991
+divu t0 gp t0
+sll t0 gp a2
+sltiu s2 x0 1413
+sltiu s1 t1 -778
+mul t4 s11 t1
+sll x0 s11 a6
+add a2 s11 s6
+addi tp s11 -1983
+divu s2 t2 x0
+xori s0 x0 -504
+sltu s1 x0 tp
+srl tp a1 t1
+and a0 ra t3
+xori t5 a1 -606
+slli s2 s0 10
+slt a0 s2 s8
+div s8 s5 s2
+xori s3 tp 1777
+slt s8 a3 x0
+slti gp a5 711
+remu s8 s10 a5
+add s0 a3 t3
+sltu t6 t6 t1
+remu s10 a3 s3
+srli gp s10 7
+xor t2 ra s8
+addi gp a5 94
+srli s2 s6 8
+mul s4 s6 s1
+sub a0 a3 x0
+slti t3 t5 -1063
+remu ra t5 a4
+rem a6 a0 t0
+auipc t3 301866
+div a4 t5 a2
+srli s4 s1 31
+sra t3 s6 t2
+sltiu s7 x0 1879
+sra t0 a5 t1
+remu tp s9 t4
+xor s10 t3 a4
+slti tp s10 -1227
+mulhu s3 s2 t1
+xor s0 a0 s6
+srai a2 s3 19
+sltiu a1 s1 -336
+sra s7 tp s7
+rem ra s6 s3
+remu ra tp gp
+lui s3 545826
+divu s7 t4 s7
+sll s3 t4 a3
+divu t1 t2 a5
+slti a7 t2 757
+divu t5 gp t6
+or s9 s4 s6
+sll s8 a3 t1
+rem a7 s6 a0
+srai gp a3 31
+auipc s2 928262
+mul s6 a7 ra
+xori s10 s4 -910
+remu t3 a7 s10
+rem t1 a5 t4
+lui s9 784379
+slli x0 a3 26
+slli t0 s1 16
+mul gp a4 a2
+andi s1 s0 -821
+slt s7 gp a3
+andi s11 t1 -641
+srli a3 a6 16
+remu s10 a3 t1
+sra t0 t4 a6
+divu a2 t1 a6
+mulhu t4 s7 s10
+sra s8 tp s0
+auipc s4 45790
+div s9 t1 s5
+mul s11 s5 s4
+lui tp 778981
+mulhsu t6 s6 x0
+sll t5 s10 a3
+sra s3 t1 s6
+srai s11 a3 7
+srl a7 s2 a4
+auipc s10 513287
+slli s11 t3 8
+slt a3 s9 a7
+andi s2 s2 -641
+mulhsu s3 t2 a6
+lui s9 918680
+slt x0 t4 t0
+or t2 a1 a2
+slti ra t5 -1642
+sltiu x0 a0 -1523
+or a3 a1 s2
+or s1 t4 t3
+sra s3 s7 t4
+mulh ra s0 a0
+remu t2 s4 s1
+sub s8 a3 s11
+divu a5 s0 a3
+srli t0 a1 2
+slt a5 a6 s11
+and s8 s2 a2
+sll a3 a5 s6
+xori s5 s1 831
+srl a3 a2 a7
+andi s7 t0 -984
+srai s11 a2 11
+mulhsu x0 s10 s3
+sltu a3 t2 a7
+mulhu a0 s3 ra
+ori s2 t6 1185
+addi s4 a2 -1068
+and a2 x0 s5
+add a7 s7 ra
+sub a0 tp a3
+div tp s6 s5
+xor s11 a7 t6
+addi t0 a1 1703
+xor t1 t5 x0
+slti s11 t1 -1252
+sra tp a4 s1
+mulh a0 s3 s5
+xor a1 s1 a0
+addi s11 s11 -1889
+or a1 a1 t5
+andi t5 s11 1350
+and ra t5 s9
+sra s0 s6 a3
+remu x0 s3 gp
+sltu ra s11 s1
+slli a5 a7 16
+remu s4 t3 t4
+and a2 a5 s7
+div s11 s11 s11
+mulhsu s1 t1 t0
+auipc s2 1042440
+sub tp tp ra
+mulhu s7 t6 s4
+slt a5 a1 t5
+divu s4 s8 tp
+sub s8 s3 a7
+divu s3 s8 gp
+mul t0 a0 t4
+slti a6 t5 -2048
+andi tp t0 -1835
+lui s5 277683
+divu a0 s7 a4
+sub s2 t1 ra
+slti a4 tp -296
+mul s8 a7 s1
+rem s6 s11 s5
+mulhsu s7 a6 a0
+remu a1 s1 a6
+srl s11 s7 s11
+sra t6 a2 a7
+addi t3 ra -446
+sltu s1 s4 a2
+mulh s9 a6 a6
+sltu a5 s1 t1
+remu s4 t4 x0
+srl a7 s7 a4
+mulhu s11 tp s6
+mul s9 s0 t2
+slli a7 a0 3
+rem a5 s6 t3
+sub t0 gp ra
+srai x0 a7 4
+sub a2 x0 gp
+sltu s7 a0 t6
+slli t5 ra 2
+andi t2 x0 -588
+lui s4 800042
+rem ra s1 a3
+sra s8 a1 a5
+and t1 a0 t2
+srli tp s2 25
+srli a1 a3 8
+sltiu a7 a0 1268
+divu a6 s7 s6
+sltiu a2 a2 1040
+andi t6 a2 -1864
+sra s3 s11 t4
+xor a4 x0 a5
+srli t1 s8 14
+mulhsu a0 s10 s3
+and s2 a5 tp
+sub s3 s6 s0
+srl s5 a4 t6
+andi s1 s10 -6
+mulh s8 t2 s1
+xori tp s2 1395
+mulhsu t2 s3 s10
+srai t1 a3 2
+addi s4 s5 -1758
+sub t4 t6 s8
+slt tp s11 s4
+xor a3 a3 a6
+srai s6 a2 19
+sltiu s9 s7 -983
+lui s3 664626
+sltu gp s4 a0
+srl a4 s1 s5
+rem s4 s4 s11
+remu s5 gp s11
+srli t3 t4 27
+remu a2 a2 s8
+srli s0 a1 25
+sra a6 s9 s10
+sltu s6 t5 s2
+srai a5 s0 13
+mulh t2 t4 s3
+xori a0 t5 -41
+sltu s11 s2 s7
+and x0 s2 gp
+divu a1 a6 s8
+xori gp a7 -1827
+ori a4 a5 1779
+sra s4 t3 t1
+sltiu tp t1 -910
+and a4 t5 t6
+or s6 tp t5
+andi s4 s7 -1650
+mul s8 t3 t2
+andi t5 s1 -1384
+and t2 s6 s8
+addi a2 s9 1013
+srl a7 x0 s8
+slti t1 s3 -1770
+xori t0 t3 -457
+sra a1 s9 a7
+lui s7 345732
+divu a0 s5 t4
+slti a6 s4 -667
+srl a1 t3 gp
+auipc t0 701060
+xor s1 ra s5
+rem t2 a3 s6
+srai s3 s10 4
+sub a1 s11 t0
+mul t0 a1 ra
+addi a4 s0 -1719
+mulh s2 s5 t2
+add tp s4 s2
+srai s10 s7 8
+srli ra s9 20
+and s8 s10 t4
+andi s9 t0 -1139
+sltiu s1 t6 1951
+sltiu s3 t4 -1053
+mulhsu t1 t1 a3
+sll t4 ra gp
+rem s4 t6 s2
+sll s6 tp s11
+mul ra a2 s1
+divu a2 t1 a0
+mulhu t2 t5 s7
+sra t0 t5 tp
+ori s2 a3 1958
+mulh t0 x0 s7
+srli x0 s6 9
+mul a5 t2 a4
+rem a1 s5 s4
+or s2 x0 t1
+mulh s5 a6 s3
+sltiu t1 t6 -1438
+mul a5 t0 gp
+slli s10 s8 23
+sra a0 s5 t5
+xor s3 t5 s11
+slt s0 a7 s1
+srli t4 t4 0
+lui s10 759345
+andi a0 s9 -216
+div gp gp ra
+ori t0 t1 -5
+slti s7 a0 1357
+or s4 t5 s11
+rem s2 s4 t6
+sll a0 s7 gp
+remu s7 a4 t1
+sltiu t1 t5 -1421
+andi a2 t6 1444
+srai s7 s5 13
+sub s7 a6 s0
+mulh t4 t6 gp
+mul t1 s11 a5
+slli a0 a4 17
+lui t2 109994
+sra a4 s5 t4
+mulhu gp a2 t0
+slti s0 s10 -325
+slli x0 t1 1
+slli s6 a4 24
+ori x0 a5 453
+add x0 a6 x0
+sltu a1 a0 s8
+sltu s7 t5 ra
+lui s11 175389
+mulhsu s6 a4 gp
+sltu s10 s3 a5
+xor s3 t5 t4
+auipc a2 133902
+sub s5 t3 ra
+xori s3 s0 -1343
+add t6 s5 s4
+xor x0 tp a5
+srai a0 a1 0
+sub a5 ra s6
+sra t6 a1 s8
+srai x0 a3 16
+srai gp x0 28
+mulh s8 t5 s2
+divu a2 s4 t2
+remu a7 t6 a6
+srai t2 s10 3
+mulhu s10 ra tp
+xori a3 s10 1260
+auipc s7 553060
+lui a5 346350
+rem x0 s4 tp
+addi t2 s6 79
+mulhsu tp t5 t4
+xor t0 gp s5
+add s3 t3 t3
+ori a2 s3 1969
+slli gp t6 22
+div s5 a7 s1
+slti t6 t3 -1908
+ori ra s2 -1580
+or a2 s8 s8
+sub s11 a3 a2
+divu s5 s4 a3
+div a2 a3 x0
+sltiu s2 s4 -651
+mul s8 ra s1
+lui t3 607014
+mul t3 s7 t0
+or t4 s6 a7
+divu ra s10 a1
+slt tp a5 s9
+srli a7 a2 5
+ori s1 s4 -1981
+mulhsu s10 a4 t0
+add s3 s6 ra
+add tp a4 s4
+rem t6 s3 s5
+sltiu a7 s10 -889
+mul s1 t1 s9
+sltiu a3 a2 1692
+ori s0 s6 -446
+and a3 gp a3
+srl s3 t0 t4
+sra a4 a2 a3
+divu t1 s3 s6
+mul s2 t1 s10
+slti s0 s0 -1903
+divu a6 s7 s9
+slli s7 s4 29
+sltiu a5 tp 1975
+sltiu s1 a6 345
+xor t1 t4 s6
+sll a7 a2 s9
+sltu a7 s0 tp
+addi t2 s3 182
+sll t3 ra t3
+srli s1 s8 1
+lui ra 789809
+rem s0 a5 a5
+remu s4 t3 s7
+remu tp a6 t4
+srai t6 s3 27
+slt s7 t2 t3
+ori t1 s8 -1878
+and s2 gp s6
+mul s4 s11 a7
+ori tp a6 -661
+sltiu t0 tp -650
+mulh gp s2 a1
+sltiu s11 t0 -651
+sub s1 t5 s3
+andi a3 a0 -579
+mul s2 x0 s10
+div a1 s7 t4
+remu s7 s5 gp
+add ra s7 a0
+sltu a0 a7 ra
+slli s4 s0 25
+rem tp a7 s5
+andi s8 s3 -1794
+andi s7 s5 -429
+divu t5 s7 a5
+lui s3 184394
+sra a1 a4 t5
+srl a3 t2 a5
+srl a1 s3 t3
+srl t1 t4 s2
+slli t4 tp 3
+addi s8 s8 -752
+div x0 s11 a4
+xor a1 s11 t5
+mulh a3 tp a0
+xor gp s3 s0
+div x0 t5 t5
+sltiu a7 a7 -859
+sll t1 a3 a4
+sub t2 t2 t4
+addi a5 a2 -480
+ori t5 s5 -1152
+remu a6 s3 tp
+sltu a7 t0 s10
+sltu s4 s5 s6
+add ra s3 s4
+xor s9 s1 s4
+srli ra t6 1
+sub s7 t0 ra
+srai a0 t4 17
+slt a7 s7 t5
+mulhu t0 s6 t0
+sltu a0 s8 a2
+srli t0 a7 16
+mul t4 s8 x0
+srai s0 s0 9
+srli a1 a6 2
+xori t1 t5 -517
+rem a4 t6 s11
+addi s0 s11 752
+xor a5 a3 s5
+slli t2 x0 25
+sub s3 s8 a0
+sltu s11 s4 ra
+rem t2 a6 s5
+srli s8 a7 27
+or t2 s4 s1
+mulh s6 s2 t3
+sub t3 s6 a0
+remu s9 a6 t4
+srl t0 a0 s9
+div t3 s10 s7
+mulhu t6 s4 gp
+div x0 ra t0
+andi t3 a1 -737
+sltu s9 s11 s4
+ori t4 a1 -899
+mulhsu a3 a3 a3
+lui a7 84162
+andi a4 s3 1557
+srl s8 s7 t6
+divu a7 s0 s4
+mul a1 t4 s8
+addi s4 t5 1760
+sll a6 s10 s5
+add a4 t0 a2
+andi s5 a1 1397
+sltiu gp s3 -650
+sltu t5 s1 s3
+sll tp a1 t0
+div tp s3 t5
+mul a3 t4 s9
+sltiu t0 t4 1465
+sltu s5 a7 t5
+addi a1 t4 -537
+andi s5 t5 944
+srli s1 t4 13
+lui gp 20459
+xori gp s9 -240
+andi tp t5 -567
+xori s1 s5 -139
+or t1 s5 t1
+srl a4 s11 ra
+srli s10 s0 23
+mulhsu a0 s0 t3
+divu s8 s6 s7
+ori a0 a6 232
+mulh s8 s10 s10
+mul a6 s6 s10
+sltu a7 t0 a0
+sltiu s9 ra -1610
+slti x0 t5 -1262
+srli a3 s6 4
+auipc t6 437608
+divu s0 a0 a1
+slt t5 t0 s5
+lui t6 674694
+ori s11 t5 1137
+andi s8 s10 890
+xori s10 s2 992
+add a1 t6 a2
+and s1 s3 t3
+sll gp s4 s5
+srli t2 a1 30
+sra t2 a3 t0
+div a2 s11 s9
+slti s1 s5 469
+sub s5 t6 s0
+div a0 s9 a7
+div a7 s8 s11
+add a6 s5 a4
+div s0 a2 s7
+srli s2 s8 23
+sub tp a2 tp
+sub t1 gp t0
+lui t2 400260
+sltiu a0 gp -1880
+srl a4 a7 t5
+mul s0 t5 s4
+slti s5 t1 -1962
+mulhu tp s4 s11
+sltiu t2 s11 -148
+mul gp a4 t1
+ori t6 s2 -81
+rem a2 a3 t1
+div a7 s4 a6
+andi s4 gp -1009
+mulhu a4 s6 s5
+mulh gp t5 a0
+mulh s6 s10 t0
+mul a1 a0 s6
+lui ra 939889
+or x0 s6 a6
+div t0 a7 t5
+srai a4 a2 30
+mulhsu s6 t0 t4
+auipc a5 239961
+srl x0 a3 t5
+andi s11 a4 536
+remu s7 a1 s7
+remu x0 tp s5
+slli a6 ra 27
+xori s4 t3 -1563
+lui s0 886466
+srl a2 s10 t6
+srai s11 a1 22
+rem s5 s9 tp
+sll s1 a2 tp
+divu s4 a7 t6
+andi a7 s10 -1981
+andi s8 ra -776
+slt gp a4 a4
+remu s0 a7 s1
+srli a7 t4 14
+xor t0 t4 s2
+and t1 a0 s7
+srl a0 ra s6
+sub t4 x0 s6
+divu t1 a2 t2
+xor s11 t0 s10
+divu s9 s9 gp
+mul t4 s11 a2
+div s9 ra s4
+mulhu tp t4 a7
+srli a7 s11 22
+divu s8 t3 a5
+sltu t1 gp s10
+lui a4 76472
+or t1 a0 s6
+mulhsu t0 s6 a0
+and s1 s4 a5
+and a3 a3 t1
+or a5 s11 t3
+slli tp a2 22
+auipc s10 60852
+and t4 t3 s3
+slti t2 s2 769
+sub s5 tp s0
+slt s0 s5 a7
+divu a1 t4 s10
+sltiu a3 s8 -1217
+mul s8 s10 a4
+and a4 s4 t0
+rem s5 a4 t3
+add s0 a1 a0
+auipc a1 881548
+and s3 s2 a5
+divu t0 a3 t5
+xor t6 s5 s7
+srl s7 s0 a0
+div t3 gp a4
+add s11 a5 s0
+andi s4 s6 297
+or s11 t1 s2
+slt a6 a4 s9
+slt s5 t2 gp
+add t1 t5 s10
+mulhu s4 a5 a1
+sltiu s8 a3 -1296
+mulhsu s1 s2 s2
+mulhu a3 t0 s7
+or t1 s3 ra
+andi a3 t5 111
+rem ra s4 t4
+mulhsu a1 a0 a0
+lui a6 43306
+mul t6 a1 s0
+div a7 a4 tp
+srl ra s7 s2
+div ra t2 s6
+srai ra s2 21
+sltu s3 s4 s3
+srli s8 gp 5
+sub t0 s3 t0
+mulhsu s8 a4 s4
+srai s4 a6 26
+div x0 t3 a5
+xori s5 s3 -1633
+mulh a1 a7 s5
+andi s9 t1 -682
+mulhu tp a5 t6
+slt t2 t6 t1
+mul t3 a0 s1
+sltu t6 s0 a5
+lui a0 201586
+sll t6 a6 a3
+auipc t5 509158
+rem a3 a2 a7
+sltiu s6 s10 -1996
+srai s6 t3 8
+slli ra a7 4
+and a4 gp s0
+srli a6 s4 28
+addi t0 s3 483
+addi t6 a1 -770
+srai s1 s8 16
+rem t5 tp s9
+srai s6 t4 23
+xor a3 s11 a6
+auipc s0 795696
+sra a4 s11 s3
+or ra s4 a2
+auipc s11 853071
+sll s6 s4 a6
+rem t1 tp a6
+lui a1 300198
+mulhsu s2 ra a4
+addi s5 a4 1081
+div s6 s1 ra
+mulhu t3 a1 s7
+divu a5 tp x0
+slli x0 s9 11
+or tp gp s10
+rem t0 a7 s4
+mulhu s7 t2 a7
+div a6 a6 t2
+srai a5 s6 18
+srl t6 s11 t0
+add a3 s3 s1
+mul s11 t3 t6
+sra t2 s8 t2
+sub ra t1 ra
+mulh s4 t6 gp
+add s5 t5 t4
+srai s6 x0 8
+div gp s8 s10
+mulhsu t3 s5 s8
+xori a6 a0 -752
+slli tp a2 17
+divu s1 ra a2
+mulh tp s7 s4
+lui a7 468373
+and s1 a2 a1
+srli s1 s9 30
+xori a4 a6 209
+rem tp s5 s1
+add s0 a4 a3
+sra a1 t5 s1
+srl a6 s0 t3
+mulhu s4 s1 gp
+mulh s2 s2 s11
+mulh a1 a3 a3
+sll t1 s4 a5
+ori s2 s10 -837
+sltiu a1 t1 -834
+div s0 s6 a3
+mulh a0 s5 s1
+mulh t5 s7 s6
+auipc t0 24599
+sll s5 s8 s6
+mulhsu s8 s6 a2
+lui t0 848056
+mulhsu t5 t1 s9
+xor t0 gp a3
+sll t0 s2 t4
+mulh tp t2 s3
+sub s9 t4 t3
+srli a5 s6 6
+ori t2 ra 476
+sltiu t3 a0 1918
+sra s11 t5 tp
+andi t4 a6 1818
+srli a7 t3 18
+slt t1 a7 t4
+remu t0 t6 s3
+auipc s5 440719
+sltu s2 s10 s2
+sltu a5 s3 s6
+sltu gp t3 s6
+and t4 t1 t6
+add ra t5 a6
+mul tp t1 a6
+andi a0 s4 684
+andi t3 s9 1744
+divu t3 tp t2
+xor t4 ra s7
+sub ra s6 t0
+sub a0 a7 s8
+divu t5 a7 a6
+mul a3 ra x0
+srai t6 a1 12
+sltu s6 a0 a3
+xori s9 a2 -693
+rem s10 s9 s10
+sltu ra s3 a6
+ori t0 s5 952
+rem a3 a5 t2
+and tp s1 x0
+addi x0 t3 698
+divu gp t0 t0
+remu a1 s6 a2
+andi t3 s0 -704
+slti a2 a2 -1005
+lui s7 924283
+auipc a3 795670
+div s4 s2 a5
+add t1 t1 s9
+and s2 t5 s5
+and s1 s11 s0
+srli s8 s4 25
+div t1 s9 s8
+sll gp a0 a7
+sra s5 a4 s7
+sll t3 ra s0
+slti s6 s8 -495
+div s4 s7 s1
+slt a5 s4 tp
+sltu a7 s5 ra
+rem s2 ra s9
+sll s6 s0 s10
+sub t1 x0 s1
+xor a4 s11 s7
+sll s9 a3 s6
+sra a6 s6 ra
+mulh a7 s2 s8
+sra s4 a4 t5
+remu a4 ra s9
+slt s6 gp s4
+remu s5 x0 a5
+xori t0 t1 -1161
+sll t1 a3 s3
+srai t3 s9 14
+add a2 s0 t5
+sltu s1 tp a4
+mul gp t4 t5
+mulhu a5 s5 s0
+sra a7 s0 s4
+remu s9 x0 a0
+rem s8 a3 gp
+addi tp s8 3
+slti s5 x0 -118
+mul t2 s10 a0
+or t1 s3 a4
+mulh a5 a0 ra
+lui t0 640864
+sra s10 gp s5
+sub t0 x0 s0
+srli a5 tp 10
+slti s2 a0 931
+slti a7 s2 1709
+srli s7 s5 13
+or s5 t5 a3
+sltu t4 s9 s1
+rem s1 s6 s7
+andi s7 s5 -414
+rem t4 s5 a7
+sltiu a4 t4 -660
+andi a0 s0 710
+sra tp a2 t2
+or t2 s10 t5
+auipc t5 709855
+sltu a7 t3 s8
+remu a7 s11 a1
+add s8 s5 s7
+divu a3 s2 a1
+rem a7 a7 s10
+div a2 s5 s6
+sltu t4 a1 a3
+sltu s8 a0 a2
+lui ra 833118
+xor a2 s11 a6
+slti t2 t5 -1755
+mulhsu a2 a3 s7
+slti a6 s11 -141
+or a3 t6 t0
+andi s10 t4 -1434
+div s5 t5 s2
+remu t3 gp a6
+or t6 a7 s10
+sll s0 s5 s9
+and a6 a2 gp
+or s3 x0 t3
+andi s9 t2 -556
+slt tp s7 t3
+auipc gp 1019186
+mulhsu gp s0 s5
+remu t4 s0 s10
+mulhu t0 s9 a1
+and s11 a1 tp
+remu t1 s8 t5
+auipc s4 572869
+sra s3 s10 s3
+remu s9 t1 s2
+lui s3 541364
+sll t4 s11 a4
+remu s9 s0 t2
+srli s1 t2 3
+mul s10 a1 a7
+divu s11 s3 t1
+or s10 gp a2
+auipc ra 883378
+or a4 s4 t2
+remu a0 t4 t2
+mulh s3 s10 s2
+sltiu t4 t4 1212
+xori a6 s7 461
+auipc t6 618618
+lui tp 779697
+slti s2 s1 -1057
+auipc s6 854073
+sub tp ra s6
+divu a2 a2 s7
+mulh s4 x0 s7
+srai s0 s10 16
+mulhsu t3 a0 t4
+remu t3 s7 a1
+mulh t6 a1 a3
+xor t0 x0 s8
+or ra s0 s7
+mulhsu s10 s4 t4
+ori s5 s10 -32
+srl t5 a7 s6
+xori tp s0 -1222
+xori s4 a4 855
+remu s11 s10 t0
+ori a0 t5 -292
+sltu x0 s6 s4
+auipc s6 907280
+andi s0 a6 -1441
+xor a6 s9 t4
+auipc a2 157669
+slt a1 a7 s0
+sltu s11 tp s10
+slt s4 a4 t1
+and s8 s8 s4
+srli s1 a2 10
+srli a5 t0 0
+and a5 s10 s4
+sltu s1 a4 a1
+andi s10 s10 -584
+srli a1 a4 20
+sra t3 s6 s1
+mulh s10 t0 s7
+slti s9 s0 -659
+sll a3 s2 a0
+div a3 s3 s8
+andi a0 s3 -1585
+slt s6 t3 s8
+andi x0 a2 1074
+srl a6 t6 a5
+slti gp t3 -1414
+and s8 tp gp
+srai s6 a5 26
+div a2 t4 t2
+auipc s9 641546
+slti t4 s6 1563
+andi s3 s7 -409
+srl gp a3 a1
+mul s0 ra a1
+mul s2 t3 t0
+sra s1 s1 s10
+andi t3 s0 -1789
+slti s11 a5 -352
+slti a2 t0 955
+remu s8 ra a0
+lui s0 67811
+xori ra s7 380
+and tp a7 s8
+sltiu s2 s6 -1453
+add s6 s7 s8
+sltu t3 a0 tp
+or s3 tp t5
+addi s2 s6 1694
+srai s3 a4 26
+div s11 s3 x0
+slli s8 s5 25
+and s2 a6 a7
+sll t3 s2 tp
+slli tp a0 19
+sltiu s2 s2 -1478
+xori a1 s11 1126
+mulhu s5 t0 s7
+slli s3 a3 5
+rem t3 t5 a0
+sub s10 t3 s2
+mulhsu a6 gp s0
+xori t6 s8 1513
+slt a6 s9 a4
+xor s7 s0 s7
+andi s11 a5 -1343
+sll s4 t4 a0
+auipc s0 183816
+sub a7 ra t2
+xori t1 gp 56
+lui a0 522280
+or s7 s0 s9
+slt s11 s4 gp
+slli s3 s11 20
+mulh gp s10 t4
+rem s2 x0 s9
+sll s8 t6 s11
+srai a4 a2 29
+mulh s2 s2 s0
+auipc t5 201049
+auipc s5 943724
+sltiu t5 a3 1997
+xori a4 s5 -1199
+andi t3 tp -1422
+mulhsu ra s1 s2
+divu a1 t2 s2
+div ra s9 t2
+ori ra s10 -2000
+mulhsu t3 s3 t5
+mul s0 s4 tp
+mulhsu s2 gp s10
+remu a2 s2 a6
+add s6 s0 a4
+slti t1 a5 1620
+slli gp t4 31
+and s5 s3 t2
+sll x0 t3 s6
+mulh a7 t3 gp
+sub s7 s6 t4
+and s9 a2 s9
+div s2 s5 s2
+slli tp t1 17
+div t6 a3 t1
+srl s3 s9 s2
+sltiu t4 s11 -294
+or ra s5 t1
+slt s3 s9 s3
+xor a2 a2 s7
+slt a5 s7 gp
+sltiu s0 a2 -1094
+srl t4 s0 a7
+mulh s6 gp s8
+sra s2 a3 x0
+sra gp s10 s6
+ori t6 a4 -1706
+lui s6 1004098
+slti s0 a0 1061
+auipc s0 621140
+xor tp a1 s8
+mul s2 s3 s2
+ori t4 a4 -365
+xori t4 x0 -208
+srai a0 ra 1
+sltu a0 s2 t6
+sra x0 s6 s3
+sltiu t0 t3 1433
+slli s2 t0 22
+rem t2 s0 a2
+slt s7 t5 s9
+div s2 x0 s0
+divu t0 s1 t2
+slli a1 s3 20
+srl a3 s5 s6
+and t3 s4 t4
+divu s4 s4 a7
+auipc x0 861888
+srl t0 t2 a7
+slt a4 s6 s7
+div gp a1 a0
+or t0 s6 s11
+mulhsu a6 a5 ra
+mul ra s4 ra
+slli ra a5 8
+divu s0 t2 a6
+add t5 tp s4
+slti s1 a6 -1488
+addi tp s0 -399
+and a1 a3 s3
+sltiu s9 s2 -2023
+lui s3 712868
+sra ra s2 a1
+mul s11 s8 t4
+rem s1 a6 a5
+mul s4 t6 a1
+sltu s0 s8 a0
+srai s7 t3 27
+addi a0 s8 -1306
+add t5 s0 s1
+add s7 a7 s2
+andi t1 a3 -1091
+slt a0 t3 s2
+xor a7 t4 a4
+lui s11 696960
+srl s5 t2 s3
+rem a4 x0 s5
+mulhu a3 t6 tp
+and t3 s0 s0
+or t0 a2 s6
+and t1 a1 s0
+mulhsu s6 gp a2
+mulhu t5 a2 a4
+rem s7 x0 s10
+lui t5 927812
+sra s5 s9 a6
+mulhu s0 t4 s7
+sltu s4 t5 s1
+mulh a1 a6 a1
+slt t2 a3 a6
+slli tp t5 25
+slti t0 t6 -1469
+slt tp ra tp
+sll s11 x0 ra
+sltu a2 a2 t4
+srai t0 s11 20
+divu t6 a4 a6
+srl t6 s0 a4
+sub t1 t0 a4
+andi a7 t1 -1804
+sltiu s4 s8 -1071
+sll s1 a0 s1
+or ra s3 t4
+srl a0 s7 a0
+slli s0 t3 31
+xor t1 a7 s9
+sub s11 tp a2
+xor a4 ra t3
+auipc s5 732909
+sll s3 s5 t5
+and s8 s10 s11
+xor t4 s1 a5
+xori s5 x0 -1896
+srl t3 gp gp
+slt s11 a1 a7
+slt ra a5 a2
+srl s4 s7 s5
+srai t4 s4 21
+ori x0 a0 -1568
+auipc a1 646148
+slli s1 a7 30
+ori a6 s9 -19
+slli a7 s7 6
+ori a6 a6 429
+mul a0 t2 s4
+sltiu t2 t6 1004
+sub x0 s4 a2
+sltiu tp s7 -1366
+slti a0 t0 -791
+and s3 t1 tp
+rem a5 s0 ra
+add tp s4 s11
+auipc t5 347542
+mulhu a4 s9 s1
+mul s11 t6 a2
+sltu a6 s6 tp
+and s8 s7 t6
+sltu t5 ra t0
+andi a0 t2 309
+xori t6 a1 -1435
+srli s4 s11 8
+sll gp s8 s5
+div s2 a6 x0
+xori s4 t6 1312
+mulh s6 t2 t0
+xori s10 s1 -436
+slti gp ra -823
+rem s9 t1 s5
+sub a0 s11 a1
+sub a3 a4 a0
+sra a7 t2 s7
+slti a4 a6 1334
+sll gp t6 t5
+ori t4 t2 -1325
+slti s5 gp 1812
+remu s10 s6 t3
+addi t6 gp -557
+xor s9 a2 t0
+auipc s1 932484
+sra s4 s2 a6
+slt t6 gp a5
+addi a4 s8 -1316
+xori s9 s9 -496
+mulhsu s2 gp t6
+sll a2 a6 s0
+rem s5 s7 t2
+auipc s2 772333
+mulhsu a0 s9 t3
+mul s0 t4 a2
+lui s9 703207
+and a4 s7 s4
+mulhu a4 t1 t0
+addi s0 a2 428
+andi t1 s10 -126
+mul a2 a4 a5
+div t6 s3 s1
+xor t6 t3 ra
+sll gp t4 gp
+sll a1 a6 tp
+rem s2 ra t0
+or s9 s5 s7
+rem t4 tp s2
+srli s7 t4 0
+srli t3 s1 0
+srli s5 a0 1
+slli a0 s4 14
+or a6 a2 s4
+lui t3 706218
+andi s10 s5 -1772
+rem a6 s11 a6
+sra a5 ra a2
+xor a7 t4 s7
+mulh s3 s10 s9
+ori t3 t2 -1274
+sltu a4 s10 a0
+andi tp a7 -1975
+mulh a1 a0 s6
+sltu t2 a2 t5
+divu s10 a4 s8
+slt s9 a1 a6
+divu t0 t6 x0
+xori a0 gp -313
+xor t5 a6 ra
+andi s4 a6 -1548
+slli s6 s2 24
+sll s6 s0 t3
+ori a1 a2 -1701
+remu a3 s9 x0
+srl s5 t4 ra
+sra tp a1 t1
+slli a2 t4 20
+andi s11 a5 -29
+slt ra a6 a5
+andi s3 a0 -1352
+xor s3 a2 s5
+andi t5 a1 -1133
+slli a1 s4 16
+add s6 t6 t6
+lui gp 597711
+srli a1 s4 19
+ori a1 t1 -537
+add t6 s6 tp
+slti s5 t6 1482
+addi x0 s6 -242
+sll t0 s6 t3
+divu t1 a3 s6
+srli s8 a1 16
+rem t1 ra s4
+srli s10 s2 6
+auipc t6 391621
+xori a0 s8 137
+sra x0 t2 t5
+sltu t0 t0 s4
+ori t2 a4 -1118
+or a5 s1 a5
+divu t1 t0 a0
+xori s7 s8 -415
+slli a2 s1 24
+addi a3 t2 -1368
+remu a0 a1 s11
+lui a3 909509
+slti a4 a3 -464
+xori s1 s11 -952
+mulh s1 t1 s6
+andi t5 a3 -632
+ori t6 ra 1026
+andi t3 a0 -1199
+slti s6 s2 1497
+ori a3 a2 -1374
+lui s7 75345
+sltu t4 s10 s1
+div s8 a5 tp
+or t5 a1 s10
+sll a5 t6 gp
+divu a7 s4 s5
+add s10 s11 s11
+auipc t2 393827
+xor a0 a0 a6
+mulhu a4 s11 s9
+slt t3 t2 t3
+sltiu s7 s5 -782
+slti s11 t2 -91
+lui s11 935295
+slti s10 s9 -1763
+mulhsu s4 a5 a1
+div gp s6 s6
+sra s9 t2 s7
+mulh a7 ra s11
+slt s3 a6 a3
+sltu s9 a6 s0
+sll s9 s6 t4
+srli s5 s11 9
+sub a3 s1 tp
+slt t1 s3 t6
+lui s11 1046200
+rem gp a5 s0
+xor t3 t0 a1
+rem a7 s8 a7
+andi s3 t3 -170
+andi s7 a1 655
+slti s1 a4 8
+addi a5 s3 -1556
+sltiu s4 s3 1977
+slti s4 a0 807
+div t6 a5 a7
+or t3 s8 s10
+sltu t5 a7 a7
+or t0 a5 t6
+sltiu s4 gp -562
+xor t3 a5 s1
+and t1 t5 ra
+srl x0 t6 s10
+xor a1 s3 t6
+div ra a4 a7
+auipc s9 946821
+srl t0 t5 s0
+sltu a4 s0 x0
+mulhsu t6 a5 a3
+divu s7 s0 s9
+mulhsu t1 s11 ra
+and ra s10 t0
+srli t1 s9 0
+srl x0 a0 s0
+rem t2 t6 a6
+xori gp a1 91
+srl t1 a7 t2
+addi a5 x0 -1790
+rem a0 a5 t2
+auipc s3 48849
+add s8 s5 s7
+slli x0 s8 26
+addi ra t2 -2016
+xori x0 t0 -640
+rem x0 t5 gp
+ori a2 a6 -165
+auipc t2 239454
+slli ra s11 22
+lui s0 756041
+or t2 s11 a1
+andi s1 a5 -1730
+lui t4 208503
+sra gp a3 t1
+sub s3 t1 tp
+sra s1 t5 t1
+srl s4 s2 s7
+sltiu gp a5 -1630
+mulh gp a4 a6
+slt a5 a0 s9
+lui a0 327432
+or s10 s6 s7
+srl s3 t2 t6
+remu a6 a5 a3
+add s11 gp t1
+sub a6 s5 a5
+xor s0 s5 t2
+srl tp s11 s11
+addi a6 t5 -504
+sra a7 a6 a1
+slt a1 s6 a0
+div a4 a5 s7
+sltu a1 t6 ra
+andi t1 a7 -1981
+add s8 t6 gp
+auipc s6 116279
+sltiu s9 t2 -491
 add tp t5 t0
-and t6 tp ra
-andi x0 a5 -32
-addi a7 t0 -689
-andi t4 a7 -1456
-sra s3 a2 t2
-xor t0 gp a0
-mulhsu a0 t4 s0
-addi x0 a6 -1928
-mulh s7 t2 s11
-mul s6 x0 a7
-rem s6 s0 t0
-andi t6 t5 -1098
-sltiu ra a4 -1951
-sra a5 t1 a6
-ori t3 t5 790
-xori t0 s7 1173
-div s11 s1 s7
-xor tp t4 s1
-div s10 t0 s11
-srai s3 s11 21
-auipc x0 868212
-sltiu a4 s11 -780
-srai tp t3 30
-mulhsu t2 t3 t5
-srai s11 a3 0
-srl a3 t2 a3
-lui a4 562395
-ori s0 a6 446
-sltu ra s1 a5
-lui s6 799189
-add s10 s10 s10
-lui gp 547445
-sltu s0 s10 s3
-andi a7 s1 1631
-xor t0 gp a2
-slt a0 t3 x0
-sltiu s7 t5 95
-divu x0 s9 t5
-slti t2 s5 -155
-auipc a5 587356
-sltiu t6 t2 -1558
-xori a2 a7 -1797
-lui tp 987484
-and t6 s8 a4
-slt ra a6 s3
-rem t3 x0 a4
-xor s2 x0 x0
-sltu t5 a4 t4
-mul t4 t0 s6
-srli t4 s11 2
-xor s11 a6 a0
-mulhu s2 t4 tp
-remu t3 s4 s8
-xori s1 t4 -1552
-ori t3 s11 -694
-mulh s0 a5 s0
-srai a3 a4 17
-remu s7 ra x0
-sll s7 x0 tp
-div gp t2 s8
-mul s11 t3 a2
-remu s6 t0 a7
-slli t1 s0 8
-rem s0 t2 t0
-ori s10 s7 -108
-slli s9 s3 8
-addi a5 s5 -256
-andi a6 s2 -1017
-srai a1 s1 16
-srl t5 x0 a4
-lui a3 241716
-xori gp s10 -1886
-and s11 s0 t1
-div t4 s5 t3
-mulhu s0 x0 a7
-slt t4 gp gp
-slti s0 s9 1708
-slt s0 t0 s5
-mulh a1 s5 s10
-and t5 t6 a2
-slli s7 a4 23
-mulhsu s6 s2 a7
-add a1 a6 ra
-mulhsu s3 s1 s7
-slli s0 a0 24
-or t1 a5 s8
-rem a7 s8 s3
-srai x0 t3 0
-lui a5 654450
-or x0 t0 s10
-add ra a5 a7
-remu t3 tp t3
-rem a4 s5 s11
-sll s7 gp s1
-remu s1 s6 s11
-auipc s0 222455
-div t4 s4 a5
-sltu s4 a1 gp
-sll a0 s1 t4
-addi a0 t5 -1675
-rem gp s4 a6
-slti a4 ra 2032
-sltiu s2 s10 -1705
-sra a7 a3 a4
-slli a3 ra 18
-mulhu a4 s10 s4
-or t2 s10 s1
-addi s5 s11 -1991
-slti t4 s5 1847
-divu a1 a4 s4
-xori s9 t4 -376
-srli t2 t5 30
-or s6 s8 s9
-andi a3 t4 -359
-mulhu s3 s10 a5
-mulh a7 t6 a6
-slli t0 ra 17
-add a4 ra a7
-ori t2 a5 1129
-and t4 a4 s9
-div gp s7 s4
-and s11 s9 a3
-divu s10 x0 a2
-sltu a3 t1 s4
-remu ra tp s5
-rem s4 s9 s8
-ori t1 s10 -1436
-mulh s5 ra t4
-xori t5 a1 55
-mulhu gp t3 a7
-addi a4 t0 895
-slti a1 t5 1820
-addi x0 tp -1566
-lui s1 637298
-sub s3 ra a2
-sltu s9 ra s0
-add s9 a5 t3
-mulhu t5 t4 t1
-srai s10 s1 29
-mul t4 t4 gp
-remu s1 a4 s8
-and s1 a0 t2
-xori s6 a3 -595
-sltiu s7 a0 919
-lui s4 562953
-mulhsu s6 s8 s8
-div a1 t6 s4
-mulh a6 t4 s3
-sll x0 s3 s0
-sub gp a0 t6
-divu a6 ra a1
-lui a2 804793
-remu s10 a3 a0
-mulhsu s9 s6 t0
-slli s3 ra 9
-add t2 s0 tp
-mulhsu t0 a2 a0
-remu s10 s8 s4
-mulhu ra s2 a5
-ori s2 t1 -576
-mulhu s3 a4 x0
-auipc s11 1020158
-xor t2 t6 s6
-mulh x0 ra t5
-srl a1 a1 a7
-srli t2 a7 12
-mulhu s8 s5 s5
-sltiu a1 x0 -1463
-srl x0 t3 a7
-and s7 t5 a0
-auipc t1 617428
-lui a5 420571
-addi s5 s8 -1482
-ori s0 t2 -883
-auipc s9 294132
-divu s0 s8 ra
-div s3 t5 s10
-sra tp a2 tp
-slli s3 a1 29
-and s5 t1 s0
-xori s11 s7 -1799
-addi a3 s9 -806
-auipc s6 884179
-srl x0 a2 t3
-srai gp t0 6
-andi t2 s11 -6
-srai t0 s0 25
-sub t4 s8 ra
-mulhu s6 t6 a7
-slt a4 s7 t3
-mulhsu t4 s10 s3
-sra s4 t4 t1
-sll t5 s9 a6
-xori a7 s7 742
-divu s0 a5 s3
-remu s6 s10 s9
-sll s3 ra a0
-divu s4 a6 s8
-xor x0 x0 t5
-srai s5 s2 11
-slti a6 x0 -1660
-mulhu gp gp a3
-lui t0 913776
-remu s5 t1 s4
-mulhsu t2 s4 s5
-xori s11 s10 -1960
-slt s4 tp t2
-mulhu s1 a6 a7
-mulhu a1 a4 t5
-div s8 s11 a5
-sltiu a7 a3 993
-xori t0 tp -1871
-sll t3 a2 s3
-auipc s6 199642
-rem t2 a1 a0
-sll t4 t0 s2
-mul s9 a4 a1
-lui tp 91013
-srl t0 a2 a2
-srli x0 x0 27
-sra x0 s8 s3
-sub t6 s3 a7
-divu x0 tp s8
-srl s0 a6 t4
-mul t3 s8 s9
-sltiu a2 s0 -1706
-sltu x0 s7 t2
-mulhu s7 a6 a3
-xor s9 ra s8
-sra tp s8 s2
-auipc gp 805383
-mulh s6 s10 a4
-sra a1 t6 a2
-xori a3 s6 -1584
-mul s4 s0 a7
-slli a1 a3 24
-mulh a2 x0 s0
-xori s7 a6 -154
-auipc s11 869976
-andi s9 a2 126
-sltu s8 t1 s7
-add s3 x0 x0
-mulhsu t2 s8 s8
-divu x0 a5 x0
-sltiu t3 s6 1616
-mul a2 a3 s11
-sll s1 s0 s6
-xori t2 a6 -657
-lui t0 1008003
-remu s2 a3 ra
-srl t5 t0 s5
-mulhu a2 t1 t3
-and s5 x0 s11
-xor t4 s1 a3
-andi s10 a0 -976
-srli a7 a4 27
-add t1 s7 a5
-xori t2 t0 632
-or a4 x0 s11
-rem t6 x0 tp
-or s8 s7 a2
-slt a7 x0 s3
-remu s8 t2 s5
-sltu s5 s7 s10
-slt s11 s4 t6
-ori s10 x0 1756
-rem s6 x0 gp
-mul t5 a7 s1
-sll s8 a6 s0
-sltu a5 s1 t4
-sll t4 tp gp
-xori t3 s0 -1777
-ori t2 s8 -1259
-sll a2 s3 t2
-mul t5 gp s1
-and s11 s3 t4
-xor s11 t5 t4
-add a7 s2 t2
-divu s11 ra a6
-mulhsu s2 a6 s4
-sll s3 t2 s9
-xor gp ra a7
-sll a5 x0 s4
-ori a5 t0 133
-sltiu t2 s11 -921
-xori tp s5 -1542
-remu a5 a7 t3
-sub t4 a5 a6
-srl a5 a3 s0
-sra a4 t5 t2
-sltu s0 t0 s3
-sltiu s5 s4 1408
-slli t4 s3 23
-srli a6 t5 12
-slti t6 t4 -1496
-sltu t3 t6 gp
-remu a6 a7 t4
-mulhsu s10 a0 ra
-remu s11 a6 tp
-auipc t3 434496
-sra tp a7 a3
-ori s0 t1 -1054
-add a6 s6 s4
-lui t5 440098
-slt a1 t3 a4
-srl t1 s11 tp
-slli s7 t0 2
-sltiu s4 t0 -1166
-slt s3 s2 s0
-divu s8 s6 s9
-slli s4 t5 17
-or s7 t3 s9
-remu t6 t5 s4
-div a5 s8 t6
-lui s0 800006
-mul x0 s1 s11
-rem s10 a2 x0
-sltiu s9 s9 -1690
-add t6 s7 t3
-addi s3 x0 1397
-slli t1 t0 18
-sub s10 a3 x0
-srl t2 ra t4
-andi t5 s1 1801
-rem s3 a2 t1
-sltu a5 s9 a1
-mulhsu s11 s2 t4
-rem t5 a0 s11
-and a3 s2 s6
-xor s7 s10 ra
-or t2 a6 s2
-slli a7 t0 6
-lui s9 775318
-srli s2 ra 25
-sub s3 t0 a4
-mulhu s4 t1 a7
-addi t0 s6 -19
-sltiu t4 t0 -1321
-or t1 s0 a1
-div x0 x0 t0
-slli a1 s0 26
-lui s10 275441
-sltiu t6 t4 -222
-mul s8 s3 s2
-slli s11 t2 16
-slti x0 s9 1893
-sub x0 a0 a7
-lui t1 150315
-srl t2 t0 t2
-sltiu t0 s4 -752
-mul t4 t2 s0
-remu t1 t2 a4
-xor t2 t5 gp
-lui s11 1043780
-sltiu a6 t4 -80
-add a7 a5 s8
-slti a3 a7 -1493
-slli s0 s8 7
-slt a5 a0 t1
-xori s7 ra 1729
-slti s5 gp -1894
-xor s2 tp s2
-xor a7 a5 ra
-xor a3 a7 s0
-slt t3 t6 a7
-srl s9 s0 s6
-srl gp x0 s4
-ori gp s6 1868
-and ra a6 s7
-remu s10 a1 s4
-sltiu t2 t0 -202
-slt t4 s10 a3
-slli a6 s7 18
-lui t3 955889
-xor gp s7 t3
-slli a7 s9 7
-sra s1 s1 tp
-auipc s2 193018
-xori x0 ra 237
-srli s10 a5 3
-and t1 a2 t1
-rem s8 t4 s10
-divu t4 x0 t3
-ori s6 gp -1720
-ori s5 a5 1182
-or a7 tp t3
-sub ra a5 s8
-ori x0 ra 589
-sra x0 x0 s10
-srai s6 a6 6
-slti s11 a6 1730
-auipc t3 837882
-srli s1 t2 29
-andi a4 t0 -414
-add a5 s1 s7
-auipc ra 658076
-lui s1 315874
-mulhsu a6 s11 a0
-slti s1 s6 291
-mul s9 a0 s4
-slt a5 a2 s8
-auipc s1 69113
-sltu ra s4 a7
-sltu s9 a1 t4
-div t2 ra s7
-auipc s4 575294
-srli t3 t1 0
-remu s9 t6 t0
-xori s1 s7 -317
-div s7 a0 t2
-sltu s2 s1 a1
-slti s9 t3 -711
-mulhsu a7 s1 ra
-slt a1 s4 a4
-srli t2 ra 16
-slt a5 a5 x0
-xori s10 a4 402
-sltiu x0 s2 -462
-mulh a4 s2 a7
-sub s9 a0 a5
-divu s9 x0 x0
-andi a3 x0 554
-slt s2 a5 a2
-rem a0 x0 a7
-slt t0 t2 t0
-remu s0 gp t2
-mulh t5 t4 s0
-sll a4 s6 tp
-remu s4 x0 s2
-ori gp s0 1315
-slli t3 a5 20
-slt s7 t6 gp
-div a4 s11 t3
-xor s4 s0 tp
-ori a2 s11 -1790
-divu t6 a7 a2
-sltiu x0 tp 2026
-auipc gp 1003837
-mulhu s5 x0 t5
-and a0 s6 a2
-rem t2 gp a1
-srl a4 t1 a5
-mulhu gp ra t0
-sll ra t1 t0
-srai s8 a7 1
-addi t1 a0 -112
-rem s3 s6 s5
-addi s6 s11 -1513
-divu t6 t3 s10
-srli a2 a4 30
-lui s1 524769
-div x0 a7 s6
-mulh s11 a5 x0
-rem x0 s8 a7
-mulh gp s3 a0
-and a0 t2 s0
-ori a5 x0 -992
-sltu a4 s8 s10
-slti a4 s9 -861
-div s10 x0 s11
-sll a1 a5 tp
-sub s0 t0 a2
-andi t0 gp -806
-andi a1 s0 -671
-mulhu t0 t6 t4
-auipc a1 201194
-lui a5 1047315
-sltu gp ra s0
-srl s0 s6 a0
-add a6 t5 t5
-ori s11 a1 184
-xor s3 s4 t1
-sltu s3 a0 s6
-sltu a3 a3 a1
-div a4 t5 a4
-auipc ra 220672
-srai a0 a2 12
-div s1 s8 ra
-auipc s6 59930
-srai a4 gp 27
-mulh x0 s0 t4
-mul x0 s10 s5
-xor x0 a2 a3
-mulhu a6 s4 s4
-slti s5 t2 -649
-ori a1 a6 -1098
-slt ra tp a6
-slt x0 gp a3
-addi a0 t3 -1205
-and a3 t4 s11
-slli t1 s8 18
-srai s4 gp 13
-mulhu t4 a2 t3
-addi tp s4 -459
-lui a3 503484
-sub ra a1 tp
-andi a3 s2 -216
-remu a5 ra a4
-div x0 s8 a6
-ori s11 a3 -45
-div a0 s4 t3
-mul s7 ra t4
-sll t1 t6 t0
-mulh s11 t1 s9
-or a2 t3 t3
-andi s8 a0 -1129
-sll s10 tp t4
-addi s8 s0 1352
-slli t1 s1 8
-slli t5 s10 27
-slli a4 t6 2
-sltiu a7 a1 -1788
-ori t5 ra 673
-add t6 t0 a4
-srai a7 t1 29
-add a3 s11 a7
-add a5 s4 a5
-slli t3 s4 19
-slt a5 a4 a7
-slli s6 s8 14
-slli a1 s11 12
-or t0 gp s4
-or s5 s3 s2
-xori s10 s2 2045
-sll x0 a3 a7
-sll s9 s10 t0
-add gp a7 x0
-andi s3 x0 1907
-mulhu x0 x0 ra
-xori t6 t2 -964
-srl a6 a5 a1
-sra a7 ra s0
-addi t5 t5 -1967
-and s1 x0 s0
-andi t3 t1 -1085
-mul t2 a3 t4
-lui s5 426398
-slti gp t1 -1730
-mulh t5 a3 s3
-addi s5 x0 119
-auipc s6 760651
-and x0 t0 a7
-andi a3 t0 1385
-rem a1 t6 s10
-srai t1 gp 1
-div t6 s10 s7
-rem s10 t4 s1
-xori s11 a7 1264
-srl s2 s3 tp
-add t2 s10 a0
-srl x0 a5 a7
-mul t5 a0 a1
-sltiu t1 t3 -473
-mulhsu s3 t3 t5
-sltiu t2 s0 517
-or x0 s3 s0
-sll s4 gp t2
-rem a4 s4 a0
-lui a6 215369
-slt t3 s10 a0
-xor x0 a6 gp
-addi t2 s1 382
-sltiu s3 s9 -526
-sltiu s1 a1 -1680
-xor a5 a3 a0
-remu a3 t2 s3
-sll s4 a4 s0
-mulhu a3 a1 gp
-sub gp a0 gp
-lui t4 366186
-divu a4 tp t0
-mulh tp s6 ra
-slli x0 t4 8
-srl a5 tp s9
-or t6 s0 t3
-slli s11 a0 11
-sltiu t6 a1 1702
-xori s6 a4 -1950
-mulhsu gp gp a2
-or a4 s4 s0
-or t5 a2 s9
-mulhu t4 tp t6
-and a0 a0 a7
-mulh x0 a6 a3
-srl a0 a1 a0
-srl t5 a4 a6
-slli t3 gp 30
-srai t1 a4 1
-div s7 a2 s7
-slti t1 s11 -1756
-mul t5 a2 t4
-slli a5 s5 4
-srli gp a2 28
-mulh s0 x0 s7
-srli ra t0 0
-mulhsu s4 x0 a7
-add a4 t1 x0
-sll s1 x0 s5
-ori t5 s0 -514
-sltu s11 t0 s10
-srai s2 t4 30
-rem ra s11 ra
-srl s5 a6 s4
-srai t2 s7 9
-or s7 gp t2
-sltiu t6 a3 -1973
-sub ra gp t6
-xori t2 t1 -1373
-sltiu a7 x0 -363
-rem s3 t0 ra
-addi s1 t3 -570
-ori s8 s2 1739
-andi s5 s6 -642
-sra t0 t6 t0
-or a2 a7 s4
-remu s1 s6 s4
-sltiu s11 s5 -1593
-sll x0 t0 s8
-srli s3 s1 7
-addi x0 a3 -48
-auipc t4 923651
-xori t5 a1 -578
-mulh s2 a0 a0
-slti s8 s1 1329
-sub tp a7 s2
-div s3 a1 a0
-sltu x0 a0 t2
-or s10 a1 s1
-sll t6 s8 s1
-sltiu t0 s7 -1520
-lui a2 974470
-xori a7 t6 -1887
-lui t1 949708
-xor a1 tp a6
-addi a3 x0 1072
-sll a4 s0 t1
-auipc s6 611209
-sub s9 t6 ra
-mulhsu s10 a1 a3
-ori s6 s1 -786
-mul s0 s1 s2
-auipc a4 795541
-mul s3 t3 t5
-xori s6 t4 -1553
-or a4 s10 s5
-mulhu ra t2 x0
-and s0 s6 s6
-div s0 s1 a1
-divu gp a7 t6
-ori t6 t0 -400
-ori x0 x0 -1277
-remu a5 t2 t1
-and x0 t4 ra
-sra s2 t2 a5
-rem x0 s4 t4
-div t6 t5 t3
-div s1 a7 s6
-xori x0 a7 -1328
-srai a7 gp 0
-srl t6 t4 tp
-xor a0 s7 s4
-sltiu s6 t1 695
-xor s8 s2 t1
-lui s2 598340
-srli t4 a7 30
-xor t6 s5 ra
-lui tp 480740
-rem a7 t4 a4
-mulhu t6 s8 a3
-sltu s8 s7 a3
-div s3 s1 a1
-slli t1 gp 13
-sll t3 gp ra
-slti s8 s4 -286
-mulhu tp t4 s7
-lui t6 105288
-div t3 t4 t1
-mulhsu s1 a5 s10
-remu a6 t2 s2
-sltiu a6 x0 -1001
-sltu s4 x0 t4
-sra t2 s1 s1
-sll a4 t1 t4
-xori ra a3 856
-sra a3 s0 s3
-xori a0 s0 -1336
-or a1 a7 a6
-div s6 x0 a5
-sll s3 t1 s9
-lui s11 388731
-remu ra s4 s11
-div t0 s5 a7
-xori s10 a2 -1279
-srli s5 t5 22
-mulh s11 s2 a3
-srl gp a6 a3
-or ra t2 x0
-and s10 s0 t3
-div s4 s8 a6
-add s10 s5 a3
-remu t6 s6 s11
-and s3 s7 a1
-ori s3 a6 -1165
-slti ra a4 -1450
-addi s7 gp 1840
-xor ra s5 t4
-slti x0 s11 -290
-and s2 ra t4
-sltu s0 a5 s11
-xori a3 a7 -26
-remu a7 t1 t4
-mulh s7 ra tp
-sltu a5 a5 s11
-slt a0 t3 a7
-div s6 s1 a1
-auipc a4 476957
-or a7 s7 s9
-div tp a1 s0
-sltu s4 t0 t3
-mulh a3 s10 s7
-srai s8 t5 18
-xor t5 s0 a7
-and tp s4 s9
-sub t0 a0 a2
-divu t5 t1 a7
-sltiu a4 t6 -1742
-rem gp s7 x0
-mulhu s8 a7 s7
-srl s6 s1 t2
-xor a3 s2 x0
-and t5 t4 t2
-ori x0 a3 -1224
-srl a0 a2 x0
-mulh a6 t2 t1
-sltu a1 s10 a2
-rem s0 t0 a1
-addi s5 s3 -816
-xori gp t6 -1914
-add t6 s5 a4
-xor s4 t3 s11
-srl t3 a4 s5
-slt x0 tp s1
-rem t6 x0 t1
-sra x0 s1 a4
-slti s11 s10 658
-rem a1 a4 a4
-mulhu s7 s8 t6
-srli x0 s6 28
-srl a0 a1 t2
-ori s11 s10 -146
-or ra s10 a3
-ori s8 a0 583
-add a3 s6 t0
-sll x0 a5 a2
-mul a3 a2 a7
-xori s4 s7 -814
-andi t0 s6 -1867
-srai s5 s10 2
-and ra s4 ra
-ori a5 t3 -51
-slli t6 s8 22
-slti t4 s1 -238
-mulhsu a3 t5 a2
-sltu s6 s10 a5
-slti s4 s0 1878
-ori t0 a3 -1121
-divu s0 s3 s8
-srli ra tp 25
-sll s7 a5 s10
-slti x0 a0 -391
-andi tp t6 -975
-mulh s2 a5 a6
-sub s2 s7 t2
-srl ra s5 t4
-sub t4 x0 s10
-sub t0 s9 a7
-addi s7 t0 -980
-addi s3 gp 785
-addi a3 a3 1538
-mulhu t5 gp ra
-remu s10 t6 a6
-divu a5 t1 s3
-addi a5 a0 -1045
-xor t2 tp a7
-mulhsu s9 a3 t5
-andi a7 t6 637
-mulh t4 s10 x0
-sra a1 tp s7
-sra t6 t4 ra
-mulh t6 a0 s10
-sltiu a3 s2 1018
-srai a2 a4 5
-sub ra s7 gp
-mulh s6 s4 a2
-remu a3 t6 s7
-div t3 t4 gp
-div s1 t1 s1
-xori a0 gp -565
-srli s10 s2 1
-mulhsu gp s9 s6
-xori x0 s2 -1107
-auipc s5 1020408
-slli tp t6 24
-srli a2 a2 26
-and s6 ra t1
-lui a6 533937
-srl t4 tp s5
-mul t4 x0 s6
-rem s8 t3 a0
-remu a3 ra tp
-sltu a5 t2 gp
-and t0 s5 s4
-slli t3 s10 19
-srli s8 gp 16
-mul gp ra t0
-div ra tp s6
-mulhsu s10 a7 s0
-sra ra s7 x0
-sll gp s0 ra
-remu s0 a3 a4
-mulhu s4 s2 x0
-srl s8 s4 s3
-ori x0 a4 -328
-slti t4 t1 -1498
-remu t0 s8 s5
-sub s4 t2 a6
-sra s3 a0 t2
-rem a4 a2 t6
-mulhu s11 ra t2
-mulhu s2 a4 ra
-xori t6 t6 401
-sltu x0 t1 t4
-auipc a4 748525
-srai s8 s9 31
-slli s4 gp 16
-srai s6 s9 27
-mul a2 s5 a0
-auipc s10 327611
-sra a5 ra x0
-slti ra s4 112
-xori t5 x0 269
-or t1 s11 ra
-and x0 t3 ra
-divu a4 s7 t6
-srli t4 x0 19
-slt s5 a0 tp
-xori t1 t4 1681
-addi a1 s2 -269
-div s6 a4 a1
-auipc s4 749133
-sltu s11 t2 s10
-and s9 s7 s8
-andi a7 t4 1990
-divu s2 s11 s5
-xori t2 s9 -1490
-divu a5 s11 x0
-add t6 a2 s5
-slt t0 s0 a6
-sra t5 x0 s10
-and s5 t5 a0
-slti t4 s3 -1349
-addi x0 t4 -1142
-andi t0 s8 1330
-rem a5 s9 s5
-divu s10 t0 gp
-mulhu s4 gp s10
-mulhu t3 s1 a5
-srl s5 a0 a3
-sll t3 s1 a2
-mulh a4 a3 t6
-srai s0 gp 2
-sub a5 s10 s10
-srl a7 t0 a0
-xor a1 a5 s8
-addi x0 a3 1566
-xori tp x0 -1404
-and t0 s3 s7
-srli s2 gp 5
-xor a4 a1 a5
-ori tp t0 -596
-rem x0 x0 a2
-auipc a3 913374
-srl s9 t2 t0
-andi s11 s0 -657
-add s4 s2 s5
-remu t3 s3 s4
-sra s3 a3 s7
-ori a0 s3 -1749
-sub x0 tp s5
-slt ra t6 s11
-slti s1 gp 1578
-andi s6 a7 -1206
-mulhu t6 a5 gp
-sltiu t4 a1 -864
-xori t5 x0 -1650
-rem t6 s10 s10
-sll gp t3 t0
-sltu a6 t1 s1
-mul s1 s6 a5
-sltiu a2 t4 -61
-sub t3 tp t4
-srl t2 a0 a6
-div s6 a7 s5
-auipc a7 868350
-divu x0 a0 a6
-remu t6 a2 s9
-mulhsu s6 s7 a2
-srl s5 s5 a6
-xor t2 tp s1
-div gp s3 s5
-srl s6 a5 t2
-addi s1 tp -19
-add t6 t0 t0
-andi t0 s8 795
-sltu a4 x0 a3
-rem t2 s7 a0
-div a1 s7 s6
-mulhsu t2 s3 t0
-xor a1 a4 x0
-slti t4 x0 446
-and a0 s3 gp
-slli t6 t2 29
-mulh t0 t6 s8
-slti s11 ra -1030
-slt a5 a6 ra
-slti s5 a1 -1384
-mul t3 a5 s1
-mulhsu s1 t3 t2
-and t4 t1 s5
-slt s3 tp s9
-srai s8 x0 11
-slli s6 s6 2
-addi t6 a7 -628
-sltu a0 t6 a1
-andi a0 s10 -1799
-slti s0 x0 -1671
-andi t6 x0 -901
-or t2 a4 t1
-slt gp s3 a3
-xori s0 x0 -519
-mul t5 a0 a3
-xor s7 t0 s6
-rem s4 s11 s2
-slt s5 s7 x0
-slti s2 x0 790
-sltiu s6 s5 -1777
-divu s1 s11 a1
-add t6 t3 tp
-mul t5 x0 s5
-auipc gp 284247
-xor s0 a6 a0
-sll s1 s7 t3
-lui s11 804850
-add a7 s4 t0
-and x0 s8 a1
-srl t5 t1 t0
-mul s10 t5 s4
-add tp x0 x0
-div a1 a3 a7
-slli tp ra 12
-auipc t6 124500
-or s2 t6 t2
-sub s0 s2 s9
-remu a1 t2 x0
-xor t0 x0 t1
-mul s2 s4 a2
-slti s5 a3 835
-mul gp s1 x0
-slti gp t1 1093
-sltiu s1 s7 -683
-mul s6 t0 a0
-auipc a1 65011
-divu t2 t1 s9
-slli s8 a2 5
-srl s1 s2 gp
-div s7 a5 s2
-lui s0 409557
-slti s5 s5 -755
-ori a2 s2 485
-or a3 ra s6
-srai s9 s11 1
-mul a1 s2 gp
-sll a3 x0 t4
-div x0 a0 a7
-rem x0 tp t1
-ori t3 t2 -1926
-sltu s10 s5 t4
-remu s5 t3 s0
-slt s11 s8 x0
-xor s9 a3 a4
-srli a5 gp 11
-mulh s9 a7 s8
-mulh gp s9 s9
-auipc t5 299615
-srai t4 a7 4
-andi a4 tp -1669
-slt tp s8 t1
-sub a6 s3 t6
-xori x0 s5 -1252
-slt a7 ra a0
-ori a7 s10 -83
-srli x0 s2 18
-sll a7 s4 a4
-mulh gp x0 s9
-slt gp t6 t6
-sltiu t0 s9 -1856
-xor a0 a3 t0
-sub tp s6 t4
-mul s8 gp s10
-div ra s4 x0
-mulh ra s7 a6
-sub a7 a6 t1
-mulh a7 s11 a5
-and s5 a5 s11
-ori s8 s9 1348
-div t2 t0 s3
-or s8 x0 a7
-srli a3 t3 13
-sra t4 a3 a7
-slt s3 a1 a2
-mulh a7 a2 a4
-mulh a0 x0 a2
-lui a6 287844
-sub t6 t1 s0
-sltiu t1 t4 1601
-srl a4 a2 a7
-or s7 t2 a5
-mul a3 s3 a2
-ori a1 s2 -1540
-and s1 ra s1
-slti tp s8 -57
-mul a1 s8 a7
-slt tp t2 t6
-addi a3 s5 -1121
-mulhu gp a1 t5
-srli a1 a6 5
-addi t4 s7 1639
-divu a5 a7 a1
-ori a1 s5 2028
-ori s5 s2 -1902
-auipc s10 435670
-or x0 s8 s1
-slti a3 s5 -1468
-slti s9 s10 -392
-srai t2 t2 18
-rem x0 s1 s2
-mulhu s7 s5 a2
-sltu tp ra s1
-and t6 s4 t0
-andi t1 a1 -1497
-mul s6 t2 s5
-ori s7 x0 -1112
-add ra ra s4
-lui s3 528291
-mulhsu x0 s2 t6
-mulhsu x0 s7 ra
-sltiu a6 a3 1222
-xori s4 a1 -1891
-mulhu s10 a1 s3
-sra a5 t1 a5
-sltiu s2 s9 -837
-remu t1 a5 t1
-ori t0 a1 -1431
-div t6 s8 s9
-add t3 a3 s4
-sra t1 a4 a3
-srli t1 s0 19
-mulhu s11 s3 t1
-addi s9 x0 602
-srl a4 t3 t3
-srai s8 x0 10
-srl a1 s8 t4
-add s7 t0 s9
-or x0 s2 a0
-auipc t1 651860
-slti s5 s9 -2003
-remu a3 a7 x0
-srli s5 a4 12
-sra t2 x0 t5
-addi s0 t1 -288
-lui s3 903273
-srl s9 t3 s6
-slt s10 a1 t5
-mulh t6 a4 s6
-and t1 s8 s3
-add gp s0 s6
-mulhsu t2 ra s3
-and t3 s3 a3
-lui s1 1023719
-sll a6 a6 ra
-andi t5 t3 437
-mulhsu s11 t0 s6
-lui s11 830038
-slt x0 t4 a1
-add t1 a0 s2
-auipc s5 873225
-auipc s5 274534
-mul t4 t6 tp
-add s1 a4 s0
-addi s2 a7 -1906
-sltu s8 a2 s11
-slti a4 x0 -1523
-sltiu a1 s6 -438
-mulh x0 t0 x0
-sra a6 s8 x0
-and a0 a7 a5
-div s6 s1 s4
-xor a5 a5 x0
-lui x0 742468
-divu tp t6 s2
-xori s10 ra -290
-sll s2 s11 a6
-sra x0 a7 gp
-sub ra a1 t0
-srli s11 gp 17
-sub x0 t2 x0
-andi s1 t1 -1500
-auipc s4 840800
-and s1 t5 a4
-sltiu a0 a7 -92
-mulh ra x0 s3
-sll s6 s3 a1
-srli a5 t2 23
-xori a5 s10 -109
-sll s10 s3 a3
-srai a1 s4 18
-sub s5 a3 s6
-andi t5 t2 -1512
-sub gp tp a4
-remu s7 a5 t1
-srl a6 a2 t2
-andi t4 a2 1947
-and t0 ra t5
-sltu t6 a0 s1
-srai a0 x0 7
-sltu t1 s7 t4
-sltiu s5 t0 -1113
-or tp s2 tp
-mulhu t3 s3 s0
-srli t5 x0 8
-sltiu t4 s9 355
-or s10 s9 t4
-sltu a3 s0 a6
-mul t4 s7 a0
-mul s1 s10 s6
-andi s8 t6 -1445
-or a6 t5 t3
-sltiu s6 s4 -1131
-srli s3 a5 26
-sll t0 t2 s11
-srai s1 a1 29
-addi t4 t1 513
-and s2 gp x0
-slti s5 x0 -908
-mulh a2 s8 s6
-sub s2 s8 s1
-andi s7 s4 -449
-xori t4 a4 -441
-lui t6 1048065
-sltu tp s2 s7
-auipc a5 364133
-and s10 a0 a6
-sltu t3 t2 s8
-divu t6 t1 s8
-lui ra 240005
-sltiu a6 s2 -423
-and a2 s1 s9
-slti t1 a0 -1725
-sll a1 x0 s1
-slti s1 s4 -333
-xori a7 s9 -1982
-addi s9 t2 -682
-mulhu a6 a3 s8
-ori tp a1 989
-xori a0 t3 1220
-sltiu t0 ra -91
-sltiu s9 s11 -134
-lui t4 74040
-add s6 tp t6
-srai ra t0 26
-mulhu t3 s10 x0
-srai t1 s8 14
-div s4 s1 t5
-srli s3 s11 11
-mul tp a4 t0
-remu s3 s6 s3
-ori a5 gp -91
-mulh s5 gp s6
-add t4 s2 s6
-or s3 t4 s8
-sub t3 t5 a5
-sll s10 s5 a4
-and t5 s0 s2
-sll a7 s4 t6
-srai x0 a5 29
-slt s2 a0 s10
-lui s8 107968
-andi x0 x0 1888
-divu s7 s10 a7
-sll x0 t3 s5
-sub a6 a2 s10
-xor a5 t4 x0
-and s10 s10 t5
-slti s8 s7 928
-mulh a6 a5 s8
-sra tp a1 a0
-mulh s11 s1 s9
-sub a0 s1 ra
-slti s0 s0 1327
-sra s5 t0 t6
-mulh t4 t0 s10
-rem t1 t4 a4
-sra s9 s0 x0
-slt s9 t2 s5
-or t5 ra s1
-mul gp s4 a5
-xori t1 t1 780
-andi t1 s2 742
-ori t6 s3 716
-sra t4 a5 t4
-slti s5 t0 -1465
-div s2 s5 a4
-auipc s9 293273
-mulhu a2 gp a4
-rem a3 s7 s2
-slli s3 gp 21
-andi s0 t3 -131
-srli t0 s8 19
-div ra s3 s9
-mulh s1 s2 x0
-andi tp a1 -1382
-xor s2 s1 s5
-add s2 s2 a3
-mulh a2 a6 t4
-div a7 a2 a1
-rem s7 s7 t3
-mulhu a4 t3 t0
-and ra a5 x0
-remu t4 x0 a0
-slli s5 x0 3
-add t4 t3 t0
-sll a3 a2 t6
-mulhsu s8 s7 a5
-srl t1 t1 s5
-or t6 tp t6
-divu t1 t3 s3
-auipc s8 310981
-and s7 t2 t5
-sltu a4 a6 s11
-sra t0 gp s4
-auipc s2 655462
-sltu ra t5 t5
-div x0 s11 s7
-xor a0 s5 a5
-and s4 a7 a3
-sltu s1 s8 a0
-div a6 s0 a2
-sll ra tp x0
-mul s10 a6 a5
-slt t5 s9 s4
-sra x0 a3 x0
-sra s4 s1 s2
-sra gp x0 s7
-mulhu a3 s3 gp
-srli x0 s0 8
-add a7 a0 a4
-andi t4 t3 1123
-remu t1 s0 x0
-slli a0 s8 10
-srli s2 a4 15
-andi a1 a6 1755
-sll t4 s8 s8
-xor a3 s5 a1
-xor x0 t0 s1
-sltiu t1 s2 -725
-mulh a7 ra t0
-and a3 tp s0
-or a1 t1 a7
-slt a2 a0 t5
-or s2 a0 s6
-ori s7 tp 1032
-mulh s7 a7 t2
-sltiu s8 t6 629
-sltiu t3 t0 1818
-add s4 s3 a4
-div s3 s11 a2
-xori t3 a5 -1765
-sltiu x0 t3 -1607
-ori t1 s7 -1366
-mulhu a1 tp gp
-sltu s11 t1 x0
-andi a5 s7 -1534
-or s5 s1 s8
-slli a0 a2 30
-sll s5 x0 t6
-xori a5 s2 -904
-remu t1 x0 s4
-xor x0 s8 s10
-addi s0 t2 -138
-xori s10 a0 -1970
-srli a0 a3 16
-mul s4 s6 x0
-remu s10 t1 s11
-ori t5 s6 282
-sra s7 s0 a5
-mul x0 a1 t2
-srl a4 s7 a5
-andi a7 s1 567
-andi t6 t4 1681
-lui t1 119910
-srli a4 a7 14
-mulh tp a1 x0
-sra t0 t6 s3
-srl gp s5 s0
-slti t2 s6 858
-sub s0 t0 a2
-mulhsu s6 s6 s11
-mul gp a5 t4
-slli s8 t5 22
-sll s6 ra t6
-or s6 s10 gp
-mul s0 a3 t2
-slli t3 s11 24
-divu s10 s3 a1
-sltiu x0 x0 1767
-mulh ra t6 a2
-xor a5 s0 a0
-xori t2 a5 -1035
-and ra a4 s4
-rem a4 a2 t0
-mul s8 s0 s2
-srl t6 a1 gp
-mulh s4 x0 x0
-slt ra a2 a7
-ori s11 tp -863
-mul s6 s8 s6
-mulhu a2 ra s5
-srai gp s4 13
-xor x0 t3 x0
-and s8 tp t3
-or s3 t3 gp
+and a1 s4 s9
+srl gp s1 gp
+srli s1 a4 16
+xori a7 a1 -1020
+sub s0 a4 a2
+sltiu a0 s3 -63
+mul t0 t5 tp
+div a7 a6 s6
+mulhu a5 ra a4
+addi tp tp 1514
+srli t5 s7 16
+andi a2 t0 1427
+ori s8 s0 -284
+andi s1 a7 -1106
+mulh t4 a6 s3
+remu a2 a0 s3
+rem s0 s1 a7
+mulh s5 s5 s4
+mul s11 a3 a1
+lui t5 527037
+slt a4 a3 gp
+auipc a6 884125
+sltiu s10 a3 -1439
+auipc ra 543737
+lui t6 1004141
+srai t5 t5 27
+slti t6 s3 1566
+mulh x0 s6 s0
+slti t3 a4 -1189
+srl a4 a5 t0
+divu a5 s2 x0
+srai a4 t4 16
+slli s7 t0 27
+add s1 s5 s9
+srai a6 a3 4
+mulhsu gp t6 t0
+mulhsu s7 t6 t2
+lui s4 358551
+mul s4 s3 s4
+sra s4 a6 a5
+sll s10 t6 a3
+add s8 s8 s2
+xori s10 t5 -1526
+add s3 a3 a1
+lui s8 272651
+auipc s11 695479
+sltiu tp s0 -157
+and tp a5 ra
+remu t6 s2 s1
+xor a5 t1 a1
+lui a5 916434
+slli t4 s6 9
+divu t0 a1 gp
+auipc a3 352869
+auipc s5 899236
+ori a3 t6 -132
+xor s4 s0 t5
+add t4 t5 s2
+xor a5 a6 s2
+lui s9 1022252
+mulhsu x0 t3 ra
+srli tp a6 16
+rem ra gp a1
+auipc s10 665926
+slti t1 t4 2016
+sub s4 ra a4
+sltu t1 s1 s1
+srai a6 s0 25
+xor t6 a2 s1
+add x0 s11 gp
+lui s11 583438
+sltu a6 a5 t4
+rem gp t4 a5
+srai gp a2 30
+rem a4 a3 t1
+sra t0 a7 s9
+xori s2 tp -1543
+ori s7 t6 -1446
+ori t3 gp -186
+slt x0 s3 s0
+and a0 t4 t3
+sub ra s3 a3
+rem t1 x0 ra
+mulhsu s11 s0 a5
+lui a6 338638
+mulhsu s4 t4 t1
+sltu t0 t5 a7
+add s2 t6 s7
+remu tp x0 a7
+andi t5 s0 -112
+mul x0 s0 s5
+xori s6 t4 -290
+divu s9 s11 s6
+rem a4 a4 s10
+slti s2 a0 -627
+xor t4 s5 a3
+lui s10 768309
+divu a2 s8 s8
+auipc a0 110697
+ori s9 s9 352
+add t3 a7 tp
+xori t6 a4 -1338
+srai a7 s8 26
+mulh gp t1 t2
+slli s1 x0 2
+ori t2 t2 -277
+srai gp a1 3
+sltu s4 a1 s9
+xor s1 s0 x0
+remu s0 s11 x0
+mulhu t4 s1 a0
+srl s11 a6 s1
+auipc a0 981960
+sra a1 x0 t1
+addi t4 s9 -1833
+srl s8 t0 x0
+sltu gp tp a6
+div a1 t0 s3
+sltu a0 s10 gp
+addi s1 s6 2029
+sub a4 s0 x0
+auipc t1 382638
+srai s6 gp 28
+slti s5 s7 -17
+srli s9 x0 23
+ori t1 a1 -468
+slli t2 a0 2
+sll a7 a4 s3
+andi a1 s5 -1891
+srai t1 a5 26
+or s7 s8 ra
+mulh t3 t4 s9
+rem gp ra a6
+auipc t0 822629
+ori s11 a5 1140
+lui s10 706834
+lui a0 952609
+srl s6 a5 a0
+ori ra t5 -1070
+remu a1 ra t5
+srli s10 a0 20
+ori s0 a5 1025
+lui s9 511720
+mulh a1 s1 s6
+and s3 s1 t0
+sltu a3 t4 a2
+mul a7 s10 t2
+srai t0 s1 15
+remu t0 s5 a2
+sltu s8 a2 t3
+or a4 t1 ra
+remu a7 s4 tp
+srl a4 s9 s4
+slli t0 a7 20
+or s10 t2 s3
+addi s8 a2 -1454
+rem a3 s5 s2
+andi s8 s4 548
+or t5 s8 s2
+srl s10 s6 a2
+sll a6 s7 s2
+div t2 s6 t4
+add s10 t3 s2
+add s2 tp a5
+addi t4 ra 1363
+add s2 s0 ra
+addi t4 a5 285
+mul t3 s1 s0
+slli a5 s11 9
+xor s8 s10 t5
+rem s0 t0 t5
+or tp ra s6
+srli a4 s8 11
+sub s4 s8 s11
+add t0 a0 a2
+rem s3 ra t6
+remu s10 s2 a0
+xori a2 a6 -802
+sll s4 a6 gp
+andi a4 a1 -1847
+srli a1 s8 31
+slt a0 s9 t0
+srli s1 s10 10
+remu t2 a6 a2
+remu s6 t3 a7
+sra t1 s4 s0
+sra s0 s2 tp
+slt s0 s10 t4
+mulhu a7 s4 s10
+mulhsu a3 gp a3
+lui s5 199100
+remu t1 s7 s8
+mul s10 ra ra
+sltu a4 a3 s8
+xor ra gp s7
+xor t1 a2 s8
+slli s3 t6 30
+add s7 s1 s1
+remu s9 s8 s9
+mulhsu a6 t4 s11
+slti a0 t3 -1761
+srli a7 s7 18
+add t2 t2 a6
+slli s3 s9 9
+xor s6 t5 s4
+add t3 s11 s9
+add s1 s7 t4
+mulh s3 s3 a7
+mul t2 gp s4
+mulh ra a3 x0
+mulhsu t2 gp t3
+divu s3 t3 t6
+andi a1 a2 2033
+mulhu t4 s2 s7
+rem s10 s0 t3
+sub a3 a6 a6
+xori gp t1 -487
+slt t6 s8 t3
+slt s1 a4 s7
+xori s10 s1 -1844
+divu t1 a5 s9
+add a3 s10 s3
+sra gp a7 a6
+sltiu t5 s11 205
+sra a3 a1 t4
+mulh a5 s5 t6
+ori s5 t2 -1223
+lui a4 866713
+rem s1 s7 t3
+slti a4 a7 1538
+andi t4 t6 -925
+sll t1 a1 a7
+or a3 t3 a7
+remu a1 t5 a5
+mulhsu s1 s2 a0
+mulhsu a1 a4 t6
+sll s1 s7 s1
+add t1 s11 s7
+mulhu s11 s10 s4
+div s4 s8 t3
+andi s7 a6 354
+srli a4 a4 15
+mulhu s3 s11 t0
+sub a6 t2 t6
+xor s8 s7 a5
+slti s8 s4 1264
+mulhu t0 t5 s5
+mul s0 s10 t6
+remu t3 s4 x0
+mulhu gp s5 a7
+slli t4 gp 10
+auipc s7 897209
+andi s4 s7 580
+divu t5 s7 s10
+lui s7 294440
+lui s4 111790
+divu a3 a2 ra
+srl t2 t4 t4
+sltu s5 s5 s1
+srai s2 s5 18
+mulh s9 s7 s4
+or a5 a3 s2
+sub t6 s11 t4
+slti a3 s5 -53
+xor t5 t3 s3
+sra t6 s9 a0
+and s3 s6 a3
+andi a5 a4 852
+div gp t6 a0
+addi s8 t2 1582
+sltu s1 gp a3
+sltu t6 t3 t6
+srai a1 a0 1
+addi a1 x0 -1200
+addi t5 s1 -2041
+lui s4 130260
+divu a0 x0 t2
+mul x0 tp t6
+ori t1 s4 -470
+sltiu s5 a5 1095
+mulhu ra s0 gp
+sltu s6 s11 s3
+auipc t5 185977
+xori s2 x0 483
+sltu s11 s9 s7
+rem a2 s8 s1
+divu s1 t1 x0
+addi s11 a3 -1389
+xor s8 s0 s6
+div x0 s5 a3
+or a1 s6 a0
+or s4 a6 t3
+andi t1 a3 -522
+lui t4 105473
+div s4 s7 a7
+slti s6 a0 -337
+auipc t0 487144
+sltiu tp tp -790
+or s5 s7 s6
+remu s6 gp t0
+remu s2 s10 s10
+slt s6 s8 t1
+sltu s1 s7 a1
+srai tp s2 6
+xor s9 s7 s5
+srl t6 t5 s1
+mul t6 s7 s5
+add a0 s7 a4
+lui ra 411517
+sltiu s6 s3 2037
+auipc s6 622513
+addi s7 s1 -1160
+add t6 a3 ra
+ori tp s1 -26
+rem s5 t4 t6
+divu a7 s3 a1
+mulh a0 s3 x0
+rem s8 t2 t4
+auipc s9 297674
+divu t4 gp a4
+divu gp a6 s6
+xori s4 s1 -679
+remu t3 a5 s0
+or a5 s11 s7
+slti a4 t0 -466
+and s10 a2 s2
+sub a6 tp x0
+slli s6 a4 25
+sub a5 x0 t2
+mulhu t0 t3 a0
+xor s3 t2 s10
+sub x0 s9 tp
+slli s5 s1 1
+remu a7 s0 s3
+mulh t1 t0 ra
+rem a6 t1 x0
+sra s1 s7 s2
+srl a7 t4 t5
+slt s4 x0 t6
+sub s9 s11 s8
+xori a6 t4 -241
+ori t2 a4 -1964
+mul s6 s7 ra
+divu t0 a1 a6
+lui t2 607646
+addi s6 s6 -561
+srl s10 a4 t6
+add t4 a6 t4
+rem a0 t5 t6
+slt tp x0 s5
+mulhsu s11 a2 gp
+or s9 t4 s6
+mulh a3 a2 s9
+ori s0 x0 -972
+mulhsu s2 s11 s11
+slti t6 t0 -1759
+rem s11 s1 a3
+slt s0 a7 s8
+sltiu a0 s5 164
+or s10 s0 gp
+add t2 a6 s11
+rem t6 t1 s8
+sltiu a1 t1 438
+slti tp t3 -41
+remu s7 s5 s10
+auipc s4 284142
+add s8 t5 s3
+sltu x0 a7 gp
+xori a4 s3 1676
+xor s6 tp gp
+or s2 t0 x0
+div s6 a0 a2
+slti tp a6 -1371
+or gp s0 s4
+sltu s3 s11 gp
+srai tp s9 6
+xor s2 s9 ra
+auipc x0 152450
+mul s5 s0 s10
+divu a1 x0 t1
+srl a5 s0 s8
+rem t1 s9 s6
+srl t3 s3 ra
+xori t2 x0 -762
+slti s9 t4 -1552
+sltiu s2 a2 -1213
+ori s3 a7 1371
+ori s1 s4 288
+sltu s4 s5 ra
+div t4 ra s10
+and t2 s5 s4
+or s8 s9 tp
+divu s11 a6 s7
+addi s1 t3 -1469
+addi s2 t4 -778
+and t1 tp gp
+slli s5 t6 10
+ori s5 s5 -533
+sltu s1 t6 tp
+auipc s8 541894
+mulh a4 s0 t5
+slti s9 t5 -446
+srai s9 a6 1
+sll s4 s0 a6
+mulh t0 t1 a3
+mul s3 s3 s3
+rem x0 x0 s8
+sll s5 s6 a6
+mulh s3 t2 t3
+or s0 s9 gp
+srli t3 a5 12
+srl s1 s7 s2
+mulh a6 tp t1
+mulhu a3 s6 s4
+lui a5 14080
+xori gp a2 -910
+xor s11 ra s0
+div s1 t4 s5
+slt t3 x0 a4
+sltu a1 s9 a6
+xor t5 s8 a3
+xor t1 s2 s9
+div gp s1 t5
+auipc a2 336321
+sltiu t6 a4 -10
+lui s5 76250
+lui s11 802538
+and gp gp a4
+sra t0 t4 a3
+mulhsu t0 a3 t1
+slti a0 t0 -876
+mulhu ra s7 ra
+or s4 s6 a7
+andi s10 s5 -351
+slti s4 a7 -357
+mulhsu s10 s10 t1
+mulhu t1 t2 x0
+srai a5 s2 22
+slli s6 t3 18
+ori ra a2 935
+rem s8 tp gp
+xor t2 s10 a3
+sltu t2 t1 s1
+sltu s6 x0 s7
+slti ra s7 -136
+andi tp s9 -1678
+xor a1 s2 t0
+ori s3 s3 1239
+sra t4 a2 a7
+sltu x0 a1 s8
+xori a5 gp -1936
+auipc a2 121320
+andi t3 s4 -320
+sll a1 gp s5
+xor t5 s1 t6
+srl t3 a3 s6
+srai gp s5 11
+and s2 s7 gp
+addi a3 s8 1262
+ori s1 tp 715
+srl t1 t1 t0
+xori s5 t2 1130
+add a2 s11 s6
+slli s5 s9 10
+add s6 a5 t3
+srai s1 tp 0
+mulhsu a6 a3 gp
+slli s2 s5 31
+lui s3 1018991
+srai s5 t2 31
+slli s4 tp 21
+divu t6 a4 s0
+ori s8 a0 -1194
+xor s7 s3 a0
+sll a1 s1 a6
+add t1 a5 s8
+and t3 x0 a0
+andi s4 t0 -1116
+andi a2 s5 -56
+slt t2 a4 x0
+sltiu t5 gp -1189
+divu a2 s0 tp
+or t3 t0 s1
+sra ra t5 t0
+divu t1 a3 tp
+addi s1 a6 1143
+add s1 a3 t2
+mulh s6 t3 a2
+srl a3 a3 s1
+add a4 gp s9
+add t4 a5 x0
+slti t0 a2 -868
+sll t0 s2 s9
+slti a6 s5 -1089
+div ra a0 a6
+slt t4 t0 t2
+rem x0 t1 a0
+divu s3 x0 t5
+mulh t6 a4 s7
+slt a2 ra t0
+srai a6 ra 26
+lui x0 23274
+slli a5 t6 5
+slli tp s4 4
+or s3 a2 t2
+srai t0 s11 10
+and a2 t6 ra
+mulh s4 a0 a4
+divu a2 a0 s4
+mulhu s11 s6 s6
+div a1 t0 x0
+or ra s2 a0
+mulhsu a2 s2 s8
+div s6 t6 s9
+mulhsu tp ra t3
+slti a4 tp -404
+sra ra s3 t1
+sltiu a1 s5 -1697
+srai a0 s5 26
+auipc s7 817531
+add t6 a4 a5
+andi a1 a6 845
+add t5 gp s9
+xor x0 s4 s3
+sra t6 s5 a3
+and t1 s6 s2
+add t6 a7 a3
+remu t3 s4 s7
+and s0 x0 s8
+xor ra a5 x0
+xori a4 s1 -201
+sub gp tp tp
+srli t1 a6 8
+slli ra t1 17
+divu s2 a0 s2
+ori t4 s3 -1626
+slti s3 s1 -649
+remu ra s4 s2
+sltu s0 a2 t5
+srli a1 t3 14
+sra x0 a4 s1
+addi a7 tp -176
+lui t4 310130
+slti a4 x0 1073
+mulh s11 a2 s8
+slti gp t1 804
+lui gp 1020999
+slli a5 a4 25
+lui t1 532427
+mulhu s0 gp s10
+mul a0 t6 a3
+xor s7 t1 s1
+addi a4 s6 -340
+sra s2 a5 s6
+xori t0 a5 -153
+or s3 a6 s9
+sll a7 tp s5
+sltu s5 s5 t0
+mulh s5 s1 t0
+add t1 t6 a4
+rem s3 s7 s6
+sra t1 t5 s3
+mul t3 s7 s0
+xor x0 ra a1
+div a1 s0 a7
+mul t6 s6 x0
+and a2 t3 t3
+addi a5 ra -758
+remu s4 a1 t3
+sltu s11 s3 s11
+sltiu t3 tp 1610
+addi gp s7 -1999
+srai s7 s11 3
+mulhsu s3 ra a3
+mulhsu t2 t2 s5
+sltiu t5 s2 -1511
+xor s11 t5 a1
+mulhsu a6 a3 t2
+slli s0 t6 6
+slt s6 s11 x0
+slt s10 t2 a2
+xor t5 t3 s11
+mulhsu s3 s2 s5
+remu s7 s1 s6
+and s5 ra a5
+div s0 s3 s10
+mulh t0 a3 s3
+srli a1 s11 22
+andi s2 a7 -930
+srli a4 ra 31
+auipc a2 638603
+ori s7 s6 1805
+add s0 a2 t4
+slti t6 a7 1241
+srai a2 a2 24
+rem a4 tp t4
+sra s0 x0 a1
+sub s5 s10 t6
+add s10 t0 tp
+addi s9 t1 -468
+slt a5 a7 t1
+divu s4 s3 s6
+ori tp gp -51
+sll a4 a6 a4
+sub a0 s10 t1
+slti t6 tp -1860
+addi x0 t1 1544
+sra a2 t2 t6
+srli a2 t6 13
+srl s8 a7 t0
+ori s2 t5 -290
+slti s5 t4 -1026
+lui s7 225619
+andi a5 t4 -1729
+srli s11 t3 13
+add a1 s3 s6
+sltiu t2 a2 -936
+mulhu s3 x0 a3
+sll gp a1 s4
+mulhsu s4 a2 s2
+auipc a2 894754
+lui s11 817803
+mulhu s4 a0 a3
+slti gp s3 1018
+mulhu t0 s5 s6
+mulhsu s9 a0 s2
+slt s7 t6 t2
+addi s8 t1 710
+rem a7 s2 ra
+sltiu ra s5 -79
+ori a1 t4 -532
+auipc a5 499782
+mulhu a3 a1 s8
+rem s10 t5 s5
+mul s10 t5 s3
+sltiu t5 s10 -1306
+add s2 a7 s9
+rem t4 t1 a4
+and t6 a6 a6
+divu t2 ra s9
+slt a5 s11 a5
+addi t1 s2 1164
+divu s2 t1 s9
+xori s2 a4 1861
+srai a7 a3 11
+slti t0 t3 69
+auipc t2 809199
+xori s11 s1 -651
+srli tp a6 12
+addi t1 s8 -883
+andi a2 a0 -768
+sub t3 tp a6
+xor s6 s0 t4
+and s4 s10 t6
+mul s10 x0 t3
+srai s8 gp 29
+addi ra t3 1435
+xori t6 t3 -928
+mulh t1 a6 s8
+rem a6 s1 s11
+slti a2 t2 1673
+andi s5 s4 -1108
+xor t1 t5 t1
+mulhu s7 s3 t6
+slt s0 a4 t4
+divu t4 x0 s6
+sub a5 a6 s8
+sra t5 s6 tp
+slli a7 s0 30
+divu a3 a2 s11
+xor s2 a2 s1
+srai a6 x0 14
+sll a2 s7 s9
+sltiu a3 a7 -91
+mulh s9 s8 s3
+srli a4 t6 24
+mulhu gp t5 s2
+slt s0 a2 t6
+slti a7 t3 295
+addi a3 t6 -1907
+sub a6 a1 a6
+slli a2 s3 4
+divu s2 s8 s9
+sub s5 a4 a2
+lui t0 965768
+xori t4 s10 -1553
+addi ra s6 -1289
+mulhu s9 s10 s4
+auipc a7 419670
+srli s0 a2 10
+add t1 t5 s1
+sub ra s9 s10
+xor a5 a7 s5
+sll s8 gp s1
+add t4 a2 s5
+div s2 s5 s6
+addi ra s6 -119
+slt s7 t1 s0
+add s9 s2 t1
+addi t4 a4 -487
+srl a0 a4 a2
+sltu s0 x0 x0
+div t2 s9 t4
+remu s8 a5 t2
+sll s3 s6 s3
+slli s0 s0 13
+add s4 gp t0
+srli s9 t2 22
+xor s10 a1 t1
+sra s7 t2 a1
+mulhsu s2 a1 a7
+sra s11 a2 s3
+lui a7 392026
+addi a0 t6 -467
+sra s3 gp a5
+rem s7 t4 t6
+slt s1 a4 a6
+srai t5 s7 1
+remu t2 t3 s4
+addi a6 a3 -1717
+slt s3 t5 a7
+mulh t6 t3 s6
+xori a1 t5 233
+slti t3 s7 -1888
+xor s8 a6 s7
+ori a1 a5 1571
+sll t4 a7 s3
+slti s9 s3 -1485
+divu a3 a7 ra
+xor a5 t0 s5
+or a6 t4 a4
+mul t3 a1 a7
+or a0 s10 s3
+mulhu a3 s7 s3
+divu x0 a2 s10
+div t3 a5 s0
+andi a5 t4 999
+sra t6 a0 a0
+addi tp a3 -1998
+slti ra s10 1804
+slli s6 a6 11
+ori a1 s0 149
+and s7 a0 ra
+addi s4 s3 -888
+srl a6 t4 s0
+xor s5 t5 s10
+mul a6 s2 a2
+slli s6 a4 21
+andi t1 s5 -1566
+mulhu s11 t1 s1
+srai ra s11 0
+add a3 t2 t3
+rem s3 s11 t5
+and s11 a1 a4
+andi s7 s1 235
+srl s7 s10 s6
+sub t5 gp gp
+xori s2 t4 109
+srai a6 ra 12
+and t1 s5 s10
+div s11 a3 t2
+ori a0 t1 -581
+remu t0 s0 s6
+addi t6 a0 -1824
+ori s3 a4 -1625
+lui s6 905354
+sltu x0 t1 s4
+or t2 a2 gp
+slt t1 t6 s1
+auipc a0 220410
+slt gp s1 s10
+xori s3 a5 864
+xori t5 s2 834
+sra t6 t5 t3
+auipc s6 62728
+auipc x0 154835
+auipc t4 106150
+addi s4 s1 473
+slt x0 a5 s7
+slt s7 s10 s2
+lui s10 408494
+ori s3 s10 -142
+srl ra t2 t4
+mulh tp t4 s2
+mulhsu a3 s2 a7
+mulhsu s1 s1 t6
+sll s6 s11 a7
+mulhu s10 a4 s10
+lui s4 669790
+mulhsu a4 s7 t2
+lui s11 428172
+slti s8 t5 -369
+xori a6 t0 -724
+or t0 s2 s9
+lui a1 348160
+sra t6 x0 a7
+mulh gp x0 s3
+rem t4 s5 t3
+divu t2 s8 s7
+mul s3 a6 a5
+mulhu t2 t4 s10
+auipc s9 970131
+srai t2 s0 14
+lui s7 929600
+xor s5 s5 a7
+sll s1 s1 s9
+slti a4 ra 644
+slt s11 s4 t5
+mulhu x0 t6 a1
+sltu t0 t4 a0
+andi s7 a7 1031
+add ra ra t0
+and a1 a2 s3
+sltu s10 a7 s8
+slti a1 gp 1264
+mulhsu a3 t0 a7
+lui a0 615577
+ori s2 a1 -1331
+sub a5 x0 a1
+remu a7 tp t6
+slli a6 a5 20
+srli t2 s3 0
+mulhu tp t6 t3
+srai s5 t0 1
+slli t1 t5 29
+ori tp s1 -83
+srli x0 x0 8
+and s2 s10 a6
+add a7 a0 a5
+xori a1 ra -2001
+sra t1 s1 t6
+mulhsu t1 s5 x0
+sra a3 s4 s10
+slti s5 s2 -221
+srli s2 ra 1
+sra t4 s6 s6
+lui s4 372442
+rem s7 t4 t2
+andi t1 s3 -1592
+slli gp a3 6
+xori s5 t1 -1384
+sltu s11 ra gp
+xori a5 ra -972
+mulhsu s5 a5 s7
+or t4 s3 s2
+remu t3 t1 a2
+addi s1 a0 -541
+remu t2 s9 t0
+div t6 t4 s8
+mulhu s9 t2 a7
+sltu a3 a0 s2
+addi a3 s1 -1637
+sub t3 t3 t1
+xor a2 ra a7
+or s6 t6 s3
+srli a2 a0 19
+srli s5 a2 12
+and x0 s5 t5
+sltiu a0 s0 -1525
+addi ra gp -1268
+addi s1 a1 1073
+sltu s0 t5 s3
+slt s9 s4 s1
+slt a6 s8 ra
+sll t5 ra a4
+auipc tp 139658
+mul s1 s11 tp
+ori t0 t0 -4
+srai s4 a1 31
+srli a2 t0 13
+slli t6 a3 6
+srli a2 a6 17
+lui s8 358933
+remu tp a1 s4
+addi a0 t1 -1123
+or x0 s1 ra
+remu s9 a2 t6
+andi s7 a0 -1365
+slli a5 s4 26
+rem a7 a5 a6
+rem s6 t5 a2
+mulh t2 t1 s7
+or t4 s2 s5
+auipc ra 854579
+sub s6 t0 t1
+mulhu a0 s6 t0
+sll t5 s10 s10
+sltiu s2 a1 -250
+addi a2 a2 -677
+sll s8 a2 s8
+slt s11 a5 a7
+mul ra s4 t4
+mulhsu t0 a1 s4
+slli a7 t5 5
+sra s8 s7 t0
+rem t2 a4 s9
+xori ra tp 1080
+sra a1 a4 t2
+mul s2 a4 tp
+addi a1 s6 -1633
+mulhu s7 s11 s9
+xori t2 s2 -625
+or a4 a3 t0
+xori a7 gp -516
+or s0 t0 t6
+srl a2 a6 s8
+and s10 a3 s4
+or s10 ra s6
+remu t3 x0 x0
+mul t3 s2 s7
+sltu s0 s4 s2
+sub s9 s6 s4
+mulhu s2 t1 s2
+mulhsu gp s4 t3
+slti s7 t4 -307
+ori a3 a2 -1499
+and a5 s2 t1
+sll a5 ra t6
+auipc a7 384912
+or a1 a3 x0
+andi s8 s9 1769
+or a4 a5 t4
+mul tp s10 s5
+mulhu s11 s4 t4
+xor x0 s3 t6
+or s5 a6 a3
+sll t4 t2 t4
+srli s7 t4 30
+lui s8 90498
+ori a1 a5 -1382
+div t2 t0 a0
+mulh t6 a3 s9
+sra a2 s5 a5
+addi t0 t3 641
+or s6 a1 s3
+sltiu a7 s11 776
+remu x0 s10 t6
+slli s4 s10 20
+sltiu t3 s3 -907
+sll x0 gp x0
+mulhu t2 s8 s5
+sltiu t0 a3 -592
+slti t1 a7 -724
+and t0 t0 gp
+add s3 t4 t5
+lui t6 841017
+mulhsu tp a6 x0
+sltiu a4 t4 -2015
+mulhu a2 a7 s5
+ori a4 x0 897
+srl t4 s6 s6
+ori a0 ra -1907
+srli a7 t1 12
+sltu x0 s1 tp
+xori s3 s11 -1789
+ori tp s9 -1092
+sltiu a7 s9 -1418
+ori a0 t4 -977
+or t3 t0 s0
+remu ra a4 t3
+slli a7 a0 23
+ori s7 s2 65
+ori t5 a1 673
+rem s3 a6 t4
+xori s0 t3 -1550
+add s2 s0 a4
+auipc s4 159960
+sub a5 s1 a7
+auipc a4 573633
+sub tp s6 t1
+sltu a2 tp a2
+sltu s6 t6 a6
+slli t4 s8 25
+addi s7 gp -98
+slt a0 x0 t5
+remu t3 a6 s1
+slli a5 s9 29
+srl s8 t6 t2
+xor t1 a4 t2
+srl ra s0 t1
+sll a7 ra tp
+slti s4 x0 977
+srli s9 a7 26
+slti t3 s5 -206
+andi s6 t6 -395
+sltiu a7 a6 -1771
+addi a5 s9 -1908
+andi s5 s11 -1961
+srl s5 s0 t5
+mulhu a2 s11 a3
+srai a6 t5 6
+div t5 a5 a6
+xori t4 a7 -1652
+slli s7 s4 13
+addi s2 s7 -1235
+or a1 s9 s6
+rem a5 a7 s7
+xori a3 s3 -873
+srl t3 t1 s9
+mulhu t0 s7 a5
+srl t2 s4 t1
+srl a3 a7 t6
+slti s11 a0 -893
+add t0 a3 a4
+remu s10 a0 t5
+xori s8 x0 1770
+srai s9 s0 24
+andi a7 s1 609
+lui t1 756186
+divu s10 x0 s11
+ori a1 a1 -332
+auipc s0 35035
+sltu t4 s8 a7
+addi s1 a5 -1366
+lui a3 963508
+xor tp t2 a7
+slli a7 a7 19
+mulhu x0 tp s6
+mulh a3 s2 t3
+sltu s0 ra s4
+mulh a6 t4 s2
+srl t6 a6 t0
+mulh tp s6 s11
+mulhsu s11 t6 t6
+srl s6 ra s6
+slti s8 s7 -222
+sltu a0 s6 a0
+or s11 s5 t3
+srai s0 t1 23
+remu a1 a4 a7
+remu s3 gp tp
+lui s4 937129
+add ra s6 a4
+remu t4 a0 a3
+srli a5 s1 2
+add a1 t6 ra
+xori a7 t4 -309
+mulhsu a4 s9 s1
+or t5 s8 x0
+divu t6 a3 s1
+mulh s2 t1 ra
+slti tp a5 205
+srli s7 s10 23
+sll t6 s9 a4
+slti a2 a2 422
+sra a0 a5 s5
+andi s3 s0 839
+xori t3 s10 -1903
+andi s6 a7 -1268
+addi tp a3 1651
+lui t6 420894
+sra t6 t0 s11
+srl gp s10 ra
+or a4 s0 a7
+srai a6 s1 18
+xor a2 s0 t1
+xori s1 s10 -1043
+sltu t2 s2 t3
+ori x0 s5 130
+sltiu tp ra -1180
+sub s10 s7 t2
+add gp gp a1
+div a1 s11 ra
+lui t2 521763
+add s8 t5 a2
+sll t6 t4 gp
+srli a4 a0 26
+sltu ra a2 t3
+srai a6 s4 4
+xori t5 t2 1037
+srl s7 t6 x0
+divu s9 x0 a4
+add s2 s2 s10
+andi x0 s11 -634
+div s7 s0 t4
+remu s6 t3 t5
+or s4 x0 s10
+sra s7 t5 t1
+mul s7 a6 s6
+rem gp t0 t2
+andi a1 s4 121
+andi s3 s11 -1524
+auipc x0 291133
+sltu s10 a1 s7
+ori a1 s8 -999
+sltiu s11 t4 -193
+xori t3 a3 1667
+ori s1 t4 -724
+srl s6 ra gp
+andi t5 s5 -1009
+lui s6 788936
+rem s11 s10 s6
+xori t0 t2 -421
+add t4 a7 t2
+srl t1 t3 s1
+xor s1 t5 t3
+or s2 t0 s11
+mul s4 ra x0
+srai s9 a1 16
+slti t0 a6 -1775
+mulhu s5 a1 s5
+lui s7 670210
+srli gp x0 27
+or ra s6 a6
+mul t3 t2 t6
+xor a7 t2 gp
+mul s3 t2 s6
+srli s2 t4 25
+and t4 a5 s6
+slt a2 a3 a6
+and s8 s9 a5
+sll s7 t2 a7
+mulhsu t1 s5 gp
+andi x0 s0 1494
+divu a6 a1 s9
+rem a0 a7 a0
+mulhsu s9 x0 s6
+auipc tp 737230
+lui a6 37191
+sub s6 t0 s3
+srai a1 a2 13
+divu s11 s8 a2
+andi t3 s5 -1588
+xori a4 x0 -1022
+srl a0 s7 s2
+ori s10 s1 -795
+and gp ra a3
+div ra a7 a1
+rem s8 s4 s10
+sub s7 s8 ra
+ori a0 s9 -1809
+mul s1 s10 tp
+sra a2 tp t6
+lui gp 450999
+auipc s8 205692
+mulhsu t6 a2 a1
+div ra s3 a7
+srai ra s7 0
+mul a3 t6 a3
+srli a7 gp 14
+and t6 s0 s11
+divu a2 x0 a3
+add a0 a5 t0
+sltiu t0 s5 -553
+lui ra 108907
+and t1 a5 a3
+sub s0 s8 a0
+srl a0 s10 s11
+auipc a0 463520
+andi s5 t5 -1652
+div s0 s0 t3
+sub s1 s10 s11
+andi t6 a4 -1472
+sltiu t6 a0 -1114
+srai s3 s11 0
+addi gp s9 -73
+andi t1 a3 -1685
+srai s5 s2 22
+xori s4 a3 -1886
+sltiu gp s1 -1595
+mulhu t5 s2 a0
+addi t2 s5 -1369
+rem s6 a7 t6
+add t2 t4 s5
+and s2 a4 s2
+and s10 t5 t1
+sub a0 s4 t5
+ori a4 a7 -76
+andi gp a3 -1698
+sra t6 tp t5
+slli a3 a0 18
+divu tp s7 tp
+xor t2 a1 tp
+slli s3 s3 30
+divu s5 s4 t4
+mul s7 a7 tp
+mulhu tp s6 a2
+srli a2 s1 29
+sra a6 s3 a4
+srli gp a0 0
+mul s6 s3 t6
+sltiu a2 s1 -966
+divu s3 a6 a5
+slli gp s10 13
+slli s0 t3 9
+sra s6 a3 t3
+srl s9 a5 a6
+divu s9 a3 t2
+sub a4 a4 a1
+sltiu a6 a6 -1279
+mul s11 s3 a5
+ori a6 s1 -1971
+srl a3 s2 a7
+andi t0 s4 843
+and a0 a7 s7
+mulh s4 a4 a4
+sltiu s8 s11 -685
+remu s4 s0 s11
+auipc s3 859574
+sub s3 t4 x0
+ori t0 a3 1126
+slt ra a0 a1
+andi ra s2 507
+srli t1 s11 6
+div t1 s3 s10
+mulhsu a1 a0 gp
+srl s1 t6 x0
+srl a0 a7 t0
+sll t0 x0 a7
+mul s11 gp a5
+divu t4 s1 s6
+divu s0 gp t1
+sltu t6 t2 t2
+auipc t2 695701
+sltu x0 s3 s1
+mulhu t2 t0 a7
+addi s9 s6 7
+div a2 a5 a2
+mulhsu a0 s6 s6
+addi s1 a5 -1083
+add s2 a2 s5
+div tp gp a4
+srli s3 ra 6
+addi s5 t0 -30
+xori x0 t3 1364
+slt s0 a7 s7
+sltiu s11 s8 -1532
+xori tp a7 -1795
+or s3 s4 s6
+srai s10 s0 7
+srl s6 gp ra
+mulhsu s1 s6 a6
+sub a3 tp a4
+sub t6 t6 tp
+divu a6 a1 t5
+mulhu s4 x0 s11
+slt a3 a5 t3
+andi s2 a3 -763
+slt s5 s7 s11
+sltu a3 s10 t6
+mulh t1 t0 t3
+remu s8 t4 t0
+sra a5 t5 a6
+add s6 a2 t4
+remu s8 t0 ra
+mul s9 s8 a0
+srli t3 t6 14
+mulh x0 a7 a1
+mulhu t0 a3 a2
+auipc t1 458497
+auipc t5 288351
+slt s11 s10 gp
+or s5 s8 s10
+xor s4 gp s10
+divu t2 s4 gp
+sltiu a6 ra -1780
+mul s1 t2 t2
+xori t2 t4 -1970
+remu t1 t0 s0
+slti s2 s9 -1948
+sra gp s9 a7
+xori s1 t4 -524
+sra t0 a4 a5
+slt s9 t2 a1
+slt a3 s9 a0
+andi s4 s7 -411
+mulh s5 s6 ra
+remu t1 s11 t4
+sra s0 t2 a5
+mulh s6 s0 s1
+srli a1 s3 31
+mulhsu a4 s3 s11
+srl a3 s10 s7
+rem a0 a1 s5
+sll s6 a3 t5
+sub t6 x0 a2
+sub s8 s10 t0
+auipc s8 127283
+rem a6 s8 a3
+xor a5 s7 t1
+srai s11 a0 18
+mulh s9 a7 t0
+divu gp s11 s2
+srli s4 a6 10
+and s2 s4 t5
+mulhu tp s10 t4
+slti s5 s2 1529
+remu s7 s10 t4
+slt t6 t6 a2
+rem s10 s4 x0
+slt s11 x0 s11
+sll a7 s11 t5
+slt s8 s5 t2
+sra s8 a1 s6
+mulh a0 s7 t3
+sll tp t1 s4
+and a3 ra t6
+mul t1 tp gp
+sra s1 a0 ra
+ori t3 tp 1796
+slt s6 a4 t1
+auipc a5 378055
+ori s4 a5 -266
+or s9 a5 s8
+andi a2 s2 -526
+mul s0 t6 t3
+mulhu a5 s8 t4
+ori t6 s3 -1776
+sub a7 t4 s9
+sll t6 s1 s2
+sub s1 s1 x0
+and a0 s2 t5
+sltiu s0 ra -242
+remu s3 tp t1
+slti s8 s9 505
+or t3 s6 t3
+and s10 s8 a4
+sub a5 s0 s5
+andi a5 t2 -1223
+sub a0 tp s3
+lui s4 118829
+ori a0 s1 -1954
+slli s6 t1 15
+srli a3 s5 27
+auipc a6 163213
+andi s8 s11 562
+srai t6 s9 19
+divu ra s9 s1
+xori a4 t1 -1132
+slti s1 t2 -765
+and a7 s8 a3
+slli ra s7 17
+sltu s4 t3 s10
+xori s6 a4 1902
+srai a0 s6 3
+sltu s2 s7 x0
+and a3 gp s7
+remu s6 t3 x0
+mulhsu a0 s1 a7
+sra tp s7 a1
+sltiu a1 s0 -1249
+sub t4 s2 tp
+srai s7 ra 14
+slli t1 ra 21
+andi t2 s6 873
+auipc s3 817628
+auipc s5 217270
+and a3 s0 t5
+mulhsu s1 s10 t1
+mul s6 tp s9
+sltu a2 s0 t3
+auipc s6 947250
+or t5 s5 t6
+sub t5 s2 a3
+mulh t1 s0 a2
+divu s7 a6 s6
+mulh s9 t5 a7
+sltiu s0 gp -877
+and s9 a5 a0
+ori a4 s0 -1218
+xori s5 a3 1885
+sll t6 s8 t5
+and a4 x0 s7
+divu s9 a5 s4
+srli s10 t3 10
+divu s10 x0 s3
+sll gp s2 a6
+divu a7 s3 s2
+mul s10 t1 x0
+xori a0 s7 -192
+xor s7 a6 a5
+mulh t6 s6 x0
+mulhsu t6 t3 s1
+sra t3 tp s11
+srli x0 s3 16
+ori tp tp -1244
+slli s2 a4 13
+mulhsu s11 t0 t0
+add t2 a5 s0
+sltu t0 s6 a0
+ori t6 a6 -587
+mul a7 t0 s7
+mulhsu x0 gp s7
+div ra s2 a0
+sll x0 s4 t5
+xor s0 s11 a6
+and s0 a7 s6
+lui s8 508366
+sra gp a0 s10
+div s9 a1 a2
+mulhsu t0 a6 s7
+sll s4 s5 s3
+and a2 t3 s2
+auipc s1 56611
+or a2 ra t3
+slti s11 s6 -1387
+andi s4 gp 1209
+addi s9 t2 -165
+srli s10 s7 14
+srl t3 s7 a7
+xori s8 s1 1348
+xor tp s2 t5
+mul s10 s9 t0
+divu s6 t1 x0
+srl ra a7 t0
+remu s5 t5 s7
+srl a1 a7 s2
+mulhsu s9 s0 gp
+srli t0 ra 9
+ori s1 s11 -637
+sltiu a0 a4 -265
+srli tp s4 20
+andi s11 s3 -1402
+sub s5 a5 a4
+divu s9 a0 t1
+rem s9 s6 a7
+slti s6 t1 2011
+sra a3 gp t6
+mulhu t4 s8 a2
+srli ra s1 29
+mulhu s5 s2 x0
+remu s3 s9 t0
+auipc s3 561456
+mul a2 a6 s7
+slt s10 s6 s0
+sltiu t5 s11 -109
+divu s7 t3 a7
+andi s8 s11 -1584
+srli a5 s8 11
+remu t1 s1 gp
+sub a7 a5 t6
+mulh t1 s10 s9
+slt a4 tp s6
+slt s11 a5 a5
+srl s3 x0 s0
+sll t6 s3 a5
+sltiu ra t3 -630
+remu s0 a4 a2
+srai a7 a6 20
+sra s4 gp t4
+sltiu a1 s10 -1586
+divu a7 a1 t4
+sltu t3 s8 ra
+mulhu s4 tp s3
+sra s8 a4 s1
+sltiu s8 a1 -1260
+mul a6 a1 tp
+xor s6 s1 a7
+and x0 t0 t0
+remu t3 s6 s8
+slli s5 t1 2
+xori a5 t1 -554
+mulhu s5 ra t5
+mul s9 s11 s3
+slti a2 s10 -628
+slti s1 a0 -903
+rem t6 t1 gp
+sub s7 s2 s7
+remu a0 s10 a3
+slli s2 tp 4
+xori s9 t0 576
+sltiu s1 t2 1345
+slt tp s6 t0
+addi s8 t1 -149
+slti s7 a4 -1440
+auipc a3 265773
+mulh a0 a0 s5
+xori t0 a0 -166
+slti t5 t1 -386
+div s11 s5 a1
+srai s0 s10 27
+slli a5 t0 18
+ori t1 s11 -249
+div a1 s11 a0
+div t5 t6 ra
+mulh gp t2 s6
+auipc t1 468134
+andi s0 t0 -1208
+mulhu t6 s0 t5
+andi s10 s5 -530
+xor t4 s9 s10
+or a5 x0 a6
+addi a6 s2 -516
+divu s4 s0 t3
+mul s11 s7 a6
+divu s0 a1 s11
+sll t5 tp s0
+auipc x0 656608
+mulh a3 s8 s4
+sltiu a3 a5 -110
+srli s9 t3 9
+lui t0 356622
+sltu a2 t1 t0
+mul s4 t5 ra
+lui t1 879960
+div t4 tp s1
+auipc t6 518155
+ori s8 ra 1549
+divu t4 t4 s7
+rem t4 a2 a7
+remu t4 tp t4
+srl tp tp t3
+add t2 s0 s3
+divu t0 s4 t5
+srl s2 x0 gp
+sltiu s10 a3 -1094
+rem s1 a5 gp
+mul t5 ra a5
+addi a7 a0 -867
+add a0 t4 s8
+ori s2 t0 -15
+rem s2 t2 s1
+andi s11 t3 -1823
+slli s8 a2 28
+mul t0 x0 s4
+slti gp s0 539
+or s11 t0 s2
+andi t1 a5 -342
+or t6 t0 t4
+rem tp t3 a6
+sub a6 t6 s5
+rem t6 s6 ra
+ori a6 a7 1487
+sll tp s4 s10
+mul gp s10 s5
+and gp s5 s11
+or s8 s1 tp
+div s0 s6 a6
+sltiu t5 s5 1036
+sra a7 s5 t5
+srl a5 a1 s8
+sltu s7 s5 gp
+srli s4 s7 10
+remu a6 a7 s7
+mulhsu s7 a4 s1
+add x0 x0 s10
+srli t4 a1 5
+sltu tp s0 s6
+slt s7 s0 t0
+sll t0 a2 s9
+auipc a7 267987
+mulhu a2 a7 t2
+sub a6 a1 t3
+sub t4 a3 s10
+add s1 t5 a5
+sll s8 t2 a0
+ori t1 s0 -136
+sltu tp a7 s9
+slti t5 s3 -1385
+sltu t4 x0 a0
+srai s9 t3 29
+sll t3 s11 t0
+sltiu s5 t1 915
+addi t5 a7 -1241
+sltu s3 s10 s9
+slti t3 s4 -177
+xori s10 s4 -1722
+div a5 s8 a1
+ori s2 t2 1152
+and s6 s0 s0
+addi s0 t3 -1555
+srl s8 s0 a7
+rem gp s10 s2
+lui s1 746127
+remu t6 ra a5
+mulhu s7 gp t0
+sltiu s7 s11 1127
+mul s5 s5 t6
+divu tp s6 a2
+divu a3 a6 s11
+div t4 ra t5
+ori t4 t1 1504
+mul t2 s11 s4
+mul x0 s9 s6
+andi tp s11 1495
+slt a0 s8 a0
+mulhu t3 t1 a0
+sltiu a3 s1 -1896
+mulh t2 x0 s0
+xori t5 a7 -1206
+mulhu t6 s3 a4
+sltu a5 s4 s5
+sltu s6 s4 a3
+sra s1 t0 t2
+mul t3 s8 x0
+mulhu s1 s10 s3
+slti s11 s11 1534
+srl a4 s11 a6
+sub a6 a1 a5
+add s4 s7 a6
+sra a4 a6 t5
+sltiu a0 s10 -599
+mulh s8 s4 ra
+mul s3 x0 s11
+auipc s5 896655
+mulhu a5 x0 s7
+sll s4 t1 t6
+div s0 t1 s6
+slli t6 s8 4
+mulhsu x0 a2 t0
+slt s10 s1 a6
+srl s2 s7 t3
+slli t3 t5 12
+div a5 s8 gp
+slli t5 s10 17
+xor a0 s7 s10
+andi s1 s4 97
+sll s10 gp t1
+div t4 t4 s6
+mulh gp t1 a4
+sltu ra gp a3
+sub a5 gp s4
+slti s8 x0 -1462
+and tp t0 s7
+mulhu a3 tp a0
+sra x0 s10 t4
+auipc s9 694430
+sub a2 a4 s7
+srli a1 a0 13
+xori a3 t1 371
+mul x0 t6 s1
+mulhsu s6 gp a1
+mulhu a6 a5 a0
+addi s7 t2 1664
+or a7 a7 s11
+sll gp t5 s0
+sub a0 s2 s0
+xori a1 t4 -939
+div s2 a4 a2
+srai a0 s10 25
+or a4 s10 t2
+mul a0 t5 tp
+sltu t5 ra ra
+sra tp t5 t1
+sltiu s7 a7 -869
+sltiu s11 s7 -1624
+xori t4 s4 -108
+srl t1 s6 a7
+slt s3 tp a6
+divu tp s7 s9
+addi a6 a5 466
+xor tp s9 ra
+sltiu s7 s9 -434
+div s3 t6 x0
+srai a1 a7 21
+addi s5 s9 844
+mul s11 x0 ra
+srl s1 t5 a4
+div s5 a0 a0
+sltu a0 a3 s4
+addi t2 s9 -1637
+slti t4 a5 -1664
+auipc a7 252183
+mulh s1 s0 t5
+sub a4 s3 ra
+xori t2 s2 1127
+div s9 s5 a6
+xori s10 a2 -1481
+slli s7 s8 30
+auipc s6 570464
+divu ra s10 t2
+slli s4 t5 28
+xor s5 t1 t4
+mulh t0 t3 gp
+sra a5 s4 t6
+sltiu a2 a6 -731
+andi t4 s4 -1831
+sltu s6 s10 s9
+mulhu t5 t0 a5
+sltu tp a3 t5
+rem s10 t2 s9
+auipc s8 690169
+ori t3 gp -113
+xori t6 a2 1799
+ori a6 s5 -1653
+slt s5 a4 s7
+slt a4 s7 s5
+sll t0 ra s2
+srai a3 s3 0
+sltiu t5 a3 -318
+slti s2 tp -484
+srli s1 t1 20
+slt t0 s5 ra
+xori t6 a0 -369
+add t3 t2 a4
+srli t4 s7 16
+sltu tp ra s5
+auipc t2 986580
+sltiu s0 a1 -984
+srl s3 a2 s2
+sltu a3 s7 t1
+auipc s11 656393
+add t2 s1 x0
+srli t2 a1 24
+sra s1 s1 t0
+mulh a6 x0 s11
+slt t6 x0 s6
+slt s1 s8 s11
+mulhu x0 t0 t4
+mul t4 a3 s7
+remu s5 s4 t3
+slli ra s7 30
+mulhu s10 tp a0
+addi a0 s0 -1392
+slt t0 s8 s2
+auipc s7 574355
+rem s7 s4 a3
+ori s6 a5 -709
+mulhsu s10 a1 s10
+mulhu s11 s7 a5
+mulhu s5 t6 s3
+mulhu a6 a6 t0
+auipc t5 800334
+or t6 t6 ra
+rem s7 a1 a7
+xori s6 a4 1257
+addi s1 tp 543
+or a1 s9 t6
+mulhsu t4 a0 s0
+add s7 a3 tp
+mul t6 a0 ra
+ori s6 s4 773
+sra t1 x0 t0
+remu x0 s0 s0
+mul gp a4 s6
+sll a2 s6 s8
+sll s5 s5 t4
+and t5 s2 s0
+xor x0 t2 a4
+rem a4 t3 s3
+auipc s8 655395
+sub a4 t0 s4
+rem a6 s9 t0
+div a3 a1 gp
+auipc t5 1019579
+addi x0 s3 1820
+sll s8 t1 a2
+sll a1 t0 s1
+addi a0 t4 560
+lui a2 121768
+slli a2 t4 20
+mulhu a6 t0 gp
+and s6 s6 s8
+srli a4 t0 10
+sll s8 s2 t5
+remu s8 a3 s7
+slt a2 s4 s2
+ori s11 t5 -1216
+sub t5 t6 t6
+srli a4 a2 27
+addi t3 gp -1064
+auipc s8 124842
+xori s5 s6 315
+slti a1 a1 -956
+slli t5 t6 29
+mulhsu a6 t2 s2
+mul a4 s8 tp
+srl ra t0 s8
+remu s5 s11 t4
+rem t1 a4 a6
+mulh tp a7 s6
+mulh s1 x0 ra
+ori t5 s0 708
+xor s5 tp s5
+lui t0 1003561
+xor s1 a7 t0
+sra s1 s8 t1
+lui a4 462244
+rem a3 s3 s8
+srai a6 s1 4
+slti a7 s5 -682
+andi s7 gp -1004
+xor ra a5 a7
+ori a3 t0 -1426
+mulh s9 s4 s6
+sltiu a4 a4 -886
+srli a7 a4 26
+addi a2 s2 -880
+auipc s0 989362
+add a6 x0 s3
+srli s1 x0 24
+lui a7 547407
+slti t0 s0 178
+xor a2 s5 s9
+div tp s0 s7
+lui a3 640181
+mulhu t6 s2 a2
+divu s6 s2 s9
+srl tp t6 tp
+sltiu a5 t6 -1838
+slti a5 s10 -985
+xori s1 s5 -456
+and s8 a2 s11
+mulhu s10 s1 t2
+sltu a2 t1 t4
+addi a5 s6 -1160
+srai s9 a6 26
+sub a6 t2 t0
+lui gp 336476
+divu s1 t3 s9
+xor s10 s0 t6
+ori t6 s10 2021
+and s1 a1 s4
+xor s10 t1 ra
+slti tp t1 -247
+xori s3 a6 806
+and s4 s6 x0
+mulh a4 a0 t1
+addi s0 t3 1741
+sltiu x0 s0 -1283
+sltiu a3 s5 1616
+xori t3 s6 -1320
+sra a5 t4 s7
+sltu a6 s5 s5
+sll s1 s6 s3
+sltiu t3 s11 -1612
+addi s4 s3 -2017
+and t5 t3 s8
+mulh a3 a3 s2
+sra t6 t2 t0
+add gp ra a0
+srli t0 a0 9
+andi a5 a2 1110
+rem gp s4 a2
+srl s5 t5 t4
+xori a6 t0 -973
+mulhsu a5 s11 s8
+ori a1 s8 -1548
+sra s7 t0 t6
+andi s11 a4 -662
+mulhu a1 s5 s11
+ori a5 s9 1179
+andi s4 s6 -196
+or s0 x0 a1
+mulhu a5 t4 s3
+sltu ra s8 a7
+div ra a7 t5
+andi s10 s4 1339
+andi t3 s0 -1680
+sltiu tp a4 764
+mulh t2 t1 t1
+rem t6 a0 a6
+mulhu s10 a3 s1
+div s7 s10 s9
+xor s9 s7 a7
+srli s9 t3 6
+slti s0 a0 600
+mulh tp t5 a2
+xor s7 s2 s4
+rem s5 s7 s8
+or s10 a3 a4
+auipc s0 549881
+mulh t3 s4 s0
+xori ra a6 -714
+mulhu s5 t0 a2
+srli s4 t5 12
+sltu s11 x0 a5
+mulhu s7 s4 a5
+auipc a4 393892
+slli a2 t6 30
+sub s3 s9 t6
+andi s11 ra -1407
+div s5 s10 s3
+slt t5 a2 s6
+or s7 a7 a6
+sub s10 gp s0
+divu t3 t2 a2
+xori a5 s11 -164
+mul a2 s9 a4
+sltu tp a3 a2
+xori s3 a5 -204
+xori a1 t4 -1337
+ori s2 s7 -890
+andi tp s11 -1522
+slti s5 a5 -1908
+slt s2 a3 s1
+mulhu s6 s2 s10
+mulhsu s9 t2 s5
+mulhsu s1 t3 x0
+srli s4 s4 0
+addi s1 a1 -39
+slli s2 s4 22
+srl t5 tp t3
+mulhu s4 a4 a5
+srai s8 a3 10
+xori tp a5 -769
+sub s11 t5 s9
+sub ra t3 a1
+srai s7 t4 26
+slti s0 a6 748
+ori t4 s6 -111
+srai t0 a7 4
+mulh a5 a3 s3
+lui t4 281062
+sll t4 s7 s0
+divu s3 s2 a4
+rem t5 t3 s10
+rem a4 t6 a4
+slt a7 t3 s6
+div a7 a4 s1
+andi s11 a2 -62
+srli a4 s9 31
+sltu a6 s11 s0
+ori a4 t4 1660
+slt a2 s7 tp
+mulhsu t5 s5 t6
+slti s8 t3 -444
+addi a3 t6 -1148
+xor t0 s1 a5
+slt s9 s3 s10
+sub s5 s3 a4
+sll s3 a3 x0
+slli a7 t4 9
+sub s11 gp s3
+srai a1 s1 14
+lui t5 411574
+xori t4 s9 1418
+addi s4 t0 -90
+srl t4 s6 a3
+mulhu a2 t0 t5
+auipc a4 703096
+mulhu t0 a5 a4
+sll t3 gp s7
+sra tp ra s7
+lui a4 118022
+slli a3 s4 10
+sub a0 a2 tp
+srl s4 a2 t1
+ori a2 a0 -1221
+xor a7 t0 t1
+add t6 a4 t0
+sra gp t6 a5
+xor a5 a6 s8
+add a6 t6 a5
+slti s5 t3 -240
+rem s7 s0 s7
+or s5 x0 s7
+slli a2 s3 15
+sra s7 t1 s1
+slli s5 t4 24
+slli tp t2 14
+mulhu gp s8 s4
+andi t2 tp 1377
+lui s2 519072
+srl s11 x0 t4
+mulhsu a3 t4 s9
+sltiu s0 s11 268
+xori s3 s11 -927
+or s0 a2 x0
+sll s7 a1 s5
+xori t1 s4 1630
+addi s0 t3 -1812
+slti s11 t6 -22
+slti s10 s1 -1212
+mul a1 t1 a6
+srli a5 tp 29
+srl t6 gp a7
+add s10 t2 s10
+mul s2 s1 s8
+rem t5 x0 t3
+andi s4 t4 83
+add t3 s9 t0
+andi t5 tp 569
+xor t6 s5 s4
+addi t5 s10 -1265
+addi s4 t5 -798
+divu s4 s1 t4
+sltiu tp t3 -1589
+lui s1 762027
+slti t3 s1 -98
+sltiu s3 t6 282
+rem a4 s1 ra
+sltu a3 tp s5
+slt x0 s3 t4
+srai ra a0 8
+slli s1 a7 22
+srli tp t1 10
+sll s5 a6 a2
+rem s7 s11 s11
+lui s8 130936
+ori s8 t6 855
+slti a2 a5 -503
+mulh s5 t6 tp
+div a0 ra a3
+mulh s6 s3 a7
+slti s7 s7 724
+add s7 s6 t2
+xori a7 a0 484
+slt s7 s3 s1
+srai t6 gp 17
+sltu t6 t2 s11
+slti s1 s0 -909
+mulhsu a7 a4 gp
+mulhsu t1 s5 s2
+remu s10 s8 s5
+sub t3 s2 s8
+ori tp gp -1084
+sltiu s3 t3 -1111
+sra s0 s1 s4
+srli s7 t1 14
+srai s2 tp 25
+sub t2 s7 s3
+lui a7 748389
+mulh s1 a7 s0
+sll t4 a7 s4
+slt t5 a0 t6
+addi s6 t6 -1195
+sub t2 t6 s8
+add t1 t5 a1
+ori s11 tp 686
+rem t1 s10 ra
+srl s7 s1 a4
+srl a2 a7 s2
+auipc t2 863875
+slt s1 a5 a1
+sltu s5 a2 s0
+andi tp ra 52
+xori t3 s1 -877
+divu s5 s6 a7
+mulhu t2 s1 t4
+slt s11 t6 s3
+or s7 s6 s2
+lui s1 998279
+xor t0 a7 gp
+srli t4 a0 7
+xori a1 s10 -675
+ori s7 t1 -1716
+slli a3 s10 19
+slli t2 a1 1
+slti s1 s4 -764
+div s11 a3 t1
+sub t1 s10 s9
+rem s6 x0 a6
+srl t4 gp a7
+sltu gp t5 t3
+srl x0 s11 a2
+slli a3 s6 29
+remu a1 a1 t5
+srli a5 s2 8
+srai t1 a0 1
+mulhsu s11 s5 s10
+or gp s8 a0
+sub s9 t6 t3
+mulhu a6 t0 t2
+sll t2 a5 s6
+rem s7 s9 a6
+srli a4 t5 17
+remu t4 s7 s8
+sra a1 s8 t4
+slt a2 a3 t2
+lui s5 854001
+rem a4 x0 a5
+mulhsu a4 t6 s0
+sll t5 s10 gp
+sub s4 t0 s2
+remu a0 s8 a2
+addi t3 s7 1429
+sltiu s7 a2 18
+srli a6 t0 31
+sll a3 t3 s1
+sra t0 tp s10
+mul s7 s11 a0
+auipc s6 296674
+divu a0 s8 a1
+andi a4 t2 -841
+or s0 t2 s9
+sltu gp t0 a2
+add s9 t0 gp
+sub a2 t1 a0
+sll s5 a4 ra
+div a6 a2 t1
+srai t6 t2 26
+slli a1 a5 10
+rem s4 a2 t4
+srl a5 s11 a6
+slli t3 a7 12
+mul t2 a0 a4
+xori a2 t4 -1382
+ori a0 t2 1565
+add a1 a6 gp
+xor a1 s0 s5
+remu a6 s11 a5
+or s1 s4 a1
+ori t6 gp -146
+slt t0 a1 a1
+mul s1 t1 t1
+mul s0 t4 a5
+sra t6 a7 tp
+lui a0 141411
+slt s11 t4 t0
+remu ra tp ra
+ori s8 s3 120
+slt ra a7 s8
+slt a2 a5 s9
+xor t2 a5 s8
+andi s8 t3 -1006
+slt s1 s10 t3
+addi gp s0 203
+slti s8 a3 -1303
+mulhu x0 a1 gp
+andi s7 a2 -922
+sltu s1 ra s1
+addi a7 s1 210
+andi t3 a3 1295
+mulhsu t3 a4 a3
+or s10 s3 t5
+divu s1 s2 t2
+div s11 tp s7
+sra t0 s6 gp
+sub a6 a7 s9
+or a4 s9 s1
+ori s9 s1 -81
+mulhsu a2 t6 a3
+or a4 x0 a6
+auipc a5 379555
+div a6 t1 s7
+add s2 t1 t0
+mulhsu s4 a1 t0
+mulh a4 t3 t4
+sltu s6 a3 a5
+srli s1 s6 10
+lui s5 891212
+andi s11 t5 -1208
+mulhsu a3 x0 a0
+sra t3 s8 a6
+sra tp t0 s0
+mul a1 s6 t3
+andi s8 a0 1822
+slt s5 a6 t2
+xori a7 a6 -391
+xori a2 s10 -763
+srl a1 a5 a0
+sll s8 s10 s8
+srli s8 s5 5
+andi t1 a3 957
+divu x0 a5 t4
+slli s0 t5 19
+srl s4 a6 s8
+slt t2 a7 a5
+add t1 a6 t5
+xor s3 t2 s6
+remu s0 t2 s7
+sltiu x0 ra 1908
+srli gp s11 29
+xor ra a5 s3
+ori s7 s8 -2010
+sltiu t0 x0 -415
+mulhu s8 ra gp
+or a0 a5 a2
+lui t3 292792
+xori t6 x0 -1350
+srl t2 s1 t1
+sltu s2 t6 gp
+andi x0 gp -994
+slti s4 s1 -642
+sltiu s1 a7 -1674
+or a6 t5 t4
+sltiu s8 a2 -1059
+srli a1 s3 2
+auipc a5 957778
+or s1 s4 s11
+sra t2 t5 t1
+and t4 s3 t2
+addi s5 a2 1642
+sltiu t5 s1 1518
+srl t4 ra s4
+rem a1 s2 s3
+and t3 a4 a1
+divu a4 a5 a2
+mulh t5 s3 s6
+div s5 a5 s9
+sub t6 s8 a6
+xori s5 a0 -162
+xor x0 a6 x0
+ori gp a5 -1934
+srl t0 a7 a7
+ori a5 s0 1948
+or s11 s9 a5
+slli a0 a5 26
+remu t0 t4 t4
+remu a4 t5 s5
+srl a0 s10 s8
+lui a6 231029
+addi a5 a2 -621
+srai s8 s11 27
+addi s1 a1 -1088
+mulhu s3 a1 t2
+ori t6 t5 -682
+sltu ra a2 a3
+ori a6 x0 -1732
+remu s5 s1 ra
+slli s10 a7 29
+slli a0 a1 30
+mulhsu a4 t6 gp
+addi t4 s0 -1276
+divu s4 s7 x0
+auipc x0 161133
+and ra s7 x0
+sll s6 s3 s3
+xori a3 t6 1883
+div s2 a2 t2
+slti a7 t5 -1569
+and t0 a7 s3
+mulhsu s9 a0 t2
+auipc t2 463031
+xori t6 ra -1343
+remu s10 a5 s4
+addi a4 a6 -1938
+div t6 t1 s10
+slti tp t4 -628
+mulh s0 gp s1
+srli t0 a2 26
+mulh t4 s10 s1
+slti a0 s10 -1641
+sub tp s5 a2
+slti s10 s2 1161
+sub a2 t6 ra
+addi t0 s3 1778
+mulh s10 s1 s9
+sra a3 t4 s4
+ori s9 tp -2024
+mulh a7 x0 a4
+srli t0 t0 29
+sltu x0 s2 a4
+mul s2 s9 t0
+auipc a1 941295
+sra s1 s5 a5
+xor s0 t6 s3
+lui t4 857151
+auipc t2 386379
+slli s11 gp 0
+xori a4 s0 -519
+or a1 a3 s5
+remu t1 s10 s1
+sll s4 s2 a6
+srli tp s3 26
+mul t1 s3 a1
+ori s9 t1 1749
+or s11 s1 t4
+sltu s4 t4 a7
+andi s3 s5 763
+sll s7 s11 s3
+div a2 a7 t6
+remu t0 t5 s1
+div a4 ra t6
+add t0 t4 a0
+auipc t5 611323
+andi t5 s4 1554
+srli a0 t2 5
+divu x0 s2 s11
+slli a3 t1 23
+sra s8 ra s8
+mul s9 s4 a7
+or a6 t1 s9
+mulhsu t6 t4 a7
+sltu gp s0 s4
+or a2 t3 t0
+sub t6 s7 s8
+srli s9 t5 21
+mulhsu t6 a1 s0
+slli gp x0 24
+srl a3 a7 a6
+mulh s5 s2 s11
+and s1 s6 t4
+mulhsu t5 s6 a4
+mulhsu t2 a1 tp
+slli s1 a0 11
+mul s1 a6 t5
+andi s4 s6 -652
+mulhu t3 ra s6
+sltu gp t0 a3
+mulhu t3 s5 s5
+mulhsu s5 gp s7
+slti t2 s1 -870
+mul t6 s9 a0
+sll a7 t6 s0
+sll a5 t5 s8
+rem s1 s10 t0
+srli s4 gp 31
+rem a0 s10 ra
+div gp tp t5
+srl gp a5 tp
+slti s9 a3 -348
+andi a7 s7 1810
+sub t5 a1 x0
+slt s5 a4 a6
+xori t2 a0 -1150
+xor a3 a7 a3
+sub t3 tp s4
+remu a7 t1 s3
+div a6 a5 s10
+xori t5 t4 126
+srli s3 t3 9
+mulhsu a1 s3 t0
+slli s5 s2 27
+mulh a2 a3 a1
+lui t1 909291
+slt s0 x0 t4
+remu a3 x0 a3
+divu s9 a5 t5
+mul t3 t5 t6
+slti t3 s3 470
+remu s11 s0 s8
+remu a3 x0 t0
+and t0 a0 t6
+slt s6 s11 a7
+div t1 t2 a2
+and t6 s7 a0
+sltu t5 s6 t1
+srli t2 a6 12
+and x0 t5 t0
+sra t0 s6 s11
+addi a0 gp -467
+sll tp t2 x0
+srli a1 a7 3
+ori t4 s3 -185
+or s11 t4 t4
+sll t4 tp s5
+sra tp tp a2
+remu a3 t3 t5
+sll gp s10 a6
+sra tp s6 s7
+slt s9 t6 tp
+sra a7 s11 s5
+mulhsu s9 gp s6
+addi s3 a1 -301
+srai t1 t4 11
+mulh s2 a6 a6
+addi tp a1 1523
+slti x0 t4 -1699
+slti a0 a3 -1673
+lui s4 609824
+sub s9 a5 s10
+mul t3 s11 t5
+mulhsu t2 a6 t4
+and s6 a5 s10
+or t3 x0 a4
+mulhsu t6 s0 s10
+slt t2 t5 s5
+sltu s2 a1 s9
+sub a3 a3 a0
+ori a1 t4 -931
+srai a6 s1 22
+andi ra s6 1285
+div t4 s0 a4
+xor t0 a3 s5
+or t6 a0 s10
+ori t3 s11 -1077
+sll s4 s1 s1
+slti s0 s11 -932
+add t0 s2 s7
+mul s4 tp t2
+sra a6 s0 x0
+ori s9 t4 -528
+srl s5 a1 a5
+add s11 t5 s5
+slli s11 t2 25
+xor s11 t1 t0
+and s9 ra a4
+add s11 s2 s7
+and s11 a7 s1
+rem s5 s8 tp
+xori a5 t6 1023
+sll a5 s5 t1
+srl s7 s3 a6
+mul gp tp t5
+sra a0 a2 a0
+lui a3 656620
+lui x0 1037272
+sra t4 x0 x0
+add a6 gp s6
+and gp s7 t5
+sll s10 t2 t0
+add s11 gp s3
+srl s3 t3 s7
+mulhu s7 t0 a1
+sltu t3 t4 s7
+xori s9 t4 -453
+sll a3 t6 s0
+sub ra s11 t4
+mulhu s8 s0 t3
+srai t0 a2 13
+sltiu a6 a6 -83
+slt a4 s8 t3
+auipc s10 619567
+sltiu t1 t4 -1969
+remu t0 s10 s1
+sll s5 gp t1
+slti tp a2 -1105
+or t0 a4 a2
+lui x0 246758
+sra a6 s10 s0
+slti t5 s5 1479
+sll s3 s6 s10
+mulhsu tp a1 t2
+slti s7 s0 -1625
+mulh s3 ra t2
+srl s0 s10 tp
+lui a5 15814
+ori a3 t4 744
+div s10 s11 s2
+slti t3 s9 1918
+slli s2 s8 9
+slti gp s3 37
+mulhu s8 a3 t0
+sub a0 s11 a0
+mulhsu s8 s9 a4
+mulhsu s2 s9 t3
+ori x0 t4 1109
+mul s10 t3 tp
+add s10 s7 s1
+sra t3 s6 a3
+and ra s6 gp
+xor a4 s2 s9
+sltu s9 s5 t2
+slli s9 s3 6
+sub s9 a0 t0
+ori a2 a5 -1816
+addi s11 s0 1405
+add t2 s3 t3
+sub s3 s5 s1
+remu s11 s2 t3
+and a0 s10 s8
+mulh s6 t2 a6
+mulh gp s9 gp
+and t3 a0 a3
+auipc s6 1010402
+mul a7 s7 a6
+divu s10 t0 s6
+mulhu s4 ra a2
+srai s1 s3 0
+ori ra s2 1586
+addi ra a1 1995
+slli t4 s4 17
+sll t2 a1 ra
+sll ra a4 a5
+xori x0 t4 1726
+remu s0 a3 a5
+slt x0 a5 s10
+xori s6 s5 -1040
+and s5 s8 tp
+mul t4 s7 s7
+slti s6 s3 1917
+add gp s8 s3
+lui s2 476942
+or s8 a5 t4
+sub a4 s5 s3
+mul a1 t3 s5
+sltiu t3 x0 1527
+add s7 s5 t0
+andi a0 t2 137
+srli tp a6 9
+ori t2 ra -1893
+mulh s8 a4 a2
+xori s7 ra -957
+remu x0 a6 s11
+add a0 s10 gp
+addi t3 s5 1085
+sra a3 t4 s10
+sra s7 a5 s8
+mulh a7 s1 a1
+sll t5 a4 t5
+slt a3 s2 s4
+andi t6 s3 -1700
+mul a5 a2 s4
+andi s2 a7 -631
+srai s1 s3 16
+xori a0 a3 -346
+ori t0 t5 -658
+addi t3 s3 1999
+divu t2 t5 s1
+sll a7 a3 s0
+mulh a2 s9 t2
+srl t1 a6 s9
+remu s3 t2 s10
+divu s7 s4 x0
+mul s11 s7 ra
+andi t5 t6 -1210
+sra s4 s9 s1
+div s2 a5 a0
+slt a4 t2 ra
+mul t5 s0 s7
+addi t5 a2 459
+rem a2 t1 t2
+xor s0 s2 a7
+slli gp a4 10
+sll a0 s7 s8
+divu a3 s8 s10
+ori t5 s1 -1760
+ori t1 a3 -1354
+addi t4 t1 -2011
+remu t2 s10 s0
+slti s4 t3 -736
+srli a5 t5 18
+or s6 t6 a5
+srli s5 a5 4
+remu s0 t6 s7
+andi a7 a4 823
+slli ra s5 8
+rem s0 tp t3
+andi t2 s10 1273
+sub t1 t3 t4
+sltu s5 t5 t6
+lui t2 17854
+or gp s7 a1
+lui a5 338234
+srli s10 a6 2
+sra s10 tp s11
+divu s4 t3 a0
+andi ra t2 -1608
+mulhsu s0 s8 s11
+slti s3 a3 -305
+sra tp s2 s5
+srai t0 a1 20
+div ra s2 a3
+div s10 a0 s10
+lui t6 86194
+remu a1 a2 s11
+div s7 s3 a4
+sll a7 x0 t2
+div t1 s2 a1
+sltu a2 t0 t4
+mul s0 t0 t2
+remu s10 a6 a4
+mulhu s10 s9 s1
+srl a4 a3 t2
+sltiu s5 s4 890
+slti s7 t2 333
+rem t4 s1 a0
+and t3 x0 a4
+lui ra 811247
+sra a3 s11 a0
+mul s7 a7 s5
+sub t6 t1 s2
+srl s5 x0 s2
+sub a6 s9 s1
+andi t6 ra -737
+slt t0 gp s9
+sra s11 gp t3
+mulh s3 s7 a1
+sra s2 a3 t2
+srl x0 t0 a6
+slti t0 t3 2020
+srli a0 t3 14
+srai a3 s10 11
+slt t5 s11 t2
+srl s1 a1 t0
+xori t3 s2 544
+remu s11 s8 a5
+and s4 s10 s4
+slti s9 s3 1373
+slt a0 t3 a0
+add s0 s7 s0
+srli s6 a4 19
+xori t4 tp -1959
+mulhsu t2 t1 t5
+srai a5 a2 16
+auipc a4 484002
+slli gp t0 15
+add a6 t3 t3
+sub s3 a3 t1
+srl a1 a2 t6
+add s4 s2 t5
+srai s1 s5 10
+sll s8 t2 t5
+mulhu s8 t0 t3
+mulhsu a4 x0 s0
+or s8 t1 x0
+srl s4 a0 t6
+or s4 s6 x0
+lui a5 945442
+addi s9 s7 -253
+sltu tp t6 s3
+sltu s0 s6 t4
+mulh a3 s11 a1
+or s4 s8 t2
+xori a5 s10 -94
+srl ra a7 t3
+xor t6 s8 ra
+sub s1 a6 ra
+slt t3 t3 t6
+mulh t2 s4 t4
+add t4 ra a5
+rem ra a7 s6
+andi a1 tp -1978
+mulhu a0 a3 s8
+add t1 t1 t0
+sltiu s6 a6 -296
+slli a3 t4 21
+sll t5 s6 a6
+srl s6 s0 s6
+sltu gp ra x0
+add s2 s1 a2
+sll s6 s4 ra
+mulhu s10 s11 a4
+srl ra tp t6
+srli ra a3 21
+slt t3 s10 s1
+sra x0 s5 s8
+ori a6 s8 165
+lui s11 282755
+mulh s5 t3 s11
+or s2 a6 a3
+srli a3 t0 26
+rem ra a6 a4
+add s11 t2 t4
+sltu a0 a6 a6
+sltiu t2 ra -1218
+srl t3 t6 s10
+add a2 ra a4
+slli t1 s9 18
+srli s1 s3 20
+sltiu a6 s8 -1181
+xor s10 a0 gp
+divu s4 s9 a1
+sub a1 s8 s10
+lui s7 111393
+slti a5 s3 617
+addi x0 s11 -1212
+andi tp tp -1498
+divu a7 t1 s9
+lui s8 857318
+andi a6 s1 644
+and a3 s11 s11
+mulh s7 tp s10
+add ra s10 t0
+xori a3 gp -438
+sll a5 s10 s6
+slt s6 t3 a4
+div s9 a7 t2
+sltu a3 t3 a6
+auipc tp 466737
+mulh s6 t0 s2
+rem s9 t1 a2
+remu s0 a5 s6
+sra a4 s5 s9
+sub s3 s1 ra
+mulhsu a3 a6 a7
+addi tp s1 -537
+slli t1 t2 21
+sub s6 a2 a7
+ori s5 s11 -421
+mulhu a5 x0 t5
+auipc t1 591551
+slt t6 s11 t6
+mulhsu a6 s0 ra
+mulh ra a0 s5
+and t0 a5 t6
+slli gp a5 27
+remu a6 a5 t4
+sltu x0 a3 gp
+and s10 s0 a4
+add s5 s3 a6
+slt s5 s4 s10
+srai ra t3 15
+addi s7 a0 890
+sra t4 s0 t1
+mulhu t0 s4 s6
+andi s1 s0 502
+divu a6 s9 a4
+mulhsu s5 t3 s7
+mul s8 t0 tp
+slti t1 s7 -1201
+divu x0 a4 t4
+xori s9 s2 -968
+sltiu a7 ra -1816
+srai gp t5 19
+mulh gp s3 gp
+sltu s10 s6 s1
+andi a0 a1 -1078
+mul s11 t6 s5
+ori s6 t5 -1251
+srli t4 t3 13
+sltiu a0 t6 -63
+mulhu s6 s3 a6
+addi a4 s6 -1363
+srl tp a5 x0
+sra s7 s11 s5
+div s3 tp s6
+slt s9 ra a6
+divu a3 s8 s8
+mul s1 s6 s3
+xori x0 s2 1319
+sub a1 tp a4
+mul t5 a6 a3
+or ra t1 tp
+sra x0 a7 t2
+auipc ra 417043
+lui a4 842888
+mul t4 t1 s3
+xori s3 tp 1789
+auipc s5 932512
+sltiu s5 s0 2028
+ori a1 s6 1434
+slt t0 s9 s1
+mul tp t1 s4
+srli ra ra 27
+srai t4 s4 13
+rem a0 a3 a2
+mulh a4 s0 a5
+sra s8 s6 s10
+or t3 a5 t2
+and s2 t2 t6
+auipc a5 322922
+addi s6 s6 -666
+andi s7 t5 -506
+srli a6 t2 7
+mulhu t4 t1 a6
+lui t2 751116
+sll t5 a7 s4
+slli a6 a7 14
+sub s4 s2 s6
+rem tp t2 ra
+ori t6 s0 -603
+divu a7 tp a6
+auipc s1 787509
+slli a2 s9 20
+sub s11 t0 x0
+addi s10 s8 -1346
+and gp tp t6
+and s6 a4 a7
+addi s10 a5 1754
+remu a7 t0 x0
+slli s10 s0 25
+srli t2 a6 25
+and s5 s1 t4
+andi s8 a0 -1734
+sra t4 t5 t4
+ori s10 x0 -1536
+remu gp t2 t2
+remu t5 s3 gp
+slti a4 a3 -1647
+mulh s5 a5 s6
+mulh t6 t5 s1
+sll tp tp tp
+ori s8 a0 -2044
+sltiu x0 t1 -1784
+auipc a1 404849
+addi t0 s6 342
+slt s9 t3 t0
+sub s1 s7 a5
+rem s4 t6 s0
+slli a1 t6 24
+sll a1 a7 t3
+slti a2 t3 673
+sltu a2 a6 s9
+sra s7 gp s10
+sll s5 s11 a6
+srli a0 a1 1
+add a5 ra s7
+ori s7 a0 -1726
+mul gp ra t3
+sub a0 s3 t3
+mulhsu a6 a6 t3
+div s8 a3 a0
+andi a5 a3 -1680
+add s2 s9 s3
+sll s10 x0 x0
+slli a0 t2 9
+slli tp tp 29
+mulhsu s10 s3 s2
+slt a6 s4 s10
+mulhu s10 s9 t2
+div x0 a1 s5
+remu s4 s0 s3
+andi t6 s10 -553
+ori a6 s9 273
+xori ra x0 -1221
+auipc x0 571017
+ori a4 t6 -679
+or s1 a3 s10
+srl t4 t5 a7
+ori gp s2 -257
+div a2 gp a6
+xori a3 a0 1385
+remu t1 a3 t5
+slli a4 ra 0
+remu gp s11 x0
+xor a7 t6 t5
+sll s9 a3 s6
+mulhsu a4 gp a1
+auipc t5 828554
+sltu s8 s3 t3
+mulh x0 s6 s7
+sll tp a4 a6
+sub t5 a3 s4
+sltiu gp s6 -345
+slli a0 t5 26
+mulhu a6 s11 s7
+sra s2 a6 a0
+andi s6 t0 -140
+srl s11 a3 a7
+sll a1 a3 s9
+xori a7 t6 -411
+slt t5 s9 a1
+sll s9 s3 ra
+srai s6 t1 19
+srli t6 t6 26
+rem t5 s3 t1
+srli t1 a0 23
+slt a3 ra a4
+sltu a0 s1 a7
+sltiu s8 t6 -1694
+sra s3 t1 s3
+and s7 s8 t2
+slti tp gp -445
+sll s5 s3 s0
+sra s11 x0 t3
+xor s10 tp s4
+auipc a1 168338
+ori s11 t3 -635
+divu a7 a5 a2
+div a6 a3 gp
+mul a4 a7 s0
+sub s5 s6 a3
+andi a2 s11 1860
+srli a5 a3 0
+andi s0 s1 54
+xor tp t6 a6
+slt s0 s5 t4
+auipc s2 115143
+sll s4 s0 s3
+and s8 s10 t3
+srl s6 s9 ra
+mul a1 t2 a1
+srl s11 ra a0
+sub gp t4 t6
+srl tp gp gp
+sll s9 s2 s3
+lui t1 182741
+add t5 a7 a0
+srai x0 s4 18
+xori t5 s6 -1640
+andi tp s10 1244
+sll a3 x0 a1
+sll t5 s9 x0
+divu t5 t1 x0
+sltu s7 a4 s6
+ori a6 s10 -380
+sra ra s0 a2
+auipc t3 630450
+mulh x0 x0 s6
+addi t1 t2 -1332
+add s4 s8 x0
+slti a6 a1 -1475
+slli a6 s4 4
+slli s9 t3 25
+lui a6 295074
+and t6 t2 s4
+ori t1 t4 1721
+lui t5 283000
+add s3 t4 s2
+mulhu t5 s5 t1
+ori tp s10 1552
+srli a4 s10 7
+or t4 a4 gp
+div t6 t0 t0
+ori tp t6 -1006
+xori s7 s0 416
+slti t3 t0 1701
+sltu a1 t2 x0
+mulhsu a0 s0 s10
+div a6 s9 s3
+mul a5 s8 t5
+srl s6 ra a6
+andi t3 s1 -860
+add t4 a2 t0
+div t1 a1 a2
+srl a1 x0 s5
+slti t1 s11 -1387
+mul s6 tp a5
+sltu a4 s7 s6
+lui a3 221024
+srli t2 a5 12
+or a7 s11 s6
+slli t1 gp 2
+ori tp a4 -1214
+mul t0 s2 ra
+addi a7 a7 -1123
+remu s0 s11 t5
+sll tp s4 t5
+ori t1 a0 -1182
+mulh tp a6 s8
+and ra t6 s2
+sll s5 a0 a1
+rem t6 t1 s9
+sltiu x0 a6 -1041
+sltu s2 a1 s4
+slt s5 x0 t2
+slli s6 t0 14
+slt s7 s3 t5
+ori a4 s7 -1967
+mulhu x0 gp s0
+auipc a4 959597
+sll t5 t1 s3
+slti a7 s1 -852
+lui t5 381924
+or gp t3 a2
+lui t2 716913
+sub tp a7 x0
+sltu a4 s4 gp
+sll a1 t1 s8
+sltu s8 s11 a4
+sra t3 a7 t2
+xor t0 tp a4
+srai s9 gp 28
+sltiu s0 s2 -1089
+div t2 t1 s6
+srli x0 s9 10
+remu ra s11 a1
+sltu s9 s6 s5
+sltiu s11 s1 -1037
+and a6 t2 t4
+sltu a7 gp gp
+mulhsu gp a1 a6
+ori tp a2 -314
+addi t0 a1 1258
+slli ra s6 31
+mulhsu s5 t6 t0
+sltiu s0 s7 -298
+add gp s7 s7
+lui s9 901984
+add ra t0 a1
+srai ra x0 18
+mulhu t5 s8 x0
+mulhsu a6 tp s4
+and t5 a4 t3
+sub s2 s9 t4
+slt a2 s11 s8
+sltiu gp a2 1066
+div t0 s2 t4
+sll s4 t3 s3
+sltiu a6 a3 -1908
+lui s6 485266
+ori s1 s10 -342
+remu x0 a2 a4
+sltiu gp s7 1496
+remu s7 a2 s10
+sll gp a6 a3
+slli s1 t6 15
+div s8 s8 a7
+mul tp a5 s3
+sub t0 s1 t5
+remu a4 s5 x0
+rem a3 t2 s0
+slt a4 tp a0
+or t2 s1 s3
+ori s0 s5 -1113
+mul a1 s0 tp
+mulh t1 a5 s8
+mul s9 a2 a6
+srai s6 t5 0
+remu s9 s8 a4
+mulhsu x0 a1 s4
+sub s3 s1 a4
+remu x0 x0 s5
+andi t4 t4 1159
+xori t2 a3 1131
+srl t1 s4 gp
+slt gp s5 s2
+mulhu t5 a5 ra
+ori s7 a7 1789
+rem tp s9 a4
+slli s6 s0 15
+sub s5 t2 s11
+remu s4 a5 a4
+mulhsu t3 a1 a6
+remu ra ra tp
+divu s1 s5 s9
+mulh s6 t3 t2
+sltiu s3 s6 -696
+addi ra s6 1068
+sra t0 a6 s7
+xor gp s6 t1
+addi a7 gp -1612
+srl a6 t1 s0
+or s8 s7 gp
+sra s7 s8 tp
+srai a6 s4 9
+slti t6 a2 -1777
+andi a4 t6 271
+divu s1 s6 t0
+mulh s3 s10 a0
+slti t3 a4 -1397
+divu s3 s6 s11
+andi a0 s3 -1328
+and tp t3 s8
+sub s9 tp s8
+mulhsu x0 a3 t2
+rem t0 a0 s6
+remu s2 s10 t2
+sltu s5 gp t2
+sra s5 s2 a4
+or a6 ra s9
+divu gp s4 s6
+slt t5 t1 s10
+andi gp s7 -935
+sll t0 s9 s7
+slli gp a6 7
+andi ra t5 -438
+srl s5 s4 a4
+srai s0 s9 5
+slt t0 s6 tp
+lui t3 1034235
+divu s3 t4 s5
+slli s4 a7 16
+sub t4 x0 s11
+xor x0 t1 x0
+slt s10 a1 s8
+sub t5 s5 t4
+slli s4 s10 15
+auipc t4 522415
+sltu gp s11 s7
+rem t6 x0 t0
+mulhu t3 s10 a0
+andi s11 s5 -732
+sltiu s4 a1 -751
+and t5 a6 t4
+add s1 s9 a6
+ori a6 s4 1035
+xori t0 s1 1094
+divu s2 t1 a7
+remu t0 ra t4
+xor ra t5 s4
+sltiu a0 a6 -1216
+xor x0 s3 a3
+sll s11 a0 s5
+srai s3 tp 3
+sra s1 s8 a6
+srli tp s5 30
+xori gp a3 -1024
+div s3 s6 t1
+sra s4 t2 s8
+rem a2 tp a6
+mul s7 s5 a4
+div t0 s8 a2
+add s4 a3 s2
+srai x0 s9 15
+sub gp s0 t2
+mulhsu s4 x0 x0
+div t5 t6 s0
+srli s1 t5 7
+mulhsu ra a7 a1
+srl a6 s7 t5
+srai a7 t1 1
+ori x0 a4 -1345
+sra a0 x0 s7
+sub t5 a6 tp
+mulhu s3 a1 a0
+srli t1 tp 1
+sub a6 gp gp
+rem a5 s8 a6
+rem s2 t0 t6
+add a5 s5 t3
+rem t0 ra t5
+srli a7 a6 23
+mulhsu s5 gp s1
+srl s7 tp s4
+or a6 t1 a2
+sra s4 s7 s4
+sub s0 a2 s5
+lui s1 818994
+addi a4 s4 -107
+and a6 s1 s7
+xori t5 t2 -363
+mulhsu ra a7 s11
+slti s8 a5 -1165
+mulhu s7 t6 s10
 addi a0 x0 10
 ecall
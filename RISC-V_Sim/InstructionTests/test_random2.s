@@ -30,15 +30,15 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-sll t0 a1 a1
-mulh a0 s4 tp
-sltu s4 a1 x0
-add x0 s9 t1
-srl s7 s8 s9
-sll s8 t5 s0
-ori s11 s6 -180
-mulh a5 a6 s5
-mulh a0 s6 ra
-auipc s0 673652
+ori t4 t5 -1714
+sra a2 x0 s9
+divu a1 a1 s2
+sltiu s1 a7 -1718
+add s4 s6 a5
+divu s0 a3 s0
+sra t3 s3 t3
+remu t5 s5 a4
+mulh a2 a7 a0
+slli s10 gp 27
 addi a0 x0 10
 ecall
@@ -30,15 +30,15 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-or a2 s10 ra
-srli s0 s5 1
-mul t2 s0 s5
-lui s4 1013743
-sra a6 x0 a2
-and t4 a7 s5
-remu a2 t5 t3
-mul a7 a6 s3
-mulhu a1 tp x0
-srli t6 t3 19
+ori t4 s11 -217
+slti s11 s11 798
+xori s11 a5 -1471
+slli a2 t3 9
+xor s1 s2 t4
+sll s4 t6 s2
+divu s11 t1 t0
+slli t3 ra 9
+mulh s5 s8 gp
+mulhu s2 a5 a0
 addi a0 x0 10
 ecall
@@ -30,15 +30,15 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-mulhsu a3 t0 x0
-addi t3 a1 -463
-andi s10 a3 1791
-mulhu a0 s1 s10
-add s10 a0 a5
-rem t0 a0 t5
-divu s6 a4 s11
-sub t6 s4 x0
-xor t2 x0 x0
-sra a1 a1 a3
+srli s0 s8 21
+xori s4 gp 12
+auipc s8 546257
+div s0 s8 t2
+srl a5 t3 a2
+srl s8 s3 ra
+xor a5 s1 s5
+sra ra a5 s1
+rem t4 a5 s8
+addi s9 a7 1576
 addi a0 x0 10
 ecall
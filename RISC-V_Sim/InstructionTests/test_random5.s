@@ -30,15 +30,15 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-divu s3 s4 s5
-ori a7 a1 -1319
-add s9 s2 s10
-slti t3 s4 122
-sub a4 s8 x0
-addi ra s4 -747
-slti a6 s6 -538
-srl s7 x0 s7
-slti t0 a1 -1721
-add gp gp s9
+div a7 s4 a6
+sll t3 t3 t6
+div t3 t1 t2
+sra t2 a7 s11
+slli a1 s3 12
+and ra ra s11
+sra s6 a7 s0
+and s0 t0 a5
+lui gp 696382
+srl x0 a5 s2
 addi a0 x0 10
 ecall
@@ -30,105 +30,105 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-srli s4 t2 15
-divu a3 a0 s1
-add ra s2 t5
-ori x0 x0 -528
-srli t4 x0 24
-lui t5 498456
-divu t5 t4 s5
-mulh s6 s0 x0
-addi t6 gp 133
-sltu t0 a3 a2
-slli t0 s5 2
-xori t1 a5 1543
-sra s9 s7 gp
-divu a4 a4 t6
-rem s0 t2 s8
-divu t3 s7 x0
-auipc ra 82509
-ori s6 s8 -138
-sltu a6 s10 s7
-mulhsu s1 s4 s4
-mulh s7 a4 s2
-sll a4 s4 s10
-slli s6 s2 25
-or s1 t6 tp
-andi a3 t3 -85
-mul s1 ra a3
-xor s1 a7 t1
-or s0 s4 tp
-srai s1 s3 13
-or s4 s3 s1
-div s1 s0 a4
-slti s10 t2 -1832
-divu s9 x0 a1
-addi t2 s2 916
-remu s6 a6 a5
-mulh gp t2 t3
-xor x0 a1 gp
-srai x0 s10 10
-addi a6 s9 1961
-sub s1 s10 s5
-sltiu s0 s0 1705
-slti a2 s8 -2028
-add t1 s10 s3
-andi t6 s10 -250
-slt a3 a0 a1
-auipc t3 150406
-srli s6 x0 19
-slti a3 a6 -1724
-srli a5 s5 26
-add s10 s5 a5
-srli x0 s7 0
-sub a7 t4 a2
-addi a4 gp -358
-mul s5 t4 a0
-slt t4 s6 s8
-addi s2 t6 -149
-rem a7 s11 a1
-lui t3 353944
-or s2 s3 a7
-srai gp x0 29
-and s3 s4 s9
-remu a6 s4 s2
-sub t3 a6 t6
-slti a6 x0 -1806
-divu s11 t1 a0
-auipc t1 53330
-sltiu t1 t4 -904
-slti a5 a7 -1168
-rem a6 gp t1
-lui a5 390744
-and s6 a2 ra
-xor t4 s10 t2
-xori s7 ra 159
-remu t5 t5 a0
-divu s6 t3 s1
-rem t4 s11 s4
-sltu s1 a5 t6
-mulhsu a2 s7 x0
-or s10 gp x0
-ori s3 t4 -1969
-auipc s6 984249
-or s10 x0 a7
-srai t1 ra 9
-lui x0 990548
-xori s0 s5 -1485
-srli s9 gp 24
-sub a5 a6 a6
-mul a7 a3 ra
-div s6 s11 s5
-sltu s5 a4 a1
-andi a2 t4 -875
-or t2 s0 a6
-sltiu a5 t1 699
-slti a5 s0 -1647
-sll a0 s9 t0
-ori a2 x0 -877
-sub ra s10 s5
-rem s7 t1 ra
-srai a4 s8 4
-xor s7 a4 a0
+srli s7 a7 15
+add s9 s2 s2
+slti t2 t1 -1925
+mul t6 tp x0
+addi s4 s9 -369
+auipc a0 825536
+divu ra gp t3
+rem s4 s7 a2
+mul ra a3 s4
+srli x0 s7 20
+mulhu t0 a1 t0
+xor a0 s5 a1
+and s5 s3 tp
+mulhu a6 s3 s2
+mul t4 a3 t3
+remu a1 tp t6
+andi t4 t3 -815
+srli t4 a3 27
+rem s2 ra a6
+sra a5 s5 a5
+mulh a4 t1 a0
+andi s10 ra 1817
+auipc s2 567868
+auipc s4 550051
+sltiu s3 s9 -654
+slli s0 gp 10
+mulhu s9 t2 s5
+divu ra s7 a0
+srai t0 a1 6
+slt s0 a1 s4
+xori s5 gp 1926
+mulh a0 a1 t6
+addi ra t5 1049
+xor a1 a3 t0
+and gp t6 t3
+sltu s8 t5 x0
+lui t4 1008653
+remu s9 t0 ra
+sltu a3 a2 s8
+divu a1 t1 a5
+slli t3 s3 6
+srl a0 ra s3
+slli tp a5 10
+sll s0 s7 a1
+mul t2 a6 a4
+addi tp tp 1235
+auipc s9 645812
+xor t2 s0 a7
+srai s9 s0 24
+mul ra s10 t2
+mulh s11 ra s10
+lui t6 716596
+slli s8 t6 28
+rem tp s10 t1
+and t1 a2 a0
+mul s5 s10 x0
+mulh tp s7 a6
+slli gp a0 23
+slli gp s1 16
+ori a0 t4 -2046
+mul s10 t1 a0
+div s3 s4 a3
+mulhsu s1 a5 s1
+remu s5 a2 a3
+sub s4 t3 t1
+div s2 a0 t2
+mulhu t5 a0 a2
+auipc t1 598770
+addi a7 s2 1025
+divu a2 gp gp
+ori tp s11 813
+sltiu s9 ra 1743
+srl a0 s1 t4
+lui t0 513919
+or tp t3 s1
+srl s6 t6 s10
+sll a5 s2 x0
+mulhsu t4 ra s8
+sltu gp a7 s5
+add t5 a1 a7
+slt t3 s10 gp
+remu x0 a4 a1
+mulhsu tp s6 t6
+sltu a7 a5 a0
+xori a1 s7 -836
+lui s0 413090
+xori a3 ra -1195
+rem s0 s10 s1
+add s9 s5 s3
+andi a4 t1 -1226
+add a5 a6 ra
+mul s1 tp t6
+mulh s6 s9 a4
+andi ra s2 414
+addi gp t0 -1538
+mulhu a6 s10 t6
+srai x0 a5 15
+rem a4 t5 a5
+add s7 t6 a3
+mulhsu x0 t0 t0
 addi a0 x0 10
 ecall
@@ -30,105 +30,105 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-sll s9 t3 s4
-div a7 a0 t1
-sll s10 s9 s6
-sra t0 t6 a2
-slt a6 s4 s3
-div s2 s11 x0
-xor s10 s9 t0
-sltiu s5 s7 1187
-xor a4 t1 s5
-srl a4 ra s4
-mul ra a1 s10
-slli s11 a4 21
-srl s3 t1 a2
-srli a1 s8 31
-and t3 s11 t0
-sra s9 t5 a2
-sub s2 a3 a6
-divu s3 a5 a1
-srl t4 t2 tp
-or s2 t0 t3
-sub a2 a2 s11
-sltu a2 a7 t3
-sub t0 s10 s11
-auipc tp 315812
-mul s2 s3 a6
-srl a3 s5 s9
-ori t5 t1 -714
-sub t4 s8 a1
-sltu s1 a7 a0
-slti s8 t1 -1424
-mulhsu x0 t0 s10
-mulhsu s11 t1 s0
-mul s7 x0 t5
-and s9 x0 s5
-div t0 s10 t5
-add s3 s10 t5
-srl t6 s10 t2
-mulh s6 x0 s1
-ori t3 s5 -1973
-mul gp s10 s6
-slli a1 s0 17
-remu tp s10 s10
-mulhu s5 t0 a0
-srai s8 a1 1
-ori a6 s7 -1436
-sub ra t0 s0
-slli a7 s8 5
-div s4 a3 s11
-add s7 s9 a6
-auipc a5 279545
-srai s0 t2 11
-sll t1 t6 s0
-add s2 t2 t3
-srai s5 tp 4
-mul a0 s5 a7
-slt t4 t6 s11
-srli a3 t1 13
-div s2 a0 s11
-sltu s10 s1 a3
-andi s5 a5 1285
-mul t1 a4 a0
-divu t1 tp s8
-div s5 s6 t6
-mulh t1 t6 s0
-xor s8 t0 t6
-slti a6 tp -1039
-slt s8 t1 s3
-sra t3 gp s6
-srai s3 a3 19
-auipc s7 1029069
-div a2 a0 t6
-or a1 s4 t2
-slli x0 a1 29
-lui a6 885347
-sra t5 gp s6
-xor s10 a4 t5
-sra gp a5 s11
-mulh t3 gp a3
-srai gp a2 19
-lui t6 126660
-lui t4 918844
-sub t0 x0 t0
-mulhu a5 a5 tp
-addi t4 t0 -873
-mul s8 s0 s7
-srai a5 a0 27
-remu a0 a5 ra
-lui a2 582072
-slli ra a6 30
-srli t0 a7 0
-rem a3 t0 s8
-sra s3 t6 t6
-div s10 a0 t4
-and s5 t0 t5
-and a3 a3 s5
-div x0 a4 a1
-ori a1 a1 1725
-rem s9 ra t0
-divu a3 s1 a4
-or a3 s4 t3
+add t0 t2 a5
+div t3 t5 s3
+sll t6 s4 ra
+div a5 a4 a6
+sra a6 a6 s11
+xor a6 s10 a0
+remu s4 s3 s3
+srai a0 t3 7
+mulhu t5 s0 tp
+srl t6 t0 ra
+add s11 t0 a0
+srli a1 s11 8
+mul s2 s8 t1
+divu s10 ra s4
+srl s9 t1 ra
+srli s9 t5 14
+sub s1 gp t4
+sll s1 s3 s2
+srl s1 t5 a7
+remu s11 t6 s9
+slti s10 a0 -1317
+sltu t2 s2 s9
+mulhu gp a2 gp
+slt t1 gp a2
+sll s5 s9 a3
+sub t1 s5 s10
+lui a7 115415
+mulh a3 a3 a3
+auipc a5 882240
+xor s5 s0 s5
+div s7 ra t6
+mulh a3 t4 t6
+div a0 s11 s4
+sll tp s3 s4
+sub s1 a6 tp
+sltu s3 x0 s8
+auipc s8 116481
+and gp s9 a4
+sub a2 s10 x0
+div a0 a3 t6
+mulhsu t0 ra s7
+mulhsu a3 s4 t4
+xor s9 a4 a0
+rem t2 tp s7
+rem tp tp x0
+slt s8 tp a0
+divu s2 a4 a7
+mulhsu t2 s8 a3
+mulh tp s6 tp
+andi a4 s10 1781
+mulhsu a7 a2 a6
+mulhsu t5 a7 tp
+lui s6 140992
+or a7 t3 s4
+srai tp a2 8
+mulhsu a6 t0 t1
+sub s11 s6 s9
+sltiu s2 t1 -1572
+mulhsu t5 a1 a7
+xor t4 s7 a6
+srai x0 s5 30
+auipc s9 886397
+sub a5 s0 s7
+add s0 a1 ra
+mulhsu t2 s11 s1
+xor s6 a2 s5
+addi s3 t5 -485
+andi s1 a1 -1720
+addi a4 s4 -577
+andi gp s3 -1629
+sll s10 gp a6
+rem t4 s9 a6
+mulhu t3 a6 ra
+mulh t4 t0 s8
+lui a0 114058
+remu s2 t6 t3
+sltu s4 s11 tp
+remu ra a2 a6
+mulhsu s8 t0 s0
+add t5 a4 a6
+mulh s8 t5 a6
+rem s5 s5 a1
+ori s9 a4 -1849
+auipc a3 432671
+add s11 t3 tp
+add a5 tp s11
+sra t0 a4 tp
+sltu s11 s3 s9
+add a7 a0 s0
+srai s7 s6 30
+srl t6 s2 s5
+mulh tp t1 t4
+divu t6 t3 s11
+lui a7 349365
+sra s6 t0 t2
+sltu s4 a0 a6
+remu t2 s8 a2
+sll t5 a6 a1
+sub t6 a5 s8
+remu s8 a0 s6
 addi a0 x0 10
 ecall
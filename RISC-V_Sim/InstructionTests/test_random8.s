@@ -30,105 +30,105 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-lui s10 402059
-ori t0 a2 -807
-lui tp 889888
-sltiu a2 gp -1912
-add gp a1 s9
-slti s11 s2 -1514
-srai s11 s5 22
-mulhsu ra t5 t0
-mulh t3 s1 s3
-auipc s11 898685
-mulh t5 t2 s6
-div t0 a2 t6
-or a7 t1 s6
-sra s7 s7 a2
-slli t4 s3 11
-remu s7 s4 t4
-rem a1 x0 s7
-slti a6 a2 -1402
-mulh ra a2 t6
-or s1 s0 a4
-xor x0 x0 t1
-andi gp t3 -279
-mulhsu t5 tp s2
-xor s8 a6 a1
-xori s5 t3 -1490
-slli a1 a0 15
-slli t4 s9 4
-srai tp s10 21
-xor s4 a5 s9
-sra s5 gp a0
-mulhu gp a1 s1
-srai a1 s8 5
-mulh s2 s7 s1
-and t5 s7 s9
-divu tp s6 s0
-xori a1 tp 639
-add t4 s8 gp
-mulhsu s1 s10 s8
-ori t0 a1 -1287
-sub s11 t0 s7
-and tp tp a4
-srl a6 a3 gp
-sltu x0 t4 s1
-xor a3 s9 s1
-sub gp s4 s6
-srli s0 a6 28
-addi s10 x0 419
-remu s10 s4 a1
-addi a5 t6 -102
-ori t1 t4 -470
-div tp s7 a1
-rem a3 x0 a6
-mul gp t5 s11
-or x0 s10 tp
-srli x0 a5 1
-sra a5 tp t3
-ori s4 t6 -1037
-divu a0 s3 a5
-xori ra s5 1822
-mulhu a7 a6 t6
-divu a5 a1 t1
-xor a3 tp a6
-sltiu a6 t2 1196
-divu a6 s9 a7
-lui a1 635302
-sll t1 s11 ra
-sltiu a3 t5 -1373
-mulh gp t0 t0
-slt ra ra s11
-slti s6 s1 -1467
-remu x0 a5 gp
-div t3 s1 tp
-rem s5 a1 t0
-andi s10 t5 -1411
-mulhu a6 s2 a4
-lui s3 284820
-div s11 s6 gp
-ori s2 s10 1118
-add a2 s10 s2
-ori s4 t6 -1689
-div t0 t3 a3
-xor t4 a6 s11
-sltu ra a4 a7
-mulhu a7 ra t6
-and a2 a6 a2
-add gp x0 s8
-sltiu s2 s4 1390
-addi a5 a4 -1006
-mulhsu s11 s0 a4
-sub s1 s5 t1
-rem x0 a1 s6
-divu t4 t5 x0
-auipc s3 428329
-add t4 t6 gp
-divu t0 tp s5
-mulh s11 a4 s6
-sltiu s7 a0 -449
-sltiu a1 s10 -303
-sra t4 t1 x0
-srli s4 t2 21
+srl t6 s1 t6
+and s4 a5 s2
+lui a4 1001231
+or a4 s11 a4
+and x0 ra s5
+slt s8 a2 a0
+slti s5 t6 -140
+andi s8 s5 600
+auipc ra 1041749
+sltiu gp a3 -1360
+sub a2 a7 s8
+remu s1 a6 s1
+div s0 t5 tp
+xor t3 t6 a0
+slti a3 a1 -2028
+sub s5 s5 t1
+mulh a7 a0 s7
+ori s11 s6 -413
+sub s9 s2 s0
+lui a3 975099
+divu gp t4 s2
+sub s0 tp s7
+srli a6 s8 22
+lui ra 450748
+mulhu s1 a0 s2
+andi s8 s4 1120
+andi a1 t3 -716
+or a1 x0 t6
+sra s11 tp a3
+andi s8 s6 -1568
+and s7 a0 s6
+andi ra s4 -155
+auipc tp 234925
+sub s10 a3 a0
+sltu t1 a4 a0
+rem t2 s6 t6
+sll s3 a6 a5
+auipc t4 652600
+srli s4 a6 1
+or s2 t1 s11
+srai ra gp 0
+and t5 t6 a0
+and a3 t4 s3
+and a3 s2 s1
+mulh s11 x0 a0
+remu s3 s8 t6
+xori a0 a6 -1031
+xor t5 s6 x0
+sll a0 t0 t1
+xori tp s9 153
+mulhsu t5 t3 ra
+and t4 s8 s1
+mulhu t3 s11 a0
+mul t6 tp t6
+sra t4 t1 a7
+srl t1 a2 t1
+srl t0 a4 ra
+div t3 s3 a6
+sub s3 s2 t5
+sll a4 s2 a4
+divu s3 t2 a5
+sltiu s2 a5 -1557
+andi s2 t3 -125
+sra t5 a7 t2
+addi a7 a7 -279
+mulhu x0 s1 s7
+sltu t0 a5 a6
+mul t0 a4 s7
+div a1 x0 a3
+srl a5 a4 s8
+and t3 t3 s11
+mulhu s8 a5 a5
+add t1 t3 a4
+sltu s3 a3 a2
+rem a2 a6 a0
+slt t0 gp s8
+addi a2 s0 -1919
+sra a3 a4 t5
+ori ra t5 -218
+or x0 s1 t3
+mul a3 ra a6
+sra s2 s2 s8
+xori t1 t4 -1843
+and tp a6 s11
+sra s10 a2 a2
+ori a4 s7 -1317
+xor s7 t4 a7
+slli t0 s6 15
+lui s8 867850
+andi ra s1 -907
+or a6 x0 a0
+xori t5 s5 -301
+sltu a7 s10 s5
+auipc a6 497157
+slt t6 s4 a3
+srai gp s0 19
+remu a7 a6 t1
+lui s1 238273
+rem ra s1 s0
+slt a2 s8 s10
 addi a0 x0 10
 ecall
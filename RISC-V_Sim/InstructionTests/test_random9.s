@@ -30,10005 +30,10005 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-mulh t5 t2 tp
-sub t6 s8 t2
-sra s7 tp s7
-slti s5 t0 -724
-sltiu a3 a3 -1034
-addi s8 t5 -658
-divu t2 x0 s0
-sltiu ra x0 1504
-lui a0 790410
-divu s1 a0 s4
-xor t3 a5 s3
-andi s7 x0 -1537
-mulh a6 s0 t2
-xori t6 ra -1581
-slli s1 a2 20
-mulhsu ra t5 a2
-addi s6 a0 1465
-sub s1 t2 s7
-sltu a6 a1 s5
-srl t3 t1 x0
-xor a0 t2 s9
-slt s0 s5 s8
-sltu s11 t3 ra
-div t5 a3 t3
-slt a3 s2 s10
-mul s6 s8 s7
-srai tp a4 11
-slli t4 a7 21
-slli a7 x0 2
-srai s8 s2 18
-sltiu t4 s11 134
-ori s2 s6 -1158
-slt t4 a1 a5
-sll s2 a1 s5
-mulh s5 a1 s11
-srl s1 s2 a2
-auipc t3 920316
-slti a0 a0 -54
-sll a2 gp t1
-add x0 s8 s10
-sub x0 s11 t4
-lui s1 640330
-sra s9 s1 s0
-or t2 t2 t5
-or s10 s11 ra
-auipc a7 318445
-srl s9 s11 s11
-xori x0 a7 -1588
-div s7 a0 s1
-srl a7 a5 tp
-sub s5 t6 t1
-sra t0 s9 s1
-lui t0 116190
-mulhu s4 s2 t3
-sltiu t0 a7 1173
-add a4 tp tp
-sra tp a1 gp
-xor a7 t6 x0
-mulhu a7 s11 s8
-srai s11 x0 23
-add t0 x0 t2
-add s10 t1 s8
-srl s7 a2 s11
-and s3 t2 a3
-sub s4 a3 t4
-srli a0 s6 27
-mulhsu tp s10 x0
-addi x0 s4 1620
-sll a5 a4 a4
-srli s10 gp 31
-andi t0 t1 338
-mulhu s4 a4 t4
-lui s8 727037
-xor s6 s10 gp
-slli t5 s4 25
-divu a3 s0 ra
-srli a5 a1 31
-rem s4 s3 t6
-ori s11 a0 -642
-xor t4 a6 a3
-add s6 x0 s1
-srl s6 s2 s1
-sub a6 t6 a3
-srl ra x0 t5
-lui s5 207290
-auipc s10 290671
-or s8 a5 x0
-mulhu t2 t2 x0
-xori a4 t4 497
-slli s9 a0 28
-lui a1 362597
-and a2 x0 s1
-sub s7 s11 a4
-srli a0 s10 18
-srli x0 s5 12
-lui s5 910473
-srl gp s8 s9
-slt t6 t6 a2
-slti tp ra -217
-mulhu s8 x0 s8
-and s3 a6 s8
-srai s11 tp 4
-divu a2 t1 s6
-sltiu gp a5 -614
-and t0 s0 a3
-rem a4 a0 s2
-mulhsu a1 t5 s3
-remu s9 x0 s2
-slti a4 a4 -636
-addi a6 ra -1165
-lui x0 661045
-xori tp a4 711
-ori x0 tp -903
-sltu s10 a0 gp
-mulhu t2 s3 s4
-srli s0 s8 15
-srl x0 s5 t3
-add t3 s11 s8
-srai s7 t3 7
-addi s9 a7 -1174
-add s5 tp t5
-sra gp t4 s2
-mulhu s0 x0 a0
-addi s9 s10 -1957
-xor s0 t2 t3
-auipc x0 93065
-mul s11 s5 a7
-mulhsu s6 s6 ra
-add s8 s6 a2
-sltiu s7 a2 1927
-sub t1 s5 x0
-mulhsu a2 s7 a0
-sll s4 a4 ra
-slli x0 s4 0
-sltiu s5 t0 -1668
-andi s1 t5 -1177
-mulhsu s9 t0 s9
-or t5 a3 s4
-slli s4 a6 13
-sub t0 x0 a3
-auipc a6 264959
-add gp a7 t3
-auipc s7 733085
-andi s5 a2 -1975
-auipc a5 753758
-slti s9 s10 -1685
-sltiu t4 s10 -1628
-slli s4 t5 2
-mulh a5 t5 t5
-addi s6 a7 197
-addi t6 t3 -1793
-lui s5 102893
-or t6 s4 a5
-auipc a2 32889
-andi s3 t5 222
-ori tp s7 344
-slli gp s6 29
-or a6 tp s1
-slti t3 gp 509
-srai s3 t6 22
-mulhu s6 t2 s3
-sltu t1 s1 s9
-sltiu t3 ra -1979
-slli s4 t1 25
-ori gp s9 -306
-mulhsu a1 t5 s5
-remu s11 s10 s11
-add s4 ra t4
-xor s4 t4 ra
-sub x0 a3 x0
-xor a3 t1 s3
-sltiu s8 s0 -151
-addi s7 s10 -470
-sltu a6 a4 s0
-sltiu tp t6 942
-divu ra x0 gp
-xor s10 s6 a7
-addi s10 s11 -405
-ori gp s10 1922
-xori s1 s10 -1491
-divu a5 x0 s7
-rem t3 a4 s8
-sltiu a5 t0 137
-rem t0 s1 t4
-slli s10 s2 7
-mulhu s5 s2 a2
-srai s9 s8 8
-or s5 a4 s10
-srl a3 x0 x0
-and t0 x0 s10
-div a1 t2 a7
-div a2 s11 s2
-lui a0 540922
-sra s1 t0 s8
-srl t1 s6 s10
-add s10 s5 x0
-mul s5 s6 s5
-mulhu s8 s8 s5
-slti t0 tp -1641
-ori s7 s10 -1891
-mul s1 s9 t1
-remu t0 a4 s1
-slli s4 a3 4
-add s7 ra a7
-sra a6 ra a1
-srai s5 a1 1
-or t0 tp t2
-mulhsu t2 t2 s1
-divu a1 a1 a6
-auipc a0 41627
-mulhu a5 s2 t5
-xori s2 t4 -1178
-or s0 x0 s1
-auipc a4 368990
-slli s11 t3 7
-mulh a7 a7 a7
-sltu t1 t3 tp
-sltu a4 s3 t2
-addi a2 s5 -1291
-slli gp a5 2
-slli t0 t6 10
-ori a6 a2 1748
-remu tp a0 s7
-sra a6 gp t3
-auipc t4 126421
-slt a0 s4 a1
-div a3 t5 a5
-xori gp t2 703
-andi s4 x0 -293
-div tp t5 t3
-ori s3 s11 101
-div a4 s3 s5
-mulhu a2 a4 s8
-addi tp s9 -948
-lui a3 317912
-remu a0 s8 s4
-slli a5 a6 10
-srl s9 s2 a5
-slli s6 s7 30
-sll s2 t1 t1
-mulh t0 t0 s4
-slt t1 s0 a4
-remu ra t6 a4
-srl gp a6 a4
-sub a4 x0 x0
-and t1 s3 a4
-mul x0 s2 t4
-mulh s4 a1 s0
-auipc t4 653833
-srli x0 t3 24
-ori a1 s0 -92
-add a6 a2 s6
-srai a1 a2 0
-slti x0 t3 -716
-sll s9 tp t1
-mulhsu s2 s4 a6
-or tp t5 s1
-addi a2 ra 1966
-mul t6 s1 a6
-sra t2 a3 s0
-srl tp s5 a2
-srli gp s0 19
-sll s3 s11 s1
-ori s11 s3 673
-add a1 t2 t6
-mul s11 a1 s11
-xor t2 s0 t3
-srai ra a7 0
-sll a0 s2 t3
-addi tp s6 -232
-and a1 s1 a2
-remu t6 s8 x0
-srai ra t1 31
-xori s3 a2 -1124
-divu gp t3 s3
-auipc t5 685622
-xor t5 s8 t0
-mulh s1 a6 t4
-or t3 x0 s5
-xor a1 t4 s2
-xori a5 gp -970
-ori s8 s3 -1579
-and s9 t5 t2
-add s4 a1 t4
-divu t5 t2 s5
-rem t5 s5 t5
-addi tp a1 9
-mulhsu t6 s1 s0
-sltu s1 s8 ra
-slli a0 gp 29
-addi s11 a0 1236
-div s10 t4 s3
-sub a1 a4 s8
-div t2 x0 s4
-remu a7 t5 t3
-auipc t1 137251
-andi s3 s5 47
-slt tp a7 s7
-srai a3 t6 17
-and t6 s2 ra
-mulh a0 a0 a4
-xori t3 s11 -1480
-sltiu a5 tp -1961
-sltiu s4 s2 854
-sra a3 x0 t3
-lui s11 677405
-srli s11 a0 1
-div tp t6 t1
-xor t4 t0 a4
-xor t0 a4 a6
-remu t4 t6 s10
-srl a0 s4 s8
-mul a2 s10 s6
-andi s1 s9 -1726
-xori t5 ra 47
-sltu s6 t2 t4
-srli s9 s1 22
-or s3 t2 x0
-sub a6 t5 a3
-divu s7 s2 s3
-mulh x0 a6 t5
-add t3 s10 a7
-mulhu s8 a3 s8
-srli s5 a5 26
-sltiu a2 a2 -2036
-srai x0 s8 23
-slt a2 t2 a5
-srai t6 a6 14
-slt a7 t6 s9
-sub t0 s1 s7
-slt s2 gp s6
-rem s3 t6 ra
-sub s9 a7 s0
-or gp s4 s6
-and s6 ra a2
-mulhsu s7 s3 t5
-div t1 s5 t4
-xori t3 a3 -546
-sub x0 s4 t2
-remu tp s7 s9
-srl a4 s3 t0
-sll t3 a3 s3
-andi a6 s11 413
-or a5 s2 s5
-andi a4 s0 -793
-slli t4 s1 24
-add s3 a6 s8
-ori t2 a2 1101
-xor t5 a1 s8
-or t5 s10 t3
-srai x0 s11 15
-srl ra a7 s0
-sll s6 s11 a2
-sub s8 s6 x0
-ori s3 t6 -1835
-mulhu ra s9 gp
-mulhu t3 a0 x0
-sltu a7 a1 tp
-sltiu s10 x0 1413
-xor s3 s6 gp
-xori s8 a4 -1622
-auipc t6 923005
-srli t0 a6 19
-sltiu a4 t0 -826
-and t0 s11 s3
-divu s6 tp a7
-andi tp gp -845
-mulhu t2 s1 a5
-sltiu a1 t0 -1069
-divu s1 t5 t5
-divu s4 gp s10
-slti tp s6 -1373
-slt a1 s10 s0
-sub ra gp a0
-lui gp 473298
-auipc x0 174340
-or t3 t6 x0
-or s6 t4 s6
-or s7 t2 a1
-xori a4 a4 -537
-div a1 t3 s7
-sra s8 t0 t4
-ori s4 x0 -1652
-sra t3 a4 s11
-sltu s1 s1 s3
-sltiu t0 a2 -975
-slti s8 a1 269
-auipc a6 101568
-xor a7 s5 s4
-auipc a0 538183
-auipc ra 714888
-sltiu s10 s0 1170
-slli t5 s6 0
-add t4 a6 t1
-andi a2 s1 674
-remu a6 a5 a1
-xori s6 s4 -924
-ori s0 s10 -944
-mulhu s4 s1 t3
-sltiu s9 s9 -688
-slti s6 t1 -37
-mul a7 t2 s6
-sra a5 s11 a0
-mulhsu s7 a2 s5
-xor x0 s6 x0
-divu s0 s6 t5
-ori a0 t0 -408
-slt s11 a5 x0
-sub s6 t5 s11
-xor t0 s8 s11
-srl a6 a2 a7
-div a6 s5 s11
-rem s7 a2 a0
-sll ra a7 t2
-div s3 s8 s11
-sltu s9 s2 t3
-srli a3 ra 17
-slt s7 t5 s11
-mulh s8 x0 t0
-ori x0 s6 -370
-sltu s11 s11 s10
-sltu s7 a0 a2
-add a0 x0 a3
-sub s4 s5 s6
-xor t6 t0 s3
-mulh s5 t1 s5
-sltiu s1 s1 -1396
-auipc s2 971578
-sltiu ra s4 -717
-rem s7 a1 s6
-rem s4 a6 t3
-slti gp a6 1914
-add a5 t5 s6
-remu a0 t1 s4
-divu s7 s9 t0
-remu a5 a3 s4
-slt t6 t3 a6
-and a3 a5 x0
-div s2 a7 s0
-sra s5 t5 s8
-div a3 s1 a5
-divu s7 a3 t6
-and a1 a3 s8
-mulhsu t5 ra a7
-slli t4 ra 8
-slli a5 s1 4
-xor s3 a5 a2
-and s5 t2 t0
-srli gp a2 28
-div s9 s0 s2
-slli s6 a6 30
-add t4 s6 t0
-sll s6 a0 a5
-srl x0 a5 s10
-or a3 s10 a2
-mul s4 t1 s9
-rem a1 a0 s3
-slli s2 s10 25
-slli s11 s11 29
-mulhsu t6 s0 s10
-addi s8 t0 -1964
-add a3 t6 t1
-or t0 t2 t2
-slt t5 t1 s0
-ori t1 s11 -643
-mulh a0 ra t3
-mulhsu t3 ra a5
-mulhsu s9 s5 t6
-divu a5 t2 t1
-lui s10 33
-ori gp x0 -1283
-remu s9 a3 a0
-addi t4 s4 -33
-mul s3 tp t2
-ori s8 a3 -1698
-mulhsu s6 s10 s0
-xor a5 tp a6
-rem x0 a2 t0
-auipc tp 217315
-sub a4 s6 a6
-mul t2 t3 ra
-and s9 t1 s5
-or s4 gp t2
-lui s3 973763
-ori s0 ra 2040
-and gp ra s1
-srli t5 a3 17
-div s8 s10 a0
-auipc t4 205190
-srl a0 a2 ra
-sltu tp ra t2
-mulh a7 t2 s3
-divu t0 s5 ra
-ori t3 a7 368
-srai s3 s3 24
-mulh a5 t2 a2
-srli t6 s2 21
-slt s5 a5 a6
-and t3 t4 ra
-sub t0 a7 a7
-add s2 a3 a4
-sra tp a4 tp
-sub a5 a7 s10
-slt s9 s3 s9
-srli s10 s3 1
-sra a0 t5 t6
-slti tp t1 1701
-rem s9 x0 s4
-srai s11 s5 9
-mulhu a6 s9 t3
-or s9 a4 x0
-mul s7 s3 a2
-div t6 a4 s9
-auipc t3 469571
-ori t0 x0 244
-srli t6 t4 3
-rem t6 x0 t1
-srli s1 t5 9
-lui a3 9105
-xori t1 t2 1078
-sub s1 t0 s11
-sltu a2 a4 t0
-mulhu a7 s8 a5
-xori a4 s1 960
-mulh a4 s11 t4
-and t6 a5 s7
-sltiu s7 s1 -1661
-addi gp t2 -1739
-srai t2 s5 18
-rem a7 t2 t1
-xori s4 s2 1521
-ori s5 t3 -948
-srl s10 a1 s8
-srl t5 t2 s11
-sra tp a4 x0
-divu s1 t3 a2
-mulh s0 s4 t1
-xor a2 x0 ra
-xori s8 a3 642
-mulhu a2 a3 a5
-srl s6 s1 s11
-lui s0 650992
-sll a4 t4 s9
-srl t1 s1 s2
-sltiu a2 s2 1578
-sltu gp a2 t1
-andi t6 t4 -1391
-and s3 t5 s2
-sll s2 t2 a2
-lui a6 51308
-slli t1 s8 14
-sub t6 a6 a7
-div s11 a4 a6
-mulh t4 t0 t5
-mulhsu gp t1 s9
-remu s3 s5 a4
-slt a5 t3 tp
-mulh s11 s11 a6
-add s5 s8 s8
-andi a3 s3 -399
-ori x0 s8 -645
-div t3 t1 a4
-xori a3 a1 -525
-sltiu a4 t5 -588
-mulh t4 a7 a0
-lui s9 209309
-slt s10 s9 t2
-add s4 t0 t1
-or t6 s3 s6
-remu t5 t6 t2
-srli tp t5 21
-srl a1 t1 a5
-slti t4 a3 -494
-rem t4 t4 tp
-slt tp s11 a1
-mulh s11 s5 tp
-lui s6 604627
-srai gp s0 30
-and a0 t6 s4
-slt ra a4 gp
-srl t0 s1 t6
-rem s10 s4 ra
-auipc s11 306672
-div s7 s4 s11
-rem a0 a5 s0
-srai a1 s10 4
-rem s5 s1 s8
-andi t0 a6 -1511
-srl s1 s7 t5
-ori s9 t1 -319
-sltiu x0 s6 -903
-div s10 s1 s10
-lui a1 210870
-sra s11 s2 ra
-add a6 t0 a5
-or s2 t1 t4
-andi a3 t3 156
-addi t1 t4 -394
-remu t3 a5 t1
-remu s6 a1 s9
-lui t4 101606
-rem a0 a7 a6
-mulh t2 t1 s7
-mulhsu t2 t6 gp
-andi s4 s3 -1526
-addi s1 ra -1050
-sub t3 s5 s5
-slti t6 a0 1235
-andi s3 t2 -839
-srli t5 t2 3
-sub a3 s11 tp
-srli ra t2 0
-xor s11 ra a1
-mulhsu s3 t2 a1
-mulhu s8 s8 s9
-div t5 s6 a4
-div s2 s3 t5
-div s6 s8 s1
-sltu gp a7 gp
-andi s5 t4 -1264
-rem t4 s7 x0
-xor ra t2 s10
-slt s5 a6 s8
-div s9 t0 s3
-ori s7 t5 -401
-srl s7 a6 s5
-sra s8 t6 s8
-sltu s2 t5 s6
-div s6 a2 a2
-rem t5 s4 s0
-mulhsu t6 a2 s3
-div t1 t2 s9
-sltiu s3 t0 1797
-ori a5 a2 592
-mulh s3 s2 t4
-slli s5 a1 23
-slti a5 t4 -612
-sltiu t0 t3 1380
-xori s0 s4 1584
-sltu t6 a6 a0
-mul s4 s2 s6
-sll a6 a4 tp
-srl a6 t0 t5
-srli x0 t3 16
-srai s3 gp 13
-auipc a2 474264
-srai s9 s5 31
-xori a4 t3 -510
-remu t0 a7 tp
-xori a7 t2 -362
-addi x0 s9 -1189
-sub a0 x0 s9
-remu s4 a2 s5
-sra t6 ra a4
-srai t6 x0 15
-xori s0 ra -906
-sltu s2 t4 a3
-lui s7 749388
-andi t4 t6 1952
-div a4 t4 s10
-slt a5 s11 t6
-xori gp ra -87
-or s7 s1 a7
-srl t0 a4 s11
-srl t4 s0 s5
-rem s2 s9 x0
-lui t5 272053
-mulhu t3 a6 s4
-add gp t3 s6
-sll s3 s5 a3
-and s8 s0 t6
-mul s6 s4 tp
-sub s5 a0 s2
-slt s5 t0 s7
-sub s2 s10 a1
-srai a2 tp 9
-mulhsu ra a4 s6
-mulhsu a2 s2 s6
-remu s5 a6 s7
-slli s7 s0 14
-srl a0 t5 s5
-auipc a2 38443
-sltu s9 t6 a7
-add s4 s3 s4
-sra t4 tp t4
-andi ra gp -1808
-srai t2 s4 0
-addi a3 s5 -1806
-divu s8 s5 s2
-srli s8 s9 11
-rem s11 s8 s11
-srai s8 t5 15
-srl x0 s8 a7
-andi s7 s2 1973
-ori s9 s7 -1688
-sra ra a4 x0
-add t5 s0 s6
-slt s2 s6 s11
-remu s4 s8 s4
-rem a3 a0 t5
-divu t1 a4 s3
-slt a4 s0 gp
-remu s3 a2 gp
-andi t4 a4 1857
-mulh t4 t5 gp
-slti a4 s9 -1745
-rem s6 s11 a7
-add s8 a7 s6
-srli a0 s1 13
-auipc a3 93176
-lui s6 265600
-or t4 s5 s4
-mulhsu s8 t3 s5
-and t0 a6 s4
-mulhsu a1 a0 a2
-andi s1 gp -1584
-ori a1 a7 -1252
-sra a3 s7 gp
-remu t6 s10 s5
-mulh t6 t4 s11
-divu s4 s7 a5
-sub t0 a1 s6
-slti s1 t3 758
-ori t5 t0 -1789
-sll s9 s6 s10
-auipc a0 472661
-slti x0 x0 -508
-remu s6 gp x0
-auipc ra 282079
-divu a5 t2 s8
-andi t0 a4 -1566
-addi a6 t5 -1693
-sltu tp a3 t6
-ori a4 s4 -1663
-mulh s8 a2 s9
-auipc s0 396107
-ori s0 ra -1768
-srai a2 s1 27
-mulh t4 s4 a3
-ori s9 a6 -562
-auipc s7 77120
-mul t6 s6 s3
-add a2 ra s6
-sll a1 a7 t0
-slli s2 s1 3
-sltiu a4 x0 -813
-and s0 s2 gp
-sltiu s3 a2 1044
-mulhu t4 s1 a0
-ori s1 t4 -1424
-or s4 t2 t4
-mulhu a3 a7 a0
-xori s1 s10 -362
-mul s3 ra s11
-and a6 s10 a7
-auipc t3 532904
-sltu a1 t0 s10
-mul s11 s11 a3
-sub ra a3 tp
-addi s3 s4 -1721
-xor t5 x0 t0
-auipc a0 540461
-sltiu s7 x0 1848
-auipc s7 107107
-slli s0 s5 24
-ori tp x0 1364
-rem s4 s6 a2
-mul t1 x0 s1
-xor x0 a5 s9
-sll t1 tp t4
-sra a0 x0 t4
-sltu t5 s10 t2
-sub s0 gp t6
-div s1 a0 x0
-add s9 a0 s10
-slti x0 s0 -77
-xori x0 tp -1331
-ori a3 s3 1062
-remu s5 a2 x0
-addi x0 s5 -936
-srai s6 s2 29
-srl t1 s0 a7
-slli ra s0 13
-divu t3 a6 t0
-xor a0 a5 s4
-rem s11 tp t2
-or t2 x0 s9
-or s6 t0 s0
-addi s8 s7 -233
-sll x0 x0 s3
-sll t2 t2 a6
-slti s11 t4 739
-mul t3 x0 t4
-rem s8 s0 s6
-remu s9 tp t4
-sra t1 s9 s3
-sltu a4 s7 a5
-sltiu t4 a1 1269
-xor a1 s3 a5
-srli x0 s2 10
-mulh tp t5 t4
-auipc s8 120413
-srli a3 s9 22
-srli s6 t1 12
-div s4 a3 t3
-mulhu t5 s1 s10
-or x0 x0 x0
-div t5 a7 x0
-sra s11 t0 s7
-srl t5 a1 a7
-sll t5 s0 gp
-and t4 s9 a5
-and a4 s6 s2
-sra ra t5 a5
-or a4 s10 s11
-srai t5 t2 27
-slt x0 s2 tp
-srli ra s2 22
-xori s7 a4 -1421
-remu s11 s4 a7
-slli s4 t1 3
-andi x0 a6 -798
-andi t5 s10 -332
-divu s6 s9 a3
-slli a0 t6 27
-srl s6 s4 s6
-slt s8 s8 t2
-mul a5 t3 a6
+mulhu s9 x0 t0
+ori a1 a1 -599
+rem gp t4 s9
+div a4 a2 t1
+and s9 s9 a6
+add a3 t4 a4
+sra s9 t0 tp
+slli a7 s9 3
+slli s8 s2 7
+remu s11 x0 a7
+sub s4 t4 gp
+sltiu s8 s9 -911
+auipc a1 246376
+slti tp s5 1451
+mulh s6 t2 ra
+and a2 t6 a5
+mulh s6 s10 a7
+sub ra s9 ra
+sltu t6 a7 s4
+ori s10 s0 201
+addi t2 a1 294
+lui a3 910922
+srl s5 a3 t2
+and a0 t4 t3
+sltu s11 s9 a3
+div s11 s9 a6
+sub t6 s9 s6
+add a2 s8 s1
+remu t5 t4 s9
+and a1 s1 a1
+or gp t2 t0
+and s3 a7 gp
+slli a5 t2 2
+mulhsu s3 a1 s2
+slt t0 s0 t1
+slt t0 s0 x0
+and a7 tp s2
+slli a7 t4 5
+sll s0 a2 s4
+sltu a2 t3 s6
+andi a0 x0 -1366
+auipc a2 643624
+xori s0 a4 -712
+mulhsu t4 t0 x0
+srl a6 a4 s2
+slti a2 t2 1472
+slt a3 s5 s10
+slli t3 s1 11
+sltu gp s4 s7
+sub s9 a4 a2
+divu t5 s6 t1
+sra t3 a0 s2
+ori t1 s2 192
+auipc ra 47313
+andi a7 t0 287
+srl s7 ra a2
+and s1 t2 s5
+slli gp a5 21
+auipc s2 959031
+sltiu s3 a6 -986
+remu t4 x0 a4
+add a4 a5 t2
+slt a5 s6 a7
+mulhu a4 tp s4
+mul t3 s9 s1
+and s0 s0 t2
+mulh t3 a1 a6
+rem s3 ra x0
+and ra s4 t0
+srai t5 s8 15
+auipc s0 990062
+mulhu t3 a3 s4
+mulh a2 s3 a1
+srai gp s2 20
+sub s4 s11 s6
+sll s4 s10 s4
+slti t4 s11 -401
+mulhu s3 s3 a6
+rem s8 s7 s11
+sltu t4 a1 t4
+srl s5 s9 s9
+add a7 s4 s3
+srai s1 s11 11
+sltu s8 t2 t1
+srli a4 s0 4
+mul a4 s0 s5
+lui s5 730128
+xor a7 s2 s11
+rem a5 a0 t4
+add a4 t1 gp
+mulhsu s10 t0 s0
+slli s2 s11 25
+xor s7 s6 t0
+div s7 t5 t4
+srai ra s8 22
+or s4 s8 a2
+sll t5 s1 s1
+or s7 s9 t2
+add t2 s7 a7
+lui s7 396710
+sltiu t1 s2 -1179
+xori s2 s9 -86
+srai a5 a7 5
+auipc s3 409938
+srl s11 x0 t3
+sll s7 t6 t3
+slti s6 s4 -1780
+srl s8 s9 s0
+sll a4 t5 t2
+ori s9 t4 -720
+sltu s9 s4 s8
+addi s4 a7 -1350
+mulh a3 s4 x0
+sltiu s8 ra 1344
+div s7 t2 x0
+and t5 a0 a4
+add s2 t0 t0
+srli s7 a5 11
+auipc a7 678918
+or a1 gp a5
+rem a6 s0 s2
+srai t3 gp 19
+sub ra t1 gp
+ori s6 s6 -1527
+srli t1 s0 14
+xori tp t5 -1793
+srli tp s0 25
+mul tp x0 t0
+divu a1 s10 a0
+ori s0 t4 139
+mul s1 s7 t2
+auipc s1 748199
+srai s8 a0 30
+mul s4 t6 a5
+andi s5 a3 -83
+slti a3 t0 -449
+srai s7 s11 25
+sll a2 s2 a7
+slli s7 t2 25
+sub a1 a6 a6
+slli gp t6 28
+or x0 t4 ra
+srl s2 t1 a0
+addi ra t6 -1317
+mulhsu s8 t3 s8
+lui s9 743383
+sub s4 gp s2
+rem s9 s0 a2
+mulhsu t4 a3 t4
+mulh ra s9 s9
+add t1 s6 a3
+ori t3 s0 -30
+mulhu t2 s3 a5
+divu tp s3 s0
+sltu a6 a3 t1
+rem x0 s4 gp
+div s9 a7 s6
+mulhu s9 x0 ra
+sltu s9 s3 s3
+xor s9 a1 x0
+div t1 s10 gp
+ori s4 s5 -1630
+sub ra x0 s0
+mulhsu t0 s5 s11
+xor t4 s10 t1
+rem t6 s6 s6
+slt s1 s4 s11
+mul s0 t3 s0
+or tp gp s8
+rem t2 ra s8
+and t0 t5 a2
+slt s0 a7 t4
+sub t5 a4 s7
+slt s9 a7 a6
+xori s9 t0 -1299
+srl t0 s10 tp
+and tp x0 s1
+sll s9 s6 s6
+sltu a6 t1 s0
+sub a0 t5 gp
+remu gp ra x0
+lui t1 73551
+sub s1 s11 t6
+add s10 gp a3
+or a7 a4 t1
+ori t0 t0 -1948
+lui s9 553656
+addi a2 s1 99
+and a7 a4 s8
+slt x0 s1 a5
+srli s11 a7 26
+divu a2 a4 s8
+mulhsu ra s9 t5
+xor a0 t2 ra
+srli s3 t2 9
+ori a7 a6 -535
+addi s6 a0 1254
+addi t5 t6 -1688
+div s2 t4 a2
+mulh t1 s9 ra
+sltu a6 a4 a2
+and a7 s2 a1
+slt t1 a5 s9
+mulh x0 s3 t4
+srai s4 ra 27
+lui s8 142425
+srli s1 t0 19
+sltu s2 a6 s8
+and s8 x0 s7
+sra a5 a3 a3
+andi s10 a4 1303
+slli s1 a6 5
+add t1 s1 tp
+auipc a6 627352
+mul t3 s9 s8
+srl s7 s8 ra
+sltu s4 s6 s8
+srli x0 t0 6
+div s6 s9 tp
+sub t1 a1 a0
+div x0 a1 s4
+srl s8 gp x0
+sll s1 s7 s8
+mulhu a6 a3 x0
+divu s2 t4 s1
+div gp tp t1
+ori a3 s11 -712
+rem t3 a7 a3
+auipc s2 290363
+andi t0 ra 1906
+or x0 s11 s8
+mulhu t3 gp s2
+xor s11 t3 s9
+andi t4 t2 -1793
+or s7 t3 t3
+and s1 t6 a5
+srli a5 t1 25
+slt t0 a2 s9
+add a7 a1 a6
+sltiu s1 a1 -882
+sra a5 gp s4
+xor s11 tp s10
+div s4 t3 s3
+sltiu s0 gp -272
+sub s2 a0 a1
+srai a3 s1 27
+xor s4 s9 t5
+sll t0 s4 ra
+srai a1 x0 4
+sll ra s7 a0
+ori a2 a0 1606
+and t2 gp a5
+sub s7 s11 t5
+sra a1 s11 t1
+remu s5 s8 tp
+mulh x0 a7 t4
+srl s2 s10 s5
+sub t0 t4 s9
+sltiu t3 ra -1498
+or a6 t0 t3
+sub s0 s9 s8
+addi a6 a5 -1830
+mulh s9 a5 a6
+lui a6 576614
+sra a7 t4 s7
+srai t6 s8 26
+and a6 s10 s11
+slti a5 t1 723
+mulh t6 s11 s4
+srai s11 t2 23
+slti a2 s6 -504
+divu a4 t5 a1
+sub s8 s11 s5
+sltiu a2 a6 1467
+srl a0 a3 a2
+mulh t3 a0 a0
+xor s0 a1 a7
+sra gp t6 s0
+mulhsu x0 s11 s10
+sltiu a1 a2 -714
+slti s1 a3 -273
+slli x0 s9 5
+srl gp ra a1
+xor s9 tp a4
+mulhsu s0 a3 t0
+mulh s10 s5 s6
+ori s10 s9 1711
+lui gp 672469
+mulhu s2 a3 t2
+addi x0 a4 -160
+andi a7 t6 943
+add s3 a6 s2
+mulhsu s1 t4 s4
+addi tp s5 848
+add s0 s6 s3
+add s8 a1 a5
+srai s10 t2 23
+div x0 s3 tp
 slli s0 s11 1
-addi t2 s0 -1189
-srli a3 s1 20
-xori a7 s8 -833
-slti s10 a1 -1950
-remu t0 s10 s9
-slti s3 s9 -127
-slt a1 s5 s7
-slt s7 s7 a3
-div s8 s9 s2
-slli a5 s2 26
-mulhsu s7 s7 x0
-and t2 t0 x0
-rem a4 a1 t5
-auipc a4 584716
-slt s9 s3 a1
-divu a0 t2 s2
-srl s11 ra a1
-sll s11 s10 t5
-divu t3 s9 t5
-srli x0 s1 7
-divu x0 s5 s8
-srl s2 a4 x0
-ori x0 t5 491
-slt x0 a1 s5
-rem a2 s4 a1
-remu ra s7 t3
-slti a1 a1 -441
-slt s0 t5 tp
-sltiu a1 a5 1918
-remu s6 tp s5
-slt s5 tp a4
-xori s4 t4 1088
-sra gp a0 t4
-mulhsu a1 x0 a1
-andi t1 x0 -246
-add s11 t1 t1
-sltiu t6 a2 -1235
-add s6 t2 x0
-mulhsu s3 s7 ra
-ori t3 t0 -1249
-sra a6 x0 s3
-mulhsu a7 s6 x0
-auipc s9 816269
-sltiu t5 s0 -911
-addi ra s10 1053
-srl t0 a1 ra
-divu s8 x0 s10
-mul s5 t3 t6
-sub s1 t4 t6
-mul t2 ra t6
-sll s8 s2 s7
-sra a5 x0 ra
-sll s8 gp t6
-slli tp a6 9
-sll s0 t0 s9
-srli ra x0 0
-lui a7 279706
-remu t6 a7 s3
-sra gp a6 a6
-add x0 t0 s11
-xori t5 ra 774
-addi s6 tp -1639
-mul a6 a1 t2
-srl t5 t5 ra
-sltiu tp x0 1743
-sub t4 a2 t3
-sra s2 x0 a5
-div a3 t1 ra
-ori s8 a6 36
-and s9 s6 t2
-sub a1 s6 gp
-divu a4 s2 a4
+addi tp s5 1370
+slt a6 t3 t2
 rem t4 s9 x0
-slt a6 s6 a1
-sltu s3 a3 a4
-slt ra a3 t3
-divu a7 s3 ra
-remu ra s2 a7
-xor a0 t0 a2
-mulh t5 s10 gp
-mulh ra a4 tp
-xor s0 s7 a4
-srli a0 t4 21
-remu x0 s9 s4
-auipc s2 152693
-lui t1 1022861
-add a1 t4 a3
-andi ra s3 1569
-srai t3 s1 27
-mulhsu s3 tp s10
-srli s0 x0 15
-sltiu s1 tp 661
-mulhsu s10 t5 s6
-srli t5 t0 18
-sra t3 s4 t2
-addi s1 a2 -236
-lui s5 123587
-slli t0 t5 25
-and t2 a4 a2
-sltiu a1 gp -715
-srli s9 a0 24
-mulhu x0 t0 s0
-ori s3 s2 1848
-remu s8 a3 s0
-xori ra ra -793
-srli a3 s10 17
-mul a0 t1 a3
-andi a0 s8 595
-slti s1 s10 -1
-xor a6 a1 s7
-lui s11 510440
-div t1 s8 s8
-sll a3 a7 t0
-sll a3 s7 s2
-andi a6 t6 -230
-xori s1 a5 -1460
-srl s9 s11 s6
-mulhu ra a5 a6
-sll t1 gp s8
-slli a3 x0 1
-mulh t4 x0 s0
-mul t4 s1 s1
-sltu s8 t6 s2
-sltu s10 a6 s1
-mulh t2 ra s6
-mulhsu s0 t5 a7
-srai s5 s10 6
-addi t3 s9 -278
-slti s8 a3 57
-rem a4 t0 ra
-xor a2 ra s5
-ori s1 t0 -1875
-slli a0 a3 13
-or t0 s2 a6
-slti t4 t6 -669
-and s7 a2 s3
-slt t3 t2 a4
-or x0 a2 s6
-add t1 a1 x0
-mulhsu s3 tp a5
-srai a1 a2 1
-mulh t6 s8 a6
-sltu s5 s3 a3
-sltiu s8 s2 -965
-and s4 s3 t5
-mulhu x0 t2 a3
-sll s7 s5 a2
-remu s0 s1 ra
-srli a3 a2 6
-srl t3 a7 gp
-sub t1 a4 x0
+mulhu t2 s6 t1
+sltiu t1 t3 -874
+or t1 a7 a6
+sltiu a3 ra -1351
+xori s0 s2 -1271
+div s6 s2 t1
+slli s7 a2 20
+srl ra gp a2
+mulh t5 t6 s7
+divu t1 s4 a4
+mulhsu a3 s6 t0
+remu a3 t4 a4
+slt a5 a4 s5
+lui gp 130131
+sub t2 a2 s1
+rem x0 t2 a0
+mulhsu ra t0 gp
+sra x0 a7 t2
+srl a2 t3 t0
+div t4 s7 x0
+ori s2 t0 -1742
+andi x0 a0 -922
+srl s8 t3 s8
+srai t4 a3 31
+add t2 a5 t2
+sll ra a3 s11
+slti a5 a5 1131
+auipc s4 127505
+xori s3 s9 -1722
+ori t4 a6 -790
+rem t1 a5 t4
+slti s8 gp 124
+slti t3 s6 1144
+mulh t4 a1 s8
+srli a5 t6 5
+sub a6 a6 t0
+mulhu a7 s5 x0
+divu a5 s5 tp
+mulh t4 t1 a5
+divu a6 a7 t1
+sll s3 s0 gp
+slt a0 a7 a4
+mulhu s9 s10 t1
+add s4 s9 s10
+xor t1 ra s5
+add s8 s8 s11
+lui t1 396377
+xori s2 t5 396
+ori a0 s5 -1749
+andi s1 s4 117
+slli t5 s8 13
+add a3 t2 ra
+srl s0 s2 a7
+slti a0 x0 1143
+lui t4 1021817
+xor t5 s2 s7
+sub tp s1 a5
+or t5 t2 t0
+mul gp tp s5
+sltu s7 t1 s3
+mulhu t6 t6 s4
+srl t1 s1 t0
+andi a5 s8 -1138
+remu t5 s0 gp
+sll t0 a3 a5
+slti a4 s8 -1795
+xor s0 t0 t0
+srli s3 ra 5
+mulhsu t6 t0 s8
+srai gp s0 27
+addi a4 s6 -1538
+mul a2 t4 a2
+slti a1 a0 484
+mul x0 a0 tp
+slli s0 s6 8
+auipc a6 715925
+slt x0 a7 t1
+lui t2 116554
+sll s6 a1 s4
+mulhsu a2 gp t2
+sltu s0 a0 s1
+sltiu a0 s4 -1064
+mulhu s3 a6 ra
+slt s7 a4 a4
+srli t6 s3 22
+slt a2 s10 a6
+rem a6 a5 ra
+remu a4 t2 t0
+and t1 s9 s9
+srli s7 s0 10
+slt t4 a4 a0
+mul s1 t0 x0
+mul s4 tp s5
+slli a7 t6 30
+mul s5 s10 ra
+xor s5 a1 a2
+div a0 s8 s8
+addi a3 s1 1244
+remu s4 s7 t3
+srai t6 a0 1
+remu tp a5 a6
+slt s6 t1 s8
+or s8 s3 s10
+mulh t2 s10 t4
+sll t5 s7 s8
+mulh gp t5 s4
+xori s6 t2 1741
+rem t6 s1 t4
+srai a6 tp 13
+or gp s3 s11
+sltu a1 s7 a0
+mulhsu a2 t5 s0
+srl t2 a7 a1
+sll s9 a4 s6
+or s5 gp t5
+add t4 a6 a5
+sra s5 t5 t1
+srli s1 t6 19
+rem s4 ra a3
+add a4 a4 t4
+ori a2 s2 -1669
+ori a0 a6 -811
+sll t4 a1 t0
+ori s9 t6 -1894
+srai s7 a0 1
+auipc s0 300173
+add a4 s7 a4
+mulhu s9 t6 t3
+slti s10 s0 -714
+divu s9 a1 tp
+mulhsu s6 s11 a0
+rem s2 t6 s9
+xor gp t2 x0
+andi ra a6 1029
+slti t4 tp -1560
+slti t4 t6 1882
+add t4 ra gp
+srli s6 s2 20
+sra s7 s11 gp
+slli t4 a5 13
+sltu a3 s4 a4
+xori s2 t6 -962
+slli x0 a0 27
+ori tp s1 -1430
+xor t0 x0 t6
+remu s8 t5 a5
+srli t1 s5 7
+remu s5 t2 t4
+add a1 a6 t2
+xori s3 s3 -503
+sltiu t6 ra 1157
+sra a1 a7 a1
+div a0 a5 s2
+auipc s6 28355
+mulh s1 t5 s0
+mulh s8 t5 t6
+slt t5 s3 s4
+xor s0 s6 s11
+slli s9 s11 2
+mulhu a7 s4 t3
+addi a6 t6 -786
+and s10 t4 s8
+andi tp gp -382
+slli s10 s7 12
+slti s3 t0 -1544
+divu t4 t6 s6
+mul t6 a2 t3
+slti s3 t2 -924
+sub s8 t5 s8
+mul tp s0 tp
+andi t0 a0 289
+add t4 t0 a1
+remu gp s3 s10
+slli s2 t6 2
+mul ra s0 ra
+slti t5 s9 -1958
+sltiu a1 tp -270
+mul s3 s10 t4
+sltiu a4 t6 -1745
+slli t6 s8 27
+mulh a2 s2 s1
+mulhsu s0 s5 s9
+add a2 gp s11
+remu a0 t6 s3
+slti s9 x0 -1737
+srai s3 a2 0
+auipc t4 420762
+andi s3 s9 245
+slti s9 s10 -492
+srli a6 t2 7
+and t3 a7 a1
+srai t5 a1 9
+auipc s6 362552
+xori s5 t1 -1244
+ori a0 t6 -1716
+ori s11 s2 -969
+lui s3 164354
+sub x0 s9 s3
+andi t0 s8 -1408
+or t2 ra tp
+andi t0 tp -314
+add s6 s4 a7
+add s5 a3 t2
+mulhsu s2 s5 s6
+lui s7 166274
+or t0 s6 t2
+srl s3 a5 a5
+mulhu t6 a2 a0
+remu a1 s8 s11
+mul ra s8 ra
+ori t3 a2 -517
+sub tp a2 gp
+sub a4 tp s4
+add t1 t6 s7
+auipc a0 783410
+auipc t4 68530
+sltiu x0 ra 893
+srl t0 tp s0
+lui a6 540035
+and s6 a2 s5
+sltiu t3 s7 -1411
+slli s3 s5 13
+lui t5 470632
+sra t1 a1 t3
+xori t2 tp -751
+slli s5 s4 20
+slti tp t3 1041
+addi t2 a2 1596
+div gp t0 s1
+or t2 a2 a0
+lui s8 645131
+auipc s0 326547
+srl s2 s2 t2
+divu t0 s6 t1
+mulhsu s9 a0 x0
+xori s11 s3 -180
+srli t4 a2 4
+sltu x0 ra a4
+sub a1 t2 s7
+sll s1 s7 tp
+slli t3 s2 28
+xori a3 s5 -750
+xori s8 t5 1677
+or s8 a5 s0
+mul t3 a3 a1
+mulhu s8 s11 a6
+remu s2 s5 a3
+divu t6 s2 ra
+mulhu s7 a2 t1
+sub s11 s3 a0
+sltiu t5 s6 553
+remu a5 a1 s10
+srl tp a5 gp
+lui a1 345565
+xori s6 ra 1164
+slti s8 s10 -561
+slli a5 a6 6
+sll t4 s8 s3
+and x0 t2 a0
+sll a1 a5 a7
+xori s2 a6 -1154
+rem s10 s7 a1
+srl t5 s8 tp
+slli s10 s10 3
+sltu gp s6 s2
+andi ra s9 -1607
+or a4 s10 gp
+divu s7 t6 s1
+xori s3 t5 100
+srl a4 s1 t2
+and s0 a2 t6
+and x0 t3 s3
+srli t6 t3 31
+srl a5 s2 s7
+mulh gp x0 s8
+lui s10 806767
+sltiu s10 s9 -1863
+lui t5 948182
+srl a7 tp t1
+lui s0 155327
+sll t2 s2 t5
+sub a4 s11 a6
+and s6 a6 a1
+mulhsu t6 s10 s2
+andi t4 a4 -1576
+srai s9 s11 5
+mulh s10 a1 s5
+sltu gp t4 a0
+or t0 x0 a1
+sll s2 a5 gp
+rem t3 a0 a7
+mulh tp a1 s2
+slt a5 a3 s3
+remu s9 s9 tp
+mulhu s10 a3 a4
+mulh a5 tp s9
+divu t5 a0 t1
+sltu a4 ra s1
+remu s1 t3 a4
+ori a5 t4 -1734
+rem a0 s3 t5
+add a0 t2 s3
+or a5 t0 a5
+mulhsu s10 t3 t0
+slti s2 t1 -82
+addi a6 t0 -787
+divu s2 a4 s11
+slt s3 a7 t2
+xor gp t2 t0
+slt x0 x0 s3
+or a7 t1 s4
+divu s4 s5 s10
+ori s5 s2 -842
+lui s4 570507
+srl t6 s10 t2
+mulhu s0 t2 s2
+xor a4 s8 tp
+sltiu gp s0 -146
+lui tp 858395
+sub tp s8 a1
+sltiu t6 s11 1390
+or a5 tp a5
+or s10 ra a6
+addi a3 t6 -290
+addi a2 gp -1523
+add t3 t4 s8
+remu t4 a3 s10
+mul t2 a5 a2
+srl s5 s9 s11
+and s1 a4 t5
+auipc ra 643798
+remu s1 t1 x0
+srl s4 tp t4
+slli s11 a0 19
+div s9 a6 s7
+srl t2 t3 ra
+slli s9 a5 9
+andi t2 a6 -576
+srai a3 s2 1
+sub s11 s4 a5
+and s7 s11 t6
+slli a4 a6 30
+slt s1 s7 t5
+slti s4 s4 1905
+remu s1 t2 t3
+auipc t3 820752
+addi s7 a5 -1768
+add s7 a3 s6
+mulhu s11 a4 t0
+ori t4 s10 -56
+sll t6 t5 t4
+slti x0 x0 814
+srl a2 s9 a4
+mulh a2 t6 x0
+srli s0 s9 20
+lui a7 670896
+sltu s3 a6 s9
+mulhu x0 s1 s0
+ori a4 a0 1498
+addi s11 s6 -1253
+andi a0 a6 1746
+mul a1 t0 a6
+sltiu s11 s2 1464
+sltiu a5 s10 -1167
+and a1 t4 a2
+srl ra s11 tp
+sll s8 t1 a1
+slli t2 s8 1
+srli t0 a3 22
+sra s0 s8 s4
+slli a2 gp 10
+auipc t3 513920
+sub gp s4 a3
+ori s8 a5 -188
+sll a4 a4 ra
+or s7 x0 s6
+divu s11 gp s9
+sltu s4 s9 s6
+add t3 t2 a0
+div gp s5 a3
+rem x0 a2 a4
+slt a7 s7 a7
+and s10 t2 s4
+sub tp t5 s0
+sub a5 t3 tp
+ori s11 s3 -883
+mulhsu s0 s9 a5
+sltu ra tp a6
+rem a6 t5 a5
+andi t2 s6 -2038
+andi s8 a0 1143
 sra s4 s7 t2
-mulhsu s7 s3 gp
-remu s11 t5 s10
-add tp s4 t0
-sra a7 a0 s10
-mulhu s11 a2 s5
-auipc a4 889038
-div s3 a6 s10
-srli a3 a1 2
-sll t0 t1 t2
-addi s7 x0 -1417
-addi s8 a3 -2018
-srai s8 a0 17
-srl s5 s9 a7
-slt tp s3 s4
-remu t3 s7 s7
-slt a6 a3 t0
-divu a1 s4 tp
-mulhu a4 s2 s9
-andi t5 s7 -1514
-remu s5 x0 x0
-slt a4 t4 t1
-lui s5 894111
-mulhu gp s5 a2
-mulh a4 a0 x0
-mul t5 s6 s10
-add t1 t5 t0
-addi ra s9 -586
-sltiu tp t3 1436
-addi a4 x0 1196
-ori s6 s4 -354
-addi s5 a0 -495
-xor s3 s10 t6
-srai tp a0 7
-ori s8 tp 869
-or a6 t4 x0
-mulhsu s8 a0 x0
-and s10 s2 a2
-ori s1 a2 -125
-mulhsu a1 t4 ra
-sra s11 t1 t6
-slti s5 x0 934
-add a0 t6 a4
-mul t6 tp s1
-divu s4 t6 t2
-mulh a6 s0 a2
-sltu s8 t1 s3
-srai s1 s3 11
-slt s10 a5 a5
-remu t5 s5 a2
-or s1 a4 s10
-sltu t0 t5 a3
-or ra a2 ra
-andi s10 s3 -1175
-srai a5 x0 26
-auipc a2 370113
-slt s11 x0 a5
-sltu ra a4 a0
-add t1 a3 a0
-remu a0 t1 s9
-srli a1 t0 15
-lui x0 170256
-mulhsu t0 s1 t0
-add s9 a7 s8
-add ra gp t1
-addi tp s10 -565
-sltu s7 s6 a5
-addi s6 t0 -1300
-sra x0 a2 s3
-mulh t1 s8 t5
-srli t3 a5 16
-addi s6 a2 -1985
-or s1 s0 a0
-rem tp s0 s10
-sltu a0 s0 s6
-sra t4 a0 t0
-srli x0 s4 14
-divu s8 tp x0
-srai s4 s8 8
-srl a0 a3 t6
-and s10 t5 x0
-srl s3 t4 x0
-xor t1 s9 tp
-mulh s9 t4 x0
-ori t4 t1 -338
-div s2 a3 a2
-srai a1 t4 0
-div t5 a0 t4
-auipc a3 535037
-mulhu a4 x0 t4
-srai t4 t6 30
-sltiu s8 t1 -1825
-sll t5 a2 s3
-sll s6 s0 a2
-mul a2 s7 tp
-addi gp a4 -1226
-mulhsu s3 s4 t4
-srai x0 t6 4
-sll a4 a5 s8
-srai x0 tp 4
-andi a1 s11 480
-remu s9 t0 s7
-srl a6 s11 s11
-xori t2 s3 -1449
-ori a1 s11 -326
-sltu t5 gp a6
-mulhu a2 s7 a0
-remu a7 s7 a2
-sra s1 gp s10
-lui s11 330390
-srai s0 s9 9
-divu a6 a5 t0
-divu s2 a4 t2
-divu s8 t4 t1
-or a4 s8 x0
-xori s8 t6 -1581
-divu t2 s0 t4
-srl a7 t6 t2
-sll a5 s9 a0
-srl a2 a6 a1
-srli x0 s10 11
-slli a2 a5 8
-xori a1 ra -1212
-mulhu ra s5 x0
-or x0 gp t6
-mulhsu s7 a7 t3
-slt t6 t1 t0
-xor s9 s5 a1
-sltiu s0 a7 -980
-srli ra t3 24
-mulhu t3 s2 s2
-divu s2 a2 s4
-srai s1 a0 26
-mulhu t1 s9 s7
-auipc a3 594724
-rem t2 a4 t5
-slti gp s2 -1424
-sra t3 a4 s5
-mulh x0 tp t4
-andi s10 s2 18
-srli t4 a6 24
-sra s6 a1 t5
-add a7 s4 s9
-mulhu a7 t3 gp
-sll s6 a2 t2
-mulhu s1 a7 s3
-srl a3 a1 a5
-mulhu s4 t2 s5
-sra x0 s4 t2
-auipc t3 299841
-remu s0 t5 t6
-sub t0 a5 t2
-and t6 ra a4
-sll a0 s3 ra
-sltiu s6 s0 -1753
-xori gp gp -329
-sltu t5 x0 a1
-mul a4 ra tp
-srl a2 s3 t0
-and a2 s10 t5
-srli a3 s2 28
-srli a7 a1 2
-sra t5 t6 t5
-srai s6 s9 18
-lui s2 798357
-add a4 a0 a2
-srl a6 s1 s9
-mulhu s4 s0 s0
-auipc t5 805505
-mul s6 s3 s11
-sra t3 a2 a3
-slti tp s8 -78
-srli a6 s5 15
-xor t1 s2 a7
-sltu s6 s1 s6
-xor s3 a2 a4
-sll a6 a2 s9
-lui ra 774529
-mulh gp a5 t4
-div ra t4 ra
-slt t3 a4 s4
-add t6 s11 s10
-slti s10 tp -1950
-mul t2 x0 a4
-mul a7 t6 t5
-xor a1 t2 t4
-sub a4 s7 s11
-srl t4 s6 a7
-mulhu s0 a6 s11
-mul t0 x0 x0
-mul t0 s10 a6
-sll s9 t4 a5
-div t5 a1 s8
-addi t4 a0 1997
-sltu gp s3 s0
-xor gp s4 x0
-ori s7 a2 -1056
-srli a3 ra 16
-add tp s11 s0
-slt s2 a5 s0
-sub s2 x0 ra
-mul t1 s2 s5
-sll s10 tp s6
-ori s11 t1 -499
-ori a6 x0 -1321
-sll t4 tp t4
-divu s3 t4 a5
-and x0 a0 t6
-divu tp s3 t6
-xori gp t6 1044
-srl s2 s8 s9
-rem x0 a1 t3
-or ra t2 t1
-andi s10 a5 1387
-mulh a4 a1 t6
-sltiu s6 s11 -399
-remu s11 a5 ra
-andi s10 s11 17
-rem a4 t2 s8
-rem a5 t0 s10
-slti s7 s2 -2027
-srl tp a0 a0
-and s7 a5 a7
-div s9 s0 s4
-mul a3 s1 s4
-sltu s0 s0 x0
-slli s9 s10 31
-or gp t4 s3
-mulh t0 t5 a1
-addi a3 t5 -342
-div s7 gp s10
-srli s4 t5 13
-mulhu s4 s4 s9
-sll tp t1 tp
-or t5 gp s8
-slli a6 s11 8
-and s8 t3 x0
-divu t5 a5 t0
-slli a4 s6 15
-andi s1 a0 -610
-mulhu t0 tp t3
-srl s9 x0 x0
-auipc a1 476040
-slti s3 s8 -300
-andi s2 s3 -890
-ori a1 a2 1182
-slli s3 t0 26
-slti s8 s11 616
-slti x0 s6 1581
-remu ra a7 tp
-slt t0 s0 s5
-remu a1 x0 x0
-srai a4 t0 6
-srli x0 s10 28
-srai s10 tp 13
-add x0 t6 s2
-xori s8 a1 -1620
-mulhsu s4 s9 a5
-and s8 ra s8
-lui s6 341141
-srl s7 x0 t0
-auipc a5 160730
-mulhu t3 s1 t3
-or gp s9 a1
-sra t4 s1 a0
-xori t5 s6 -311
-srai t1 a2 12
-sll t4 s9 s4
-auipc t3 525591
-xor s11 t2 s3
-rem a3 a1 a0
-auipc s4 560061
-add t5 a7 t1
-sub a4 a1 t0
-remu s1 a3 s10
-divu s1 ra s11
-mul s7 t6 s2
-add a6 s4 a7
-rem s0 a7 s0
-sub a6 a5 ra
-sll s7 s0 a6
-sra a2 s1 s2
-add a7 ra a1
-auipc t3 774610
-mulh gp a0 s1
-ori t5 s3 -1717
-xori s1 a0 1955
-slli s10 s1 30
-mulh t6 s3 a6
-add s0 s1 tp
-div a6 s0 a2
-lui a3 790835
-sltiu t6 s4 178
-sub t2 s2 ra
-and s6 t4 a2
-srl t0 s10 s0
-sltu s7 x0 x0
-add a4 s3 t0
-rem s3 t4 t3
-slli s5 t3 26
-srli s1 s0 14
-srl s0 x0 s4
-lui a4 192958
-srli t6 s4 15
-andi s9 t2 -515
-addi a1 s2 -1155
-lui t2 956941
-remu s5 s7 s11
-and gp s2 s4
-andi t3 ra -35
-sltiu s8 a7 -129
-slti s5 a5 -1888
-slti a5 s7 -713
-slt s0 a4 s3
-xor t5 a4 s1
-or t1 x0 t1
-or x0 tp a1
-sra t6 t2 x0
-lui s11 63167
-auipc x0 585098
-mulhsu s2 tp t5
-add a7 t4 t1
-srli t4 s4 1
-and a7 t6 a2
-mulh s4 t6 s1
-divu a2 a4 t5
-mulh s2 s8 t2
-sll s10 a1 s6
-add x0 t3 a2
-slti t4 s8 490
-sll t0 x0 gp
-slt a1 a4 a0
-auipc x0 1020782
-slti a7 t4 980
-xori ra a7 -449
-sltu a7 s1 t6
-slli s6 a5 22
-slli a0 t0 16
-xor a4 s8 s5
-mulhu ra s1 t0
-rem t1 s3 ra
-divu a6 s5 s3
-lui gp 398357
-sltu s6 a4 x0
-sltiu a7 x0 -960
-div tp t2 s8
-srli a6 s10 6
-xor s1 s11 s3
-and gp ra a7
-add t3 s1 s2
-sra t5 a2 a6
-slt a6 a4 s7
-and s10 t5 s7
-srli a0 t1 26
-sltu t1 a7 t5
-lui t4 777192
-srl s3 x0 a0
-auipc s4 441486
-divu a2 t2 tp
-sra s6 a2 s3
-remu ra t5 a5
-div a1 t5 t5
-xori t0 tp -824
-srli s10 s9 27
-mulhsu s1 x0 t5
-sll s10 ra x0
-mulhsu x0 a2 s9
-slt t0 s3 x0
-srli s1 t4 9
-slli s8 s10 1
-xor s11 s11 t3
-sltu t5 t6 s2
-remu a2 s7 x0
-slli gp s0 7
-sltiu s3 a6 1903
-divu t2 a4 a0
-andi s7 a3 -1937
-divu ra a2 a2
-or s0 t4 a5
-xor gp s0 a7
-or s7 s1 gp
-sra s8 a5 x0
-slt s6 x0 s3
-sub a7 a3 t0
-srli a7 s1 17
-and s11 t5 s4
-auipc s6 737569
-slti t0 t2 -1775
-srai s1 t3 13
-div s4 s8 a3
-rem t1 s2 gp
-and s4 x0 t6
-mulhsu s10 a5 a2
-slt a5 a4 tp
-addi a5 s7 -1529
-auipc a6 1026480
-srl t4 s7 s3
-xori a3 t4 -1261
-sltiu s2 t5 -1902
-addi t1 s10 -1659
-divu s4 s0 a6
-sra s3 gp t0
-sltiu a2 a7 -1940
-andi a3 s10 -1511
-sltu a5 a1 s2
-addi a4 s6 803
-slt t1 s0 tp
-andi t0 a7 -1939
-xori s3 s3 -895
-and t6 a0 t0
-mulhsu s4 s0 s8
-add s8 s7 a4
-sltiu ra a1 -1253
-andi t2 s5 1979
-sltiu a1 t1 1767
-sll t1 t5 a2
-lui s9 996551
-mul a6 x0 t0
-add ra s6 a0
-addi t6 s7 -451
-divu a3 s7 t1
-slli t5 tp 28
-remu s6 t0 s11
-slt s9 t4 t2
-mulh t5 s1 s9
-and s2 t3 a3
-xor t4 s4 a0
-divu t0 gp s9
-srl a0 a0 tp
-sll s6 gp s1
-mulh t0 a4 a2
-sra s2 s11 s2
-and a7 t5 gp
-rem s8 s2 a7
-sll a2 s3 ra
-remu s1 a0 t3
-addi x0 s5 -1858
-div s7 s0 s6
-rem s7 s4 s3
-slti s0 ra -1104
-divu t6 t2 s2
-sltu a3 a7 s4
-slli x0 ra 23
-xori a4 s3 424
-and a4 t4 a3
-srl gp a3 s10
-slt s5 a1 s2
-remu t2 s8 s11
-ori x0 s3 -2007
-sub s6 a0 s7
-lui t1 248614
-rem t3 a3 s4
-ori gp t6 -1622
-rem t6 s0 s11
-add x0 t0 a2
-xori s11 a6 1232
-andi s6 gp 198
-add gp s1 x0
-sll t2 s4 s2
-or s1 s1 a2
-srl a7 a6 a7
-slt t5 ra t4
-srai s1 t4 4
-xor s8 s2 gp
-sll s3 a4 t0
-sltu s10 a0 t5
-mulh s4 t0 s6
-lui t4 715970
-srli t3 t1 7
-remu ra s8 a4
-xor s0 s7 gp
-xori t0 s5 -1322
-auipc a2 921370
-slt s2 a5 a3
-sll s5 s3 s8
-auipc s2 340030
-xori a7 x0 -613
-sub s2 s0 s2
-sra gp s10 ra
-sra s10 a4 x0
-srai x0 t2 9
-auipc s0 251415
-divu a7 s2 s1
-lui a7 612093
-div a4 s4 a4
-lui s5 148459
-div s5 a5 s6
-add a0 t3 a3
-sltiu s3 ra -1495
-srl s2 s3 s5
-lui s7 458365
-ori s11 a5 912
-andi x0 gp 988
-slt s11 s7 t0
-rem s3 s0 t3
-sub s1 ra gp
-slt a1 a7 t3
-sltiu s4 s11 -674
-sra s3 a6 t3
-sltu s0 s5 a6
-div s7 t0 s10
-sltu t2 t6 x0
-andi t2 a2 1549
-mulh a7 s2 ra
-srai s7 s8 31
-slt x0 tp x0
-rem t5 s7 a3
-andi s7 gp -1885
-sltiu t2 gp -1739
-or s6 s5 s10
-lui tp 722717
-slti s6 t0 -310
-divu a5 s5 a3
-sltu t1 s11 s3
-slt s2 x0 t1
-addi s3 t0 -230
-mulhsu s0 a0 gp
-and a7 a6 t0
-srl s5 t3 s2
-srli s5 s1 26
-remu x0 a0 a7
-mulh s6 a7 s8
-srli t2 s11 16
-div tp s4 s5
-divu s4 a4 t5
-mulhsu t4 t6 a0
-slli s3 t6 12
-or s8 a6 t3
-sub s8 s3 s2
-mulhu t2 a5 a3
-slt s9 gp ra
-ori s5 s6 1278
-mul s4 a7 s6
-mul s7 t6 s0
-sltiu s8 gp -6
-xor s10 t6 a6
-lui tp 624987
-xor a5 t2 a6
-sra x0 t3 t2
-mulh a2 t3 t6
-srl t2 s5 s3
-mulh s4 a1 s1
-mulhu a7 gp a1
-div s6 s9 a2
-add s3 a3 a0
-mulhu s4 tp t0
-mulhu ra a1 s8
-sub a1 a2 tp
-auipc x0 681684
-mulhu a6 t0 s9
-slti s2 t2 1420
-mulh t0 a5 t6
-rem t3 t2 s3
-mulhu s4 t5 t0
-sub a0 t0 s9
-auipc s10 579402
-auipc s7 32715
-mul tp s1 s9
-auipc a5 282147
-srl t4 ra tp
-or tp s9 s9
-mulhu s8 s7 t3
-slti t4 s2 -1459
-sll a3 gp s1
-andi a2 s9 1435
-slt t4 s3 x0
-or s9 a0 tp
-mulh a4 a0 s7
-srli s2 tp 21
-andi x0 tp -159
-xor t0 s10 t2
-slti s0 a6 -559
-lui t3 304722
-add a4 t1 a2
-and x0 a1 s6
-mulh s1 t0 s2
-and a6 a0 s7
-slti a7 s10 -1159
-sltu ra s0 a0
-rem a0 gp s2
-sltiu a3 s0 -517
-sll t0 a4 t0
-remu s4 s2 s10
-sltiu x0 t1 1902
-xori a1 t6 1770
-slt a3 s11 t3
-remu a1 a2 s5
-sltu a7 a1 t2
-div tp s9 a0
-srai a5 tp 4
-div t5 s4 a1
-sub t6 a3 t6
-xor a5 a6 t4
-and s5 t1 s8
-div s7 t6 t3
-remu ra a1 s3
-srai a6 x0 26
-mulhu t3 s10 gp
-remu a0 s0 s1
-srl a0 s6 a4
-srli s4 x0 27
-mulhu a3 a0 a7
-slli x0 s1 0
-rem a1 s3 s7
-mulhsu x0 s9 s0
-or a1 s11 t6
-div s4 s11 t3
-ori s1 s10 132
-slt s3 a5 s5
-and s4 a5 s9
-or t1 a0 s0
-remu s9 x0 s8
-auipc a6 509926
-srli s3 t6 27
-mulh a6 t1 s3
-sll t3 a6 s6
-auipc x0 473371
-mulhu s2 s2 s2
-lui tp 474345
-mul s0 a1 s4
-slti a1 s4 -1574
-add a3 t0 s2
-slti s0 s5 -1344
-divu x0 t4 s7
-sra x0 t4 s9
-sub s8 t6 t0
-sltu gp t5 t2
-sltiu s6 a0 -1106
-slli t4 s1 9
-mulhsu a7 s8 a7
-xor x0 t6 s2
-addi gp gp 245
-remu t1 s8 a5
-srai t5 s1 7
-add s4 s5 a3
-sub s7 x0 s8
-lui s2 37124
-and s9 s10 a6
-sll gp s10 s10
-sub s10 s9 x0
-div t6 s0 t4
-and a0 gp t3
-rem s0 s5 s2
-slti s5 a2 -922
-addi s8 a5 -800
-mulhu s10 a5 s10
-mul gp s4 x0
-add a6 a2 s3
-mulh a4 s5 s1
-divu t0 a2 s11
-ori a0 a2 -1457
-sub s10 a2 a6
-addi a3 a3 -1573
-div s4 s7 s9
-addi a5 s3 928
-srai s11 s6 7
-divu x0 s8 t3
-srl t6 tp s9
-srl t6 s11 x0
-mulh a1 s3 s0
-ori s7 s2 -1964
-sltiu ra a4 -1192
-slt s11 s0 x0
-sub t4 s5 s0
-mulh a7 a6 s3
-and ra s2 s7
-and a5 s11 a4
-lui s3 176534
-mulhu a7 s1 a5
-lui a6 578941
-auipc t6 161257
-sra a2 s8 a3
-xor t3 gp s5
-or a4 a5 t4
-srl s2 t4 t6
-srl t0 a4 t4
-div x0 t3 s0
-divu t3 ra gp
-sub s10 t2 a3
-div a6 a3 t1
-sltiu t0 ra -1523
-and t6 s7 a2
-mulhsu t4 ra a5
-lui t5 1681
-sll t2 s10 gp
-xor ra s3 a0
-xor gp t2 a4
-sra x0 tp s3
-div s5 t6 s2
-srli x0 t3 18
-or gp tp ra
-ori s9 a0 -892
-mulhsu s11 t4 x0
-and a5 a1 s4
-ori s6 t1 1159
-and tp s5 ra
-mul t3 t6 a4
-slti t5 x0 -1509
-sra a7 a7 a7
-mul s11 s5 a5
-sltu a5 gp a4
-auipc t2 264917
-ori s6 t2 -1513
-sltu s4 s0 t6
-sll s5 s4 t6
-or a0 tp s11
-or t1 s10 t0
-mulhsu a6 t0 s10
-mulhsu s8 a5 s4
-lui t0 308749
-mulh s10 s10 tp
-xori a5 s5 980
-div t5 s3 a0
-remu t5 x0 s1
-lui t5 695385
-or t3 a4 s5
-or a6 s2 s1
-divu s10 s10 a2
-lui a5 227252
-andi s7 s10 423
-add s11 s4 gp
-and s10 s3 t4
-sub t5 a6 t4
-sll t6 s2 s7
-add t5 a0 x0
-xor a3 x0 a6
-andi s9 a2 575
-slt t6 ra a5
-and t2 t2 a6
-add a2 a7 a2
-or a6 a5 a3
-srai s4 a1 15
-xor a0 x0 t6
-srl t5 s6 s4
-and a6 s2 t4
-slt t1 s4 s8
-ori a0 a6 105
-sub t5 a1 s9
-sra t2 a6 s10
-addi t2 a3 -1955
-andi a6 s4 -698
-auipc s9 113023
-srl s4 a2 s8
-add s6 x0 t6
-sra t0 s10 t6
-remu s6 a2 t6
-mulhsu a3 ra s7
-rem gp a4 s11
-remu s9 tp t4
-srai s4 tp 17
-slli s8 s5 30
-sltiu a4 a3 310
-sub s7 tp t0
-addi s3 a5 1262
-mulhu x0 t3 s3
-and s0 x0 s7
-remu tp a3 t5
-remu s10 a5 a7
-andi a6 x0 1688
-sll a6 s9 a2
-and a1 s6 t4
-mulhsu s3 s7 a4
-srl gp tp a0
-mulh s7 a2 x0
-sll ra s0 s3
-mul t2 s5 a6
-srli t1 a6 14
-lui s9 972746
-addi a5 t1 1532
-slt s5 t4 s0
-divu a3 t3 s7
-slti a1 a4 -721
-sltu t3 a0 s4
-mul s6 ra s9
-mulhu a0 a4 t0
-auipc x0 1043956
-div s9 a6 s5
-srl t5 s2 s8
-slti tp a0 -1531
-sltu s11 s4 s9
-or t6 s5 t6
-ori s1 s0 -1724
-sltiu s11 t2 -739
-divu x0 t3 a6
-sra tp s7 t1
-slt s4 a3 a0
-slti a3 s1 -1907
-srai t2 t2 18
-remu a7 t6 s3
-divu s7 s4 a3
-slli s0 s10 0
-srai s5 s9 25
-slti t3 a7 1938
-xori s10 gp -1862
-lui t1 24777
-lui ra 133503
-sra t1 a2 s1
-xor s1 s5 t1
-sll t6 ra t3
-mulhsu t3 s9 a0
-and s1 s5 a4
-addi s0 t3 -499
-and gp a3 s8
-mulhu t5 gp tp
-sltu s1 a7 s6
-rem a1 t3 t4
-srl tp a3 a2
-addi t0 t2 -705
-slt gp s4 a5
-sll s5 s1 t5
-sltu s5 s5 s7
-auipc s3 684912
-srl s7 a2 x0
-mul s6 x0 ra
-sll s8 t0 a1
-xor s7 s4 t3
-sll t5 x0 s5
-slti t5 a4 575
-slt tp a2 s11
-slli t0 t4 30
-slti t2 s8 -85
-xori a0 a5 315
-addi x0 t5 -836
-or t0 a3 s5
-div s5 t4 tp
-xor a3 t6 s4
-xor x0 s11 a3
-sra x0 a4 ra
-srl tp x0 s1
-add t3 s8 t1
-remu ra s2 x0
-ori a4 x0 -1361
-rem t6 a0 s4
-div s4 s10 x0
-lui a6 428282
-divu s11 a1 a1
-and s3 t2 s5
-andi s1 s7 -299
-mulhu a0 a0 s10
-addi a4 a0 -1731
-divu x0 a1 s6
-or t0 x0 a3
-add ra s7 s10
-srai t1 a7 15
-xor a1 ra s2
-sra s11 s6 s4
-lui s0 385928
-mul s4 a1 x0
-slli a5 a4 4
-add x0 s5 a6
-slti a5 s2 852
-srl a7 t5 t3
-rem s5 t2 s5
-mulhsu a0 s0 s4
-xor s3 a4 s2
-xor t3 s1 a2
-srli gp a3 28
-xor t3 s11 t5
-slli ra s2 24
-or t4 t6 t2
-auipc gp 313474
-andi t4 a2 1595
-mulh s8 t2 s7
-sra s8 s8 t0
-divu t1 s3 s1
-mul t3 a0 t3
-srli s10 s11 26
-mulh s3 a0 s10
-srl t0 x0 a6
-xor ra tp a0
-rem t0 a7 t5
-lui a1 314761
-divu s11 a5 t6
-and s2 t5 a3
-xori x0 ra 1060
-mul t1 s7 s3
-slli t6 a0 16
-slli a3 s7 23
-ori s10 s3 1166
-ori gp a4 -1077
-sltiu t6 a6 -677
-and t5 s7 a4
-sra t0 s0 ra
-mul tp s0 s2
-add a4 a3 a3
-mul s11 t0 tp
-auipc a6 174587
-ori a6 a0 554
-auipc a4 553626
-slt a2 t5 a7
-srl a2 t3 a1
-xor s3 s4 s4
-add a5 s10 s6
-andi s5 a0 -306
-div x0 t6 s11
-mulh t3 x0 t4
-srli a7 t2 26
-srai t4 ra 8
-divu s3 s5 s9
-slt a4 t5 t0
-sltu a2 s11 t1
-sltu t4 gp gp
-mulh a3 s9 t0
-add a2 t3 a1
-slti a3 t5 -1591
-rem a1 a1 s9
-mul a1 t5 s1
-sltu s4 s5 x0
-add t5 a3 t5
-addi gp ra 1877
-mulhu gp x0 s5
-sub a1 t0 s4
-sra s6 x0 s2
-sltu s8 a5 t4
-mulhsu s3 a1 s10
-sltu a0 s11 t0
-ori s0 s5 952
-xori t0 a3 -1389
-slt ra s11 s3
-div s4 a6 t2
-andi a0 a4 -1660
-sub t2 s3 a2
-mul a2 x0 s7
-divu a0 s5 s6
-or t2 ra s2
-slti s7 a1 -412
-sltu ra gp a5
-sltiu a7 ra -1647
-auipc tp 69573
-mulh a2 gp t1
-mulhsu s7 x0 a2
-sra s7 x0 a5
-srai gp ra 14
-divu s0 a3 a4
-mulh ra s3 s5
-sll s2 ra s3
-mulhsu x0 gp gp
-xori t2 a0 -1320
-srli gp s1 10
-lui s1 576112
-xor t4 a6 a7
-mulh s3 s4 s6
-div s3 x0 s7
-srl s3 t1 a5
-lui a7 50160
-divu x0 x0 a4
-add s9 s3 s10
-div s8 x0 s1
-sub s10 x0 a2
-mulhu t5 t6 t2
-addi t4 gp -1504
-sub x0 x0 t6
-sltu s2 s3 a4
-mul a6 a6 ra
-mulhu a0 a0 a5
-slt s3 a1 s7
-sub t6 x0 t0
-sltu s4 s11 t3
-sltu s6 s0 a7
-srli t1 s2 26
-auipc a1 789291
-remu s1 gp a2
-mulhu a5 t1 a0
-lui x0 708462
-mulhu t6 s3 gp
-slli s6 tp 22
-mulh t6 s0 a6
-rem t0 s6 a1
-ori t0 x0 808
-srl x0 x0 a4
-srl s1 s2 s4
-srli a0 tp 22
-auipc t5 157235
-sub t5 s4 s6
-sra a6 t5 tp
-remu t3 s4 a2
-slt x0 t2 x0
-and a5 s5 s6
-rem s10 t3 a7
-slli s3 s2 14
-divu a2 a2 s3
-lui t4 513571
-slt s0 x0 s9
-sub a7 s8 gp
-srli s7 s10 4
-add s4 gp t0
-and a7 tp t6
-and s4 s3 tp
-sra s5 a1 a6
-sltu t0 s0 t4
-ori s5 a1 -433
-sra ra a0 s10
-remu s5 s0 s6
-add s10 a1 a4
-add s3 s10 t3
-mulh s11 a0 t6
-mul a1 x0 s8
-srl t4 a3 gp
-lui a4 417454
-and s9 t6 a7
-addi tp s8 -675
-sra gp a5 t2
-xor s11 a0 s9
-sub t0 a3 s11
-mulhsu s4 t5 t5
-remu s8 t5 gp
-sll t6 t4 t4
-sub t3 t4 a2
-remu s1 t0 a5
-mulhu a3 s4 a7
-slli a5 s5 7
-srai t6 a2 11
-srai t0 s5 19
-xori s4 s3 -821
-lui s1 368832
-rem a3 a3 t5
-andi s5 t2 310
-srai t6 s3 27
-auipc s3 402920
-sltiu x0 t0 -1134
-slli gp s0 15
-add a0 a5 s2
-andi a7 a3 -35
-sltiu a5 s10 695
-srai s3 t3 6
-srl s2 a1 s8
-srai s9 ra 29
-ori a7 a1 -563
-mulhu a2 t1 gp
-xor a3 s0 tp
-remu x0 a2 t4
-add a6 a3 s4
-slti a3 t2 -1860
-mulh s5 s1 t2
-addi s6 s6 1903
-div s5 s10 tp
-sub s2 a4 t1
-srli a1 s4 29
-and s1 s2 s4
-ori a4 a6 1563
-srai x0 s9 8
-slt s3 s7 s9
-mul a5 s4 s6
-andi s7 s7 -1895
-auipc s9 89064
-addi t5 s1 1712
-mulhu t1 a2 s1
-div a3 t0 x0
-slli s2 a2 19
-slli s2 s7 12
-srl t0 a1 t1
-mulh gp s2 t4
-and tp ra a0
-and a2 t3 a0
-sub s0 s2 tp
-remu s2 t2 tp
-ori s10 t3 1145
-mul a5 a4 ra
-rem t6 s11 s9
-srl a3 gp t4
-slli s11 ra 25
-sltu s4 s2 s6
-sub t3 t2 gp
-xor x0 a4 s4
+andi s11 s3 217
+srli s5 t5 7
+mulhsu s11 s3 a7
+slli tp a7 9
+mulh s9 t3 tp
+xor t6 a4 s5
+or s1 s5 s10
+srli tp gp 20
+addi a4 t1 1066
+xor s2 t2 s8
+or t4 s11 tp
+mulhsu a2 s3 a0
+div t1 t1 t0
+lui a0 9206
+addi ra t2 -1071
+div a5 s4 a1
+xor s2 s0 a3
+divu tp ra t5
+andi s3 a1 -1642
+rem gp t1 s7
+slti a3 s3 -1468
+sltiu a1 s7 483
+srai a1 t1 19
+slti s3 s8 -1841
+div a6 a4 s10
+lui a2 610096
+mulh gp t5 a3
+srl s10 s11 s1
+slt s11 s9 ra
+slti s1 t1 -850
+xori s1 s2 1417
+srl a1 s8 t0
+andi t5 gp -689
+srai t5 t4 25
+addi s6 s3 1649
+xori a3 a2 548
+srl gp a1 s9
+rem s1 a4 s7
+rem a6 t6 s11
+slli s2 x0 18
+andi s5 ra -1644
+slt s0 gp a4
+sub s6 s8 s0
+add s1 s1 t6
+div s6 t3 a6
+sub s1 t0 s3
+srli s2 s5 12
+auipc s2 775308
+slt a4 s9 t1
+sltu ra t6 s0
+and s3 a2 t6
+mul t1 a6 a2
+div a4 ra s5
+or t5 a1 a3
+sub a4 a0 x0
+sra s4 s6 t5
+sltiu t5 s11 1114
+sltiu s6 s6 628
+xor s4 s4 s3
+srai a7 a5 25
+mulh a0 gp t6
+sltiu gp t4 -1541
+sub a5 s11 t2
+xor s5 s11 a6
+lui t4 609438
+ori s11 a3 1227
+or s5 s0 s7
+rem a4 gp s11
+or s5 t2 t5
+mulh s0 gp t5
+srl s0 a1 s2
+rem t6 s4 t2
+slt s6 a1 s6
+slt a2 t5 a0
+andi s3 t1 -622
+mulh s9 s3 gp
+sub a5 a7 s7
+addi a7 s9 -1626
+div s1 a5 s6
+remu s4 a2 a4
+ori t1 s4 388
+auipc a1 601204
+srli s8 t0 24
+sltiu s6 t2 -1831
+mulh t0 s11 t5
+sltiu a7 gp 858
+sub s6 a1 a7
+ori tp t0 -2014
+mulhsu a1 t6 t3
+sub a2 s7 t3
+or t6 a6 s11
+xori s8 a0 1701
+mulhsu a6 s1 x0
+slt s3 a5 t1
+auipc t6 304042
+sra t6 a7 gp
+srl a3 s4 a7
+srli a0 s11 19
+or a3 s5 s8
+slti a6 a2 -246
+slti s6 s2 788
+mulhu gp a3 t2
+xori t0 s10 -1958
+xor s7 a5 a5
+slli t2 s2 13
+add s0 t5 t3
+and a4 a2 s2
+xor a3 s9 s2
+slt t2 gp s10
+srl t3 a7 x0
+rem t1 a4 t6
+sltiu t3 s6 -1347
+lui s3 526960
+addi t6 t4 1032
+xor s9 t6 s1
+srai a4 t6 12
+xori s2 s7 1665
+ori s1 x0 -1312
+xor t0 t0 tp
+mulh t1 s4 s2
+sub t5 s5 s11
+sltu t4 a2 a5
+mulhu t1 s10 a1
+sra s8 s1 t6
+andi s3 s10 348
+srli t0 t2 23
+mul s9 tp ra
+div x0 a3 s7
+mulh tp a7 tp
+slti gp t5 -949
+slti a6 s6 1516
+mulhu t6 a1 s0
+sub s0 t5 s3
+divu t6 s5 ra
+sub s7 s8 s10
+mulhsu t5 s5 a6
+mulhu s4 t4 s1
+auipc gp 299141
+slti a7 t0 514
+sltu gp s11 a6
+xor s2 a1 s8
+slt a4 t6 a2
+slt s0 t2 a3
+mulh a6 s6 ra
+sub a0 a2 x0
+sra tp s10 t1
+add gp s11 s0
+and s1 a0 t1
+mulhu s11 a2 s0
+slti t6 a2 -24
+slti s6 a2 -860
+xori s6 t0 1517
+srai t6 s1 3
+sltiu a1 ra -279
+srl a1 s3 a7
+mulh s8 a5 t3
+sll a5 tp a0
+auipc t0 534894
+sub a4 t3 t6
+mul a2 s5 gp
+xori s8 t4 -1835
+sltu a4 s9 s8
+mulhsu a0 gp s5
+sra t6 s0 t4
+mul a1 tp s5
+auipc s1 774732
+mul s5 t4 s7
+sltu t2 a6 s11
+lui s10 684844
+and s11 t3 s8
+andi a3 a0 2037
+lui a5 70652
+andi gp a6 -949
+add s7 a4 t1
+sub x0 s8 s6
+sra s11 tp s10
+sltu a1 gp gp
+slli a3 s6 28
+or s7 t4 s0
+sra s7 s3 t3
+mulhsu s10 t6 t1
+auipc s0 1008720
+mulhsu s10 a2 s7
+div s3 ra a7
+rem s3 a0 a2
+sltu s4 a2 a4
+slti a4 t6 -1944
+slt a7 t1 s1
+slt s6 s7 s7
+mul s0 t5 gp
+mul t2 t5 s7
+slti a5 gp -1483
+slli s5 t5 29
+srli a4 s1 18
+addi tp s8 -1644
+or s7 ra s11
+xori t6 ra -1745
+lui t6 856159
+xori s2 s8 -1290
+andi s2 s9 -906
+auipc s9 933163
+andi t3 t2 1572
+and tp a3 s4
+auipc t1 852068
+slt a5 s1 s11
+rem s6 s3 t5
+xor x0 s1 s7
+slli x0 s6 15
+sltiu s3 s6 -1726
+div s11 gp s4
+sra a5 s4 s0
+slti ra t4 -1323
+slti s4 s8 -353
+div s11 t2 a5
+slli a3 t3 8
+slli t3 s4 10
+remu s7 s6 t6
+sub t4 s1 s7
+srl t3 gp s11
+ori s4 gp -1968
+sra a1 t3 s0
+remu a6 a7 t0
+xori a0 gp -104
+xor s9 a0 s2
+xori t1 a3 -521
+and s0 x0 t1
+andi s0 s10 -46
+or ra a3 s1
+srai t5 a4 10
+slti x0 s8 -765
+srl t0 s1 a5
+sra a2 t1 a0
+ori a1 t3 -1781
+addi s9 t1 -648
+addi gp s8 -644
+rem a4 s8 x0
+divu a1 s5 s7
+add s9 gp s9
+xori t2 t0 1172
+and t5 s5 s8
+sub ra s1 a6
+sltiu t3 a4 -1361
+mulh s5 ra t1
+remu tp s5 t2
+mulhu t6 t5 a6
+srli t0 a1 7
+rem a6 s3 t5
+slt a2 a6 t6
+srli t0 s7 14
+andi a4 s7 -2044
+divu s3 t2 gp
+sll s10 t3 t5
+mul t5 t0 s9
+rem s3 tp t2
+mulh s9 x0 a4
+or s0 t0 a5
+mul a5 t5 gp
+srai ra s6 5
+slt s0 t2 a3
+add a2 s1 t1
+xori t0 tp -942
+ori s2 s10 -1216
+mulhsu s1 a6 a0
+slti a7 a2 1615
+slt t3 a4 a7
+and gp gp s11
+slti t2 a6 996
+auipc a7 980430
+remu a7 s5 x0
+srai t1 a3 15
+sra a0 s10 a7
+rem t4 s11 s5
+andi a1 x0 1753
+andi t6 t5 -1713
+remu t0 a0 t5
+lui gp 471574
+lui s0 550531
+divu a3 s5 ra
+sll s7 gp s0
+slli a4 a6 30
+xor tp a6 a5
+mul a4 s9 a0
+divu t2 t5 t0
+slli a1 a5 9
+srai s4 s7 29
+sra a4 t1 t1
+or a7 tp ra
+ori gp t1 204
+slti s11 a0 -1295
+slti a6 t0 -342
+slli t0 a0 24
+ori s9 s6 15
+mulh a2 s7 a3
+srl s5 s1 s7
+mulh s0 a5 t5
+mulhu a0 t6 s6
+sub a2 t2 a1
+divu a5 s7 t3
+mulh t5 t2 s11
+srai s3 a5 21
+and t6 s11 s4
+rem gp s9 a5
+ori s9 s0 248
+or a0 t0 s9
+rem s5 t1 s2
+div tp s2 t4
+srai t5 x0 5
+slli t6 t0 18
+rem s7 t5 ra
+slti a1 ra -945
+slti s4 a1 -1815
+sra a1 tp x0
+divu t1 s10 s10
+sra t6 t1 s9
+sltu a7 a3 a1
+mulhsu s5 a6 s3
+srl t3 s7 a3
+slli t4 a6 17
+addi a1 ra 1436
+and x0 s4 a6
+andi s8 s1 -1455
+xori ra s5 -1822
+or s4 s5 s3
+mulhu t1 t2 s4
+srli s6 ra 21
+xori s2 s0 -198
+mul t0 t4 a3
+slt s1 a0 t1
+rem a7 a1 a7
+and t6 a6 t4
+sra ra a2 a7
+sub s10 a0 a0
+divu s1 tp a7
+sltu s11 s6 a5
+andi t0 t4 1559
+mulhsu tp s2 s11
+sltu s11 s10 s7
+addi a6 t1 867
+add s0 t5 a0
+auipc s0 606769
+mulh tp a0 s6
+mulhsu gp gp t5
+sltu t2 tp s9
+srl a7 t4 x0
+andi s1 a5 -97
+andi s11 ra -1074
+sub t5 a0 tp
+div s9 s4 s1
+divu t6 a6 a3
+mulhsu t6 s2 s7
+mulhu s6 t1 a7
+xor s7 a5 t6
+andi t0 a0 -112
+sub s8 s8 a6
+sra t0 ra a3
+or s6 s9 s1
+srli s4 t3 22
+srl tp s10 s10
+sltiu ra s10 -767
+div gp ra s8
+srai s9 s2 4
+srl a6 s11 t4
+ori s7 ra -717
+ori a3 s5 -336
+sltu a0 t1 a2
+sltiu a4 s5 1055
+sll a0 s11 t4
+add s5 t0 a5
+sra a3 ra t1
+div s11 t3 t0
+slli s4 s1 10
+add a1 a0 s7
+sltu s0 tp a0
+divu a2 s0 t2
+sra s10 s4 s5
+and t3 t2 a4
+srli t5 t0 1
+rem a7 a5 s7
+srl s2 a3 x0
+mulhu s0 gp gp
+remu x0 x0 a4
+srai a4 s5 16
+sra a6 t1 s11
+slti t1 a3 -2030
+sltiu s3 a3 1000
+mulh t4 x0 ra
+divu x0 a2 t2
+addi ra a5 -339
+srli a5 s2 9
+div a5 t5 s2
+sra t3 t2 s4
+mul t5 t0 tp
+sll s5 s4 s7
+srl a1 a3 s7
+lui ra 961477
+sll t1 s3 s7
+xor gp a5 a4
+sll s6 s0 a3
+sltu t4 s6 a4
+ori s0 a4 1823
+sltiu t3 t3 -1828
+mulh s1 t1 t0
+rem s0 s10 s6
+auipc ra 772121
+addi t6 s6 -554
+mulh x0 s7 a3
+ori a5 t5 -736
+sub s9 t1 s11
+srai s11 s5 19
+slli a0 a0 22
+andi a7 a2 374
+srai s11 x0 3
+srai t5 t2 1
+or t4 a7 t6
+slt a3 t4 a4
+ori t5 s4 -1595
+or tp s11 t1
+and t4 s0 t5
+addi s0 t4 -307
+sra a6 a5 t5
+andi t4 gp 1968
+and a0 s2 s5
+addi s2 s6 -1082
+mulhu t0 a1 ra
+auipc t0 757811
+mulhu x0 a5 s8
+addi t1 s7 -1328
+sltu a0 t4 ra
+slli t6 t4 19
+or t3 ra a3
+or gp t4 a5
+xori ra gp 1159
+sltiu a5 t5 647
+mulhsu ra a0 s6
+or a6 s9 s9
+xori s9 a6 -1762
+mulhsu a1 s2 s11
+auipc t4 514434
+sll t1 t4 a1
+rem t0 s8 a3
+mul a2 t6 s5
+sltiu tp s11 -1806
+sub a5 s11 s10
+srli s9 a0 9
+addi s11 x0 -1398
+or a3 s2 t1
+sra tp gp x0
+srai s5 t5 23
+mul a1 s3 a7
+add s0 a0 gp
+mulh gp s2 s1
+slli t1 a4 15
+mulhu t0 a7 a1
+xor a7 a3 t5
+mulhsu gp s5 t0
+mulhsu t0 a0 s6
+lui t5 60948
+mul s5 t6 a3
+ori tp s3 -1400
+div s4 s1 s9
+sll a4 t6 s3
+slt s5 s2 a0
+slt s0 t1 t1
+rem a5 s6 t5
+sra t4 s2 a3
+lui a5 691584
+slti s9 s0 465
+srai gp s8 22
+xor s2 gp t3
+slli s2 t6 2
+xori t4 ra -224
+mul t2 t2 s5
+slti t1 s0 -1152
+mulh s9 t1 t2
+sra a0 a7 a3
+srli t5 s3 23
+srli x0 s0 21
+srli s3 a4 13
+srli s5 gp 22
+andi a1 a3 -270
+srli t1 s3 20
+srai a5 t4 26
+ori s2 a5 -704
+rem a5 tp t5
+srli tp t1 4
+lui a6 182247
+slti a4 s4 -1413
+srl t2 s9 s2
+addi s9 a1 -663
+slt s4 a5 tp
+sltu s10 t4 t3
+andi a1 a7 1811
+srai ra ra 5
+andi tp s1 1643
+auipc t0 317178
+mulh s1 gp s8
+auipc s9 49580
+slti a3 a5 853
+lui a3 320757
+sll t3 s1 s1
+divu tp a4 x0
+lui s2 167912
+sltiu ra s4 -290
+add x0 a0 gp
+ori x0 t6 -740
+auipc t1 328311
+mulhsu s0 a6 s11
+lui a1 410926
+slti x0 s2 -493
+sltiu a4 a2 836
+div x0 s1 s4
+mulh ra a2 s9
+mul gp ra a7
+rem gp x0 gp
+mulh s8 s5 t4
+srl s6 t0 a1
+sra s6 t5 s3
+sll a2 tp t0
+and x0 s7 a4
+divu t5 s3 t4
+sltiu s4 a5 -587
+auipc t6 519054
+addi s1 a1 1332
+srl a3 s7 a6
+slti a6 s3 -1402
+srai a6 s7 6
+div t1 ra a3
+xori s10 s2 1183
+xori a1 t5 -411
+xor a7 s7 a3
+sra s7 a7 s9
+rem s0 gp x0
+sltu t1 s5 ra
+sra a1 a3 s9
+div t2 s0 tp
+slti t0 tp -1147
+mulh s8 x0 tp
+rem s9 x0 tp
+srli a1 a6 2
+auipc a5 874309
+srli s6 s2 19
+sra t3 a4 gp
+ori s9 s9 917
+div s4 a7 ra
+srli a7 t5 10
+div t1 tp a4
+lui t3 1047702
+addi a0 s1 979
+remu s10 a0 a4
+srl t2 s0 t5
+xor s10 gp s0
+srl s3 s7 ra
+sub a1 x0 a5
+xor t3 s3 s4
+xor x0 a5 s2
+sltu s10 a2 a1
+mulhu ra s7 s7
+mulhu t2 a7 a6
+rem s5 s3 a5
+rem t6 t0 s9
+slli a0 s4 14
+ori s3 s1 -1214
+sub s6 t4 s9
+slli s6 t0 18
+sra s8 s3 s1
+addi s3 a2 -583
+ori t5 t3 -1985
+sub t6 s4 s0
+or a2 a0 s4
+mulhu t0 t3 tp
+sltiu t2 a1 -754
+slti a6 ra -1367
+xori a7 s11 553
+mul s11 s3 s8
+or s10 s5 t3
+add t3 a1 ra
+or s4 s0 s1
+xori ra s1 -702
+and s10 t3 s6
+srl a4 a6 s8
+slli x0 tp 11
+srl a6 x0 tp
+addi s2 a4 -1766
+xor a7 t5 s11
+rem x0 s9 s10
+srai a1 s10 2
+slt a3 t0 a2
+srl a5 s5 ra
+sll a5 tp t2
+sll s6 tp a2
+remu t5 a7 s2
+remu s5 s9 s4
+and s1 s4 t6
+srli t2 t1 25
+slt s10 s5 s5
+add t2 s10 a6
+slli s10 s9 31
+sll a7 s8 s1
+andi a4 a0 -1674
+srai a7 x0 12
+xor a2 a1 a5
+mul s11 a6 a3
+add tp ra t0
+mulhsu s7 s5 tp
+sub t6 t6 s0
+lui s10 754493
+mulhu t5 a3 s1
+xor t5 a7 s6
+div s4 s9 s5
+and s3 s4 s5
+sltiu gp s1 923
+lui a2 623160
+mul s8 a0 a1
+srl t1 s7 t3
+sltu a6 tp t3
+divu s0 a6 s3
+or s7 s0 s5
+sub ra s9 s0
+auipc s6 577260
+div t5 x0 t5
+slli s9 s1 31
+mulhu a6 a2 t5
+mulh t0 a0 s0
+addi a4 a3 -675
+sltu t3 s11 s0
+srl a5 tp t1
+slli gp t0 1
+add s2 s10 s9
+slli t1 ra 27
+ori t4 s3 1583
+srl s7 tp a2
+slt s1 a2 s3
+slti a2 s4 -1321
+sltiu t6 s6 -1176
+mulhu t0 tp s7
+slli t5 s2 15
+mul t5 s6 s3
+mul a6 t0 a2
+xori s5 t0 -1661
+div s11 s11 t5
+srai a5 ra 23
+auipc s9 199012
+divu s4 x0 s7
+andi tp a0 928
+ori gp t1 -1514
+xor s9 t4 s6
+xori t0 t1 -1509
+mulh t2 t3 s10
+sltu t3 a1 a7
+mulh a0 a0 t0
+sub s11 t4 t2
+rem s10 a5 a6
+slti a4 a6 -730
+xori s4 t1 89
+mul gp a7 s0
+lui s4 591470
+slt a4 a2 a4
+sltu ra tp a2
+mul t5 a6 s9
+divu x0 s4 tp
+andi ra s10 -767
+xori t2 a1 -222
+addi t5 a5 -1429
+srai t4 t3 11
+auipc t2 516435
+divu s10 gp t1
+srai t5 s2 21
+slli t2 s5 30
+srai s10 s0 18
+mulh s10 s8 s5
+slt t4 s1 gp
+auipc tp 675415
+mulh a4 t2 s7
+mulhu s3 tp s2
+addi s5 s3 604
+mulh s11 t4 t2
+and x0 s6 a1
+rem t1 t3 s6
+divu s5 gp a6
+addi a7 tp -1500
+xori t1 a7 1210
+divu a3 t1 a3
+addi s6 t3 -382
+mul s10 t3 a4
+remu s10 s2 s9
+andi a0 t0 749
+and s0 s10 gp
+div s0 a3 t4
+srli t6 t2 17
+xori s8 t3 -490
+xor a7 t0 t0
+srl s6 s9 a6
+or a6 s0 t0
+slli a2 a4 28
+slli x0 s10 7
+div a5 s6 t4
+ori a0 t6 -1133
+andi s10 s8 -1177
+add t0 s6 s2
+xor s2 a0 a6
+srai s9 a3 10
+sub a1 t0 gp
+divu t6 a1 a7
+addi s6 s4 -2041
+xor a0 s1 s1
+auipc a0 859816
+auipc t1 755483
+slli x0 gp 19
+mul a3 s7 s11
+srli s8 ra 9
+rem a6 s4 tp
+slti t6 ra -1724
+or s5 a1 s1
+mulhsu x0 s0 s9
+mul s8 t5 a6
+mulhsu s3 a1 gp
+sltiu a3 t5 -1390
+and s1 t3 s10
+andi a3 a2 -1720
+div t1 a2 a0
+sll a6 t6 t5
+slli s4 a4 14
+mulhu x0 s7 s1
+auipc a0 802565
+sra t1 a4 a1
+divu s5 t1 a6
+xor t2 a0 a0
+srai t3 s5 2
+mul a6 s6 gp
+remu a1 s11 s10
+div s4 gp s9
+slti t2 x0 -212
+add s7 gp t2
+sltu t2 s9 s1
+rem a1 s2 s8
+auipc s6 237563
+lui a3 552089
+addi a3 tp -1512
+xori s0 t1 -1227
+sll ra s4 a7
+addi t4 a4 -1418
+sll s2 t5 s1
+xor x0 s7 s10
+mulhsu a7 t3 t5
+slti s11 t0 887
+divu tp s2 ra
+add t6 a5 tp
+sra s8 s10 s2
+addi a2 t6 -66
+mulhsu a4 x0 s10
+or s5 a5 t1
+mulhsu s4 a2 a4
+sub t5 a4 s8
+rem s7 a4 s1
+and s3 a7 a3
+srli ra t4 18
+auipc s11 719710
+andi s6 t0 1647
+srl s6 s6 t0
+srli s5 a3 10
+sltu s0 a3 a2
+srai s9 t0 12
+remu t5 s2 a0
+mul t1 s8 a0
+sra t6 a0 a4
+rem s2 t5 s5
+mulhu t3 s3 t0
+lui s4 980343
+srl s10 t6 s11
+srl s1 s6 t1
+sltiu t1 a4 -517
+mulhu s8 gp gp
+mul x0 a6 ra
+lui a3 19389
+remu s11 t0 t3
+rem a1 s8 s6
+srli a3 tp 0
+remu s0 s6 t1
+srl s2 t0 x0
+ori t2 s2 1104
+srli gp tp 24
+mulhsu t1 s10 a0
+rem s8 a3 s10
+add t4 s7 s8
+slli a4 a6 7
+sra s5 x0 a3
+slt a7 s2 s10
+auipc a1 967587
+auipc a7 364854
+slli a3 t6 17
+remu s7 s8 t5
+div a7 s8 t5
+auipc t1 817851
+or s11 s4 s10
+auipc s3 57302
+mulhu t0 t5 a1
+mulh a4 a6 s8
+xor a1 s5 s7
+remu s2 s9 a3
+srl x0 a2 ra
+or ra t4 s9
+rem t2 s11 a4
+sra a1 s4 t3
+mulhsu s10 gp a6
+mulhu s2 a0 tp
+addi a4 s0 -737
+remu s6 s1 a4
+mulhu s1 a0 t5
+add s4 a3 s5
+sltiu s2 s9 -451
+or s10 s2 a4
+remu t5 t4 t1
+sltu ra s4 s9
+mulhsu a5 a0 s3
+sltu a2 s0 ra
+slli s2 a4 25
+ori a3 s5 2014
+div s10 s7 gp
+addi t5 s9 -553
+mulhu a0 t5 s3
+addi a1 s10 1650
+addi s2 t1 855
+auipc tp 604694
+sub a4 t4 t1
+mulhsu s5 a0 s11
+ori gp a7 1779
+rem gp t1 s10
+add s1 a2 s1
+xor a6 s10 a1
+mulhsu t4 tp t5
+mulhsu t2 a7 a2
+rem a7 a0 s10
+mulhu s5 t4 a2
+auipc s5 52320
+add s5 s5 s2
+add t2 x0 s9
+sltu s5 s2 s8
+rem a2 t5 s0
+ori a1 s0 -657
+ori s3 a4 -262
+mulhu a7 gp a2
+sltu s8 a3 s0
+sltiu s2 t2 -782
+mulhsu ra gp s3
+xor s5 s0 s9
+rem s11 x0 ra
+divu t6 t1 t1
+srai a1 t6 20
+add s6 a4 gp
+addi s2 s1 -1179
+lui a1 26636
+remu s9 a4 s6
+divu tp t4 s4
+xor t0 a3 s4
+andi t0 a6 -170
+andi a5 t3 -1528
+div s7 a6 t1
+mul s1 a5 gp
+sra t3 s5 a2
+remu tp a2 t1
+sltiu s1 s9 764
+slli a6 s6 16
+xori a4 a7 -679
+mulhu a2 a3 t3
+srl t2 s0 s10
+xori a7 s8 -1817
+mul s9 t4 a2
+divu s2 t0 a3
+xori s9 x0 -983
+sltiu t0 s8 -1491
+mul a6 a0 a0
+sub s6 t1 s11
+srai gp s0 10
+sltu s9 s10 s2
+sltiu gp a7 -1054
+srl s6 t5 s8
+slli ra s9 11
+slli t2 s9 24
+srl tp s11 ra
+addi a0 t5 -175
+slt s5 s8 s0
+auipc a3 580278
+or a5 s11 tp
+sll s5 gp s5
+slli gp a5 6
+or t2 gp t0
+mulhu s4 s9 s10
+sltiu gp s7 -1003
+slti s6 t1 1645
+mulhu gp a2 a4
+lui a4 20853
+andi s9 a4 -334
+divu s10 a0 s9
+div gp t1 gp
+and ra tp t5
+slti s4 a0 267
+xori t4 s5 -1868
+sltiu ra s1 1149
+xor a7 ra s6
+sltiu t2 a7 -1142
+sltiu a5 s11 252
+remu x0 s11 x0
+sll t0 s5 a4
+mulhsu t6 s3 a1
+mul a7 s8 s8
+slt s8 s3 s6
+or s1 a5 t6
+slti a6 t5 -1966
+mul s3 s1 s5
+sltu a7 x0 t3
+xor s4 s9 s2
+or s8 a2 t1
+srl s11 s2 t5
+add a3 s11 s7
+addi t2 s7 -1899
+srli a3 s6 0
+mulh s11 s0 t0
+mulhsu s0 gp s0
+sub a6 a1 s3
+sltiu a6 s0 -919
+xor s4 ra s3
+sltiu s1 a5 1129
+addi s9 t0 482
+sltu s5 a2 ra
+slli s5 s3 9
+rem a4 a7 s8
+sll x0 s8 s11
+srl a4 ra s5
+sll a7 s0 a7
+add s2 tp t6
+sub gp t2 a2
+xori t0 s7 1521
+rem s1 s1 a2
+mulh t6 t2 s1
+mul s2 t4 s8
+sltu gp a4 t1
+divu a0 s7 s5
+and a3 a7 t5
+lui s9 155853
+and s5 s2 s3
+xori s2 x0 1263
+ori a2 a6 -738
+sub s0 a2 ra
+srli tp s9 0
+sub t1 t6 s10
+slt tp t0 a2
+rem t2 x0 s8
+xori ra a6 871
+mulhsu s5 t5 t3
+add t1 s7 s3
+srai a1 s2 3
+mulhsu a4 s5 tp
+sub s10 s7 ra
+ori a5 t4 -1626
+addi s10 a0 -207
+or a2 s0 a5
+xori t1 a2 -1634
+lui a1 793645
+mulh a6 tp tp
+or gp a7 s4
+rem a2 a5 x0
+srl gp t5 s6
+sll t4 a6 t1
+and gp s11 t3
+andi a7 a5 1440
+ori x0 t4 361
+slli t5 a5 24
+slt a4 x0 a1
+remu a6 s3 t3
+xori s1 s1 -499
+slti x0 s4 903
+slti s10 t6 -124
+or tp a3 a7
+addi a5 a7 1096
+srl s7 x0 s5
+ori s3 t0 -1855
+addi a4 a1 -1192
+add a5 a3 s9
+srli a2 tp 15
+andi s10 gp -2
+mulh t1 ra a7
+slt a1 ra t4
+sltiu s2 x0 -1028
+and s10 a3 a3
+srl s9 gp a0
+lui x0 816135
+mulhsu s8 a2 gp
+or s3 ra tp
+srl x0 t6 a3
+xori t3 a4 -311
+add s7 s7 s6
+slti s8 gp 1365
+and s0 a2 a1
+mulh s9 s8 a7
+xor s11 s11 s4
+andi t6 s5 598
+add s7 t4 ra
+sltiu s7 s1 -1073
+xori s7 s2 680
+or s1 x0 a5
+sltiu s5 a1 970
+mulhsu t6 a2 s11
+divu s3 s7 a4
+sra a6 t5 a3
+divu ra s10 s5
+xor t4 tp t5
+srl a5 s3 t4
+srai t1 a0 13
+ori t2 a0 -1875
+div a3 gp a2
+rem s10 s1 s11
+lui s2 741285
+slli a6 a7 14
+slti s0 gp -1822
+sltu s5 a2 t0
+slti s10 tp -294
+sltiu a2 tp -1706
+lui ra 62903
+srai a2 a2 17
+mulhsu s2 s7 s2
+xori s7 x0 -55
+and s0 a5 s5
+srl a7 s3 a2
+auipc t5 275143
+or a6 a7 t4
+mul x0 a1 t1
+divu a1 t5 a1
+lui t0 409602
+slti a4 s4 -1357
+or t2 s9 s1
+sll s7 t2 s8
+addi s1 a3 1975
+mul gp tp s6
+mulhsu a5 a5 t0
+mulh s7 a3 gp
+and a7 a5 t6
+rem x0 s9 a0
+srl s1 s1 s5
+xori s11 t5 -1423
+xori s6 s1 -370
+auipc s4 107252
+rem t4 s6 t3
+sra s8 s6 s8
+mulhu s10 t5 ra
+remu s4 s9 s3
+ori s10 gp -1352
+srai tp t1 16
+slli a4 s1 3
+add ra t1 s5
+sll s11 s10 s0
+addi a1 t0 -980
+remu a6 t2 s4
+add s3 x0 s9
+srl s1 s5 t1
+xor a6 s8 a1
+sra s4 s9 s2
+and s11 s4 ra
+andi ra a7 -1052
+add t0 a4 s9
+mulhsu s7 a1 t2
+sltu s11 s5 s6
+srai t0 t0 3
+srl s3 s1 a4
+sltiu t0 s4 -1477
+slt s3 a4 a6
+mulhsu s8 s6 a0
+rem a0 x0 a1
+xori a4 t0 -1139
+sll t5 s0 a4
+slli s11 s8 21
+srli a5 a5 18
+srl s1 t1 a6
+xori s0 a1 137
+sltu t0 tp s3
+sra s9 t5 t4
+xori a1 s9 -1925
+xor a4 a3 x0
+ori a4 ra 1014
+slti a3 t2 -1875
+and tp ra t5
+sub s5 t5 s9
+addi t2 t0 161
+xori s11 s3 215
+xor a4 t6 s11
+slli s5 s3 23
+addi a5 a4 967
+sra a4 tp t6
+andi t2 t4 -1211
+slt s7 a3 a5
+add a0 s2 s1
+auipc s11 478784
+srai s1 a0 17
+xori gp s6 -1848
+auipc t2 789792
+slt t6 s8 gp
+xor a6 s4 t3
+rem ra x0 x0
+div t1 s7 s3
+mulhu s10 t4 t3
+and s1 s5 s4
+mulhsu tp s5 t2
+remu t4 a5 ra
+div a7 gp a3
+ori a6 s10 -1135
+srl x0 s1 s3
+lui a3 477652
+sltu gp t1 t5
+srl t5 x0 t6
+mulh a2 t6 ra
+slti s7 a6 28
+addi s7 t4 -498
+rem a3 s7 a6
+add a1 a1 a4
+div t6 s9 a4
+mulh s9 s7 a6
+sltiu t3 s7 -830
+andi s5 t2 -1371
+divu s3 s10 s9
+mul t0 a5 s4
+auipc a0 862153
+rem s9 t4 s6
+srai s0 s3 30
+slli s7 ra 15
+slli t1 a2 14
+sra a4 a2 s3
+remu s6 t6 t5
+sll a5 s7 a5
+srai s4 a6 29
+auipc t5 1043179
+and t5 s0 t6
+mulh s7 t5 a5
+mul tp tp t6
+sub s4 s10 t4
+slli s8 gp 22
+xor t3 s0 a7
+srli s7 s6 12
+rem tp gp s1
+rem x0 s2 s5
+or s4 t4 a6
+sltiu gp t6 -961
+xori t3 s4 -1291
+auipc t1 800367
+remu t6 a2 s3
+div a3 a6 t1
+addi t3 s11 1142
+srai a6 gp 22
+xor t3 x0 t0
+srli x0 s4 21
+lui a6 220579
+rem s7 s7 a4
+xor t0 t1 a2
+div s3 ra a5
+slli t6 t4 14
+sub a3 s5 s6
+slli s6 t3 6
+mul a7 t6 s0
+srli s9 t1 2
+mulh t2 a1 s6
+sub s3 a3 a0
+remu a6 a7 tp
+divu s3 t3 t4
+divu gp t0 t0
+div s6 s7 s5
+andi s1 s5 -844
+and t6 s5 s3
+divu x0 s10 t2
+xor s11 s0 s0
+mulh a5 a3 s10
+ori a1 s11 -398
+xori s8 s3 -598
+slt a5 tp a6
+mulhsu s5 s1 s3
+mulhsu a0 s9 t5
+add t5 s7 tp
+sub tp a0 t6
+sltu s6 a5 s5
+add t3 tp s9
+slt t3 a6 s2
+divu t2 s5 s9
+sltiu s0 gp -1248
+div s6 s7 t6
+sll a2 s10 a6
+divu a3 s6 t6
+sltu s0 s3 s1
+slli s0 t2 22
+rem a2 a2 s3
+sltu t6 t1 t6
+mulhu s5 ra s0
+div s2 a2 t1
+slli a2 t5 14
+srli s11 tp 22
+rem a2 s6 a0
+mul s2 s0 s1
+sll t5 s0 s0
+sll s1 tp a5
+addi t6 s7 -1727
+rem a1 a7 gp
+or s6 ra t6
+remu s8 a6 s11
+srl t0 s3 a0
+or a5 s4 s2
+slti t0 s0 -1882
+sub s8 t2 a2
+sll t4 a7 gp
+addi s1 s2 -185
+sltiu a4 a0 -1411
+sltu x0 s3 s3
+srli a0 s0 31
+xor gp t1 s5
+add x0 t0 a3
+sll t5 s2 ra
+slti t0 x0 -1041
+sltu a4 s9 x0
+divu s4 t1 a0
+srli x0 s6 26
+xori a0 a2 -1529
+sltiu t5 t2 -237
+mulhu s11 a2 x0
+div t4 a0 s2
+addi s9 t0 452
+sub a4 s2 s10
+ori a7 s5 -1410
+slt s7 s6 t4
+addi a4 x0 -1750
+sltu tp ra x0
+srai t3 a5 26
+xor s9 t1 s2
+sra s3 a5 tp
+xor s10 t6 s3
+div s3 s4 s8
+srl tp t2 t6
+divu s10 gp t0
+sltiu a0 s2 -404
+div s7 a0 gp
+add s1 gp s6
+lui a4 244824
+sll t6 s0 s11
+sltiu ra t2 -1292
+srli a1 s10 1
+slt t5 s9 s8
+add s8 s5 s5
+mul a0 s2 s9
+rem t4 t4 a2
+and ra a5 ra
+srai s6 s2 20
+sra s9 t5 s11
+div tp t1 tp
+slti a6 s5 908
+xori a0 s9 549
+div a1 t0 a2
+sra tp t0 s6
+rem s1 s8 t2
 srli s10 s11 26
-sll ra s9 s5
-sra a1 s6 s8
-xori s8 x0 596
-or t5 s10 ra
-divu a6 x0 s7
-slti s4 t0 -491
-xori t1 s9 324
-slti s11 t1 1993
-sltu a1 s8 s8
-srli ra a7 30
-remu t2 a0 a6
-add t0 s1 a2
-slti a7 ra -358
-sltiu t2 s7 -792
-auipc a2 112097
-auipc t2 518428
-mulhsu s11 s8 a5
-or s1 a1 t2
-mulhsu t5 a7 t3
-remu s7 t5 a1
-divu s10 t2 s1
-lui a2 960835
-and s11 ra a6
-sll s3 a5 a4
-slt a2 s8 s10
-mulh a3 s8 a7
-srl tp s0 t2
-and x0 x0 a6
-remu s1 t6 s0
-divu s2 a3 t5
-sll x0 a1 x0
-srl s2 a7 a3
-ori a4 s1 -1857
-div ra gp a1
-or gp t2 tp
-sltu a1 a5 t0
-auipc t5 180889
-div a4 tp s11
-mulhsu a3 a0 s9
-lui t1 890778
-remu s5 t3 x0
-addi t4 s2 39
-mulhu a7 s3 s9
-mul t1 s7 s11
-slti s10 t4 -438
-div a7 s11 a5
-xori gp s10 -60
-mulhu s9 t5 s11
-rem s1 s3 s7
-ori a5 a1 -366
-div s1 s8 s10
-rem s2 t0 s11
-divu a3 a5 t4
-sub ra s3 s2
-addi t0 t3 -1600
-slt a6 s1 x0
-addi s2 a4 1391
-div ra s11 s1
-mulh a3 a4 t6
-sltu x0 t2 s9
-srai t0 s4 17
-sltu s2 x0 s7
-sra s7 a0 a4
-or s7 s1 a4
-add s4 a5 ra
-lui a6 1022375
-and a5 t0 a1
-sltiu t4 a4 1752
-auipc s2 168980
-div s11 t2 x0
-slt a2 t6 t4
-andi s2 s2 -312
-xor t1 t6 s0
-sra s4 t1 s2
-ori s6 gp -687
-xori t3 a2 1333
-sra s0 a0 x0
-sll a1 s10 t4
-ori s4 a5 -1266
-sub a2 s6 s5
-mulh s11 t5 t4
-srl t4 s5 s11
-slt a5 tp s1
-slt s10 a0 s2
-sltiu a4 a0 -872
-divu a6 s10 a6
-lui s1 184064
-sub s3 t0 t3
-mulhu s6 a4 t4
-xori s9 s5 -206
-divu s11 t6 s6
-and t6 x0 s11
-mulhu s6 t5 s5
-sra x0 t2 ra
-mulh s4 ra s10
-rem s4 s3 t3
-mulhu t2 a0 s1
-andi a4 tp 67
-and s6 s4 t3
-xor x0 s4 t4
-srai s8 t4 12
-srai a3 t5 20
-slti s9 s6 -725
-mulhu a1 t2 s1
-mul s1 s4 x0
-sltu ra ra x0
-ori t3 x0 -635
-sltiu a7 a1 1886
-xor x0 s6 s11
-div gp tp a4
-remu s2 a3 a5
-slli t2 t1 2
-slt a4 gp t0
-srai a2 t6 26
-xor t2 a6 s6
-sll s7 s7 a2
-auipc a1 57901
-mulh s7 t3 s11
-andi s7 x0 -1325
-or s9 a6 s6
-sub s5 s3 a5
-rem s2 s3 s3
-slti a5 ra -156
-xor a3 s0 t3
-slt t6 tp t1
-srl s1 x0 s1
-srli a5 s8 21
-sltu s10 s11 s3
-ori tp t3 383
-lui a1 180331
-remu t4 t2 t6
-rem t0 a7 s11
-srli gp s0 21
-rem a4 x0 ra
-sltu a7 s3 s10
-add a1 a2 s7
-div s1 a6 s7
-sll t6 x0 ra
-srli a1 s1 18
-mulhu t3 x0 t3
-mul tp a7 a7
-xori t6 t6 -2036
-lui s0 762730
-srai tp t3 5
-div s2 s7 t1
-sll t0 s11 a7
-divu a4 a7 t0
-srli a5 t1 20
-or a2 a4 a5
-andi x0 s0 705
-slli t4 s2 4
-xor a4 a5 s3
-or s0 t6 s0
-addi a4 t2 1688
-sll s6 gp s4
-srl s7 s8 t5
-div t4 s4 a7
-div ra s9 a5
-rem s1 x0 gp
-sra s9 t2 s6
-sub a4 t1 s4
-xori t6 s2 -1280
-ori a4 s9 206
-divu s11 a3 s1
-or s9 s9 s10
-divu a1 t5 a3
-andi t3 s0 11
-sltu s7 s4 s10
-or s2 s1 a5
-sltiu a4 s0 -619
-divu s0 t1 s6
-xori s6 s4 -1784
-slli s3 x0 8
-auipc s9 259853
-divu s7 a5 s0
-mulhsu a7 s0 s5
-srli tp s10 19
-xor t6 s1 s10
-sra a6 t0 a1
-andi t0 x0 -1535
-mul a1 ra x0
-slli x0 s4 25
-srl s5 a3 x0
-div t5 tp tp
-mulhsu t6 s6 t2
-xori ra t2 -757
-addi t6 s2 1608
-divu a2 s4 s2
-remu a6 s0 t0
-sltu s4 a1 a4
-andi s1 tp -1082
-remu s10 x0 t2
-divu t6 a2 a0
-sltu s8 s10 x0
-mul t4 t0 a4
-sub a7 a3 s1
-xor t4 s6 a0
-slti tp a7 596
-slti s11 a0 -1396
-srai a1 s11 7
-add s1 t3 s2
-sltu a4 s11 t0
-mulhsu s9 x0 a5
-sra a5 s4 t5
-srai tp s0 11
-andi s10 tp -1137
-mulhsu a4 t3 x0
-lui x0 151541
-sra x0 gp a2
-mul a4 s3 s2
-addi a6 s9 -564
-addi t0 a5 1051
-slli a5 s8 27
-sll tp s9 t2
-mulhu s9 s8 a3
-srl s11 s9 s0
-slt t5 a7 t5
-xor s2 a5 t2
-ori a1 t3 87
-add s11 ra gp
-srli s5 t6 6
-slli t5 a2 4
-sltu a0 s3 s10
-sltu a0 a7 s4
-slt ra x0 s10
-sltiu s5 s7 1577
-addi s9 t0 -253
-sll x0 s4 a2
-mul a3 t3 s6
-slti s1 gp -740
-slti s1 t5 -1259
-auipc s2 179728
-auipc a0 125273
-sub t5 a7 s11
-sra s8 tp s9
-slli t2 x0 14
-sltiu t6 s7 -892
-xori s11 a0 -1751
-sra a3 gp s1
-xori s1 a0 -512
-slti a6 t2 -270
-sltiu s3 a0 -158
-sub a7 gp t0
-addi s2 t3 -93
-mulhsu t3 gp gp
-and s1 s3 a5
-ori s2 s6 -225
-sra s7 s10 s0
-sll a3 tp t0
-lui s11 229274
-srli s10 s8 12
-mulh t2 a3 gp
-slt s8 a5 a5
-xor a7 x0 s10
-slli s10 s2 6
-divu a2 ra s10
-mulhsu a3 s11 s5
-mul t4 a3 t4
-lui t4 447030
-rem t2 a5 a3
-mul s4 t5 s7
-slti a2 ra -1758
-andi t2 t0 -685
-mul t0 s1 t3
-sltu tp s6 t2
-rem t1 s4 s8
-srai t6 tp 22
-add s0 t2 a2
-div t4 t5 a7
-srli s0 s11 29
-xori s8 a0 -1408
-sub t1 t4 s8
-add a7 s1 s1
-slti t2 s8 -1817
-srli s2 x0 5
-addi s11 a0 -5
-lui a6 753281
-sltu t3 s0 s10
-sra t2 s2 s11
-sltu a3 a4 a1
-sltiu s11 s9 2026
-ori a4 x0 -1864
-divu t3 t2 s1
-slti t6 a6 -1252
-sll x0 s3 x0
-lui t1 814731
-srli a5 s4 9
-xor t4 s10 s0
-mulhu t2 t3 s5
-addi a7 s0 1569
-srl t3 s7 a2
-srl s0 s4 a4
-mulhu s3 s9 a7
-slt x0 a1 a6
-srai s9 t1 11
-lui s3 672473
-rem s2 t1 a7
-remu t3 x0 s1
-add t5 s1 a4
-mul s3 tp s9
-andi tp s5 -1182
-auipc a3 977373
-lui x0 845721
-xori t5 a2 -164
-and s4 t0 t3
-mulh t2 a2 a6
-srai ra s1 8
-sll s9 t4 a7
-xor x0 a0 a3
-lui a1 255943
-add gp s3 s3
-sltu a4 s4 t0
-sra t0 a7 tp
-xori t0 t6 -404
-srli tp s0 9
-sltiu tp s0 725
-mulh s8 t2 a0
-mulhu a4 a6 s8
-addi a2 s11 -1734
-addi a3 tp -897
-sltu s4 s4 s9
-add x0 x0 t6
-divu x0 s0 s1
-ori a0 x0 -1596
-mulhsu s3 s2 a4
-srai a1 s11 19
-sra s10 a5 t4
-sub a3 ra a1
-add a4 a6 a5
-lui x0 858551
-sll s3 t4 s8
-srl ra t3 s1
-srli a0 t3 26
-mulh a2 s1 a7
-sll t5 s2 s4
-sra t0 t2 a0
-srli t0 s0 8
-mulhsu t2 a5 a1
-add a0 gp x0
-sll t1 gp s2
-lui s5 1002140
-slli a2 x0 30
-sub t2 x0 s2
-srl s5 t3 t4
-sltu t3 s2 a1
-remu t6 a0 s9
-add s5 tp t1
-and s4 a3 t0
-slt t3 a3 s6
-mulh a6 t6 t2
-div s4 s8 x0
-and t2 a7 s6
-sltu a1 gp s8
-srai t5 a1 15
-slti tp x0 -1956
-auipc s1 7490
-slli s10 x0 26
-mulhu x0 t6 a6
-andi a5 t5 -803
-remu s9 s3 ra
-rem s5 s7 t4
-sub t4 s2 s2
-ori s10 s4 -980
-xor tp t4 s5
-lui s3 694519
-add t6 t1 s8
-mulhu t2 a7 s6
-sltu s7 t4 s5
-sub s5 s5 x0
-xor a3 s6 ra
-addi s7 s0 437
-mulhsu gp s9 s2
-mulhsu x0 a2 s6
-sltiu a7 t3 1969
-xor t5 s5 s10
-slli s2 s1 7
-rem a1 a5 s9
-lui s11 684448
-sll s10 a5 s10
-slt x0 s3 s5
-div t0 x0 t5
-addi t3 t5 1081
-andi t0 t0 -2011
-srl t6 a7 s9
-rem a3 s9 t0
-div a2 s4 a6
-slti a3 a3 -1124
-sub a1 a1 s1
-add a6 a0 s2
-xori a5 a6 1843
-divu a5 a5 a0
-xor s4 t4 t4
-slti s2 a5 -132
-div a0 s7 s6
-and tp s9 t5
-sll a7 a5 s11
-remu s6 a4 s10
-sltiu a0 s8 1864
-mulhu s7 t2 a6
-mulh t0 s11 ra
-srl a7 tp t3
-srl s11 a4 a1
-rem t4 s8 t0
-remu ra s10 t3
-divu s10 tp a1
-auipc s2 579218
-mul s3 t2 x0
-slt x0 s11 s1
-mulhsu s0 s7 s10
-slli s11 a6 15
-srai x0 a7 18
-or s9 s5 s1
-addi a0 x0 -785
-sltu a0 gp t5
-andi s2 s11 1066
-srl a6 s3 s1
-slti t3 t3 1645
-mulhu t2 s8 s1
-div a6 t1 s5
-mulhu tp s5 t4
-mul a0 a7 x0
-sub t3 s2 x0
-slti a4 t6 84
-remu s3 t2 t2
-sra s7 s4 t1
-rem s1 a7 t0
-add ra t6 a6
-mul t3 s10 s5
-add s10 x0 gp
-rem s7 a3 s1
-remu s2 t2 x0
-divu s9 a5 gp
-sll s5 t2 s0
-ori x0 t3 790
-rem t2 a1 s8
-sltiu t4 s6 -908
-lui t1 997508
-andi a4 a6 -1624
-rem s11 a4 a1
-slli a0 t6 26
-mulhsu s9 s5 a6
-sub a4 s8 x0
-xori a5 t1 843
-mulhu t6 a4 a2
-sra t4 s6 ra
-sra a2 a5 s7
-sltiu s9 t2 96
-lui s1 226569
-xori a4 s0 -1893
-sltiu s10 a5 1925
-addi s8 s1 -2032
-sub t5 s0 t3
-mulhsu a5 s2 a5
-mulhu t6 x0 gp
-mulhsu tp t0 t1
-mul s2 a6 a7
-lui s8 145596
-mul t0 s10 s7
-mulhu s6 x0 a5
-srli a2 a6 4
-sltu a7 a7 tp
-srli x0 a6 4
-srl a2 a0 a4
-xori s10 s3 1024
-slti s8 t1 -519
-remu t1 s5 s10
-mul s4 s8 t2
-lui s1 129196
-divu s0 tp x0
-mul a0 s1 t3
-mul a2 t0 ra
-slli x0 a6 28
-sltu tp tp t1
-divu gp x0 s6
-add a5 a7 s10
-divu s1 s9 a4
-mulh a4 a6 a4
-sll t2 s1 s5
-sra t4 t3 s5
-divu s6 a2 a7
-andi s11 t4 -766
-add a0 ra s4
-slti a7 s1 521
-and t3 s7 t1
-slti s5 s7 -2019
-mulhu s4 a6 a4
-mulh s6 t2 a3
-auipc a5 685394
-add tp tp x0
-rem t5 a4 s2
-sra s8 gp a7
-div s1 a4 s1
-lui t4 893456
-mulhsu s3 a5 t5
-or s1 a5 s4
-srli gp s1 8
-mul t2 tp a0
-mul s1 ra s5
-srai t6 a1 5
-lui s5 767246
-remu ra a3 a3
-sltu a0 gp s6
-lui x0 653191
-slti a1 ra -373
-andi ra s4 1740
-srl t5 t2 s1
-sltiu s11 s7 1711
-auipc a2 981911
-slti x0 s2 -22
-lui s2 589200
-srli s9 s3 23
-addi t4 s7 -1989
-div t3 tp a1
-srai s4 a7 17
-slli a2 a5 18
-sra s9 s0 a3
-auipc a6 349712
-sub a0 s0 ra
-ori s7 t3 -1808
-sll gp s4 s4
-slli s2 s9 18
-addi tp a4 -379
-xori s11 a0 -267
-srai t6 s8 29
-mulhsu t6 a0 s9
-slt a3 ra s1
-mul s7 s2 s7
-divu t3 s0 s1
-slt t3 a7 a4
-sltu s11 s8 a5
-slt s6 t4 s9
-auipc a1 896300
-and s0 a3 a2
-sltu s7 a5 x0
-auipc t6 929785
-xor a3 s7 s1
-lui t3 124434
-slli s9 s4 8
-add s10 s9 s5
-divu a0 x0 t0
-mulhu t6 s9 s2
-sra s6 a2 a3
-slt s0 s1 a0
-sub t1 s2 a0
-addi t4 s7 872
-divu a0 s11 s5
-and a0 t2 a6
-auipc t5 20367
-andi t4 s7 202
-srli s0 s2 19
-sltu t1 s3 s2
-addi a3 s4 -721
-srli t2 s5 29
-div s8 a6 s5
-andi t4 s1 1534
-andi a4 a2 -423
-or a0 a2 tp
-mulh x0 a5 gp
-mul a0 a4 s6
-srai s9 s9 5
-div t3 t0 s10
-srli s4 t2 5
-slti s8 t5 -1747
-andi s5 t4 -876
-mulh t6 x0 a6
-sub a5 x0 s6
-mul t6 s3 s2
-slt a3 s10 a4
-addi s4 s8 -261
-remu x0 s2 t3
-slti a7 s2 -477
-remu s8 s1 a4
-srai tp s3 18
-sltu t5 a3 a0
-andi s2 a5 354
-divu s10 s10 s0
-sltu a7 s2 s7
-srli gp a0 18
-xori s4 t3 -237
-sltiu a7 s1 -702
-srli t6 s9 28
-slt t2 tp t0
-addi t6 t5 -1411
-and s4 s9 s6
-sltiu s10 s5 -575
-div a1 x0 a7
-srai s9 a4 11
-addi s11 t1 1250
-add s10 gp s10
-or a5 s7 t6
-xor t0 gp a0
-and x0 s3 a4
-srl s0 a7 x0
-sltiu s10 s0 -726
-srl t4 a7 s8
-lui s3 797090
-andi t5 x0 -1910
-srli t2 t5 28
-slt s9 a1 a4
-add a5 ra a5
-srl gp a1 x0
-sltiu s1 gp -416
-sltu s0 t2 ra
-auipc s7 25123
-sltu t2 a5 t1
-sub s0 s5 s11
-sltu s5 gp t1
-andi x0 s7 -1000
-auipc t6 692001
-auipc s7 968863
-srli s6 t0 12
-lui a5 188717
-slti t6 a7 -853
-rem a6 a3 a4
-rem a2 x0 a2
-ori t0 s0 -528
-sltiu s7 a5 1605
-srl t5 x0 a5
-or s8 tp t5
-sltiu x0 s1 -1787
-lui s11 833240
-addi a5 t4 -247
-andi s6 t5 -740
-mulhsu a1 x0 s1
-slt t6 a0 t2
-sll s1 a5 x0
-addi s3 t0 762
-sltiu s4 s4 -1388
-mulhsu a6 s11 s3
-andi a1 ra -1937
-slti t5 a2 -1671
-andi t1 s7 703
-sltiu a6 s10 -1503
-divu x0 tp t6
-divu t6 a0 s9
-mulhu ra t3 t6
-sltiu tp s8 -1701
-addi a0 s3 -1413
-sltu s10 s8 a7
-and t6 s5 t2
-srl a1 gp t6
-mulh a2 a1 a5
-srli s4 ra 13
-andi s6 ra -496
-sltiu a5 x0 1213
-mulh t3 a7 s11
-xor x0 s8 x0
-slti s6 s11 -932
-auipc a0 161733
-sra t6 a1 a6
-sub x0 a6 t1
-ori x0 s2 -1892
-remu a7 ra s6
-slti s0 t6 -752
-ori t1 a7 -1261
-addi s9 t3 1195
-srli tp s10 10
-remu t3 t0 s11
-xor s4 x0 tp
-srai x0 a4 13
-mul s6 a5 x0
-sltu t3 s2 s4
-or s10 s11 a3
-mul s0 s7 s7
-and s6 s5 s2
-mulhu a0 s10 t1
-srli gp s8 2
-addi a1 a7 -2013
-sll ra ra x0
-divu x0 s4 a6
-srli s1 x0 9
-slli s7 gp 14
-remu x0 a7 s8
-remu s6 gp t2
-lui a1 368055
-remu t2 s6 a2
-slt x0 s0 s10
-xori s3 x0 -1986
-slti s0 s9 -354
-mulhsu s8 a7 s7
-rem s4 t3 s6
-add s11 a1 s1
-andi a5 a3 -1851
-mul t1 a2 a6
-mulhsu t4 tp s11
-or s1 gp s1
-mulhu t5 t6 tp
-xor s6 t0 a5
-sll s5 a2 s8
-mulh s4 s11 t0
-sltu s7 s6 s11
-mulhu s3 s10 a3
-slli s6 s8 9
-sll t6 tp t5
-mulhu s7 x0 tp
-srli s5 s6 18
-mul a2 a7 s10
-and a6 s7 a1
-addi s5 a4 38
-sra a2 t0 s9
-ori s4 a4 -1450
-ori a4 s10 -822
-slti t3 s8 -1048
-rem s6 s1 a7
-slt a5 s4 a7
-xori s7 t2 -1375
-auipc s1 640202
-and a5 a0 a2
-srai a2 s8 0
-ori s3 a3 1171
-slti s0 a0 824
-srli s8 s10 24
-andi a3 s11 1889
-slli s0 s8 16
-sll s6 t6 t5
-sltu t3 t5 a2
-mulhsu a6 s6 a6
-sltiu s11 a5 -1409
-and s7 s7 s7
-add t0 ra s2
-addi t1 ra -1270
-srl t1 x0 t4
-sltu x0 x0 s3
-div x0 s10 x0
-andi a6 s3 -45
-and tp gp tp
-sltiu s4 s7 -472
-sub tp a6 a7
-sub s10 ra s6
-addi t1 a7 -1672
-remu t6 ra t5
-rem s5 a0 s6
-srai s7 s6 21
-mul a5 t2 s1
-or a5 s7 t5
-srai gp x0 21
-sltiu a1 s7 -468
-slti s7 s1 -1387
-andi s6 s6 666
-or a2 s11 s5
-slt s9 s6 t3
-addi t0 t0 -4
-xori t4 tp -1418
-or t6 t4 ra
-mul s10 a5 s3
-rem t5 a7 t6
-andi t2 s10 -1160
-mulh s4 s8 ra
-addi t1 x0 669
-srl a3 s5 t6
-add a4 a4 s5
-add t0 x0 t3
-srli x0 s11 1
-sub s3 s3 s3
-add t6 s4 s6
-sub s5 tp a3
-srl s0 a1 a2
-auipc t3 837529
-div a7 t4 s8
-srl a5 a0 s7
-divu a6 gp s11
-and a5 t6 s9
-rem s10 t2 s5
-slti a6 a2 -654
-lui s9 861668
-auipc s2 113551
-sltiu s7 t5 598
-srai s0 t5 27
-add t0 t2 s0
-rem x0 a6 s3
-remu a1 s1 t4
-mulhu a6 a4 a7
-remu t2 s8 tp
-srli s4 t4 23
-lui t6 661471
-srai tp s3 22
-add t0 t4 a7
-rem a6 x0 s6
-or a2 s0 s4
-sra t5 s7 ra
-sltu gp a7 t4
-ori t0 tp -442
-addi a4 x0 1157
-srli t2 s7 21
-or s5 s0 s5
-slti s4 t4 -1916
-mulh a1 a4 a2
-slti a2 s2 -1655
-slli a3 a5 17
-sra s11 x0 t1
-srai t4 s5 24
-slti s0 t5 -657
-remu s4 s5 ra
-xor s5 s0 s1
-sltu gp t6 a0
-slti gp s5 -148
-andi a4 s4 -1967
-div a5 s0 a1
-mulhsu s10 a7 s5
-mulhu a2 t4 ra
-xor t2 t1 a5
-xor s1 a3 s7
-sltiu t2 tp 2003
-sltiu s9 tp -1157
-slti t1 t4 -715
-divu s3 s3 s3
-xor s5 s10 t2
-sra gp x0 gp
-mulhsu t1 s9 s11
-xori a6 s0 -1530
-srli s5 a4 0
-remu t4 x0 t4
-slti s7 s2 -666
-and s3 s1 t4
-mulhsu s2 t1 s1
-sub t5 a4 a1
-div s1 s4 gp
-srl a6 s0 s5
-divu s4 x0 a4
-sra t1 s1 a4
-auipc tp 624047
-add a3 a1 t3
-lui s5 148187
-and a1 s9 a6
-srai a5 a7 7
-srl a6 t4 s4
-mul a5 s8 gp
-lui x0 362124
-slt s7 t2 s7
-slti ra a4 -68
-mulh s9 x0 s3
-xori a0 t3 -1025
-mulhu s2 s9 s10
-remu a7 s4 s10
-mulh a2 a5 a1
-slti t4 t1 1236
-ori gp s5 -1125
-sltiu tp s1 -1854
-auipc a7 78112
-lui x0 223660
-ori s4 x0 -657
-xori a1 ra -956
-sll t2 s2 s2
-lui a2 98678
-and x0 s6 s5
-sltu t4 s8 a3
-sltiu t0 s1 -2022
-slt s0 s6 s6
-srai a0 s6 6
-lui ra 1019098
-srli s8 a7 11
-slti t2 s8 -1134
-auipc t6 855778
-remu a2 ra s9
-remu s0 t2 a4
-slt a3 x0 t2
-slti gp tp -943
-auipc a2 808753
-slt s0 a7 t4
-and s2 a5 ra
-slti s7 s7 -734
-sltu t4 t4 s5
-sltiu s9 s8 -479
-add t4 a3 s1
-mulhsu t5 ra t6
-mulhu a2 s0 tp
-andi a2 t2 -806
-mulh s5 gp s5
-lui a5 242645
-sltu t6 s11 a2
-sra a7 x0 s10
-mulhu s7 t4 a3
-mulhsu x0 t4 a3
-xori s7 s8 -1986
-divu s9 t4 ra
-srl t4 a6 t2
-xor a2 s3 a5
-sltiu t3 s2 1906
-andi t0 s11 -811
-sub s1 a2 t3
-sltiu a7 t6 -894
-sltiu a3 s1 1595
-mulh a0 ra s11
-sra s7 a0 a2
-sltiu s11 t0 -1842
-div s4 s6 t3
-add s9 t3 s1
-ori a1 s5 -1680
-mulhsu a3 s6 ra
-remu s5 a6 a2
-and x0 s0 t3
-slti s10 s10 -164
-sub a3 a4 s11
-auipc s4 743758
-srl s8 t3 s10
-divu x0 t0 s5
-ori s3 gp 86
-sra t2 x0 x0
-add s5 s3 a5
-slt t1 t1 a7
-mulhsu ra a7 s7
-srli s4 s4 17
-slli t3 a6 23
-div s2 t4 a0
-andi t6 a3 -1913
-sub s0 s5 a6
-xor t0 a3 s8
-add a0 t4 t2
-mulhsu tp s1 s0
-xori s2 s0 -734
-div s1 t2 s9
-slti t0 t3 2031
-sll t1 t5 a3
-div gp a3 x0
-sltiu a3 s10 -1687
-mulhu s6 s3 s2
-sra a6 a1 s1
-remu t6 s5 s5
-addi s7 s5 21
-srai s1 a5 12
-auipc s5 505070
-or s6 s11 s3
-sll a1 t0 a2
-remu s11 t1 x0
-lui s10 470912
-srl tp s4 t4
-remu s8 t0 s5
-sll s1 a6 s3
-mulhsu a2 s8 t2
-xori a3 t2 -492
-slli s5 s2 30
-and t0 s11 tp
-auipc s6 1006558
-addi a7 ra -338
-sub s5 a3 x0
-sltu s9 x0 s11
-mulhu s8 s9 s7
-sltiu s4 x0 -444
-sll s11 s4 s4
-xor a6 t6 s9
-srli a1 t2 6
-sra t3 a7 s4
-mul s4 s6 gp
-addi a3 s7 -607
-ori t2 x0 -961
-srl s6 a1 s3
-and t2 s9 s9
-sra gp s0 s1
-remu t0 a2 a3
-lui t4 227530
-xori s2 a5 -2018
-slt a2 t1 s8
-ori s6 t4 -1678
-or s6 s4 s5
-remu tp a0 t2
-mulhsu a3 a0 t0
-sra t3 s4 s1
-srli a3 t4 15
-mulhu x0 t3 x0
-srl s6 t2 s3
-slti s3 t0 -560
-sra a2 t1 x0
-lui t1 446367
-srl a1 s0 s0
-srl s11 s6 s3
-xori s3 t1 -313
-sub s9 t0 x0
-sltiu a6 s4 -1637
-add s2 s3 s3
-rem s4 tp tp
-add t4 x0 s11
-and a0 t0 t5
-mulhsu t4 t3 s1
-ori s1 x0 -1315
-sll t3 x0 s6
-xor a4 a0 a6
-mulh s9 s11 s10
-sltu ra a0 s8
-mulhsu s2 t4 t4
-srl a2 s1 a3
-rem t2 s0 t3
-rem s4 t0 s0
-sra s7 s2 a0
-srai t6 x0 11
-srli s1 t4 9
-srl a6 t4 a0
-sltu s11 s10 a2
-add tp ra s11
-mul a1 tp ra
-slt a5 tp s8
-divu x0 s9 gp
-srli ra a2 21
-mulhu t1 s7 s1
-xor ra s3 a4
-sub t2 t3 t3
-and s1 s6 a4
-sub t6 a7 a0
-mulhsu s10 t5 s3
-auipc s1 620201
-srli t6 s1 14
-slli a3 x0 29
-and a7 a2 s0
-lui s4 937319
-and tp s7 t0
-xor a6 a2 s2
-xori t4 t1 1630
-andi s5 a2 1062
-add s9 t2 s11
-sub s3 x0 t6
-slli s0 s0 27
-div s0 s4 t4
-and tp gp s1
-srl s10 t3 x0
-mulh a2 s7 t5
-and x0 s8 t1
-mul t2 a4 s5
-add t2 tp a6
-mulh s0 tp t0
-sll ra a3 ra
-slt a4 gp s9
-srai t0 s7 6
-auipc ra 701054
-srl a7 s0 t0
-mulh t2 x0 s6
-remu s8 gp s0
-mulhu s1 t2 s0
-mul s6 x0 gp
-mul s11 a5 t3
-lui s7 732416
-add t1 ra s2
-remu t3 a0 a3
-sra a0 gp x0
-mulh s1 a2 s4
-auipc s11 528208
-auipc t5 449938
-add a1 t5 s5
-sltiu t3 t2 -1331
-xori s2 a1 -1023
-div x0 s7 t2
-auipc t1 59188
-or s4 t6 s10
-auipc a3 489322
-srl s3 s9 s11
-lui t5 1001762
-rem s1 s0 s2
-slli s0 t6 8
-and x0 a7 t3
-srl t6 t5 s9
-auipc s0 736841
-addi a5 t2 -349
-sra s0 s3 s5
-sub s2 a7 s8
-andi a2 t4 -521
-srai x0 t1 29
-addi a4 t3 1961
-auipc s10 750148
-srai t6 s4 0
-and ra s2 t6
-mulhsu s2 s6 s5
-andi a0 s4 187
-slti a1 t3 219
-sub t0 s10 a3
-sub ra a1 tp
-sltiu a2 a4 -1760
-addi tp a4 259
-or a5 t5 s7
-sra a4 a0 s3
-andi s0 a1 1411
-and s8 a7 a2
-addi s9 s0 748
-xori t2 x0 -687
-mul gp s6 s11
-slli s4 a2 27
-or t1 s11 ra
-remu a2 s7 s8
-sltu a0 s5 ra
-mulh s3 s5 a1
-sra a5 t2 s7
-sltiu s6 s11 -1090
-srl t2 t3 tp
-ori tp s5 1502
-div t2 s3 a5
-slli s8 a5 16
-mul a3 a1 s3
-sll a1 x0 s2
-andi t1 t5 -1850
-lui a4 866286
-addi s5 s4 -1004
-srli s6 s3 5
-slti s8 a2 -1018
-srai s2 a1 18
-addi s7 t2 1746
-and s7 a2 gp
-slli a0 s7 3
-xor t3 s3 t0
-srli s4 a2 3
-mulhsu s7 s11 a1
-slt a4 t2 s0
-sltiu s6 s11 1103
-slti x0 a4 1247
-sltiu s3 x0 -381
-mul s11 x0 s3
-xori s0 s9 -900
-or s4 s8 s10
-sll a0 a4 s4
-xor s0 s4 ra
-xor s7 a6 t4
-srli a5 x0 25
-andi x0 t4 -57
-add t1 a4 gp
-add s1 s11 x0
-sltiu a4 a1 -467
-sll s3 ra t3
-mul a7 a7 s10
-auipc t3 66826
-mulhsu ra s1 t5
-sltiu a1 gp 1154
-sub s9 s10 t1
-srai a1 tp 28
-divu s2 s9 a2
-srl a6 t0 t4
-andi a6 t4 -1536
-auipc t6 808454
-div t1 a3 t4
-mulhu a6 ra s4
-add t2 a2 x0
-and a6 t0 s1
-addi tp s6 579
-and s10 s6 a3
-sra t5 s3 s8
-lui a6 437068
-lui t4 215878
-divu t6 s6 s11
-slti x0 s11 1578
-slt s6 s3 s5
-sll s6 t2 s7
-mulh s7 t5 a7
-srli s6 a5 27
-and a4 s11 x0
-and s2 t1 a1
-auipc s2 692255
-mulh s0 s0 tp
-mulh s3 a7 s0
-add s2 t2 a2
-slt t1 x0 t0
-div a3 ra a6
-add t1 a5 t6
-sltu gp t2 s9
-xor s8 t3 a0
-or a1 a1 a0
-xor s5 a0 a2
-sra t5 s11 t6
-mul tp ra a7
-divu t0 t1 s8
-auipc a7 373392
-srl a5 s8 t2
-mulh a4 a0 t6
-sra t6 x0 tp
-mulh a7 a6 s0
-slli x0 s9 18
-mulh s4 s11 s8
-xori s0 s2 1502
-slti t3 a7 1882
-slt t4 a6 t6
-sltu s0 s10 t0
-rem a2 x0 tp
-mul s0 a2 a4
-srli s10 s10 11
-mulhsu a0 t6 s11
-sltiu s9 a1 1492
-remu t5 t1 s2
-ori s1 s11 33
-divu a6 s5 t0
-sll t0 t5 s11
-auipc gp 308385
-slt s10 s5 gp
-div a5 a1 a2
-and t4 s3 s2
-sll ra ra s11
-and x0 tp t4
-mul s7 ra s1
-div s1 s7 s11
-xori s1 t5 -492
-sltiu s1 s3 -348
-andi t1 s8 -248
-slt x0 s10 s5
-sltu tp gp a3
-div t0 s10 t5
-xor t1 s11 ra
-div a4 s5 s10
-sltiu s6 tp -812
-srai s5 t3 18
-auipc s0 1047802
-lui s3 185293
-mulhsu a2 a7 tp
-sll s3 tp s8
-sub a0 s4 s5
-lui t5 400520
-divu x0 a1 x0
-addi a1 s9 -1798
-divu s8 s9 a7
-divu t6 s9 ra
-rem a5 t6 t4
-sra s8 a6 s11
-auipc s8 236783
-slli x0 a3 11
-mulhsu t4 x0 ra
-ori a7 s3 -1150
-mul x0 ra s5
-sra t1 s6 s9
-mulh t2 s9 s3
-rem s10 t6 ra
-sltu t5 s0 a3
-sra s8 a2 tp
-addi s5 s1 -1525
-sll s10 s10 a3
-remu a4 s6 t4
-srl a7 t2 x0
-addi s2 s2 -254
-sub s11 t2 t6
-slt t0 t1 a7
-mulhu s8 s7 t0
-slli a1 t4 22
-sltu a2 t5 s1
-divu t2 s6 t3
-xor s11 a7 s4
-div a1 s9 a7
-remu t0 t4 s4
-xor s6 t5 t3
-andi t6 a5 -1132
-div s1 t2 s5
-xori a7 a7 -1846
-add x0 s4 s7
-xori a6 gp -1253
-lui s4 859132
-mul t0 t5 a4
-xor t0 a2 t5
-addi gp gp -1270
-or s11 t3 s0
-mulhsu x0 s5 ra
-srli t0 a0 5
-slti x0 s11 586
-and a4 a7 t1
-lui tp 136403
-mulh s0 s11 s8
-sltu t5 s4 s0
-xor a1 s7 tp
-xori t3 s9 -1530
-sll s1 ra s2
-sltu s2 x0 t5
-ori s3 s4 -639
-mulh a1 t2 t5
-mulhsu t2 a7 x0
-srli s8 t6 9
-ori s6 a0 79
-srli a7 a7 14
-srli s1 t4 21
-slli t1 a5 0
-lui t2 655678
-divu s10 a6 a4
-sll a0 s8 x0
-srl s10 s6 x0
-slli gp t6 5
-slli a5 s0 11
-andi s6 s9 -1429
-sltu a3 a0 s10
-mulh s0 s9 t0
-srai s0 a2 29
-or s11 s0 t0
-srli s0 t1 28
-add s2 tp a3
-sll x0 a7 x0
-add s3 s0 gp
-and t5 tp a4
-div s0 s5 s6
-or s8 t4 s5
-slt s8 a5 t0
-auipc t1 498029
-add t6 t0 ra
-auipc s2 539408
-slli gp gp 25
-xori ra a6 -1179
-xor ra t4 t4
-srl t1 t3 x0
-sra s11 a3 s10
-sll t2 s3 a5
-add s11 s3 t2
-slli t5 a3 15
-ori s0 s7 1551
-add gp s11 s3
-xori t1 s11 -2
-divu s2 t5 s8
-slli s5 t2 4
-sub t1 s0 a2
-rem a6 t6 t2
-mulhsu a1 s8 s1
-srai t6 s10 15
-srai a3 s5 5
-add s4 a0 x0
-add s11 t4 x0
-srl x0 a1 t3
-slti s7 s1 631
-sltiu x0 t0 -2018
-addi t0 a6 -602
-xori t3 t4 -1054
-mulhsu s10 gp t4
-sub t3 s4 tp
-sra x0 s11 a4
-mul x0 s4 t0
-mulhu s8 a3 x0
-slt t1 a3 t0
-lui gp 295650
-sltu t0 a5 a5
-srl s1 s5 s11
-addi tp s11 -1229
-mulhsu s10 t3 s8
-xori s5 a6 302
-and a0 s1 a5
-ori a4 s9 -519
-or a4 s4 a3
-mulhu a5 a7 a0
-xori a4 s1 -2033
-auipc a0 1016703
-slt t4 t5 a7
-divu s5 a2 t2
-srli x0 t5 28
-div a5 a7 ra
-or a3 t1 a0
-and a5 t0 s1
-lui t6 611015
-mulhsu a2 t5 s6
-srli a2 a4 31
-srai s1 s9 18
-srai s11 ra 0
-sll a0 a0 s8
-srl s8 a4 a5
-sra t2 a4 t2
-mul s0 a1 a2
-srai t5 t0 14
-slt ra s10 a4
-sll s2 a5 s10
-sltu t0 a3 t2
-xori t0 s2 -1193
-or a4 ra a7
-andi a7 a5 -1841
-andi a2 s11 440
-ori a0 s4 -1443
-xori t2 s8 -562
-andi s3 a6 -1538
-auipc s9 51976
-addi t3 s2 -1575
-lui t1 657013
-mulhsu a2 a7 a0
-mulhsu t4 s9 x0
-addi t5 t3 -49
-slli s4 s9 19
-lui a4 420102
-xor s2 ra s8
-sltu t0 s0 x0
-sll a4 s4 t6
-sltu s3 t5 s4
-sltu gp s2 a5
-addi a0 s9 250
-srl a3 a3 s8
-slli s8 x0 2
-addi x0 s1 -1449
-and t2 a0 s6
-slt t4 a2 s6
-ori t6 s8 564
-addi t0 a6 -1870
-sra s5 a2 s7
-sub s8 tp a5
-sltu s8 s10 s10
-rem a4 t2 t3
-slti tp gp -1623
-slli ra s11 25
-srai s2 s10 2
-mul s5 s5 s9
-srl t4 s3 t2
-sra a3 t3 t6
-slt gp a2 a6
-mulh s11 gp s9
-sra a6 t5 s3
-xori t5 tp -1309
-mulhu s7 a4 s0
-sltiu gp s9 37
-sltiu a5 tp -850
-xor a4 s6 t6
-andi t6 a4 -83
-add x0 s3 s3
-slli s5 a5 25
-sra x0 t2 s2
-xor t6 a2 s6
-ori a5 s6 229
-slli a0 t5 26
-slli ra ra 14
-sltu s8 s0 s10
-ori t0 x0 -655
-slt a4 a2 s10
-div s8 x0 s1
-and a4 x0 s4
-and s9 a7 s5
-slti s7 t1 1963
-sra s9 s9 a1
-or s9 a6 a7
-auipc s9 295003
-add s8 s10 a5
-andi s1 s6 463
-sltu s0 a6 tp
-andi t2 tp -721
-mulh gp t3 t1
-divu s2 s8 s11
-auipc s0 686665
-divu t3 s4 t2
-auipc a3 480439
-xor a2 a2 s1
-divu t1 s8 s2
-add a5 s6 a6
-ori a0 a2 -200
-slt ra a4 a3
-or t4 a2 t3
-lui s8 761594
-ori gp tp -1213
-xor s8 tp t4
-rem t2 s3 s3
-add s9 a3 s2
-srl s10 tp s7
-xor s8 x0 s5
-xor s0 a0 a2
-slti ra s1 -1470
-sll s2 t0 s8
-slt a0 s11 t5
-sub a3 s5 a3
-sub s5 s11 a7
-slli s0 t0 11
-divu t4 s7 s4
-xor a3 t0 a5
-sra s10 x0 t3
-mul t5 a0 a3
-auipc a4 758514
-and x0 s4 s9
-addi s0 gp 160
-sltu s0 t1 ra
-add s0 a7 s8
-mulhsu a5 s8 s0
-slti tp t0 -1113
-srl a6 a3 x0
-mulhsu a5 t2 t1
-slt s4 s6 s4
-mulhsu s8 s8 gp
-sub t5 s4 s0
-remu s8 x0 tp
-rem s11 s1 a5
-mul a7 s8 s11
-mulhu t3 x0 x0
-div s5 s5 a6
+ori t4 x0 179
+divu s0 tp t2
+rem ra s4 a3
+lui t2 300807
+srai a0 t3 12
+div s8 s5 s10
+lui t4 258408
+slti s5 s2 -904
+rem s10 s9 s5
+mulhu t2 s2 s11
+lui t1 267957
+div t1 t3 a2
+divu s0 s7 s0
+and t2 s8 a4
+auipc a6 650489
+mulhsu s2 s11 s5
+srl s6 s7 s6
+sll s7 s1 s6
+addi t3 s3 -1081
+addi t2 a6 -982
+sub t4 a6 t3
+sltu t0 a0 s3
+srl s8 a1 a1
+auipc t1 305146
+addi s4 a5 -850
+divu s1 s8 gp
+mulh t2 t5 x0
+slli s10 a2 2
+xor s8 s11 ra
+and a7 t0 a4
+addi a6 s3 1135
+sltiu s1 gp -184
+or a4 t2 a5
+mul s7 s4 s1
+srl a3 x0 tp
+divu a3 s11 a3
+and s4 t6 t1
+or s11 a7 tp
+or t5 s10 t3
+slli t6 s4 8
+rem s7 x0 s10
+slli s5 t4 27
+sltu t6 a0 a1
+divu s11 s5 ra
+slli s1 s4 18
+sltu ra t3 a3
+divu a6 s10 s7
+auipc a4 536471
+divu a3 s6 s7
+mulh s5 s6 x0
+mulhu t4 a6 t5
+or t2 tp s8
+ori a7 t4 -1902
+srli s7 tp 7
+sll t6 s10 a5
+remu s7 a5 a0
+or s10 a7 s6
+rem t0 t1 gp
+rem s5 s4 s9
+sll s4 t6 s5
+mul s4 s10 s1
+add s6 t2 gp
+xor a6 s6 a3
+srli a3 a4 29
+srai t4 t1 14
+or s4 s3 s2
+sltiu t2 s5 193
+and s11 gp t3
+addi s3 a7 -103
+rem a2 t3 a5
+mulhsu s7 a3 a4
+rem t1 t2 s4
+mulhu t0 s3 s7
+rem a0 a7 s6
+xor gp a1 t6
+mulhsu t1 s5 s2
+lui t2 535583
+rem gp s9 a4
+srai t4 t0 27
+add s11 s0 ra
+srli s2 a1 10
+mulhsu t2 s2 s0
+srli t6 x0 12
+srai s9 s8 12
+slt t5 s8 t1
+divu t2 s9 s10
+sltiu s0 a2 1257
+addi t5 t4 254
+addi t1 t5 -611
+sra s3 s3 a2
+sra t3 a0 s0
+mulh s7 t2 t1
+add t5 a3 s4
+rem s2 tp gp
+sltu a1 a6 a6
 rem a7 s4 a1
-add ra x0 a6
-sll ra t4 x0
-sltiu s1 t3 -1980
-slli t1 s2 20
-auipc ra 945546
-remu s0 s10 a7
-xori t0 t0 -1657
-lui s11 73264
-mul s8 a2 t5
-sub s8 s1 s11
-sub t3 t0 s7
-add s9 s11 t3
-srl a1 s10 s9
-sltu t2 s6 s6
-add gp a1 ra
-add a7 ra gp
-sra t0 a6 s7
-lui s1 244820
-mulhsu s0 s8 t2
-slti x0 x0 -87
-sltiu x0 t5 1812
-sub s4 t1 a1
-lui a7 449013
-add a1 s3 a1
-remu t6 t4 t4
-auipc s0 815387
-andi t1 a0 -1969
-lui t4 726943
-slli t1 a1 25
-sltu s3 s0 t4
-sltiu x0 s3 -1604
-lui s0 60969
-addi t1 a4 -676
-mul s9 a5 tp
-ori s4 a2 851
-xori gp s4 -597
-divu t3 t5 s5
-sltu a1 x0 tp
-andi a5 s4 -731
-mulh a2 s4 a6
-mul s2 t6 a0
-sll s10 t3 t1
-srai a1 s0 3
-or a5 ra tp
-mul a1 s5 s9
-slt a0 s2 s1
-addi t2 s11 32
-sra ra t2 a5
-mulhsu a2 a2 s2
-add t6 ra a4
-add x0 a7 a4
-mul a4 t4 tp
-slli a0 a7 28
-srai s11 x0 21
-srai x0 a6 2
-div s0 s3 tp
-sra s7 s9 s1
-andi t3 t0 -1298
-mulh t6 t5 a1
-slti s7 s1 -1402
-mulh t3 x0 s5
-or s2 s6 x0
-srli s3 t6 13
-and s8 a2 ra
-sll t5 a7 t2
-ori a1 s9 -98
-sltiu t1 s1 745
-mulh s1 s6 s3
-and t0 a1 s11
-slli t1 s0 3
-add s7 ra s9
-remu a5 t4 s6
-lui s4 567972
-auipc a3 935216
-mul a5 s10 s6
-srai a0 s9 4
-remu a6 a6 a7
-srai s9 t5 7
-sll t2 s2 s1
-lui s10 194450
-mulhsu gp s1 a0
-ori tp x0 -1890
-mulh t4 t1 a7
-lui s4 662558
-sltiu x0 tp 301
-remu s1 t0 t2
-srai ra s3 9
-lui s9 668493
-srl gp s10 t3
-srli gp ra 25
-mulhu a6 x0 s9
-remu t6 a2 s3
-rem s4 s10 a7
-srai s5 x0 17
-andi s2 a4 -1962
-auipc a7 729393
-srl s7 t0 t0
-sub a2 gp t6
-sltu s8 s7 a3
-ori s4 t1 -122
-and t1 s9 s5
-srl s1 t2 s6
-ori t3 a3 143
-sra t4 t4 t6
-slti s4 s10 -276
-srl ra tp a3
-auipc t0 497596
-mulh s1 a7 a7
-sll s1 tp a3
-mulhu s4 a7 s5
-mulhsu s6 t5 s11
-sltu s2 ra s0
-or tp x0 s5
-auipc s10 771944
-sltu a1 x0 ra
-slti s11 s3 -1777
-sra s8 s7 a4
-sub a7 t6 t0
-slti a7 s11 8
-slt tp a1 t3
-divu t3 a3 s6
-mulhsu gp s5 t5
-rem a1 s1 a6
-mulhu t2 s1 a4
-slti a5 s11 1452
-sltiu t1 t4 1772
-sub x0 s1 t1
-sra x0 a1 a5
-mulhsu a1 a5 x0
-ori s6 s7 -920
-remu tp s7 s3
-sub t4 t0 t2
-sltiu t2 gp -1960
-addi t2 a2 -245
-sltiu s11 s5 1979
-slt t3 a6 ra
-slt a1 t2 t3
-sltiu a1 gp -1093
-xor s8 a4 a2
-div t2 s0 t0
-xori s11 s1 -1663
-srli s11 t2 14
-andi s6 s4 -1030
-or a4 t6 x0
-addi x0 s6 -361
-slti s3 a5 -1819
-and t0 s1 a5
-xori a3 a7 -986
-mulh t2 t0 t3
-srli a2 s6 16
-andi t5 a0 -1436
-slli a6 s10 31
-andi gp x0 1513
-and a2 x0 t2
-slli t6 s4 15
-divu a0 t2 s5
-slti a7 s5 886
-srl s10 t3 a0
-div s8 a4 t5
-sltu tp ra s5
-add a0 s8 a2
-slti s8 s7 864
-sra s7 t3 a3
-andi t3 a6 585
-addi a6 s11 -985
-mulh x0 s6 t1
-mul s7 gp x0
-srl s5 t1 s9
-ori s0 t6 -1760
-addi s9 s10 -160
-and t1 s10 a5
-xori s6 s5 428
-xori a2 t2 538
-rem t5 t6 s5
-srai s2 a4 12
-sub a6 s6 t4
-and s1 ra s10
-srl t3 t1 gp
-divu a7 a2 s8
-addi t2 s8 94
-mulhu ra s5 s0
-addi s9 a3 -631
-mulhu t1 s6 a0
-sll a5 s0 t5
-addi s7 t0 -1024
-mul s1 s8 a2
-mulh s9 s4 t6
-andi x0 a0 259
-srl t2 s3 x0
-sltiu s8 tp 487
-srli s3 tp 14
-add s2 ra s10
-andi s9 s10 -1209
-srai a6 t5 24
-slt t3 s11 x0
-ori t6 s7 1589
-mulhu s2 tp t5
-srai tp s5 2
-slt a3 tp a4
-sll s2 ra t5
-xor a0 t1 s9
-mulhu s5 t3 s9
-add s2 s3 a5
-srl s10 a3 a3
-sltu s7 s3 s8
-srai t1 s10 15
-mulhsu s3 t4 t6
-slt t0 t3 s1
-slti a1 s6 -2048
-remu x0 x0 s8
-slli t3 a3 20
-div a0 a1 s10
-xor ra a7 s6
-mul a3 a4 t6
-div t1 a5 t5
-rem s0 s2 s4
-addi s0 x0 562
-sub a2 a7 s6
-or s0 tp s5
-add a1 gp a6
-mulhsu a3 t1 tp
-xori t3 a1 -1657
-sll t2 tp a4
-and a7 a2 s5
-div t5 a2 t5
-mulhsu s6 a5 tp
-addi a5 s10 1716
-sll a0 t4 s10
-slti s2 t4 -449
-sltiu t0 t3 1393
-sub x0 t1 s1
-xor a0 s2 a1
-sltu x0 gp x0
-mulhsu s3 t6 s5
-andi s10 a1 -1385
-div gp s8 s5
-mulhu s6 t2 s1
-sub a1 s10 a2
-remu s10 x0 s5
-srli t5 t1 28
-addi s5 s11 -670
-addi t0 s8 258
-mulhsu x0 a5 a7
-div s7 s1 x0
-auipc a7 456320
-divu t3 t0 gp
-srl t5 x0 ra
-sltiu tp x0 -906
-remu t0 a7 s8
-addi s5 t3 -697
-lui a6 553649
-srli a7 a4 5
-addi gp s2 1949
-rem t5 a0 ra
-or t5 a5 a5
-andi a5 a7 -430
-sub t5 t2 s1
-lui a5 464744
-xor s8 ra s8
-slli s7 s2 7
-srl tp s6 a5
-or x0 x0 s2
-slti x0 s8 -1743
-remu s11 s0 t1
-div s0 s7 ra
-srai t1 s6 16
-rem ra s4 a0
-xor ra a2 s3
-sltiu a0 x0 104
-mulhu s7 a6 a3
-divu t2 s6 a4
-add t2 t4 a4
-xor s10 s6 tp
-srli s11 s7 21
-mul a1 a6 t1
-slt s0 s8 s8
-add s5 ra a1
-mulh t6 s6 t0
-sub gp s2 a6
-xor s2 x0 t1
-div t4 s6 t1
-mul t2 a5 a7
-slti s10 s9 -59
-sll s11 s9 s6
-srli s3 s0 20
-sra s1 a5 a6
-andi a6 s6 -1854
-xori s6 a6 1565
-sra a0 a4 s3
-sltu s4 s2 t2
-srl ra s9 s1
-andi ra s9 -1911
-and s3 a2 s0
-andi s7 t5 1407
-srl x0 t6 tp
-sll t2 s0 s3
-srl s11 s0 s3
-add a6 gp a4
-slti s11 s4 -950
-mulhu s0 a2 t6
-slt a1 s8 a4
-mulhu a5 s1 x0
-addi s5 s2 484
-ori t3 s4 -912
-xori a4 gp -1173
-div t5 t2 s2
-sltu s3 a4 a6
-auipc gp 75937
-srl s2 x0 s5
-srl s6 ra t0
-slt a2 s9 a1
-sltiu tp t6 1019
-slti s0 s6 1984
-sltu s5 x0 a0
-slli s5 s1 4
-mul ra a4 s5
-sub t0 s9 a6
-slt s2 t6 tp
-mulhu x0 s7 x0
-sltu t2 a4 ra
-slti a1 gp 1805
-or s6 gp x0
-srli s0 x0 20
-mulh x0 t0 x0
-srl s9 s2 t6
-mulh t1 a1 s3
-sltu s6 ra s0
-and s3 t3 a1
-and a5 t5 ra
-sll s1 gp t1
-slti a3 x0 -403
-ori s6 a2 -1632
-lui ra 1015345
-and t1 tp s4
-andi tp s7 966
-or a0 t2 s8
-auipc a2 534878
-sll a2 a7 a7
-add t0 a1 a4
-slt s9 a0 a3
-addi gp gp -150
-mulhu t4 a6 s11
-mul s8 t4 x0
-divu a1 s3 t1
-lui a4 1007221
-addi a1 x0 1952
-srai s8 a0 25
-auipc s3 273481
-sub s1 t1 s10
-sub s9 a5 a2
-auipc t6 784809
-slti t3 s8 -1600
-srai x0 a1 28
-add a2 ra t1
-sltu s11 s5 s1
-andi a6 s10 1924
-sub s9 s5 gp
-slti a6 t2 -966
-sltu s0 s10 s1
-divu s3 a4 s9
-add t5 s5 s8
-srl s11 a5 x0
-sra s11 t2 a1
-andi s0 x0 1923
-remu t4 a4 a7
-sra s10 a0 t4
-mulhsu a0 a3 t0
-slli s10 a6 3
-addi s6 t0 -1230
-mulhsu t0 t2 x0
-sltu s7 a5 s4
-sltiu t6 s0 511
-rem s7 s2 s5
-mulhu a3 s7 a3
-lui s11 892002
-sll a2 s11 a5
-add s6 s4 t5
-divu s0 a3 s6
-sll s9 a6 s11
-divu t6 x0 t6
-xori s3 t4 450
-xor s8 a0 t3
-xori t3 t1 1318
-rem a7 s1 gp
-mulh s7 s4 gp
-slt t2 s5 t3
-srai s8 s5 11
-or s4 s6 s6
-and t2 gp t3
-sltiu a1 tp 1181
-sltu x0 a7 t4
-sltiu s11 s4 419
-sltiu x0 a2 -1619
-sltu s9 s3 s0
-mul ra tp s5
-slt s1 x0 t1
-auipc a3 594495
-srli s11 a3 14
-addi a0 a5 791
-or s8 s10 t1
-auipc s10 559789
-srl a3 t5 s7
-remu s4 s6 s11
-sltu a0 t5 s10
-divu x0 s11 t2
-ori s4 s3 -433
-and t4 s7 tp
-or a0 tp a1
-srli s8 s9 0
-lui t2 239023
-and t0 a3 s5
-divu t3 t5 t5
-slt a1 t1 tp
-rem s10 gp s0
-addi a0 a3 -1840
-srai a5 a0 29
-div s0 gp s9
-lui tp 33020
-lui t3 253000
-auipc s2 524704
-slli a1 x0 29
-and t5 s6 s3
-rem t4 a0 x0
-rem a1 s5 a4
-sra s6 s9 ra
-xori a7 s4 -1723
-srai s4 t0 20
-srai a2 t6 13
-ori s5 a5 -869
-addi s1 s11 855
-ori s4 s6 -1944
-mulhsu t5 t5 t4
-sra s5 s7 x0
-sltiu s2 s6 982
-divu s5 s0 s5
-addi s5 ra -1765
-slti s1 a6 -389
-xori a7 a1 -1957
-xor ra a7 s8
-slti t1 s1 -1829
-sltu x0 s2 s0
-srl s9 x0 s11
-srai a1 t4 10
-sra t4 a6 s11
-ori s6 t0 418
-or s11 gp s6
-mulh s10 s9 t0
-rem s1 tp s6
-addi tp ra -1851
-and s1 s11 t4
-divu s5 s1 a7
-slli x0 s6 1
-slti s9 s2 1847
-add t5 s1 t5
-auipc tp 945046
-slli s2 t1 28
-auipc gp 316486
-divu s3 a0 x0
-sra x0 s0 s6
-sll s6 a7 s6
-xor s11 s3 x0
-slti s8 a6 204
-or s9 a2 t4
-addi ra t5 -1797
-slt ra s8 a3
-add s2 t6 t2
-srai a0 tp 5
-sltu s4 a1 a6
-mul s1 t2 a6
-andi t2 t5 389
-remu x0 t2 s5
-sltiu t3 a0 1725
-or s5 a2 s5
-slti x0 s1 -1948
-remu t4 a1 a2
-slt s11 t3 a1
-sll s6 s3 s2
-srai s4 x0 6
-srli a6 s9 25
-slli x0 s11 1
-sltiu s1 t3 -1211
-mulhsu gp s0 a4
-divu t5 a7 a6
-sub a1 t1 s11
-addi a1 a2 -1684
-andi a1 s1 -1138
-srli s0 s5 7
-sub s6 a7 s6
-ori x0 s8 886
-slli a1 a5 5
-xori t5 t5 -1916
-mulh a2 s2 t5
-add x0 s0 s2
-sltiu a5 a0 -938
-mulhu a7 s10 t4
-sra s9 a6 t4
-sltiu a0 t4 -627
-or a3 t1 t2
-lui t4 473282
-slti s1 s9 949
-remu t4 gp t4
-slli t2 t3 8
-add ra a4 s6
-auipc s9 80245
-remu x0 s4 s3
-srl a7 a3 a4
-mulhu s7 a6 a0
-xori s6 s2 -1572
-rem s6 a0 s8
-rem t3 s3 s9
-srli s5 s7 1
-lui a6 901878
-slt t4 t4 gp
-or a1 a1 t5
-addi a0 s11 871
-mulhu s2 s3 a1
-and s1 s9 s6
-auipc a2 75412
-auipc s10 6388
-mulhu a6 t3 t2
-add a0 s4 s5
-lui s10 844397
-slti x0 a0 1185
-slli s5 a5 1
-srli gp t6 18
-lui a7 281613
-addi t2 t3 -16
-xor t5 s9 s0
-mulhsu t2 s0 a2
-and s9 s2 s0
-slt s10 t4 s10
-srl a4 a6 s11
-lui t3 524173
-slli x0 s5 3
-add a0 s0 t3
-rem a5 s7 ra
-and s2 a6 t3
-andi s1 s6 1287
-sltiu a2 a7 -87
-xori t2 tp 1117
-auipc t4 649357
-mulh s1 tp a7
-slli s2 x0 9
-srl a4 a6 ra
-sra t3 s10 ra
-sltu s1 t4 s2
-mulh s0 a3 t2
-sltiu x0 a2 -803
-xor s3 s10 gp
-xor s0 a1 a3
-srl s11 s7 gp
-add s4 s1 a7
-addi s1 s8 -1297
-sll s7 x0 a5
-and s8 s0 s9
-mulhsu t2 a7 t1
-andi s5 a0 -1118
-rem t5 s8 gp
-rem a2 a5 t2
-remu s1 s10 t3
-sltu x0 gp t1
-srai s3 s7 25
-or s4 s9 s11
-and a1 a2 s6
-addi s0 s3 -94
-xor s5 s0 s10
-sub t4 t2 t0
-srl s10 a4 gp
-srl tp tp t0
-xor gp s3 s2
-sra s9 s3 s2
-srai s0 s10 14
-addi s3 s2 -107
-or ra s8 ra
-srli s6 s1 0
-and s8 s2 s11
-auipc x0 476506
-rem ra s9 s3
-rem s10 a5 s8
-andi s1 s10 -1321
-auipc s3 131720
-srai a4 a5 13
-sub t0 a7 s8
-auipc t2 363608
-mulhsu t5 s5 x0
-slli s11 a0 16
-divu ra a1 t5
-mulhsu a0 s4 s5
-rem a7 a4 ra
-mulhsu s4 s8 t4
-or s11 s6 s6
-lui a0 887988
-auipc tp 424400
-sra a4 s6 x0
-srli s9 s5 17
-srai a3 t0 29
-slti a1 gp -423
-slli s11 tp 17
-rem x0 s11 gp
-mul t4 s9 s2
-sltu a7 ra a6
-and s1 s5 tp
-lui t0 678744
-srl s9 s11 t0
-mul a7 s9 a5
-addi a3 t1 1578
-srai s6 s6 27
-auipc s1 203369
-sltu ra t0 a4
-slti s0 a1 -1274
-lui tp 200799
-auipc s0 505592
-and t5 a0 t2
-sra t1 t1 s1
-xor a4 t4 tp
-div a6 s10 t0
-add s11 x0 s6
-ori t6 a4 -1930
-and a1 s4 a6
-add s9 a4 s2
-sltu s5 a4 s11
-ori t5 s10 -2037
-sub s0 s3 t0
-remu s11 a5 s6
-mulhsu t6 s10 t4
-auipc tp 645928
-div ra s7 s7
-slli t1 s8 17
-srl s3 s6 s2
-andi gp s11 -1432
-sltu s2 s9 s2
-andi t6 a0 320
-slli s2 s11 22
-or t2 s5 a7
-mulhu s1 a7 t6
-srai ra a2 17
-srl a4 ra s2
-sub s10 s8 a7
-sra ra a1 t0
-add t3 t1 s6
-and a2 s0 s0
-add gp a1 s5
-rem t2 gp s2
-div s2 s6 t2
-xori tp t3 -1492
-rem s10 a6 s9
-add s9 x0 tp
-rem t0 a0 s11
-divu a4 a6 x0
-addi s11 t4 -1277
-xori gp a5 -361
-srli a5 s10 19
-ori s5 a5 -1318
-ori a0 a1 -574
-remu t3 t1 s1
-sra s1 x0 a4
-divu s2 s2 a4
-sll t2 s5 tp
-ori s10 t5 -613
-and s10 t5 s2
-srli s10 s7 14
-remu a0 t6 a2
-ori x0 s1 -508
-sub x0 s4 s1
-addi a1 s9 -1137
-andi a0 t4 1961
-sltiu s9 a3 -882
-mulhu s6 t3 t0
-mul x0 a0 s7
-sub gp s3 s7
-and a7 s1 x0
-rem gp x0 a3
-lui t4 486195
-lui a7 617248
-slt t0 t1 a7
-srli gp s1 31
-xor s8 ra a4
-mulhsu t2 s5 s8
-sltu t5 s7 a5
-ori s6 a0 -1518
-mulhu s11 a6 s7
-srai a6 a0 29
-divu t1 s10 s2
-add t6 ra t6
-and t6 s4 t0
-add s8 a4 x0
-ori t2 s5 -251
-mulh s4 t4 a3
-addi ra x0 -927
-auipc a7 977987
-or s7 gp a5
-andi a5 t6 278
-slt x0 a2 a7
-addi a2 s8 -1216
-mulhu tp t0 gp
-addi t6 s4 -110
-remu a3 a2 a5
-auipc ra 167733
-sll t0 s8 s2
-rem ra x0 ra
-srl a4 x0 s2
-or s9 t5 ra
-mul s3 t4 tp
-srli s5 gp 31
-auipc t2 580228
-slli tp s6 5
-andi t0 s3 -379
-xori s0 a0 -990
-add s10 t0 s10
-srli t1 s7 23
-xori a6 a5 -503
-mulhsu x0 a6 s2
-sra s8 t5 x0
-slti ra t2 880
-divu s10 a4 s1
-slt a2 a3 s10
-sra a4 x0 t4
-srl a2 a7 s3
-xori t6 a0 595
-divu s1 a2 s5
-slli gp a5 17
-rem s3 ra gp
-addi t4 s2 -497
-andi a0 t6 -626
-mulhu s5 s5 a1
-divu x0 a5 ra
-xor t3 s6 tp
-mulhsu s9 a3 s5
-sltu s2 a1 a4
-sll s5 gp x0
-srl s6 tp t4
-srli s5 x0 22
-div t6 a7 gp
-srai s10 a7 20
-sltu t1 s2 ra
-sltu s2 s3 s10
-rem t6 s1 s7
-slt s7 t0 s5
-srl s5 gp s9
-srli ra t5 12
-divu t1 s11 a2
-slti s6 ra -965
-auipc a4 218291
-and s6 s4 a4
-srai a7 tp 19
-xori s2 t5 1522
-xori t6 t4 800
-auipc t2 428616
-mulhu a7 a3 a6
-mulh a1 t5 s7
-lui s5 370706
-addi a5 s4 -1164
-remu x0 gp s5
-mulh s2 a0 x0
-srl t2 a3 t6
-and a6 x0 a1
-sltu a5 a7 a2
-divu a1 x0 s10
-mulhsu tp a5 t6
-mulh t0 a5 x0
-sra s4 a6 a6
-sub s9 s6 t5
-xori s8 s5 -1921
-xori x0 t4 -1435
-sub x0 t2 t1
-mulh s4 a2 t4
-and s3 t5 tp
-sltu s0 s4 x0
-slti s0 s7 -43
-srai t6 t2 7
-or s4 tp t5
-sub s6 a6 t0
-and s9 t3 t3
-mulh s3 t2 s1
-slt a1 s11 t2
-sub t2 t3 a1
-srli s6 s10 16
-addi a0 a1 -1745
-srl s0 s9 a7
-srli s1 s11 29
-divu t3 a4 t5
-mulhsu s8 a1 a0
-or t0 s10 s9
-auipc t3 773355
-add s1 s6 a1
-xor a7 s1 t6
-xori t4 a2 -1047
-sltu s0 a6 s6
-mul t4 s10 t5
-auipc s9 1039160
-auipc a1 702087
-xori a0 s9 -884
-sll a2 a6 t2
-remu s3 s9 a1
-srai t5 t1 21
-andi t6 s9 -403
-srai s8 t5 17
-srl a3 t0 s3
-divu x0 a2 a2
-div s4 a1 s9
-auipc s8 745250
-and t2 s6 a0
-sll s0 s0 s5
-or a5 a0 s9
-slt s5 s0 gp
-divu s0 s3 t5
-mulhu s9 s0 s5
-slti s6 a6 581
-and t5 a7 t1
-xor s6 ra tp
-lui s7 523177
-sll s3 ra a3
-xor s5 s3 s1
-mulhsu a6 t4 s7
-xori t1 s3 -1304
-mulh t5 a5 t0
-slti s8 s0 -557
-add s2 s9 a0
-rem a5 a6 t0
-andi t5 x0 -564
-andi a6 a7 -1242
-or s6 s10 gp
-lui s2 851841
-slli s11 t4 17
-slti s7 t4 -21
-slli x0 a7 3
-or a2 s3 a4
-divu s2 s2 tp
-and s2 x0 s8
-addi s11 s2 1958
-andi s9 a1 -955
-xor t3 ra t0
-xori t3 s10 1536
-addi a5 a2 -835
-sltiu s9 a7 -220
-slt s6 a4 s5
-remu tp s4 x0
-sll t6 t6 s3
-lui s4 196645
-lui a0 751687
-or tp t1 s2
-slti tp ra -1554
-mul t1 t6 s0
-srli t0 gp 20
-ori x0 gp -794
-or a6 s1 a0
-auipc a1 512385
-auipc s7 927306
-addi s0 tp -1059
-srai s0 s8 12
-xori s2 t6 -1448
-div s5 t3 t2
-divu gp t3 a5
-div s6 s10 t5
-mulhsu a6 s11 a6
-sltu t3 s9 s0
-auipc t5 753332
-ori s8 a3 1180
-slti s4 t3 -1878
-divu t1 s6 t5
-auipc a7 81788
-xori x0 gp -362
-sub gp t2 s10
-remu t2 gp s4
-mulhu s4 t3 s5
-lui a6 409130
-mulhu ra s2 s9
-sltiu s10 s4 -1613
-and tp x0 s3
-or s10 a7 s11
-sub a6 s6 s6
-divu x0 s1 s6
-divu t0 s9 s11
-and a0 a4 t2
-addi x0 gp -582
-srli s2 a7 10
-lui s7 601977
-srai ra t4 10
-and s0 a0 ra
-xor t0 s8 a6
-mulhu a2 a4 s1
-sll t2 a2 s1
-sll tp s10 a6
-sub s11 gp s0
-lui t2 674567
-divu t5 s7 s1
-xor a4 s2 s0
-srai t6 x0 3
-div a5 t3 s2
-sltu s9 a5 x0
-mulhu t0 s5 t2
-ori t5 t4 -2007
-ori s4 s1 1162
-andi s4 x0 -1396
-and tp s6 s9
-sra t4 a3 t6
-srai a3 a6 31
-div t0 a1 t2
-slt a2 s7 a3
-lui s3 237792
-andi a1 a2 -1768
-sub t6 t3 x0
-auipc a4 286412
-sub s4 a2 s2
-div s4 s4 a0
-srai t6 t6 3
-divu a0 a2 a3
-ori a7 t6 -1880
-remu t5 s8 t0
-slt s8 s6 a3
-mulh x0 t4 s5
-add a1 x0 a3
-remu t3 tp s8
-andi s10 s1 447
-srli a2 s0 20
-addi t5 t1 -1531
-mulhsu s3 s0 t0
-slti a6 t2 -1503
-andi x0 s6 -663
-xori s10 t3 1113
-auipc t0 1018051
-and a4 s6 a6
-sll gp t4 a4
-remu a1 t6 a4
-slli t3 ra 29
-slti s4 t2 -536
-sra a6 s9 a7
-andi s3 a6 -712
-and s4 t3 t0
-or s6 s6 a3
-add a2 a7 s9
-sltiu s1 s5 -597
-div a2 a4 a0
-and a0 t3 a3
-srai s9 x0 2
-and x0 t1 s5
-srli t2 s2 0
-andi t2 s0 1941
-mulh t6 s0 s11
-sll s7 s4 s3
-div gp s1 s11
-and s3 s5 s1
-sltu a3 s0 s11
-sub gp s10 ra
-xor a4 t6 gp
-divu x0 tp tp
-sltiu a1 s6 1109
-xori s4 a2 -1041
-sltu a2 x0 ra
-xor a0 t6 t6
-slti tp a3 -828
-div a0 a7 t1
-mulhu a0 t6 gp
-srli a0 s1 28
-slli x0 t6 30
-mul s4 t1 s10
-mul a5 s9 s6
-sra t5 t1 s2
-add a2 gp t2
-ori a1 s6 -189
-srai s3 t4 14
-mulhsu x0 s11 t0
-xori tp a7 -640
-mulhu a0 s7 a2
-srli s7 gp 31
-srl t5 a5 t6
-slli a1 a4 16
-xori a6 tp -627
-mulh s6 s10 gp
-div s9 s10 t6
-mulhsu t2 s1 a1
-mul s11 s2 x0
-ori t3 t2 -153
-sra t0 s8 t6
-mul s10 s4 s9
-sra tp s0 s7
-srl s2 t5 t1
-sub t5 t3 t2
-addi a1 tp -855
-addi s3 s2 1546
-and s0 s6 t2
-mulhu t0 s8 s7
-or a5 t0 x0
-xor gp s7 a4
-sub s4 gp s0
-sltiu s8 s8 1701
-srl gp t4 a6
-sub t6 s8 t2
-slli t0 t4 5
-slti s3 t1 -107
-auipc ra 307870
-sltiu s6 a5 980
-mulhsu s2 t1 x0
-sub a5 x0 a0
-rem s8 s9 ra
-sll t2 s8 t4
-andi t5 s10 972
-auipc a1 839767
-sltu t0 s10 t4
-mulh s8 ra t3
-lui t1 436558
-and s7 s4 a7
-sub t1 s7 s10
-mulhu t2 s11 tp
-mulhsu s10 s1 gp
-add tp a1 s0
-slti a5 s9 941
-rem s10 s4 a3
-add a5 s7 s8
-slt a2 a3 s7
-srl s7 s6 t6
-lui t1 5209
-auipc ra 241093
-mulhu s3 t1 t3
-addi s2 s6 1582
-srl s8 s2 s7
-sltiu a4 t1 -256
-and t4 s3 a2
-sltu a1 s9 a0
-slti s0 s3 -58
-or ra s5 a4
-xor t2 s8 a4
-slti a3 t2 -23
-slti s11 s11 -1344
-slti s6 s11 30
-divu a7 s11 gp
-srai t6 s0 7
-xor a3 a4 x0
-slti t0 s9 -1598
-slt tp gp tp
-div s5 t4 a6
-mulhu s9 s3 a0
-mul x0 a3 s0
-mulhsu s11 a1 s10
-mulhu s11 gp s7
-auipc x0 489461
-auipc s8 667339
-lui s0 743722
-mulhsu t4 a2 x0
-srai a3 s7 20
-mulhu t2 a5 s5
-srli t2 a1 28
-auipc ra 430228
-sll s0 a2 s9
-lui gp 100806
-slti s9 t3 898
-mulh x0 a1 a0
-div t0 gp t3
-or a2 t6 a1
-div s2 tp s10
-sltu ra t6 s7
-lui s4 978810
-xor t0 a0 x0
-add t6 ra s5
-or x0 a7 a3
-sra s1 s10 s8
-sltiu tp s4 -685
-sltu t0 t1 t1
-or x0 s5 s4
-slt t2 s3 s3
-srli a7 a0 25
-remu s7 tp gp
-mul t6 x0 s10
-sll gp s11 a0
-div tp s4 t3
-rem t3 tp s11
-divu a2 s7 a4
-div x0 t2 x0
-slt t5 s0 gp
-or a4 t0 t3
-srl tp a2 s10
-addi s7 a5 -1154
-rem a1 a6 a6
-divu a5 a4 t3
-xori s8 s2 1749
-srai t4 s7 10
-mulh s10 a6 a7
-remu ra s8 x0
-mulh a5 a1 ra
-mulh s5 a7 t0
-div s1 s7 t4
-addi t6 s6 -435
-and s9 s0 t0
-srl a1 tp s11
-sub t2 a0 x0
-div s8 gp a1
-lui gp 687074
-sub s1 a2 x0
-remu t2 tp a5
-xori t3 t1 -1153
-xor s7 a7 a5
-lui a2 908560
-mulhu s6 t2 x0
-slli s8 t6 23
+srli t4 a0 21
+and s11 s0 t3
+mulh t6 a0 s0
+srai s6 a1 21
+sll a1 a4 x0
+auipc s0 329464
+srl a6 s1 a0
+lui s3 603404
+slli s4 s9 26
+add ra a3 t5
+slti gp s9 -1704
+xor x0 s6 t1
+slt a7 s1 tp
+addi a1 t2 1491
+divu t4 a4 s3
+sub t1 ra t5
+ori t5 tp 129
+srai t3 s2 12
+srli t0 s3 18
+andi s11 s0 951
+sll a0 s9 s4
+sra s3 t0 a7
+sll t2 a0 s3
+mulhu a3 gp a3
+sltu t1 tp a2
+sub a4 a7 s1
+lui a7 282596
+srli a2 s3 2
+srl s11 s11 x0
+andi gp s0 -1123
+sltu a6 s7 s8
+sll s7 s3 a7
+xori s1 s7 -1890
+addi t3 t3 1577
+rem s11 tp s4
+or s10 s5 ra
+remu tp a4 tp
+remu s3 t6 gp
+or t1 a4 a2
+remu x0 t4 t4
+and gp a7 t2
+divu ra s11 t2
+slti t6 x0 -1794
+divu t3 s2 s6
+mulhsu a6 s2 s8
+sltiu s3 ra -1771
+mulh s11 a3 a2
+auipc a6 134527
+mulhsu s1 t4 t4
+div s4 s11 s7
+slt s6 s7 s11
+remu a4 s5 a3
+rem t2 s3 s11
+ori a0 s1 605
+div x0 a3 t4
+mulh t1 s3 gp
+ori t6 s0 37
+sltiu s0 s0 1117
+and s8 s0 a7
+remu a5 a5 a3
+srl a4 s3 x0
+sub s7 tp s11
+mulh s5 s9 s6
+srli t2 s10 28
+srl s3 s4 s2
+or a0 x0 a5
+slti s2 a4 799
+mul t3 s2 t3
+srai a6 t5 20
+xor x0 a7 s8
+auipc s6 462268
+mulh ra gp s1
+or a7 t1 t4
+mulhsu s0 a7 t0
+xori s2 t6 1076
+xori a7 s10 574
+xori t2 a1 -1183
+xori s2 t0 -1120
+add a6 s10 a6
+srai s6 s3 25
+remu s4 a7 t5
+sltu t0 t3 s9
+mulhsu gp t3 a0
+slli s1 x0 19
+sltiu s2 s8 -99
+div a2 t0 s11
+srli ra ra 20
+auipc a4 917132
+sltu a0 a4 s0
+andi s8 a3 1377
+addi s8 t6 1628
+andi s9 a1 -142
+srl t2 s3 s7
+srl t6 a4 gp
+srl t1 x0 a0
+srli t2 gp 23
+and s5 a5 ra
+and a7 s11 t6
+and x0 t0 x0
+mul s2 a0 t1
+andi a6 t5 905
+slt tp a1 a4
+srl a6 t3 s2
+srli s0 a4 9
+and s1 a3 a2
+mulhsu s0 s7 s3
+sltu s10 a5 s3
+add s8 a2 s4
+xor t3 x0 s9
+mulhu s6 t3 s4
+mul a3 a3 s7
+mul s3 s0 s10
+mul a6 t0 t6
+srai t4 t5 0
+mulhsu s11 s6 s6
+sub t6 a3 s0
+remu s3 s11 a1
+and t3 a4 s0
+or s3 s4 a4
+andi gp s6 -985
+srai s9 tp 11
+mulhu t0 t5 a1
+auipc s7 485994
+rem x0 a7 t5
+add gp t3 s8
+mulhsu a7 s3 t0
+lui s1 930761
+remu gp a5 s0
+sll x0 s3 s10
+remu s9 a0 a6
+and a2 tp s3
+div a0 a1 t6
+and t5 a2 gp
+mulhu t3 t1 s4
+xori s9 a1 1916
+mulhsu a3 x0 s3
+div s7 tp a3
+add x0 a3 a4
+divu t1 tp t1
+slli a1 t5 4
+sub a4 s2 t6
+srai a4 gp 5
+xori t2 s9 -1431
+xori t4 s7 -1700
+addi a4 s7 421
+xori t2 a3 -893
+and s6 t5 s0
+sltiu a5 x0 985
+lui t4 904178
+div s0 a6 s6
+slt t3 s0 t4
+div s5 a6 s11
+ori s0 s2 -336
+add a5 t5 s1
+ori a7 s2 -287
+lui a0 1000587
+sll a3 s1 a7
+ori t3 t0 -1901
+mulh t0 s5 s6
+div tp s1 gp
+mulhu t4 s3 s7
+srli s9 s1 23
+sra s10 a3 ra
+andi ra a3 520
+andi t4 a2 -437
+mulhsu a7 a4 s2
+mulhsu t5 s11 s10
+slti a1 s2 812
+divu ra a7 a3
+mul s5 t5 s8
+andi a5 a6 -1074
+mulhu s3 t0 s10
+auipc a3 731442
+sll s1 s11 t0
+slt s5 a6 x0
+mulh s1 s10 t6
+xori s7 s11 -1960
+sltiu t1 s7 -513
+add a2 s4 s7
+remu t4 s9 tp
+slti a2 s9 723
+mulh a0 s8 s9
+remu s3 s2 s7
+mulh a0 s2 s9
+ori s8 s11 -1982
+or tp gp tp
+divu a2 s1 s4
+sra t4 tp s6
+mulh x0 t6 s0
+slti t2 a3 -1512
+or ra t6 s5
+sub a7 s6 t3
+rem s3 t5 t5
+srli t1 a1 29
+auipc a7 107528
+sub t5 t0 a4
+sltu gp s6 s10
+lui t2 384180
+sltu s2 t1 a7
+and s0 s10 s10
+mulh s6 a4 s2
+sra s4 s3 a2
+srl gp a1 a3
+srai ra a4 7
+mulhu s5 tp a2
+xor t6 a6 t2
+addi s8 a2 -1882
+srai a1 gp 9
+or s11 a2 s7
+add s9 t3 a4
+slt t1 a6 a5
+sra t3 s11 ra
+andi s1 s9 538
+sra s3 t2 s2
+remu s0 a2 a2
+div a5 s1 s9
+xor x0 s7 t3
+xori a7 t2 -611
+sub t1 a3 s9
+rem x0 s6 a6
+srai a0 t1 18
+sltiu a1 t1 976
+add s10 t0 a6
+div s2 s10 a2
+add t2 s10 a2
+mulh a4 a6 s9
+sltu x0 a4 s6
+slti a7 tp 949
+andi a7 t5 -735
+or s7 t1 s4
+andi a5 s6 -1017
+remu a1 a7 a2
+divu gp a4 t1
+sub a6 s9 s6
+srli a4 a7 30
+slt s4 a5 a6
+srai gp t2 18
+xori a5 s9 -1873
+srai tp t6 2
+sll t2 t0 tp
+sra s6 t1 tp
+andi s10 s3 -689
+xor s0 s7 t2
+ori x0 s9 -531
+sub a6 t0 s3
+sra s4 s0 s0
+xor ra a7 t2
+xori a3 s2 -1308
+or s0 s7 a0
+slli s3 s1 30
 sub t0 s7 t1
-div tp s11 t1
-or tp s3 a5
-sra t1 ra t0
-sra s10 ra s5
-srli a7 a0 18
-andi a2 s5 1202
-xor tp x0 s2
-sll a5 t5 a1
-srai ra s3 10
-remu t5 s7 t6
-mulh x0 ra s0
-div tp s5 x0
-divu a1 t0 s5
-xor tp t0 t5
-mulh tp s7 t0
-sltiu a1 s2 -442
-mul x0 t1 s3
-srli a3 a6 0
-and s9 s7 s0
-mul x0 s4 s1
-srai t6 t5 12
-slli t0 gp 13
-addi t2 a7 -360
-or a1 s11 t1
-add t0 x0 gp
-sra s5 t3 s8
-srl s4 a6 t6
-mulhu t4 t0 a2
-mulh s2 s7 a3
-remu ra s2 a2
-sll a3 a1 t5
-div tp a6 a4
-xori a1 t2 -1342
-add t1 s10 t1
-addi s9 x0 -40
-auipc tp 708662
-auipc s7 706006
-srai a6 tp 4
-andi s11 t2 -950
-sltiu t6 t5 -1095
-add s4 a1 s9
-mulhsu s2 s2 s3
-xori s2 a4 -397
-sub t0 a0 s11
-sra s11 a1 a4
-xor a2 s3 t0
-remu x0 t4 s9
-auipc s10 796773
-sltu a3 s11 t5
-sra gp t3 a7
-xor x0 t0 a3
-sltu s3 t0 t6
-srl a3 s8 a1
-sltu a0 a6 gp
-or a4 s2 s3
-sll a0 s5 s4
-divu a2 x0 tp
-sub t0 s11 a7
-mul a6 t2 gp
-mul s8 ra a2
-xori s3 a0 -1847
-sub t6 a4 gp
-and t6 a4 s0
-remu a0 s7 a1
-addi s10 a4 -179
-mulhsu t2 a4 tp
-mul gp t6 t6
-sub t5 s7 t4
-and s4 s6 a3
-sra t4 t6 a6
-sub tp t5 t3
-srai ra a3 0
-andi s3 a7 824
+ori s3 s0 -1621
+andi tp t0 -21
+xor s5 t4 s1
+sra s9 s2 a1
+srl t4 t1 s3
+remu t1 a1 s5
+sltiu s1 a4 242
+slti s3 x0 -1561
+mulh t4 s11 s9
+div s4 t0 s11
+rem t6 a4 s4
+sltu s3 s9 gp
+sub tp gp gp
+lui s8 426532
+and a2 s3 s1
+mulhsu gp a5 t5
+sltu a1 t1 s9
+ori s4 t3 -788
+slli s8 s11 29
+sltu gp a4 t4
+xor a0 a7 a3
+div s2 tp t3
+divu a7 a2 t0
+srli s4 a5 23
+sub tp gp s11
+slti s6 s1 -1258
+remu a1 a5 a1
+sltu s2 a1 x0
+lui s5 284564
+mulhu s8 t1 s7
+mulh s9 a5 a7
+sra a3 s9 t6
+or a0 t2 a2
+remu t5 a6 t3
+div a4 a0 s4
+srli s10 s11 31
+mulhsu s2 s0 s7
+auipc a2 480737
+slti gp x0 -54
+addi s7 t5 1180
+mulhu s9 a6 x0
+slli t4 s3 23
+divu x0 a1 s10
+auipc s5 794887
+auipc a7 41060
+andi a6 a6 -1127
+andi s6 gp -860
+slt a7 t6 a7
+sra t6 s5 a5
+or a7 s7 x0
+mulhsu s7 s1 tp
+xori a3 a4 -1356
+xori s8 s7 -880
+xori a5 a1 -407
+mulhu tp t5 t2
+rem t4 tp tp
+xori a4 s8 -135
+mulhsu a2 s2 s3
+and s6 t3 s9
+sra s0 a3 t0
+sra s0 s5 s10
+slt t6 s5 s11
+and a2 t4 s1
+remu gp s4 s2
+sltu a1 gp s8
+mul s6 a5 s7
+slli s1 a7 9
+xor a0 ra s1
+divu t6 a3 a7
+mulh t3 gp tp
+mulhsu gp a5 a7
+lui s6 657557
+addi ra a5 -606
+rem s5 t5 tp
+sll s7 s5 gp
+xor s2 tp a3
+andi s4 s9 -6
+sra s2 tp a4
+or a7 s4 a1
+auipc a1 556632
+auipc s6 326583
+slt s4 a6 t1
+sra a4 s4 t3
+and t0 t1 t6
+sltiu a2 s7 -1457
+slt gp t6 t5
+div s7 s2 s5
+or t6 s0 s1
+xor t6 a6 a6
+xori s9 s7 -1356
+sra a4 s0 a3
+remu s4 a0 gp
+divu s4 t4 s7
+sltu s1 a4 s5
+and a1 a6 t1
+sltiu a5 a4 -1129
+mulhsu s10 s1 t1
+slt a1 s9 a4
+mulh s4 s0 s2
+addi ra t5 -1729
+mulh s6 t3 x0
+remu a3 tp t4
+sra a6 t5 s10
+addi t4 a3 -1433
+mulhu t6 a5 s11
+sra s7 a1 s1
+lui tp 728557
+slli a2 s11 31
+mul s7 a7 s1
+mulhu s10 t6 s3
+mulhu t4 ra s11
+srai a4 gp 26
+andi s4 a3 747
+xori a1 a4 -22
+mulhu a3 t3 t0
+xori a4 a7 -1924
+add gp a1 tp
+sltiu s0 s3 -694
+xor t6 tp s11
+mulhsu a2 s5 s9
+mulhsu t4 tp a2
+srai gp a5 10
+sltu t1 s7 s7
+slti s6 s5 -84
+divu s0 a0 t2
+xori t2 t1 -1514
+sub t0 s4 t1
+mul a6 s7 s10
+add s11 t3 s11
+mulhsu a5 s2 t6
+or s7 gp a2
+div t2 s11 t1
+add s2 s5 s10
+sra s11 t1 t2
+slli s0 a2 4
+xor a2 a2 a1
+or s9 s3 s7
+sltiu a2 s8 1814
+rem a5 s0 t5
+xori a6 a4 641
+mulh gp s1 a1
+srl s0 s3 t3
+mulh a7 a3 t3
+addi a1 s10 -1245
+slt a1 s10 s9
+srl t5 a3 s10
+slt t0 a7 t2
+and t0 a2 s6
+xor t4 gp a2
+sltiu s0 ra -1662
+lui s3 27495
+srli gp a2 11
+srli t4 s11 28
+slt s11 a2 s9
+slt gp s0 a1
+mulhu s1 s9 a1
+srli s4 a1 12
+mulh t5 t3 a4
+mulhu a0 s8 tp
+srl a7 s8 t0
+ori t5 ra 24
+auipc t6 830501
+rem a0 t6 s6
+mul s4 s2 s1
+slli s1 a1 14
+sltiu s3 a7 -1884
+divu a4 a2 a1
+sub s10 a7 t3
+auipc t1 890899
+mulhsu a5 a2 s9
+mulh a2 s9 s9
+mulh s9 t4 a5
+sra a7 s10 a3
+or s0 s1 gp
+sub s1 t3 t3
+slti t3 s6 -484
+sltiu x0 x0 -1158
+remu s1 a4 s9
+or tp s4 gp
+div t1 s8 t3
+or x0 ra tp
+div s5 s7 t5
+srl t1 a5 t2
+lui a7 260554
+slt s3 t3 s5
+add s9 ra s11
+andi t5 x0 -227
+ori a3 a5 -1138
+div t1 s3 s7
+ori s0 s11 1473
+ori a2 a1 -1442
+add t2 t5 s10
+sltiu gp s3 -845
+remu gp s10 tp
+remu t1 a1 a2
+addi t5 s9 -1674
+srai s4 a5 12
+sltiu t0 tp -1746
+ori t0 a1 -1203
+sll t5 a0 s8
+auipc a0 606761
+slti t0 a4 -848
+ori x0 t5 514
+ori s3 s3 -1176
+xor a3 s4 s3
+mul a3 t2 x0
+auipc a2 921467
+sub t3 s5 t1
+mul t4 s4 a4
+ori a2 a1 -277
+sltu s9 x0 s5
+mulhu s4 t3 t0
+sll s2 t6 s9
+addi s1 a3 1633
+add a5 x0 s6
+sub x0 s8 tp
+sltiu ra t1 485
+mulhsu t6 s1 s1
+add s2 s0 s2
+ori t0 s2 846
+div t1 s10 a0
+srai x0 t4 1
+auipc t5 195737
+andi s6 a7 -1941
+auipc t3 942264
+mulhu a2 s6 s8
+slti s7 a3 -1207
+add a6 s3 t6
+sra s6 a7 s3
+srai gp a7 3
+sub t6 gp t6
+srl s9 s8 s1
+auipc x0 811410
+srli t3 s5 18
+sra tp s9 a4
+srai s5 s7 14
+div ra s2 s11
+srl t0 s10 a6
+or tp a1 s7
+sub s5 t5 s8
+srl t2 t4 s3
+remu s6 s6 t1
+lui gp 189169
+mulhu s2 s0 s11
+slli t3 t5 30
+ori ra s6 -579
+auipc a2 149201
+rem ra ra s5
+and s9 s4 s3
+sltiu t3 s1 1739
+or s6 s1 s1
+sub s3 ra a4
+ori s7 s1 -122
+auipc s7 606668
+divu s7 s6 x0
+srli a2 t3 17
+divu s3 a1 ra
+remu a1 t3 x0
+addi a1 s5 1042
+slt a7 s8 a3
+rem s8 tp s8
+sltiu s11 gp 555
+rem a0 x0 tp
+srai s8 x0 10
+srai a3 s5 5
+addi t5 x0 606
+sra a6 s10 tp
+sra t3 tp s4
+rem s9 s7 a5
+slt s10 a1 t6
+div s10 s11 a6
+sra a0 s3 s4
+slli a5 s9 22
+srli gp s3 0
+addi s9 t6 1490
+or s0 s8 s8
+auipc tp 181046
+slt a4 s0 t6
+srai a4 s10 30
+mulh t0 a0 a3
+srli a7 t1 26
+divu a0 t0 x0
+add s4 a3 s8
+div t5 s7 s3
+lui a4 770430
+srai tp a5 8
+mulh a6 ra a2
+mulhu tp s2 tp
+srl t0 x0 s10
+mul s8 s2 s11
+xori a6 s9 -2011
+ori a3 a0 -551
+mulhu gp s5 a1
+andi s2 t3 -88
+sra s1 s10 tp
+ori s9 a4 -235
+addi a0 a4 -1046
+xor t0 s11 t2
+xor a0 a5 a2
+slli s1 t6 27
+slti a2 a6 -1188
+add s1 a3 s2
+or s10 x0 a2
+slti s8 s7 1990
+srai t3 s10 25
+div ra a3 s0
+mulhsu a5 s11 ra
+srai a0 s3 23
+add s6 ra a4
+sltu gp a0 s4
+sra t1 s8 gp
+srl a6 gp a7
+mulhsu a6 t0 t2
+srli a6 a7 6
+mulhsu a1 a2 s0
+ori a1 a2 -989
+sltu s2 a2 s6
+or s6 t1 t0
+andi s8 a5 -1798
+mulh s1 a0 tp
+mulhsu t0 s4 a0
+andi a1 gp 1536
+auipc a2 713616
+div a4 s0 s6
+xor s0 a3 t1
+lui s8 955232
+xor s8 t4 a6
+sltiu s11 t2 973
+lui s2 146428
+sltu a2 a2 s3
+lui a6 421542
+lui a0 726735
+ori s0 t4 1569
+add s1 a5 a3
+sltu s3 t3 t3
+and a3 a5 s6
+and a3 t1 a5
+lui t2 384080
+or a3 s4 a2
+slt a3 a5 t3
+mulhu a4 a1 a3
+ori x0 t5 1617
+or a4 gp s0
+xori ra s1 -979
+and s5 t4 t2
+slt a6 s11 s7
+srli s4 a5 21
+sub s11 s9 x0
+srl gp a4 a5
+or s4 s11 a4
+slti a0 t4 1983
+sll a5 s2 a7
+mulhsu a5 t2 t2
+auipc s7 641693
+mul a1 t5 x0
+sll s10 a3 s9
+addi a7 s9 -842
+slli s3 gp 9
+remu t1 a1 a2
+mulhu t1 a4 a7
+mul s2 s1 a6
+xor a7 s1 gp
+and a4 t1 a5
+mulh a2 t4 t0
+mul a4 s4 t1
+mulh a1 s4 a6
+sltiu t6 t3 -845
+slt s9 ra ra
+div s1 a5 s5
+sra a5 x0 s9
+slli s4 s5 12
+divu a6 gp t6
+slti s9 ra -1330
+sll s1 a0 ra
+sub tp a3 a0
+sltiu s2 a6 1996
+srl a1 t2 s9
+auipc t5 737052
+addi a7 t4 -1968
+sltiu tp s5 -1577
+ori s9 s7 1104
+xori t1 x0 -1298
+addi a7 s1 -1646
+add s0 s8 s9
+remu s2 s0 t2
+add s11 gp s3
+div s3 a4 s10
+mulhsu s8 s4 a2
+sra a6 a6 t0
+add s3 s9 a2
+sltiu s1 a3 -195
+mulhsu s8 ra a4
+mulh s6 s1 t4
+remu s9 s10 a4
+or a5 a6 s9
+sltiu a1 s10 -1901
+divu tp a2 s7
+mul ra t4 s0
+mul t5 s0 a3
+andi t3 s9 346
+srli t0 s6 23
+slti t0 a7 -1652
+slti a0 t5 -695
+sub a3 s0 s5
+addi t3 s10 1202
+auipc s1 2878
+sub t4 s6 t2
+xori t4 a1 -1883
+divu t2 a2 t0
+andi s8 t2 1309
+ori s6 s0 -264
+mulhsu s4 s11 a3
+mulhu t0 s5 s0
+srl s4 s5 t3
+sra a3 s6 a2
+sltu s11 t0 t6
+mulhu s10 s3 s5
+mulhsu ra t0 s3
+auipc s3 876265
+or t3 t5 t4
+lui s8 465684
+mulhsu s5 a7 a7
+xori t4 s9 -733
+slli gp t4 16
+addi t3 a7 859
+add a5 t5 t3
+remu s11 gp x0
+lui a3 505296
+divu s9 a3 s0
+mul a0 a0 tp
+mulhsu ra s4 a7
+andi t3 a2 1040
+addi s0 s0 -768
+sltiu t5 a2 -1676
+mul s5 tp s6
+mulhu gp t6 s5
+xori ra s8 -1623
+divu s8 s4 t0
+xor a7 s2 s0
+mulhu t3 a5 s1
+divu s6 t0 t4
+divu t6 t4 t4
+slt a3 s6 a3
+auipc s2 61238
+sltiu a4 t4 1791
+xor a3 s9 s7
+remu t2 s9 gp
+and t5 t6 s2
+srai tp a6 7
 srl t3 a7 s1
-xor a7 t6 a3
-xor s4 a2 s3
-xori s10 s1 -464
-mul s2 s4 tp
-sll a0 s7 t0
-auipc s5 38324
-add a7 a2 a2
-auipc s9 134574
-mulh x0 s7 s10
-mulhsu t0 s7 t3
-rem s11 a5 a0
-sltiu x0 s2 -1338
-srai a2 s5 22
-srai x0 gp 17
-srai t3 s2 27
-mulhsu gp s8 t1
-auipc s6 703539
-srli a7 s11 22
-addi t6 t6 -1362
-and a5 ra s10
-addi t3 t6 -1984
-and s6 a4 t5
-andi s1 ra -243
-srli tp a5 8
-auipc a1 927197
-srl t4 a6 s8
-srai t2 s9 0
-sltu a1 t0 a0
-slti t4 x0 598
-and a1 s1 x0
-sltiu s3 s8 702
-div t1 a7 a2
-divu t4 a6 s9
-mulhu t5 s2 a5
-srai t0 a2 28
-sra s0 a2 s2
-div s8 ra s2
-addi a3 s0 -1396
-remu s10 a3 a7
-add a6 t4 s6
-xor s11 s3 a0
-rem t1 x0 s5
-mulhu a6 gp a2
-div t1 a7 s3
-and gp s11 s3
-or a1 t3 s0
-slti t1 s5 -1945
-mulhu a2 s5 a3
-srai a4 s5 7
-mul t0 t2 s2
-sll a5 s7 t1
-sll t2 tp t3
-mulh ra s10 a7
-ori t2 a3 1530
-mul t3 s10 s9
-add s0 s5 t1
-andi a5 t0 -1125
-slti tp s4 -608
-mulh a4 a1 t2
-mulhsu s10 a4 s10
-add x0 t4 a1
-divu t2 s0 t1
-sltiu s0 a6 -1582
-mul a0 tp s1
-srl gp a3 s7
-slti a3 ra -110
-mulh a6 a7 a2
-mulhsu t4 s2 t3
-mulhsu s8 x0 ra
-srl gp a5 s2
-srli a4 s7 8
-slti s2 s1 -1050
-mulhsu t6 x0 s8
-divu a7 a7 s4
-sltiu s9 s1 -1731
-add s0 s11 s9
-sub a1 x0 s5
-mul s2 s7 s7
-or x0 s7 a3
-slt s0 s9 s10
-mul a3 s2 t5
-andi s7 t2 1014
-andi s1 a1 -1696
-mul s1 s8 s10
-mul t5 s6 x0
-mul s8 gp t3
-div a7 tp s5
-or a1 a7 s8
-sltu a5 a5 s11
-srli a5 x0 27
-sra gp a1 t3
-add t4 a5 t6
-srli s4 t2 24
-andi s5 a6 1765
-sltu s8 s3 t6
-xori t4 s11 -214
-sll x0 s10 s3
-slt s7 ra a0
-mulh s6 s8 a7
-sll a4 x0 t1
-sub a0 s2 s2
-slti s4 t5 986
-slli a7 a4 12
-or s8 s7 x0
-rem t4 s2 s7
-xori gp t3 -281
-addi tp s10 -133
-slli a7 a2 26
-slti a2 t0 -1186
-sltiu a6 a2 1218
-mulh t3 a7 a7
-mul s9 a3 t0
-srai a0 a4 10
-mulh ra t6 s1
-sltu a2 a4 a2
-lui t2 212231
-slli s9 s4 23
-srli s3 a1 11
-sltiu a6 x0 -478
-srli a4 t6 25
-sll s9 s0 s9
-slti s3 t6 870
-mul s8 s0 s10
-remu s1 t4 a0
-sra s4 a4 s2
-divu t2 s9 a4
-mulh ra s9 a5
-and a3 t4 s6
-sltu a6 s1 t5
-srl s4 a6 tp
-andi a1 a1 -838
-sll x0 t0 x0
-slti s9 s3 -859
-and a6 a1 a2
-slli t2 s3 27
-srli a3 a4 13
-lui t6 13092
-remu t5 a6 a1
-lui s9 855253
-sll t1 s5 s6
-sll a6 a2 s7
-mulhu t5 s1 s8
-addi a3 s11 1502
-mulh a5 a1 tp
-mul a4 a3 s2
-rem s9 s10 ra
-divu t3 s8 s5
-ori a7 s5 -1799
-sltu gp ra a4
-lui t0 827708
-addi s11 t5 0
-divu s0 s9 a6
-slti s6 s4 -1353
-sltiu s3 s4 -759
-srl a3 a3 t6
-sltu s0 a1 a4
-slti s6 s10 -687
-andi s9 s3 -1975
-or x0 a7 t2
-and gp t3 a5
-sll ra s1 gp
-remu s5 a4 a5
-auipc x0 920341
-remu s2 a1 s6
-or t4 t3 s1
-divu t4 s8 a6
-sll a2 t3 t5
-mulhsu s11 s9 s7
-and t1 x0 t2
-divu t3 s7 a4
-xor s7 ra s1
-addi s8 t0 -1167
-or x0 s1 t5
-div s4 t3 a3
-addi s3 s4 -1109
-srai a0 a1 20
-sltiu t1 s5 300
-sltiu a7 gp -354
-slt ra t0 t3
-sra s3 a2 a4
-sra a1 t4 a4
-sll s8 s10 a4
-lui a7 588334
-sll s1 t0 t0
-ori t3 s9 -210
-mulhsu a7 s0 tp
-remu s8 x0 t0
-add a2 s11 s11
-addi a3 a3 -1749
-slli s11 s0 18
-mulhu s9 a3 t1
-rem a1 s8 a4
-add tp s0 s1
-slti s8 t5 -1744
-mulhsu a5 s5 a0
-mul a0 t4 a0
-divu gp x0 t2
-srai t0 t1 25
-mulhu a7 s2 a4
-add x0 s1 s2
-mulh s1 a3 s2
-sltu t6 s7 t3
-auipc s2 552646
-and s6 s1 a2
-slli a7 s9 30
-lui s2 608821
-xor t2 t2 x0
-sltiu ra s7 -1487
-divu t2 s1 s2
-xori gp s11 -197
-mulhsu t0 s1 s2
-or ra s8 t6
-slt s3 s3 a1
-and a3 ra a6
-sra a4 s0 s4
-mul x0 s0 t6
-srli t2 a4 29
-andi x0 ra -655
-remu s0 s3 s7
-or t3 s3 a3
-sra t6 a7 gp
-srai s1 s0 5
-mul t5 t1 t6
-slti x0 tp -642
-slli a4 t5 5
-sltu t2 a0 s7
-sltiu a1 s5 -1676
-xori a7 t5 -1224
-divu s2 a2 t3
-andi s3 a1 1127
-srli t4 a1 3
-addi t3 t0 134
-slli s8 s4 8
-sub a7 s6 a5
-auipc a7 898333
-srl tp s0 s11
-sll s3 s2 t2
-sltu s8 s10 a2
-or a1 t5 a4
-slt s4 a7 x0
-and ra t3 t3
-srl x0 t1 a2
-and tp t1 a2
-xori a0 t5 -1940
-divu t0 x0 a7
-slt t4 s3 t4
-mul s4 a5 a7
-mul a0 t5 s2
-andi s0 t5 -913
-ori t0 s7 -1463
-div x0 a7 t1
-xori a0 t1 -207
-sub s7 s9 a1
-slli t3 x0 11
-slti t6 a4 -396
-mulhsu a6 s3 tp
-srl x0 s7 x0
-mul s2 s4 a0
-sltiu s1 a0 -1602
-addi x0 s5 -423
-mulhsu a6 s11 t0
-xori x0 s1 224
-srai t5 s4 9
-mulh s7 t0 s4
-div gp t0 a0
-sub gp a6 a6
-slti s11 gp 1660
-sltiu s0 s10 2041
-divu t3 t2 s1
-divu a0 s5 x0
-lui ra 995719
-and t4 a5 a2
-sll ra t3 s6
-mulhsu t5 t3 x0
-slli a1 t6 9
-sltu s7 a6 t3
-mulhu s2 s5 s3
-div t6 a6 s0
-srl s3 t5 a7
-xor s2 t6 t1
-sltu x0 gp t0
-mul a6 s4 t4
-slt t2 t3 x0
-mulhsu a2 t3 x0
-slli a5 a4 31
-srli t2 a3 7
-srai gp s3 12
-slli s11 s11 2
-slti s7 x0 -706
-sll s10 s5 s9
-or a6 a0 a5
-slli s0 t1 19
-or a6 a3 a3
-mulh s5 t5 s4
-mulhsu t5 s9 s8
-xor t3 a2 s4
-sll x0 tp s1
-div t0 x0 a6
-srl tp a1 a1
-andi a5 t1 1258
-srli s6 tp 13
-rem ra t6 s11
-ori a7 a4 -1152
-sltu s0 t4 s9
-remu x0 t6 s2
-remu a3 t4 a1
-and s10 s2 tp
-divu s0 s7 ra
-srli t5 s1 25
-sltu a4 s9 s4
-remu ra x0 s0
-sra t4 x0 s7
-rem s9 s6 t5
-remu x0 a7 t3
-srl s3 s5 ra
-add t4 t5 x0
-xor s8 s11 s10
-div t5 a4 x0
-remu a2 t0 tp
-div x0 t4 ra
-srai s6 t3 7
-srli s2 t3 26
-div t5 s9 ra
-srl a0 s10 t1
-srli s7 a4 11
-rem s10 s6 a0
-rem a3 ra s4
-auipc a2 489627
-lui a4 758778
-sll a1 a2 s10
-rem t4 t6 t5
-or x0 s9 a5
-lui s9 565412
-srai t4 s4 17
-add s0 x0 t6
-slt t1 t0 t1
-sltu t2 a6 a6
-sra s2 gp t6
-div t2 t4 gp
-sll t1 t6 s8
-remu t1 gp t6
-mulhsu a1 s0 t2
-lui a4 669581
-mulhu t1 s10 s4
-sltu gp t4 s2
-and a0 a0 s11
-xor ra x0 t5
-sll a7 t1 s0
-sra s4 t3 t1
-sltiu a3 s9 1654
-and t1 s3 t0
-mul a6 a6 s0
-andi a0 s3 -558
-remu a2 a1 t0
-sll t4 s3 a1
-mul tp ra s3
-sltu tp s2 ra
-or x0 t6 s11
-mulhsu a1 s7 s10
-mulhsu a2 x0 t2
-mulhsu s10 a4 a1
-srli gp t1 26
-lui t1 477878
-sub s4 s3 s9
-lui a3 108686
-xori s3 a3 661
-and ra s4 a3
-and tp s8 a1
-slt t1 t1 s1
-xor t3 s11 t0
-sra a2 s0 t2
-sub gp a6 s3
-div t0 s7 s1
-mulhsu t3 x0 s11
-srl s0 t0 s1
-ori s7 s3 -418
-slt s4 t5 s7
-mul a2 a2 a5
-or a4 tp t5
-mul s9 ra t0
-sltiu s2 a4 -1917
-add s6 s8 a0
-div s10 t4 ra
-slt s7 a0 t3
-ori s11 a3 987
-add a7 s9 t6
-sra a4 a0 a7
-remu x0 s3 t0
-srai s9 s5 21
-sltiu a0 a5 -685
-sltu s7 a5 s1
-sltu ra s5 x0
-sra a7 a0 t6
-andi t1 s5 -722
-slti a2 s2 51
-sll a1 s6 a7
-slli s3 t5 12
-andi s6 a6 778
-sltu s7 s10 s1
-addi a6 a4 -1047
-srli s10 s11 1
-mulhu a2 s8 ra
-mulhsu a5 s9 s11
-rem t5 a2 a3
-srli tp s6 15
-rem s3 x0 a1
-srli x0 s7 14
-lui a0 725936
-slti x0 ra -1792
-slti tp s0 -1733
-sra s3 a1 x0
-or s8 t1 s11
-srl a4 t2 tp
-remu a4 a7 x0
-srai s2 tp 5
-add a5 a6 s11
-xor s1 ra x0
-ori t2 a3 -1746
-rem s7 tp t1
-mul a7 gp x0
-mulhsu s3 a4 tp
-sra gp s3 tp
-lui t5 938883
-slt t5 gp a7
-and a3 s4 a1
-and s7 a0 a6
-remu s8 a6 s5
-and s4 t5 s6
-sll a5 a6 s2
-add x0 x0 a2
-xori a6 t6 938
-auipc s0 723669
-srli t2 s9 14
-slt x0 t6 t2
-slti s5 s9 588
-mulhu s0 s8 a4
-srai s5 s10 26
-sll a2 t0 t2
-mul s5 a6 s9
-slti a4 s2 -1715
-sltiu s7 x0 1450
-rem t6 a7 t6
-sll t0 s3 s1
-ori a1 s8 -758
-sltu a4 t5 tp
-add a4 s0 s0
-xor s10 a5 s9
-sra t3 x0 t1
-addi t0 a2 -1874
-sltu gp a0 s3
-andi s2 a7 -1168
-div t5 t6 ra
-xori t0 a7 1085
-auipc t5 957803
-sltu t4 s5 a1
-slt s1 s2 s11
-xor s8 a6 a6
-ori x0 t6 1206
-slti t3 a2 -616
-divu a4 s0 t3
-ori s7 a0 -1806
-lui tp 292930
-mulh a4 s11 t2
-andi a0 s0 -254
-addi tp s10 -317
-sub s3 s8 s5
-mulh s7 s8 gp
-srl a1 a0 s9
-srai s5 tp 3
-sra a6 s4 t5
-lui a2 650876
-sll s4 t4 s10
-lui a4 986438
-mulhsu s8 s8 a1
-mulhsu a6 a2 s2
-srl t5 s6 s1
-add t4 a1 a2
-slt a5 s4 a3
-addi s3 t2 1980
-sra s8 ra a3
-mulhsu a6 a4 t3
-div t2 s5 a0
-sll gp s4 s2
-slt gp ra gp
-srai t4 s1 20
-or s8 s10 t4
-sub ra t6 t1
-add t1 s6 s7
-remu tp a6 gp
-auipc a7 501820
-sub s8 a5 s8
-sltiu x0 s1 -1669
-mulhu a6 s9 tp
-slt s1 s4 s2
-div a2 a6 s11
-divu s7 s0 s4
-addi t2 s2 -1548
-remu s11 tp t1
-ori tp s2 -387
-mul t3 t5 s3
-slli t1 s0 16
-srai s6 t1 12
-andi gp t5 -85
-div t3 s0 s8
-xor t3 s2 s9
-remu s7 t0 gp
-sub s5 s4 x0
-sltiu s7 a1 -1626
-sll s8 a5 s9
-divu a7 t2 s10
-lui a0 750092
-xor ra a3 tp
-sltu s10 s11 s6
-divu a6 t4 t5
-divu s0 a3 s2
-add a3 x0 a2
-mulhu s10 t0 a4
-xori s7 s11 -696
-mul a7 t0 a2
-xor t5 s8 t4
-srli a5 s3 26
-add t1 a5 s0
-sra tp s3 t2
-sub a6 t1 s7
-mulhu s2 s10 s6
-andi s9 s0 682
-auipc t4 323431
-and t6 s11 t6
-xori s9 a0 -2039
-sltu s5 t1 tp
-andi t6 x0 1236
-sra s11 a1 s5
-add tp s9 s6
-sub t3 a6 t5
-mulhu a5 s5 a0
-mulhu s2 s4 t0
-sltiu x0 tp -383
-slt gp a4 s7
-sltu s1 s8 s6
-add ra t2 a4
-divu s9 s0 t5
-remu a0 t6 a5
-rem a3 s8 a4
-mulhsu tp t6 s3
-xor s11 s8 s2
-xori t6 gp 153
-mul s3 t4 a3
-slt a4 s5 s11
-addi tp t2 -49
-rem t2 a7 a0
-srli x0 s1 19
-slli t6 s7 28
-mul a1 t2 a3
-lui s9 891833
-div t2 s10 s8
-div a1 t1 a1
-sltiu a6 s1 -1345
-add ra t4 x0
-sra s7 s2 s11
-mulhu t6 a5 s2
-slt a7 s2 a5
-lui s5 786473
-mulhu t6 a6 t1
-and ra t6 s11
-slti s4 a1 1819
-slti a2 s10 -1451
-add a4 t5 s10
-srai t5 s11 1
-srl s6 t3 t1
-mulhu t2 x0 s0
-and t2 a1 s3
-xori gp s9 -1998
-slti gp a3 1827
-sltu t6 s11 a0
-sltu t3 a3 s7
-mulh s5 t0 a7
-or s0 t4 a7
-mulh s11 s0 a1
-srai s3 a2 4
-ori s7 s10 -1549
-sltiu s2 t6 -316
-slt s7 a2 t2
-mulh a5 a2 a1
-sra a0 s8 t1
-sub a2 s5 s11
-slli t6 t5 15
-srli s1 t1 22
-addi t4 s0 -66
-mulh a6 t0 s2
-sltu s9 t6 x0
-slli t6 x0 16
-slt a4 a1 s0
-mulhsu a1 gp tp
-slli s3 s2 16
-sra t5 ra a6
-rem s0 s6 s11
-sra a1 a1 s5
-sltiu a3 s3 -1361
-auipc ra 640679
-mul s7 s11 s8
-mulhu t1 t2 gp
-div s4 t3 s9
-srai x0 gp 29
-srai tp a1 26
-sltiu s2 s0 1329
-rem t2 t2 a1
-mul t3 a4 a2
-srai a0 a4 0
-ori s7 s8 -250
-or a3 s6 a5
-xor ra ra ra
-srli t0 s8 30
-divu t4 t6 a5
-sra a4 a5 s10
-remu s5 s9 t1
-sub t3 a7 a2
-srli a3 s5 22
-lui t2 924404
-srai a7 s9 17
-sub s4 x0 s8
-mul a3 x0 tp
-and t6 a6 t4
-mulh gp s5 s11
-auipc s7 253183
-srli ra s5 12
-mulhu s2 s7 t5
-divu t2 t6 t5
-or s0 a3 a2
-sltiu s3 s11 -463
-andi s5 a6 -602
-slt t3 s6 gp
-xori t1 a1 -1115
-srai x0 s7 16
-ori tp tp -1406
-ori x0 s0 -1002
-mulh t2 s1 ra
-rem t6 s6 t5
-srli s7 a3 8
-div s1 t6 a3
-ori a1 s2 -1834
-lui s4 409712
-rem t1 gp ra
-and s2 s4 s11
-sra a3 a4 a4
-srai s1 s10 18
-sltiu t6 s5 -893
-andi t4 s10 -1423
-divu s3 t4 t3
-mulh a6 a2 a4
-add s2 x0 x0
-divu a2 t4 a5
-ori s2 gp 1616
-and a0 t3 a6
-sra s3 x0 t3
-srli t4 s1 27
-auipc s11 850870
-slti x0 s9 -1522
-srli a6 s6 24
-rem a3 t6 a7
-srl t0 s6 a6
-add a7 a6 s3
-sltu a7 t4 a2
-srl t0 a1 a6
-auipc s5 184458
-divu t2 t0 s5
-rem t3 t3 a3
-and a1 a6 s10
-add s3 gp s6
-mulhu a6 a5 a3
-andi a0 a1 -203
-mulhu s9 a3 s9
-divu a3 gp a7
-srl s2 a7 x0
-divu tp a3 tp
-slli a0 ra 27
-lui tp 624071
-and s6 ra t3
-sltu t1 s7 a7
-remu t3 t4 tp
-rem ra s10 a4
-mul s8 s7 s5
-sltu s4 s3 t5
-mulhsu t4 t6 a5
-sra s4 a6 tp
-xor gp s7 a6
-mulhu t4 a4 s3
-and t2 s0 s11
-div a2 tp x0
-mulh gp s5 s4
-lui a3 1016861
-sltiu s11 a6 -702
-srai t1 s9 31
-or t3 a1 t5
-slti s3 a0 1074
-srai a6 t4 3
-auipc t6 412622
-sra s7 a2 s9
-and t1 a7 s8
-sra a1 t1 a7
-ori t0 s6 -1878
-mulhsu s8 tp s2
-addi tp s1 -659
-srl a1 a7 s6
-slti s2 t4 -1481
-srl s6 gp tp
-or s2 a6 s6
-sltu t0 gp t1
-lui t4 461029
-sra s0 a7 t5
-remu s7 s10 s3
-add s3 a7 ra
-srli s2 t4 23
-rem t0 gp t3
-mul tp a5 s3
-mulhu a4 t0 a1
-sll s5 s11 s10
-mul x0 t5 gp
-mulh a1 s11 gp
-sltiu s10 x0 -245
-add t6 a0 t0
-mulh t5 a0 a3
-or s9 s7 a3
-div t1 s2 a3
-ori s9 a5 -1546
-add a6 x0 a1
-auipc t6 352019
-ori t1 t5 876
-sub t1 a2 t6
-divu x0 a5 t1
-sra a5 a6 s11
-ori ra t3 204
-sub s8 s8 s3
-sra t6 s4 a3
-slti t6 a7 578
-add a7 a4 s10
-sll t1 a4 t0
-add a1 s11 s10
-sra a6 t0 s8
-sll a7 s11 t3
-mulh a0 s5 a2
-mulhu x0 s5 t4
-mul s3 ra ra
-slli t4 t6 29
-sltiu s1 s1 -322
-div s6 gp s0
-lui a6 620530
-div a6 x0 x0
-remu s8 s5 t1
-sub t3 t4 t5
-slt t1 gp tp
-sra s3 a1 t4
-addi tp a3 -1604
-auipc a5 673961
-slti gp s6 -123
-mulhu s11 a1 s6
-slt s0 tp t0
-andi ra t3 -1551
-divu s11 a6 s0
-slli s3 x0 2
-sra t4 s10 s3
-srl s9 s6 a4
-rem a7 s8 x0
-mul gp gp t5
-andi s11 a4 -701
-andi gp s0 6
-ori s1 s7 58
-sltiu x0 tp -1792
-or tp t3 t1
-srli s2 t6 11
-sub a5 a1 a2
-xor a2 a5 ra
-slt a2 s2 gp
-addi tp s6 -1732
-sub a0 s2 t5
-addi s1 gp -1500
-mulh t4 s10 a1
-mulhu a7 s9 t1
-slli s5 t5 25
-mulhu s1 s6 ra
-or a3 a7 s5
-srl a6 t0 t0
-lui a7 471402
-xori tp gp -1875
-or a1 s11 t6
-sltu a5 s5 a6
-xor a0 x0 t1
-slt a5 t1 t4
-slti s4 s2 841
-addi s5 a0 -1105
-srli t1 s2 1
-mul t5 s4 s1
-xori t1 s0 1512
-and s0 s10 s11
-div tp s4 x0
-and x0 ra s2
-divu s4 t0 a6
-sltu s6 t6 t5
-divu s11 s9 a0
-remu t3 s7 t4
-andi tp s6 -1702
-or ra t3 s6
-sltiu a2 a5 -995
-srai ra ra 21
-lui t3 949165
-srli a1 a0 31
-xor s3 t0 t5
-lui s4 184200
-div s4 s6 a0
-rem s8 t4 s4
-xor s1 t2 a4
-slli s0 s6 17
-mulhsu a1 t4 x0
-mulhu s5 ra s7
-slt s0 a6 tp
-sub t0 a1 t0
-divu x0 s6 t2
-remu a7 t3 tp
-lui s6 294957
-mulhsu s5 s6 s4
-sub a7 t3 t5
-div tp t1 t2
-sltu s9 s6 s5
-slti a2 a0 1623
-and ra t2 s9
-xori s9 t6 -1293
-mul t0 a6 s0
-rem ra t3 s8
-lui s2 549434
-srl t1 s8 a0
-xor tp s10 s8
-auipc t1 131928
-sll s11 s5 s8
-lui t4 573856
-sra a1 t2 s6
-addi x0 s7 -1264
-sra t1 s11 a2
-mulh s9 s6 t6
-mul tp a6 s1
-sltu s10 a1 s9
-mul a5 t1 t1
-lui t1 954325
-remu t0 s7 s6
-or a4 s5 s9
-sll s9 a7 s1
-mulh s1 a4 t2
-ori t3 s6 1787
-mul s3 a2 s5
-mul s1 t2 s11
-sltu t1 s7 t4
-mul t2 t6 s7
-slti a1 t5 2014
-srli a2 t5 18
-add gp t6 a4
-andi a4 a4 1375
-divu t2 a3 s6
-divu a3 x0 s4
-addi tp s6 707
-sub x0 t2 x0
-srai t2 s3 14
-sub t4 t6 t1
-srl a1 a1 ra
-rem s10 tp t2
-mulhsu t4 s7 s5
-mulhu t6 s10 t3
-auipc a2 683210
-srai a1 s9 27
-mul s10 t0 t6
-slt t0 a7 x0
-sra t1 a0 s3
-div t0 a6 s11
-ori t1 s4 -1953
-addi t1 s11 -1605
-sll a6 a4 gp
-sra a1 a0 t5
-xor a3 s1 t2
-addi s10 a1 -918
-lui gp 101418
-mulhsu s5 t6 a7
-srai a4 s2 20
-srli s10 ra 13
-remu a7 s2 t5
-sll a7 t1 s6
-divu gp a3 t2
-sltiu gp a7 -903
-remu s10 s11 gp
-mul a4 s10 a4
-and t4 s9 a6
-lui a7 730127
-remu a5 a6 tp
-sltiu t6 s8 -1789
-and s7 s6 a7
-sltiu x0 a0 1499
-slt t2 gp t3
-xori a3 t0 -1122
-sra a3 a6 s7
-srai a2 a7 30
-sll t6 s0 t5
-and s11 t3 t1
-divu x0 s3 s9
-and a5 s10 gp
-srl t5 s8 gp
-remu s1 s0 t5
-ori s4 tp -1619
-add a5 s8 a7
-sll t5 s5 s6
-mulhsu t0 s9 ra
-sltiu t3 s2 -705
-sll ra s5 s3
-slt s1 t1 x0
-sll gp a0 s10
-auipc a2 425105
-addi s11 t1 -303
-div t4 a4 s4
-mulhu s4 t2 a3
-div t6 s10 a5
-sra tp s3 a7
-or a4 s3 a2
-remu t3 a5 a7
-divu a5 t3 a7
-mulh t3 s11 t4
-rem a3 s0 a0
-auipc s8 474307
-slti s8 a6 -1611
-auipc t5 133999
-add tp a6 t5
-mulh t6 s3 s3
-lui t3 567216
-ori s8 t1 517
-slti s4 t5 -1289
-sub t3 x0 t0
-remu ra s10 s3
-divu a4 a1 ra
-srli t2 a5 9
-or ra t5 s7
-srai tp t6 10
-mul s2 s2 ra
-slli s2 s8 2
-div s9 a0 s9
-slli s4 s1 9
-remu s6 tp t5
-slt a4 a5 a0
-or s8 t1 a6
-sltu t0 t0 s10
-mulhsu a3 t6 a1
-mulhu s4 s3 a1
-lui s0 11904
-xor t4 s3 a1
-div a4 s10 s8
-divu a0 s7 a0
-sltiu s3 ra 538
-lui t3 996826
-sub a6 t2 t6
-mulhu x0 t5 a4
-and s2 s7 t5
-xori a2 a0 -1277
-sub s3 s6 s7
-sltu x0 gp x0
-andi t2 a7 -207
-sll s6 t3 s3
-sltiu gp s4 -605
-mulhu a4 gp a3
-xor gp a4 s4
-andi s2 s2 311
-srl x0 x0 t4
-slli gp t2 17
-xori t3 s3 -822
-slt s8 a7 a3
-divu s5 t6 x0
-mulhsu s7 t6 t3
-sltu t1 t6 a2
-div x0 t4 s2
-remu s1 s7 a4
-div a5 t5 a7
-remu a2 t1 s10
-rem a4 s11 gp
-mulhu a6 s10 a5
-mulhu t2 tp s9
-ori s7 s0 -200
-xor a0 a5 a6
-ori s4 t2 -1534
-lui a5 512798
-mulhu t5 t3 s6
-div s5 s2 a3
-slti a7 t2 312
-xor a2 a1 s1
-mulhsu t6 t2 gp
-mul t4 a5 s10
-slli t3 s4 1
-add t4 t4 a4
-remu t2 a6 x0
-slli t5 a2 4
-slli a3 t0 4
-srai x0 s7 6
-lui a1 645109
-mulhu s9 t1 gp
-divu s9 a7 gp
-addi x0 a3 1792
-sub t6 a5 a0
-sll tp s5 a3
-addi a2 x0 1334
-rem t1 t5 s3
-mulh gp s6 s3
-srai s5 tp 26
-xori s9 a4 -67
-sltu a5 s11 a2
-mulhsu t6 t1 a4
-rem x0 s6 t2
-xor x0 a3 t3
-remu t1 a3 s4
-xori gp s2 1945
-slti a6 s5 -1757
-add x0 s2 t2
-sra s1 t1 t0
-mulh x0 x0 t2
-mulh s1 s8 t1
-mul s10 t4 gp
-mulhsu s7 a2 s11
-andi a5 s0 -1128
-auipc s3 649853
-sra x0 s2 t2
-div s1 s7 t3
-add t1 tp s5
-rem s8 a1 s9
-sra t5 s3 tp
-divu ra a3 gp
-remu t5 t2 tp
-ori gp t6 -1033
-remu s3 x0 s2
-sub a6 s8 t1
-andi s8 t2 -984
-lui tp 463244
-sltiu a4 s6 -1780
-mul tp a0 s3
-sltiu gp s8 -914
-sltu a3 a1 a7
-mul t2 x0 a6
-remu a0 a4 ra
-add a4 s0 s3
-and ra t6 tp
-mulh a0 s7 a0
-ori s9 s11 1279
-slt s11 s2 s11
-sltiu tp s2 -981
-lui s7 743661
-sub s5 s9 s4
-xori ra a6 -265
-sltu a7 t1 a5
-srl s8 s5 s6
-rem t6 a4 s11
-sltu s7 a1 s0
-xor s7 t0 t2
-sll s7 tp a2
-sra t0 s8 s11
-sltu t1 t1 t0
-sltiu s0 t4 468
-slt s10 s0 t3
-mulhsu t2 s1 a6
-srli a4 a5 4
-auipc s2 119119
-or s11 s3 t2
-sltu s5 s9 x0
-srli t0 a0 9
-mulh gp s7 a5
-srli s5 s1 7
-sltiu s4 x0 690
-lui t6 200860
-rem s10 x0 s1
-sub a3 s3 s10
-sll s2 t3 t3
-rem s1 s8 x0
-and s5 t0 t1
-div t5 s8 t2
-and s6 s5 x0
-xori a2 s9 -1255
-div tp s1 s1
-remu gp ra a1
-xori x0 s3 1667
-andi s3 s7 -1046
-mulh x0 a6 s5
-or a4 a7 a5
-srai t1 t5 14
-sub t6 t0 a6
-lui x0 401483
-rem s5 t0 a3
-mulh s3 a0 s3
-sub s10 a5 s10
-addi a3 t1 -1246
-ori t4 t3 1133
-sub s2 t2 s1
-slti a5 s2 -302
-add x0 t5 t0
-sltiu s2 t3 168
-srli a6 s8 7
-and t5 t0 tp
-mulh t0 s2 t6
-slti a4 t4 104
-div s4 t5 s2
-mul a7 a1 a2
-add a7 s8 t3
-lui s10 19409
-srli t3 t6 27
-mulh s0 s4 s0
-ori s9 a5 -1362
-sra a1 t4 s1
-and x0 gp s6
-sll s3 s10 t2
-xori ra ra 1119
-or x0 gp t6
-mulhsu a1 a7 tp
-and tp t4 t4
-mulhu s1 s3 s7
-rem s0 t0 a7
-xori s1 t1 -917
-sra s9 t2 s7
-srai s11 a5 23
-sll s2 s7 a6
-sub a5 a7 t3
-sltiu a7 a6 -1978
-div s6 t3 a0
-xor a6 gp s2
-div a3 s0 s8
-addi s0 ra -1791
-lui s10 129052
-sltu s2 ra t6
-srai ra a1 13
-srli s5 a2 19
-mulhu x0 s5 a2
-ori a5 a3 -1399
-ori x0 a7 -1453
-addi s2 ra -80
-rem s2 t3 t5
-ori s5 a2 -1278
-srai t2 a5 5
-divu t5 a2 t5
-slt a0 a6 s6
-remu s9 t0 s4
-lui s11 665312
-lui a1 589584
-mulh s5 a1 s4
-sra a5 a7 x0
-addi t6 s11 -1652
-slli gp t5 29
-srli s8 s1 22
-sra s6 a4 s9
-srai s11 x0 28
-mulhsu s2 a3 t5
-div s8 s11 t1
-divu a4 t0 t4
-div ra s4 s8
-remu a1 s2 s1
-sll s8 t3 t5
-remu gp a6 s8
-sra ra t2 t1
-andi ra a5 -503
-mulh s10 gp s3
-mulh tp x0 gp
-remu gp s6 s11
-ori s6 s11 -900
-srai s8 s5 5
-lui s4 286263
-divu ra a2 t6
-or a2 x0 a2
-srli s11 gp 12
-srli a1 t3 28
-ori t2 tp 958
-rem s8 s9 t3
-add s11 x0 s11
-xori a4 ra 426
-xori x0 tp -1992
-andi s11 x0 -839
-auipc a6 747824
-remu s3 s8 x0
-srl a5 s11 t5
-mulh s5 tp t2
-lui a7 891620
-slt t2 x0 tp
-srl t1 s3 ra
-sub t4 t4 a2
-sltiu t3 a3 -32
-mul x0 a2 tp
-slli a3 t2 12
-srai t5 t1 20
-srl a3 s10 s6
-slti a1 a4 312
-sll t4 x0 s11
-sltu t6 a7 t0
-sra s10 t6 s7
-srai a1 s4 14
-sltu s2 t4 a3
-divu ra ra x0
-slli a5 t3 20
-sll s4 t0 s8
-xori t0 s4 151
-slli a2 a1 29
-andi tp t4 2045
-sub a3 a2 t3
-or t3 s2 s10
-andi s10 s6 1957
-divu x0 s9 tp
-mulhu a2 t5 a7
-or a4 a0 ra
-mul x0 x0 a4
-slli t3 t4 4
-sltiu t0 x0 820
-rem tp t4 a0
-mul s4 s4 t1
-srl a1 s5 s5
-or a3 x0 t1
-srl t1 x0 t1
-srai a3 a2 18
-addi t5 a2 -953
-ori t4 t2 -1247
-sub x0 t1 s1
-mulh s5 s7 t5
-div s3 a6 s6
-sub tp x0 s11
-sltiu s6 x0 -1283
-ori a0 ra -1431
-sll x0 s9 a0
-srai a6 a1 21
-ori s0 s10 -397
-lui a2 667480
-xor s1 s10 s1
-mulhsu tp t2 x0
-mulh t2 a3 a7
-sub a3 t0 s0
-addi t6 a0 -1713
-xori t1 x0 1172
-div a3 ra t5
-ori x0 ra 1367
-sll a1 a5 s0
-srli s10 s5 23
-sltiu s3 s6 -1558
-rem a1 s3 a4
-auipc a6 1163
-mulhu s1 t5 t3
-mulhsu t1 tp s7
-sltu t5 s9 a4
-add s5 s11 gp
-mulhsu t4 t2 t3
-divu s6 s6 s5
-xor s11 t1 a3
-add t2 x0 t2
-srai a1 s5 8
-sltiu s1 s2 -1499
-rem s8 s3 t1
-xor s5 s3 s3
-mulh t5 s0 s8
-slli ra s4 10
-mulhsu tp s10 s0
-rem s9 s8 s0
-andi tp s3 -877
-mulhu x0 t3 a7
-sltiu s10 t0 -2
-mulhsu a5 ra s10
-lui t3 535263
-sra a4 gp s7
-divu s3 s11 t0
-mulhu s7 a7 x0
-divu t5 s8 a7
-sub s8 s2 s1
-xori t2 s11 -890
-rem s0 s11 ra
-ori a7 s9 -946
-xor ra ra t2
-xor s9 s6 a2
-and tp s10 x0
-addi t0 s0 -1890
-rem a0 t3 s3
-andi a6 s10 1010
-ori x0 s7 -950
-lui tp 922005
-slti s5 t6 -929
-and s2 s3 t3
-sub t3 s0 s1
-remu s0 a0 s6
-div a5 a1 a0
-srai a4 s9 23
-srl s7 t4 gp
-sltu s5 t0 s7
-xori t5 s11 -1035
-slli s4 x0 30
-andi a1 s5 -31
-mulhu s6 t2 a5
-sub a0 s8 a5
-add a6 t1 ra
-add t1 s6 s7
-mulh a7 a6 gp
-divu s6 a5 a6
-divu s9 a7 x0
-slti ra tp -621
-mulh x0 s0 t3
-sll s11 t1 a3
-divu s3 tp a0
-slli s4 s4 27
-sltiu a2 s7 -1177
-slti a7 t5 -126
-auipc ra 861707
-lui s1 351174
-xor s8 s3 s11
-addi s0 s10 -219
-div s9 a4 s4
-srli a7 gp 31
-xori s3 s5 -1443
-sltiu s11 a6 739
-or x0 t1 a0
-lui s6 210411
-srai s8 s1 8
-addi s11 tp -1782
-slt s3 a2 t4
-srli s4 s5 16
-sltiu t0 s9 -1817
-slt s11 a7 ra
-mulhsu t5 ra t4
-ori s11 s8 -234
-andi a0 tp 1146
-and t0 gp t4
-andi t6 gp -450
-sra a0 s1 s11
-rem t2 s9 x0
-slti a0 t1 -203
-srai a4 s4 2
-auipc ra 740934
-srai s9 s3 16
-mulh x0 s6 a7
-andi s2 a2 -1223
-sll a6 s9 s10
-mulhu t6 t4 s3
-div a7 x0 s10
-lui a7 534551
-auipc t3 414050
-mulh t1 a1 t4
-addi t5 t5 -464
-srl s3 t2 s11
-slli ra t0 9
-srl a4 a3 a0
-add a2 s8 s3
-sll s0 ra t2
-slt t2 a4 s2
-sra a0 t1 s9
-sra t1 t1 gp
-or s1 s9 t6
-slt x0 s5 s0
-srl s11 tp t2
-slt s1 t1 a5
-mul s1 s7 s6
-mulhu t4 a4 t3
-xori a1 gp 1150
-xori s0 s1 -1348
-mulhu s3 t6 a0
-slti s2 tp -1325
-xori ra a3 -1348
-remu s9 t5 a2
-mulh s5 s10 t6
-srl s2 t3 s1
-mulh t4 t4 a2
-sll s10 x0 x0
-xori t0 s3 -1151
-mulhsu s8 a2 a0
-auipc a7 861233
-and x0 t0 t5
-rem a0 s0 s8
-add t1 s5 tp
-mul a4 s2 a1
-mulhu s6 x0 a3
-rem s2 t1 s8
-div a7 a6 a2
-mulh a0 t0 t6
-add ra a2 t6
-slt s4 a3 a1
-srl s0 s5 s6
-and a0 s5 s7
-rem s11 ra t4
-srli s7 s9 17
-remu x0 s9 t5
-div s11 s7 t4
-divu s4 a3 s6
-sltu x0 s1 s9
-andi gp s10 864
-remu t6 tp a4
-xor s6 ra x0
-xor t5 s6 tp
-mulhu t4 a2 t2
-auipc a2 837279
-div t5 t2 t1
-ori s6 t2 -570
-slli s4 s5 7
-auipc a4 732261
-xor t6 s0 s5
-sltu a2 a0 a5
-srai a4 a6 29
-mulh a4 s1 t2
-mulhu s4 tp gp
-sub s4 a3 s8
-sll a7 s4 a7
-sll t4 a6 t4
-sltiu a1 a6 1516
-sra s8 a6 s9
-slli t5 x0 25
-and t3 s10 a5
-xori t6 s1 -1904
-add s2 gp gp
-mulh t0 s3 s2
-slti a3 t0 133
-sltu s10 s4 t3
-sub s7 a5 a1
-add a4 a2 t0
-sra s9 x0 x0
-add t2 s7 tp
-div a6 t6 x0
-or a7 s6 gp
-mulhsu s9 t4 a5
-add s1 s0 s6
-or s0 t6 s3
-andi s0 x0 335
-srl s9 t1 a0
-slti s0 tp 495
-slt s9 s3 a3
-sub s7 t3 s1
-mulhu t5 t2 a7
-srl s8 s10 t0
-xori t4 s8 -68
-xor a7 s9 t1
-slti s9 s4 575
-srai t0 t4 0
-ori s10 s4 -1855
-sub s6 a3 s10
-ori s11 t6 -300
-or a5 s10 a7
-auipc a3 354849
-xori s4 s10 -311
-sltiu a5 a3 -1559
-sll t5 s8 s8
-slli t1 s8 9
-mulhsu a5 a0 t6
-andi t4 s1 1627
-andi s11 a4 -1768
-xori s10 x0 -1044
-sltu t2 s1 a6
-andi a2 x0 153
-ori s10 s9 908
-rem gp s7 a4
-auipc s8 47660
-sll a2 t5 t0
-add a4 t1 x0
-addi t2 s4 -469
-sltu x0 t6 x0
-or t0 t3 t0
-rem t6 a1 a0
-mulh t4 s4 s8
-mulhsu a5 s7 a5
-slli a2 a1 12
-or a4 t3 s6
-sltu a0 gp t3
-sra s1 a2 x0
-and s7 a7 s7
-sll s7 s4 t3
-rem t2 tp t0
-sltu s6 a0 a6
-sub s2 t4 t6
-srli t0 t0 13
-sll t5 s11 a3
-sltiu t4 a3 1010
-sltu ra s10 a6
-rem a4 s8 s6
-slt a4 t6 a7
-andi a6 a7 -1049
-srli s7 t4 2
-slli ra a2 26
-div s5 s2 s2
-add t3 s10 a5
-mul a2 a0 t6
-add s1 t3 tp
-sll a1 x0 t3
-sll s3 s5 s2
-add s8 a3 gp
-srai s0 s1 14
-mul a4 t4 gp
-addi x0 t6 -1796
-slli s10 ra 24
-sub t6 a6 tp
-sra s11 a3 a6
-mulh a6 x0 s1
-ori x0 a6 820
-sub x0 a6 s9
-mulh t1 s3 s10
-rem s4 t3 ra
-and a3 s7 t1
-sub t0 a3 s4
-auipc t0 242038
-div s10 a7 s10
-divu s2 s11 t4
-addi a3 s1 -199
-slti x0 t6 1745
-srai s6 s1 29
-rem s2 ra s3
-mulhu a3 x0 gp
-mulhu s2 s3 t4
-lui x0 358943
-divu tp x0 t1
-and a6 tp s4
-xori t0 s10 -1510
-lui s11 1022232
-lui t1 937249
-mulhsu s9 a1 a4
-slti t4 s3 -74
-srai s5 ra 22
-mulh a4 s2 a2
-sub gp t3 t0
-sra s7 a4 t4
-mulh s8 x0 s10
-mulh t5 t3 s8
-remu a0 s9 t1
-slti s11 gp -1830
-lui ra 351853
-mulhsu a1 a2 gp
-slt a0 s9 s3
-sra t1 t5 a4
-srai s11 s0 3
-add s7 a5 x0
-and t4 a5 s3
-div x0 a1 s10
-sltiu ra a2 -1647
-mulh s5 a1 a6
-auipc t3 827830
-sll s0 a0 a4
-mul s9 s1 x0
-lui s5 876039
-srai t0 t6 4
-srl t1 a1 s8
-mulh gp tp s3
-sltu a2 a5 s6
-slti x0 x0 -905
-srl t4 s2 a2
-sub t5 gp s1
-mul s6 s11 s7
-add gp a4 tp
-ori s7 a4 -110
-sltu tp t3 a7
-and t4 t3 x0
-or x0 t1 a5
-lui t1 651515
-sll a3 t6 tp
-auipc a6 385863
-mulhu t3 t3 s7
-mulhu a7 a0 s3
-lui s1 958495
-mulh a0 s2 s9
-mulhsu t1 a2 s2
-mulhsu t4 tp s4
-slt s5 t1 a1
-div s1 a2 s6
-lui gp 253779
-slti a5 t2 214
-xor t3 a6 t4
-mulh s6 s11 a6
-remu s3 a2 s3
-lui s9 185983
-add s4 s5 s4
-addi t3 x0 950
-addi s0 s6 -589
-div s0 t1 t1
-sll a0 t0 t2
-srl a0 s6 s2
-slti s6 a3 -1311
-srl s0 a5 a1
-and gp s2 t6
-sltiu ra t3 -289
-or s7 a5 t4
-or s8 a6 s4
-ori a3 t5 1048
-rem s2 t1 t6
-div a7 a3 t4
-mulhsu x0 a2 a4
-slti a2 a4 -1999
-xor a3 s10 a1
-add s1 a6 a6
-or x0 s0 t0
-divu s2 a0 s7
-ori s4 a7 -8
-add s5 s5 gp
-rem s0 t6 ra
-mulhu s9 a4 s9
-divu a2 x0 s1
-add s3 a3 a4
-srli s11 a3 10
-sltu gp s6 s11
-xor s2 s5 x0
-mulh s7 s8 s9
-addi t0 a6 976
-mul s5 a6 s7
-sll t1 s3 a7
-or s4 gp s4
-sltu s3 s1 a4
-xori a5 x0 320
-sra s1 a2 s7
-divu s4 t2 tp
-slti a5 s1 -1175
-srli a5 s1 6
-sll t4 t1 a3
-slli s2 x0 31
-srl a0 t1 a2
-sub x0 s9 a4
-srai s5 s2 2
-xori s4 t3 -1060
-srai s11 t4 18
-xori t0 a5 -1380
-srli a7 t1 18
-mul t6 t5 t3
-slti a7 tp 90
-add t0 s10 x0
-andi s1 a0 -266
-add s9 t0 t0
-or gp s4 t5
-sltu s8 a4 t2
-rem a7 x0 t1
-add x0 x0 s9
-srl s10 a2 s8
-div s7 a3 s0
-srl s9 a1 ra
-slt t6 s2 a1
-sll a6 a5 t0
-remu s8 s8 t3
-and a7 s1 t2
-mulh t6 t2 a1
-slt s11 s1 a6
-xori a4 x0 -1728
-ori gp x0 243
-or s0 s11 a1
-ori t1 t6 -1613
-ori s2 s4 -946
-ori a2 x0 -976
-sub t0 s10 s1
-sltiu a3 t1 494
-mulhsu s5 s9 a6
-rem a2 gp t2
-or a6 a3 t4
-slli s2 x0 12
-div tp s11 t2
-sltiu t5 t4 -727
-ori s1 s5 -1258
-and ra a2 t4
-sra s4 s9 a6
-sltu a7 a0 s2
-add s2 s8 s4
-divu t1 t6 a3
-sll a3 t2 t1
-mul t4 a2 a6
-srai a7 a5 7
-mul t4 a5 t2
-andi s4 s0 1614
-ori a2 s2 -1254
-sra a5 ra s2
-xori x0 t2 -127
-ori t4 s4 -105
-srli a3 t0 29
-slt s7 s2 a1
-sra a3 s5 a2
-srli a3 t3 6
-lui t0 858452
-slti tp a2 -1002
-div tp t0 s7
-or t6 s1 s1
-rem a7 t4 s4
-xori a4 s5 -1698
-auipc s10 995269
-xori a4 s7 -1078
-sll x0 tp x0
-andi a7 t0 2044
-slti a0 s4 1954
-andi s4 a3 227
-slt s5 a3 tp
-slti s8 t1 -1731
-divu a4 t5 t0
-srl a1 a1 t1
-rem t1 s10 a5
-xori a5 t0 -1269
-mulhu a6 a7 x0
-srl t4 s8 a6
-sll t6 s6 t5
-mulh t3 s8 s5
-xor gp a5 a7
-xor s7 s10 t4
-xori x0 s9 73
-and t3 t0 t3
-sub a4 s4 s2
-add s5 t1 t5
-srl a3 t1 s3
-ori s9 a0 -23
-auipc t6 1012184
-sltu s6 s3 s2
-div t2 t4 s5
-srl s4 s8 t0
-sub t3 t5 t4
-sub x0 s1 a3
-sltiu s7 s1 -909
-remu a0 s11 s2
-and x0 s10 t6
-srl a7 t2 s3
-rem s9 s0 a3
-auipc s9 878013
-xor t6 s2 s10
-sltu s10 a0 s3
-sub t2 a0 t6
-add s7 tp a6
-mulhsu a5 t2 s7
-rem s9 gp a7
-mul a5 s11 a6
-andi s1 x0 907
-slti s6 t2 -1783
-mulhsu s0 s1 s6
-addi t5 s11 -543
-add a4 t2 a2
-remu a4 s8 t2
-sub s9 tp a5
-slt s4 s10 s8
-slli t0 s6 18
-rem a4 t1 a4
-sltiu s7 t6 -322
-slli ra a3 15
-lui s4 562279
-mulhsu a4 ra s8
-mulhu a2 s4 s3
-addi t0 t3 -1043
-srai t0 a0 28
-srli a4 t6 28
-slti t2 a5 -1990
-slt a5 tp s4
-sll a2 s3 a5
-mulhu t2 ra a3
-div s11 x0 s7
-srai tp s11 7
-sltiu s8 s2 1371
-slti a6 tp -950
-divu t1 s0 a1
-auipc a4 239135
-auipc a5 9788
-srai a2 a1 12
-auipc s9 540199
-andi s0 tp -395
-div a5 tp s0
-slli s11 a6 23
-remu t2 s7 s3
-or s6 a7 t0
-sltu t2 s9 s9
-slt t1 a3 a2
-sltu s1 a2 s5
-remu s6 t5 a3
-rem a1 s0 a6
+xori s1 gp -577
+srl a5 a2 a4
+divu a5 tp ra
+mulhu a2 s6 gp
+srai s1 s6 2
+srli a1 a4 10
+sltiu s10 a1 -263
+xori a3 t3 -271
+andi s0 t1 1943
+sll s0 tp ra
+mulhsu gp s0 a6
+srl a3 s10 s11
+slti s11 s8 -920
+slli s4 s6 25
+rem a5 a6 t5
+srli s8 s4 12
+rem s11 s6 t5
+divu a6 a6 t3
+sltiu a5 ra 1720
+slli a2 a0 6
+xori x0 t1 414
+add ra s7 a2
+mul a4 t0 t0
+mul a2 s10 t6
+addi s2 s6 -124
+add a6 s8 a3
+srai s5 x0 30
+srli tp s0 19
+add s7 s4 t2
+xori t4 t4 2037
+slli tp a5 0
+xori s5 s9 1247
+mulh tp a4 s9
+or t5 s5 t6
+slli s7 a4 28
+mulhu a6 gp s9
+srai a0 a2 24
+auipc x0 644372
+add s10 t3 s11
+sltu a0 s1 x0
+srl t4 x0 s2
+sra t5 s2 s5
+slli gp s0 27
+lui s2 1042083
+sub a1 t4 t0
+divu t3 tp ra
+andi t3 gp -1720
+mulhsu t2 a7 s4
+sltiu x0 s4 -1205
+mulhsu t5 tp s11
+mulhu t1 a5 tp
+xori a0 a1 1037
+mulhsu t5 s9 a4
+sra t5 gp s6
+or a0 t4 a7
+ori s4 s2 -403
+divu x0 s4 s1
+addi t4 t0 -1405
+add s7 a2 a4
+mulhu a4 a3 a3
+rem ra s8 s7
+xor s0 s6 s9
+or s2 gp t3
+srli a7 s8 8
+mulhsu a7 a7 t0
+slli t6 a1 6
+mulh s0 s7 s8
+sub gp s6 a5
+srli s2 s8 7
+and s9 t2 a2
+auipc s10 721681
+sub a1 a5 t5
+mulh t4 a5 s9
+auipc t2 1024404
+auipc t3 797568
+add s11 s5 s6
+lui s10 559884
+divu s2 tp s4
+sra t2 t3 a1
+addi a5 s4 -1436
+sltiu s9 gp 539
+sll s6 a7 x0
+addi a1 s8 -1700
+ori a0 t1 -1255
+div a5 a6 s11
+mulhsu t5 a1 t5
+mulh a6 t5 t0
+remu a3 ra ra
+mulh a4 a7 gp
+andi tp s4 -1052
+mulhu s2 a7 t6
+addi a5 s3 -1308
+or t0 t1 t5
+srl a4 gp s8
+slti t5 s6 -395
+slti ra t6 -2000
+srl s10 t2 a5
+xor a4 s4 s10
+xor s6 t6 a2
+xor a7 a4 s4
+srli s11 s10 4
+sltiu a6 s2 -1393
+addi s8 a1 -1457
+auipc t2 127387
+rem a3 tp x0
+lui t2 798479
+rem t0 t6 s11
+andi a7 a1 1944
+srai s10 t2 12
+xori a4 x0 -1623
+xor a6 a4 t0
+andi s6 a6 -391
+sub s5 a4 a0
+slti a6 s10 -362
+mulhsu s6 s5 x0
+slt t0 s1 s8
+slt t4 a2 s1
+sltiu t1 s7 1803
+srai s10 s11 14
+slli s2 s9 22
+srai t0 s2 31
+slt t6 s9 t3
+ori ra a5 -1307
+lui a6 381741
+remu a0 s10 s6
 slt s5 a7 s9
-andi t3 t3 -1709
-add a4 ra s4
-remu ra t2 x0
-mulh t4 x0 t5
-and t3 a2 s8
-sub a0 s1 s1
-and s0 s6 a7
-sra x0 t2 a5
-srai gp s10 16
-mulhsu a0 x0 a4
-srl x0 a3 s4
-srai s8 s6 0
-or t3 a7 s10
-mulhsu a2 t2 tp
-sub t0 s5 t4
-add s7 s10 s2
-ori a7 x0 1267
-addi a0 s3 -1526
-sltiu a6 a3 -1433
-andi tp a1 1813
-add t2 s4 a2
-div x0 t2 t6
-remu s8 s4 s11
-mulhsu s3 a1 t1
-mulhsu t6 x0 s6
-srl s4 gp a3
-auipc ra 735810
-sll t0 s1 a6
-divu s7 s3 x0
-mul a3 t2 ra
-auipc x0 146789
-sra t3 gp a4
-remu a7 a4 t4
-divu a3 a1 s11
-sll t0 t6 s11
-mul t5 t6 a1
-slti a7 s5 -1080
-sltu a2 gp a2
-lui s6 705246
-slli a7 a1 18
-or s8 a3 gp
-sll a0 gp t4
-or a4 s5 a7
-mul gp a6 gp
-sra t4 t4 s0
-slti s8 a2 -328
-srl a0 t5 s0
-auipc t6 583879
-srli s2 s1 24
-remu s1 x0 a3
-rem t2 ra ra
-sltiu ra x0 1962
-srai s6 s0 5
-and t4 s6 gp
-mulh t1 t1 t0
-ori s6 a0 -1237
-divu a0 s6 s4
-sra gp t4 s3
-mulhsu s8 t4 s3
-srli s2 s3 16
-auipc s9 620826
-auipc s8 176630
-mulhu t0 s10 t3
-mulhsu a5 t3 ra
-sltu s10 s10 a2
-and s7 a2 a6
-andi t4 s4 -1667
-sll a2 t4 a7
-remu gp a7 a5
-slli s4 t1 17
-mul s8 s2 a0
-auipc t5 214603
-rem x0 tp t6
-sltu a1 x0 t5
-sltiu ra ra -1211
-mulh s4 t1 a3
-xori s9 s7 911
-slti t4 a3 249
-mulh s3 a4 s10
-mulhu ra t2 a1
-sra a0 s9 s9
-remu s5 gp t3
-sub x0 t5 x0
-divu t5 a7 t1
-mulh a7 a0 s9
-rem t0 a7 t2
-lui x0 69018
-mulhsu t2 s6 t6
-remu t2 s5 t6
-mulh gp a4 t0
-addi s9 a5 -49
-add t5 s3 s3
-lui t4 780018
-sltu s7 t6 t1
-ori tp s1 -771
-srli s0 a4 17
-rem s1 s9 a3
-srai ra t5 13
-remu t0 a2 a4
-mulhu s9 a6 t3
-ori a1 ra 1801
-slti s10 a0 1915
-add s3 a7 s2
-addi t6 x0 -1137
-slti a4 s8 800
-mulhsu t2 t5 s9
-slli s7 ra 29
-sub t1 a2 gp
-slt ra s7 s9
-add s7 t1 x0
-srl t6 a2 t4
-div gp t2 s1
-div a6 a6 x0
-auipc a5 539154
-and ra t4 s7
-andi t3 a1 -663
-srl t6 a2 a1
-mul a7 s0 s1
-and s11 s5 t2
-srli a4 s0 26
-sra t6 s7 a3
-div s4 s3 s4
-srl x0 s10 s8
-ori a3 t4 -135
-sltiu s5 a2 -1839
-mul s7 t6 t0
-srl a6 x0 s7
-mulh a4 a6 t1
-mul s5 s6 gp
-mulhu a4 t0 a2
-xor s5 t1 a5
-sra s10 a4 t4
-mulh x0 s8 a7
-remu s2 t2 s6
-rem s4 a7 t2
-add a5 a0 t4
-add t4 a7 a3
-sra a3 s3 s11
-rem s0 s0 a7
-srl s6 a4 t1
-and s5 s0 a2
-or a0 s3 a7
-xori tp a6 -377
-slti a2 t4 -1013
-auipc s6 719645
-ori s0 s1 -1744
-slt s8 ra t2
-mulhsu t0 x0 t4
-xor x0 t3 ra
-or a4 s10 gp
-lui a1 263291
-auipc s4 5656
-div t0 tp s1
-div a4 a0 a7
-or s4 s0 t4
-sra ra t6 tp
-sll t2 a7 s1
-sltu s1 x0 t3
-srai s8 s11 5
-mul ra t5 t2
-slt tp s9 a3
-xor t1 x0 s5
-xor t4 t0 a5
-divu ra x0 s9
-srli a0 x0 28
-xori s10 s11 1084
-srai s2 a4 0
-sltiu t3 s0 -966
-mulhu x0 t6 t2
-andi s5 t3 -1094
-mulh a7 ra s7
-slt a0 ra s9
-lui s7 688846
-divu a6 a6 s3
-sra a3 t3 s8
-xori a6 tp -409
-srai s11 s9 13
-mulhu a4 a6 t3
-mul s7 s1 s0
-sll s10 t4 t5
-mulhsu t6 t3 s1
-auipc t0 181569
-ori a6 s5 -1084
-srl s8 t0 a5
-mulh s5 x0 t6
-srli t1 t4 19
-add s2 gp x0
-sltiu s2 t5 -723
-andi t2 s10 -1999
-slti a3 x0 1741
-sltu a6 gp ra
-slti s8 a7 -210
-add s4 s11 ra
-ori ra s7 1876
-sll gp a4 s0
-mulh tp ra s10
-mulhu s5 s6 t1
-divu a5 s5 a0
-slt s11 s11 s11
-slli s1 a7 9
-auipc s8 482821
-srli a3 t6 19
-div s11 a2 t4
-and x0 s4 x0
-sub s7 s8 gp
-sltu t6 s9 s5
-mulh s2 t2 a2
-and tp a4 a6
-lui s7 120552
-mulh s1 t0 t1
-auipc s9 989338
-rem s1 t6 tp
-mulh t5 s2 ra
-rem s9 s11 s3
-srli s4 s8 3
-sll a0 s9 x0
-rem a7 x0 s1
-addi a3 s7 -1285
-sltiu a0 a2 -895
-srai t6 x0 15
-sltu gp s0 s4
-mulhu ra s4 t4
-mulhu s3 s4 s5
-mulhsu ra t0 a5
-mulhu s9 a5 a2
-add s1 s0 t2
-xori t1 ra -665
-auipc s9 443605
-mulhu a0 a4 s9
-auipc t3 749662
-xori s9 a4 -214
-slli s11 t0 24
-sub x0 tp gp
-add a4 a1 a6
-divu s7 t1 s5
-srl t2 t4 s5
-xori s6 a2 -320
-sra tp a4 t4
-mulhu a1 s7 x0
-xori t2 a7 1621
-srl tp x0 ra
-sub s10 t6 a4
-slli s11 gp 2
-mulhu a2 s7 s8
-sll t3 a5 a1
-sub s8 s2 t4
-rem s6 x0 s9
-mulhsu s3 t1 ra
-mulhu s8 x0 x0
-mul s2 gp t1
-add a6 ra ra
-sll t3 a6 a6
-srl s6 a3 a2
-mulhu s10 t4 s1
-xori a6 tp -1449
-xor t0 s11 s2
-sll t6 a2 a6
-sra x0 s10 s6
-ori x0 t5 -56
-mul a7 s1 a2
-srai s10 x0 6
-addi gp a6 822
-auipc t4 1047550
-srai x0 t0 26
-ori t2 ra 849
-addi s7 a1 -1941
-srli t0 s9 13
-sub s0 s11 s7
-xori a7 a4 925
-xori t0 gp -397
-remu t0 x0 s4
-add s11 a1 s0
-mulhu s6 s8 s2
-andi s7 s5 -715
-mulhsu s3 t6 s7
-andi s2 s2 -569
-sra tp s3 s6
-rem a2 s9 a4
-andi a3 s9 -61
-srli s1 t5 30
-divu s1 a6 a2
-slti s4 a3 -1889
-or x0 a1 a6
-andi gp a1 612
-remu a2 s1 t3
-andi a4 t3 -266
-srai t0 s9 8
-slt a2 a1 s8
-auipc t1 640639
-sltiu t6 a4 -873
-mulhsu t4 a3 s5
-or s6 x0 t4
-srl a6 s7 gp
-mulhsu s3 s6 t3
-remu t5 s0 ra
-lui t1 436457
-sub s11 a1 t6
-divu gp a3 tp
-mulh s2 s10 t0
-sub s9 t2 a3
-addi ra ra -1261
-slti s11 a5 -1099
-ori t4 s7 -837
-xor s4 s0 s0
-mulhu a1 a0 s10
-andi s5 s8 -1240
-andi a5 ra 17
-auipc s2 702438
-sub ra a3 t0
-sub gp s3 s6
-lui a6 463744
-or s7 t2 s7
-xori a1 s1 1284
-divu s1 a6 a6
-or t5 s11 x0
-srai gp t1 20
-srai a5 s9 24
-sltiu tp s0 1264
-srli s6 s11 7
-mul a6 a2 a5
-sub s9 s2 a1
-mulh a7 s6 a2
-sltiu s0 t6 1799
-and a1 s7 s11
-and x0 t6 x0
-or s4 a2 a3
-andi a3 a1 -1070
-add s4 a1 t4
-srl t0 s10 s10
-mulhu s2 s2 t1
-or t4 a7 t4
-addi a6 a1 1099
-sltiu t3 t6 -1260
-sub ra ra ra
-add a1 t5 t6
-slt x0 a1 a5
-srl a4 t5 a1
-and ra ra t3
-mulhsu s0 a3 a0
-addi t2 gp -383
-or s10 s1 t1
-mulh s2 gp ra
-div s3 ra s1
-remu a3 s2 s4
-slli tp a7 8
-mulhsu t4 t2 a1
-srl gp t3 s4
-sltu s10 t6 t2
-xori t3 a7 -34
-div a2 t1 tp
-divu s9 s3 a1
-slli s3 s3 28
-mul s3 s8 s2
-or a0 a5 s1
-srai gp a3 27
-add t2 a5 a2
-mulhsu s2 s1 t0
-xor t1 a5 s1
-rem s5 t6 s0
-remu t2 s1 x0
-addi s5 s11 -1988
+srli s4 s1 11
+lui a3 927854
+remu s10 s2 t1
+sll t0 s9 a1
+srai t1 t0 21
+mulhu s1 s10 s4
+or s11 t5 x0
+mulhsu s4 x0 t0
+addi a4 t5 -645
+sll ra t2 a4
+addi a3 x0 -1425
+sub s8 a2 s2
+remu ra t1 a5
+andi tp t6 845
+lui a1 460001
+slti a1 t0 792
+xor a5 gp x0
+sra s9 s10 s5
+andi s9 a1 777
+add t1 s1 t5
+sub t6 a3 a2
+rem gp t2 s10
+add a1 a7 a3
+xor a0 s10 a7
+srl a2 ra t0
+rem s8 s3 a7
+sltiu s9 a6 -1443
+sltiu s11 a1 -1224
+sub s6 x0 s2
+srai t0 gp 7
+xor a0 a6 s11
+or a4 t3 a1
+remu gp a0 t1
+mulh s9 gp a1
+sll a0 s2 s6
+srl t0 t0 a0
+add gp t1 a7
+add t3 t3 s3
+mulhu t3 s2 a3
+lui a4 816640
+sll s9 s8 s2
+slli a4 s11 16
+ori t6 s0 77
+sll a3 s8 s6
+mulh tp s2 s6
+div s7 a1 x0
+slli a7 t1 12
+sra a6 x0 s10
+srl s1 s8 x0
+slti s1 a1 -415
+rem t4 t3 t4
+sra s7 s2 a4
+addi s7 t6 -1671
+sltu t6 t5 s2
+sll a0 a4 tp
+divu a1 s5 s3
+sll a2 t2 s1
+srl s4 a6 t5
+sra t1 t4 a2
+andi t2 gp 1816
+ori s11 t0 662
+mulhu s10 a5 x0
+slti a6 s0 -199
+slti s6 s8 -346
+or t1 a7 t5
+srai t3 t4 15
+auipc s8 997971
+auipc t2 349641
+sub a5 tp a3
+ori s2 gp -1305
+slli t0 a3 8
+srl ra x0 a0
+mulhu s6 s0 t6
+rem s7 t6 t1
+andi s9 a5 880
+remu a7 a4 t6
+div s0 t5 t3
+div a2 s5 t3
+srl a6 a5 t2
+srai t2 a4 20
+sll a3 t0 s11
+sltiu ra t0 -1943
+or gp s6 t6
+add a1 gp a5
+divu t3 a2 s5
+rem t1 a4 t4
+remu s7 s5 s10
+srai t2 s2 1
+sub t5 t2 gp
+or t5 a0 s1
+mul x0 ra t3
+slti s8 a4 -872
+divu a5 s10 s8
+mulhsu s9 gp t6
+divu s11 a3 a7
+sll s7 a5 t6
+andi a1 s6 623
+remu s8 a4 x0
+xori a6 s0 -1730
+sll s2 a6 a4
+mulh s3 t0 t3
+srai s6 ra 27
+slti t2 s3 402
+sub a0 a1 s0
+sltiu tp a0 -1524
+remu s3 a4 s1
+sra t3 a7 a7
+sltu gp t3 a2
+divu t3 a6 s2
+andi x0 s10 -1855
+slli s1 s11 24
+xor t2 s1 s8
+sub a1 gp gp
+mulhu t1 a5 s4
+addi x0 s6 -594
+srai s1 gp 6
+mul t0 s9 s11
+mul t3 x0 a4
+mul ra s4 t3
+ori t5 a4 -1587
+addi s5 s0 -1952
+srl t6 gp tp
+slti ra s5 -1352
+add t1 a1 a7
+mulhu t2 tp s0
+ori s4 s7 -212
+ori s4 a6 -1621
+srai t3 a2 16
+mulh a1 a1 s3
+sltu t4 a2 a1
+xor a3 t5 s11
+remu a3 s1 s10
+xori s3 t6 -553
+srl gp a4 t5
+sltiu tp a3 -50
+div s7 s10 a6
+sra s6 a6 s9
+xori s1 t0 -1646
+mulh s7 x0 gp
+slt s8 s4 gp
+mul a5 s9 tp
+auipc a5 808950
+mulhsu a3 a6 a7
+ori a6 a7 -428
+xor t0 tp a0
+andi s3 s10 -1050
+srai a4 t3 18
+addi s7 a0 -150
+srai s1 s11 6
+ori s9 s11 1822
+slli a5 a6 10
+slt s8 s9 t3
+srl s0 s9 t2
+or s1 s6 s2
+sltiu a3 t0 32
+auipc tp 253021
+sll s11 a2 a1
+ori t5 t4 -245
+ori s0 t2 -1427
+rem a4 s3 s3
+divu s2 t4 s6
+sra a7 a4 t5
+mul a1 a5 t6
+or gp t3 s7
+divu s8 ra tp
+sltiu a0 s9 -356
+srai a7 t2 10
+remu t2 t6 a2
+mul a1 tp s10
+addi t1 a2 -572
+mulh t2 a3 a0
+mul s10 a6 s5
+srli s11 s9 15
+srl tp a6 a2
+ori s4 t1 -734
+srai a1 s0 28
+remu a6 ra a5
+add t3 s4 s2
+slt s7 s0 t1
+sra s1 a0 a6
+mulhsu x0 s3 a6
+srli s1 tp 31
+slt s10 t0 t3
+sll s0 t0 a4
+andi a1 t2 -955
+addi t2 a2 -1335
+slti s11 a3 -1300
+sub s4 s5 s8
+div s2 a6 t3
+sltu a0 a4 t2
+sltiu a2 ra -133
+and t6 tp a1
+mulh a3 s10 s0
+rem s0 s3 t4
+divu s9 s6 s11
+mulhsu a4 a3 t5
+slt s4 t2 x0
+srli x0 s10 28
+divu a5 t0 s3
+auipc s9 439808
+ori a2 t4 537
+srl a1 t6 tp
+and a5 t3 a1
+sltiu a7 a5 -1184
+lui t0 967240
+auipc s0 525413
+sltiu a3 s3 -1135
+auipc a5 455946
+lui t3 355869
+div x0 tp a2
+auipc a3 540097
+srl s9 s4 s2
+and tp s9 t0
+slli a5 t0 6
+xori t6 s11 -233
+addi t4 t6 1129
+sltu t0 t2 s7
+srai t5 s11 25
+slt s3 s1 t3
+and a3 a1 s4
+xor a1 s1 s4
+srl ra s7 t2
+remu a1 s1 s10
+and a0 t1 a7
+sll s6 s5 s8
+mulhsu t2 s10 a2
+ori s7 t4 303
+slt t4 s2 s0
+mulh s3 s3 a7
+slli s11 s3 26
+andi s6 t0 -81
+lui s7 682354
+andi a7 a5 166
+and a6 s11 s11
+mulhu s5 a2 s2
+mul a3 tp ra
+srli s2 s2 7
+remu a6 s9 s5
+andi s8 s4 -1851
+rem t3 s4 t1
+ori t5 t1 -1499
+mul t1 s0 s6
+xori t5 x0 -1281
+remu ra s4 x0
+and t0 a6 a3
+mulhsu s5 a5 a1
+rem t3 s2 s6
+div s7 t5 t6
+sltiu s0 a3 -64
+sub s11 a2 a1
+and s0 s5 s4
+mulh s8 t3 t5
+mul t0 a7 t2
+srai t0 x0 11
+mulhsu t6 s9 t1
+mul a0 s2 s6
+add ra s8 a2
+andi tp tp 2
+add ra t4 s0
+andi s8 s11 -1357
+andi s1 a5 -286
+sll s7 t5 s2
+and tp a0 a4
+slli s3 s0 9
+sub t6 t6 a6
+slti t6 a7 -393
+rem s3 t4 tp
+srli a0 s4 6
+remu s6 x0 tp
+add s4 s7 a2
+slli a2 x0 9
+srli t5 a5 20
+slti t1 s7 -821
+mulhsu a6 s0 t6
+or s10 s8 s1
+mul t1 t2 a1
+sltiu a7 s11 140
+xor a7 gp t1
+srl s9 s0 t2
+mulhu tp s5 s10
+and s3 s7 tp
+rem t1 s4 gp
+xori s0 s4 -1366
+sll s11 tp t1
+ori a2 s1 1104
+mulh s11 s6 t3
+sub s5 s0 a3
+and t1 a7 t2
+mulh s10 ra ra
+xor a2 s6 t6
+div a5 t6 s11
+sra s9 t5 a7
+xori s7 s3 -373
+srl a1 tp a1
+divu s7 t0 s2
+sltu a3 t0 t0
+and s2 gp a2
+slli tp a0 21
+or a0 a0 s1
+remu a3 s6 t0
+mulh t6 t3 s3
+mulhu a0 s11 x0
+and s3 a4 t5
+sra a3 a2 s0
+andi s3 s7 -667
+sltiu t3 a3 159
+sltu ra s9 a1
+srli s1 s0 28
+mulhu a2 s5 tp
+add s2 t4 s4
+slt a1 s4 x0
+divu t5 t6 s3
+mul a1 t4 a4
+sra a3 s10 t4
+srli t0 gp 4
+lui s10 150576
+slli t0 t0 17
+remu t4 s10 t5
+mulh a7 s1 t1
+srai a1 t6 0
+srai a7 t4 31
+divu s9 s2 a1
+andi t6 t5 -609
+sll s8 s9 t1
+srl a4 a5 s4
+mulhu gp t3 s9
+sub x0 s9 s11
+sltiu t4 t4 107
+xori a5 s1 571
+xori s8 a1 1307
+remu s10 s4 t0
+sra a4 s2 tp
+xori t2 a5 758
+or s5 s3 s3
+srai t0 t4 31
+slli s7 t3 21
+xori a4 s2 1584
+xori a3 ra -1073
+ori a3 tp 1911
+xori a3 x0 -542
+slli s7 s4 6
+ori s6 a4 1174
+mulhsu a5 gp a4
+add a6 x0 t3
+slli t0 a5 8
+xori s11 s10 -187
+mulh a6 s3 s10
+mulhsu s1 t0 t1
+auipc s4 708306
+divu s4 s7 a3
+slt s3 t5 s1
+srl t1 a2 s6
+srli t0 s10 16
+xor a5 t6 a7
+or a1 tp t5
+mulhsu a2 s1 tp
+or t4 t4 s4
+slli a7 s7 15
+sltu a5 t0 t3
+or t4 s9 s3
+sra ra s1 ra
+slli a3 t2 6
+slt x0 s3 t0
+andi a4 s6 1034
+mulhsu s8 a0 s0
+rem t2 x0 s8
+slt a0 s4 gp
+sra s5 t6 s11
+srai t2 t5 19
+and s11 s3 a2
+srl s1 t0 s10
+mulhsu s6 s5 s1
+mulhsu s5 s2 s9
+sltiu t4 t2 -1447
+div a1 t5 s6
+srli a1 s0 25
+div a5 s0 s11
+lui t2 815053
+xori s9 tp -26
+sra s10 gp a3
+lui t1 779358
+div t1 t5 a5
+slti x0 s5 -542
+sltu a3 t2 s11
+or a4 x0 a7
+div a3 t4 s0
+srli s2 s5 12
+sll ra t0 s6
+xor a7 s5 x0
+divu a2 a1 s9
+mul a4 t3 s5
+ori s6 s4 456
+mulh s8 a5 s10
+slli s11 t6 13
+sra t5 ra s5
+rem s1 a6 s1
+mulhsu s0 a5 s4
+andi ra a1 1561
+add t0 a7 s4
+andi t2 tp -1286
+mulhu s1 t1 a6
+ori s3 a4 -208
+andi s2 s11 -1102
+sltiu t4 a5 426
+divu s4 s2 s8
+ori tp t5 1233
+sltiu t3 t1 1887
+srai ra s4 17
+sub t4 t3 s11
+divu a5 t6 a3
+auipc s4 601483
+addi s0 s11 -28
+div a2 s6 t0
+slli a6 s8 29
+sll a2 gp t1
+xori s0 a3 149
+divu t4 s2 t0
+slti a1 ra -1013
+ori s8 a5 830
+ori s3 t5 1287
+mul t2 a2 s11
+slti tp t2 1713
+slti t1 t4 708
+mulh t0 gp gp
+xor s7 t0 t3
+srai s4 s8 17
+auipc s6 487017
+sll gp x0 s4
+div s4 a5 s8
+slti t0 s10 304
+rem t6 a2 s11
+lui s9 648395
+sltu t2 s1 a5
+slt t6 t1 a5
+and x0 t0 a6
+sll tp t4 s8
+sltu s2 t5 a4
+auipc s3 872568
+mulh tp a3 s6
+div ra s5 tp
+add s8 t2 s0
+srli s7 t6 27
+rem t1 tp s0
+remu a2 a4 s4
+divu a4 a6 s9
+slti a5 t3 252
+sra s7 a4 a4
+ori a5 tp -1781
+srli s10 a5 17
+or s2 s4 t5
+addi s10 s0 956
+mulhsu gp s1 s11
+divu s8 t3 t2
+xor s7 a7 a2
+slti gp a3 175
+xori t0 a3 -1658
+sub x0 s1 ra
+xori s8 s9 -73
+xor a3 s11 s5
+mul s11 gp t5
+slti gp s4 -951
+sltiu x0 s1 -1511
+slti s11 a1 -1236
+auipc t5 366730
+add ra s10 t6
+addi s9 ra -1504
+mulh t1 t5 a4
+mulhsu s7 a6 a2
+sltu s6 s11 x0
+mulhu a6 s6 a1
+mul t4 a1 ra
+addi s6 s8 303
+slti gp s4 1265
+and t4 s1 t3
+mul gp s9 s11
+mulh a2 s5 x0
+sltiu a1 ra -886
+slt s4 a3 a4
+xor s4 t3 a7
+div a2 gp s0
+srli a5 s4 12
+xor ra a6 t2
+mulhu a1 a6 gp
+slt a7 a0 s10
+slti t1 a6 1412
+sltu ra t6 a1
+sra a1 a4 ra
+mul s0 t0 tp
+remu a2 s5 a1
+addi gp a2 -367
+andi s3 s1 1761
+sll a0 a3 a6
+auipc a7 771527
+xor s7 a2 a7
+mulhsu a3 s0 a5
+addi t1 a6 -1049
+srl s6 t5 s11
+sltu t5 s4 s3
+remu a0 a2 s4
+mulhsu a2 s8 s7
+mulh t2 s2 tp
+sll t0 t1 s6
+ori a7 a7 -1470
+sll s3 s11 a1
+sll a1 t4 s7
+and s7 t1 t4
+srai a0 tp 25
+lui s8 116975
+sltu a5 s4 a5
+xor s6 a3 a3
+remu ra ra s6
+srli s0 a3 0
+remu t3 s10 a6
+srli s0 a0 14
+mulhu s11 s1 t0
+addi s2 t2 -1425
+sltu tp s1 a1
+mul a1 x0 s9
+ori ra s9 -294
+sltu t3 s1 s4
+and t6 t3 a3
+sltu s10 tp s4
+srai s6 s6 26
+andi s11 t4 -1957
+auipc s11 784466
+mulh a0 s4 t5
+div t1 t4 s6
+lui s6 256483
+or t6 a5 s0
+sub x0 s5 t2
+add a6 tp t5
+srl a7 a4 t2
+sltiu gp s3 1219
+mulh ra s1 s11
+mulhu s8 s11 s8
+lui s3 535880
+or a4 a5 a5
+or s4 a0 t3
+and s0 a5 a1
+mulh a2 s9 s4
+divu ra s1 t1
+rem a6 t4 s1
+slti a4 a7 -2012
+mulhsu t5 s7 t2
+sltiu s9 a7 1584
+mul a6 a4 gp
+mulhu t1 s0 t5
+sra s10 a3 s7
+addi t5 a0 -1561
+mulh a0 tp s10
+mulhu a2 t0 s0
+mulh t1 t0 t5
+lui t4 888096
+div t2 t2 t3
+div a0 s9 s3
+rem s10 s8 x0
+srai a5 s4 25
+slli a7 tp 9
+addi s10 s6 438
+add s3 t6 t1
+ori s0 t3 -1811
+xori s5 s1 -1771
+xori s1 s11 -1012
+remu gp s9 s0
+sll a2 s10 t2
+srai a4 a7 31
+srli t3 s10 30
+mulhu t4 ra s10
+auipc t0 356667
+mulh tp ra gp
+slti a2 t2 -773
+sra s10 s2 s9
+addi x0 s1 -827
+sltiu a0 s2 -1057
+slli s7 s0 29
+srl a3 ra s8
+mulhsu a7 t0 ra
+slli a7 s9 19
+sub s11 tp x0
+slt a3 a4 tp
+ori tp t3 -100
+auipc s1 980990
+slt t1 a4 t6
+add a6 s1 a0
+ori s0 s5 -1924
+addi s1 gp -1314
+lui s5 742687
+addi a5 s1 -140
+srl gp tp t6
+divu s3 a3 a1
+srai s6 s9 13
+slli s10 a1 22
+remu s7 a3 gp
+lui s8 300552
+addi a1 s4 -302
+and t0 s0 s3
+addi t1 t6 -1196
+and t6 s6 t2
+mulh s0 t1 s3
+rem t6 x0 s2
+mulh t0 a6 a0
+srl gp a0 s2
+andi a7 t6 -1409
+srli a4 a5 17
+sll t4 t1 s3
+mul t3 a4 s11
+andi s4 tp -428
+slti a3 a6 -1566
+div s5 a2 t3
+srl a2 t3 tp
+sltiu t4 s9 -1680
+divu a1 s4 a7
+xori s6 s9 90
+srli t3 s1 15
+slt a4 s9 t5
+sra a5 t3 a2
+mulhsu t0 a1 s1
+remu a2 a6 s1
+ori a5 a3 -578
+xori s11 a7 151
+or s7 a2 tp
+mulhsu s9 s7 s9
+andi t5 a1 1979
+rem s9 t2 s11
+mulhu x0 s11 a2
+xori t4 tp -1098
+mul t4 t3 a6
+or t1 a3 s4
+remu t0 a5 s2
+add x0 t0 a5
+sll ra a2 a2
+xor a4 a7 s2
+rem tp t0 t3
+mulhsu gp a1 x0
+xori ra gp -1755
+mul gp s1 s5
+mulh s4 s2 s11
+slt t0 s7 s6
+ori s0 s5 -1184
+remu a5 s2 a5
+div s3 s11 s6
+slli x0 a7 6
+srl s1 t4 ra
+ori a3 a7 1208
+andi a1 s9 1411
+andi tp a4 -1684
+slt t5 s3 s3
+sltu a3 s0 a2
+mul gp a1 s8
+mulh s3 a3 a2
+srl t4 s0 a0
+ori x0 t3 594
+slt a6 a5 t2
+ori a0 ra -1086
+slti s1 t6 -1942
+sra s10 s1 a0
+srl x0 a2 s5
+lui a7 403610
+remu gp a0 s0
+mulhsu t3 s1 t3
+slt t2 t5 s8
+auipc a6 696792
+lui tp 612174
+sub s11 a3 ra
+mul a3 t3 a3
+slti ra t2 -1319
+and a3 a6 s5
+slt t1 s1 s5
+mul s8 s7 s3
+sll t4 t3 a6
+auipc s6 206810
+andi gp x0 -1351
+and a1 a7 s2
+slti s11 tp 700
 or s8 s0 t0
-or t2 s5 t4
-rem x0 s2 gp
-ori t1 s9 1305
-xor t4 s8 s7
-mulhu a5 a5 a1
-auipc s8 301468
-add a0 a2 a0
-xori a5 s4 -848
-sub s9 a7 s8
-mulhu a1 t6 a3
-mul x0 t0 t5
-sll s7 s2 a3
-mulh s1 a0 t1
-mul a5 t0 s6
-sltu a3 s11 s10
-sub t2 s5 s10
-mulh s4 s5 a2
-lui x0 584592
-slt tp a0 a4
-xori s6 tp -58
-or t6 x0 tp
-slli a1 a2 4
-slli x0 s4 3
-remu ra a3 a2
-slti t1 t0 -1027
-xori a0 s2 -1034
-slti s8 s2 -1513
-lui a4 794817
-mulhsu s6 a1 gp
-remu t0 t0 a3
-or ra a3 s10
-auipc s10 156836
-div s8 s9 s9
-xori s4 s1 -321
-sra t5 s1 s5
-add x0 t4 gp
-ori a4 gp -1186
-slt gp s9 x0
-slti a7 s9 -1837
-div s1 t3 s9
-remu a0 t1 t0
-addi tp a4 -228
-sll s11 t6 s5
-slli a7 s11 11
-divu s3 t4 a5
-andi s0 s0 1406
-slli t6 s7 18
-divu x0 gp a2
-slti gp s6 1289
-mulh tp a5 s3
-sll t6 a1 s8
-and ra t3 a5
-ori a7 t0 -1566
-div a3 a0 a3
-lui s10 75760
-divu t4 gp s7
-ori s5 s7 1823
-sltiu s5 t4 213
-div a0 ra gp
-slli s3 a6 12
-mul tp s1 t6
-div s3 x0 t1
-add t5 t0 a5
-or s9 s9 gp
-lui s9 908274
-xori s5 a6 -1270
-div t6 t0 a0
-xori x0 t5 1269
-slli s4 a0 18
-div gp a5 s7
-rem s8 a0 a2
-slti a0 a1 -445
-rem a1 a4 t4
-remu x0 t3 t5
-sltiu s4 a4 -1957
-slti s7 a5 -1332
-sltiu a4 t5 -450
-slli t6 s0 5
-srli gp s2 20
-mulh a7 a5 t4
-mulhu t4 ra s1
-remu s6 s0 t3
-remu ra s7 s3
-srli t1 a5 26
-mulhsu a2 x0 t6
-mulh s10 s10 t0
-lui t3 581737
-mulhsu a1 s5 s11
-srli t0 t1 29
-mulhsu s8 s11 tp
-mul x0 t2 a4
-xor a6 gp s2
-mulhu a5 a4 s0
-mulh s4 a6 s7
-srl s10 ra s9
-slt a3 t2 a0
-mulhu t4 t5 s5
-add t4 s11 s8
-sub a3 t6 s5
-slti t4 a6 -491
-addi s0 t2 1347
-remu t4 s4 tp
-sltu a0 a2 t5
-rem s5 s7 t1
-divu a0 a5 a2
-and t2 a6 t4
-addi s1 s9 -1297
-mulh t2 a7 x0
-rem t4 s4 t2
-sra s5 s6 s0
-add gp t3 a6
-rem s4 a7 s11
-mul s11 s0 a5
-srai t6 a6 15
-sltu t1 s4 a7
-mulhsu s2 gp t4
-lui s10 220619
-add s5 s2 a6
-srli tp a6 20
-and s0 a0 a4
-xor x0 a1 s1
-add a6 t0 x0
-sll x0 s2 a3
-srai t5 a7 31
-srli t2 s1 7
-remu t3 t6 tp
-slt s4 t2 s0
-mulhsu s10 t4 s9
-ori t2 t4 -573
-srai x0 t1 4
-sltu a5 a7 t4
-sltu t6 a1 gp
-mul s8 s4 t5
-rem a1 s6 t3
-add a5 a2 s6
-and ra a7 a7
-xor x0 s9 s3
-slli s8 a5 27
-rem s4 a2 s0
-and t0 tp s8
-sll s0 a0 t1
-slli s6 s9 30
-slli s9 s1 9
-sll a2 s8 a2
-slli s7 ra 4
-slt t2 s6 s1
-mulhu x0 a1 s0
-slli a0 t6 24
-slt t4 a0 t3
-divu s5 a7 s3
-auipc gp 408865
-srl x0 s8 a2
-lui a0 608562
-xor s0 t6 s4
-sltu x0 s11 s11
-slli t4 t0 30
-auipc x0 152002
-xori s7 t1 -65
-addi s5 x0 108
-srai tp s4 14
-xor s11 a3 s3
-xori t5 s5 -382
-sub t5 a1 s10
-srli t1 s6 7
-lui s3 801238
-lui s6 909017
-sll x0 s4 t6
-xori t4 t5 1427
-mul a6 a3 t3
-sub tp x0 s4
-addi tp s5 -30
-xori a4 x0 1025
-mul a6 s10 s0
-slti ra s7 -364
-ori tp ra -310
-ori t4 t4 -1079
-andi s11 s0 -59
-add a1 a3 s0
-div x0 t0 ra
-srai gp s0 4
-xor s3 s10 s2
-remu s1 s5 a4
-ori s6 s5 -1185
-mul x0 s0 gp
-mulhsu s7 s2 ra
-mulhsu a4 s7 a5
-srl a3 t4 tp
-auipc s4 751928
-mulh gp a5 t1
-sltiu t6 s0 -890
-slli tp a6 16
-slli t5 s9 27
-srl a0 t3 t2
-add s4 s6 gp
-sub a4 t4 s10
-slti s1 s9 620
-mulhu s9 a4 t3
-sltu s11 s9 s9
-xori t2 s5 -677
-andi s5 t4 -142
-sltiu a7 a7 1014
-rem s6 a5 t6
-divu t3 t5 s3
-auipc s4 517920
-sltu s8 s2 s4
-or tp a3 t4
-sra x0 gp s2
-remu a6 a7 s5
-srli a5 t0 14
-slti t2 t1 638
-slt x0 s10 gp
-xor a5 tp s2
-sll s6 a1 a2
-addi t3 a7 -780
-mulhu x0 gp a6
-or s7 gp s0
-andi s2 a5 1003
-xori a3 s1 -706
-sub a0 a2 t6
-lui x0 277770
-ori s10 t5 1736
-sra s0 s4 t1
-xor s11 gp s9
-auipc s1 289301
-ori s6 s2 1744
-or a0 x0 s11
-div gp s1 a0
-div s0 s8 x0
-slti ra s9 -907
-slti t6 s6 1810
-sub s5 s9 a5
-srli ra s1 0
-addi a2 ra 1155
-divu gp ra t4
-sub a0 ra t5
-sub s5 s9 a0
-auipc s9 675357
-xor a5 a2 a5
-slti tp a2 1604
-srai t4 a4 31
-srli s5 t3 16
-mul x0 t0 s6
-or s8 t6 t4
-div s7 s0 t6
-mulh s11 a4 s2
-sub s5 t4 s3
-mulh t4 s7 t6
-sltu a2 s5 s3
-slti tp t1 -305
-add t0 gp t5
-mulhu s6 t0 x0
-sub a0 s1 s11
-slt s3 a4 t3
-mul t1 ra x0
-remu x0 a4 tp
-addi gp s3 293
-mulhu s7 x0 s6
-srl s6 a6 s3
-divu s1 a2 a2
-slt s2 s4 s3
-sra s3 a5 t6
-div a6 s3 t4
-remu tp gp t0
-mulhu t0 a3 a3
-ori gp a0 1252
-addi s4 s1 1311
-srai s3 x0 17
-slti s1 t2 -1150
-and a3 t0 t0
-andi s6 s0 -1676
-mul gp s9 a6
-sub a5 a5 a6
-ori s1 t1 -1174
-sltiu s4 s8 -1115
-mulh gp s1 t3
-sra s10 s1 t3
-sub t1 a4 ra
-xor t4 a3 t5
-sra a1 s2 x0
-rem t5 s3 a1
-ori x0 a0 1926
-sub a3 a3 s10
-slli t2 s6 17
-andi s2 a5 -124
-remu s7 a2 s8
-sltiu a5 t4 -1149
-xor a5 s9 s1
-sll a1 t5 x0
-sltiu a1 tp 1533
-sltiu s0 s7 -778
-xori x0 s11 -1607
-srai s11 s8 25
-lui t4 915186
-xori s1 ra -2020
-xori a7 ra -2046
-sltu s3 a5 t1
-addi tp s10 -722
-mulh t0 a7 a6
-sll a3 s11 x0
-srl s2 x0 s10
-remu a1 x0 a0
-sltu tp s5 t3
-sltiu s4 gp 1935
-srl t6 s1 a0
-slt s3 s11 a4
-div a4 s7 s4
-div t2 s4 a4
-srl s6 t0 s0
-auipc s8 479110
-divu s3 ra x0
-addi a5 s1 -646
-slli s0 a4 0
-slti s3 s1 -204
-add a0 s8 a4
-srl t1 t4 gp
-or t3 s10 x0
-sll ra gp x0
-sltiu t1 s11 -226
-slli x0 gp 10
-xori t0 t5 -860
-or s6 a3 a0
+remu gp t3 s7
+slli ra a4 13
+slli tp t4 15
+add t6 t1 gp
+auipc a3 924923
+div t1 t0 t4
+ori s2 s1 1474
+slti s0 s11 1760
+div t1 s8 x0
+slli t0 s2 5
+add a4 s8 a1
+sra s1 a1 a6
+sll s0 a4 s9
+slti a4 s10 -183
+sltiu t0 tp -1061
+remu s3 s3 s8
+slti t2 s4 -1990
+mulhsu a5 gp a0
+remu s9 gp s0
+and s4 gp s0
+and s10 a3 s4
+lui s5 39989
+slti a7 a4 -188
+andi s7 a6 -574
+rem a7 t2 s1
+div a4 t2 s10
+or tp a6 a3
+lui s2 674059
+mulhu a0 s7 a4
+srl ra s6 s0
+sltiu a1 a6 -1906
+slti s10 gp -385
+xori s11 gp 1677
+slti t0 s5 911
+srl t3 s4 t2
+slli s11 a7 27
+srai a5 s5 16
+mulhu ra t3 s9
+mulhsu a1 t3 a4
+xori s11 s6 -687
+xori s9 tp -1872
+xori t2 s0 -1915
+sub s2 a2 a5
+addi t6 a0 -1065
+addi s11 s0 -901
+slt s6 a3 s5
+mul s6 a4 a6
+andi ra a2 -578
+xori a2 a2 -1210
+or s0 gp a6
+lui a1 234982
+rem t6 a6 a4
+addi a3 a3 -1178
+srl s9 t1 ra
+slt x0 t4 t3
+sll s1 s2 a0
+srli t4 s3 1
+remu s3 s11 s1
+mulhu t4 s0 t2
+sra t4 s2 a6
+add gp s5 t5
+and s2 s9 t4
+sltu s0 x0 x0
+slt t4 s2 s8
+divu a4 s5 a2
+divu s9 tp s2
+slli t6 s10 15
+auipc a6 846423
+mul a4 t2 a6
+sltu t3 a7 a5
+or a5 s11 s1
+xor t5 x0 s7
+slti s5 t6 -339
+add s11 t3 s7
+sltu a1 s6 s10
+xori s6 ra 307
+slli t4 s9 8
+add x0 t5 x0
+sll a5 a6 x0
+ori a5 s9 -1959
+mulhsu s9 s5 t1
+sub ra ra s4
+srl a6 a2 s10
+sltu s5 a0 s3
+sltu s6 a7 t2
+srl t0 s0 gp
+or s6 s10 t0
+mulhu a7 s2 t5
+remu a4 s8 s1
+or t1 t4 a2
+sll s7 a6 t6
+slti s4 gp -1011
+xori tp s9 -2019
+div x0 a2 s0
+div a1 s2 s8
+xor s2 ra a1
+ori s6 s8 829
+sltiu gp s4 -1295
+sra t0 a7 tp
+xori a4 s11 1365
+srl s0 s6 t0
+add a7 s10 a7
+xor s4 s0 s4
+andi s5 a4 -64
+sra a7 s7 t4
+srai t0 s2 15
+srl a1 s7 s1
+mul s11 s11 t2
+add a6 t4 s3
+mulhsu t4 s0 a0
+lui s3 29665
+addi x0 ra -285
+and s1 s3 a5
+add s5 s7 t4
+sltu a0 s8 s10
+slli a0 s11 20
+andi s8 t6 1726
+or a4 t5 s10
+sub s1 t1 a3
+divu s2 s9 s3
+mulhu x0 ra t3
+srai s7 s10 3
+div t1 s1 s11
+sltu ra s4 a5
+srl x0 tp a3
+slti a7 t5 107
+mul t5 t0 a0
+slt x0 s11 ra
+srl a2 s10 a1
+sltu t1 tp t4
+sub s6 t2 s2
+add s7 t5 s7
+srai t4 tp 28
+mulhu a1 s6 a3
+srai a1 s7 19
+xori a1 a3 1682
+srai s1 s4 12
+lui t5 1043357
+add t4 a5 s10
+slt a4 ra s6
+sra t3 x0 s7
+sra a1 t4 s8
+mul t1 a4 s11
+lui a2 283937
+sltiu t5 s2 1277
+mulhu a6 s0 s9
+slti s1 t5 1560
+addi s7 s11 -439
+div a1 s9 t3
+div s3 s7 a6
+mulhsu s5 s11 a4
+lui s1 598823
+addi s2 a4 -301
+div s10 s10 t2
+slti t6 s9 1191
+addi gp s11 -851
+sltu t5 a2 a2
+andi s1 tp -387
+srai a4 tp 7
+addi s2 s11 -1315
+or s6 s6 s9
+mul s6 s9 a1
+and a3 s7 t1
+slti s8 x0 -27
+add s1 gp t4
+sltu a0 s6 s7
+auipc s8 976109
+sll s6 s1 s0
+rem s1 x0 t4
+sra t5 gp gp
+slli t1 a5 19
+slli a6 s1 3
+sub t0 ra t4
+sub gp t0 tp
+mulh a4 a0 a7
+mulhsu t2 t0 s0
+sltiu t6 s6 -989
+sltu s6 s10 tp
+div t5 t6 a2
+slli s11 s2 29
+xor t2 s10 a2
+xori t4 t3 2021
+addi s3 t5 -377
+mulhu t3 a7 s6
+or s2 gp tp
+slt s8 a4 t6
+div s11 a1 s4
+slt a3 t0 a2
+slti t5 ra 1731
+add t4 a4 s5
+mulh s8 gp t2
+mulhu s6 t6 s6
+add s7 a6 ra
+rem t5 a1 a5
+mul a0 s7 gp
+lui s11 49582
+srli t5 s8 4
+sub s8 s3 s5
+add s3 t4 s7
+sll s8 s2 s5
+srli tp t4 15
+mul t6 s2 t2
+andi gp s8 702
+srl t4 s11 a3
+mulhsu tp s3 a4
+slli s10 t3 4
+or gp s7 gp
+sll ra t2 t3
+remu a5 a6 s4
+and t2 s0 a2
+mulhsu s7 ra a5
+remu s5 t5 tp
+srli a2 s0 1
+ori tp a4 -68
+slti a6 t5 -716
+andi t4 s8 -783
+slli s10 s5 19
+addi a6 a4 1093
+srai gp t6 17
+divu a4 s1 s4
+sll s11 tp s10
+andi s6 t0 -85
+mulhsu tp s2 s7
+srai a6 ra 3
+mulhsu s7 gp a1
+sll s0 a1 a1
+addi a3 a5 -99
+remu s5 s7 s8
+srli s8 tp 12
+xor ra t4 s10
+remu t2 s11 t1
+div s11 t5 a3
+sltiu t2 s0 -1122
+slli t5 a5 2
+srai t6 s7 12
+xor s9 a1 a7
+slti s11 ra -649
+remu t2 s11 s1
+mulhsu t1 s9 x0
+mulhu a2 ra a5
+and s0 s2 s4
+slt t5 s4 a1
+sltu t3 t5 s11
+andi a0 t2 537
+sll t4 s0 s7
+sra a0 x0 a0
+and s3 a1 a4
+xori s8 s6 -1442
+add t6 a7 t2
+rem t6 a0 s9
+srli t4 gp 25
+divu s10 t5 s6
+lui s0 801145
+sub t3 a5 a2
+and tp s0 s4
+andi s2 s9 -975
+sub tp s1 s7
+ori s1 t0 53
+sltiu t6 s1 1546
+sub s9 a2 a6
+srli s2 t0 30
+and s11 s4 t6
+srai a2 s8 23
+sub s5 a5 a3
+srli a4 s11 6
+div a4 gp s1
+srl t2 s10 t0
+mulhu s8 x0 a0
+andi s0 t0 -277
+div a4 a2 t2
+sltu x0 t5 s9
+auipc s5 566556
+mulh s9 s0 t1
+rem t3 s11 s0
+sltiu a0 s8 165
+auipc s8 433718
+andi s9 a4 -1551
+sra s7 a1 t2
+auipc t5 608208
+ori a6 x0 -822
+srl x0 s9 a6
+sltiu s4 a0 1824
+or s2 s9 s4
+and a0 a5 tp
+sltiu t4 s0 880
+mulhsu t0 a2 t1
+slli t0 x0 11
+rem s8 s5 a5
+sltiu a4 s9 -577
+mulhsu t2 a6 x0
+div a6 ra a7
+slli x0 s9 6
+andi s5 s7 -8
+sltiu s5 s7 127
+and s9 a5 s0
+srli gp t6 28
+lui t1 501390
+xori a0 tp -1345
+xor a2 ra x0
+xori s0 t0 22
+div s1 a1 a4
+lui s11 873513
+ori s6 s7 -950
+andi a1 a0 1969
+srli ra s8 13
+sltu s4 t4 s8
+sub s9 s9 s5
+and s8 a1 s0
+or t4 s1 t1
+or s11 s4 s0
+and s0 s11 s4
+sra s11 x0 a4
+rem s7 a4 t6
+remu a0 gp t0
+lui a5 737284
+ori a7 s4 -490
+mulhu s0 s8 a4
+srai a2 ra 10
+mulh s7 s10 s2
+xor s5 s0 s9
+mulhu s11 a0 a6
+slli s4 a2 12
+srli t5 a7 9
+srli a2 s10 25
+divu s1 s1 s0
+sra s2 tp t4
+srl t0 t4 a7
+mul t1 a7 s4
+rem s2 a7 s1
+auipc t0 853624
+mul s8 a1 s11
+slti s11 a0 1015
+rem t2 s1 a5
+divu s5 t6 t0
+remu t6 s1 s6
+slti a7 t2 -888
+lui s11 892343
+andi s7 a1 -950
+slli a5 a4 11
+xor t0 t0 a0
+xor t3 a1 t6
+ori s10 s0 -1912
+srl gp t2 s6
+sub a7 tp gp
+and t1 s3 t4
+xor t0 a7 tp
+auipc a1 717179
+sll s5 a6 t0
+mulh t3 a4 s5
+sltiu t3 s8 -1166
+sll s6 s7 s9
+srli a4 s6 12
+div s3 s10 s0
+slli s1 a3 0
+remu t5 s9 a0
+div s11 a7 t5
+lui t4 689707
+sll a6 s10 s3
+ori tp a5 -284
+srai s10 t6 9
+or x0 t1 a4
+ori t3 s3 -1258
+xori s5 a4 -1096
+srli a2 s4 21
+srl s8 t0 a7
+mulhsu gp t4 a6
+slli s7 a2 19
+divu tp a4 ra
+rem t4 a6 tp
+sltu a6 t1 t2
+ori s2 s2 -1190
+andi a1 s6 -348
+sltiu x0 s0 -71
+auipc a5 1029478
+slti s1 a7 1691
+mulhu s5 s4 t6
+xori s7 s3 -216
+ori s4 t0 789
+or s0 s11 a1
+srli x0 s2 19
+xori s4 a1 -829
+slli t2 s8 12
+add tp s3 s7
+andi s8 s4 929
+sub t5 a5 t0
+sll s0 t0 s3
+slli a2 a7 31
+mul gp s10 t1
+div s3 gp s0
+sll a2 a0 s8
+lui a6 823542
+sra s8 a7 a3
+mulhu a4 s7 s10
+divu x0 s7 a3
+slti t3 t6 -904
+slti a4 a5 -946
+srli ra s1 30
+mulhsu a4 s10 a5
+divu a7 s5 s5
+andi t2 a6 -1704
+sll t4 a2 s2
+addi s9 x0 -700
+sra a7 a4 t5
+srai t4 s0 28
+rem x0 t6 a6
+ori s6 a0 1025
+remu a7 s3 t2
+div ra gp t3
+mulhsu a0 t1 s9
+mul s4 ra t4
+xor t0 s11 a2
 srl t3 s6 t0
-sra x0 s6 t5
-sltiu x0 s1 -660
-and ra s3 tp
-auipc t5 1012605
-addi s11 a1 -60
-mulhsu t5 a7 ra
-andi a2 s9 -12
-remu t2 t1 s5
-xori a0 x0 -1281
-sra a5 s7 s5
-sub a5 a2 s10
-div a6 t5 s11
-mulh t6 x0 s9
-slt s5 a5 s7
-rem s2 s6 ra
-slli a7 t6 12
-mul tp t5 t0
-rem s2 t4 tp
-div ra x0 a5
-or s11 tp a3
-mulhsu a7 t0 x0
-sll tp s1 x0
-mulh x0 ra t1
-auipc s0 120892
-auipc a2 748093
-lui a7 836424
-mulhu s1 a3 s3
-addi t6 x0 -1922
-and t0 s9 s8
-div t4 a0 ra
-srli s7 a2 31
-sltiu x0 t0 -1251
-slti gp a4 498
-xori a7 s5 -1449
-rem t0 s10 a5
-mulh s5 s7 s6
-add a7 a4 s10
-srai s5 s5 2
-andi s2 a1 -1376
-srli a4 a1 15
-auipc t1 556649
-div x0 s8 s8
-lui a1 158350
-srl a3 t2 a3
-xori x0 x0 -1863
-mulhsu s6 a6 x0
-mul a0 s7 s1
-mulhsu a1 t4 a5
-addi s10 x0 -405
-slt s0 t0 t3
-slti s10 gp -1841
-addi a4 a7 1553
-slli s5 s4 3
-ori s9 s5 -233
-sltiu a2 tp -1248
-lui s6 79780
-srli a4 a4 17
-sltu a5 s8 t3
-xor a7 a1 s7
-ori s3 t3 1018
-srai s1 t2 2
-mul t0 a6 s10
-slti a2 a7 72
-remu t3 gp a4
-ori t5 s8 934
-mul s9 s4 x0
-ori s6 s8 1802
-srli s4 t5 2
-sub a6 t0 ra
-xor t2 a0 s0
-or s11 ra tp
-sltiu x0 x0 -785
-and a4 a1 a2
-srli gp t6 6
-sll a7 t2 a0
-and s8 tp a4
-sra a7 t2 s5
-addi s5 t5 -337
-addi t5 gp -759
-srai tp s11 13
-addi x0 s1 -1973
-srl tp s3 s6
-and x0 a5 s10
-divu x0 ra s3
-mulhu t0 a6 s4
-ori t6 s10 585
-or s3 a7 s6
-xor x0 a4 s2
-add t4 a4 t6
-and a6 t1 s4
-add s9 x0 s11
-auipc a1 930059
-addi a3 t2 -1656
-lui a1 350688
-add t6 t2 s1
-mul x0 a2 t0
-srl a4 s0 t4
-xor a2 s8 a5
-div s1 a4 ra
-add s6 t5 a7
-sltiu s4 gp 1092
-auipc t6 362959
-andi s7 s9 -1694
-remu s8 s11 s3
-rem s5 t1 s1
-sub t6 s4 s10
-add t3 x0 t3
-mulhsu gp s7 s11
-auipc tp 839731
-lui t3 169686
-sll t0 a1 a0
-ori t6 t2 1222
-mulhsu s0 a2 s11
-mulh t0 a7 s2
-slt a4 s8 s10
-slt tp t4 tp
-sll s7 x0 s6
-srai x0 t3 23
-slt a6 s6 s0
-mulh a0 a3 s3
-or t3 s0 a5
-ori a3 s4 -1201
-xori a3 s7 -1258
-mulhsu ra s8 s9
-sltu a2 t6 s3
-mul t4 t3 a7
-remu t0 t4 s8
-mul s9 t3 t6
-sub gp ra t1
-sltiu gp gp -420
-div t0 gp t4
-sll t0 s3 t1
-slti a0 a3 -1624
-sub gp s0 s8
-xor s4 s1 s8
-rem a1 a0 t2
-remu s8 t1 a6
-sltu a1 a4 x0
-slti a3 a4 1767
-rem s3 s9 gp
-slt s10 s6 gp
-srl a3 a7 t1
-srl a6 t5 s7
-lui a7 55557
-or a6 s0 s10
-divu t0 s10 s1
-rem a6 a6 t6
-sltu a6 s7 t5
-slti t2 a6 -813
-mulh s0 a0 a7
-slli a3 t6 2
-slli t0 s6 25
-slli s0 a2 12
-mulh a6 s4 x0
-andi s10 a7 -688
-slt a6 a5 s5
-srl x0 a0 x0
-remu a1 x0 x0
-srli s11 a7 8
-mulhu s0 a3 t2
-mulh t4 t1 a1
-auipc a6 660788
-remu t5 s1 tp
-mulh s1 a2 t2
-lui s8 714535
-and a4 a6 s5
-mul s10 x0 s8
-lui a2 71280
-xor s11 t3 a7
-slt a2 a5 s4
-xor x0 s2 tp
-addi s2 t0 -438
-slli a3 gp 7
-sra s3 t0 t2
-slt t6 a6 a6
-ori t3 a7 -1762
-ori t0 a6 -745
-rem t5 ra a6
-srl s6 t5 a3
-ori a3 a5 -386
-sra s10 a2 s4
-or t4 tp s6
-add a5 gp a1
-xor x0 x0 t5
-slli a7 s0 27
-sra s5 s4 a7
-mulhsu a4 a2 s11
-sll s10 tp t2
-add a3 a3 a3
-srli s9 s4 8
-srai a7 s1 5
-and s2 a2 a0
-srai t3 s9 19
-lui s7 823399
-sub s3 s10 s1
-andi s5 a0 1701
-xori a1 tp 745
-addi s8 s7 2015
-add a3 s0 t0
-mulh s0 x0 ra
-sll x0 a7 a3
-rem s9 a1 a5
-andi s10 a6 -738
-mulh a0 s5 s6
-xori a7 s1 -89
-div s7 s1 s2
-sltu tp gp s2
-addi s5 s4 783
-slt a1 t5 t1
-divu gp s7 s9
-lui t0 474651
-mulhu a4 a2 a4
-slt s7 s9 a1
-srl a1 s4 x0
-sltu a0 x0 s8
-mulhu tp s8 s9
-xori tp s3 1983
-sll t6 s10 s10
-div ra a6 s11
-sll t0 s11 a7
-xor t2 s7 ra
-mulhsu x0 x0 t4
-or a0 x0 a1
-slli a6 a2 10
-or t4 s1 t6
-and s2 a1 gp
-divu gp ra x0
-slli t0 s2 14
-lui x0 367695
-lui t1 485159
-sltiu s2 ra -1331
-mulh s9 a0 a6
-sra a1 t3 t2
-sltiu s6 a5 31
-add a2 t2 a2
-sltiu s10 s1 252
-slt x0 t3 t6
-mulhsu a3 a2 s10
-mulhu s5 s0 s0
-lui t3 335575
-slti s11 t1 1692
-sltu t2 t2 a1
-mulhsu t2 s10 a0
-mulhsu t4 s1 t3
-srli a4 tp 25
-sll s1 s2 s2
-remu t5 tp s5
-mulhsu s4 a5 s3
-mulh s3 s10 s10
-divu s0 a3 a7
-ori a7 s9 1178
-sltiu a1 t3 305
-div s5 t0 s1
-ori s11 a2 1023
-remu s9 t4 s8
-srai a3 tp 9
-slti a1 t4 -792
-lui a5 38115
-xori t2 s3 -153
-mulhsu t5 s3 ra
-srai s11 s10 20
-sltiu t0 s0 -1781
-srli s7 t4 14
-xor t1 t0 s0
-slli s10 s10 2
-slti t1 t1 802
-auipc a6 467926
-sltu a3 t3 a4
-sltu t0 s0 s0
-sltiu a1 a4 -1393
-andi t4 s11 -66
-andi t3 gp 1845
-srl s7 t3 s7
-srl s9 s11 a3
-xor s9 s10 t1
-slt t5 t0 t5
-lui a4 288171
-or s2 s2 tp
-rem t6 tp t2
-addi s4 s7 1836
-sltiu ra a4 -96
-andi ra x0 -1661
-mulhsu s5 t6 a0
-andi s0 s8 1174
-slt a6 t2 s9
-add t6 s7 gp
-srl x0 s2 s3
-srl s9 s4 s6
-slli a3 a4 12
-add s3 t5 tp
-addi t2 t6 1565
-andi tp s11 1792
-auipc t3 746207
-sltiu a6 a0 1293
-rem t2 a0 a2
-mulhsu t6 x0 s8
-add a7 s8 s1
-addi s6 s5 -1781
-ori a2 t2 147
-srai s7 s4 29
-sltu t4 gp s0
-remu a7 a2 s0
-xor s6 s5 t3
-mul s0 a0 t4
-ori a7 a2 -1864
-mulhsu s1 t5 t3
-mul s1 s0 s11
-srli a6 a2 22
-ori a6 a6 818
-slli t3 x0 13
-divu a5 t4 gp
-srai s5 a6 22
-rem a6 t5 t5
-lui s4 923365
-mul s3 t2 s0
-auipc s4 555252
-div s2 a7 t3
-sll t6 s8 x0
-srli s8 t4 8
-mulhsu s10 t0 s9
-divu a5 t5 a5
-andi a6 t6 -1724
-srai t0 s9 6
-slt s8 t5 a6
-mulhu s0 s2 a5
-sll s4 t5 s8
-or a1 t3 a6
-andi s4 a6 780
-div t6 x0 t4
-add t0 s7 a1
-remu s4 s7 s6
-slti t4 s4 1668
-sll t3 s6 t2
-sll tp t4 s3
-slt a1 a0 t1
-lui s9 793323
-rem s11 s1 t2
-divu a6 s1 a1
-sltiu a1 a2 1829
-or s7 t0 x0
-auipc s4 493959
-lui t2 502747
-srli t4 ra 10
-or t5 t2 a6
-sltu s1 tp a5
-sltu s9 a6 s10
-sll s1 t0 a6
-and s10 a3 s10
-addi s2 s1 -849
-mulhu s3 gp t4
-xori s6 s7 1781
-and s1 t6 s7
-or s10 s1 s5
-xori s3 s9 -1400
-div a4 a0 tp
-sll ra t2 s6
-divu s2 s8 a3
-mul a2 ra a6
-ori a0 x0 -1968
-sltiu s7 s1 -137
-remu t5 a5 x0
-lui s10 620866
-srli t0 s8 13
-sltu s10 x0 x0
-add t3 ra a5
-srli a6 t3 14
-auipc s5 735223
-sltu s4 a0 a0
-div t3 t3 s6
-remu t2 a1 a6
-mulh s0 t5 s2
-xor a5 t5 s8
-slti s9 s1 -1340
-or s3 x0 t1
-slt tp s5 t3
-xori s1 a4 -728
-sltiu t5 t4 -1532
-div s2 t0 t5
-xori s10 ra 1794
-srli t1 s11 13
-mul a5 a2 s11
-andi x0 s2 -1465
-mul a5 s6 t5
-slt t0 s0 a5
-add t6 x0 t3
-remu t5 s6 tp
-div ra s7 s10
-slti ra s5 -1533
-divu t6 a2 x0
-lui t4 355099
-remu s0 t3 tp
-and a2 a7 s0
-lui t1 162473
-slt a0 a2 a0
-divu s8 a0 ra
-mulh a7 t3 s10
-auipc s2 419249
-slti x0 s0 -1402
-mulhsu s10 ra t4
-sltiu s3 a4 -1342
-or gp a3 a5
-sltiu s2 s3 -1459
-slli t3 a3 14
-srai tp x0 9
-mulhu a7 s3 s1
-lui x0 202283
-srl s8 gp s10
-slli a3 gp 17
-sub s11 s3 a7
-xori s9 a3 -991
-mulh t2 a5 t1
-xor x0 ra s4
-mulhsu t2 a5 t3
-addi a4 a5 -1553
-sll a4 t3 t4
-xor s7 t6 tp
-andi s6 t2 -1154
-srai a0 a0 12
-or s1 s9 s9
-sltiu s4 ra -418
-slti a7 gp 1042
-sll tp s10 s9
-mulh s5 s0 a0
-sltiu a2 a7 -1450
-ori a7 a7 -733
-mulhu tp tp s7
-addi s3 x0 -1203
-ori s10 s5 -151
-andi a5 s0 -511
-rem a4 t1 tp
-srai a3 t0 28
-lui t6 46891
-remu s4 tp t5
-and ra t4 t0
-andi s11 s10 -433
-srai t0 s10 17
-div a3 x0 t1
-add a6 a0 x0
-div a5 s5 s9
-xor tp s10 a5
-rem s7 x0 a2
-slti t4 s3 -1266
-mulh a2 t2 tp
-mulhsu t5 s0 s3
-and s11 x0 a0
-addi x0 a7 -365
-lui t1 509008
-addi a0 a5 118
-sltiu s9 t2 -308
-add a1 s2 gp
-mulh a0 gp a7
-divu t6 s6 s6
-sra s9 s1 s7
-or x0 a7 a5
-sltu s9 t5 s11
-mulh a1 a2 s6
-sra gp s11 t6
-sll a7 t3 a2
-lui tp 788267
-xori t5 s5 -1121
-srl s8 t2 t6
-xor a1 t1 a0
-lui t3 13424
-mulh s2 a1 s7
-mulhu s1 t2 a7
-mulh a2 ra s6
-sra s2 a4 t2
-mulhsu t1 s6 s1
-slt s7 s11 s2
-slt s4 x0 s7
-add a4 t1 a6
-add s6 a3 t3
-sub gp a3 s1
-div s8 t6 a5
-ori a1 tp -1959
-lui tp 517453
-divu gp a0 t3
-srl t5 t6 s8
-rem x0 a2 t0
-mulhsu s3 t2 s7
-sra a7 s8 t6
-mulhu a6 a5 a1
-sltu s11 a4 x0
-xori s7 ra -1037
-srl s8 a6 a0
-sra tp x0 a7
-lui t0 542748
-andi a7 s11 689
-divu t2 gp tp
-addi ra s5 1765
-remu s3 s11 s0
-sra s9 s7 s10
-lui s5 341395
-slt t6 t5 s10
-sra t1 s9 t6
-lui a0 602521
-slt a6 a1 s9
-sll ra x0 s8
-and t6 a7 t1
-slti tp s11 -478
-sltu s5 t4 a1
-mulhu a5 a4 s10
-srai ra t5 0
-srl t5 t1 s0
-srai s10 a3 13
-andi x0 a2 -152
-lui a1 788836
-add t1 s9 s8
-slt s7 s1 s9
-xor s7 s8 ra
-sltiu gp t1 1729
-srli s10 t3 29
-add a2 a2 t0
-addi t5 s2 731
-divu t0 s7 s4
-sltiu s2 tp -666
-mulh s6 a2 s5
-divu t4 x0 s2
-andi gp gp 1652
-or a7 x0 s8
-div t3 a4 s5
-divu s10 s0 a2
-div a2 s11 s3
-add a1 s9 t4
-remu s4 s3 a7
-or a0 a6 t2
-slt s0 s8 a7
-lui t1 362782
-divu t0 a6 t3
-sll s9 a7 a5
-ori s1 a5 989
-addi s8 a2 -635
-lui s1 490935
-lui t4 725438
-mulh a3 s0 s4
-lui ra 520122
-mulh a3 a0 a4
-ori a3 s4 -1187
-mulhu t3 s0 t2
-rem a0 s4 a2
-or a6 s10 s6
-and gp x0 a2
-slli s9 a2 13
-andi x0 a6 -1197
-mulh ra gp s0
-ori s10 s3 1222
-sll a5 s10 x0
-sub s4 a1 a4
-rem a0 s2 s4
-slti s7 t6 303
-divu s10 s8 t5
-remu s3 t6 s0
-auipc s1 814462
-mulh t3 t5 s5
-lui t3 359500
-mulh gp s2 s9
-div s5 a2 t6
-srai s4 t5 26
-add gp s6 s11
-add a0 a5 s8
-mulhsu t4 t6 s8
-rem a0 s4 x0
-mulhu s10 s6 t2
-srli s0 a5 10
-slli s3 s7 5
-xor s3 s8 a6
-sub a4 t0 t0
-xori s7 s1 -1903
-xori t4 s8 -522
-div t0 s10 s10
-andi s10 t1 830
-divu s11 t0 t1
-srl t1 t5 s5
-srai a4 gp 8
-sra ra s2 tp
-xor gp a5 t1
-slti t5 s5 -1504
-rem s3 a3 t6
-lui a6 13699
-andi a2 ra -1010
-div s10 t1 t5
-srli s10 s9 2
-sll x0 s0 s1
-xor s6 a2 a5
-auipc ra 180552
-xor s0 a7 x0
-sub x0 t3 s3
-sub s2 s6 a5
-mulh s2 x0 a5
-srl a7 s11 a7
-xori a0 a7 -168
-slli a6 x0 24
-lui a4 404243
-slti t6 s1 -1132
-divu s6 a3 t6
-srl t6 t6 t5
-div t6 s1 a0
-sub a5 s2 s7
-addi t1 t0 -1393
-srai s7 t6 14
-sra t4 x0 a7
-mul s9 s11 a5
-srl a7 a3 s5
-xor a0 x0 a0
-lui t5 698075
-sra t2 tp a6
-slt a4 ra x0
-sra a3 s10 t3
-auipc s8 46646
-rem gp s0 t5
-srl s10 x0 t6
-and s11 s8 t2
-auipc s10 146168
-slti tp t3 -183
-xori s2 s7 -1294
-ori a0 tp -669
-slli t3 a7 26
-divu t2 t3 t0
-and t0 tp s2
-srai gp a6 11
-div t6 t1 a1
-lui a1 49685
-addi t1 tp -941
-ori a7 tp -384
-srli s0 s6 7
-mulh s7 x0 t2
-sltiu a3 s0 -1466
-mulhsu s8 tp s5
-sltu t5 x0 gp
-srli s6 a0 20
-sltu t1 t5 t5
-sltiu s5 a1 -1826
-add t3 s9 s1
-mulhu t6 a7 a1
-mulhsu tp x0 tp
-divu t3 a2 tp
-mulhu s3 s0 s10
-or t5 tp tp
-slli s5 s5 30
-div s9 s10 s11
-slli a4 s9 6
-or a4 t4 a4
-srl s2 s2 t5
-slt t0 s1 ra
-or x0 x0 gp
-srli s0 s10 6
-sub s7 s4 s10
-auipc s10 368094
-mul s2 t2 ra
-remu t1 a7 s4
-slt s1 t0 a1
-rem t6 s0 a4
-sltu t0 s11 s2
-div t4 s5 s1
-sll a4 tp a0
-xor s4 t4 a3
-sltiu s1 x0 -264
-slli s3 s0 12
-ori t2 t3 548
-slti t5 t2 -504
-divu s1 t4 a6
-xori s8 a5 -702
-sll a3 tp t5
-srli s7 s11 9
-add t6 ra a2
-andi t5 ra 199
-srai t1 s2 19
-or x0 t3 a4
-or a5 t5 s5
-xor x0 s9 t0
-or x0 t4 s8
-add s1 t5 s8
-slt s4 a7 t3
-xor a1 ra a3
-mulhu a2 s7 t0
-sub a4 a2 s3
-and a7 x0 t0
-sltu a0 s2 s11
-sra s3 a2 ra
-div s8 s6 s9
-srli t6 t2 16
-mulhu s9 t5 s11
-andi s5 s9 -1425
-sra s5 a6 x0
-xor s0 s5 s10
-or s1 tp a7
-sltu tp a1 s6
-auipc t5 365654
-rem a5 s6 x0
-srli s9 s6 13
-sll gp x0 s7
-remu s0 t1 t4
-lui s6 694719
-sra x0 s0 s0
-srai a1 t4 25
-mulhu s7 s4 t5
-srli t4 t5 19
-andi t1 a6 -1784
-lui s11 252687
-auipc s4 765864
-div gp s5 s3
-and s3 t6 s7
-or gp x0 s9
-sub t6 a5 gp
-remu a1 s5 t5
-sra s9 s7 s5
-sub gp s8 t5
-remu x0 a4 t1
-mulhu s1 s2 s7
-add a7 t0 s10
-mulhu s3 a5 s2
-sra t1 a5 tp
-auipc t5 439443
-div a0 s0 s7
-addi s7 s4 -1252
-remu a2 a1 s7
-sub a7 ra t3
-sub a3 s9 ra
-srai s5 t5 23
-slli a5 s6 10
-addi s11 t6 -1117
-mul gp s7 gp
-auipc a4 301522
-slli s2 a6 15
-add a6 a7 s11
-sltiu t2 s10 -1127
-sltiu a5 s3 -727
-sltiu gp tp -1269
-slti s8 t1 -1257
-ori x0 s6 1630
-srl gp a3 a3
-sra a7 t4 s4
-srl s11 t3 s5
-sub a2 a6 s8
-auipc t3 436410
-xori t4 a2 429
-sltiu x0 t5 -1133
-ori ra t2 489
-div a0 s0 s4
-divu t0 x0 s11
-and s8 s4 t1
-srli x0 t4 4
-slti s6 x0 -539
-xor s1 a6 a6
-or s8 s6 a3
-divu s4 a3 ra
-and s11 t4 a5
-or s11 a6 x0
-srai x0 s6 19
-add s8 s0 t2
-andi s2 t4 -1595
-srl s1 t2 a6
-rem t2 a5 tp
-andi a6 t2 -1984
-rem s9 s11 a0
-auipc a4 296809
-srli t1 a2 0
-auipc t6 934565
-auipc s6 101848
-sll a5 a6 s7
-and t5 s0 t1
-srai s3 a4 2
-sub a4 x0 a3
-mul a5 s3 t5
-mulhu s1 a0 s0
-div t2 s1 a2
-xori a0 t3 1160
-remu s3 s1 t2
-sltu s11 gp tp
-sltu t5 a4 s10
-and ra a2 x0
-sra a2 t4 s8
-add s10 t6 t5
-srli a3 s1 16
-div t5 s3 t0
-and a6 s2 a7
-mul a1 s5 gp
-sra a0 a2 s8
-sltiu s1 t0 -1916
-slli x0 s0 30
-sra s3 a0 t3
-sra s1 a7 a1
-slti t5 s0 -1605
-xor s5 t4 s2
-andi a5 tp 942
-andi ra s8 -61
-div s1 a6 s2
-sltiu t3 s9 -1931
-sltiu s11 s7 -514
-rem s6 x0 a4
-xor a5 s5 a7
-lui t0 68959
-mulhu a1 a7 ra
-mulhsu s5 s2 a1
-auipc a2 508677
-sltu s11 t2 s4
+auipc a6 568178
+addi a4 tp -1409
+sra t6 x0 s7
+rem a7 s5 s11
+sra a0 s10 x0
+mulhsu a4 t1 tp
+divu s4 a6 s4
+and s0 s7 a0
+addi a4 a1 -193
+sll tp s2 s6
+sub t1 s8 s5
+addi a2 s7 -1764
+slt s0 s3 t5
+add a3 a5 a7
+remu s9 t2 a6
+lui a4 279996
+lui t4 183481
+slti a3 a0 -426
+srl s2 t6 a7
+andi t4 a5 -1150
+and t0 s11 x0
+and a1 t3 t6
+rem a7 s6 ra
+slt t2 a1 s1
+or a5 gp a4
+andi s5 s7 -773
+ori a5 x0 -57
+srai a1 s1 9
+lui s9 817671
+or a4 t5 a3
+xor a7 ra s10
+lui a3 436536
+slti ra gp 1724
+sll t0 t4 t1
+slli s1 a4 15
+mul a6 t3 s0
+sub s7 t5 s4
+and s1 a6 a5
+or s10 t1 a2
+srl s0 s6 t0
+rem tp s4 t4
+xori s7 ra -381
+divu s7 s3 a2
+mulhu t2 s2 t5
+srli a1 s8 0
+sub s8 s8 s4
+mulh a0 x0 s5
+sub s3 a5 s1
+srli t6 s4 18
+sll s6 t6 s11
+xori a3 tp -1096
+mul a4 s5 s7
+sra t4 s0 s10
+sltu gp t0 a0
+or a6 s1 a3
+sll tp s2 ra
+divu a2 t3 a5
+sub s10 t2 s3
+srai ra t6 0
+or t2 s8 a6
+sltiu t2 s5 1891
+auipc t5 614352
+div t3 s10 s1
+rem x0 t1 s8
+mul a6 s0 x0
+and gp s2 t5
+auipc t1 883552
+mulhu a4 s0 a1
+rem tp a4 t3
+remu a5 t3 a7
+andi a2 a6 1162
+slt t6 s1 gp
+slt a4 a2 s4
+divu a7 s6 gp
+andi s8 a4 -494
+mulhsu s9 a7 t4
+slti s9 ra -374
+auipc s6 529469
+sub t3 s9 s2
+ori s5 a3 1964
+sltiu a7 t0 -984
+sra x0 s8 s0
+addi t6 t3 -172
+xor s9 t3 t2
+and s3 s6 a3
+sll s1 s10 s0
+div s8 gp s0
+mulhu tp s11 a0
+or a2 a7 s9
+remu s4 a2 t5
+andi s9 s3 357
+srl a0 a6 t2
+or tp gp a3
+ori s1 a2 -118
+slli t4 s1 31
+rem s2 ra s0
+slli t1 gp 17
+mul a2 a6 t6
+slli t2 a6 15
+sra s8 s6 s2
+auipc s1 508313
+srl s0 s10 a1
+div s8 s8 a0
+addi t1 t1 -1380
+lui t6 593697
+divu s11 a2 s2
+rem t3 s11 gp
+mul s4 s7 x0
+addi a3 s2 1758
+add s7 s10 a5
+mulh a1 t2 s7
+divu s1 s3 a1
+mulhsu a3 s6 a2
+rem a7 tp s6
+mulhsu s2 t6 t4
+lui s7 383971
+divu a7 t1 s4
+sra t6 s1 s7
+remu a0 s10 s6
+sltu s7 a2 t4
+or s5 a7 a1
+srl s3 s6 a3
+srai t1 t1 4
+mulhsu t1 a1 a1
+sra s5 s3 ra
+mulhsu ra s6 a7
+srl s8 s5 t2
+mulh t2 s3 a3
+remu a1 s4 s6
+xori tp tp -384
+xor s2 s2 t6
+addi s2 a4 1908
+ori s0 a4 740
+sra s8 s11 a4
+addi t0 s2 -42
+mulh s2 s3 a2
+sub s0 s11 t3
+sll s10 a1 tp
+slti s5 a2 81
+andi s8 a4 -834
+slt s11 x0 s10
+sltiu a7 t2 -2041
+or a3 s6 s1
+sltu s10 a7 s11
+mul s9 a4 a4
+auipc s10 362376
+srl gp t0 a7
+andi t2 gp -1869
+addi s4 s5 1786
+mulhsu s11 s2 a3
+addi a6 t1 -632
+slt s7 a1 a1
+sub s5 s9 s6
+sll s9 a3 s6
+rem t5 s8 x0
+auipc s7 47043
+and a2 ra s7
+mulhsu t5 a5 t6
+and a7 t4 t6
+sltu s8 tp s2
+andi s5 a3 -1039
+ori t5 x0 -1742
+sltiu s8 s9 2024
+lui s5 420589
+and a3 gp s9
+slli x0 s0 6
+remu a7 s4 x0
+add s2 s6 t2
+sub t0 s5 tp
+div t4 s6 s1
+srli s4 t0 17
+xor t2 gp x0
+andi a2 s9 1472
+srli x0 t1 4
+srai s4 s11 15
+divu a4 s3 x0
+slti s6 x0 1058
+sub s5 a7 a0
+addi s10 s6 1135
+sra s7 gp a0
+add s0 t2 s4
+slli a6 t4 25
+sltu s4 s5 s11
+mulhu t1 t0 s9
+mulhsu s11 s9 a6
+sub t6 a7 t3
+sub a3 s1 s3
+sltu s4 t5 s4
+xori tp a3 -1776
+divu s4 t3 t1
+andi tp s8 -1266
+or s10 a7 a7
+ori s3 t0 -48
+sltiu a6 s5 -174
+andi a6 t2 -920
+sll s11 a5 s10
+ori a7 s9 -1562
+slli t0 s4 24
+mul s7 a2 x0
+remu s9 t0 a0
+slti t2 s5 -1910
+remu s0 s7 tp
+sub a5 a5 ra
+sra s9 a2 a0
+divu gp s11 s6
+srai s2 s4 2
+sltiu ra a1 -1731
+ori s9 s9 -506
+sltu t0 s1 s8
+andi t4 t1 -945
+rem s6 a1 a0
+divu a3 t5 s3
+srli t3 s0 1
+sll a1 s2 s1
+sltu a7 s1 t0
+sltiu s4 s10 -1794
+sll s0 a7 a1
+mulhu a3 t4 a1
+divu s4 s9 t2
+mulh x0 gp ra
+srli s3 ra 15
+srl s6 ra s9
+div a1 t0 t3
+ori a3 s0 1177
+sra ra x0 ra
+auipc s1 314713
+and s1 t0 s7
+add x0 t4 a1
+lui s10 303000
+lui s8 376314
+lui s4 168618
+srl ra t1 s11
+addi a0 s6 -1793
+sltu a0 a7 s4
+slti a3 gp 599
+or s9 a3 gp
+sub a6 s6 t3
+srl s1 ra ra
+mulhsu s3 a3 s6
+and s3 a6 t0
+mul t6 s7 t1
+slti s0 ra -1628
+sltiu t6 s3 2
+div a3 a5 ra
+add s4 s5 s11
+sltiu t0 s4 -843
+or s2 t0 s1
+mul s4 s3 s7
+sra s6 t4 a2
+addi a5 ra 1065
+div s5 s10 gp
+lui t3 630011
+sll t6 s1 s5
+andi s3 a0 -1804
+mulhsu a2 t3 a2
+or a3 t1 t4
+mulhsu s4 s6 a4
+slti t2 x0 -834
+sltiu s6 s0 30
+sltiu ra s4 -774
+rem s0 t3 s3
+and s2 t6 t6
+add tp s11 gp
+remu a2 s2 s2
+div s7 a4 tp
+slli t0 s5 5
+sub s6 s4 s9
+xori a6 s6 -880
+sll ra gp a1
+mul a1 x0 a1
+srl t0 gp gp
+addi a6 tp 1324
+mulh a4 gp s0
+and t3 s5 s8
+auipc s0 668181
 xor t4 t5 t3
-or t4 t0 a5
-addi a0 ra -1158
-div x0 t1 s9
-slti s9 t4 240
-sra t1 s6 s8
-srl x0 a4 s8
-div tp s11 s7
-sub s10 gp t2
-sll a5 ra s2
-srai t2 tp 2
-mulhu s2 s10 a5
-mul s0 s5 a3
-or s3 s9 t1
-slli s4 s7 24
-mulhsu s8 s8 a4
-add tp s4 t3
-sub a4 s0 s10
-addi s0 t0 -2013
-andi s7 a1 -1748
-andi s5 x0 -1624
-mulhu a1 a3 t6
-ori ra s6 845
-slt ra t2 s6
-slt s1 a0 t2
-or a6 ra t5
-ori t4 s4 -704
-and x0 t6 a1
-xor a5 s10 tp
-srl t4 t1 t5
-or s10 s1 t0
-sltu t0 t1 t3
-srl t2 s0 s4
-andi s11 a4 466
-sltu t0 a6 t6
-slli a5 s3 20
-sra tp a2 ra
-xor a4 x0 a1
-or gp s3 a0
-srli a5 s6 27
-remu s10 s5 s6
-xor tp t3 s2
-mul x0 t6 s1
-rem a7 t1 s4
-divu gp s6 s7
-sra s6 t6 s3
-mulh x0 a1 a4
-lui t3 915968
-addi a2 ra -1603
-or s9 s6 a2
-div gp t3 s11
-addi s2 ra -337
-mulhsu x0 s0 s2
-sub s11 s2 a7
-sra t0 s1 t1
-mulhsu a7 a5 gp
-xori tp a5 1406
-sub s1 s2 a4
-divu a2 a5 ra
-andi t0 a5 -1348
-sltu a6 tp a6
-slti s9 a2 1235
-addi a1 a7 -779
-divu t5 t6 a7
-mulh a3 s5 a7
-auipc a3 509206
-divu t4 ra tp
-sltu s8 ra t6
-lui t5 121425
-srl gp tp gp
-slt s8 x0 t0
-mul a2 s7 s5
-xor a7 a7 s10
-slt t2 s3 s2
-auipc a7 865364
-mulhu s9 t3 a6
-or a2 t6 s4
-ori a2 t0 1311
-add s10 s4 a6
-div x0 t5 s11
-sltu a0 a0 t3
-xori s4 s3 -1482
-sltiu a2 s4 -1266
-mul x0 a2 x0
-slli tp a0 28
-srai s10 x0 23
-lui t3 853080
-slt a5 s9 s1
-srl t6 tp x0
-add t4 s1 s0
-auipc s9 40883
-mulh t4 a0 tp
-divu s4 s4 a3
-auipc t6 123396
-mulhsu a4 a6 s4
-sll s8 s9 s10
-slti ra s7 1920
-xor t0 s5 s7
-add gp s3 a0
-divu t4 a4 t6
-srl s8 a1 s6
-sltiu t5 t4 -1726
-rem t1 a6 s4
-xori t1 s1 -1396
-or s6 s11 t6
-addi t6 a7 -1193
-rem s2 x0 a7
-slt t1 s8 t3
-slti ra t4 1525
-ori s0 s3 -1334
-and ra a6 s4
-srai tp s2 26
-addi t6 s3 -621
-slli s11 s11 16
-divu t6 s2 s2
-slti s9 s9 -1521
-sll t2 a3 t0
-rem s2 s3 x0
-srl s5 t3 s2
-auipc s7 264268
-xor a0 x0 a5
-srai a1 a3 22
-remu tp a4 s3
-div a2 s5 x0
-srl s10 s5 t2
-mul s0 s4 x0
-add t3 t1 a0
-mulh ra s7 x0
-srai ra s3 0
-and s3 s10 x0
-sra a4 s9 s0
-xor s1 a7 t4
-srli tp s6 15
-remu x0 a6 s1
-remu a6 s8 s1
-sltiu a6 t3 -1139
-mulhu tp s7 s4
-and s11 s2 a2
-divu gp t4 a1
-sltu s6 a5 a5
-div t1 s2 t0
-slt t6 s0 x0
-srl t4 tp a3
-sltiu a4 a4 -1523
-auipc s2 39907
-slli s10 s2 24
-srai s8 t6 4
-remu s9 t2 tp
-sub s2 s11 x0
-srl a6 s9 t0
-mulhu t4 a0 s3
-rem t2 t0 s8
-div x0 s5 s11
-srli s1 a7 20
-mulhu s9 a7 ra
-mulhu s3 t3 tp
-mul ra s1 x0
-sltu s6 s6 ra
-divu x0 a0 t3
-slti gp s7 -1768
-remu s1 x0 s5
-and t3 s8 s7
-mulhsu t3 a5 a5
-mulh t2 a7 s1
-sra s3 s1 t5
-add s4 s3 t2
-remu a0 a7 gp
-auipc a2 542150
-srli x0 a7 27
-ori s7 x0 -1472
-add s8 t5 s0
-or t4 s1 s11
-srai t1 s6 25
-mulhsu tp a5 s1
-xori s8 a2 626
-remu s1 a7 a3
-or a7 a2 a0
-div ra t6 s6
-add s8 t1 t5
-auipc s7 409208
-andi a1 s2 -1702
-auipc gp 532061
-lui s3 1026853
-srli s0 a0 11
-slt a2 s4 s10
-sltiu t5 s0 -369
-slti s4 t4 -1118
-slli s8 t4 23
-xor a6 a1 s9
-sltiu t1 a7 394
-ori s2 s8 -1105
-srl t0 a6 t3
-xori tp t0 1842
-srl s8 tp s8
-sra s4 s9 t5
-slti ra t1 -988
-sra s6 t5 s9
-srli s9 x0 18
-sll a4 s3 t5
-rem s0 s4 s2
-andi a1 s8 -1126
-slli a3 x0 12
-slli a5 s6 10
-mulhsu a3 s9 t1
-andi a1 t5 -1742
-and t0 x0 a2
-ori a7 t6 -836
-and s10 s3 a5
-rem a6 s4 a7
-slt s5 s7 a2
-divu a7 s0 a2
-slli x0 ra 19
-slt s8 gp s2
-or a7 ra a0
-add a4 a4 s5
-xor s8 a6 s1
-add a2 a6 a1
-mulh a4 s11 a2
-divu a0 t4 s5
-add a2 t4 s7
-ori s7 t1 -1769
-add t3 t6 tp
+mul s6 s5 s3
+mulh a0 x0 t4
+sub s1 t4 a3
+xori a7 s9 -1945
+divu s5 s2 a4
+slt s8 s3 a6
+srai t5 s1 1
+addi a4 s8 -1114
+divu s4 s8 s3
+add tp s7 s8
+lui t5 851362
+mulhu s0 ra s4
+sltiu s6 a5 259
+mulh s1 s6 t1
+andi a3 a0 1920
+add t6 t6 s4
+mul s0 s4 t6
+mul t0 a3 t6
+slt s0 tp tp
+sll t5 s8 a7
+mulhsu a7 a7 s4
+slt t4 a0 t0
+mul ra s9 s3
+and gp s1 s9
+add s0 s3 a4
+addi s7 gp -656
+div t5 tp s5
+and t1 s8 t2
+srai s4 s11 9
+slti gp s6 -63
+lui s0 975591
+sll s3 gp s7
+mul a6 gp s5
+mul a5 a6 x0
+sltiu t1 t6 -1173
+addi s10 s11 -585
+srli t6 s8 3
+remu a5 t1 s1
+and a5 s0 t6
+lui t6 998933
+srli t2 a6 28
+sra a0 ra s5
+sll s10 a3 t3
+srli s9 t5 6
+div s2 t2 s4
+add t5 t4 a7
+mulhsu s5 s7 a2
+srl s2 a1 t1
+add s7 a2 s6
+xori t1 a2 -102
+or s6 a1 a1
+srl s9 s11 s3
+addi a2 s9 -1145
+xori a1 s5 1044
+add a6 s6 a6
+remu gp s1 a5
+mul s10 a2 a3
+mul a6 a4 tp
+srl s6 s4 a6
+sub t5 ra t0
+lui tp 166531
+addi a7 s6 1867
+xori t3 a0 -1341
+and s8 s2 tp
+slli s4 s10 23
+auipc x0 857262
+div s2 s2 s5
+or a2 s0 t1
+srl a1 a5 t3
+sltiu a2 t3 -1566
+slli s11 s1 13
+slli s9 x0 20
+mulh s7 t5 gp
+mulh t1 t1 a4
+sltu s6 ra ra
+sub x0 tp tp
+sltu s1 t6 s9
+sltu s11 a3 ra
+auipc gp 122645
+divu s1 a2 t5
+andi t6 t1 -870
+remu gp a4 a5
+ori s3 ra -1982
+andi s7 s10 1324
+andi t0 a5 -702
+xor a3 ra t2
+lui s0 28387
+andi a7 s8 -1767
+sub tp s7 s5
+sll t2 a7 t3
+xor tp s0 a0
+andi t0 s11 -1192
+ori t0 a2 -306
+lui x0 21059
+andi tp tp -1366
+or t2 s8 t5
+rem t0 a0 a4
+addi s7 ra 1035
+ori t0 s10 1960
+remu a0 t6 t4
+mul t0 s11 s1
+ori t5 s0 -1637
+divu t4 s0 a5
+mulh s0 s10 gp
+lui a4 1019257
+sltiu s4 s10 1647
+or a4 s8 t0
+divu a5 a2 t3
+divu gp t1 s10
+slli s2 t0 28
+slt s5 s1 a7
+and s10 a4 s10
+srl a3 s6 t4
+xori a2 a2 -1215
+and t3 a1 s5
+mulhsu a5 ra s4
+sll s3 s1 s11
+slt a7 t6 s2
+xori t0 a5 -781
+mul t5 s1 s9
+slti s7 a4 1394
+slli s5 s0 18
+mulhu s11 a0 s0
+and ra s6 x0
+mulh a4 t1 s9
+mul gp a2 t6
+rem s5 s5 s0
+srli s6 s7 27
+rem ra a6 a0
+sub a1 s8 s7
+ori s0 s10 -227
+or t0 t3 tp
+and t2 s7 t1
+srl a6 s8 a6
+remu s3 s5 s0
+divu tp gp tp
+sub s0 s2 s6
+mulhsu a1 s11 s6
+srai a3 a3 22
+rem s9 s3 a6
+sltiu t0 a4 2027
+slli a4 s8 24
+mul s5 s6 s9
+mulhsu ra x0 t5
+add a0 a4 t3
+xori s2 s2 1583
+srli t3 t0 14
+slli a2 t2 15
+mulh s2 t4 s1
+srli s7 s2 3
+div a7 a2 s5
+srai s8 t0 18
+div s10 s11 s2
+sub t0 s6 s5
+sll tp t6 a6
+slt a7 x0 a5
+sltiu s6 t0 421
+and s5 gp s1
+andi a0 t6 -607
+divu a7 x0 a2
+mulh s7 a6 s10
+xori s5 s3 722
+addi x0 a6 -713
+slli s9 t0 2
+sltu t4 a5 a1
+mulhsu t4 a0 t1
+sll s6 s6 t6
+srli t1 tp 8
+sra s3 s0 a0
+rem s10 s6 a1
+xor a3 a2 s1
+sltu s10 s11 a1
+ori s3 t5 -1763
+sub a2 t5 s5
+sltiu ra s7 1935
+mulh a0 a0 s9
+xori t2 s10 -1328
+slti t2 s10 -1642
+add t1 a0 s4
+mulhsu s5 a5 t6
+auipc s3 67812
+divu tp ra t1
+sll t1 a2 s6
+mulh a1 s9 a2
+ori s11 s6 -1038
+sll s4 t3 a7
+ori t0 ra -504
+sll gp a2 s6
+mulhsu x0 s6 t3
+sll s2 s1 ra
+slti t1 a6 -1820
+xor s5 a1 s10
+srl s11 gp s8
+rem t6 a5 t1
+mulh t3 t4 t0
+addi t4 a2 1437
+mulhu t1 a3 t4
+or x0 gp t6
+sub a2 t3 tp
+srli s1 s0 20
+srai t0 a2 26
+xor t6 s10 t1
+ori s9 tp -1427
+srl a4 s6 s8
+slti a3 s1 581
+auipc t4 480550
+mulh t4 s8 a6
+srl a1 a6 s10
+divu a3 gp t4
+divu x0 t0 a5
+slti t2 t2 -915
+slti s0 t0 -1203
+srli a3 a6 9
+sll t1 s4 t5
+mulhsu s10 a4 t6
+xori s2 a2 1976
+mulhsu gp s2 a2
+div s8 s10 s3
+sltu s7 s9 s9
+mulh s9 t0 a2
+mulh s0 s5 s7
+sra s6 a7 a7
+add t1 a4 ra
+auipc ra 498514
+andi tp t6 -864
+xor s9 s9 t2
+addi t6 ra -1912
+xor x0 s9 a1
+sll s7 a6 t1
+auipc t4 686559
+mulhsu t3 s0 s7
+and s6 s9 s6
+slti ra a3 -965
+slli s6 t4 9
+slt s0 tp s2
+xori a6 s7 -1977
+srl a2 a2 s10
+ori t4 s6 1750
+auipc x0 818867
+and s10 s5 t6
+mulhu s1 s3 x0
+andi s10 s11 -739
+mulhsu s1 s10 s3
+xor s8 ra t0
+and t5 s8 s2
+slt a7 a0 t3
+srai s3 t4 5
+xor t3 s9 s5
+auipc x0 671228
+addi ra t5 -2018
+div s5 t3 ra
+sltu a4 gp tp
+slti a6 t6 1661
+div t3 s9 x0
+slti t2 s4 -1908
+sltiu a7 t6 1550
+lui s5 403791
+rem t1 s9 tp
+mulhsu s0 t4 s10
+sra a3 t3 s0
+sub s3 t3 s3
+lui a2 289818
+srli s8 a5 4
+mulhu s2 s2 s10
+div s5 s6 s1
 sll s2 x0 s7
-sra s5 gp s3
-add t0 a6 a1
-and t3 s7 s10
-sltiu a5 t1 -459
-mulhu s6 s2 a3
-sub t5 t6 ra
-mulh a2 s7 a5
-sub t6 s10 x0
-auipc s8 889123
-xori t4 a0 -912
-divu s1 s3 tp
-sltiu s9 t0 -689
-sra s5 s11 x0
-mulh t3 a3 a3
-div a7 s10 ra
-sra a6 s5 s10
-divu s5 t0 t2
-slli t2 t6 2
-xor x0 a7 a5
-srl t1 s5 s11
-mulhu s7 s4 s8
-sra t5 x0 s9
-rem x0 s11 t2
-addi a7 t4 -1066
-mul t5 a6 s6
-mulhu a7 a5 t3
-sra s1 s6 tp
-div x0 x0 tp
-addi t6 a7 411
-srl s3 t4 gp
-xori x0 s4 472
-remu s7 tp t3
-sltu t3 s3 t1
-slti s8 x0 866
-slli s11 t1 15
-sra t4 s6 t1
-sub tp t1 a0
-mulhsu a6 s1 s7
-divu a1 s2 a3
-xor t2 ra s1
-rem s11 t6 t1
-mulhsu gp a6 a2
-add gp tp a0
-slt s3 tp s9
-or t2 t2 t4
-sll a2 a6 a7
-srai s10 t0 4
-add s8 a6 a0
-rem s9 s0 s8
-mulhu s9 t1 s7
-mulhu gp t4 s9
-sltiu t1 s8 1257
-addi a3 a4 -888
-mul s2 t2 ra
-slt a5 t0 s3
-sltu s1 s7 a6
-auipc s9 683149
-lui s4 257328
-sra a2 t6 s8
-srl x0 t4 s0
-slt gp a5 t3
-div s0 a6 a5
-divu a1 ra s1
-sub s2 gp t4
-sltiu s4 s0 -1613
-srli ra t5 30
-slti s2 s7 1938
-sub x0 s2 t4
-xor s1 a0 a0
-mul t5 x0 s1
-xori s0 x0 278
-xor s7 t1 a6
-mul a5 t6 t0
-sltiu tp a2 1186
-and a0 a1 s0
-sra s7 a3 x0
-srli s2 s7 16
-xor s4 s5 s2
-xor s5 s4 t4
-lui s5 462152
-remu s5 a1 a7
-sub s3 t4 s5
-srai s8 s5 7
-slli t4 a7 13
-slt tp s8 a7
-sltu a5 s3 t0
-sub tp t3 gp
-and a1 s9 s4
-div a3 tp s6
-addi s11 t4 1879
-xori a5 s8 -1722
-rem s3 t4 a6
-srli s4 a2 17
-rem s9 s9 s1
-sll a1 x0 a7
-mulh s4 a7 s0
-andi t0 t2 -1962
-slli s2 s10 30
-slli s3 ra 12
-srli t4 t2 21
-add s0 s7 a2
-addi s9 a3 1988
-sub s11 s9 s3
-srl t1 s6 ra
-lui t6 859052
-div s10 a6 a6
-or t2 x0 s1
-mulhu a7 s11 a7
-mulhsu s10 s8 a4
-srl t4 a1 t4
-xor s10 s8 s1
-add a0 s9 ra
-mulh s2 t4 s3
-and a5 t6 s6
-sll s4 s7 a7
-divu x0 s6 s8
-mulhsu a0 a0 ra
-ori ra s0 -1133
-mulh s10 gp t0
-sltu a7 t1 x0
-mul s4 t2 t0
-andi a0 s0 -917
-and t6 a1 s2
-remu t6 a4 a2
-mulh a1 tp x0
-slti s9 tp -896
-srl s3 t5 ra
-and s4 t6 s2
-addi s3 s9 -752
-rem t2 s3 s9
-slti t0 s2 81
-sltiu gp a0 919
-srli t3 a6 8
-slti a4 s4 1602
-rem a6 t4 a1
-mulhu s10 a1 a6
-sll a4 a1 x0
-mul a3 t2 gp
-slti ra t4 507
-mulhsu a5 a2 s8
-srl t6 gp s1
-rem s7 x0 a6
-mulhsu t6 s0 t6
-slt a2 t2 gp
-add a6 s9 a6
-srl s7 s7 t5
-srli a0 t6 23
-srli s6 s3 18
-srl t6 a4 tp
-mulh s10 s8 s9
-slt a5 gp s11
-divu s7 a2 t3
-lui a4 501554
-mulh s2 s11 ra
-div a1 ra s5
-srli t1 s11 18
-sll s10 s2 s5
-xor t3 x0 t5
-sub t0 s1 t3
-auipc a2 79114
-mulhsu s6 t4 s6
-andi s11 ra -817
-sltiu t6 a5 2044
-remu a3 s8 t3
-lui t4 947212
-mulhu a5 s6 s4
-ori t5 gp 90
-auipc t5 114972
-srl s11 t5 gp
-sltiu gp a5 -2034
-sltu t1 a4 t3
-divu s3 t1 s8
-mulhsu x0 t1 t0
-add s10 a6 t6
-ori a6 a1 1118
-rem a6 t6 s4
-mulhu t0 s6 s11
-srl s1 a7 a5
-mulh s3 a6 t0
-sll t1 a7 a1
-mulh x0 s3 s6
-sra s0 s1 t0
-mulhu a5 a6 s0
-srli s0 a4 10
-div a6 x0 s7
-mulh s9 s3 s11
-mulh a7 t5 s2
-remu s7 a5 tp
-remu a1 s7 tp
-sra s10 t6 t5
-or t1 s7 a7
-sltu s0 s2 a4
-xori s11 s0 -1585
-sll x0 t0 a5
-lui s4 333119
-remu s10 a6 t5
-slt a2 t4 s11
-addi s6 a3 871
-rem t5 a0 s2
-or s2 s8 t0
-divu a4 t1 a6
-srl a3 a0 ra
-mulh s0 ra a3
-sll a1 s8 t3
-remu x0 gp a3
-srli s5 a2 27
-sltiu s4 a7 -640
-rem a4 a3 s2
-and s4 a2 s2
-xori s8 x0 520
-or a6 s9 s5
-srai s10 x0 2
-sra s0 gp a5
-or s2 t0 s7
-remu s8 t1 s2
-slti s8 a0 1429
-rem t0 s9 s5
-or gp s3 a2
-mulhsu s7 x0 t2
-ori s11 ra -1800
-xori s6 s8 -784
-lui a3 1041062
-mul t1 s9 tp
-ori t0 x0 -1150
-sltiu s8 t3 1336
-div a5 x0 a0
-mulhu s9 s4 s3
-or t1 ra a6
-andi s0 a6 -1534
-ori a0 s10 994
-mulhsu t3 s0 s6
-divu tp ra t4
-sltu s5 s6 t3
-addi a1 s1 573
-remu a3 s3 s10
-and a3 a5 a7
-xor a2 a3 s9
-srli ra s7 14
-lui s1 1008184
-sll s4 ra a5
-addi t2 t1 -612
-sra s8 t0 t0
-divu s0 t1 s8
-xor a2 a3 s3
-mulhsu ra s2 s6
-mulhsu t0 t6 a4
-addi t4 s9 -1799
-sltu t1 t5 t3
-srli s6 a5 0
-div s1 a2 s6
-sub gp a1 s8
-sub s2 t2 s5
-srli s1 a4 24
-sll s5 t5 s0
-or ra s3 t6
-slli t3 s6 31
-mulh s10 t2 a7
-add t1 t6 a2
-slt t4 a3 gp
-auipc t3 808081
-add t5 a5 a0
-xor t2 a4 s9
-or s0 t2 a3
-sra a4 ra a0
-divu s0 t1 s11
-div s1 a2 a5
-div t2 s2 s0
-add s4 a6 gp
-andi s6 s10 -1565
-ori gp a0 1406
-mulhsu a0 a2 t4
-srli s0 s1 2
-div a2 t4 t1
-mulhu t6 a0 s0
-srl s1 t0 s8
-sra s11 a1 s0
-xor a6 s2 s3
-remu t1 s1 s3
-sub x0 s7 gp
-xori t6 s4 -1700
-divu s0 ra a0
-xor tp s5 ra
-remu s6 s1 tp
-or a1 a3 t4
-mulh s2 t2 a3
-ori t1 a6 -963
-slt s5 t3 a6
-srli a0 s7 8
-sra a2 s11 a0
-slt a5 s8 s10
-rem s10 t3 a0
-sltiu t2 t3 -1350
-mulh t2 x0 s10
-sltu t2 s10 s2
-mul a4 s7 tp
-sltiu x0 t3 1908
-srl a1 s10 s8
-lui s6 57585
-and a0 s2 a3
-div x0 s9 s10
-ori s4 s10 -491
-and a0 a2 s10
-sltiu a0 s9 1211
-xori t4 t1 -847
-or s7 s8 a4
-or a5 s5 t6
-sll tp t6 t4
-sltiu a6 a6 -1772
-or t6 a3 s5
-divu s11 a7 t4
-srai a1 t2 7
-div s2 t5 s5
-or a7 s9 t0
-divu t1 t6 a2
-divu t6 t4 s3
-mul s3 a5 t0
-srli s8 a0 14
-rem x0 s6 s3
-mul s1 s8 a3
-xori s2 s2 -1641
-slli s3 s3 9
-rem t6 t3 s3
-srai a0 s11 22
-slli s5 s5 4
-mulhu s1 s7 s3
-lui s6 783081
-auipc x0 856475
-sub ra t0 t1
-or s5 t3 s10
-andi s1 t2 -1214
-remu s3 x0 s0
-ori t3 s10 -13
-sll tp t6 s11
-and a7 ra a1
-lui s5 69070
-xor t4 s8 a3
-ori gp t2 -2019
-rem s11 t5 a4
-xor a5 a2 t1
-divu s2 gp a5
-sltu gp s1 ra
-sltiu a3 tp -378
-addi s10 a2 -901
-auipc a6 450724
-sltiu x0 ra -1917
-sll s1 gp x0
-sltu t5 t4 t2
-add s1 a2 s6
-or a4 t2 t1
-mulhsu t0 t5 a1
-sra s9 a5 s4
-mulhsu t6 a6 x0
-xor t2 t6 a7
-add x0 s7 s11
-sra t2 t5 a1
-ori s2 s3 1289
-sll s6 gp s3
-add t6 a0 ra
-rem t2 s8 t0
-mulh a3 gp tp
-mul s6 s2 t5
-slti a6 x0 1565
-sltu s9 a6 t1
-andi a7 a3 1060
-xor t3 s4 s4
-slli x0 a6 21
-andi s8 gp 21
-sll a5 tp a3
-or s5 s0 s4
-div gp tp t4
-srli s0 a4 7
-div s9 a3 s9
-ori tp t0 -1524
-mulh t1 a5 s3
-slti a1 s0 908
-mulhsu s7 s3 a0
-andi s10 s0 -1838
-sra s0 tp a4
-mulhu a3 a1 s4
-mulhu ra s8 s5
-remu s2 a3 t0
-sltiu a2 a3 -1676
-rem x0 t3 s1
-sltu s8 x0 a7
-mulhsu s0 t6 a3
-lui a1 1037635
-xori s3 s2 -649
-divu s10 s1 t2
-mulh t5 a1 a5
-or t4 gp t0
-sub t0 s9 s2
-sltiu a1 s10 -1672
-srli t2 a4 25
-sltu a3 a6 a4
-slli t0 a6 4
-sub t2 a2 a4
-or a1 x0 t0
-ori s1 s0 -822
-srai a3 t0 23
-ori t6 t5 1783
-xori ra s2 686
-divu a4 s3 s9
-sub t6 t2 gp
-or t6 s5 tp
-auipc t1 143925
-lui s5 660547
-mulhu t0 s2 s9
-auipc t1 497101
-mulhsu gp t3 s4
-lui s1 359442
-slli s5 s11 12
-mulh ra t1 ra
-mulhsu t1 s10 x0
-ori x0 s8 1349
-xor s2 s0 a0
-sub s3 a6 t0
-sltu s8 tp s9
-slti s2 t5 -1294
-rem x0 s0 t4
-addi gp s2 -446
-xor a2 a6 s4
-xori tp t0 -903
-ori tp s2 -880
-mul t5 s0 s8
-srai s3 t6 25
-addi s11 t2 -56
-addi s1 t5 1996
-xori a4 t3 1894
-srli s9 s3 28
-and t2 a4 t3
-mulh a2 s6 s3
-sra t2 s1 a1
-addi t2 a7 1547
-sll s7 s0 s4
-sra s0 s1 s1
-divu s8 t0 s4
-sll x0 s0 a1
-srai s7 t3 20
-rem t0 t5 t4
-sra a0 t1 s10
-srli s10 ra 1
-slli a2 s8 13
-add gp s2 s9
-mul a3 s1 a2
-sltiu a0 t4 -993
-addi a3 a7 -118
-mulh s10 s0 s10
-sub s3 s6 t2
-srl s2 s7 s8
-and a1 a3 a0
-sltiu x0 t2 -640
-mulhu a3 s3 a2
-mulhsu t1 ra tp
-mulhsu a2 s0 s6
-slli s6 s7 27
-auipc a2 1021454
-srl a2 a2 x0
-rem t5 a0 a3
-sltiu t2 t2 -2033
-sll t3 s11 s5
-srai s7 s10 10
+sltu s10 a3 t1
+xori a2 tp 37
+remu a0 a5 s8
+sltu a0 a2 a2
+sll s8 ra s3
+xori s9 a0 -1210
+slti ra s0 -919
+add a4 t3 a5
+sltiu s5 s11 -1816
+ori gp s6 -547
+remu s7 s2 gp
+mulh a5 s10 gp
+mulhu a3 a5 tp
+mulhsu t4 s9 a4
+div s3 a0 s1
+xori a1 a0 -1658
+srl s11 t6 s2
+andi s11 t1 -927
+auipc a1 893708
+auipc t2 14934
+mul t1 s1 s3
+mulh a0 t2 s7
+sub s8 s1 s3
+and s3 s1 t3
+slt t6 s1 s11
+rem ra x0 s7
+sltu t6 t4 s8
+srai a4 gp 0
+divu s2 s5 s8
+sltu tp s6 s1
+remu s3 s11 s11
+srl t0 t0 s7
+addi s2 s5 457
+mulhu t0 s11 s6
+srli t4 s2 14
+xori s6 a7 -2044
+mulh s3 s1 a0
+xor t4 ra t3
+xori s9 a5 114
+slli t4 t3 31
+divu t0 tp ra
+slti s0 t6 517
+sub tp ra t4
+lui a7 511810
+add s9 s10 a0
+slli s6 s8 28
+divu t4 ra s3
+sltu s4 t1 s2
+slt s3 s4 t0
+sltu s8 s6 s6
+sll t2 a7 a3
+mulh a7 s9 a2
+slti a7 a5 -362
+addi gp s7 -1237
+and t0 t4 s1
+andi a1 t4 81
+mulhu s0 t2 a2
+srli s4 s1 22
+and t2 s0 a5
+rem x0 s5 s10
+mulh a4 a3 a7
+andi s1 s2 1656
+divu s9 s6 s8
+or s10 gp s10
+sltiu s10 s8 -1570
+srli a4 s4 18
+remu s6 a6 tp
+add s1 s11 s11
+srl s6 s2 t5
+srli tp t0 8
+xor s1 s3 a0
+mulhsu ra t1 ra
+or s3 a4 t3
+mulhsu s4 t4 tp
+sll a1 a3 s1
+auipc t6 1028933
+lui t2 250215
+srai a4 t4 31
+andi t0 s3 -392
+mulhu t5 a1 t3
+or s2 a5 s11
+remu x0 t2 x0
+andi s0 t2 -1649
+srai s0 tp 31
+addi a3 ra -275
+ori a1 s7 1873
+andi a5 a7 -1085
+auipc tp 606008
+mulhu tp t2 tp
+xori s8 t3 1955
+div tp t6 a3
+srl s5 s3 a4
+slti s4 a4 282
+and t5 s6 s3
+sub a2 tp gp
+rem s3 s9 s0
+sltu ra s7 s11
+srai a6 t4 2
+or t6 a6 a4
+mul t3 t0 a4
+xor a4 s1 s8
+xori s9 a3 -85
+and a3 s4 a3
+div t0 a7 t6
+slti s8 s0 -1482
+xori s8 x0 -739
+sub s10 s0 a7
+remu gp a2 t5
+add s2 x0 a1
+sub s5 a0 gp
+sub a6 s7 s11
+sll t2 t2 s0
+xori s0 t2 1233
+xor s4 s5 a3
+srli t5 t1 6
+add ra s11 gp
+srl s11 s5 s7
+sltiu a3 s1 -57
+andi t0 t0 1405
+srai a0 s8 22
+ori x0 t6 -1173
+srai s1 x0 3
+slt x0 x0 s2
+srl x0 a5 t4
+addi t0 t2 1490
+addi t5 s7 1845
+sltiu t5 s1 -1150
+sltiu s8 a2 -850
+lui s2 700200
+remu s3 s10 s6
+srl a6 gp s11
+xori a7 t3 1478
+mulhu a4 t5 s1
+remu a6 s5 t0
+andi s11 gp -1745
+srl a4 a4 t6
+sll ra s2 s7
+and x0 tp t3
+sll s7 a6 tp
+srli t0 a0 29
+srli a0 t0 7
+slt a3 s1 s2
+divu s8 t6 s9
+mulh a6 a7 t0
+mulhsu t2 s3 x0
+sltiu s4 t0 -296
+auipc a0 947924
+xori a6 a5 7
+addi s7 s2 -1105
+sltiu s1 a2 399
+addi t2 s10 -820
+addi t4 s10 -1626
+add a1 a6 s10
+sub s5 a7 s8
+auipc a0 247027
+or tp s8 x0
+rem x0 s9 s3
+xor s7 t5 t6
+sltu a6 s4 a2
+lui s1 22151
+mul tp a2 a4
+srai t1 t3 21
+xor t6 t5 s5
+remu s9 a5 a0
+or a7 t0 s4
+div a6 a2 a7
+andi s7 x0 -2018
+ori t3 s9 431
+sra t6 a0 s2
+and s5 s9 a0
+sll s11 s4 s1
+sll t3 s4 s10
+ori t6 a7 337
+mulhu s10 s2 a5
+mulhu s2 a0 t2
+lui t0 266595
+addi t2 a4 -434
+rem a4 t1 a6
+slt s5 s0 s8
+mulh t0 s8 a7
+srli t3 t3 11
+ori t1 s11 -1309
+slli s7 s4 10
+xori gp a6 -82
+mulhu ra tp s9
+slti s7 gp 469
+rem a0 tp tp
+sll s6 s11 ra
+or s1 a6 t1
+lui s10 81873
+div s4 a2 s8
+divu s8 a2 t3
+xori t0 s8 -1263
+mulhu t3 gp a3
+slt tp s7 t4
+lui t3 436754
+mulhsu t6 a1 s5
+auipc s11 752136
+auipc t2 29941
+slli t0 s1 5
+sub s5 a2 ra
+lui x0 619835
+sll gp a5 s9
+sub t0 t0 t6
+xor a1 s10 a4
+mulhsu s9 s5 s7
+srli s6 t1 12
+srli gp s6 9
+lui s7 469715
+srai s7 s2 16
+lui t2 585813
+slt s10 tp t6
+mulhsu s1 s6 s10
+slti s6 t2 -1756
+srli a1 a6 22
+sra gp t0 t3
+mulh a2 s2 s9
+addi s0 s1 -1278
+slti a7 gp 1147
+addi ra ra 1063
+remu s0 s3 t0
+slt s9 s4 gp
+mul s4 a3 a5
+sll s4 a5 t0
+lui ra 560461
+sll t5 t4 t1
+auipc t6 485099
+divu t5 x0 s6
+sltu a3 s9 a5
+xor s2 ra a7
+divu a6 x0 s4
+xori s8 s0 1206
+xori s6 a6 -1901
+andi t3 s10 -1218
+slti t3 s0 166
+mul t6 a4 s2
+mul s2 s8 s5
+add t3 tp a4
+rem tp s5 s10
+add t0 t1 a2
+srli a0 a3 12
+and tp ra t0
+or s11 s9 s5
+auipc s7 544960
+remu a7 a1 s3
+slt a7 s7 gp
+mulh s8 s0 x0
+sll t1 ra s8
+or ra a6 a6
+sltu ra a2 a6
+sub a3 a6 s7
+sll a3 s1 s10
+remu a1 t0 s11
+ori a2 a7 -1694
+srl t5 s1 s0
+srai s5 s10 16
+srli ra a4 3
+mulhu t6 t0 t3
+mulh t6 t6 s0
+rem a2 t4 t2
+or s0 t3 a4
+mulhu s5 a6 a1
+remu s7 t4 a2
+sltiu s1 s0 -1203
+divu s0 gp s10
+lui a3 771885
+rem a6 s1 t4
+sra a1 s11 a1
+sub s9 t5 a6
+sra t5 s3 x0
+sub t4 t5 s3
+slli s6 tp 11
+ori a3 a1 1854
+srai t2 a5 12
+remu t6 s5 s5
+mulh s4 s9 t4
+srl t5 s1 s0
+and s3 a4 ra
+ori t2 t3 -1304
+lui t2 75606
+sltiu t2 t4 -1112
+lui t0 365981
+sll t0 s11 t5
+auipc a2 973115
+xor a2 ra s0
+mulh s2 a0 t1
+andi s5 s7 -942
+add s4 s8 ra
+mulhu s1 a0 t3
+mulhu s5 a4 a0
+add t5 a1 a5
+div gp s4 t6
+sltiu a1 a2 676
+lui gp 701528
+mulhsu s3 a4 s1
+srai a3 a7 27
+slt a1 s11 s0
+srl s5 a4 t4
+slt s10 s5 a0
+mulhu a7 t6 s4
+sra s5 s7 s4
+slti a6 s6 1908
+remu t3 a1 gp
+mulhsu t1 s11 s11
+slli s8 s6 14
+and a2 s2 t2
+slt a0 s5 t3
+add a6 t6 ra
+mulhu t1 t0 s9
+and s6 s5 a2
+ori a4 gp -996
+div s7 s5 s9
+xor t2 ra a1
+rem s4 a3 s8
+xor x0 s1 s10
+sll s4 s7 s8
+slti a6 s8 -903
+or s5 s4 s6
+xori s9 t0 -667
+ori a6 s5 -687
+mulh s8 x0 a1
+ori t1 s2 -1554
+sltiu s5 t3 1001
+srli a5 s9 21
+sll t2 a0 a3
+slt s5 x0 t4
+sub gp a2 s8
+rem s0 t0 a3
+xor a1 a3 a1
+rem t1 s7 a4
+ori t1 t2 1552
+sltiu a3 x0 -1500
+lui s2 833452
+lui a7 334712
+slti t6 s6 201
+div x0 s7 s7
+lui a2 1039022
+andi s7 a0 -170
+xor s7 a5 x0
+srl s10 t6 x0
+or gp s4 tp
+slli s10 s6 31
+mulhu tp t6 t0
+slt t2 a3 t2
+add a5 s3 a4
+xor s7 a2 s1
+addi t3 a1 1660
+mulhu a4 a6 x0
+mulhsu s5 t2 s5
+remu t2 a4 s9
+and a2 t5 tp
+mulhsu s6 tp s10
+sra a5 t0 gp
+ori s4 ra -1727
+slti t0 s9 -1336
+rem t2 s9 t2
+divu s3 a1 a1
+slt s6 s5 t1
+sltiu s2 t6 -646
+mulhu ra t0 t5
+mulh a4 a7 s4
+srai t5 a0 14
+div s10 s11 s5
+slti s4 s11 1263
+or s7 s0 ra
+slti t5 a1 -194
+sub t2 s11 a7
+divu s9 s8 a1
+andi s8 s9 1046
+xor ra s9 a6
+sltu s7 t4 a1
+add s1 s6 s3
+mul s4 s9 t0
+and a1 tp s3
+rem s4 t5 a4
+slt tp s8 s1
+or s0 t6 t1
+addi ra a1 504
+rem x0 a4 a4
+remu s8 t6 s0
+addi a2 a3 2002
+mulh s6 s10 a0
+sltu ra t5 a1
+rem t5 t5 a5
+slli s10 gp 25
+sll a6 a0 gp
+srai s0 t3 20
+srai s0 s1 17
+slt s9 gp a2
+div gp s9 s4
+mulhu s1 s4 a6
+ori tp s2 -1612
+or s4 a7 s5
+auipc t5 118913
+sub a5 s10 a2
+sltu x0 s3 t1
+sra t3 t1 s2
+sltu s9 s8 a2
+mul tp a4 s0
+sltiu a6 t2 -489
+lui t0 130384
+srli a6 s10 12
+add a0 a0 t3
+addi a4 s11 -1339
+mulhsu a5 t3 s2
+rem a6 s3 s4
+sll t5 s1 t3
+divu a4 t4 x0
+slti ra s8 356
+srai t1 s6 7
+srli x0 t6 10
+rem a0 t1 s0
+sub s10 t4 s1
+lui s4 62550
+divu gp s6 tp
+divu a0 a1 a6
+add s2 t2 s4
+srai s9 a7 4
+sub a2 ra s5
+lui a1 77398
+and a0 s3 a6
+mul s3 a4 tp
+and gp t2 s10
+slti s4 t5 1114
+div gp s5 t3
+andi s7 s9 -1940
+mul gp s9 s8
+div ra s6 ra
+or a4 a5 ra
+slli ra s1 14
+sltiu t0 a0 -838
+rem a3 s9 t5
+srl t1 t2 s10
+remu s1 s1 a1
+divu a0 a3 a6
+divu t6 a2 s8
+divu s4 t6 a5
+remu a6 a0 t5
+mulhu t3 s8 t4
+add tp s9 s7
+div a6 a4 gp
+mulhu a4 a7 s10
+sll t2 a1 ra
+lui gp 22815
+sub tp s11 s2
+rem a1 a2 s10
+and a5 s2 a1
+addi s8 s0 2013
+slli s3 a2 1
+add ra tp t5
+remu a5 s2 a2
+andi ra t1 -957
+and t5 s2 s2
+and a1 s2 t1
+div tp t0 a4
+srli gp x0 12
+divu s8 s3 a2
+and s5 s4 s8
+auipc t6 81561
+xori a4 ra -401
+sltiu x0 s9 1580
+addi tp t4 -1623
+mulh s2 s0 s10
+sra s4 t2 tp
+sltiu a2 t3 -1756
+or tp s9 t1
+slt a3 s8 s0
+xor s3 gp s10
+slli a7 ra 31
+ori s1 t6 -1937
+ori s11 s0 -1900
+auipc s8 716026
+and a0 s10 s10
+srl a5 gp tp
+slli t4 a7 12
+lui s2 545000
+andi s8 a2 -1511
+sra s2 t1 a6
+xori a0 s3 152
+add s8 s1 a1
+rem a1 a4 t6
+sltiu s2 a1 145
+lui a6 652288
+lui t6 454261
+sll t5 a0 s5
+addi t1 gp -267
+and t2 ra t3
+slti s11 x0 -430
+lui s3 861374
+sub s10 gp a3
+or t4 s4 ra
+or s4 t4 a4
+remu s7 s9 t6
+sra tp s9 s0
+slti s5 t4 57
+sll t5 s3 s11
+ori a6 a6 1228
+slt s11 s0 a2
+andi t2 s10 -502
+mulhu t5 s2 a4
+srai s1 s4 18
+slti s5 t3 -23
+sltiu t3 s5 208
+and s2 a6 a3
+sll s7 gp t0
+div s6 t3 x0
+xori x0 t3 -1225
+lui t6 746686
+slt s10 gp a0
+sll a7 t1 t0
+rem t5 t3 s2
+slt s8 t0 t1
+sra s1 s1 s9
+ori a0 a1 -1592
+mulh s4 a6 s4
+xor t1 a3 s2
+slti s5 s2 -2005
+sub a2 s3 s2
+slti s10 a7 -491
+mulh s7 gp t4
+and s7 a6 a7
+mulhu s10 a7 a4
+add s4 s10 ra
+sltiu s5 a2 1154
+divu s0 s11 a1
+srai a2 s10 29
+mulhsu a5 a2 a7
+andi a5 s1 -1295
+srai a7 tp 12
+sll t1 s1 s2
+srl t3 ra s4
+remu t3 s3 t6
+or gp s2 s3
+sltiu tp a1 -1504
+slli t1 x0 21
+slt t6 s5 t1
+mulhu s5 a1 s7
+mulhu a5 s1 a6
+sra tp ra s7
+sltiu a1 s9 -1441
+sltiu tp a4 760
+srai s5 gp 5
+or t2 t2 t2
+sll a5 s10 s3
+sll t5 tp s0
+xori s9 s7 1614
+or a5 t3 s6
+add t6 a1 s7
+srl s7 a1 a4
+lui t5 471316
+lui a6 13050
+sll s3 a7 s8
+sra a7 ra s6
+divu a2 s3 s10
+or s6 s3 s2
+rem t4 x0 t6
+div t3 tp s6
+lui t5 792808
+remu t4 t4 tp
+xori s10 a5 1695
+addi t1 t2 -385
+andi tp s3 -361
+mulhu s3 t1 s4
+mulhu a5 a0 a1
+divu s11 s6 s8
+xor a1 x0 s0
+and t3 a5 tp
+sra s2 s2 a5
+sll s5 s8 s1
+sub a3 s1 t2
+addi a3 s9 -454
+remu a3 a1 t6
+sltu a7 x0 ra
+mulhu s0 a6 t2
+mulh t3 s8 a2
+div s7 x0 t4
+xor s9 a1 a3
+ori a2 ra 1453
+srl a5 t2 t5
+mulh a4 ra t2
+slt t4 t1 a3
+sll x0 gp s11
+or s11 a2 s1
+mulh s9 s7 a3
+srli s1 s1 9
+and a0 s2 s0
+andi s0 s3 1092
+sltiu s7 t6 1899
+sll gp s5 t2
+or s7 a4 s2
+rem t4 gp s0
+andi t4 s0 -1821
+lui t4 634921
+slt a0 a4 s11
+mulhsu a5 a3 a1
+srli s0 gp 3
+srli s4 s3 16
+slli s10 t3 23
+and s3 t1 a6
+div ra s0 a3
+or s6 s11 s0
+remu gp t1 t1
+sltiu ra t3 -814
+sra t3 x0 s6
+and a2 t1 a3
+sltiu a1 a1 -298
+srai s3 t1 19
+lui t4 796344
+mulhsu a1 s2 s0
+mulhsu s7 s1 a5
+srl a6 t4 s6
+sub s3 s7 t3
+srli s10 a5 13
+mulhsu t3 gp s2
+rem gp t3 a1
+mulhsu s8 s6 t4
+divu a1 a4 a6
+or a0 a6 s2
+rem s7 s3 s8
+lui s0 516674
+mulhsu s1 t1 s6
+sll t3 x0 a3
+divu tp t5 s4
+rem s7 a4 s6
+auipc s1 75648
+or a4 s11 a5
+srl a4 s1 a2
+sltu s3 a4 a1
+ori s4 t5 -543
+sll t3 t4 a5
+addi a2 s11 -1185
+mulhu a3 gp a7
+or t0 s6 gp
+div s1 t2 s4
+slti s8 t0 -1128
+or t3 s2 t0
+mulh s4 t6 s1
+slt s0 a1 s8
 slt t2 a7 x0
-sub s7 s1 a6
-xori t2 a0 -424
-add s10 s5 a7
-div x0 a7 s4
-sltu a0 a5 a6
-div s6 x0 s11
-ori a0 tp -929
-mul t1 t4 tp
-auipc t1 763481
-or t3 s4 t4
-sltiu s11 s3 -1226
-divu s3 a7 tp
-srl x0 a7 ra
-sub x0 a6 x0
-xor a3 s4 s0
-mulh ra s6 t0
-srli t3 t0 13
-xori gp a0 -1032
-xor s5 a2 s8
-divu s0 s3 s3
-mulh s4 s5 t5
-ori s11 a5 -421
-addi a7 t2 193
-mulhu a7 s5 s11
-lui t4 852093
-sltiu a5 s6 -882
-mul tp t2 a6
-and s1 tp a7
-sll a5 a2 s1
-auipc s7 30518
-sll s1 s8 a0
-sra tp t5 t0
-slli gp s9 17
-slt s11 t3 s10
-andi s10 t5 -1358
-srai a4 t0 7
-sra s11 t3 s3
-srli s10 s9 7
-xor x0 a4 a2
-andi t6 s4 1563
-div tp gp s3
-mulhsu a1 s11 s1
-sub s4 t1 a7
-srai x0 s3 31
-remu tp a6 t3
-srai s4 a3 15
-remu s10 s5 s10
-slli ra s3 8
-slt t6 s8 gp
-slt s1 s10 t6
-div s11 ra s8
-add a3 x0 s3
-andi s0 s6 1851
-sltiu a3 tp 724
-mulh gp ra a5
-mul a6 a0 s8
-divu t0 gp a2
-slt gp t3 a6
-srai s4 s5 20
-sll a5 s8 a3
-mulhu s9 t6 s1
-slli s5 t0 3
-ori t3 a1 -1924
-or t0 x0 a1
-srai tp s5 24
-or tp ra ra
-lui x0 985918
-slti s10 s7 1607
-mulh tp ra s0
-slt a5 a0 a7
-mulh t4 a3 gp
-addi t5 t2 -1635
-auipc a7 780545
-and s11 t5 s0
-divu s1 a6 t4
-srai s11 a5 21
-sll ra t4 gp
-addi t2 a0 -735
-sll s1 s5 t0
-mul x0 s7 tp
-sltiu s7 s1 -760
-divu a1 t5 a1
-ori s7 x0 936
-mul a7 s7 s2
-sll a1 t2 s5
-srli s8 a5 3
-lui s6 126260
-mulhsu tp s0 a5
-divu s1 s8 t2
-sltu ra s1 s0
-slt x0 a3 gp
-xori t3 a5 -781
-ori a6 tp -1935
-mulh x0 s4 s3
-xor t3 t0 s11
-add s8 s1 t6
-addi t5 a3 -497
-xori a0 x0 -1250
-srli s9 s8 9
-sub gp s2 t5
-xori a1 t3 -1409
-rem a5 a4 s6
-srl t1 a2 a6
-addi s10 s1 122
-srai s2 x0 9
-andi s10 s5 1351
-sub s3 t6 s11
-srl a1 s6 t2
-add s3 t5 t5
-xor t1 a6 s11
-xori t6 t6 608
-sll t5 s2 s8
-or a3 s10 s3
-rem s7 s3 s7
-lui ra 838750
-sltu t2 t0 s2
-or s7 a0 a5
-divu s9 a0 a5
-andi a4 gp -171
-slti a3 a2 -1543
-auipc s2 408202
-sll s7 s9 s8
-slti x0 a7 -533
-or a6 a0 t0
-slli s4 gp 6
-add s5 t1 t3
-auipc s10 560004
-rem s1 ra t4
-xori s10 a7 991
-sra t5 a3 s6
-xori t6 s7 -111
-mulhu s2 a0 a0
-slli a5 s3 0
-sll s0 t4 t1
-mulhu t2 a3 s0
-srl t3 a3 t4
-srl a4 x0 a1
-mul a2 a5 a2
-srai x0 s1 12
-divu a3 a4 s8
-slli a2 a7 15
-xor s9 s11 s5
-slti t4 s2 -19
-divu t0 a2 t2
-srl s11 a7 t4
-sltiu s4 s8 -1862
-mulhu x0 s7 a0
-sltu s8 s6 t0
-div s6 x0 s1
-sltu t0 t3 a7
-sub gp t6 s1
-rem s6 s10 s7
-andi a5 s0 -1250
-mul x0 s5 s4
-mulhu a2 x0 s2
-mul s3 s6 t1
-addi a2 s11 -1996
-rem s8 s9 s7
-slli t1 a3 19
-or s1 a5 s3
-auipc x0 3439
-ori s0 a5 460
-div s2 s0 s5
-auipc t1 863090
-xori a0 t4 -506
-slt t2 s6 a2
-srai a5 t5 7
-mul s7 s0 gp
-mulhu t2 tp ra
-ori s10 a6 -1715
-slti ra t6 -1498
-auipc s2 168616
-sub t3 a2 t1
-sub a2 s6 tp
-mul a1 a3 x0
-or t3 t2 x0
-sra s8 s1 a0
-andi s9 a0 -661
-divu s2 tp s9
-ori s6 s11 474
-or x0 s10 a0
-sub t0 a6 t4
-lui s10 81197
-auipc a2 326889
-srli a1 s0 8
-and s10 s1 s2
-xori s6 s10 -417
-auipc ra 594227
-addi a3 tp -294
-sltiu s6 s8 -852
-sltu a3 ra t0
-srai gp s5 3
-xori t4 s1 -1156
-slli s6 a2 26
-srai t4 tp 10
-or tp t2 a4
-add s1 a0 s7
-mulh s8 s6 s5
-mulhsu s0 x0 gp
-divu x0 ra a6
-xori x0 s2 -1606
-divu a0 t6 a0
-rem tp s4 s8
-mulh s1 s8 t5
-andi a5 s2 -462
-and a2 s6 a0
-divu s6 t6 a4
-xori ra t3 -219
-or t4 a1 s9
-mulhsu s2 x0 gp
-srli a5 s10 12
-mulhu t6 s6 s6
-sltiu s2 a3 -1748
-sra s2 s0 s2
-srli t4 t6 15
-mulhu a5 s2 s3
-remu a6 s11 a5
-mulhsu a3 s4 s8
-xor s9 a0 s8
-and a0 s1 s0
-and s0 gp a4
-srl a3 s0 s2
-sltiu a4 t0 1190
-mulhsu t0 s7 gp
-slti s1 ra 633
-or a7 x0 t5
-mulhu t0 s0 s10
-ori s6 t0 -850
-sltiu t3 a0 -884
-lui s3 596560
-rem t2 s11 s9
-sub t5 s7 s2
-mulh s6 t3 s9
-addi a6 a4 -258
-mulhsu s3 t4 tp
-divu x0 t4 x0
-srl a4 s7 s10
-andi s5 t6 -1649
-add t6 s7 t5
-srai s3 s5 20
-mulhsu t4 s8 s7
-sll t3 a1 tp
-ori s11 t3 -702
-sltu t4 t2 s3
-ori gp ra -320
-slti a7 tp -1229
-rem s4 s5 a3
-auipc a2 1010709
-xor s1 t2 ra
-slli t1 t2 20
-ori t5 t1 144
-sra s1 t2 a5
-xori s0 t1 -425
-sltiu a7 gp 582
-srli a0 a3 20
-rem s10 t5 t3
-div s4 x0 tp
-sll tp a5 s8
-ori x0 x0 -1805
-sltiu t1 t2 -1202
-addi a4 a1 -755
-auipc s2 636829
-mul a0 t3 a3
-mulhu s5 a1 gp
-mulhu a2 x0 a7
-slli s1 gp 18
-srli s4 t2 18
-add gp s10 s4
-slti t3 s9 1851
-srl x0 t3 s4
-mulhsu s4 s2 a1
-remu a5 t6 s7
-sll a7 s5 t4
-sra a5 t2 s10
-mul s10 s0 t2
-sltu t1 s8 a5
-slt a2 gp s7
-lui s3 506045
-slti s2 t1 -1916
-mulh a1 a4 s3
-mulhsu t1 s3 x0
-mulhsu s8 a3 s5
-rem a2 x0 s10
-slli t0 s4 15
-mulhsu s9 s0 s11
-mul s9 a2 a6
-sltiu a6 a7 -527
-div s11 s2 s9
-sra t1 a5 s5
-addi t6 t2 -1833
-sub ra s9 a2
-mulh s6 s8 ra
-divu t1 a3 s6
-sub s8 t3 a0
-auipc t5 622840
-or s10 s7 t6
-or a2 s6 s0
-rem s8 s6 t5
-andi s1 s9 -1596
-srai t0 a5 26
-remu t0 t3 t4
-sltu x0 a4 gp
-slt t5 tp s1
-slt s10 s10 s9
-mul s11 s10 tp
-mulhu x0 tp s1
-ori a6 t2 -1992
-sll t0 a6 s1
-sltiu ra a4 -1704
-or s2 tp s7
-srli t3 s10 26
-xor a7 s1 a1
-rem a4 t4 a5
-sltu gp t4 tp
-slli a7 a2 2
-srai s10 s11 15
-and s2 s2 a0
-slt a2 x0 t6
-sra t4 t4 s10
-sub s3 t2 tp
-xor s2 s5 a3
-slti s5 s5 1612
-xor s2 s6 a7
-sub t0 s2 s1
-sltu t3 s6 s11
-or a6 t2 a3
-sll s7 s10 t5
-mulhu x0 s9 a3
-and s5 s9 a7
-add a7 t4 x0
-add a4 s7 s4
-remu t6 gp s9
-sltu a7 a3 t6
-srai s11 t0 18
-ori a7 s11 1334
-or s2 t0 a6
-auipc a5 310395
-div a0 s7 t4
-sltu t2 s9 s4
-mul a4 t2 s5
-addi a6 s6 -844
-sltiu s7 t4 243
-sub a3 gp a5
-or a4 a0 gp
-sltu s11 s0 t0
-and a1 tp s10
-sra s7 a3 t3
-sll s8 s0 a3
-sltu a2 a0 t6
-slli a1 t4 15
-mulhsu t1 s5 a1
-xori ra s1 484
-mulh s3 s11 s8
-auipc t4 37872
-sra s9 t0 tp
-mul a1 ra x0
-mulhsu s6 a7 s3
-rem a2 s8 x0
-andi t5 a0 -1695
-mul t4 s7 a5
-addi s0 s7 579
-mulhu s5 t3 gp
-xori t5 s6 -1206
-mul tp x0 t1
-add a7 s5 s9
-slli s10 s1 23
-sltiu t3 a5 -1106
-remu tp t3 t0
-mulh t1 x0 s4
-andi s8 a7 -1212
-div s9 x0 a3
-rem s8 a3 s11
-addi t1 s7 731
-divu s10 s9 gp
-sll s5 a5 a2
-mulhsu s5 t4 gp
-sub t2 x0 t4
-and s4 a6 s6
-mulhsu s3 gp x0
-srl a1 x0 s7
-ori a5 s1 -922
-or s4 a3 s0
-srai s9 a2 30
-mul s6 x0 s9
-add s10 s10 a7
-slti x0 s10 993
-sltu a7 s9 s11
-add x0 x0 s1
-divu s1 t3 s10
-sub s6 ra a4
-div a6 x0 a3
-sltu s4 s10 s11
-or t4 s6 t5
-mul t3 s0 s8
-div a7 t3 t6
-srli a0 s8 27
-or s8 x0 tp
-sltu t1 t1 x0
-srai a4 s8 6
-mulhsu s11 a5 s10
-lui t1 10178
-sltu t1 a3 s2
-slli s10 t5 10
-srl s4 t2 s4
-lui t3 322934
-sll s4 ra t6
-mulhu x0 s3 gp
-add ra s0 t3
-sll a4 s5 a1
-mulhsu a5 s7 a0
-auipc s7 174422
-remu s1 s5 s2
-sra gp s5 a2
-xor t1 s11 t4
-or a2 s5 s5
-rem a4 s7 a4
-sltu a3 s11 x0
-sltiu a7 ra -1281
-sltiu t1 s6 -1074
-remu t0 s3 x0
-sll t0 tp a2
-auipc tp 564623
-ori t4 s4 -1561
-and ra t5 a3
-andi t5 t6 -1218
-slt tp s4 s11
-auipc tp 768709
-rem tp gp a6
-add tp t4 x0
-andi s9 t3 -700
-xori s11 s5 -679
-sltu a6 t0 a0
-mul t3 tp s1
-ori s5 a1 1439
-slti a3 a3 -806
-remu gp s6 s2
-mul s4 a0 s6
+srl t1 a1 t4
+sltu s7 s5 t6
+xori a4 s1 -1844
+slt tp t5 s8
+andi t4 s1 -1822
+add s6 s5 s6
+srli a1 t0 6
+srli a7 a5 9
+add a7 s0 s10
+andi s0 s2 910
+sltu t3 s4 a6
+auipc a2 742235
+xor s3 x0 s9
+div t2 s10 s7
+slt ra ra a1
+ori s2 gp -156
+remu a3 tp s11
+sltiu s1 s5 -1339
+mulhu s8 a1 a2
+sltu a2 a4 s5
+sub a6 s9 s11
+lui a6 212810
+mulhsu a2 t1 x0
+xori t6 a7 -279
+sub x0 t4 t3
+slt s6 s0 t5
+mulhu a5 t2 s7
+andi s2 a0 -1493
+remu s5 s2 ra
+sra s11 s8 ra
+slli s8 ra 9
+lui t1 936036
+sltu t3 t0 s5
+rem t2 t5 t4
+srli a3 gp 11
+div s11 a3 ra
+mul t4 a6 s1
+slt a0 a0 x0
+slti s6 a1 -604
+lui a0 603323
+mulhu a5 gp t3
+addi a6 t3 -538
+add tp t2 s7
+and a5 t0 t3
+mulhsu a5 gp t0
+sltu t6 ra x0
+mulhu gp a0 tp
+mulh a4 t4 s3
+srl s6 s8 t1
+slti s11 a5 -1219
+mulh a4 t6 a0
+srli a4 s7 16
+sub t3 s9 s0
+addi a7 t4 -297
+slt t1 s3 ra
+xori s10 s0 1440
+divu gp a1 s8
+sltiu s9 ra 1915
+addi s8 t0 1123
+sll t6 a3 t2
+divu a7 s11 gp
+remu ra a7 t5
+rem t0 s5 t4
+div a1 s10 s1
+div ra gp s8
+auipc gp 259144
+slt ra s0 a3
+add a4 a1 a1
+srai ra s8 28
+sltiu t4 s10 -1254
+mulhu s3 s7 s8
+add a6 a0 a0
+lui a5 630751
+add s5 x0 s3
+mulh a0 t5 t5
+sub a5 s10 t1
+and ra a4 t3
+sll gp s4 t1
+slli s8 s2 2
+mulhsu gp a5 t2
+sra a0 s3 tp
+and t3 t3 t2
+rem ra a5 a0
+lui s9 924631
+ori a7 s10 1938
+mulh a0 a1 a7
+rem s7 t5 t0
+sll s8 s7 gp
+mul t3 s3 s0
+ori t2 gp -1269
+slti s2 a2 1967
+and a3 t3 a6
+mulhsu s5 x0 s9
+slli t5 t6 4
+sltu s6 s10 s8
+srl a7 ra x0
+andi s2 a6 -1401
+divu s0 a2 s5
+or a7 s8 a2
+xori t3 t6 939
+sra a2 s8 gp
+mulhu x0 a6 s2
+slt x0 t0 ra
+srl a5 a1 t0
+sltu t6 s0 s5
+slti s2 t1 1054
+remu s6 s6 a6
+srai x0 s5 9
+ori s4 s7 -1703
+slti s0 a3 -1159
+rem a7 t1 s2
+rem a4 a3 a0
+addi s11 t2 -1536
+xor gp a3 a1
+xor s0 t6 a6
+and s8 s7 x0
+slt s5 tp x0
+divu a4 s7 s1
+or t4 a1 s11
+mulh t0 a7 s11
+mulhsu s6 t0 s7
+add s5 a3 t3
+and s0 t2 t1
+sra t0 s10 s8
+rem t3 t2 s6
+slt a2 t5 t0
+divu t6 gp s7
+mul a5 a2 s10
+sltu s10 s5 t0
+slt s1 a3 s1
+srli s3 a2 11
+mulhsu s4 t6 t6
+xori a7 s9 -1716
+sltiu s7 s5 -400
+addi tp s4 -49
+rem t0 t5 t5
+andi s3 x0 -1234
+srai a4 s5 30
+lui t3 496239
+div s4 s3 a4
+auipc t6 556442
+mulhu t1 s0 s0
+mulh a5 s11 s10
+xor a4 t0 s9
+srl s8 s3 s7
+or s1 s3 s10
+mulh t3 a2 tp
+mulhu ra a7 s0
+ori t3 s4 336
+slti a5 a4 -526
+sra gp x0 a6
+addi s6 s5 392
+xor s9 gp a3
+sra a4 s0 t2
+sra t6 s9 s6
+auipc s6 554774
+sltiu t1 s8 -680
+srl gp t1 s10
+ori a5 s10 -506
+xor a5 gp s1
+mul t3 gp ra
+slli ra s10 21
+div t4 s9 s4
+sltiu s2 a0 1268
+mulh tp s1 tp
+ori s1 a2 433
+mulhsu s0 s9 t5
+xori a0 t0 -614
+rem a0 gp tp
+srai t0 t5 16
+xori gp t4 1332
+ori s1 s9 -1406
+auipc s6 357923
+sltiu s9 t1 -599
+or t0 t5 s10
+sub s6 s9 s10
+slt s11 s5 s10
+mulhsu s10 gp s9
+slli s5 s7 31
+mulhsu t1 a1 a5
+slti t2 a4 -1165
+sltu s5 a6 ra
+or s3 tp a5
+xori s8 s1 -774
+divu a6 a1 a0
+slli a7 s8 3
+sll a1 a6 s2
+div t4 tp s8
+remu t0 t6 s10
+sltu s9 s7 s6
+andi a1 t5 101
+xor a2 a3 t4
+xori a3 s5 -1801
+ori s10 s4 -1416
+mulh a2 s2 s3
+remu t1 gp a7
+auipc x0 229186
+slti t2 t4 363
+remu s4 s11 x0
+sltu s1 t1 t5
+add s3 t2 t2
+divu s9 s5 gp
+srai s0 s2 31
+divu a6 ra tp
+sll ra x0 gp
+xori a7 a1 -2008
+sll t1 x0 s5
+srai t0 x0 24
+andi a6 a6 -1309
+slli s11 a4 12
+sltiu s11 a7 -1321
+mul ra a5 a4
+srl a7 a1 t6
+srl t4 s6 s2
+srli a7 a1 12
+mul t6 s6 gp
+srli gp t3 21
+div s2 a5 s3
+mulhsu t2 s11 t1
+lui ra 448918
+xor a4 s7 s7
+xor a6 s4 t2
+and gp s8 a3
+addi a5 x0 -1889
+mulh t6 s6 tp
+lui s5 1009854
+mulh s5 t3 s6
+mulhsu s3 s2 s4
+srl gp s5 s5
+srli s4 t5 20
+mulhsu x0 gp s9
+and a5 t4 s1
+and t2 s2 x0
+xor s10 s7 s0
+rem t2 s1 t5
+or t3 t6 t6
+slli a0 gp 9
+lui gp 406161
+srai a3 a5 11
+sltiu t5 t2 -1081
+srl s5 t5 a3
+sub s11 s7 t2
+slli t3 a2 3
+divu s4 t5 s2
+remu a3 t0 s11
+and a6 t1 s9
+remu s8 s3 t0
+xor s8 s11 a4
+ori x0 s3 -1140
+sltu tp s5 a7
+and s3 s8 s5
+sub t2 s9 s3
+mulh s6 t0 s10
+srli s8 t6 2
+or s2 a5 s11
+divu s5 ra t4
+slli s8 t6 25
+remu t1 a1 a2
+sll s9 t1 x0
+sra s10 t0 a4
+xor t4 t0 t5
+sll t5 t6 a3
+or a1 s9 s10
+sll t4 x0 a0
+rem s10 s5 s0
+srli a0 a0 10
+ori t5 s1 -1743
+xori s6 gp -1940
+and s8 x0 s4
+ori ra s6 974
+rem tp s0 s2
+sll s9 ra tp
+remu t1 s9 a4
+sll t1 t5 s8
+sll ra gp a0
+sll s6 a7 s8
+divu a1 t5 a5
+mul a7 a1 t2
+remu t1 t4 t6
+mulhu t2 ra t1
+and t2 a1 t1
+mulhsu s2 s1 s0
+xori s6 t6 767
+srl a7 a5 t2
+srai gp s7 18
+addi t3 t6 -15
+add t4 a4 s7
+add t6 a7 t3
+and s7 gp s6
+xori s10 a3 -1612
+srli s6 a1 30
+and t5 t1 a1
+mulhsu a7 x0 a6
+mulhsu a7 s2 s6
+slti s10 t0 -1120
+mul s0 a4 t5
+div x0 t4 t3
+sltiu a5 tp 888
+mulhu s8 a0 x0
+divu t4 s6 ra
+andi a2 t6 52
+sltiu t4 s0 -1411
+rem s9 a4 t6
+addi s9 t5 1784
+sltu s1 t6 t4
+ori a7 a3 1272
+sll s6 s2 a3
+sra ra t4 t3
+or t2 s8 t4
+slli gp t3 28
+slt s10 s2 s10
+ori a2 x0 -271
+srl t1 s8 t6
+and t0 t5 t5
+rem a6 a0 t6
+addi s6 s11 -2027
+slli s1 a1 11
+remu a2 s8 a7
+mulhsu a7 gp gp
+slti s5 t4 -938
+sltu a2 tp a6
+slt t1 t5 s6
+mul t0 ra s7
+or s1 t6 t5
+mul s4 t0 t4
+add s0 t0 tp
+sll s3 s6 s9
+addi t0 s2 756
+mulhsu a1 s9 s8
+rem s2 a1 s8
+mul s9 a5 t5
+lui a6 725702
+auipc s0 969701
+sltiu s11 a2 266
+mulh s1 s4 t2
+mul s11 a4 a7
+mulh s4 a4 s4
+sltiu s0 s8 -1339
+divu s8 s4 t3
+div t0 s1 ra
+mulh s8 a3 a1
+or t6 t1 s7
+sll a5 s8 tp
+addi s3 a0 917
+mulhu gp s6 a4
+mulhsu s1 s11 a5
+sub x0 t3 s5
+sltiu t0 t1 -769
+sltiu t6 s6 1041
+rem gp a1 s7
+xori ra ra -969
+div t5 t2 s10
+slt a3 s1 s4
+slti gp a7 1081
+slli t4 s1 22
+srl s2 s6 t6
+mul s4 s9 s2
+or a5 s6 t3
+srli a1 x0 27
+lui t5 904799
+ori s2 s4 17
+mulhsu s2 t3 t4
+addi a6 a3 -531
+rem a6 s2 s11
+ori s9 s6 666
+slt t1 s7 s2
+ori tp s8 -383
+and gp t0 a3
+mul a1 t5 x0
+mulhu t0 t4 s7
+slti t4 s1 834
+slli a1 s6 17
+addi gp x0 1735
+sltu a4 a6 s10
+mulh t3 a4 s6
+ori s1 a0 -351
+and x0 x0 t2
+ori a1 t2 -794
+or s9 s4 a7
+sra s1 s10 ra
+lui a2 938949
+remu a1 a2 tp
+mulhu t2 t1 a6
+div s5 ra s0
+srai a3 a7 3
+xori s1 a6 -131
+sltu t1 s5 t4
+andi a1 t3 433
+sra a4 s3 a2
+sltiu s10 gp -1825
+xor s1 s7 t3
+addi t4 s8 703
+add s10 t4 a7
+andi x0 s7 -178
+sltiu a2 ra -463
+sra tp s4 t2
+rem s10 a3 a6
+andi a5 t0 1110
+mul t5 s9 a6
+xor a4 a4 s0
+sltiu t2 a7 -1233
+sra tp a4 t6
+add t6 t4 s6
+mul a5 tp s1
+div t5 s1 t0
+sltu a5 a0 s11
+divu s9 t0 tp
+slli s11 a2 30
+slt a1 a6 a4
+add s8 gp t5
+auipc a2 205366
+sra t6 t4 ra
+slli a5 t1 5
+mulhsu t3 t3 s0
+and tp s8 x0
+xor x0 t2 a5
+sltiu s4 t2 -1673
+addi s6 a7 400
+rem a6 t0 s6
+slti a3 a0 -1867
+or a5 s8 a1
+sltu a0 a0 s7
+rem a4 a2 a7
+mul s3 a1 s11
+add t2 a5 t4
+addi s3 t6 1632
+remu a6 s4 a2
+lui t5 35772
+mulhsu s3 s7 s2
+mulh s2 a1 a3
+mulhu s7 s9 a4
+xori t6 a3 -6
+and s7 x0 s11
+srli t0 s11 3
+div t1 t4 t5
+sra x0 t5 s0
+srl a6 ra t6
+div t1 gp t5
+sra s6 s9 t3
+mulhsu a6 a2 x0
+sltiu s3 s2 -305
+andi s4 s4 -1024
+auipc ra 724767
+auipc a2 315977
+sra a0 a3 ra
+mulh a3 a1 t1
+srl s3 s7 t0
+div t4 t5 t4
+xori t1 ra -1913
+andi t2 a0 1690
+mulhu tp s1 t4
+ori ra s8 -723
+lui ra 175263
+slli s5 s9 25
+lui s0 627594
+lui a5 327425
+srli a3 a1 28
+ori ra ra 1397
+and s4 s7 tp
+srli s1 a5 6
+sub s8 a7 s1
+sra s2 t3 a6
+addi s4 s10 -213
+remu s6 s3 s2
+sltu s10 a1 gp
+andi t3 a7 -606
+slti a4 t1 -1458
+andi a6 s8 -1201
+remu s5 t1 a7
+divu t5 t3 a4
+mulhu a0 s10 s8
+xor x0 a0 t5
+divu s11 s8 a4
+sltu a3 s9 s9
+xori a4 a6 503
+addi s2 s9 -901
+srai s3 s10 9
+or ra t6 t3
+andi t6 a4 -1770
+div x0 tp a3
+ori s3 s11 2031
+rem t4 s3 s7
+addi t6 t2 -439
+sra s8 gp s4
+slt a2 a4 a4
+mul a2 s6 s0
+ori s0 s9 -180
+rem t3 tp t4
+sra s8 a3 s10
+and s9 a0 s2
+srl tp x0 t2
+sltiu a5 s7 2037
+srl s3 t3 s9
+srli s1 ra 17
+xori s2 s8 517
+mulhu s2 a7 s8
+mulhu ra gp t5
+srl a2 s2 t2
+rem s7 t3 s7
+sltu a5 t3 a7
+addi s11 t5 1713
+slli s10 s1 12
+lui a3 513990
+addi a6 gp -1412
+addi a3 a0 -66
+addi s6 s11 -432
+sra t4 s5 gp
+sltiu s5 a1 -1038
+xor s5 tp tp
+slli x0 s11 29
+sra s1 a5 t1
+divu a7 s6 s11
+div s7 t4 a5
+xori x0 s4 -562
+sub tp a5 a2
+div a2 s6 a5
+srai s8 a1 21
+addi a5 a7 1472
+srli x0 s10 30
+sra a0 s5 t0
+auipc t1 92052
+srli t1 t4 12
+add s11 a1 a2
+ori t3 a0 -204
+and t3 t2 s7
+andi a0 s8 -882
+addi s9 t0 -222
+auipc s0 795885
+divu s7 s8 x0
+mulhu a3 s10 t1
+sub s9 s11 a4
+mulhu s0 s1 t6
+lui s10 94003
+mul s10 t4 a2
+sub s0 t0 s0
+srl s10 s5 t0
+mulhu s0 s0 s10
+slti s4 a1 -1672
+auipc t6 985926
+sra s9 s2 a7
+slli a2 ra 8
+slti ra s4 -1230
+mulhsu a7 s8 s11
+andi s0 t2 -1189
+andi a4 s1 -1694
+sll a3 s4 s6
+rem s10 s10 ra
+divu gp a5 a0
+rem t6 tp t0
+srli gp a2 11
+andi t1 a7 -1616
+sltu tp s0 a2
+or t1 s0 gp
+or s1 s3 a7
+andi s3 s0 -2020
+sltiu s5 s8 -717
+slt s10 a0 a0
+divu a3 s5 s10
+add s4 s6 s8
+or s0 s6 a1
+sll t5 t2 t5
+sra gp s0 a7
+sll a1 a7 a1
+srli a1 s1 8
+srli a1 s5 30
+rem gp x0 a7
+addi s0 s4 32
+rem x0 a0 s0
+xor a6 x0 s1
+andi s0 a4 880
+srai a5 a4 3
+slt x0 s6 s3
+divu t0 s2 t2
+rem s2 s0 a7
+srli t6 t6 31
+andi ra t2 1360
+xori a1 a0 1445
+andi t3 ra -1988
+srl s5 ra a1
+slli t3 s4 29
+remu a3 t6 a5
+slti s1 s4 -637
+xor s7 s4 s0
+xor a6 s7 t4
+xor s6 t2 s2
+slt a7 a5 s4
+slti x0 t6 -1681
+divu ra ra s0
+slt s10 s8 a5
+srl a7 a3 t2
+mulhu tp s5 s7
+andi a5 s6 -1542
+add a7 tp t2
+and gp t6 s1
+sll a1 s11 a5
+mul t4 s2 a5
+auipc a1 104550
+or s9 s6 a2
+mulh s10 t3 t4
+srli a1 t1 22
+slli t5 s2 1
+rem s4 t3 s11
+div s7 a4 s2
+divu t1 a6 a4
+addi a5 a7 -1799
+xor t2 a7 a0
+mul a1 s7 a2
+or a2 a3 s1
+slt s2 s6 t2
+sltu s9 s5 a7
+div gp a3 a4
+divu a7 s7 t0
+div a1 a6 a4
+mulhsu t5 t0 s1
+andi s11 a0 -280
+and a2 a0 a7
+sltu s9 x0 a5
+sltu s3 s0 x0
+srai t2 s8 9
+srli a1 s8 1
+remu a5 a3 s11
+remu s5 a4 t4
+srl gp s10 x0
+divu t0 s6 a1
+slt t4 ra a7
+or x0 a3 a3
+mulh s11 x0 tp
+ori gp s9 181
+slt s7 a0 s8
+auipc s3 118225
+sll s2 a3 t4
+mul t4 t0 gp
+sll t6 a5 s6
+andi a6 t0 -954
+addi ra s4 -27
+add a7 t5 s1
+slt t4 a6 s10
+xor s11 s10 s7
+lui t0 412477
+remu t5 s1 x0
+xori ra ra -1276
+addi t3 t4 -1778
+sltu s4 a3 s9
+sub t4 t3 t0
+ori s8 s4 -641
+srl a2 s1 s4
+addi t0 s2 -284
+mulh tp s3 a2
+divu a0 ra t3
+rem gp t6 tp
+lui ra 871581
+rem s4 s10 s3
+sltiu s3 a2 1886
+sltiu tp s8 586
+mulh s1 s4 s8
+divu t3 a2 tp
+ori s3 s0 -986
+addi gp tp -476
+srli t4 ra 26
+addi s7 s4 -2030
+divu s0 s0 a3
+slt a4 t1 t3
+sra t6 s7 s11
+add t5 s10 s5
+andi a2 a4 4
+sub s11 s6 a2
+sltu s6 x0 s7
+mulh s1 s8 t1
+rem x0 a0 x0
+add t1 s6 s5
+andi t6 ra 40
+mulhsu s8 t3 a5
+slti t4 a3 -1562
+srli s1 a1 14
+slti a4 s6 -1019
+slt s2 t5 s0
+divu t4 tp a1
+mulhsu t1 s9 t6
+divu tp s3 t0
+slt s4 t6 a7
+sltiu a7 gp -153
+sll s0 s6 t4
+slti s2 a5 -498
+lui s11 365636
+srl a2 a5 s7
+slti t6 tp 355
+remu gp a0 s0
+sll s0 s1 a3
+addi s8 s5 1401
+srl t0 a1 s10
+xor tp x0 t4
+slli s3 s0 1
+sub a7 a1 s0
+sll s9 s0 a5
+auipc a7 615300
+srli s5 s1 25
+divu a7 ra s6
+auipc a6 369954
+sub s9 x0 a4
+ori t2 s8 555
+add t0 a0 s11
+xor a6 t3 t4
+auipc s11 525537
+ori t0 t5 1959
+divu s3 s3 a4
+srli a7 t4 11
+div t0 t3 t5
+or a4 s0 a7
+mulhu s4 t4 s2
+srl t3 a3 a7
+andi t3 ra -1749
+slti a0 a0 1070
+mul s11 t3 s8
+slt t3 gp a1
+mul t6 t5 a0
+sub t6 s10 t1
+srl s0 a7 s10
+srli t5 a5 8
+ori s11 gp -1167
+xori a7 a7 -1945
+srl a5 s11 a1
+addi t4 t1 -1989
+srl a2 ra t4
+rem s7 s2 a6
+sltiu s8 a6 -1350
+add t5 t0 a1
+and t5 t6 a3
+mulhsu gp a6 s6
+xori s2 s3 123
+rem s4 t4 x0
+slli s5 t5 21
+xori s2 a2 -177
+mulh x0 a5 s7
+xor s7 s11 a3
+sra a2 a3 tp
+auipc s10 58852
+and s6 s1 s3
+slt s9 ra a4
+slt s9 s10 s1
+xori s7 t0 -446
+and s10 t0 t3
+srai s8 s8 24
+ori a2 s0 -1666
+or s6 x0 a4
+mulhu t2 s8 s7
+remu a2 s7 s3
+mulh x0 gp ra
+lui s4 855701
+and s2 s9 a2
+sll a1 s5 a6
+lui x0 985289
+mul t2 a1 gp
+mulhu s7 a0 x0
+srl s7 s9 a3
+rem a1 a4 a1
+or s7 a0 s0
+mulhsu s0 t6 a3
+sltiu a1 t3 2029
+xor s7 s9 s10
+div tp s4 t3
+mulhu t3 s8 t6
+mulhsu s1 a4 a4
+sll s1 t2 s1
+auipc a3 268236
+slli a1 s11 22
+remu a6 s2 s9
+slt a0 t3 s0
+rem t1 s1 a1
+mul a4 s11 a6
 lui t5 654357
-remu s7 s8 x0
-mul t3 s6 gp
-div s2 x0 t1
-slt t4 s4 s1
-xor x0 x0 x0
-auipc t4 377431
-divu t4 t0 s1
-slli s11 x0 11
-sra s4 s6 s6
-xor a2 t3 s5
-srl s9 t5 t4
-or a5 ra x0
-mul a0 tp t3
-ori a0 s11 12
-srai s3 s10 19
-addi t2 t4 -307
-addi s11 a5 -318
-divu a1 gp s10
-mulhsu x0 s1 s10
-mul x0 x0 s7
-slt s4 a6 s2
-or s4 a1 a1
-div a2 t0 s10
-sub gp a3 a1
-slt s6 s10 tp
-div a1 s2 a0
-lui s11 463357
-srl a5 t0 s2
-addi s2 x0 -468
-mulh t1 s3 t5
-slt t4 a6 s9
-add x0 t1 s10
-rem t4 t3 a7
-mulhu s3 s6 a4
-srli tp s7 20
-mul t3 t5 s0
-mulh gp s10 x0
-remu s10 tp t6
-auipc s8 181132
-add a3 a7 t2
-slti s9 s5 -1663
-div a3 s5 a7
-srai a2 a0 28
-mulhsu s4 ra t3
-mul gp t6 s7
-divu s9 s7 s7
-sub s1 s4 gp
-addi tp a1 -500
-addi s2 s0 -972
-remu s11 a7 s10
-rem x0 x0 x0
-andi ra s6 835
-slt t6 s4 s0
-sltiu a1 x0 -1999
-srai s3 s6 28
-mul a5 s11 s9
-slti s9 a5 297
-slti a3 t5 -636
-mulhsu t2 s11 s2
-sltiu t6 a1 -451
-rem s2 x0 gp
-srli x0 t5 9
-remu t0 a3 tp
-sltu s6 s5 t6
-mulh a4 x0 s3
-slti t6 a1 -1048
-slt s11 s10 t5
-srl a6 a5 s3
-srli a6 s1 6
-remu a1 a2 t5
-andi s3 s1 -1588
-and x0 s10 a3
+sub a6 s4 s3
+add s8 a6 t4
+sltiu a1 a4 -1482
+srai a7 t6 24
+sltu gp a5 s11
+srli a3 s10 15
+mulh t6 tp gp
+slli s9 s0 16
+andi a6 t0 -1974
+xor s8 s9 t4
+srl s1 s3 a1
+slli a1 s8 0
+srl tp s4 t3
+auipc t6 912186
+mul a0 t1 t2
+slti a4 t1 -369
+mul s4 s6 s9
+mulhsu s5 a5 t5
+mulhsu t2 a3 s10
+auipc gp 653296
+mulhsu s8 a2 a5
+mul a2 t5 t1
+srl a2 t5 t1
+rem t3 s8 s9
+mulhsu t0 x0 s3
+and s6 gp a6
+slt t6 s9 s8
+srl t5 x0 t5
+srli s0 s4 25
+and s8 s2 t5
+div s1 ra a6
+srli a0 t0 15
+andi t0 a2 -1405
+lui a4 445080
+srai a1 t3 22
+sll t5 t1 gp
+divu t2 a0 t0
+srl a1 s10 s10
+auipc gp 849090
+slti a4 t3 -447
+slti a0 t2 597
+sub s6 t1 s5
+mul x0 t1 gp
+mulhsu t3 s11 t3
+srli s10 s2 17
+mul a4 a4 a3
+sltu s5 t6 t6
+xor t2 s7 s0
+auipc t0 548842
+srai a4 s10 30
+srl a4 t4 t3
+sub a5 t2 s10
+xor t5 s9 s2
+xor a1 gp gp
+sll x0 a5 s10
+mulh t3 a1 a2
+mulhu t1 s6 a1
+or s10 t6 a2
+srli s1 a0 18
+andi a4 s10 -1874
+slt t3 t4 s0
+mul a1 t5 x0
+slti a4 s5 370
+slti a3 s0 1926
+mulhu t3 s10 s10
+srl gp x0 t3
+sra gp tp s11
+addi a7 s5 745
+sub t0 t0 s5
+addi a7 s1 -423
+addi s7 a5 -1295
+lui a3 796783
+xor s5 a3 s9
+srli t0 a1 6
+add t1 a5 a4
+xori a2 s5 852
+sll s3 s9 t0
+and s11 s10 a7
+srai tp t0 29
+sltu t0 t0 s1
+sra t1 s4 s8
+mulh x0 a3 tp
+sltiu s11 t4 1604
+srai x0 x0 15
+remu s4 s0 ra
+or s8 t0 a7
+or a6 x0 s4
+divu x0 s2 t1
+sltu s11 s4 s0
+auipc a0 251344
+srli a0 s9 28
+sltiu s10 a5 1657
+mul a5 s9 a6
+addi t0 a3 -684
+srli s7 s1 21
+slli t1 a6 4
+and t0 a3 a4
+sub a1 s6 s5
+add s10 a2 t6
+slt s1 s2 t3
+lui t3 54364
+ori a7 s1 852
+add ra t2 a2
+ori a0 a1 -1135
+xori s1 tp -724
+srli t4 t0 26
+slli s6 s6 8
+div s0 s1 t0
+ori s1 a3 -691
+divu t4 s11 s3
+mulhsu t3 t4 s5
+sub s5 s7 a4
+mulh a3 s5 t2
+sltu t4 t4 t4
+sll s3 t4 s5
+xor a6 s2 t5
+or ra s6 s11
+srl a3 t2 a4
+andi a7 gp -1352
+slli tp t0 30
+andi t0 a2 -831
+div tp a1 s1
+lui s0 543040
+srli s1 t0 22
+xor s10 t0 t6
+addi s6 s8 -1039
+mul a1 a2 t3
+srli s5 s10 20
+mulh s1 t0 s3
+slli t5 s10 8
+srl a2 a1 t0
+div s3 s6 a4
+slt t0 a5 t0
+slti s1 a3 997
+srai t4 s3 25
+mulhu s7 a2 a3
+mulh a7 ra s11
+auipc t3 220892
+slti t4 t1 -1267
+mulhsu a7 t5 gp
+xor s5 tp s1
+mulhu t2 gp a3
+mulhsu a5 s4 tp
+srai s6 s6 28
+sltu x0 t6 s3
+sltiu s8 a1 -130
+sll s3 a5 s9
+mulh a4 s6 s5
+srli t3 s10 24
+and s8 t3 s6
+sltu s5 a7 a1
+auipc t4 669254
+sltiu a4 a0 -815
+rem a3 t3 t2
+sltiu t5 a0 386
+divu a6 a7 s2
+sub gp x0 s0
+add s6 a3 s7
+slli t3 t5 12
+sra t3 a3 s6
+and t0 a2 t1
+rem x0 a1 s0
+xor a2 s4 s11
+addi a5 t5 648
+addi t0 s7 -1412
+mul s9 t6 s3
+sub s6 s5 s5
+and t3 gp a7
+slli a3 gp 0
+xori s7 t1 1630
+lui a3 981371
+mulh a5 a7 s3
+add s1 s8 s0
+srli s8 ra 14
+div s9 s11 t2
+sra a2 s1 a5
+rem a0 s11 t2
+andi s6 t2 -1824
+sltiu t0 a1 1360
+lui s6 347832
+slti gp s4 -1371
+mulh s0 s11 ra
+rem a0 tp s6
+andi s3 ra -833
+auipc a1 899760
+divu s9 s7 t4
+mulhu s2 s8 s3
+mulhu s4 t6 s9
+and s1 t4 s4
+mulhsu gp s3 t0
+slli gp a1 23
+sll a3 t6 t4
+andi t0 s7 -619
+andi a1 t0 -2032
+divu s8 gp s11
+mulh t1 t0 s6
+ori s8 a0 -1431
+sltiu a3 a0 -54
+ori x0 s3 -1435
+rem x0 s11 a0
+slti s6 s7 567
+remu ra s7 a5
+sra a1 s8 s9
+add a7 gp t1
+and s7 s1 a6
+ori a0 a2 -1477
+xor ra a1 t1
+remu s9 s10 s5
+lui a1 922801
+xor a2 t5 a4
+slt a5 x0 s4
+xori s3 s4 609
+or t3 x0 t1
+xori s1 a5 -1920
+add t1 t0 s9
+sub s9 t0 t5
+rem s3 s5 t0
+srl s10 ra a2
+remu t4 a2 a3
+slli t2 s4 3
+xori ra a6 -657
+rem s11 s4 a0
+addi t5 s9 478
+add t6 a0 ra
+andi a3 s4 -2004
+srl s1 t6 x0
+sub t6 ra tp
+mulhsu t1 a6 a0
+slti a7 a5 40
+xor s8 a5 ra
+xor a0 a2 a1
+sub t1 a2 s2
+add s0 gp t3
+divu s4 a2 a6
+slli s6 t5 13
+divu s7 s2 a4
+or s6 gp a6
+div t4 s3 a1
+mulhu a4 a7 t4
+xori a6 tp -8
+srli a0 tp 22
+lui s8 811721
+addi x0 s2 107
+sra s3 s4 ra
+mul a4 s8 s1
+ori gp a7 647
+addi s4 t3 -464
+mulh s4 a3 t2
+lui t6 219882
+div t3 a6 a1
+and a6 a6 a7
+sra t3 a2 a5
+mulhu s9 t6 a4
+sra a0 s6 s8
+mul a3 a7 ra
+mulhu a3 t6 ra
+divu t6 s9 s2
+sltiu tp a2 -1701
+remu t5 a2 s3
+sll s7 a0 a3
+srli a1 t0 19
+remu t2 ra t0
+mulhu t6 ra s6
+auipc s10 10960
+srl a7 s1 ra
+or s8 t6 s0
+slti a0 a3 -1700
+slti t4 s2 -475
+remu a2 t0 s4
+mulh a1 t1 s10
+sltu a2 t4 a5
+sub s6 a5 t4
+auipc s8 1026912
+xor s11 s9 t6
+mul s0 a0 a4
+or s5 a5 s7
+auipc s3 413508
+andi s0 a4 -1515
+xori t2 a4 -1321
+sltiu s0 s11 -1641
+lui a6 308428
+and s10 s10 a4
+or a1 s3 s11
+addi t1 ra -37
+slt a7 x0 x0
+div t5 t1 s6
+slti t5 s10 -1965
+sra ra a5 a3
+lui t5 438958
+srl t0 s11 tp
+srai s11 t1 14
+and s1 s3 tp
+div s5 a2 t0
+sltu ra s7 s8
+sra s2 s2 t6
+sltu s6 t4 a4
+xor a0 a4 t3
+slti t2 a3 -1077
+srl s6 t5 s5
+slti s1 s6 -562
+sll a3 a6 a5
+remu a0 t4 s10
+and x0 a2 t0
+mulh s5 t4 a5
+mulhsu x0 t6 a1
+mulhu a0 a4 s9
+sub s11 a3 s2
+lui tp 575174
+mulhsu s1 a5 s3
+mulhsu t4 ra gp
+xori t2 t5 -1482
+srl s9 a7 ra
+and s9 x0 a6
+ori s10 s4 -1498
+mul a5 s5 t1
+addi a4 s5 1567
+sltu s6 s11 t0
+ori s4 s10 -722
+auipc s4 1027781
+sra a1 s5 a3
+xori s1 a2 959
+sltu s5 t2 a5
+and s9 s0 s2
+sra t6 a0 a6
+or t3 s2 t6
+mulhsu a3 x0 x0
+slt s7 s7 ra
+rem t4 a5 a5
+sra s8 s2 s10
+mul s0 s10 s11
+add s10 t6 s9
+remu s4 s5 a0
+or t4 t6 t3
+sltu x0 s0 tp
+slli t6 t4 23
+xor a1 s4 a2
+slti s4 s6 -1600
+mulhsu a5 s7 a6
+divu s1 t6 s3
+lui ra 118785
+srli a4 x0 28
+srai s9 s4 4
+sub s8 t1 a2
+slt t0 tp ra
+slli s10 s8 13
+slli t1 s11 18
+rem a7 s1 s6
+divu a7 a4 a2
+mul a7 a3 ra
+or x0 tp a3
+sll s0 t0 s0
+ori s2 s6 1981
+add t6 s5 a5
+slt t2 x0 s5
+mul x0 t0 a7
+add s3 t6 s10
+ori s0 t3 -1478
+mulhu t5 a4 a0
+slt a6 s6 s7
+xor x0 s9 t2
+divu a5 gp a7
+sltu s7 a1 x0
+sra a5 s4 t0
+divu t3 a4 s8
+slli t1 s6 1
+slti s1 a3 601
+slti a2 a2 1892
+div s11 a3 a0
+srli gp t2 2
+andi t0 s0 413
+rem a2 t0 s3
+slt s2 a0 a2
+ori a5 a1 957
+auipc s5 538194
+remu s8 s7 t4
+lui t3 189939
+lui t0 132473
+remu x0 a4 s4
+sra s8 s5 t2
+srli s4 s8 15
+slli a2 s2 15
+divu t1 x0 gp
+slli a0 a2 28
+xori a7 s1 1218
+divu a7 s2 t4
+mulhu t6 s7 a7
+xori a4 t4 -1206
+srai s6 t6 16
+mulhsu s8 s11 s2
+xori s6 t2 -150
+slti a3 a4 -206
+mul t5 t5 a2
+srli s10 t5 22
+andi s8 s11 287
+mulh s3 a1 s2
+slt t6 t5 s4
+rem s5 s6 s0
+xori s0 x0 -209
+auipc t1 373884
+or s6 s4 t2
+divu s7 gp s11
+add s7 s0 s0
+addi a5 t4 940
+slli s0 s7 9
+sra s9 a4 a3
+mulhu a6 s0 x0
+and t2 t2 s11
+or t0 tp x0
+divu s4 t1 t0
+mulh t4 t4 t0
+auipc s3 740937
+mulhu s5 t1 s2
+or s10 s3 s0
+slt x0 a4 s7
+mulhu a6 a6 s5
+and s1 a4 s6
+xori s0 s10 1873
+sra s11 s6 t2
+lui s8 215560
+slt t5 s2 t0
+andi t5 x0 -1829
+sra gp tp t5
+rem s7 s8 a7
+div tp s11 a3
+divu s7 s11 s11
+slli s4 t5 20
+mulhu s5 a0 s2
+slti a0 s1 120
+slli a2 a6 16
+andi a4 a3 -117
+mulhu s11 s0 s1
+auipc s2 894399
+mulh t0 a4 s8
+sltiu s0 a0 -1349
+slli a4 a7 7
+slt ra a6 a5
+srai s2 s10 26
+sltu s6 s8 a2
+add a6 s2 s3
+and a7 s5 s0
+xori t4 t2 -649
+remu t2 a6 s0
+sub t2 s7 a3
+addi t3 x0 231
+sltiu s3 t1 -1847
+div t6 t1 t5
+or s0 t2 gp
+or s8 t2 t4
+lui s4 679632
+mul a1 s11 t4
+mulhsu tp t3 s11
+xori t2 s3 -2023
+and s3 tp s8
+ori a5 t6 -593
+sub tp s2 t5
+sra a1 s4 t3
+srl s8 s11 s7
+sltiu s1 s10 -512
+srl s2 t6 t0
+srai s10 t5 12
+srli a0 a4 8
+srli s5 s1 3
+mulhu s6 t3 gp
+auipc a0 354563
+mul ra s0 s9
+sltiu s5 s8 -1242
+xori s11 s2 -244
+sltiu t6 s4 -1466
+slt x0 s4 t3
+sub a7 gp a4
+remu t6 t4 a5
+lui tp 949807
+sub t0 s5 s10
+slli s5 s5 30
+slli s1 s9 25
+xori s6 s10 -602
+div t0 s2 s2
+and t2 a7 s6
+srl a1 t5 t3
+remu s4 s3 t0
+mul ra t2 s6
+sra s2 t2 ra
+divu s6 s9 t1
+xor gp t0 a7
+or s8 t1 a5
+or t6 t3 s8
+srl a4 s6 a5
+sltu t1 a5 t6
+sra a4 t5 a4
+sra s0 x0 s1
+or a1 gp t6
+auipc s11 907119
+srai s11 t4 8
+sub s3 t5 s3
+auipc tp 126913
+mulh tp x0 s3
+srai s1 s8 18
+divu a3 s6 t6
+addi t0 s5 -1644
+addi s8 s9 307
+sll t4 a3 t1
+rem s7 s9 t6
+auipc s9 560394
+mul x0 s6 s11
+divu ra s8 a3
+srl t1 s10 a7
+sub s11 t5 a4
+sltu s8 x0 s1
+sll a6 a2 s7
+sub s9 t1 a7
+sltu s0 s0 s4
+andi a4 s11 -437
+rem t6 t5 t5
+remu t6 t0 s0
+div s2 a1 tp
+slli s4 a0 17
+andi a0 s9 1906
+mul s10 a4 a5
+addi a1 t1 4
+slt tp a3 x0
+sltu s9 t1 a7
+andi a6 gp 1850
+srli s10 t3 15
+slli s10 t5 28
+sra gp s1 a7
+remu s4 gp t6
+div t2 t2 t5
+sll s11 s4 s4
+rem s6 t1 t4
+mulh t3 s7 tp
+slti a7 s4 -406
+auipc s11 487317
+rem t4 x0 x0
+sra a5 tp a2
+ori t1 s7 856
+srli s4 s8 22
+mulh gp t1 a6
+slli s9 s6 6
+addi s1 t5 -196
+auipc t2 458394
+div t4 tp x0
+mul s10 s9 a5
+remu t1 t1 s2
+lui s11 728757
+sub gp gp s9
+sll t2 s0 s8
+addi s9 s3 1265
+xor a5 s10 t4
+andi s6 s6 -1463
+remu a7 t3 a1
+addi s0 x0 -1008
+sll t3 t3 s11
+srli t5 a1 20
+or s4 s7 s1
+sltu s6 a7 t4
+div a7 s2 s2
+sltu a0 s3 s9
+sub s4 gp ra
+ori s0 s10 -1167
+srli t4 s8 7
+sra s6 s3 s9
+srai a4 t3 12
+sltu ra s2 s7
+slti s6 a4 -749
+ori s5 gp -2
+srli s10 s5 22
+rem t3 s5 t5
+add gp a1 s9
+andi x0 tp -1063
+sll s9 a1 x0
+sltu t2 t2 t6
+sub s2 t0 t4
+mulhsu a4 a0 s5
+or t4 a4 t1
+div t0 t0 t1
+sra s6 t3 s9
+sltiu a6 x0 1319
+srl a1 s11 s1
+sltu s7 a3 s7
+srl a2 s2 t2
+auipc t0 745497
+auipc s1 606846
+or a6 s3 a4
+srai s11 t5 10
+ori s7 s7 1415
+add a6 t3 t2
+sltiu s9 a1 1762
+addi a1 t0 21
+mulh s7 t6 ra
+sra x0 a5 a6
+slli s9 s0 20
+auipc s5 72706
+slti a3 t5 -26
+mulhu t2 s6 tp
+sltu a0 ra a7
+mulhu s9 a2 s0
+lui s1 683746
+andi t0 s3 -676
+sub a1 a1 s5
+srli s9 s9 16
+lui ra 882677
+srl s3 s10 s1
+srl s8 s3 t2
+srli s0 t1 23
+sll a6 t1 s0
+mul t5 s0 s6
+slti tp s1 -1589
+andi a1 a5 -462
+slli s10 a6 26
+auipc tp 137239
+or a3 s7 a7
+xor s5 s4 t6
+xor s8 tp s1
+srai t0 a0 9
+sra x0 s3 t3
+mulhu s3 s7 t0
+div s5 t2 s10
+xori t4 s8 -445
+auipc s2 434907
+srl t3 t6 s3
+sltiu a4 s9 -1294
+sra t0 s4 a4
+srl x0 s0 s0
+xori gp s0 775
+sltiu a0 t3 -472
+slti s10 a1 -194
+sra a0 a4 t0
+mulh t4 t1 ra
+add a5 s4 a1
+lui s9 884306
+slli t1 s1 6
+sra s4 t5 a3
+ori s4 s8 -697
+srli x0 t0 2
+mulh s9 t0 t4
+remu s4 a7 t6
+sltu t3 t4 t5
+lui x0 493463
+divu ra a3 tp
+andi a1 s0 -125
+lui a6 699649
+auipc a5 639891
+remu s2 s9 t6
+sll t3 s4 a3
+srai gp s4 23
+srl a7 gp s9
+add s4 s9 a1
+addi s6 a3 423
+slli t4 a3 27
+rem s1 a1 a0
+xor t4 a3 a6
+addi a7 t1 -1410
+mul s2 t3 t4
+sltu x0 s0 a7
+xor x0 s2 gp
+or s10 ra a6
+xor tp t3 a6
+div a3 a4 a6
+lui a2 781205
+sll a2 a5 gp
+addi a0 a3 900
+slti tp t5 1013
+sltu gp t2 t6
+divu a7 s10 s5
+sltu gp t5 s0
+xor tp s7 s5
+remu t5 s2 s9
+div a6 a5 a0
+srli a3 a3 5
+sra s7 a4 t4
+addi t2 t5 -1957
+div x0 a5 a4
+srai a3 a5 7
+auipc s0 195644
+add ra s10 a5
+sra t3 a5 t6
+or x0 a6 a3
+ori s5 t6 1894
+div a0 s2 s8
+slti a0 t0 542
+srai s9 s5 17
+rem t0 a5 s2
+slti s9 a6 -402
+slli t0 s3 14
+srli t2 t5 19
+slti t0 s7 643
+mulh a7 s5 tp
+remu a2 a3 s1
+slli t6 s7 27
+sra a5 s6 t4
+sll s8 s10 t2
+or x0 a2 tp
+andi t4 a0 -1275
+div a5 s1 s10
+sll tp t1 t2
+auipc s3 699655
+mulhu t3 s1 t0
+add s6 t0 s1
+remu s10 s3 s8
+slli t0 t6 26
+remu s0 s7 a0
+ori a2 a1 -1186
+divu s4 t6 t1
+slti a3 t6 -1364
+xor a4 s6 s4
+or s8 t6 s1
+sra a1 a6 s11
+mul a1 ra a7
+sra t4 s6 a0
+mulhsu s1 s0 s1
+srl s6 s4 t1
+div t4 s8 a5
+sltu a1 t1 a3
+sltiu a5 t6 1078
+sltiu s3 a4 290
+mulh a0 t4 gp
+xor s8 a3 t0
+sltiu a4 x0 -1017
+add s3 a7 t0
+xor t5 s11 a7
+sltiu s5 x0 429
+xori t0 t3 1139
+rem a6 s2 x0
+xori t2 s0 -1271
+mulh a0 tp a0
+sll t5 a7 s9
+sra a6 a4 x0
+sltu s10 s6 t5
+or t4 s9 s10
+sra s5 s9 a7
+mulhsu t2 a4 t3
+srli s5 a2 2
+add s1 t0 a5
+div t2 s10 s3
+remu t3 s0 t6
+andi s6 gp 606
+remu a2 a4 x0
+xori a0 gp -686
+lui s2 692453
+mul ra s0 s9
+lui s1 700959
+add a2 s4 s10
+lui a5 587378
+sll s10 a0 t3
+add s8 s7 t3
+mulh a6 s0 tp
+sltiu a6 s3 260
+srli tp x0 2
+sltu ra a3 t1
+srli s9 s6 1
+divu a0 t2 t4
+auipc tp 869662
+auipc ra 841676
+xor s3 s10 t0
+lui gp 103172
+sub a4 a1 a6
+ori s4 t4 -833
+and s8 a7 s8
+slti s10 s11 -196
+mul s6 s5 s10
+mulh s10 s11 s2
+srl gp s7 a6
+sub t3 t3 gp
+sra t0 a7 s4
+add t5 t0 s7
+auipc t0 585749
+slli a0 a1 16
+sltu a4 gp t3
+xor s2 a0 s10
+mulhu s3 a5 s8
+mulh a1 a1 a3
+slli t6 t3 2
+mulhsu a2 s10 a3
+slti t5 s4 864
+xori s4 s6 -1201
+and s4 t4 t5
+andi s1 t6 1313
+addi s10 s6 -1548
+andi s7 t0 603
+sll s5 s11 t6
+srl a0 a2 s7
+addi a7 s8 -174
+sll s5 t1 s3
+addi s11 gp 824
+slti gp s5 1783
+xori s8 a1 -81
+mulhsu a3 s3 a0
+or s6 s11 a2
+andi s8 gp -1835
+addi s6 s9 -764
+and gp a1 s2
+divu s0 s2 s5
+srl s5 a1 a5
+andi s11 s4 -1506
+and t0 t0 a4
+mul a5 t5 s3
+mulh s5 s5 t2
+mul s4 s5 a0
+mul s5 s7 s11
+srli s1 a1 5
+xor s2 s4 s3
+mul s7 a1 a3
+remu s6 t3 t3
+auipc tp 650838
+lui a6 278904
+sub s0 t5 a3
+mulhu t0 s0 s6
+andi a7 t5 1104
+srl t4 a4 s2
+srli s4 a6 26
+and a1 a1 gp
+ori s3 s6 -165
+or t3 t5 s9
+srli a5 ra 26
+and s1 t6 a5
+slli t0 s11 6
+xori t4 gp 145
+mulhsu s11 a3 a7
+sub tp gp a3
+mul s8 s2 s8
+rem s0 gp s10
+mulhu ra s10 a7
+auipc a1 688504
+srli t1 t5 30
+xori t4 x0 -578
+srli a3 t4 23
+sltiu s8 a4 584
+or s0 s7 a6
+xor t1 t6 s6
+andi s5 t6 716
+slli a2 a7 14
+remu s1 s2 a7
+rem s11 a3 s3
+slt a7 gp a0
+sll s3 s11 t1
+sub s10 s1 s1
+slti s4 x0 -1009
+sub t4 t4 ra
+rem a5 s6 t6
+and x0 s9 x0
+sra s11 a1 a6
+srai s8 a7 28
+auipc t5 895129
+rem t5 s4 s9
+remu s5 s8 t5
+rem t3 s7 s4
+andi t4 t0 -1580
+lui a1 738759
+divu a5 s2 s7
+div t2 a1 ra
+slt ra a5 a5
+xor a3 tp s2
+rem a7 a6 s6
+lui s7 490712
+auipc s6 1008633
+sltiu gp s9 1581
+xori t2 a4 -1999
+mulh a7 a0 t2
+srli a3 t2 11
+divu s0 x0 s8
+xori s7 t6 -1329
+slti s11 s1 -474
+srli t0 a4 21
+auipc a3 27892
+andi a7 s11 -1099
+mul t2 x0 s8
+srai t1 x0 16
+mulhsu s0 ra t4
+xori s8 s11 -127
+mulhsu t5 a6 a2
+slt a6 t0 tp
+slli x0 a5 2
+add a6 gp t0
+rem a5 s2 t5
+slli a6 t4 24
+ori t4 s8 566
+lui s6 833032
+add s10 gp a7
+lui a4 1029996
+slt t1 t0 gp
+sub a1 a1 t6
+rem s5 gp ra
+mulhsu gp s6 s9
+xori a0 t2 -925
+remu t2 t4 s5
+srl s9 s11 a4
+and s6 a4 t3
+srl a2 s0 a6
+xori a1 s0 -1190
+slli s0 s1 31
+sll s0 a3 t5
+remu t2 a4 t2
+sll s10 x0 s5
+mulhu t3 s1 a5
+lui t3 498899
+addi s1 s5 -2036
+slt s4 s8 a2
+rem a3 s10 a2
+or tp t3 x0
+srai s7 gp 9
+divu ra s10 a6
+sltu a6 s3 a1
+add t6 s0 s5
+srl s10 s1 a7
+sll s8 s4 a4
+mul a2 s2 ra
+rem gp ra t6
+ori s1 a1 1231
+sltu s7 s6 a6
+mulhu a6 t0 t2
+rem a7 a2 s0
+srl s9 t1 a4
+srli a3 s7 5
+mulhsu t5 x0 x0
+slt a6 a6 a2
+remu s7 a1 s3
+div t6 t6 s11
+srai t5 a1 15
+sltu s2 t2 s6
+remu a5 s7 s5
+sra s0 t1 gp
+or s3 t1 s3
+srl s2 a2 s11
+auipc s1 693929
+ori x0 ra -991
+srl a5 ra a7
+srai a0 t1 15
+lui t1 560303
+remu s9 s1 t6
+add s1 t2 t3
+slti s9 s8 -641
+sltiu s8 t5 -1742
+mul s2 s11 s8
+mulhu s7 a2 s7
+slli a5 s6 12
+slli s1 t4 23
+slli s3 a7 2
+div t5 s6 s8
+or s0 t1 s4
+auipc ra 675574
+andi a0 a0 -1150
+div tp t1 t5
+lui s7 886070
+addi a4 s3 405
+srl ra a4 s1
+and t1 a4 s6
+slti t2 s0 -913
+slli s3 a1 23
+divu a3 t4 s11
+addi t4 a3 -470
+addi ra s7 374
+sltiu s2 a7 -273
+slli s3 t1 3
+mulhsu t1 t2 t6
+andi x0 t2 -790
+sltiu s2 a1 -156
+mulh s8 t6 s4
+srai tp a2 20
+sub a7 x0 s5
+slli a1 a6 26
+add s5 s6 t5
+slti a1 a1 1206
+slt t5 x0 a7
+div ra a2 s1
+mulhsu s3 s11 s1
+mul t6 a0 t4
+srl a1 a3 a3
+srl gp t3 gp
+mulhu t3 s5 a3
+addi a6 x0 -1048
+sll t3 t0 a2
+sltiu t4 s1 1183
+slt t3 a7 s3
+mulh t0 s4 ra
+srl t5 a6 ra
+add t3 s7 s2
+srl s4 s5 x0
+slt s1 a4 t5
+div s2 a1 t3
+lui a5 103076
+lui s8 922883
+add t2 s6 s10
+mulhsu gp gp s4
+srai s11 a7 13
+div t0 a6 s3
+mul s6 t4 a1
+div s11 a0 t6
+divu s2 s9 t2
+lui s0 147895
+remu a4 a1 s11
+auipc a4 385784
+sltiu tp gp 450
+andi a7 t4 1670
+srli s4 s1 10
+ori ra a7 -85
+auipc a3 505825
+xor s5 tp t4
+addi a7 a4 -2042
+or a4 a1 t1
+sra ra t5 s8
+ori s3 a5 1700
+xor a4 s4 a2
+addi s4 t2 -143
+rem s5 t6 t0
+add t6 t4 s4
+andi x0 t1 322
+mulh s8 a5 s6
+slt t5 tp s5
+xori s4 x0 -1315
+mul s4 a6 s0
+sll a0 a6 s5
+divu a1 a6 s7
+auipc t1 773201
+xor t2 s2 a0
+sra a2 s8 a4
+div t5 s1 a1
+sra a7 a1 t2
+srli a7 a0 2
+sltu t3 s7 a4
+xor s7 s3 t4
+auipc t4 416677
+srl gp a3 s9
+ori tp t5 1044
+sll a0 s6 a2
+sltu a1 a4 s11
+slli s10 s6 24
+sra s8 a7 s10
+lui x0 614404
+sub a0 t0 t1
+mul t3 a0 s10
+srai s9 s9 16
+ori t4 s2 1843
+sub s10 a4 a3
+rem a1 s0 x0
+ori a3 s5 -293
+addi a0 t0 -171
+srli s5 t6 19
+rem s2 s11 tp
+sll ra s1 a1
+lui s11 551005
+add s9 gp a0
+srl a7 t5 gp
+mul gp t0 a5
+slti t2 t4 1104
+mulhu s4 t3 a7
+addi s3 t3 -653
+srai t0 s2 16
+xori s11 s8 1106
+add a2 s6 t0
+sra t2 s7 a1
+mul s1 t4 s10
+xori t4 x0 -104
+add gp t3 a4
+auipc s6 773281
+lui tp 428092
+auipc t2 234247
+mulh s8 a4 tp
+sra t0 t5 s9
+mulhu t0 s4 s2
+andi t1 t1 1955
+mul s5 t6 s2
+mul s6 s1 t0
+srai t2 a1 28
+and a6 s3 s11
+addi s5 ra -585
+sll gp t4 s1
+addi a6 s6 -568
+lui s2 512961
+and s3 s7 tp
+mulh s0 a4 t2
+lui gp 75409
+andi a6 s3 -1174
+srli s2 a4 28
+xori t0 s7 976
+mulhsu a5 a6 gp
+ori t2 s7 289
+srl s0 a6 s8
+sll a7 s6 a6
+sltu s9 gp s2
+div s10 t1 s1
+xor s1 a0 s8
+andi s3 s3 -662
+sra a4 s4 ra
+divu x0 ra a1
+sltu t2 a6 tp
+mulh t3 gp s3
+lui a3 507904
+srai t2 gp 3
+sub s2 s2 a1
+xori s7 t0 -562
+rem a4 t5 s10
+remu s2 s9 s5
+sltu t1 s9 t5
+sub s8 a4 a7
+mulh s6 x0 a3
+slti a6 s7 538
+sltu tp a7 tp
+srl t4 ra s2
+mul s11 a3 s4
+xor a3 s7 t0
+mulh x0 x0 s7
+sub x0 s7 a5
+auipc a3 22820
+slli a7 t3 4
+srli x0 t1 17
+mulh s11 s8 t4
+slti a7 s7 978
+and a7 s8 s3
+mulhu a3 t6 s10
+srl s7 gp s2
+and tp s6 ra
+sltiu s8 a5 -2003
+mul a2 s0 s9
+srl a6 gp s0
+mul s7 a1 a1
+divu s8 s0 a1
+slli a3 a6 9
+remu a6 s8 a4
+addi s6 t5 418
+mulh s1 s10 s4
+auipc a6 53354
+srai a5 t3 16
+xori t0 t6 -1802
+rem s9 s2 gp
+slti t5 a5 -1265
+mulhsu a6 s3 t2
+rem s9 a4 ra
+mulh s4 gp t4
+add s8 s6 t6
+sltu t0 s9 t0
+srl s9 t0 a7
+slt a2 s3 s0
+mulhu t3 tp s5
+mulhsu s1 t1 t4
+sll a0 s7 t4
+div s1 s5 s4
+divu t0 s10 s0
+srl gp a1 a7
+lui s6 665248
+divu a7 t4 t3
+addi t4 s9 -1404
+mulhsu a5 s9 s7
+sltiu a5 s7 -1333
+xori s7 a6 1719
+srli s11 s9 12
+rem s5 a4 a6
+srli t1 a2 24
+lui x0 669577
+sltiu s8 t1 -1710
+auipc gp 937415
+lui x0 652314
+srai s3 tp 7
+mulh s4 a3 t1
+auipc x0 525018
+andi s2 s5 903
+slli s9 s8 17
+mulhsu tp x0 ra
+xor s8 t2 ra
+divu s8 t6 a6
+sub x0 s0 t3
+sltu s5 s0 s0
+sra s9 a6 t5
+ori s11 a2 -44
+srl s3 ra s9
+sltu tp s6 s4
+mulhsu x0 x0 s3
+andi a0 s8 347
+remu s2 s4 ra
+add a1 a0 a6
+auipc t5 669173
+slti t5 t0 1059
+sub s4 t2 s8
+sll t1 s11 a0
+add t6 s6 s4
+slli s3 a4 0
+xor t6 a3 s5
+mulhu s11 s9 x0
+rem t3 t5 t6
+srai s3 ra 0
+slti s7 t3 -388
+rem t4 s11 gp
+div tp a0 t5
+slt s9 s3 x0
+slti a6 s4 1201
+mulhsu s4 s10 a1
+remu s9 s11 a7
+ori t5 a4 -281
+div t3 a7 t6
+srli gp t5 4
+xori t1 a7 -1324
+srl a1 ra t0
+add s2 s5 t0
+and a7 a3 t6
+rem t5 s10 a3
+divu gp t5 s8
+srl t1 s9 tp
+and s6 ra a4
+rem s5 a5 t3
+sub s10 a3 a7
+mulhsu gp a6 x0
+xor a2 a4 s4
+mulh s3 s7 s11
+srai ra t0 4
+and gp gp a7
+mulh a2 gp a1
+ori a2 s5 -242
+sltiu tp a3 1968
+ori s6 t4 -482
+andi s0 s1 1939
+mulh s3 ra s5
+mulh s4 t0 ra
+sub s2 s4 a2
+mulh s1 s0 a0
+andi t0 gp -1856
+sltu a6 s7 a3
+ori t2 a4 -1549
+lui t3 468701
+mulhsu t1 s2 s4
+slli t2 t1 15
+and t0 a6 tp
+or a2 a1 a0
+lui a7 967563
+mulhsu a3 t5 t0
+mulhu ra s10 t5
+sub t1 t6 s8
+slt s7 t3 s4
+mulhu a5 s11 a3
+srl t1 t3 a5
+or t0 t0 a1
+or t4 t6 gp
+mulhsu t3 a5 a3
+rem gp s5 t6
+slt s4 a7 t2
+addi gp x0 -1718
+slt t0 t6 t0
+sub a4 s7 s3
+sub s11 t4 s10
+divu t4 a1 s5
+sltu a0 t5 s7
+sltiu s10 s8 1175
+andi t3 a0 -827
+auipc s2 733268
+ori s6 ra -1493
+sll s6 gp a1
+and a7 ra t4
+sra s10 a7 t3
+slli s7 s8 25
+sll a5 a1 t6
+or a1 t2 a7
+mulh x0 s8 t4
+sub gp ra s7
+slt s1 a4 s10
+xor tp t4 a0
+srli s6 gp 6
+mul s0 a2 a3
+srli t1 a1 2
+xor t0 a4 s10
+sltiu s10 a6 -1787
+mulhsu t5 t4 s1
+and gp s11 s2
+mulh s7 gp a6
+or t5 a0 t5
+srli s2 t2 13
+sub s6 a5 a2
+srl s3 s10 s4
+slt s8 a1 s4
+srl tp t6 a1
+slti t0 gp -1803
+sltu s9 s1 a0
+srli a2 t0 20
+lui s6 870985
+rem t0 s7 gp
+add s11 t6 s10
+srli t3 s9 12
+mulhu t3 t2 s5
+sra s3 t1 a6
+divu a7 s4 a4
+srl a4 s7 tp
+divu tp s5 s8
+xor s4 s2 s4
+rem s1 s1 s6
+slti s3 gp -1016
+mul s0 a3 a6
+rem gp x0 s3
+slli s2 t4 15
+xori t2 s4 -1169
+slli t1 s7 16
+xor s8 a3 s0
+divu tp a3 x0
+remu t2 s8 a7
+mulhu s6 s2 t4
+srli a2 a7 22
+andi a2 s1 750
+mulhsu t6 s0 gp
+remu a7 x0 a7
+slti t5 s0 -559
+sll t4 gp a6
+lui a6 936847
+lui x0 376905
+xor s11 t4 x0
+div s6 t6 a1
+add a1 a1 a2
+remu s7 t1 t0
+xori t2 ra 739
+and t2 s3 s6
+slt t1 a7 s6
+slt t5 t1 s7
+sll s8 a6 s7
+or tp a2 a2
+sltiu a3 s0 -668
+div t0 a7 ra
+srl t5 t3 s7
+xor s10 s5 t2
+or t3 s4 a3
+sll x0 s6 s3
+srai s6 a0 28
+lui s5 115069
+slt a4 s9 t4
+srl a3 t2 s0
+or s1 x0 s11
+mulhsu x0 a1 t6
+auipc a0 678849
+sra s7 s5 a0
+add t3 t3 x0
+lui tp 804051
+ori a5 s6 -1542
+rem t4 a3 s11
+sra s9 t2 a5
+sub s2 a4 a5
+slti t4 s3 -111
+mulhu s11 t2 t2
+sll a7 a0 gp
+mulhu s3 s4 s11
+mul a4 a2 s1
+addi s5 s5 -1826
+slti t4 a5 -1827
+div s9 a6 s11
+or a7 s3 a0
+xor s4 gp s5
+xori s8 a0 1603
+remu t0 a4 t2
+addi t4 t5 740
+mulhsu s1 ra s0
+slli t0 s9 22
+slti s2 a0 -1491
+sltiu s3 t6 856
+mulhu a3 t6 a1
+rem t6 s9 s0
+sub s7 t2 s10
+srai s2 a6 3
+andi a2 a1 -2024
+xori t2 s1 -1296
+xori t4 t0 -1051
+sll s8 s4 s4
+srai t4 s5 19
+remu s1 a7 t6
+divu gp t4 t3
+auipc a4 327025
+addi s1 s4 -785
+srai a0 a4 24
+slli x0 a6 21
+add s2 s6 t5
+sll tp s9 a4
+slli s2 t5 15
+mulhu gp t1 s7
+mulhu t1 t4 a5
+sltu a7 t0 a4
+auipc t6 904487
+sltiu s5 s1 909
+mulh s11 a2 s1
+auipc gp 913681
+sltu t3 s4 a5
+sltu t3 s9 a0
+ori t3 t6 -561
+or t0 a2 s0
+slti a2 a2 -923
+mulh a2 s5 a5
+auipc s7 86855
+srai s2 t0 28
+srli s11 a6 31
+divu a7 ra t0
+auipc t5 543965
+sltu s3 a0 a4
+srl tp s11 t1
+mulhu s2 s6 a4
+auipc t0 734492
+slti s9 t3 -1355
+slti t6 a7 -1250
+sltu x0 t4 s4
+mulhsu s7 a1 t0
+or s1 s1 s6
+xor s8 t6 ra
+mulh s6 tp s10
+mulh ra s11 a7
+slt t5 s5 t1
+auipc a0 722084
+divu s3 a3 a2
+slti s3 t5 -1572
+xor t1 t4 a3
+mulhu t4 a7 s1
+and gp s3 s1
+sll t5 t5 s7
+andi x0 s6 -1154
+sll s4 s2 t5
+rem s2 s11 ra
+srli t0 a3 30
+or s1 t4 tp
+div s4 s1 s2
+divu s5 s3 s6
+ori a5 a4 1953
+mul s3 gp t6
+divu a4 t3 t2
+srli s4 t3 11
+sra a2 s4 a5
+slt a1 s1 s1
+lui a3 398527
+xor a5 x0 tp
+div s8 t2 t5
+remu a7 a3 s6
+divu a1 a3 s1
+xor s1 s3 a1
+and t4 t1 ra
+slti t2 tp -1282
+or a7 a4 a7
+sra a3 s4 gp
+remu s2 s6 s0
+sltu x0 t5 gp
+or s4 a1 s6
+mulhsu t1 t1 s6
+or s10 s1 a4
+divu t3 t6 a7
+auipc a0 529264
+mulhsu s6 a3 s6
+divu a2 a2 a3
+sll t0 s8 tp
+add a1 a0 t4
+andi s9 s7 1234
+mul t3 s2 s0
+lui s5 215434
+mulh t2 s7 s10
+slt s9 a4 t0
+srai a1 s9 25
+addi t2 a5 -1500
+sltiu s3 t3 -1944
+srai s7 a1 8
+rem a4 s7 a2
+lui a1 521393
+ori s0 gp -1538
+or s8 a0 a5
+andi t6 a0 1824
+auipc s0 529011
+slti s4 x0 -456
+xori s10 s4 -18
+xori t0 s5 181
+mulhsu ra s10 s10
+sltu t6 t0 t5
+xori s1 t0 -1545
+srl a3 t6 s4
+lui a5 80395
+remu s4 a3 s0
+srli a7 a5 3
+xor a7 a0 a6
+sltu s2 s6 s8
+ori s8 t0 336
+sltiu a2 a0 1036
+or t3 s11 x0
+sub a7 a1 t3
+xor t3 a4 s9
+div t6 s0 t5
+srl a4 a3 a2
+xor s0 t5 s11
+divu a0 s0 a2
+sltu s8 s6 s9
+add s11 gp t2
+slli t4 s11 9
+srli x0 a4 20
+sra t6 a5 s6
+srl s3 x0 t0
+mulhsu a5 s10 t4
+add ra ra a1
+sra s10 s6 s0
+slli t6 s7 23
+xor a7 s4 t6
+mul s0 a7 a4
+or t2 s2 a5
+sub s7 s0 a0
+divu a7 ra s5
+srai t6 s10 22
+mul s3 gp s9
+mul t0 s9 t5
+lui a0 795374
+or a7 t5 s4
+srl tp s8 t3
+addi a0 t1 723
+slli s6 s1 18
+slt a1 t5 a3
+sra ra t0 a2
+slti a0 a5 -22
+srai a5 s5 19
+sll s2 s0 x0
+lui a2 685832
+slli t6 gp 8
+sltiu s10 s10 -1516
+div t6 ra tp
+xori s4 s10 -1828
+ori a5 a1 118
+divu a0 s5 tp
+mulhsu t0 a7 a5
+xor a0 s9 s11
+mulh s2 t0 tp
+sub s2 s5 a6
+slt x0 t4 gp
+sub a5 x0 a0
+mulh s1 a5 s9
+or t0 x0 a3
+div s11 a2 ra
+andi t5 s11 -1462
+sltiu a3 s4 1278
+slli s4 s1 12
+mulhu t3 s4 t3
+srl t1 gp t5
+mulhu gp s1 gp
+mulh t4 s8 s0
+lui t2 389447
+slti t4 s1 136
+add gp s3 t2
+remu s7 s6 t2
+remu tp ra a1
+slli ra t4 1
+addi s10 s10 -1824
+srli a2 t6 1
+andi s3 t1 -1542
+auipc t0 40660
+add t6 t5 s1
+add s6 s9 s6
+or a6 s4 s6
+andi ra a0 -1537
+srl a4 t3 a4
+srai a5 s6 0
+div t3 t0 t5
+sltu gp s10 s10
+xor x0 a4 a6
+and a1 s7 a5
+slti ra t1 -844
+or a4 s8 t4
+srai s1 s2 22
+sltiu s9 s11 487
+andi s9 s0 -1824
+sub s11 t2 s11
+or a1 a2 s10
+divu a6 a4 t4
+xor s0 t4 s1
+auipc t5 955663
+div t5 a4 gp
+sub s7 s9 t6
+div gp s7 t1
+add t6 tp s11
+xor s10 s6 ra
+xori t1 s6 1409
+slli a4 t0 4
+mulhu gp t6 s9
+ori a4 t2 -230
+xori a7 a5 970
+xor s1 s4 s10
+xori s3 tp -1708
+div a2 t2 s11
+auipc a3 452393
+sub s8 s3 s3
+add a1 s4 a5
+sub tp a4 gp
+xori t4 s5 -391
+srli s3 s8 11
+ori s2 a1 456
+andi s3 s9 898
+sra s0 a7 s11
+divu gp a0 t6
+div s2 s9 t1
+ori s5 s8 1240
+srli a5 a4 11
+lui t4 745824
+ori a3 a7 -243
+mulhsu s3 s9 a1
+slli t4 t4 28
+ori s10 a4 61
+mulhu ra gp s3
+mulhsu s11 s10 t1
+srai s6 a2 29
+rem t3 ra a1
+sltu s8 s6 s9
+mulhsu a7 t3 s7
 remu s11 a4 a5
-ori s3 s9 1786
-xori s7 t5 1127
-xori a6 t0 -584
-xori t4 s1 -1384
-xor ra s11 s8
-mulh s11 tp a4
-sltu t6 t0 ra
-slli ra t1 28
-auipc a1 508275
-mulh s7 s11 s0
-divu t1 s7 s5
-srai s1 s4 26
-ori a6 a0 -2043
-sll s6 s7 a3
-and s0 a3 t3
-mul s6 t5 s5
-divu s10 a6 a1
-sltu t6 s5 t5
-sra s2 s1 a6
-sub x0 t6 s1
-and a6 t1 t1
-slt t2 a3 s3
-sltiu s3 ra -821
-xori t5 a3 2039
-xori a6 t3 1818
-sltiu s4 a3 -28
-mulhu s11 t6 a7
-srli s3 x0 29
-sub s11 x0 t5
-srl t2 tp a0
-srai tp s1 5
-lui t1 437663
-srai a0 t5 26
-divu s11 t6 s5
-remu s3 s6 t3
-srli s10 t5 10
-slt s6 s1 s8
-mulhu t3 s2 a5
-mulh gp s7 x0
-div s4 s9 t4
-div a2 x0 a2
-srai a7 a2 18
-sltiu t6 s7 -766
-srli a0 a4 31
-ori gp s11 -1430
-remu s0 a1 s7
-sltiu s6 s11 -149
-rem s3 a5 ra
-slli a0 s4 28
-addi s3 gp -1803
-or t3 t5 x0
-divu t2 s8 a7
-addi a5 s4 -1090
-rem t3 t2 s3
-addi a4 s6 444
-slti a7 s5 1447
-sub s4 s8 a7
-auipc t5 204860
-slli s8 s7 31
-or ra tp s0
-xori a0 s6 -604
-sltu s1 s2 s8
-mulhu a1 s1 t3
-srl t4 x0 s4
-and t1 a1 s11
-ori t1 s2 -154
-xori t0 gp -1955
-sltu t2 s8 a4
-mulh gp gp x0
-div s1 s9 x0
-xor s11 x0 x0
-add a1 a6 x0
-srl a0 s6 t1
-andi gp tp -773
-lui t6 227631
-lui tp 994139
-srai s11 s3 21
-slt a3 a4 s7
-addi s4 s2 -58
-slt gp s3 t0
-sltu s4 t2 x0
-rem s11 a3 s1
-sub a1 s1 t3
-mul s11 s1 s0
-rem s8 t1 s8
-div a4 t4 s0
-mulh s7 t1 x0
-sltu a4 a2 s7
-sll t2 s5 a3
-rem ra s3 a4
-ori s0 x0 849
-or s9 s11 tp
-add ra t1 t1
-srl a3 t4 tp
-sltu t0 s3 t4
-div a2 ra s6
-and a6 a6 t3
-lui a5 961615
-divu s8 s5 a6
-addi t6 t3 1239
-sll t5 s3 a0
-sltu a4 s3 s4
-mulhu x0 a3 gp
-and ra s9 x0
-srai tp s6 22
-mulh a5 s7 t3
-divu s6 s11 t1
-rem a2 s8 s3
-mul ra a6 s2
-remu a6 s0 a6
-sll a5 s3 t4
-mul t6 a5 s1
-sra s11 s11 tp
-andi s5 s3 953
-sra t3 a4 s10
-sltu s9 s3 a3
-auipc tp 169180
-ori a2 t0 1973
-slt s0 t6 a4
-sltiu t1 s4 -1013
-srai gp t0 23
-or t4 s9 s1
-lui s9 426736
-lui s6 69671
-remu gp t3 s9
-sra s11 t3 s10
-slli t1 a0 26
-mulhsu a3 a6 s9
-xori t1 s9 1344
-slli s7 s11 7
-slli a7 a7 5
-slt a5 s0 s4
-xor s6 a7 s9
-div t5 x0 s11
-div tp s0 s11
-sll s11 s6 a0
-rem s3 t3 a2
-slti s7 t3 622
-sub s11 s6 x0
-divu a7 a1 s1
-sub t4 t3 tp
-slli x0 t5 30
-mulh t5 s6 s6
-add s7 t2 x0
-sub a4 t5 a6
-add t3 t2 a3
-srl a4 s10 s10
-rem x0 s4 t4
-sltu s0 s4 t2
-lui t3 549612
-mulhu s8 x0 x0
-auipc s3 306271
-sltiu gp ra 684
-divu t0 a6 s5
-and a2 t6 s2
-lui t3 571634
-mulhsu tp tp t1
-sub t1 s9 s4
-and s9 a4 t5
-remu t3 t3 a1
-xori tp t5 -1416
-auipc a2 284290
-srl a1 s3 a3
-mul s4 x0 t6
-andi t1 t4 -981
-div a4 t1 a7
-div a3 x0 t0
-add t0 t0 a3
-slli t5 s11 12
-mulhsu t6 s3 t6
-ori t5 s4 -508
-srl s1 s6 x0
-mulhu s5 s4 s4
-addi s7 ra -2046
-rem a7 t0 tp
-srl t3 t0 a0
-or t4 x0 s4
-xor tp t3 s11
-and s2 s8 s4
-divu a5 a6 s3
-sra x0 s10 s0
-andi s4 t1 -1407
-addi s11 s7 1809
-addi t4 a4 -714
-divu x0 s11 s10
-mul t6 s4 s10
-or a1 s4 a5
-sll t3 a2 s8
-rem t4 t5 s1
-sub s1 a5 t4
-auipc t0 640739
-andi s5 s10 -117
-andi s8 t1 765
-auipc s11 255177
-auipc tp 540871
-mulhu a4 t4 s9
-mul gp x0 s9
-divu s5 a7 t0
-or a5 t2 t0
-sll t0 t5 a3
-divu t4 t0 a0
-srl a3 s11 s9
-sltiu a7 a5 -828
-andi a4 t4 -1514
-lui a7 522770
-mulhsu s11 t1 gp
-srli t1 a5 7
-slti a6 a1 -618
-slli t5 s0 10
-remu t3 tp a0
-sra t6 t4 s6
-divu a1 a2 a3
-addi s5 s1 -597
-slt t6 t4 a3
-mulhu a6 a3 ra
-ori s6 s0 -96
-slti s6 gp -926
-sra t4 s9 s2
-lui a7 213522
-sll gp s7 t4
-add a0 s4 a3
-mulhu s8 a2 s11
-and a5 a6 t6
-rem s6 s0 s7
-srli ra x0 16
-divu s2 s1 a5
-mulh tp a0 s3
-and a6 a4 s10
-mulh s1 gp x0
-andi t6 s11 -57
-srl a5 s10 a6
-mulh a2 s8 t0
-add s5 s6 a7
-and s3 s8 s10
-srl ra s5 t0
-auipc t3 277825
-and t4 a3 s11
-srli a4 t4 24
-andi t6 s0 -1393
-srli a0 t1 17
-xor s11 t2 s11
-mulhu a7 a3 x0
-ori s3 s7 -1997
-mulh t6 s6 s3
-sub s5 a6 a0
-sra t1 x0 s9
-slti a6 s6 -249
-auipc x0 945931
-slt a2 s1 a1
-xori gp a2 2043
-mul a7 a4 a2
-remu a2 tp a7
-ori t2 tp -1169
-srli a6 t3 0
-sltiu tp t1 1219
-auipc t5 668531
-sub s8 s9 t0
-sll a0 t5 s6
-xori t3 x0 -266
-or a3 s6 s11
-slli s0 s9 16
-auipc s11 643952
-srl x0 t3 t6
-srai s5 gp 16
-auipc t6 441902
-srai a4 s0 8
-xor s3 s2 x0
-lui a6 626939
-ori a0 t3 -1889
-ori t1 a5 -1941
-lui t5 225134
-srli a2 s6 22
-sll s0 a1 a5
-ori s5 s5 1535
-addi tp s7 -2030
-remu a6 s4 s3
-srli s8 s9 24
-mul a3 s1 ra
-addi s0 t1 -1392
-and t0 t6 x0
-addi a4 t3 -984
-ori s8 gp -159
-or t2 a3 s8
-sltu s1 tp t0
-sll s5 s11 s2
-mul s10 s11 tp
-and s3 a2 t2
-srli s8 s2 26
-ori s0 a1 1806
-sltu a7 s9 s10
-sra x0 a6 s3
-slt tp s9 gp
-rem x0 s11 s7
-sltu t0 s4 x0
-sll gp tp s6
-remu s6 x0 t0
-addi t0 t3 -533
-mulhu s2 s0 s1
-slti t0 s3 -262
-mulh t1 s5 x0
-mulhu s7 a3 x0
-mulhu a0 s0 gp
-slt a2 a1 t2
-sub ra s2 t0
-and s9 s11 a5
-srai s0 s1 21
-sltiu a4 t2 -1359
-remu s5 ra s9
-xor s11 a7 s5
-sltu a1 t2 s6
-or t6 s4 s6
-andi s5 a5 992
-mul s3 a2 s1
-ori t2 s7 -259
-or a0 a7 s7
-divu s1 s10 a7
-remu x0 gp x0
-div s7 s10 s10
-and t6 a3 a7
-div s4 t4 s9
-sra t3 gp t4
-auipc s2 168448
-srai a6 x0 0
-rem a7 t2 a0
-andi a6 t4 346
-auipc a5 929001
-xori a5 tp -696
-remu a2 t0 t6
-div t1 s5 s1
-sra x0 gp a3
-auipc a3 105206
-remu a0 ra t0
-sltu t5 a2 s2
-xori x0 t1 -1526
-ori a2 a7 1176
-div s7 a0 ra
-andi t1 t4 -607
-sltu a6 s11 s5
-ori s0 t0 -1597
-slli a0 a6 26
-sltu s10 a4 s8
-ori t0 ra -109
-srai t6 s0 4
-or tp t5 s6
-lui s9 630743
-slli ra a3 11
-mulhu t3 t4 ra
-xori s7 a0 -42
-xori gp s4 -226
-sub a1 tp s3
-or s3 tp a6
-sltu a5 s9 s4
-lui s11 9101
-srl tp a5 t6
-sub gp s0 a4
-and a6 s10 t4
-sll s8 s5 t5
-sltiu s1 ra -410
-and s11 s8 s5
-xori s9 t1 1635
-sltiu t5 a7 -1235
-srai t0 gp 23
-slti x0 x0 846
-srl x0 s8 s0
-andi s5 a4 -1984
-slt t4 t4 s5
-or s3 a7 x0
-slti x0 t3 1972
-mul t2 a2 tp
-or a1 s1 s3
-rem t2 t5 s0
-sll s4 s5 x0
-srai a0 a6 28
-sub s9 a5 a0
-rem a5 a0 s4
-sltiu s7 a7 -827
-sltiu tp s1 1670
-div s9 a1 a6
-srai s6 gp 19
-lui s5 549762
-slli x0 a1 4
-sra tp a3 t6
-slli a6 s1 28
-sra x0 a1 a1
-divu a6 s5 t6
-addi ra s7 -1146
-addi s3 t2 -1163
-srli t1 a3 26
-sub a5 s6 tp
-rem a6 t3 a1
-rem a5 gp s4
-slli s11 s4 1
-sll t2 s10 s5
-mulhsu tp gp t1
-ori x0 a7 587
-add ra a2 s9
-slt s8 a6 s11
-divu a0 s9 s3
-srai t0 a6 31
-div x0 a4 a1
-mulh t1 tp a5
-divu a7 s1 t5
-andi t5 s2 -1728
-srl s7 a1 s7
-srl gp a2 s6
-lui s10 777823
-and s11 s3 a0
-addi s2 s3 242
-sra gp s0 x0
-sub s4 t0 t3
-sub s9 a2 a0
-mulhu t1 s5 a6
-mulh s6 t5 tp
-rem tp t4 tp
-sltu s4 a3 a1
-add x0 gp s5
-auipc a1 760293
-or t5 a6 s9
-auipc s3 417776
-divu tp x0 a2
-sll x0 s4 s9
-add t1 s11 s5
-rem t1 ra gp
-mul t5 t0 a7
-auipc t3 135789
-xor a7 a1 x0
-slti a1 a0 -793
-sltiu t0 s8 -1466
-lui t1 316918
-sltu a2 x0 t0
-or s4 t6 t3
-sltu a1 t0 s11
-srai t1 t0 18
-div s6 s6 s9
-sll s5 s1 s10
+xor a7 t3 t0
+slti s2 a4 -598
+lui t1 15878
+or t1 t1 t5
+mul t6 a0 s2
+mulh x0 t2 t4
+mulhsu s1 s0 t3
+add s7 a4 a2
+sll t3 a3 t4
+sra s4 s8 t6
+srli ra t3 31
+mulh x0 s2 a0
+lui a1 109724
+xori a5 a4 -1733
+ori gp s6 -1317
+or a1 s8 x0
+slt s2 s7 s7
+mulhsu s11 a0 s9
+divu s5 gp a0
+andi s0 s1 -74
+xor a5 s10 gp
+ori s2 s7 432
+or x0 s6 t0
+slt t6 s7 a0
+mulhu s1 a2 s8
+slt a3 a6 s9
+slli t5 a0 10
+lui s4 828770
+mulhu t6 s6 a6
+sll s7 s10 a2
+slli s0 a0 8
+add t4 s2 s1
+remu t4 s9 gp
+andi t3 s7 1392
+mulhu s5 t0 a5
+ori t2 a7 -1208
+addi t0 a6 -678
+sra x0 t6 gp
+xor s7 a0 a4
+sltu s5 t3 s9
+slti s4 s6 -959
+remu a2 ra t0
+mulh a7 a2 s4
+sra s1 t1 s11
+lui s6 837614
+add a5 s4 s11
+mulhu s9 s6 x0
+srl x0 a5 a1
+xori t1 tp -781
+mulhsu a3 s4 s11
+slti t0 ra -431
+srai s0 tp 3
+div t4 s0 gp
+ori t0 a0 301
+remu s0 t5 tp
+sll a6 a7 t3
+sll a4 s0 t3
+divu s6 a6 s11
+srl gp tp a1
+sub a5 a3 t3
+sub ra a4 a7
+div t6 s4 t1
+sll t1 a2 s4
+slti a4 a1 1897
+div t0 t6 gp
+slti a0 s4 -1355
+srai tp s2 7
+mulh s8 s3 a1
+rem s0 a4 a7
+div s8 a1 s11
+div s4 s5 s8
+or s7 t5 t2
+addi t6 s6 1184
+rem s4 t1 t1
+sltiu s0 a1 411
+div s6 s9 s9
+srli x0 gp 4
+div a1 s6 s9
+lui a3 762495
+srli gp gp 19
+addi a6 t5 -1988
+sub a7 a4 s0
+srl a2 tp s0
+sltiu a5 s5 -1629
+srl ra ra a1
+auipc t3 369440
+xori ra s11 -1537
+srli s1 s10 26
+sub s10 tp t3
+ori s5 s1 119
+mul s0 ra s4
+rem a5 t6 a4
+and t5 t2 a6
+auipc a3 142599
+srli s10 x0 18
+mul t0 a6 s10
+lui s4 109858
+rem a2 t2 gp
+srai s5 s0 23
+slt t0 s8 a1
+sra s1 t0 ra
+addi s2 s11 -973
+xor t1 a4 s7
+ori s7 t0 -1782
+rem a7 t1 s9
+sltiu s0 t4 -1498
+remu a1 s7 t4
+sltiu s3 a5 -1176
+and x0 ra t5
+addi a2 t1 -1869
+andi a6 s5 -625
+lui s0 463013
+sltu s8 s8 a5
+srai t1 a4 16
+andi s5 a6 687
+sltu a0 t6 t6
+remu tp a0 t4
+mul t1 t3 a0
+sltu s0 s11 s7
+lui s11 1026800
+xor t3 t1 s5
+xori a0 s4 1459
+mulhsu a3 a2 x0
+mulhu a6 a7 a7
+slti s1 t6 -192
+auipc s11 338505
+div s6 s11 a0
+slt gp s10 t4
+xor a6 s2 tp
+auipc ra 159914
+ori s3 ra -1292
+xor a2 a5 s0
+sltu a3 ra s7
+lui s8 341793
+slli s1 s4 19
+mulhu t6 a7 t6
+xori a1 t1 -658
+mulhsu a1 s7 s3
+srli a4 s6 30
+slt s7 t4 s7
+srli t1 s0 14
+and s3 t4 s0
+lui tp 380366
+sub gp t0 s4
+sltiu t1 tp -1671
+div s11 t6 t2
+ori s11 s9 102
+slti s2 a6 1964
+auipc ra 702270
+xor a6 gp s10
+srai s10 t1 5
+rem t3 t3 t2
+xori t3 t0 -1024
+addi ra a2 -154
+divu x0 s9 t3
+addi t5 s8 64
+xor x0 t2 t6
+srl t3 s7 ra
+sltiu a7 s1 514
+addi s7 s2 -928
+sltu s2 t6 s6
+sll s5 s1 tp
+mulhu s7 s0 s3
+remu a4 a6 s0
+and a6 tp a6
+mulh t1 s10 a7
+srl s8 s5 t5
+srai s5 a7 20
+ori a7 s11 -103
+auipc s1 651562
+slti s11 s11 -144
+mulhsu s4 a5 ra
+auipc s6 842148
+slli t4 a1 24
+ori s2 s2 659
+or a4 a6 s5
+xor t3 t3 s6
+sll s6 t2 t6
+ori s11 a6 -1217
+sltu a4 t5 t4
+srai s1 a7 3
+slli s8 a2 17
+xori a2 s8 -497
+ori tp t6 810
+sra a7 s11 t1
+sll s10 t5 s4
+slti t0 t0 -1220
+slti t1 s6 -889
+sltiu a6 s7 -459
+mulhu gp tp s7
+slt a6 a7 s1
+add t1 s9 t5
+sra gp a0 t2
+srli t6 s5 10
+or a2 tp t0
+mulhu s3 a6 s1
+srl s10 t5 s0
+and t6 a0 a7
+slli s6 s1 5
+sll a2 s8 s1
+auipc gp 748823
+srai x0 t0 9
+mulh a7 tp t4
+xori s3 s0 1918
+sltu s7 a7 t0
+srai a2 tp 19
+srli s1 a7 11
+mulhsu t5 a3 t3
+slti s3 tp -1281
+and a1 s10 a1
+remu s8 s9 s0
+add s1 s7 a7
+remu a6 s2 s0
+sltu s0 s2 a2
+sltiu t5 a5 -1902
+auipc s2 336039
+divu gp a7 s5
+lui t2 273237
+and a5 a5 t3
+srai t2 a5 16
+div t5 t5 t2
+mulhu s4 t2 a3
+divu s6 gp s0
+lui a2 533624
+mulhu t6 t2 s10
+xori t5 t2 699
+sra t5 gp s7
+sra tp a5 s3
+lui a7 359382
+rem s11 s3 s11
+addi x0 s4 -553
+xor a6 a1 s10
+remu ra t0 s10
+mulh t2 a1 s10
+mulhu a5 t0 s8
+addi t5 s7 -254
+div s2 a6 a6
+divu s3 a2 t2
+add s9 s4 a7
+sltiu ra gp -988
+mulh s3 s4 s7
+auipc t0 474878
+mulhu gp t4 s11
+slli t0 s5 18
+sll a5 a6 tp
+slti t0 s3 -614
+sub t0 a6 a1
+add s0 s0 gp
+addi t3 s1 -721
+xor a0 x0 s1
+sltu s10 a7 a7
+ori a5 a3 -1938
+sll ra gp a7
+sltu gp s11 s8
+lui a0 727387
+andi s2 tp -460
+addi a3 s7 1737
+add a1 a0 x0
+mulh a5 t4 a2
+mulhu s7 x0 a0
+remu gp gp s8
+slt s6 t0 t2
+slli t4 a3 23
+mulhsu a7 s3 t5
+lui s1 585454
+sll s6 t1 s7
+mulhu gp t5 t1
+sll a0 a2 s11
+mul t5 s0 s11
+srai t4 t2 7
+srl s7 t4 a1
+sra t5 s11 t1
+xor s2 t6 t1
+sltiu t0 s1 -125
+srli s4 a5 8
+srl a0 t1 x0
+and t4 t0 s7
+sltiu a2 s10 -430
+xori s9 a3 -1723
+lui a6 918654
+sub t1 s9 s6
+sra a4 a0 t1
+slti t2 a4 -1491
+sll tp s5 s2
+remu a1 s1 s2
+addi a4 t4 -1219
+addi s6 t0 -1650
+mulhu s9 s3 s3
+addi a5 a1 -321
+srli t6 t2 20
+srai s5 t4 6
+addi s5 s8 -1398
+lui s5 139157
+mulh s2 s1 t0
+mulhsu s5 gp a6
+srai t6 t0 21
+slt s8 t0 ra
+div tp ra a3
+sra a6 a1 x0
+srai s10 t1 9
+sltu s0 tp t4
+remu t5 t3 a4
+mulhsu t1 t2 gp
+slti a6 gp -165
+slti a6 t0 -1536
+remu t0 s9 a3
+srl t3 s11 ra
+srai t5 a7 6
+srai s5 ra 19
+sll a0 t5 a7
+mulh a5 s1 t1
+slli a1 gp 19
+sltiu tp x0 -340
+andi a4 s6 610
+slt t4 t4 a6
+srl s4 t3 gp
+mulh s2 a7 s5
+xor t1 gp t3
+remu a4 s0 a0
+mulhu a2 s8 s9
+slli s1 t0 12
+lui t0 584134
+lui s1 927174
+ori ra a3 -169
+sub a0 a2 s11
+slti s4 tp -291
+div s7 t3 gp
+remu gp s0 gp
+sltu a6 t6 a6
+ori a2 a2 860
+slti a4 t5 -903
+sltiu t5 s5 -1513
+mul x0 s4 s4
+divu s11 s11 x0
+srl t3 s5 ra
+xori a2 gp -1301
+sra s10 s5 s10
+andi a0 s7 1620
+auipc x0 573567
+and gp ra s1
+sll ra a6 a0
+mulhu s11 t0 a3
+or s5 t3 s1
+andi t3 t1 115
+add a1 a7 s2
+divu t3 a7 s6
+sltiu s4 a5 1557
+mulh ra s7 gp
+slli s8 a2 27
+sltu s5 s0 a2
+remu a7 a3 a2
+auipc tp 591078
+div s0 s1 t1
+mulhsu s10 gp a5
+and t0 a1 ra
+rem a4 gp t3
+sub gp gp t0
+slt s10 a4 s8
+or t6 t6 s2
+slt t4 a2 s1
+srli s11 s8 17
+rem t0 t6 s4
+slt s4 x0 t2
+mul a2 x0 ra
+mulh tp s4 s1
+mulhsu gp s7 s6
+addi s11 s1 477
+sltu s4 a0 s6
+mulh s11 a2 a3
+slti s5 s10 -176
+mulhu s6 s4 x0
+auipc s1 393092
+sub t5 gp t0
+mulhu a5 ra a6
+srli a2 gp 19
+sub a7 s11 s0
+mulhu a0 tp s6
+xori s9 x0 681
+divu s1 x0 a6
+slli gp a2 3
+mul tp s4 s2
+rem s10 s7 s5
+auipc a3 891050
+sltu t5 a3 x0
+srai a5 s2 29
+sra s11 t2 a1
+andi s5 a5 -1332
+mulhu a1 s7 s2
+or s2 tp t5
+addi t2 t4 -26
+divu t4 s10 s2
+sll t6 s0 a1
+addi t2 a2 -114
+remu s6 s9 x0
+sll t4 s2 s11
+slt s7 s1 s10
+sll ra t0 s10
+srli s11 s5 2
+lui s2 241927
+or a4 t0 t4
+addi s9 t1 1883
+slti s6 s0 1644
+lui t6 14290
+mulhu s4 a4 t5
+srai s5 s1 31
+auipc a3 112753
+mul s3 s10 t6
+sra ra t2 a2
+srl s9 s6 t4
+div a1 s1 t4
+auipc s8 93697
+sll x0 s10 s11
+slt a0 a4 t3
+add t6 s0 a2
+xori t2 t4 -203
+ori ra s10 -1137
+sll s3 tp tp
+mul gp a1 gp
+mulh t5 gp s9
+lui gp 615045
+or s4 s3 a1
+andi t0 s2 -1678
+srai s8 a2 29
+mul a4 ra a3
+slli t3 a1 28
+sll s0 a0 s7
+sltu s0 a5 gp
+mulhu s8 ra s2
+sub s3 t0 s9
+sll a5 a3 x0
+remu t0 x0 a4
+sltu s1 tp ra
+xor a4 a6 s4
+mulhu t3 s3 a3
+xori t2 s9 -1542
+auipc s5 391490
+xori s7 t1 686
+slti s1 s9 1556
+and t6 t2 x0
+auipc a7 864879
+sub t2 t2 tp
+sltiu a6 s9 -1497
+srli a2 a5 22
+remu a3 s10 s8
+sub tp a6 t4
+add s2 t0 s3
+srl t1 a1 t6
+sltu s4 a5 s0
+add s10 s8 a4
+mul t2 t6 a7
+and t2 t6 a7
+srl s4 a6 ra
+add s0 s9 t6
+sub s8 a5 s2
+srai s7 tp 23
+sub s3 t0 t2
+divu s1 a7 a2
+and tp s1 t6
+sltiu s2 a4 1368
+sub t0 s9 t4
+mulh s5 s4 s4
+mulhsu s8 t0 t3
+sub s0 s1 s8
+slt t1 a6 gp
+srl a2 s10 t4
+mulh s5 a4 s8
+mulhsu s11 t4 s9
+slt ra a0 a5
+and t0 s8 s10
+srli s2 s2 26
+or s4 s9 s6
+srli a0 s11 13
+sub t0 t6 s1
+sub t6 t5 s3
+xor x0 s11 a1
+mulhu t0 s10 a0
+sltiu t3 a5 -1286
+slli t3 a3 14
+sra a6 a7 s5
+sll t4 t6 s9
+div s9 s11 a4
+sltiu gp a0 -573
+xori tp a2 775
+auipc s7 214747
+srai s2 s0 27
+sll s6 ra s1
+and t1 a2 s5
+and t1 a3 t0
+sll a0 a1 a2
+divu s3 s8 t6
+sra s10 t5 t2
+add a5 s9 s8
+slti s4 a6 -1090
+sll a3 a3 s0
+addi t0 t3 -1783
+div a5 s3 s2
+sll tp a3 s9
+rem x0 s1 t2
+mulh tp s8 s8
+add t0 t3 s2
+mulhu s9 a7 s10
+xori t5 a6 -1796
+remu t6 s5 s2
+andi s2 s4 -1414
+remu s2 t3 tp
+divu a5 s7 s7
+remu s6 s0 t5
+xor s11 a0 a1
+and s8 gp ra
+div s7 s7 t3
+xor t2 a6 t0
+or a0 a5 s2
+srl s5 t3 s4
+remu s8 s10 a7
+slt s0 t6 a3
+xori s0 s5 1793
+lui s3 672185
+divu s8 a7 a1
+xor t1 t3 s3
+mulhsu s4 a1 x0
+auipc x0 186924
+divu a3 tp t5
+sll s11 s9 t6
+ori t0 a6 -464
+auipc s4 69495
+divu s2 s3 a0
+sltu t6 t1 t4
+sltu s7 t1 s7
+mulhsu s4 s0 a3
+slt t6 ra a6
+mulhu t1 s5 s4
+sub a6 s7 t3
+and a2 tp s4
+lui t5 711192
+andi s3 a6 -216
+auipc s1 77814
+xori s10 a5 -786
+xor t4 s6 s10
+mulh t4 gp a5
+divu s6 a4 a7
+sub ra s6 t6
+sltiu s3 s0 673
+sll s1 s9 t3
+slt s1 s4 a2
+srl a6 s5 t4
+mulhsu s1 t0 tp
+auipc s0 769389
+slli ra t2 1
+mulhsu s11 s4 s5
+addi a5 t0 1270
+lui a7 459095
+sra gp s3 s1
+and a5 s5 a1
+auipc a0 348221
+srai t3 a6 11
+mulhsu s6 a6 s10
+ori s4 t0 -66
+or s8 s6 a7
+sra t1 x0 t3
+lui s11 79768
+sltiu s2 t5 -1946
+mulh a3 s0 a4
+slli t6 a7 24
+mulhu s1 a4 a5
+div s8 x0 s0
+mul s9 s2 t5
+ori a7 a7 -1766
+divu a2 s3 s2
+srl s7 t1 t5
+divu s7 t2 t3
+andi a1 a0 -976
+xori a4 s11 -262
+sub t6 a1 s1
+div t0 a6 a1
+slli s9 t4 15
+mulhsu s1 a5 s4
+and t0 a0 t6
+slli a3 s2 29
+sltu a6 s6 gp
+sra a5 t6 a1
+lui s10 308853
+mulhsu s8 s8 s1
+div x0 s1 t3
+divu ra s4 s11
+xori a3 t1 -1946
+ori t0 a0 -61
+srl a6 s8 x0
+lui t1 28389
+xor x0 t4 s5
+mulhu gp a7 a7
+auipc a1 679793
+div t3 a5 s0
+andi a6 a3 -1756
+srai s3 s8 14
+remu t5 ra s4
+sll s4 gp a0
+rem s5 a1 a5
+slli s4 s5 13
+slli x0 a4 30
+lui a1 604797
+and s6 t1 s3
+sub gp t4 s5
+auipc s9 323737
+sra t2 x0 s8
+sra x0 a4 s0
+add s6 gp a2
+divu s11 ra tp
+addi s4 s6 1307
+ori s6 s2 -827
+mulh x0 a4 t1
+xori ra a0 -782
+andi t2 s6 -1019
+rem t4 s1 t6
+srl a1 t2 t5
+srai tp s0 6
+srl t5 a7 a2
+srai t1 a4 15
+slti s1 t3 -1985
+sll s3 ra a1
+sll a1 a4 a5
+lui a4 931394
+srl s7 a1 a5
+rem ra a4 t4
+srli s2 a3 10
+sra a0 s10 s11
+srli x0 s4 21
+srai s1 a1 8
+sltu x0 s6 a2
+mulhu t4 t1 t6
+lui t0 631343
+remu x0 t2 t3
+div s3 a2 ra
+sltiu s5 s8 -1094
+xori t4 s5 2017
+mulh t5 tp s4
+sltiu s0 s10 377
+mulh t0 s11 s0
+sll s6 a1 t5
+xor s3 tp a6
+srl a3 ra ra
+slt s2 t4 a0
+rem tp tp s10
+mul a7 a7 s4
+slti t0 ra 792
+lui s0 998799
+sltu s8 s0 a6
+and a5 ra s11
+addi t3 s11 -1654
+and tp tp t1
+sra a6 t0 t5
+slti gp t4 -1621
+sltu ra t2 t2
+srai a6 s4 28
+slt t6 s10 t4
+auipc t3 489044
+sra a0 s4 t4
+xor t3 t2 s11
+slt t3 s2 a6
+and gp a4 s7
+srli s6 t4 30
+srai a6 s1 13
+or t4 a5 s3
+slli s11 a3 18
+srl gp s10 t6
+sra t6 gp t1
+auipc s2 109182
+slli s2 a3 8
+add t2 t1 s9
+remu s11 a6 t2
+andi s7 s3 -123
+add t0 t6 a3
+xor s9 a7 s6
+srl a0 a0 s8
+srli s2 s5 10
+srl a7 s7 x0
+xor a0 t2 t6
+mulhsu t0 x0 a4
+mul t0 s10 s1
+remu t3 a4 s11
+remu t5 t5 t0
+or t2 t4 t2
+slli a1 a1 4
+divu t6 s10 a5
+sll a4 s3 s11
+and a4 ra t0
+xori ra a3 -1876
+slli t1 x0 30
+rem t5 t2 s9
+sub s4 s8 s7
+sll s7 t3 s11
+auipc s3 304880
+ori ra s1 -14
+sltu s11 tp t1
+add ra s6 tp
+ori s11 s1 1687
+andi s2 t2 -737
+div s5 gp a4
+mul t1 t1 ra
+xori a0 a7 -576
+lui t4 673037
+sltu s6 t2 s5
+auipc a5 972429
+mulhsu s3 t4 s4
+div t5 s11 t5
+slli a7 s3 26
+auipc t5 856572
+sll s3 t2 s7
+and t4 a3 s6
+addi ra t1 -697
+or t0 a4 s8
+lui s7 43768
+ori t5 a2 1713
+auipc s2 45655
+remu a3 s6 s10
+rem s8 a4 s11
+slt s2 t1 s3
+mulh t4 a7 t6
+mulhu s11 s3 a0
+addi s11 s8 -1053
+remu s5 a3 t2
+sltu a2 a4 s2
+remu a1 t6 a2
+divu t2 a0 t3
+mulh s3 a0 tp
+div t2 a4 a4
+sltiu s8 t6 -1342
+ori t2 a6 -1786
+mul t2 s0 a1
+andi s3 a5 -491
+sltiu a1 a6 -535
+div gp s4 ra
+or a7 s9 t3
+divu s2 s10 t4
+mulhu x0 t3 a6
+or t3 s8 s1
+or a1 a3 t0
+sltiu s11 s6 -556
+or a6 s11 t2
+div s9 t2 s1
+div s10 s3 ra
+sll a3 s6 s9
+mulh s0 t3 s1
+srl s3 a2 a1
+lui t1 433983
+ori s10 s5 -420
+or gp t6 x0
+slti s10 a2 -90
+mul ra t6 s4
+sll x0 s10 a1
+lui s8 853655
+andi a5 t4 1138
+slli t1 a6 10
+slti t4 tp -762
+sub s11 s8 a5
+or t3 a7 a2
+sltu t5 t3 s6
+div a4 a4 t6
+srl s5 x0 t0
+xori s6 t0 -1241
+or s6 t1 t3
+slt tp t6 s8
+srl t6 s1 t6
+mulhu s2 s7 s10
+sra s1 a5 a0
+sll s4 t2 a7
+lui a2 140102
+or s10 t3 s7
+xori t4 s6 -1330
+xori s6 s10 -482
+slt s1 t5 gp
+and t6 s1 t4
+mulhsu x0 a2 a4
+slli a5 t3 16
+and a4 s0 t6
+rem s9 s11 s4
+add s4 s6 t1
+srl t4 s7 x0
+add s10 a3 a0
+srai t0 s1 17
+div x0 gp s10
+srli a7 gp 11
+remu s3 s5 t5
+slt t4 s2 s0
+sltiu a3 s2 -1465
+sll ra a7 x0
+xor a0 t3 a7
+mulhu s0 a0 a6
+andi s8 s11 -680
+rem t3 s7 s8
+mulhsu s5 s5 s6
+xor t6 a2 s9
+slti gp gp 1927
+slt s2 ra t4
+mulhu a7 s5 s0
+addi s2 s9 1530
+srai a7 a2 0
+srai s2 s5 8
+mul s4 a0 s4
+slli s8 t0 23
+addi tp a5 798
+srai a1 x0 5
 and s0 t5 s9
-ori s0 s9 -1417
-ori a3 t2 -1177
-andi s2 x0 -1017
-ori t3 s0 -1788
-xori x0 s7 -1725
-xori t6 s5 1590
-and a5 s2 a0
-sra t2 s10 s11
-addi t5 a7 -1229
-xor t3 s7 gp
-xori tp t0 -1917
-sll s9 s3 a4
-lui s5 479931
-or a3 s11 t2
-slt ra a3 s7
-slli s10 s3 22
-sltu s6 x0 s0
-lui s6 180947
-sll a0 s1 s4
-rem s5 t1 x0
-add s8 gp s9
-xori s3 x0 607
-mulhsu gp t1 gp
-slli a4 a1 30
-slli a0 tp 29
-sub t4 s8 s11
-slt a0 s6 x0
-ori tp ra -562
-lui s7 219556
-mulh t6 a7 t5
-ori x0 a0 -179
-ori s9 a7 220
-divu t4 s3 a5
-sra t5 x0 tp
-addi s11 s11 1259
-addi t1 x0 334
-srl s7 ra a6
-ori s0 t5 -663
-slt s9 s6 s5
-mulhsu t0 x0 a1
-mulhsu s1 s0 s1
-auipc t1 545526
-auipc a6 121799
-or s6 a1 a2
-srai a0 s5 1
-ori x0 t1 -1566
-ori s6 a1 1272
-add t2 s3 x0
-mulhu s4 x0 a3
-slti a5 a6 364
-add a1 s9 t2
-divu s1 t0 a4
-rem t0 s6 t6
-sltu a7 t3 x0
-rem a0 t5 s7
-slt t3 a1 a3
-and ra t1 s5
-addi a6 t4 -2040
-srli s1 a6 24
-rem gp a1 s8
-srl x0 t6 s10
-mulhsu gp t5 t5
-auipc a1 579127
-xor t1 a2 s10
-xori t1 s4 -1429
-xori s2 s11 1787
-sltu s11 a1 s10
-mul a0 a6 t4
-rem s6 s2 a2
-rem s0 t1 x0
-andi t5 t0 345
-auipc s10 519524
-mulhu s0 t3 s8
-slt s3 a0 s11
-andi t3 a6 -921
-xori s3 s9 -876
-auipc s7 824378
-addi a6 s2 667
-addi t4 t3 -1792
-add s9 t0 a7
-rem a3 s3 gp
-auipc s5 51971
-srl s1 t3 s11
-xori s0 s5 -1446
-mulhu a4 a4 t0
-slti t6 x0 152
-div tp x0 a4
-and a3 a2 t0
-or s6 a2 a2
-mulhsu s0 s10 t0
-mul t3 s2 a6
-andi s0 t2 -302
-sra s1 s3 s8
-divu tp ra t0
-sltu t5 t3 s2
-or s1 s8 s9
-addi a3 s1 -1108
-mul a3 s9 a0
-remu s1 a7 s0
-sltiu t6 a7 1513
-slti s9 x0 -1314
-div x0 s0 s3
-mulh s9 x0 s4
-srai a2 s7 21
-sra a2 gp ra
-mulhu t3 a2 s11
-rem a5 s2 s9
-slli s5 s8 10
-srai tp a0 3
-div s2 s4 a0
-andi s8 a4 -1771
-mulhu t6 s1 s6
-sltiu a4 a7 1437
-div s11 ra x0
-mulh ra s11 t0
-mul a6 a6 t6
-slt s6 t4 s2
-slli s8 s0 20
-remu t3 s5 t3
-rem a1 t4 s7
-mul s11 x0 s11
-add a4 t6 s8
-sll a1 a3 x0
-mulh a4 s5 s2
-srli t0 a2 30
-remu s3 tp a4
-xori tp t2 2038
-sub t1 a4 t5
-sra a6 a6 gp
-srli s3 s1 14
-add a2 t4 a0
-srai t2 tp 31
-or a7 a6 s10
-and t4 t3 s4
-rem s7 a2 t0
-sub a5 a6 a2
-srli a5 tp 0
-sra a4 t3 a3
-remu t3 s2 t1
-xori gp t0 -202
-sltu s6 t4 s1
-srai a5 t0 21
-addi s8 t6 -1474
-mulhsu a7 gp a6
-mulh t0 s1 s0
-srai s0 s2 4
-mulh tp s9 s3
-ori t1 s9 -1968
-sltiu a4 a5 -1456
-remu a3 a5 a2
-srl s2 s3 s7
-or t5 t3 x0
-auipc a0 556764
-auipc t3 79502
-remu s10 t4 t4
-ori gp t4 1572
-slt s2 a2 tp
-srli s3 t3 28
-and t5 t0 a7
-ori s10 s0 167
-mulhsu t4 s2 t5
-andi s8 x0 -558
-srli a6 s2 14
-slli a6 a4 8
-srl x0 t0 a6
-sltiu s6 s5 0
-sll t1 a0 a7
-sub a7 s8 s10
-divu s7 s10 s8
-srl s8 t1 t2
-add s8 a2 s1
-rem s9 t2 s2
-sra t5 a0 t1
-addi s2 tp 1340
-sub x0 s3 s4
-add gp s6 t4
-auipc s4 395723
-divu s9 t6 t3
-sltu a1 a4 s3
-andi x0 t5 -1042
-div t3 s8 s8
-or s10 s2 s10
-div a6 s0 t4
-srai s3 a5 18
-mul s11 s9 s7
-remu s10 s4 s10
-mulh t1 a5 s3
-rem a3 t0 t5
-xor s6 s11 a5
-sra tp s4 s3
-slt t3 t1 s5
-remu s2 a4 t1
-sltu t3 x0 s6
-add a7 x0 tp
-remu t5 s3 s2
-ori t4 a3 -429
-and s9 s2 a5
-and a0 s2 s0
-slli s9 t0 16
-and a6 x0 x0
-mul s11 s8 s10
-xori a7 x0 -2000
-xor s1 t6 ra
-ori s5 s11 1813
-mulhu s2 t0 s8
-mul t0 a5 a0
-ori s5 s3 -487
-rem s2 s9 a3
-remu t3 a1 t0
-slt x0 a2 t2
-auipc t4 667967
-div s6 t3 gp
-xori s8 a1 -1967
-slti s7 s1 -977
-sltiu t1 s8 59
-slt x0 s1 s8
-div a7 s4 s8
-or t2 x0 s3
-auipc t4 591806
-srai s7 x0 31
-mul s6 s2 t1
-xor tp a3 t3
-rem s5 s6 x0
-ori a3 x0 -1583
-sltu x0 a0 a3
-and gp tp a5
-sub tp ra s3
-srli t4 t1 19
-sll s1 x0 s10
-addi s7 t5 -327
-rem s1 t4 t5
-mulhsu t3 ra s5
-addi t1 a6 -34
-xor s1 s6 t2
-addi s10 s2 -1352
-sll x0 s3 s1
-remu s0 s7 s4
-rem t0 s9 s7
-lui ra 369869
-sll a1 a7 t0
-mulh s7 t5 s3
-sra tp s1 s7
-rem a7 t1 s6
-xori t5 a1 -290
-sltiu x0 a6 461
-mulhu s6 a2 t4
-add s8 tp s6
-rem s3 s11 t3
-add t6 s8 s8
-auipc a1 967388
-add a1 s9 t0
-slt s5 s2 a0
-rem s0 a7 s6
-sra t4 t3 s3
-div a4 a5 ra
-rem s3 s5 s6
-slti t0 s10 -458
-mul s1 s10 t4
-xor a3 t4 s2
-addi a4 a6 -179
-addi ra a7 357
-mulh a6 t6 a5
-slti x0 s11 -1982
-mul s11 a4 s3
-slti a1 a7 1459
-auipc s1 308104
-addi a1 a1 -418
-mulhsu s4 t3 a7
-rem a1 s3 a1
-or s5 s2 s1
-rem s2 s4 a6
-mulh a7 x0 t1
-slli s11 s10 18
-rem s9 t2 a5
-lui s8 824583
-xor s11 t6 a5
-sltiu s5 s0 -252
-mulh x0 a6 s7
-mulh s5 x0 s1
-slti t3 t2 -633
-add t1 t1 a5
-sltiu a5 s0 -520
-slti s8 x0 -194
-slt a2 a1 t6
-sltu t3 x0 s5
-xor s10 s6 a5
-sltiu s4 t5 -3
-slt a6 a7 a1
-slti s2 s1 -1467
-mul a2 ra a6
-srai s10 t1 25
-add t0 s8 a7
-add s0 a6 s1
-lui t1 192396
-andi a5 s10 -1903
-slt a4 s11 ra
-rem s8 s11 a6
-mulh s8 s7 a4
-sra s3 a2 s9
-sll s9 s9 s8
-and s10 t3 s10
-mul s4 gp ra
-ori s11 s7 1721
-sltiu s9 s0 1453
-andi a0 s3 -1047
-or a6 a3 s4
-mulh ra s0 t3
-divu s0 x0 s9
-srl gp x0 t4
-lui a1 447748
-mul t2 x0 a0
-sub s1 s5 s5
-slt s6 t2 x0
-ori t4 a3 -1248
-divu gp s7 tp
-xori ra s5 30
-srai s4 a6 28
-sll gp s10 s8
-or a4 s5 a6
-slt t5 ra s8
-srli a0 a6 16
-mulhu s10 a4 t5
-remu t6 s1 s8
-mulhsu s6 a1 x0
-srli t2 s11 17
-add a2 s11 s4
-slti s1 s3 -1630
-srai s3 s8 17
-rem a3 s5 s11
-ori s6 s7 -993
-sltiu t2 t2 -540
-lui t5 288484
-mulhu s5 s7 s9
-auipc a7 183045
-slt t5 t5 tp
-sub tp s7 a6
-add s6 s1 a3
-sll a5 t3 ra
-sra s5 s4 t2
-sltiu s2 tp -1799
-slt t0 tp a7
-sub x0 t2 s11
-slli ra s10 13
-divu t2 a2 a7
-rem s3 s10 a4
-lui s9 944604
-slt a6 s8 a0
-and s6 s10 a2
-sll gp s2 s0
-auipc s0 255426
-sltu ra t2 s10
-srli s5 a3 14
-slt a2 ra s11
-slti s0 s0 1258
-or s11 s3 s0
-divu s7 x0 a3
-slli s8 t0 29
-sll s10 a6 a0
-div s3 s8 s4
-srai t5 x0 16
-lui s3 877680
-and t1 t2 s8
-srli t3 a4 29
-divu s6 s10 a6
-sra t4 t6 a3
-mulhu s9 t1 a6
-xori s11 s4 -350
-rem t6 s1 s4
-and t4 s6 ra
-rem t2 a2 t2
-srl t1 t2 s11
-divu s4 ra s3
-srai t4 s5 11
-srai ra x0 23
-lui s5 658302
-divu t6 a4 a6
-sltu x0 s4 s4
-remu x0 x0 a1
-srai s1 a0 1
-sub x0 gp s7
-ori a2 t0 -1763
-xor t0 t5 a6
-mul t0 a3 s9
-sltu s8 t1 s2
-sltiu a5 s0 -575
-slt s4 a4 a4
-xor s1 a5 t3
-rem t6 t4 a4
-srai s8 x0 3
-divu t3 s6 a0
-xori t3 s7 -2030
-srl a2 a1 a6
-addi t4 a0 -1014
-srai a2 s8 22
-slli s8 a6 5
-sub t2 a3 x0
-divu t5 x0 a5
-div t3 s11 t0
-mulhsu ra a5 s9
-sub t1 a4 tp
-and s5 t5 x0
-or t6 x0 s5
-andi a4 s6 632
-div s0 a2 s5
-sra gp s7 s4
-div a2 s8 s9
-sll a5 tp s4
-divu s6 x0 x0
-div s1 s10 tp
-lui a7 115968
-ori a0 s10 1205
-srl s1 a7 t2
-xori s10 s3 -1185
-andi t0 a2 -889
-remu gp t4 s9
-slt s6 a0 s4
-xori a3 x0 1929
-div a4 x0 s2
-slt a6 a6 gp
-sltu ra t4 s8
-or s1 a6 a6
-remu s6 s3 tp
-srai s11 x0 31
-xori x0 s0 -224
-srai tp s4 2
-or t5 ra t0
-mulhsu a5 t0 tp
-xori a6 s6 -570
-addi a3 s10 -414
-xori s1 a7 -12
-and a1 x0 s3
+mul t6 s6 t2
+srl x0 s3 x0
+sra a5 s6 s11
+srl a4 a4 x0
+srli a0 tp 4
+xor t1 s11 a1
+mulh a1 a2 x0
+rem a4 a7 t1
+add s4 s1 a7
+rem a1 s2 ra
+xor s4 s0 s8
+xori s4 s4 -49
+andi s7 s2 -300
+sub t5 a4 s4
+addi a1 t1 -1633
+mulhu a4 t2 t6
+slti s8 t1 -1295
+srli a0 s8 24
+srai s7 a5 13
+sltiu t4 t4 1114
+addi a1 s4 1029
+remu tp s5 a2
+sub a1 s1 t6
+divu a2 a0 s4
+sltu a1 ra s2
+sub t6 t3 gp
+addi s7 t1 -495
+sltu s9 s8 s10
+mulh a3 a0 s7
+and s5 t1 s4
+slti a7 x0 -1585
+rem t1 t6 t5
+add gp t1 a3
+rem s4 a7 s7
+div s5 s3 s4
+sll t1 s7 t2
+div s10 a1 s5
+divu a7 a6 a7
+addi s0 ra -1381
+ori a6 s4 1301
+sub s2 s5 t4
+remu a7 gp s5
+srl s2 s2 a2
+srli a2 a4 0
+and t5 s8 a4
+xori a3 s5 -592
+ori t1 a6 1286
+srli s1 s1 19
+mul s4 s8 a7
+sll s11 s7 a4
+add s9 s1 t5
+mulh x0 a4 t4
+mulhsu s8 t3 s1
+rem ra a4 s8
+div tp s1 t4
+remu a7 t3 s9
+mul s2 t0 s3
+slt s5 t6 a3
+xor s6 ra s3
+slli x0 ra 8
+sra a5 t0 t1
+mulhsu s3 a5 s3
+ori x0 t4 853
+xori tp tp 1756
+sll a2 a7 a4
+xor s0 s9 t3
+add s2 s0 s9
+div t3 a3 s0
+lui s2 110205
+addi s4 a7 98
+xor a7 s2 ra
+slti tp a3 -1668
+sra s9 a2 tp
+remu a0 a7 t0
+add s4 a1 t5
+lui x0 571129
+mulhsu a5 s1 t4
+xor t2 s7 a6
+lui t2 366631
+slti a5 s8 -1111
+xori a1 s11 -1569
+sra s8 s5 gp
+mul t0 a7 a1
+srli t1 s5 4
+addi a5 s0 -741
+sra a6 t4 a3
+rem a3 gp s5
+add s6 a5 a2
+slt t0 a5 s2
+srai t1 ra 29
+divu s8 s9 t0
+sltiu s9 a4 108
+mul s4 a2 a5
+auipc t1 709532
+and s6 x0 s10
+or a3 s7 s5
+sll s9 t6 a2
+lui gp 691904
+mul s9 a6 a6
+and s3 s0 a6
+ori a7 s4 -1193
+sub tp x0 t3
+div a7 gp t0
+slti t5 s11 -1659
+xori s11 a6 761
+andi s3 s11 -1388
+sll a6 s1 a6
+xori s0 gp 1865
+sub s10 s8 s8
+auipc s10 377282
+xori s5 s4 -941
+mulh t4 a6 s6
+and a1 tp t0
+and a3 s0 s3
+rem gp s10 s5
+and s0 t3 s5
+lui ra 146
+xor s2 s11 t6
+auipc gp 511321
+xori s4 s9 -1544
+sub gp s4 s11
+srl t1 t1 a5
+rem t6 a2 s2
+sra tp s6 t5
+sltiu s1 gp 2013
+xori tp a7 -1354
+andi s0 a1 -172
+slt s5 s7 t3
+divu t3 t0 t1
+rem s9 a5 t3
+srai a1 a5 11
+and s11 a1 a7
+xori a2 s0 526
+sub a2 t6 a6
+slli tp a2 15
+sltu s0 a7 x0
+sra ra tp s2
+srai a5 ra 22
+srai gp s1 22
+sltu s0 t2 s1
+sltiu s2 t0 1777
+andi a3 t5 -722
+addi s2 t0 1433
+sll s3 t5 s6
+xor s0 s9 t3
+divu t2 a4 t5
+sll ra t4 s6
+sub s6 s4 ra
+mulhsu tp s6 t3
+auipc t1 23101
+sub a5 t5 t1
+lui s10 323090
+sra s9 s8 s8
+sltu gp s2 a5
+srl s7 a7 t3
+srli s1 s10 5
+mulhu a4 s3 s10
+remu a2 ra a5
+divu tp a6 t6
+xori s1 a4 -133
+slli t1 s9 25
+slti x0 s1 -1217
+slt s7 s11 s4
+mulhu s5 t5 s2
+lui s9 1033521
+slli a5 s7 21
+slt x0 s5 a4
+mulhsu s3 s6 t2
+mulhu a2 t2 s1
+sltiu s5 t6 -1961
+addi a4 t4 1682
+sll t1 s1 t1
+auipc a7 738882
+auipc a0 948221
+srai s6 s8 29
+slt s0 a0 s2
+slti s6 t3 -1948
+divu a6 t3 s5
+sll x0 t0 t4
+remu s8 s7 a4
+rem s5 a0 t2
+slti t5 s8 1137
+lui s7 191718
+addi a7 t0 -194
+sub s8 s6 s7
+add s11 a3 s2
+and a2 t6 s4
+addi s1 s3 -792
+mulhu s11 s0 t4
+mul s1 ra a6
+sra a3 a3 s2
+ori s6 tp -888
+sll x0 a4 s7
+and a1 s4 s11
+slti s9 a6 1235
+mulh x0 a1 t1
+mulhu gp x0 a7
+xori x0 t6 -711
+xori a3 a6 -997
+addi tp s1 -1148
+sub t0 s10 a5
+addi s6 t5 -204
+auipc a5 746148
+mulhsu s7 t1 a1
+sub a7 gp s3
+sll s2 a5 s4
+andi s6 gp -557
+slt s8 s2 gp
+xori s3 a6 -860
+mul a4 s6 a5
+srli t1 a6 19
+divu s10 a2 t5
+srai a2 s1 26
+sub ra s3 a2
+slt a4 ra t4
+srai a2 s9 5
+sll a3 s5 a3
+sltiu t1 s8 477
+sltiu s0 s3 1012
+slt gp s4 s2
+auipc t3 277182
+sub s6 a1 s4
+and s10 s10 tp
+srl s3 s10 s8
+slt s5 t5 t4
+srai s11 s0 15
+and s11 tp s8
+rem t1 s1 s6
+xori a2 s4 574
+slt s4 s4 s9
+div a0 t5 x0
+mulhsu a2 t6 a2
+sub t1 a4 s4
+srli t0 s2 4
+slti a1 a1 1646
+srai a4 t4 18
+srl ra t1 x0
+xori a1 s0 1097
+srai t0 a4 24
+lui s8 825526
+slli s11 s11 3
+mulhsu s11 x0 t2
+ori s9 t6 -1690
+mulhsu ra t3 a7
+sub s10 s0 ra
+xori a5 s5 -586
+add ra s5 s5
+xor s5 tp s11
+srai a3 t0 8
+ori a6 s2 683
+mulhsu tp tp t3
+ori t0 t5 -392
+mul a2 a6 s4
+slt s1 t5 a2
+divu s7 s0 a0
+mulhsu s2 gp s9
+srli x0 t2 10
+remu t2 s3 a1
+slti gp s4 -845
+add t2 s10 a2
+xor s10 s2 s8
+srl tp s3 s1
+slti s7 a0 160
+sra a0 a7 t6
+sra gp a3 a4
+ori s11 t0 -1465
+sltu a1 a4 t5
+slt s7 s3 a5
+lui t2 595989
+slt s2 s1 s9
+srli t1 s4 0
+add t2 a5 t3
+slt s3 s5 a6
+mulh s10 tp a6
+srli t5 t4 20
+addi s3 t5 -796
+srli t6 t2 7
+div t1 t4 a4
+sll t0 ra s0
+and a1 t5 s4
+srai a1 x0 21
+slli s8 t2 5
+or a5 s4 s4
+slti s10 s2 1874
+addi a5 s10 1308
+sub t4 s8 a7
+slt t6 a3 s5
+srl a2 s7 t2
+slli s11 s2 25
+andi t5 a7 1606
+addi t0 a0 -541
+slt a5 s4 s2
+sltiu t1 s4 1230
+mulh a4 t1 a2
+srli s6 a2 10
+srai s0 a5 26
+srli t5 s7 6
+auipc s1 881588
+sll s5 a6 a1
+slli s0 s3 8
+srli s9 s7 4
+slli t0 s3 10
+or a5 s4 a7
+auipc a3 241846
+sra s3 t2 gp
+srl t6 s11 a2
+slli x0 s2 3
+mulh s11 t6 gp
+slti t6 s5 1303
+add s9 a6 x0
+remu a3 t5 s5
+mul s1 tp a0
+mul a4 t0 a4
+slti s1 s10 1870
+divu s6 a1 x0
+rem s11 tp s5
+sra x0 t4 a1
+srli a2 t1 28
+srl t5 a7 s4
+rem s4 s10 s4
+mulhu s8 gp s1
+lui s9 9842
+div ra s4 s2
+remu s7 a6 s1
+div t0 a2 t0
+divu t6 s9 s6
+sra s4 s0 s9
+lui t3 101502
+mulhsu t4 a1 a2
+sra s8 t0 t5
+slt a1 a7 s9
+sra t1 a6 a1
+div t3 a2 t6
+addi a5 tp 1318
+rem t0 a0 t5
+slli a5 s3 8
+xori a3 s10 -1520
+lui a1 306535
+mulhsu t6 x0 s4
+add s0 t0 t2
+mulhsu t4 s9 a5
+sltu t1 s2 s7
+sub s6 s6 t4
+slti x0 s0 1722
+srai s0 a6 10
+ori s8 t5 -594
+srai s5 t4 10
+slt s9 s6 s6
+srai s10 a2 11
+and t2 t3 a5
+addi t5 s10 -174
+add s11 ra x0
+sltu a2 s5 gp
+slli s5 s6 7
+sltu a4 a2 s7
+auipc s7 266224
+add s8 s6 ra
+mul t0 s5 t1
+srai a3 s0 11
+slt a5 a3 t5
+add s4 ra t1
+rem ra t1 x0
+ori gp t5 -3
+add a6 t2 ra
+mul a7 s5 a6
+lui a5 676710
+xor s11 s0 s10
+andi t5 a4 1098
+add s2 a5 tp
+remu t1 a0 s1
+addi t4 a7 -171
+add a6 s9 a6
+lui a1 959263
+srli ra a0 1
+divu a2 t3 ra
+slti s7 t5 298
+add s8 ra s1
+xori a3 t4 -1289
+rem a2 s3 a0
+sub s8 s0 s11
+and s2 x0 s2
+slli t4 t4 19
+remu a0 s7 t1
+and s5 t3 t6
+and s5 t4 t4
+or a5 t3 a7
+sll tp s9 x0
+ori t3 t0 1172
+srli t3 s6 28
+remu s6 x0 s4
+slti s9 a3 1217
+slt t1 s11 t6
+add t0 t0 a1
+add a2 a6 a0
+sll ra s8 a4
+sub a7 x0 t2
+ori s4 s8 -297
+srai t3 a0 15
+divu s6 s10 t0
+mulhu t4 s10 s6
+slt a5 a5 tp
+sltu s8 a2 t4
+srl s5 t6 t6
+mulhsu s1 a7 a3
+srli t6 a3 25
+div s1 s3 s4
+sub s9 x0 s9
+rem s9 t1 s8
+sub a1 s11 t5
+divu gp a0 t2
+sub a7 s4 s7
+sra s2 s11 s7
+mulhu t2 t3 t5
+div s8 t3 s4
+mulhsu gp gp s5
+srli s2 a2 6
+add a6 x0 t6
+add t3 s1 s9
+ori s7 s7 2045
+sltu s7 a3 s11
+sltiu t3 ra -2011
+sra t3 t6 a4
+sltiu t2 s3 -1023
+or t5 tp a0
+auipc t4 587389
+mulhsu s1 s11 tp
+mulhu t0 s3 a3
+sltiu a5 s2 -242
+xor t0 gp a6
+ori a4 s0 1083
+mulhu t3 ra a5
+xori t3 a5 -1375
+divu t5 a6 x0
+mulhsu s11 s7 a3
+ori x0 t3 -466
+xori t6 a3 936
+ori t3 s3 -1105
+addi a3 a7 1505
+andi s10 s3 -1722
+sll a6 s8 t0
+srai s6 s1 20
+remu s2 s3 t1
+slt a6 a7 a2
+sltiu a7 s8 -267
+sub a7 s7 t0
+sra t2 ra s10
+and s8 t1 a5
+addi t0 a3 -761
+mulh s2 ra t4
+sltu a3 s10 s9
+auipc s7 295880
+add t4 s4 s9
+xori t3 a3 -169
+xor s4 t0 ra
+xori a6 t2 -424
+lui s5 887837
+andi s4 x0 -1576
+divu ra t4 ra
+slt t4 s1 s1
+divu s6 a1 t2
+and a5 t6 a3
+or ra s10 s9
+xor t1 s11 s4
+add a5 a2 t1
+add s8 s0 s8
+auipc s8 586508
+addi s1 a4 -30
+srai s2 s2 18
+addi s0 s2 1877
+srai s11 s7 22
+xori a2 t0 -184
+sltiu s10 a6 -1976
+and a2 a3 ra
+sltu a0 t6 t6
+sll a7 s6 s10
+ori a3 a4 1558
+ori s4 s10 1319
+slt s10 t5 t5
+srl s10 t6 t6
+addi tp t3 -2010
+addi s2 s6 -619
+slt t4 s1 s9
+mulh a1 a2 a2
+lui a2 289111
+xor s7 s6 s9
+mul s1 a7 a1
+srai s2 t3 15
+rem s8 s5 t6
+xor s6 a4 s6
+div a7 a2 a5
+andi t6 t0 1445
+div t5 tp a7
+sltiu gp a1 -1298
+srai s1 s8 1
+srli a3 x0 25
+xori s9 gp -1032
+auipc s2 569935
+xori s4 a1 370
+add s11 t2 s9
+srai s0 s1 17
+srai t3 t2 7
+lui s11 500239
+srl tp t5 s2
+slt a5 s6 ra
+remu s6 t2 s6
+and s10 t3 x0
+srl t0 a6 s10
+and a3 a6 a7
+srai x0 t0 27
+rem tp s11 s7
+mulhsu s3 t1 gp
+sub s4 t5 s2
+sll a0 s6 t3
+addi a6 s7 -1506
+divu a5 a7 s3
+slti a6 s5 1146
+slli gp s9 13
+mul s2 a1 s1
+or t4 ra s9
+srli t4 t0 5
+andi ra s5 -507
+xori s6 tp -1369
+divu t3 a6 a4
+srl s1 a5 t5
+mulh a2 ra t3
+mulh a3 s9 t4
+div t6 t6 s7
+xori a0 gp -1981
+mulhsu t2 gp a7
+sra s2 s1 t5
+lui t3 238306
+srai a3 s8 0
+sltu ra a6 x0
+mul t6 s3 t5
+div t6 t5 t1
+div t1 gp a3
+srli tp a6 7
+lui s7 509847
+srl t0 s8 s10
+addi a6 t2 -622
+mulh s8 t6 s6
+xor s4 t4 gp
+mul a4 a1 s2
+srai t1 x0 23
+slt t6 a2 a7
+sll t4 tp tp
+mulh a7 s6 s8
+slti s11 x0 367
+add s10 t1 t2
+sub t1 a3 ra
+auipc tp 297889
+div s8 a4 gp
+sub t2 s7 t3
+remu t5 s2 t0
+slli x0 x0 16
+add ra a6 t5
+mul a3 s9 t4
+andi x0 s3 1648
+rem a3 a0 x0
+divu s10 s5 s2
+div a1 s2 t3
+srai s1 s2 16
+addi s11 t1 -964
+sub s11 s0 s7
+mulhsu t3 a1 s9
+xor s7 gp s1
+mulhu s7 a6 a0
+lui s6 280752
+andi s7 a6 -1584
+remu s8 t1 t0
+divu s7 s6 s9
+sra a5 a5 tp
+rem a7 s5 s7
+and t4 ra t5
+sll a0 s11 t2
+rem t4 gp s7
+and a6 s3 s6
+auipc a2 946468
+and s10 s10 s3
+remu x0 x0 s8
+addi t1 s7 -923
+sll t3 a0 x0
+slti a3 s7 336
+srl s9 s11 s4
+divu s7 s2 ra
+andi s11 a3 -135
+slli t5 t3 19
+mulhu t3 t2 t3
+srai x0 s1 17
+mulh s4 s4 gp
+or s7 ra s8
+lui a0 313934
+mul s7 t1 s5
+srl t0 s6 ra
+andi s5 t3 956
+mulhu t1 t2 s4
+sltu s10 a6 a3
+remu s9 tp s10
+sra s6 s7 s1
+slt s2 t0 s2
+slti s1 t3 -495
+auipc t1 950893
+slti s11 t0 -248
+auipc s9 319462
+xor s11 gp s1
+sub s9 t1 gp
+mul a6 s10 t1
+and t4 a3 a6
+add a4 a3 s7
+divu s2 s1 s0
+and tp a2 s1
+sra s9 t0 t6
+xor s1 s2 gp
+sra t0 s1 t0
+sll s1 s3 s8
+xor a0 s4 a2
+srai s1 t5 23
+divu s1 a4 s5
+divu s9 s9 t6
+sltu a0 gp a7
+slt a4 s8 t3
+andi s8 s10 -247
+mulhu t2 a4 s9
+slti s6 a1 -1312
+lui t6 782641
+auipc t0 197052
+auipc s8 621345
+srli t5 t6 16
+slti x0 gp -1003
+div s6 t6 s3
+slli t1 ra 23
+sra t3 a2 t3
+divu t5 s4 tp
+slli s10 t0 23
+div a3 s5 s6
+srai t4 a5 4
+mulhsu s2 tp gp
+mul t1 a6 tp
+mulh s9 t2 tp
+sub tp s1 t1
+srl t6 s0 s0
+sltiu t6 s2 -1054
+srl t0 a3 s0
+ori tp s0 -629
+divu s2 s9 a6
+sub t5 a3 t0
+mulhu s9 t6 a6
+srai s11 a1 31
+slti s8 s1 1590
+sltiu t5 ra -1083
+divu a4 s7 t1
+sub gp a3 s9
+mul a5 t0 t2
+or t1 a5 a2
+slli s7 s8 13
+and t3 a1 t2
+xor s9 gp s11
+slt t2 a2 a5
+xor s10 x0 s5
+rem tp s10 t2
+sltiu gp s11 -1319
+mul tp t2 gp
+lui x0 321497
+rem s4 a2 s0
+sra s6 t3 a3
+addi s8 ra 1227
+mul s9 s6 a1
+ori s10 a6 -696
+srl ra t3 a1
+or a5 t2 s4
+auipc a5 18325
+srai s11 s0 5
+divu t3 t2 s2
+sltiu x0 s0 840
+ori a6 gp 821
+srai a6 s3 25
+mulhu tp s6 s5
+divu t5 a0 t2
+add s11 t2 s11
+srli a3 s7 3
+lui t2 362667
+slt s8 s10 s0
+or s9 ra a1
+slti t0 s4 -1102
+divu t4 s2 tp
+mulhu a2 s2 a7
+sltu gp s8 s8
+addi a1 a7 -1621
+sra t5 s11 s2
+srai s11 s4 18
+add s9 x0 s10
+xor s11 t4 t1
+srli t4 s9 26
+slli s10 t5 24
+srai a7 s3 18
+div x0 s0 a0
+sltiu gp tp 881
+sltiu t5 t0 2028
+add t0 gp a5
+div s0 tp s1
+mul a4 t4 t1
+sltiu s9 s3 1057
+remu s9 s9 s3
+lui a3 962467
+sra a6 tp s11
+xori tp s0 1520
+andi t0 t0 -1897
+addi s6 t1 -1989
+sltiu a7 tp 42
+divu tp s5 t1
+sll t0 a0 a0
+or t2 ra a3
+rem s4 s2 a6
+lui s10 346299
+remu a3 s3 a2
+and ra t3 s1
+lui t1 96352
+srl s6 s1 a6
+slti s5 t1 1550
+mulhu s5 s7 a5
+srai t1 s11 9
+sltu t3 s11 tp
+ori t2 t0 -683
+srl s11 t1 a4
+sub t0 s7 s8
+divu t5 s4 t0
+sra t3 t2 t5
+and t5 s6 t1
+mulh s6 s1 x0
+xori s0 s10 1250
+xor t0 t2 s7
+divu s1 s11 t3
+andi t1 t6 70
+sll t2 x0 s0
+rem t0 t5 t1
+mulhsu s7 a6 a0
+srl t4 a6 s10
+slt s7 a0 s1
+mulhsu a5 t3 s5
+sltiu s2 a0 -1695
+srai s6 s5 9
+remu a1 s7 s3
+mulh a0 s10 t0
+addi a2 s1 -1203
+or t4 s6 s7
+and x0 a3 gp
+sltiu a1 gp -1369
+srai a6 t6 22
+and t3 a5 s0
+slt s9 ra a5
+srl t2 s4 a4
+ori a3 s0 280
+slli s4 s8 30
+or a4 a3 a7
+sltiu a6 a0 1960
+div a2 a6 s11
+xor t1 t2 t2
+sltu s9 t2 s7
+sltiu a3 t5 715
+lui a1 605164
+mulh s8 s11 a5
+add t1 s9 s6
+divu gp a3 a5
+mulhsu s2 s0 s9
+sra a3 ra t4
+mulhsu t5 a2 s6
+sub a7 a0 t0
+mulhsu s7 a1 a4
+sll a0 s10 s11
+slti a2 a4 1290
+mul gp tp a3
+srli a2 a7 15
+srai s9 s6 20
+remu s2 t2 tp
+mulhsu t5 s4 s5
+srai a0 s7 15
+remu t1 a0 t5
+sra ra a0 a3
+sra ra t5 s2
+sub s9 a2 ra
+addi ra s11 -1426
+xor a3 s2 s10
+div t4 s2 gp
+slti s7 s5 53
+xor gp t1 s0
+ori a5 a2 -665
+remu a1 t4 a2
+xori s2 t3 -1935
+div s9 s7 s7
+sltu s10 s0 t4
+ori tp a1 -1258
+remu s0 t5 s0
+addi s11 s9 1836
+andi s3 a1 -383
+sltiu a7 x0 -754
+mulhsu s2 t2 t3
+auipc a4 156260
+sltiu s0 a3 -1803
+auipc a3 64532
+mulhu ra tp s0
+or s6 a5 t5
+mul t4 s1 t0
+xori a2 t1 704
+auipc a5 262516
+auipc tp 366900
+addi a3 s2 -87
+sltu gp x0 t3
+xori s7 gp -1943
+sll gp s6 a7
+slti s2 a2 48
+auipc a0 1018921
+slti t5 a7 -625
+andi s9 a0 1417
+sltiu s7 a5 343
+sltu t5 t0 s6
+rem s1 ra s10
+mulh t4 s7 a6
+sll a0 s5 t5
+rem s0 a2 s7
+sra t4 gp s3
+srl s6 t6 gp
+xori s11 tp -370
+slli x0 a0 9
+sra s7 x0 t6
+srli s11 s1 18
+lui x0 753565
 mulhsu a2 a4 t6
-mulhu t2 a5 t3
-remu x0 a0 a5
-sltiu s2 t2 -621
-xori x0 x0 266
-sub s5 t1 s11
-lui s6 787374
-auipc s6 577266
-srl t0 s6 t1
-xor t1 s2 x0
-xor gp t1 s10
-slti s4 a1 -1692
-mulhsu gp s9 s9
-andi s6 s6 -24
-mulh ra a3 gp
-mulhsu x0 s7 s0
-lui a6 381009
-mul a4 a6 s10
-remu a2 s9 t0
-xor s7 s4 t3
-slt a6 t6 a0
-sra x0 a5 a0
-xor s1 t2 s0
-sub t5 s5 s3
-and a3 a7 s9
-sra x0 t6 s0
-lui s7 178789
-slli a7 s0 22
-lui s8 523255
-remu s10 a7 t4
-sub s6 t4 gp
-slli a4 s0 16
-andi a1 s6 -1516
-and s6 a2 a1
-slli s11 gp 22
-srai s0 t5 15
+srli t6 t2 16
+sub s8 s9 a4
+xor t0 a6 t6
+sltiu s5 t6 1354
+sltu t3 s3 s2
+sltu t0 a6 x0
+mulhu a7 s11 s3
+srai a7 t2 4
+sltu s9 a2 s10
+sll a0 s7 t1
+rem s11 s8 s9
+divu t0 ra s2
+xor s1 t4 s4
+mulh t6 a3 t2
+rem a7 gp t1
+or t4 a7 s10
+lui a0 655411
+xori a1 s0 -1114
+slti s10 t1 -1250
+sltiu a2 s5 1252
+rem s11 t0 t1
+divu s2 ra a5
+srai a5 t3 10
+rem t5 s6 s2
+divu s8 x0 s11
+remu s3 a6 s3
+rem t0 a4 t2
+andi a0 gp 1227
+mulhsu s6 s5 a3
+mulhsu x0 a0 gp
+rem t3 t6 s0
+mulh a5 gp a2
+xori t4 a0 -74
+srai s4 t2 16
+xori t5 s3 418
+sll x0 s2 a7
+mul a2 a0 t5
+slt s3 t4 t2
+slli s4 s0 15
+mulhsu a3 a7 tp
+lui tp 338935
+div s10 t5 t3
+andi s0 t0 -1439
+or a7 a0 s3
+add ra a0 tp
+and t3 a0 s10
+mulhu t2 s7 s11
+xor s6 s8 t5
+xori a3 ra -1917
+sra t2 s9 s4
+mulhu a5 a2 s8
+ori s11 s1 588
+xor s6 ra a4
+ori t3 a1 867
+auipc gp 916948
+divu t5 a4 s5
+mulhsu s9 a7 gp
+mulhsu s6 t2 s11
+sub a1 t4 s11
+sltu a3 ra s11
+remu a6 t0 s10
+remu gp a6 s5
+sltu a1 t2 t3
+divu s1 a0 t2
+sltu t3 x0 s7
+divu s3 t3 a0
+srli s4 tp 3
+sll t5 a0 t4
+remu a3 s0 s1
+srai s3 a7 27
+mulh s5 a0 a0
+ori s8 a4 158
+slti tp t1 1302
+mulh t3 s10 t3
+sub s4 a5 a2
+slli s11 s2 25
+addi t5 t5 971
+add t6 a7 a2
+rem s3 tp s10
+sra t5 s11 t1
+and t2 a3 gp
+srai t5 t0 3
+auipc t6 582334
+srai ra t3 14
+slli t0 s1 23
+srl ra s4 a1
+sub s11 s10 s3
+andi t4 a5 -1276
+add a6 s0 a5
+addi s11 a0 266
+and a1 s1 s8
+srai s3 t0 7
+xori t0 a6 -1943
+lui ra 861089
+divu s11 a6 t3
+mulhsu s1 s11 a6
+xori t2 s8 -633
+srai s2 a4 30
+slli t5 t5 17
+or ra a5 s1
+div t0 s9 s5
+mulhu s10 t4 s0
+div a3 a5 a4
+sltu t4 s8 t3
+sra s4 t4 a5
+sub t6 s10 t0
+xori s11 t4 1570
+addi s3 t4 1202
+divu gp s0 x0
+andi t2 s3 772
+div s0 t3 s10
+slt a6 t3 t3
+div a0 t4 a6
+srli a3 t3 23
+mulh ra s9 a5
+mulhsu s8 s2 s5
+or a4 x0 s6
+addi s8 s11 -431
+divu s1 s0 a2
+mulh s11 s11 a3
+slti t1 a2 1652
+mulhu x0 tp s4
+xor t1 gp s6
+srli t4 x0 20
+rem t1 s9 s9
+andi t5 t0 -1207
+srli x0 gp 20
+mul s7 t1 a4
+xori t3 s2 203
+sub s3 s6 s7
+ori t5 s4 1668
+remu s8 t2 a6
+srai gp t0 28
+divu t6 t4 a2
+xori s8 s7 -319
+mulh s6 t3 tp
+srai s8 a5 12
+remu s0 s0 t1
+mulh ra s2 t1
+and s0 x0 s6
+auipc s9 522219
+or s0 s7 s6
+divu s10 a5 a5
+slt t0 t3 t0
+srli a6 x0 16
+sltu s8 s9 x0
+andi s1 s7 -1395
+mul s2 s6 s0
+rem t2 s5 t1
+mulhsu s11 t1 t3
+sltu t0 s1 a6
+addi a0 x0 -1990
+sltu s1 a4 gp
+sltu s4 a6 s5
+xor s0 a1 a3
+sub a7 a2 s0
+slt x0 a7 a2
+srai a4 s6 3
+xori a6 a0 -231
+sltu t4 a4 t0
+mulhsu ra s10 t6
+mul s3 s3 tp
+divu t6 t4 s10
+mulhu a3 a6 s10
+sltiu t3 s2 -941
+and t4 t0 gp
+sll t0 s7 s0
+sub a6 s0 s4
+sll a6 t5 t6
+div s11 a5 s11
+srai s10 t4 4
+sltu s3 s8 s2
+addi t6 a1 -1397
+divu s4 t5 s10
+ori gp a2 1757
+xor t5 a6 t3
+lui t1 55673
+remu t6 x0 s2
+lui s3 91681
+xori t3 s0 -707
+mulh ra t5 s4
+or t6 x0 tp
+xor s6 s6 ra
+sll s0 s6 tp
+mulhsu s0 a5 t6
+or t5 t2 a1
+sub t3 s6 s0
+slt s1 a2 s7
+or s6 s6 s2
+or s2 a3 s3
+addi s5 s9 1451
+lui t3 548662
+lui a1 694653
+sltu t4 a2 a1
+div s8 tp tp
+add s6 x0 t3
+and tp s1 t2
+ori a4 a2 -1120
+srli s5 ra 5
+remu t4 a4 t6
+div gp s0 t3
+mulh x0 s6 tp
+slti s6 s2 -1118
+slt a1 tp s11
+mul t2 s3 a1
+xori a0 s0 -495
+ori a2 t6 -1048
+slli a2 t2 22
+andi a6 s9 -1683
+mul s5 a0 s7
+slti gp s9 -73
+mulh s3 ra a6
+add a3 t0 s9
+sra a7 ra t4
+srl t2 gp a5
+sltiu a6 s7 -802
+mulhsu x0 s5 a5
+auipc s5 191817
+add s0 t1 a5
+mulh a5 s11 s6
+remu s4 a7 t0
+rem a3 a5 a5
+rem a7 s9 s6
+sltu s8 s5 a1
+or a5 t6 a1
+srl s2 t5 a7
+or s7 ra s10
+andi t6 t1 -889
+srai a2 a7 22
+andi s8 x0 -1792
+andi a4 t3 210
+sltu s5 s5 tp
+andi tp a0 73
+divu t1 x0 a7
+srai t1 t2 24
+sub t4 s9 s10
+mulhu a3 gp a4
+addi s3 s6 -45
+mulh a0 s0 a2
+rem a5 s6 ra
+slli t4 s1 30
+srl s2 t6 a7
+sra a6 s2 a3
+xori a2 s1 1871
+divu ra s2 t1
+xori s3 s11 1378
+divu t6 s6 a2
+add a2 s6 a4
+slli t6 a7 31
+srai t6 t4 3
+xori s11 s5 -956
+mulhu ra s10 s0
+remu a5 t2 s0
+and s10 ra a1
+slti ra s10 1414
+srai a2 t2 24
+or s11 a3 s5
+add ra a5 a1
+sll s9 t0 s4
+lui a2 110507
+sltiu s10 s4 -1818
+auipc t5 516330
+srai s2 s8 14
+div s4 a1 s5
+andi t0 s11 918
+sltu t5 s1 s9
+add s5 s3 s9
+slli a6 ra 22
+mulhu a0 a2 a3
+add s8 a2 a6
+sra x0 x0 a0
+ori a2 tp -505
+andi s11 t5 -921
+add s5 t3 a0
+mulhu tp a5 t4
+rem s1 a6 t1
+or a0 gp t2
+slti t1 s10 -439
+addi a5 t3 396
+or s10 t5 s7
+xor s5 a0 t2
+xor x0 t1 a1
+sub a3 a6 a6
+sll x0 s11 t1
+auipc a4 904183
+slli s4 a1 21
+andi s10 a0 1506
+addi s8 t2 -1040
+slti s3 a6 -248
+auipc ra 910557
+srl a2 s0 a4
+sltiu a5 s9 -1949
+mulhu t4 s3 a3
+rem s2 t5 t6
+addi t3 tp 1785
+sltiu s2 ra -413
+add gp tp s9
+mulh s8 t5 a0
+mulh a4 gp s0
+sll ra a1 s4
+ori s6 s3 -1633
+srl a6 t1 a5
+slt s5 a3 s5
+mul s6 t0 s6
+mulh s5 a1 s4
+sll s9 s4 s6
+srl s0 gp t4
+auipc t2 662118
+mul tp a6 s7
+slli s1 s10 21
+slt s2 a0 s10
+addi s10 s1 -1992
+sll t0 t1 a5
+auipc t5 351426
+auipc s3 737181
+srli ra s4 23
+slti a4 s3 281
+sra s11 a4 t2
+srli a3 gp 22
+div s7 t1 t6
+mulh t3 a7 t2
+sub tp a2 a6
+or s5 s0 s8
+add s9 s5 a5
+slli s1 ra 14
+srli a0 s1 23
+remu a2 t1 a6
+srai t5 t6 4
+slti t5 a4 -1567
+mul t4 s7 a4
+sll ra s5 t5
+slti t1 t2 -200
+and s10 t4 s7
+sltu t5 t2 t1
+slt t6 t3 a5
+and gp s6 s1
+sltu s0 s4 tp
+auipc a0 55055
+mulh a0 t4 s11
+divu s10 s1 tp
+lui a1 62539
+sltu a4 gp ra
+addi t6 a7 -1904
+add t0 a1 t6
+addi a2 t4 -974
+mulh s10 a0 t6
+sltiu t4 x0 -1888
+sltu t5 a0 s4
+addi a5 s0 1616
+xori s8 tp -1636
+or gp s9 s2
+sll s2 s9 s3
+mulhsu a6 a3 a3
+divu ra s8 s6
+mul s3 a7 t0
+xor a1 s1 s8
+divu s10 a1 s10
+srli ra a2 31
+mul ra t6 t2
+remu s11 s8 s8
+div s2 s5 s4
+mulh t1 a4 s4
+mulhsu a4 a7 tp
+srai a6 t1 31
+sltu a6 a1 s11
+addi ra s3 1228
+xor s9 t5 tp
+sub s4 s2 a1
+remu s1 s0 gp
+mulhsu s4 tp ra
+auipc x0 989429
+srli a0 s7 7
+srai gp t3 15
+mul s9 gp s0
+and s11 a5 s10
+sll a5 s6 a0
+rem t0 s9 s7
+srl s4 t2 a7
+slli s8 a6 27
+slt t3 s10 s11
+srai t2 s3 1
+sra a1 s0 a0
+srli ra s9 26
+auipc s4 179443
+or s5 a3 s11
+addi s9 ra -1454
+div a6 t4 s6
+mul a4 a4 s8
+andi x0 a4 -2038
+srai s9 ra 16
+addi s4 ra 1394
+sltu s11 s1 s9
+mul s6 a2 ra
+rem t4 tp gp
+sub a2 s8 t1
+xori s9 ra 320
+xor tp s1 s5
+mul s7 a6 a3
+slti t1 x0 1676
+addi s5 t5 -1841
+and s10 gp x0
+srl s2 t1 a5
+addi s7 a6 1903
+sltu s10 s3 s5
+srli s9 s11 25
+lui t2 434578
+div t6 a5 s6
+addi a7 s6 606
+srl s2 t0 s10
+lui t6 385789
+auipc s1 897100
+srai s5 ra 14
+slli s4 t3 9
+mul s4 s7 gp
+mul s11 a7 s4
+sll ra t5 s8
+sub s5 a0 s7
+mul s4 a3 s6
+sub s1 s8 s0
+auipc a2 578659
+sll t3 ra s3
+ori s11 a1 -1474
+srli s8 a1 17
+rem s3 t0 s7
+xor t3 t6 gp
+sltiu t0 x0 1000
+sltu s10 x0 x0
+srli t5 x0 24
+sll x0 ra s0
+and t1 a5 s11
+sra s8 s0 t1
+mulhsu s1 s0 gp
+and s6 x0 t2
+and s8 a6 a0
+sub s11 s7 s0
+auipc t5 174631
+divu s9 t0 t6
+slt t2 a7 a0
+and t1 a3 a1
+divu s3 a7 s11
+divu ra s10 x0
+ori s8 s6 -709
+xori ra t0 1516
+slli s7 s2 13
+addi s1 t1 -1926
+andi s2 s8 545
+slli s5 t1 27
+addi s5 s11 -229
+mulhsu tp a1 s4
+slli x0 a2 20
+remu s3 x0 ra
+mul a4 s8 t1
+andi s8 s10 -929
+addi t6 a3 1484
+srai a0 a4 6
+sra ra s2 x0
+sltiu s9 t0 -833
+xor s10 s1 s10
+and a3 t5 s10
+mulhu s2 s11 a5
+addi a2 gp 1009
+slti t3 s0 -1835
+ori s7 s5 -722
+srli s5 a5 3
+lui s0 60262
+remu gp a0 t4
+slt a7 s1 s5
+mulhsu a2 gp a4
+sra s3 t0 t0
+sll tp a0 s5
+xori t3 s4 -843
+addi s8 s11 -62
+sra a5 a4 ra
+srl gp s6 t4
+srl tp tp s4
+or x0 t5 t1
+ori ra a6 -1969
+add gp a5 s9
+mulhsu x0 s2 a5
+mulhsu s0 t2 s3
+xori t5 s8 -1784
+andi a6 ra -1131
+sltu t2 s10 a6
+slti a7 a5 -1104
+xori s2 t4 1282
+mulhsu tp x0 a4
+ori s2 t3 -1845
+slli t3 t0 0
+lui s0 747133
+xor t5 a5 s10
+slt a2 a1 s7
+rem ra a3 a0
+div a2 s10 a7
+remu tp a0 a6
+slt a3 s6 a1
+rem s11 a3 t2
+remu t2 s1 a7
+slli a3 a7 26
+div a5 a6 t6
+mulhu a7 s0 s8
+mulhsu s4 s9 t0
+mul t3 ra s0
+sltu s6 s7 s0
+mulhu a6 a1 a2
+srli s0 s3 18
+sll t5 s9 a0
+mulhsu s1 a0 s2
+slt s7 t1 t0
+remu gp a3 s4
+xor a4 t2 s1
+and s2 a0 s4
+addi a6 s9 -152
+ori a4 s9 -2028
+slli t6 s6 1
+and s9 s5 s11
+mulh t2 a6 s9
+slli a7 gp 27
+sltu t3 tp a3
+mulhsu s5 s2 a5
+div a1 a6 s4
+ori a4 a6 1776
+rem tp s6 s8
+slli t6 s4 18
+ori a4 t5 458
+and t5 t1 ra
+slt s2 s2 s5
+mulh s11 t2 t1
+srai gp s9 16
+sra a5 s5 tp
+lui t4 559912
+srai s10 a5 2
+add a7 s2 a0
+slt s6 a3 s10
+srl s5 t6 x0
+andi a1 a0 -1587
+srli s9 t6 12
+remu a4 a3 s3
+mulh a4 t1 s2
+slti t3 t0 -1343
+div s1 a1 t1
+xori s1 t2 -840
+addi s6 a0 1905
+sra s7 a7 s9
+mulhu t6 a6 x0
+slti x0 a1 -266
+slli t1 a0 27
+sll a4 t6 s1
+slli t4 s0 10
+slt t3 t4 t0
+addi t3 s0 -1251
+sltiu s0 a1 -957
+mulhu a5 ra s5
+sub s9 gp t6
+xori a6 a4 1799
+andi t0 s6 757
+mul s3 s5 a7
+mulhu t5 s1 a6
+divu s10 ra s2
+srli s9 t2 11
+mul a4 t1 s1
+mulhu t0 s0 s1
+and a4 s6 a1
+srli s2 a1 17
+xori t5 a2 -1601
+addi a6 a2 735
+sra a6 tp t6
+mulh s4 t6 a3
+div a5 t0 s2
+remu t2 s3 s2
+lui a2 899906
+divu s6 s8 t0
+srl s5 s1 s5
+addi t5 a2 -381
+sra s3 a5 t5
+and s2 s3 gp
+sll s8 a1 t0
+mulh gp a3 t4
+mulhsu tp a7 a6
+mulh s6 a5 a1
+andi t4 gp -1478
+ori x0 t3 -807
+addi t5 x0 -341
+mulhu s4 gp s4
+sltu s11 a5 a5
+mul tp t2 t3
+and s0 s10 t4
+mulhsu s3 s8 t5
+or s4 x0 ra
+rem s2 a2 s0
+mul s5 x0 s11
+slli s9 t5 22
+sll s7 t6 a7
+addi t4 t3 425
+add gp t3 s0
+xor a6 a4 s9
+rem s4 t5 s4
+mulhsu a4 a0 tp
+sra t3 s3 s5
+div a2 gp a0
+sub a6 t3 tp
+div s6 s8 s11
+mulhsu s4 a0 a5
+rem s1 s3 a4
+auipc t3 30469
+srl tp s7 t5
+ori s7 a4 1733
+sltiu t5 a1 134
+slti a0 tp -2025
+lui tp 877882
+ori s2 s9 -574
+srli tp t1 19
+and t6 t2 a7
+ori a2 s10 -535
+sll t1 s3 s0
+slt t3 a1 t1
+xor s10 s4 t2
+mulhu ra a3 ra
+srli s7 t6 27
+rem s11 a5 t6
+addi s9 x0 -1088
+sltu t2 a2 t6
+mul a7 a6 t4
+slli s11 ra 31
+sltu s2 s2 t3
+andi s11 a4 -1725
+mulh s8 s7 s1
+div s5 s0 s2
+mul s10 s9 a0
+srl gp s11 s4
+auipc s6 633364
+divu s11 t6 a3
+mulh s2 t6 a5
+rem t5 s7 s5
+and a4 s9 a0
+divu t3 gp t1
+xori t3 t6 -1661
+sltu t2 ra t0
+or x0 t2 s5
+srli t5 s1 30
+mul s2 t6 a0
+rem a0 s2 s9
+andi s2 s3 -1949
+xor t0 s5 s9
+srli s3 a1 0
+mulhsu s4 s11 t6
+srl t1 a5 t2
+sltiu a1 t1 -693
+div s8 a6 t4
+mulhsu ra t3 tp
+sub t4 x0 t0
+slli a3 a1 29
+rem a0 t6 s9
+mul t0 a2 t3
+lui s3 878719
+sub t3 a1 s8
+add t0 s10 s3
+lui t4 89751
+slt t0 a4 s6
+andi t1 s11 1661
+divu a3 s1 s2
+xor t2 gp t5
+slli s10 t1 27
+andi s1 a1 -825
+slti s11 s11 -2028
+addi t6 a3 -1413
+sltiu t1 s2 -1382
+rem a4 s6 a0
+sub s2 gp s6
+mulhsu a7 s3 tp
+sltu s10 t2 s7
+slt s3 tp t0
+sub t2 t0 a3
+sra a1 a7 s2
+andi s3 s9 -1821
+lui s1 1024726
+xori gp s1 743
+sub s2 x0 x0
+div s3 a0 t1
+remu s1 s9 s1
+srli s10 s7 8
+srli a3 t0 26
+lui t0 106344
+slti a3 a2 124
+div s5 a0 s6
+sll a4 t4 t5
+srl s6 x0 t4
+sll s1 s7 s11
+sltu s9 s10 s11
+sltu t3 a6 a4
+or t2 s0 s6
+sltu a1 s5 s5
+sltiu a4 s6 -914
+slt s7 s11 t6
+ori s2 t5 1592
+mulhu t6 t4 s7
+slti s0 s11 -1921
+sltiu a0 a4 -1982
+and t0 tp a0
+mulh t1 s4 a7
+slt s8 t1 a4
+andi s1 s9 -162
+and tp s3 s5
+sra s8 s0 s2
+div s4 a2 t2
+addi tp s0 -1496
+or ra a4 s5
+remu s11 t4 t0
+mulhsu s10 s1 t1
+sltu s6 s5 s10
+divu t1 s5 a0
+addi t6 a7 1424
+srl a5 s4 t5
+ori a0 s1 316
+srli ra s9 3
+sltu s0 s9 a0
+xori s1 s3 -317
+remu s10 t1 a6
+mulhsu t3 a0 s6
+mulhsu s5 t3 gp
+or s7 t5 s9
+remu t0 a0 x0
+xori x0 gp -1180
+divu ra a3 ra
+mulhu s4 t4 s10
+sra t0 a2 s9
+div s5 ra t2
+lui t6 250016
+sub a4 t1 s11
+mulhu s11 a4 a0
+addi a1 a4 -1089
+divu s9 s10 gp
+and t6 t1 tp
+sub x0 t4 s3
+srai s7 t4 23
+div a1 a5 a4
+mulhsu t3 a1 s3
+auipc gp 952097
+srai s2 s9 12
+andi s8 a1 -1144
+addi a4 t3 -1037
+lui gp 832941
+lui t6 679101
+srai s10 s9 26
+div s1 t6 t5
+ori s4 t0 -889
+srli s1 x0 1
+and a4 a2 s11
+xor s2 s4 x0
+add t0 a5 s0
+rem ra a3 s1
+lui t0 519184
+mul s2 a5 s6
+auipc s1 251357
+sub s8 t0 a3
+lui t1 595575
+sll x0 t0 ra
+sll a2 a5 s0
+andi a5 gp -909
+slli t2 s0 2
+mul a1 gp t6
+rem a1 s6 s4
+mulhsu s8 s5 a3
+sll s2 s3 s11
+and s7 s7 s8
+addi a7 x0 -8
+slti s6 a5 -1040
+mulh s10 t4 s1
+slti ra s5 -395
+mul s6 a3 s0
+lui s9 930139
+mulhsu s2 t6 ra
+andi t0 s5 1486
+slti a7 t6 -6
+sub s3 tp gp
+lui s0 378874
+srli a6 ra 18
+andi s2 t6 951
+div tp a4 s1
+sll s1 s1 a7
+rem a0 s4 s2
+sltiu s1 a0 -49
+sltiu t3 a5 769
+lui s9 1009774
+auipc gp 349845
+lui s7 210910
+srai t6 t1 29
+slti t1 a5 1165
+add t2 a3 s2
+lui ra 909325
+mulhsu a3 s3 x0
+rem a7 t5 a5
+srl a5 tp s1
+xori s9 a6 -2008
+addi a1 ra -1230
+sltiu s3 ra 582
+xor t3 x0 t5
+sll t6 t1 s9
+sltu x0 s7 t0
+mul t2 a7 a2
+auipc x0 33982
+slt s5 a2 t3
+sltiu t5 t5 -97
+mul s10 t0 t4
+add x0 t1 s3
+ori t3 s7 1545
+mulhsu a3 s8 s2
+sltiu t3 a2 -1657
+xori t3 s6 -1158
+xori s4 s4 163
+addi s0 t1 -1713
+srli s1 x0 21
+slt a2 s7 s7
+rem s5 s8 t5
+slt t2 a5 a5
+remu s7 a0 s11
+mul a3 s1 a0
+auipc t4 226983
+sll a0 a5 t5
+sra s1 tp s0
+or s3 a4 a5
+remu s4 s5 s7
+mul s6 s9 tp
+lui a6 1035023
+sltiu s5 a6 525
+srli a0 a6 0
+srai x0 s6 0
+srl s8 t4 s1
+remu a5 s0 a3
+srai a5 a5 9
+sub t4 s11 t1
+slt a7 a6 t6
+sltu s3 s4 tp
+srli s9 s9 3
+slti t5 s1 1394
+and t4 a1 a7
+mul t5 s5 a3
+sltu x0 s11 s4
+rem x0 t0 s3
+lui t1 367626
+add s3 t4 s9
+sub s0 t0 a0
+sub a6 s1 ra
+remu t4 ra s4
+sltiu t1 s2 -31
+slti s4 s7 -52
+xor s5 a0 a3
+ori a6 t0 -1704
+sltiu tp ra -973
+srli s4 a2 11
+slti t0 a3 -1175
+remu s2 s9 t6
+srl gp t0 s3
+and s9 a5 a5
+rem x0 gp t1
+div s10 t2 tp
+xori a3 s1 1834
+andi s11 s0 -128
+slli s3 s8 17
+sltiu tp s8 -1042
+div s2 x0 a4
+srai t6 tp 30
+addi t6 t2 -643
+sra a0 t1 x0
+auipc tp 778007
+sra a0 t2 a4
+addi s0 a1 -1818
+sltu a1 t1 a5
+mul tp s4 x0
+sll a0 gp s5
+xori a0 a4 -993
+andi gp s3 -153
+divu a3 s10 a0
 addi a0 x0 10
 ecall
@@ -0,0 +1,136 @@
+addi x0 x0 0
+addi ra x0 1
+addi sp x0 2
+addi gp x0 3
+addi tp x0 4
+addi t0 x0 5
+addi t1 x0 6
+addi t2 x0 7
+addi s0 x0 8
+addi s1 x0 9
+addi a0 x0 10
+addi a1 x0 11
+addi a2 x0 12
+addi a3 x0 13
+addi a4 x0 14
+addi a5 x0 15
+addi a6 x0 16
+addi a7 x0 17
+addi s2 x0 18
+addi s3 x0 19
+addi s4 x0 20
+addi s5 x0 21
+addi s6 x0 22
+addi s7 x0 23
+addi s8 x0 24
+addi s9 x0 25
+addi s10 x0 26
+addi s11 x0 27
+addi t3 x0 28
+addi t4 x0 29
+addi t5 x0 30
+addi t6 x0 31
+lui gp 1
+addi gp gp -2048
+rem t0 s6 a3
+lh a5 178(gp)
+slt a5 s8 s6
+lhu s1 -884(gp)
+lhu a6 1182(gp)
+addi tp x0 1
+sw ra 724(gp)
+sb s5 1401(gp)
+remu t3 a5 s8
+rem a3 a3 s5
+sra t4 a6 a4
+lbu a1 413(gp)
+xori a3 t2 -1314
+lw a5 -676(gp)
+slli s7 s8 26
+slt a7 s9 t0
+srl t1 s5 a0
+and t1 t1 t1
+addi tp tp -1
+bne tp x0 -52
+srli t5 s0 16
+sh a6 1362(gp)
+remu a5 a3 s1
+sra ra s6 t0
+auipc t2 894118
+auipc s0 941752
+xori a3 a2 1413
+lb s9 -396(gp)
+sub s6 a6 a3
+mulhsu a3 s2 s1
+bge t0 a7 20
+sltiu a2 a7 -1355
+and a7 t5 s6
+sb s9 -806(gp)
+srai a3 s5 19
+addi tp x0 8
+sra a1 t5 t2
+slli s0 s4 7
+mulh s7 a2 a6
+addi tp tp -1
+bne tp x0 -16
+bgeu s6 s10 48
+divu t2 t3 s4
+mulhu t5 a6 a1
+lhu a0 -996(gp)
+sw t2 -28(gp)
+auipc s10 837628
+xori s4 s3 -1869
+mul s2 t1 s3
+mulh a3 a4 t1
+mul s9 t4 s6
+bgeu t1 s11 12
+bltu a4 t1 8
+addi s8 t5 1666
+addi tp x0 7
+bltu a7 a5 56
+srli a4 s6 17
+lbu t5 -1670(gp)
+slti a6 s2 1171
+sb s3 -718(gp)
+srl ra t5 s2
+lui ra 611964
+blt t3 s4 56
+bge t5 s9 48
+sw a5 -1556(gp)
+srl s1 x0 s10
+sw ra 1872(gp)
+lb t0 -978(gp)
+remu t1 s0 s11
+mulhu s3 t0 a6
+addi tp tp -1
+bne tp x0 -64
+slli s0 s2 27
+bge a0 s9 20
+addi a6 s8 335
+sra s5 s10 a1
+sltu t4 a6 t4
+rem s7 s9 s4
+lw t5 -1316(gp)
+lbu s0 -1368(gp)
+slti t2 s1 -522
+auipc s8 195120
+lui t6 326102
+mulhu s5 s1 t2
+or t1 a4 a2
+bne t6 t5 20
+or t2 s5 t3
+sh a0 1028(gp)
+srai s7 s9 24
+andi t4 a7 2041
+add s0 s8 t3
+bge a1 s9 12
+slli s2 s6 13
+lhu a7 -184(gp)
+sub a4 t3 t2
+lbu s0 84(gp)
+srl a2 s0 t5
+remu s11 s11 s9
+lbu s5 -1558(gp)
+divu t5 s3 ra
+addi a0 x0 10
+ecall
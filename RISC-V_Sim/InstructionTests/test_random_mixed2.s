@@ -0,0 +1,10036 @@
+addi x0 x0 0
+addi ra x0 1
+addi sp x0 2
+addi gp x0 3
+addi tp x0 4
+addi t0 x0 5
+addi t1 x0 6
+addi t2 x0 7
+addi s0 x0 8
+addi s1 x0 9
+addi a0 x0 10
+addi a1 x0 11
+addi a2 x0 12
+addi a3 x0 13
+addi a4 x0 14
+addi a5 x0 15
+addi a6 x0 16
+addi a7 x0 17
+addi s2 x0 18
+addi s3 x0 19
+addi s4 x0 20
+addi s5 x0 21
+addi s6 x0 22
+addi s7 x0 23
+addi s8 x0 24
+addi s9 x0 25
+addi s10 x0 26
+addi s11 x0 27
+addi t3 x0 28
+addi t4 x0 29
+addi t5 x0 30
+addi t6 x0 31
+lui gp 1
+addi gp gp -2048
+addi s3 s2 -1614
+blt s5 a1 44
+slli t5 a0 8
+sltiu t6 a4 -965
+add a0 a2 a0
+srl a5 a1 t0
+addi s10 x0 -1502
+xori s6 a2 517
+sltiu ra t0 -993
+lbu s10 -1792(gp)
+xori s7 t2 1359
+sw a1 -1076(gp)
+addi s8 t3 -1907
+lh ra 1852(gp)
+xor s7 x0 a7
+lbu a2 1563(gp)
+sw s7 560(gp)
+lbu x0 117(gp)
+sltu s10 a3 a7
+or ra s4 s5
+beq s6 a6 16
+lhu a1 -920(gp)
+xor x0 s6 s5
+sltu s10 a0 s11
+addi tp x0 7
+mul ra a1 t3
+slt a3 a4 t2
+mulh s6 s7 t6
+lb s9 -801(gp)
+addi tp tp -1
+bne tp x0 -20
+blt t2 t1 4
+ori ra s10 -1442
+add s8 ra a4
+rem x0 s1 s2
+slt s7 s6 a1
+mulh s0 a4 s3
+lb ra -1776(gp)
+xori s9 t6 1048
+lui s1 538962
+sra s6 t0 s6
+lbu s3 -977(gp)
+sub a4 x0 a7
+addi t4 a7 -241
+divu s6 s10 t4
+sw s2 -640(gp)
+slt a6 x0 t4
+mul a1 a5 a3
+addi tp x0 4
+lhu a1 1870(gp)
+lhu s11 1276(gp)
+ori s10 a0 1536
+add s5 s11 s3
+sll t6 t3 t2
+addi tp tp -1
+bne tp x0 -24
+sb s2 -610(gp)
+lw s5 172(gp)
+sra s0 ra s4
+lbu a7 185(gp)
+srli x0 a4 8
+lb x0 1615(gp)
+bgeu t4 s3 12
+lbu a4 735(gp)
+sll s0 t5 s4
+mulh t4 a4 s0
+addi s2 s0 -1354
+bgeu s11 a1 20
+blt s6 a1 20
+mul s6 a3 s4
+xori s5 a7 1878
+addi s1 a2 161
+bltu t2 s7 36
+lh a3 -1526(gp)
+mulhsu s10 t6 s1
+add t2 a0 s5
+bge s9 s2 20
+srli s0 s0 2
+lw s1 1712(gp)
+lw a0 -1128(gp)
+sltiu s1 t5 1628
+addi tp x0 2
+sh t6 -332(gp)
+or x0 s7 t1
+sb t1 771(gp)
+addi tp tp -1
+bne tp x0 -16
+xori s10 a5 -784
+sh s10 -1296(gp)
+or s11 a7 ra
+mulhsu s7 s1 s7
+xori t3 t5 -1332
+mulh a5 s7 ra
+slt a0 t4 t4
+slti a5 t2 -890
+lw t6 1184(gp)
+srai a2 s7 16
+srl a0 a1 t2
+sub t1 s8 s7
+lbu a6 -50(gp)
+xor a3 s1 t6
+auipc t0 596968
+xor t2 a6 a1
+mulhu s10 s4 t1
+addi tp x0 1
+rem a2 ra ra
+srli s3 a4 1
+sll t6 t0 s11
+slt t1 s7 s8
+sb t0 563(gp)
+lhu t6 -650(gp)
+sh a2 -716(gp)
+sub x0 s0 x0
+and s5 a5 s3
+blt s11 s5 56
+addi t4 s4 -1164
+addi tp tp -1
+bne tp x0 -48
+or a6 s4 a6
+sh t0 -1418(gp)
+xori s1 ra -789
+slt a4 s2 t4
+auipc s1 0
+jalr t4 s1 24
+bne a3 t2 32
+mulhu s0 a5 s11
+lb s8 -162(gp)
+auipc s3 806119
+mulhu a5 s10 s11
+lb a1 -10(gp)
+sh s9 -352(gp)
+ori s9 s8 -270
+mulhsu s5 s3 t6
+lw t6 -940(gp)
+sh s2 -1386(gp)
+lhu s8 1044(gp)
+addi s6 s1 -107
+andi t5 a7 962
+lui s11 509216
+sll s9 s4 a3
+auipc s0 0
+jalr t4 s0 44
+srai s4 s1 14
+and t6 ra s7
+bne t4 s6 52
+sltiu s4 s11 -743
+auipc t1 350306
+sltu a4 s4 s4
+slt s11 s7 t1
+addi s2 t0 -1611
+and s1 s1 s7
+beq a2 s1 24
+rem s8 t4 s9
+mulhsu s11 s7 s2
+sll s7 a2 s1
+addi ra ra 781
+bne t6 a2 4
+sb s6 1942(gp)
+srl t5 s4 t0
+ori a7 s2 1729
+and x0 a2 x0
+beq s6 s0 48
+addi tp x0 1
+xori s5 s11 -512
+andi t5 t3 -1737
+srai t5 a7 14
+xor s8 a0 s7
+addi a4 a5 -1247
+divu s1 a3 s10
+and s3 s7 a6
+addi tp tp -1
+bne tp x0 -32
+srli s7 t5 23
+bltu s6 a6 40
+divu s9 x0 s4
+slli a4 a3 0
+jal a5 36
+sra s1 s8 s0
+sb t1 -984(gp)
+slt s5 t6 s1
+xori t2 x0 -1691
+rem t3 s3 s9
+slli s1 a7 30
+and s0 s4 t6
+mulhsu s3 a6 a3
+xor s3 s0 a7
+mul s2 ra t6
+sltu t6 t6 s3
+lbu s6 -121(gp)
+or s3 s4 t6
+mulhu a1 s1 s7
+sub t3 t6 t6
+mulhsu t4 s6 s4
+mulh s10 a0 a6
+addi s2 s6 -570
+srli t5 s11 24
+sb s11 1323(gp)
+addi tp x0 2
+bne s6 t2 32
+ori t4 a0 1415
+bltu x0 a2 64
+sra t3 t3 ra
+and a2 s0 x0
+addi tp tp -1
+bne tp x0 -24
+sb a1 1959(gp)
+addi tp x0 6
+lui t6 952361
+lui t0 890674
+mulh a1 s2 s5
+mulhu t4 s0 s9
+slt t3 t5 t4
+add s1 a0 s9
+addi tp tp -1
+bne tp x0 -28
+lb t3 143(gp)
+lh t1 -1806(gp)
+lbu x0 -562(gp)
+divu s3 a6 s3
+lb s0 -785(gp)
+mulhsu a7 a7 x0
+lbu s11 197(gp)
+bltu t5 a3 20
+sb s1 1154(gp)
+and a5 t0 a2
+sw a4 88(gp)
+srli s4 t0 1
+addi tp x0 5
+sh x0 -1322(gp)
+slt a5 s11 t0
+andi t1 s6 -593
+xor t4 s2 ra
+div t0 t6 t0
+add a1 a7 ra
+srai s2 x0 7
+auipc s9 0
+jalr s8 s9 16
+srai s11 t0 19
+lhu a2 978(gp)
+andi s6 s2 -1965
+bne s5 t1 40
+srai s0 a1 9
+lh s9 1288(gp)
+srli t2 a0 5
+addi tp tp -1
+bne tp x0 -68
+remu t4 a1 a3
+xori t4 s6 878
+sra s1 s11 t3
+bltu s11 s1 64
+ori s11 s6 -800
+sltu ra t0 s0
+sub s7 a7 s10
+bge a7 s10 8
+rem t3 x0 a3
+srai s6 a2 0
+add s8 a1 t6
+divu s6 a0 s9
+lb t4 -806(gp)
+xor ra s11 a5
+sw s1 -676(gp)
+sra s2 a7 a0
+sh s9 672(gp)
+rem s9 s4 s1
+mulh a4 a7 s1
+slti s0 s4 -1633
+lh a5 -1394(gp)
+mulh a3 a5 x0
+lw s7 344(gp)
+and x0 s9 a6
+addi s6 s1 -809
+andi a7 a5 1474
+sb a5 -1462(gp)
+rem t1 s0 a4
+sub s11 s9 t6
+addi tp x0 5
+sw s4 464(gp)
+sw s0 1580(gp)
+slt s3 a7 a1
+lw s0 -1404(gp)
+and s3 t1 a2
+srli a0 s10 17
+remu a0 a7 a5
+lw a1 0(gp)
+addi tp tp -1
+bne tp x0 -36
+div s9 a6 a7
+add a1 s1 s4
+andi s1 a5 -1419
+bgeu a3 a3 20
+srl s1 a6 s1
+bge a2 a0 12
+addi a3 t5 -1399
+lbu s8 -1584(gp)
+sltu s11 s3 s3
+ori s8 s9 952
+ori a4 s10 1727
+srai ra t4 10
+jal s1 8
+mulhsu a4 s1 a5
+slt t4 s8 s11
+addi tp x0 2
+slti a0 s8 455
+sub s3 s8 x0
+divu s5 a1 a0
+bgeu t2 a4 32
+lhu ra 1178(gp)
+auipc s7 0
+jalr a3 s7 24
+beq t3 t0 56
+srli t3 a1 2
+lui a5 593692
+sub a7 a4 s8
+lhu s9 -188(gp)
+addi tp tp -1
+bne tp x0 -52
+remu a6 t2 a6
+lbu s2 988(gp)
+slti a2 a4 -1867
+div ra a7 t1
+sll s5 a1 a7
+bltu s0 a6 64
+beq a4 a1 44
+sra a4 s10 s8
+sw a6 -1636(gp)
+jal s1 12
+sll s10 s5 a4
+and a4 t2 s9
+lh t3 -1354(gp)
+divu t5 a2 a3
+lui s3 838410
+ori s1 a3 1307
+xori t4 x0 1676
+lw a1 1120(gp)
+auipc s6 192143
+sb s2 -87(gp)
+lb s0 -1414(gp)
+lbu s9 1313(gp)
+slt a6 t1 s0
+blt s11 s6 16
+sltu a7 a2 a3
+div t5 x0 a1
+slti t3 s9 781
+lbu s11 -1118(gp)
+sh s4 1638(gp)
+srl t4 s8 s6
+sltu s2 t3 t4
+lw x0 776(gp)
+srl a3 a4 s5
+lhu s6 1630(gp)
+addi tp x0 8
+andi s9 a4 1836
+lh s8 1040(gp)
+add t5 s11 s5
+addi a5 t4 613
+sb s4 1718(gp)
+sltiu s1 t5 -1746
+mulh s7 x0 t4
+slt a7 a2 x0
+lhu s0 -1258(gp)
+slti a7 t6 -44
+sh s9 -1314(gp)
+xori s8 t1 -677
+lh a4 -1484(gp)
+srl ra s1 t2
+lw t4 -300(gp)
+bge s5 t6 12
+addi tp tp -1
+bne tp x0 -68
+addi tp x0 1
+lh s9 -790(gp)
+sra t4 ra s11
+sub t0 x0 a3
+lh s7 -982(gp)
+srli s1 t5 7
+mulhu t3 a2 a5
+jal s1 8
+mul t0 ra a6
+srli t0 t3 17
+bge t2 a5 24
+srli a5 x0 27
+sltiu s7 s1 1796
+slti t1 t3 857
+addi tp tp -1
+bne tp x0 -56
+andi s9 s3 632
+srai a6 a1 30
+mulh a5 s1 a2
+andi s7 s4 -943
+slti a6 t3 -1051
+lhu s8 -498(gp)
+ori a4 a4 -243
+sw t6 -1932(gp)
+addi tp x0 8
+sub t2 t1 s1
+addi a1 s1 -1644
+sub s0 s6 ra
+slti a0 a7 -1226
+slli a1 ra 5
+andi a1 t5 1805
+sw s1 1876(gp)
+lw s6 1688(gp)
+rem s3 s11 t1
+srl a7 s1 s1
+auipc s6 923609
+auipc s9 992510
+lbu a1 1353(gp)
+and a0 s7 t2
+bne a3 s8 44
+andi s1 t6 1337
+addi tp tp -1
+bne tp x0 -68
+xor a0 a4 t1
+and a2 t1 a1
+lw s5 -208(gp)
+rem s2 a4 a1
+bgeu t1 a6 12
+bgeu ra a2 8
+sb t4 -1372(gp)
+addi tp x0 1
+remu s7 s11 t3
+bgeu s7 a2 36
+auipc a4 314485
+mul t1 a1 s4
+mulh s2 s2 s10
+beq s9 s0 16
+srai a7 s11 11
+lb a6 922(gp)
+and s10 a6 s0
+lhu ra 1862(gp)
+addi tp tp -1
+bne tp x0 -44
+slt s7 t1 s1
+lbu a0 -1022(gp)
+addi tp x0 1
+sltu s6 s4 t4
+addi t2 a4 -1817
+lui s3 935435
+slti a7 s7 -274
+sll s6 t1 s3
+sltu s4 a1 a7
+auipc t4 0
+jalr s5 t4 44
+sh t0 -824(gp)
+addi tp tp -1
+bne tp x0 -40
+sltiu s2 a2 964
+divu t0 t3 t0
+lhu s4 702(gp)
+auipc t2 897360
+add s4 s11 t0
+slti a7 s2 -1751
+addi tp x0 8
+ori s6 ra -1410
+lw ra 156(gp)
+andi x0 t2 -1004
+srai a6 t6 13
+bgeu s4 t3 12
+divu t3 s9 s2
+lbu s0 -313(gp)
+addi tp tp -1
+bne tp x0 -32
+mulhsu a5 s6 t2
+sw s5 -352(gp)
+sw a6 -1464(gp)
+slli a5 s5 20
+lb a4 -175(gp)
+sll t2 a2 a3
+auipc t1 0
+jalr s4 t1 36
+sltu x0 s6 s8
+auipc s1 731569
+slti s9 s7 -864
+sh a3 -608(gp)
+lw t3 1960(gp)
+sb s9 -920(gp)
+lb t6 1000(gp)
+addi tp x0 2
+mulh s3 s7 s5
+add a4 t1 t3
+slti a2 t5 1946
+rem s11 a5 x0
+mulhsu s5 t4 a4
+srli s3 t1 10
+bge t1 x0 4
+sw x0 -1812(gp)
+slli a6 a3 6
+addi tp tp -1
+bne tp x0 -40
+srli s11 s11 2
+slli a4 s2 1
+lui x0 315971
+andi t6 a7 959
+srli a5 s1 5
+lb t6 1726(gp)
+lui s2 460266
+divu a0 s6 s2
+mulhu a7 s7 t2
+sh ra 776(gp)
+remu s3 s7 a2
+lb s8 500(gp)
+srli t1 t2 0
+srai x0 a2 19
+jal ra 40
+sh s11 516(gp)
+bne s9 x0 16
+lhu t4 354(gp)
+sh s6 1136(gp)
+lw s1 260(gp)
+mulhu ra s11 s3
+sltiu t6 a7 -1398
+add t4 t3 s11
+lh s3 1014(gp)
+addi tp x0 8
+lb s9 -547(gp)
+divu a4 s4 s7
+lw a7 -32(gp)
+lhu s0 740(gp)
+sltiu a4 a2 1311
+beq a6 s5 64
+sw t6 1832(gp)
+srl a0 s1 s10
+bltu s3 s11 24
+srai ra t2 23
+addi tp tp -1
+bne tp x0 -44
+mul t4 s11 a2
+slli a4 ra 26
+slti ra s11 -1510
+auipc s9 747151
+mul a5 s10 t0
+bge s4 t5 52
+bgeu t2 s8 20
+lbu a5 1439(gp)
+sh s9 -1684(gp)
+srli s11 t4 30
+lb x0 890(gp)
+xor t5 a7 t6
+xor x0 s11 a0
+lw t4 88(gp)
+add t4 s9 s8
+slli t5 t5 6
+or s1 t3 a0
+lb s5 -1365(gp)
+divu t0 a3 s9
+srl a3 t6 t5
+or a6 t0 s0
+sltiu s2 s2 -780
+sub t3 t5 s11
+lbu s2 -1270(gp)
+or a7 s6 s10
+lui t6 735669
+bgeu a7 a0 4
+addi tp x0 4
+lh t1 1768(gp)
+xori s4 t2 -827
+lui a2 843934
+srl s4 t2 s3
+sh s9 28(gp)
+srli s6 ra 4
+mulhsu a4 s9 a7
+srai t2 t1 13
+sltiu t2 x0 -416
+auipc a3 0
+jalr s9 a3 28
+lhu a7 -1890(gp)
+xori s2 x0 1054
+sltiu s2 s7 -1663
+addi tp tp -1
+bne tp x0 -60
+sra s4 a5 a0
+rem ra t5 a4
+mulhsu x0 t6 t5
+sub s6 a7 t4
+xori t4 s10 -1025
+addi tp x0 3
+lb a1 265(gp)
+sh s5 1512(gp)
+bltu t5 s9 12
+sltu s2 s2 s2
+sub a3 s5 a2
+slli t0 t1 31
+lb s4 -1400(gp)
+rem a6 t4 ra
+lbu a4 347(gp)
+lbu s9 -1237(gp)
+slli s2 a3 26
+sb s2 -1911(gp)
+sh s11 -262(gp)
+addi tp tp -1
+bne tp x0 -56
+or t1 s3 t0
+and a7 t3 a5
+lh s11 216(gp)
+lh a4 -702(gp)
+sw a0 964(gp)
+lh x0 -938(gp)
+mulhsu t0 t6 t1
+sltu s10 s5 t2
+srl t4 s9 s4
+jal s0 8
+div s8 s5 s7
+addi tp x0 6
+sh s5 182(gp)
+mulhsu s0 a5 a7
+lbu a3 -1028(gp)
+beq s2 t5 36
+sub s8 t2 a2
+ori s8 t0 1540
+sh t1 -1874(gp)
+remu a2 a3 a2
+addi tp tp -1
+bne tp x0 -36
+andi x0 s0 807
+remu t0 s0 t5
+srai a4 a7 24
+srl a6 t4 a4
+rem s9 t0 s3
+addi tp x0 6
+sll s5 t0 a7
+addi t6 a3 -757
+srl x0 a0 a1
+bne t1 s9 36
+bgeu a5 a4 40
+mul s2 a0 s10
+lhu s2 -1338(gp)
+slt s1 a3 x0
+slt a7 s3 s6
+lbu t6 1283(gp)
+xori t3 s2 -1483
+lb s0 -322(gp)
+andi t2 a0 -985
+mulhu a2 t0 a7
+beq t6 a6 4
+addi tp tp -1
+bne tp x0 -64
+srai a6 a6 17
+addi tp x0 1
+mul s3 t2 s0
+andi s0 a0 -2010
+lb t6 -115(gp)
+sb a1 -1404(gp)
+slt a6 a6 x0
+srli a3 t3 2
+lbu a2 1160(gp)
+andi a7 s6 -1633
+add t2 s9 a7
+addi tp tp -1
+bne tp x0 -40
+xor a2 x0 t4
+div s9 t3 t0
+lh s8 1480(gp)
+srli t0 s0 16
+lb s10 -330(gp)
+bne a1 t0 32
+xor t0 a7 a1
+sw a2 -1744(gp)
+div a7 a4 a4
+lbu a4 798(gp)
+sltiu s3 s9 1700
+bge t3 s3 16
+addi x0 s9 1593
+sub a0 a0 a6
+slti a7 s10 1515
+addi tp x0 3
+remu a0 x0 ra
+bgeu s7 a3 20
+sw a5 872(gp)
+addi s7 t2 -1762
+addi tp tp -1
+bne tp x0 -20
+addi tp x0 2
+div s8 s3 t2
+xori x0 a7 903
+slli t6 s2 15
+sh t4 -1554(gp)
+srai s10 a6 0
+blt s8 a5 32
+remu s11 s3 a1
+addi tp tp -1
+bne tp x0 -32
+andi a6 t4 -1844
+auipc t1 0
+jalr s2 t1 12
+srl s5 a7 a6
+addi tp x0 6
+lbu a0 633(gp)
+srl a6 t4 s9
+lhu t4 58(gp)
+div t6 s9 s11
+or s11 t0 t3
+lw a1 -2044(gp)
+sw s2 -380(gp)
+sh t5 -828(gp)
+bltu t3 a7 36
+lbu s7 -1810(gp)
+addi tp tp -1
+bne tp x0 -44
+lui t5 14380
+slli t0 t0 22
+auipc x0 732755
+sh s2 -808(gp)
+sll a1 s4 s4
+addi tp x0 8
+andi t4 s4 -93
+sb a1 -7(gp)
+sltu a5 s3 a7
+xori s10 s11 -948
+ori a7 t3 -1847
+lh a1 -1684(gp)
+sltiu t0 a0 1132
+ori s9 a4 -1254
+slt ra x0 ra
+bne a4 s5 4
+div s3 t1 s10
+addi tp tp -1
+bne tp x0 -48
+mulhsu s0 s1 a6
+lw s10 1856(gp)
+addi s2 s2 -1447
+sub t6 a7 s11
+xor a1 a7 a0
+addi tp x0 7
+lw t2 -1840(gp)
+lui s9 726328
+slt t1 ra a1
+lui s5 472271
+auipc s1 353053
+xor s9 s9 x0
+slt s9 t3 s9
+bge s6 t3 32
+sltu s9 s8 t2
+sll a1 s3 s6
+addi tp tp -1
+bne tp x0 -44
+sb a0 -355(gp)
+mulh s2 a7 a1
+bltu a1 s4 28
+sltu a3 a4 s2
+lh t1 -1988(gp)
+mulh a1 s8 a2
+divu a4 a3 ra
+or t3 t6 t0
+addi t2 a7 1768
+addi tp x0 4
+add t4 t2 a1
+lw t6 -1376(gp)
+sll s10 a5 s4
+addi tp tp -1
+bne tp x0 -16
+lb s6 1019(gp)
+jal t6 36
+slti s6 t2 111
+lbu s3 -586(gp)
+lui t4 581377
+sh t2 1308(gp)
+sw s2 -1280(gp)
+slt s9 s3 a3
+auipc s1 638961
+mulhu a7 t2 s3
+bgeu a3 s0 36
+slti s5 s6 -1534
+slti s5 t4 -304
+sll s7 s4 s11
+sw t0 -396(gp)
+mulhu a2 s8 s8
+lb a5 1047(gp)
+mulhu a7 a4 s3
+sw t2 -948(gp)
+lw t6 -1252(gp)
+div x0 t2 a7
+div s3 t5 a1
+lw s9 20(gp)
+auipc a1 152900
+srli s2 t5 9
+srli s8 t3 10
+sltiu s9 s10 -799
+lh s3 -2014(gp)
+sh s3 -776(gp)
+sub x0 s8 s1
+bgeu t6 s3 40
+div s4 a4 ra
+mulhu t5 s10 x0
+mulhu x0 s2 s9
+auipc a7 786882
+slti t2 s7 720
+sb t5 1046(gp)
+slti s2 a3 1602
+lbu a6 -1497(gp)
+mulh s4 s0 a5
+bltu s8 a1 56
+mulhu s11 t4 a2
+jal a3 4
+lh s9 -652(gp)
+lbu a2 -1545(gp)
+auipc s10 126143
+or a6 s4 t2
+lb a7 1899(gp)
+add t6 s9 a0
+sw t2 972(gp)
+srli a2 a2 25
+beq ra x0 64
+andi a2 a2 -1684
+slt t5 s10 s9
+lhu t2 1036(gp)
+slli s5 s10 10
+rem t1 s6 s8
+sub x0 ra s7
+srli a1 a1 10
+lw s3 -1940(gp)
+jal t6 36
+xori ra a3 -1242
+mulhsu s2 s9 s10
+mulh s8 a1 t3
+beq a4 t3 40
+blt s3 s7 48
+sra s9 a2 t1
+sh a7 -1372(gp)
+mul t6 s7 s11
+add s9 s9 ra
+addi a2 t4 -166
+sb t6 187(gp)
+mulh t2 t4 s8
+add t5 t4 a3
+srai a0 s1 9
+slti a2 s5 68
+jal t3 4
+bne s0 t4 28
+sh s0 -1798(gp)
+mulhsu s11 a4 a7
+div s6 x0 t0
+or s2 a5 s6
+bgeu s2 t2 24
+mulh t5 x0 a4
+add s3 t4 s3
+lbu s0 -1913(gp)
+sw t6 1444(gp)
+beq s7 s10 4
+sltiu a0 t2 475
+divu t6 a2 s5
+bltu t2 t2 20
+or t3 a4 s7
+bltu t2 s5 32
+lh s9 38(gp)
+mul a7 a0 t5
+lhu t1 842(gp)
+sll a4 t6 a1
+lb s11 523(gp)
+sub s4 a7 s10
+and s7 s0 a7
+rem t4 a0 s11
+sw a4 2036(gp)
+mul s11 t1 t1
+mulhsu t1 ra s6
+mulh t2 s1 s3
+sb s4 -635(gp)
+sb t0 -107(gp)
+bne s1 a5 64
+srai s4 a3 27
+slli a4 s11 6
+sh s7 -1808(gp)
+and ra t4 s4
+ori s10 x0 223
+lui ra 140182
+or t3 t6 t6
+sltiu t0 s9 1846
+andi a0 t1 -434
+lbu s7 -1496(gp)
+mulh a5 a7 a6
+sltiu x0 a6 832
+lb a7 -1501(gp)
+srai s10 t2 13
+andi a3 s9 -1261
+rem t2 s3 s8
+mulhsu s2 x0 x0
+mulhu a0 s4 a3
+lbu s10 -1325(gp)
+lbu s5 -726(gp)
+lw s11 -616(gp)
+slt a2 s6 a7
+sh s1 722(gp)
+sw t2 188(gp)
+lbu s2 1273(gp)
+or s3 a1 ra
+xor s5 s0 a1
+or s9 s6 s7
+andi s8 s7 -1384
+lh s0 -760(gp)
+mulhu a5 s6 s5
+div s1 t4 t3
+ori x0 t6 -858
+remu t3 a6 a2
+blt a0 t1 64
+sra s11 s7 s7
+xori t4 a5 -443
+sw a6 1700(gp)
+add a5 a5 x0
+sh s2 -998(gp)
+sltiu t1 s3 546
+ori t0 s3 -716
+lbu s8 622(gp)
+lw a0 1744(gp)
+divu t6 a4 a2
+rem a1 s7 a7
+bltu s4 t0 4
+bltu s6 t5 48
+lbu a3 -526(gp)
+bgeu s1 s6 44
+bge s2 t3 56
+sb s8 -1152(gp)
+lbu a3 690(gp)
+andi x0 a2 -17
+srai s6 a3 17
+sb a2 881(gp)
+lhu a3 706(gp)
+bgeu s1 ra 32
+lh s6 -1540(gp)
+sltiu x0 a4 -1032
+lw s2 776(gp)
+sw s9 -272(gp)
+sll s8 a1 t5
+xori a3 t0 -413
+sltiu a7 a2 -1183
+addi tp x0 5
+lhu s2 64(gp)
+or x0 t6 s5
+srl t5 t3 t5
+mul x0 s10 t3
+addi tp tp -1
+bne tp x0 -20
+mulhu s1 s11 s0
+sltu s7 t3 a1
+rem s4 a3 a3
+mulhsu a4 a1 s5
+sw t4 196(gp)
+bgeu s7 x0 4
+addi tp x0 4
+sltu s10 a6 t5
+slt s10 a0 a1
+bgeu t5 s8 52
+div s5 a6 a6
+sltiu s8 s6 1207
+sb a7 323(gp)
+slli t5 t5 31
+sh t2 1744(gp)
+sll s7 a5 a5
+lw a1 -136(gp)
+div a1 a5 s0
+lh a0 1394(gp)
+sb t4 112(gp)
+addi tp tp -1
+bne tp x0 -56
+addi tp x0 1
+sll t3 s9 t0
+sb s0 -1620(gp)
+sub s8 s2 s6
+sll t5 a1 ra
+sb s5 -778(gp)
+sll a0 ra s0
+sltu t4 s1 ra
+addi tp tp -1
+bne tp x0 -32
+beq a3 s0 12
+mul a4 a2 a2
+mulhsu t0 ra s7
+sra ra s11 a0
+or s10 x0 s8
+sltiu a3 s1 -825
+bgeu t6 a6 40
+and t6 t3 a1
+blt a6 t3 12
+lw a1 -364(gp)
+and a3 a5 s1
+xor s8 s2 t4
+blt x0 s3 28
+auipc t5 636246
+mul t4 t1 t0
+sb s2 543(gp)
+mul t4 s1 s7
+sh a2 -1840(gp)
+lw a3 44(gp)
+sw s9 484(gp)
+divu a3 t2 s6
+rem a4 a1 t5
+srli s4 s4 9
+sb s5 1537(gp)
+addi tp x0 1
+lb s2 -1133(gp)
+addi tp tp -1
+bne tp x0 -8
+sltu t4 a0 t6
+lw t2 1144(gp)
+srai t2 s5 3
+srl t5 a1 s4
+lui t3 476152
+jal s1 32
+mulhsu s9 s8 x0
+remu t5 a0 a3
+xor s10 t1 s0
+auipc s8 456915
+sltu a7 a7 a7
+mulh a0 t5 s5
+sb a1 1940(gp)
+div t1 s1 x0
+ori t3 t4 -167
+auipc a3 711056
+slti s2 s6 -1473
+mulh t0 x0 s2
+ori a5 a4 -1884
+mulh a0 x0 s1
+sw t6 -1824(gp)
+andi s6 a4 -1644
+ori t2 s7 -551
+sltiu t2 a5 -290
+addi tp x0 7
+sb s7 -1293(gp)
+srai a4 s9 6
+mulhu a5 t5 a6
+slt a6 t6 s2
+addi tp tp -1
+bne tp x0 -20
+slli s0 s3 3
+lb s6 1978(gp)
+slt a1 s8 t0
+sltiu a3 a7 -1354
+xori a2 s3 -146
+sltu a5 s11 s1
+sh a4 1808(gp)
+sub a0 a5 s6
+add s7 s11 s0
+lbu s6 627(gp)
+addi tp x0 8
+add t5 t1 s11
+mulhsu t1 s8 t5
+sb s0 360(gp)
+lh s0 1396(gp)
+slti a7 t0 -1019
+auipc s6 804652
+or t1 s11 s0
+slti s9 t6 -1807
+xor s1 a1 s1
+addi a3 s1 -1167
+auipc a1 963858
+beq a7 a4 12
+addi tp tp -1
+bne tp x0 -52
+or t6 t3 s11
+srli x0 a7 23
+sltiu x0 t0 -1893
+lhu a6 -1358(gp)
+srli s3 x0 31
+addi s10 s5 -1551
+slt s8 a4 s4
+lw s11 756(gp)
+div t4 ra a2
+addi tp x0 6
+remu s9 x0 t0
+div a7 s9 s11
+sb s7 188(gp)
+sw a3 -1496(gp)
+slli s9 a1 24
+mulhsu ra t5 t4
+mulhsu t3 s6 s5
+addi tp tp -1
+bne tp x0 -32
+or ra s6 t5
+mulhu s0 s3 s5
+sh s0 -42(gp)
+addi t0 t3 -844
+and t6 s9 s6
+sb t0 121(gp)
+div t0 s3 t5
+sltu s8 s5 a5
+bne a0 s3 60
+sw t6 -1828(gp)
+mulh s9 t3 s7
+lh t0 -538(gp)
+slli s2 s10 11
+addi tp x0 4
+xor a5 s9 s9
+jal s2 8
+div a1 ra t3
+bltu a1 s5 44
+addi tp tp -1
+bne tp x0 -20
+sb t3 -1950(gp)
+mul t6 t5 s9
+sra a2 a6 s11
+or s8 s2 s6
+sb a2 1243(gp)
+rem a2 t2 s5
+sb a6 1376(gp)
+addi s10 s7 -1114
+addi tp x0 3
+sltiu a7 t0 -1895
+ori a1 t6 -954
+divu a1 s9 t1
+slti s4 x0 -401
+sll a0 t2 a4
+addi tp tp -1
+bne tp x0 -24
+ori s1 s3 -1542
+sh t1 24(gp)
+or s1 a0 s7
+mulhu s10 s7 t4
+lw s7 1340(gp)
+addi tp x0 8
+auipc a2 264076
+lhu s4 -290(gp)
+srli s9 s2 15
+sw s11 1308(gp)
+lhu t3 498(gp)
+mulhu a4 t3 a5
+xor a5 x0 ra
+addi tp tp -1
+bne tp x0 -32
+sw a3 -12(gp)
+sra t4 a4 t4
+slt s8 t0 s0
+sltu s10 ra s5
+sltu a6 a6 ra
+slt s3 ra s3
+sll s0 t4 s0
+auipc t4 0
+jalr s1 t4 24
+auipc a7 229566
+xor s6 s10 t1
+beq a2 a6 8
+jal s7 4
+addi tp x0 6
+xor a0 s6 s9
+lbu s10 93(gp)
+slli a5 a7 29
+bgeu s4 a7 60
+addi tp tp -1
+bne tp x0 -20
+slli s4 a5 3
+addi a7 a1 166
+lh a6 410(gp)
+addi tp x0 6
+div x0 s8 x0
+mulh s3 t6 s3
+bgeu s11 ra 36
+addi tp tp -1
+bne tp x0 -16
+lhu t1 1862(gp)
+or s6 s2 a1
+srli s10 t3 17
+sll t1 s0 a5
+lh s7 -1214(gp)
+andi s5 a0 -632
+sh s3 1396(gp)
+addi tp x0 2
+slt a4 s4 s3
+lhu x0 264(gp)
+divu a2 s6 t5
+sw t6 -580(gp)
+sw s4 408(gp)
+andi a3 s2 -353
+add s1 a0 s3
+srli s9 a5 28
+addi tp tp -1
+bne tp x0 -36
+auipc a0 240656
+lw ra 1968(gp)
+slli t1 s8 23
+mul s6 ra a1
+addi tp x0 3
+mulhsu s9 s6 t1
+lb a2 -1059(gp)
+addi tp tp -1
+bne tp x0 -12
+mulhu a7 s9 s9
+blt s2 ra 16
+bgeu s1 s3 16
+sw a4 -2028(gp)
+mulh a6 a4 t5
+div t4 s8 a5
+lw a0 220(gp)
+lui s2 533706
+mulh t2 t4 t2
+remu t3 s8 s5
+blt t0 s2 12
+xor a3 a3 a4
+and a4 a5 a0
+addi tp x0 1
+add s11 x0 a0
+lhu s0 -890(gp)
+andi s0 a3 201
+slti s7 a7 -1545
+andi a5 s0 -216
+mul a2 s10 s11
+auipc s6 0
+jalr a0 s6 64
+blt a2 t6 56
+bne s7 s1 48
+srai s3 t6 17
+addi tp tp -1
+bne tp x0 -48
+mulh s8 s1 a0
+bltu a3 s9 44
+rem a0 a3 s6
+sh a5 1510(gp)
+divu x0 s4 a7
+bgeu t4 a6 56
+sb a4 -227(gp)
+sltiu s9 t1 -1840
+addi t1 t2 -507
+sw s4 1816(gp)
+xori s10 s11 655
+sltu a6 s7 a0
+andi s8 t1 656
+sh t0 -252(gp)
+lb a5 1164(gp)
+lw s7 -1196(gp)
+addi a4 s6 -310
+lw t0 -92(gp)
+bge s11 s6 40
+slti a2 s1 1718
+lh a2 -632(gp)
+lbu s1 1827(gp)
+lb t3 1419(gp)
+sh s10 1814(gp)
+andi s0 a3 -1554
+ori t3 t0 -200
+div a5 t1 s9
+lhu t3 -1400(gp)
+sb s8 335(gp)
+add a6 s2 s0
+bgeu t0 s7 8
+sb a0 1300(gp)
+remu t1 t6 t4
+addi tp x0 2
+sll s7 s4 s1
+jal s5 44
+ori t3 t3 -92
+sh ra 430(gp)
+addi tp tp -1
+bne tp x0 -20
+mul s6 s11 a0
+sh s9 -1208(gp)
+mulhsu t6 t3 x0
+addi s1 ra 426
+bne a0 a1 20
+add s6 s8 ra
+sw s9 164(gp)
+lbu t1 1387(gp)
+add t3 s3 t5
+sra a6 t1 s5
+or s10 a4 t5
+sh ra 802(gp)
+lui s11 873013
+lhu a6 208(gp)
+slti t6 a7 -1190
+divu s5 t3 s10
+sw x0 52(gp)
+lh t1 -538(gp)
+lhu ra -18(gp)
+bne a2 s10 44
+lb s7 -1614(gp)
+mulh t3 t0 t2
+bge t0 a7 56
+and s6 ra t1
+slti a5 s9 1320
+sltiu t6 t3 922
+srl a3 x0 a0
+lw t2 -388(gp)
+lw a0 -2004(gp)
+sltiu s4 t1 1357
+sra s10 s7 a3
+lbu s10 -1822(gp)
+addi a7 s9 -179
+andi s2 s8 455
+rem t5 ra a4
+add t2 t0 a0
+bltu t3 s5 8
+mul x0 x0 t1
+srl s11 s0 a5
+mulhu s3 a1 a1
+add s7 s2 a6
+lbu s4 -1781(gp)
+bge a5 s5 40
+mul t2 t6 s0
+slli t2 t5 5
+addi ra a2 -109
+mulhu t4 a1 s10
+xor ra t4 s9
+sltu t0 ra t4
+xori t1 t2 -1502
+sltiu s0 s11 -1098
+add a3 s1 a3
+srl a2 a0 a2
+slli a0 t2 3
+mulhsu s8 a0 t5
+sltu t4 s9 s11
+lw t4 664(gp)
+bgeu a4 t6 16
+auipc t1 534452
+lb a3 193(gp)
+divu a1 a2 t2
+addi tp x0 1
+and a5 s10 t2
+sra a6 s6 s11
+srl x0 ra s7
+xori a6 a1 -810
+addi tp tp -1
+bne tp x0 -20
+sb ra 2021(gp)
+auipc s3 0
+jalr a2 s3 68
+mulh s8 s8 t5
+rem s1 a7 t6
+lbu t4 1301(gp)
+bgeu a4 a0 12
+srli ra s2 21
+xor s0 s0 x0
+slti ra s7 -1801
+sltiu t4 x0 -1655
+lb a0 -642(gp)
+rem a0 t4 a2
+srl s3 t5 s1
+remu s3 ra s10
+bge t3 a1 36
+lbu t3 996(gp)
+sra ra s9 s2
+sll s8 s8 t0
+lbu t4 1452(gp)
+sra s10 t0 t2
+srl a2 s2 t2
+lui t4 628574
+and x0 t6 a4
+mulhu x0 x0 a4
+or s9 s3 s2
+div s0 s3 a3
+mul t3 s7 x0
+divu a5 a7 a5
+sw x0 -1380(gp)
+lb a6 1674(gp)
+lw a7 -352(gp)
+lbu a2 1805(gp)
+lw s11 1220(gp)
+add a6 a7 s11
+div t0 x0 s2
+auipc s6 945766
+sltu a3 s10 t1
+sw ra -96(gp)
+auipc s5 1034150
+srai a5 a7 25
+slt a3 s6 t4
+lb x0 -238(gp)
+sh x0 212(gp)
+lh s0 16(gp)
+lw s8 -1380(gp)
+xor a7 a0 s5
+srl a3 a6 a7
+div t4 s5 a0
+remu s4 t0 s11
+ori a7 a0 -1949
+lbu a6 -225(gp)
+lbu a3 335(gp)
+slti a4 s4 1430
+sb s3 1032(gp)
+or s9 s2 s1
+xor a1 a4 a1
+lhu a0 -972(gp)
+srai s8 s8 16
+auipc s8 92416
+lbu s0 1313(gp)
+lhu s7 -858(gp)
+sltu t2 ra a2
+ori s11 t5 -1962
+andi s4 s7 -936
+sll a4 a4 t5
+slt s0 t5 s8
+sll s9 a0 a0
+bgeu t3 t3 56
+div a0 s4 a3
+mulhu t6 a0 t0
+rem s4 x0 a6
+ori a5 s2 -1893
+sub a6 s4 x0
+bge a3 x0 32
+sll s10 t3 t2
+bne s3 ra 64
+addi t2 a7 -1835
+lbu t2 215(gp)
+bltu a4 t0 4
+remu a4 a0 t0
+sltu a6 s10 t6
+addi tp x0 2
+bge s10 a2 52
+sra t4 t5 a0
+addi tp tp -1
+bne tp x0 -12
+mulhu x0 a1 s6
+lhu s9 1250(gp)
+rem a7 a4 a7
+sw t2 -1212(gp)
+xor s1 s6 a2
+mulh t3 s3 a4
+srl s4 s1 a0
+add s5 t4 a3
+sll a6 s4 s10
+sw s3 708(gp)
+lhu a4 -1580(gp)
+lui s10 805894
+srai a7 a2 1
+xor ra t6 a0
+bge t4 s10 36
+sra a5 a0 s10
+ori s10 a4 -1601
+sltu s1 s7 a3
+lw x0 312(gp)
+sb t1 -1542(gp)
+sw a6 -1468(gp)
+lhu s8 1806(gp)
+lw s10 728(gp)
+addi t1 s5 -1460
+andi s11 a1 1891
+lhu a6 -2002(gp)
+jal t6 8
+or a6 t0 a7
+addi tp x0 8
+lb x0 -133(gp)
+sll s9 s5 s10
+sltiu s10 s9 -839
+addi tp tp -1
+bne tp x0 -16
+lw s8 1152(gp)
+addi t3 s2 -1680
+slli s9 x0 0
+sll t5 s2 s4
+lh s10 -452(gp)
+srli s2 t3 30
+lb t4 114(gp)
+sb t3 245(gp)
+andi a5 a2 -376
+lh a3 416(gp)
+auipc a2 0
+jalr s8 a2 48
+lb a0 -1547(gp)
+srl s10 a6 s2
+lbu a2 791(gp)
+addi t0 s6 318
+ori s8 a5 -1496
+sw s1 -1800(gp)
+mulh t5 a4 s5
+bltu a0 s8 28
+xor x0 s5 t5
+lw a7 -1500(gp)
+sra s6 t6 a3
+lhu a6 1248(gp)
+lhu t6 -280(gp)
+sw s0 2044(gp)
+auipc s5 195003
+auipc a3 964495
+lbu t5 -1213(gp)
+sb t5 424(gp)
+div a5 s0 s6
+bgeu s0 t0 4
+slt a0 t4 t6
+sw a0 1676(gp)
+ori s10 s10 -1056
+add a0 a6 a7
+sw t1 1172(gp)
+andi a2 s1 1880
+lw t5 464(gp)
+addi t0 a3 -369
+mul a0 s7 t3
+bge a3 a1 28
+auipc a5 985223
+bltu s0 s7 40
+div a7 s4 s8
+slli t1 s2 31
+sh s7 -1454(gp)
+ori ra t0 -778
+srli s4 s9 19
+sh a6 -1618(gp)
+mulhu a4 s11 s0
+divu s8 a0 a0
+add a3 a4 s8
+lb t6 -1677(gp)
+sw s3 4(gp)
+sub s4 s11 a0
+lw a7 -1296(gp)
+and t2 t6 s7
+div t1 s1 t2
+slti a1 s7 -106
+sub s0 s2 ra
+sw s7 456(gp)
+sw s1 520(gp)
+sh t2 1074(gp)
+sw t3 -836(gp)
+lh t6 -8(gp)
+remu s3 x0 a7
+andi s3 s7 -662
+lui a5 418196
+sh x0 1040(gp)
+lb a5 -1739(gp)
+addi tp x0 3
+lb a2 638(gp)
+rem t1 t3 t6
+lhu ra -1530(gp)
+sw s4 -1968(gp)
+lhu t3 -1778(gp)
+slti a1 s8 -1761
+xor a0 a1 s0
+xori s1 s1 421
+srli t6 s7 5
+addi tp tp -1
+bne tp x0 -40
+remu t3 s1 a7
+andi a4 s8 -267
+lb a0 874(gp)
+sra x0 x0 s3
+sw a7 -1380(gp)
+sb x0 967(gp)
+sb a7 -1789(gp)
+and s11 s6 a7
+remu a1 s9 s5
+andi s8 s8 -1742
+lb ra 1277(gp)
+sb s9 779(gp)
+addi tp x0 6
+srl x0 s3 a3
+slt s11 t1 s1
+sub s10 s4 a1
+xori t5 a6 -257
+addi tp tp -1
+bne tp x0 -20
+addi tp x0 1
+lb t2 -338(gp)
+sw a2 1584(gp)
+addi x0 s3 1390
+lbu t0 -300(gp)
+xor s0 a2 s7
+srl s7 s4 t1
+bltu a6 t2 20
+sw s7 -252(gp)
+srai s4 t1 27
+lui t6 691498
+sll t5 s5 s11
+sw x0 1412(gp)
+addi tp tp -1
+bne tp x0 -52
+lb t4 -1003(gp)
+mulhu s6 a0 t5
+sh ra 436(gp)
+divu a3 x0 a7
+slti x0 s8 1366
+auipc t3 309512
+mulhsu t0 a6 s3
+lbu t4 741(gp)
+mulhsu a0 s11 s3
+divu t5 s1 a5
+xor a3 t6 a6
+auipc t3 348305
+srai a4 s6 3
+slt a1 s1 a2
+sw s9 -744(gp)
+slt t1 s0 t2
+add s4 x0 s5
+blt a3 s6 16
+sltu s11 x0 a4
+slti s5 a4 -297
+sh a3 -1970(gp)
+srai ra a0 3
+xor s11 a0 t2
+and t4 s7 a0
+lhu s0 2022(gp)
+sw t1 1700(gp)
+jal ra 16
+xori s0 t6 103
+sw a2 -1420(gp)
+xor s10 t5 t5
+addi tp x0 6
+lw a3 1960(gp)
+srl a7 t2 a5
+srai ra s4 11
+slt a5 x0 s0
+slli s11 t0 9
+lb ra -1078(gp)
+lbu t2 35(gp)
+or s1 t6 a2
+lw s2 -644(gp)
+addi tp tp -1
+bne tp x0 -40
+mul s4 a5 s5
+lhu s8 -1688(gp)
+sb s3 1404(gp)
+bge x0 a1 16
+and s5 t0 s0
+slli s9 s10 10
+or t5 x0 s5
+auipc t5 0
+jalr a3 t5 24
+srl ra t0 s1
+sra a5 t6 ra
+bge s0 t5 28
+lhu t5 416(gp)
+lh ra 1622(gp)
+and s10 s11 t1
+srl s2 a5 s3
+ori x0 s1 -1791
+rem s1 a7 a6
+addi s6 ra -361
+slli t0 t0 27
+auipc a4 0
+jalr t1 a4 24
+slt s2 t3 t2
+lhu s2 -1370(gp)
+sb a3 1194(gp)
+sra ra a0 t4
+xori t4 t1 -2043
+sltu a1 a7 s4
+lb s2 347(gp)
+or s5 s6 a3
+bgeu a7 t6 56
+xor a3 ra s7
+beq t2 ra 12
+or s3 s6 t1
+and s2 s2 s8
+addi tp x0 8
+blt a5 s8 52
+sh a3 336(gp)
+lui a6 6844
+addi tp tp -1
+bne tp x0 -16
+add a0 t3 s3
+sltiu s4 s11 -1376
+jal t1 48
+lb a6 1575(gp)
+lhu s1 1940(gp)
+srai a3 a0 1
+srl a2 a4 a4
+bgeu a6 a6 56
+xori t1 s9 -1248
+sh s6 -398(gp)
+mul s11 s4 s1
+andi t3 ra 1954
+lb a0 -450(gp)
+sw s4 1016(gp)
+lh s1 -1972(gp)
+sll t6 s5 s2
+lui s7 305161
+sltiu s10 a4 227
+sltu s3 t4 t0
+slli a4 t3 16
+sltu x0 s9 s3
+lh s9 -1026(gp)
+andi t4 x0 1794
+mulh s2 a2 a1
+srai t1 t3 30
+sltiu s9 a6 -33
+remu a3 t3 s8
+add t0 s6 ra
+remu t2 s5 ra
+auipc s2 1033502
+mulh t5 a5 s4
+lw a5 -968(gp)
+sll a3 s9 s0
+mul s10 s9 s3
+addi tp x0 1
+lb t4 915(gp)
+lbu ra -2027(gp)
+lhu s10 1554(gp)
+xori t6 s6 -1214
+mulh s8 s6 s2
+lui x0 23889
+lh s7 1092(gp)
+andi t0 s0 1273
+sltiu s8 s10 -1065
+srli s11 a5 16
+ori s2 a6 -1471
+lh s4 234(gp)
+sh a1 1352(gp)
+blt t6 t5 12
+andi x0 s8 1904
+sh s3 -672(gp)
+addi tp tp -1
+bne tp x0 -68
+sub s0 s8 a2
+mulh t4 s4 x0
+lui t6 785733
+addi tp x0 4
+lui s5 416513
+bge s5 s5 32
+mul t2 a5 s11
+sb s0 427(gp)
+sh a7 -1032(gp)
+addi tp tp -1
+bne tp x0 -24
+lh s3 754(gp)
+bge t2 a0 40
+mulh s8 s5 a0
+sltu s6 s9 s2
+add s3 s4 s2
+bgeu s10 x0 36
+sw t1 2016(gp)
+lhu a4 1906(gp)
+sb s8 -1198(gp)
+lw ra -1612(gp)
+divu s2 t5 a1
+sw a4 -1760(gp)
+xor s5 x0 t4
+blt s6 s10 4
+addi tp x0 1
+xori s4 t1 -542
+or a7 t0 a3
+lh s10 146(gp)
+sb s9 265(gp)
+slli t4 t3 14
+mulhu s0 s2 a7
+divu s8 a2 t5
+sltiu x0 t0 -1321
+srai s7 a2 27
+addi tp tp -1
+bne tp x0 -40
+lui t1 573618
+lui t1 138440
+bgeu s11 a5 20
+lw t6 1896(gp)
+sh s8 794(gp)
+sltiu s8 a2 -937
+or s10 t5 t3
+addi tp x0 2
+xori t5 t1 -1013
+xor s5 t0 t1
+addi tp tp -1
+bne tp x0 -12
+sll s11 s2 s4
+mul t4 t4 a3
+lbu a7 1108(gp)
+lb a4 1578(gp)
+xor s6 a5 t5
+bge t4 a4 48
+sra s1 t1 a2
+andi t2 a5 -2027
+lbu a5 -561(gp)
+mulhsu s6 t5 t0
+bne a6 s8 20
+rem t5 s6 t3
+lhu s0 380(gp)
+mul t5 a3 ra
+bgeu a0 a7 12
+divu s0 a5 s7
+addi t0 a2 -699
+addi tp x0 5
+jal t1 64
+slli s10 s1 24
+auipc a2 0
+jalr s3 a2 16
+or t0 a2 s1
+xori a6 s7 -1461
+beq s9 x0 48
+divu a5 a5 t5
+srl t6 t6 s4
+mulhu s11 t6 t5
+or s0 s9 s6
+addi tp tp -1
+bne tp x0 -48
+auipc a3 255018
+lh t1 -1584(gp)
+srl a3 s7 s2
+lh t5 -1502(gp)
+and a7 a6 t3
+addi tp x0 3
+sh a6 -1650(gp)
+sw s9 -832(gp)
+srai a1 a1 8
+beq s11 s4 60
+bne s6 s7 20
+srai x0 a1 16
+addi tp tp -1
+bne tp x0 -28
+blt s4 s6 40
+addi tp x0 3
+mulhu t1 t1 s5
+srli s7 s11 14
+add a7 s5 a0
+bne a3 ra 20
+addi tp tp -1
+bne tp x0 -20
+bgeu s11 s2 8
+slt a1 s11 a7
+addi tp x0 3
+bge s2 a7 20
+lb t6 291(gp)
+sub a0 ra t4
+div s4 s0 s11
+lbu a3 707(gp)
+lbu a3 -1074(gp)
+sltiu s3 a4 1938
+slt t0 t6 s11
+lb a4 -1564(gp)
+andi s9 a5 -1552
+srai a3 a7 13
+lh s0 -1012(gp)
+xor a6 t0 ra
+lui s0 839542
+addi tp tp -1
+bne tp x0 -60
+div a1 t6 t0
+lh s11 1044(gp)
+lhu s9 -866(gp)
+lb t2 1690(gp)
+slt s10 s6 t6
+bge a6 x0 24
+divu a2 s9 a0
+sltu s5 s8 t2
+and s10 a4 t4
+srli a2 x0 15
+lb s7 800(gp)
+addi tp x0 8
+lhu s6 1002(gp)
+lw t5 860(gp)
+addi tp tp -1
+bne tp x0 -12
+div a7 s7 s3
+srli s10 x0 18
+lh a5 1820(gp)
+div s1 s5 a3
+and t3 s3 t2
+sub a4 a5 a0
+lb a7 -1160(gp)
+sub ra s4 s3
+lbu t0 76(gp)
+sw a4 -972(gp)
+mulhu x0 s7 s5
+mulhu a6 t1 ra
+jal s1 36
+lhu x0 -1448(gp)
+slli t0 a0 25
+sh t3 1930(gp)
+andi s11 s10 -1158
+div s5 t0 s2
+and t6 s0 a5
+div s7 t5 ra
+or s2 a7 s10
+div t3 t2 t4
+blt s2 s8 12
+lui t4 555213
+lh x0 1018(gp)
+auipc t2 0
+jalr s1 t2 68
+rem t0 a3 s7
+mul a4 s2 t6
+div x0 s5 a5
+xori a5 t0 -596
+mulh s0 t3 s10
+srl s1 t4 ra
+beq a2 s11 28
+beq t6 t2 60
+sra a4 s9 a2
+bne s9 t2 4
+lbu a6 -355(gp)
+lb ra -2036(gp)
+slti ra a1 -995
+bltu a6 s7 44
+sh s5 -104(gp)
+mulhu a3 s5 s1
+srl ra t5 t1
+srai s5 s5 7
+div t5 t0 s6
+bltu t0 t4 4
+remu t5 a6 t3
+div s0 s3 a0
+lbu a4 -416(gp)
+sub s0 s6 s11
+srli a4 t4 8
+mulh a4 s5 a6
+slli t4 x0 7
+sll s6 a7 s8
+sra s0 t3 t0
+sb s9 1008(gp)
+slli t5 t6 30
+mul a3 s5 s4
+rem s2 t6 s2
+lui a7 943134
+srai t0 s0 1
+srai s10 x0 18
+ori s11 s7 -1821
+mulh t4 s9 s1
+auipc a2 52116
+lw ra 1204(gp)
+sub s0 s11 a5
+lbu a3 -1541(gp)
+and t6 s4 s0
+auipc a7 0
+jalr a4 a7 12
+auipc t6 369588
+bltu s11 ra 16
+lbu s3 724(gp)
+sltu t3 a0 s1
+srli s8 s6 1
+addi tp x0 7
+lbu t4 579(gp)
+divu t4 s1 s6
+bge s6 s7 24
+lb s7 2037(gp)
+addi tp tp -1
+bne tp x0 -20
+ori a2 s2 -1325
+ori s3 t1 421
+remu s0 a6 a5
+sll s6 s9 a6
+lw a0 -1404(gp)
+mulhsu s2 t6 t6
+and t1 s9 a2
+mul s8 t2 a1
+addi tp x0 2
+slt t6 s7 a6
+ori a2 a1 1582
+lbu s6 1627(gp)
+sltu s9 s8 s11
+sh a4 540(gp)
+and s1 s3 t6
+auipc s8 671110
+sh x0 392(gp)
+ori s5 s11 -4
+addi tp tp -1
+bne tp x0 -40
+lw s6 -76(gp)
+add s3 s9 t1
+slt a2 s2 a1
+auipc a0 85784
+srli s3 s4 29
+lui a6 164313
+sltiu t5 s11 -567
+mulh t0 s6 s5
+sb a7 -1371(gp)
+srli s9 s5 11
+beq t6 t6 16
+lh t0 -1366(gp)
+srl t2 s6 s7
+lb t6 -1588(gp)
+auipc a2 748360
+sb a5 702(gp)
+addi t3 s7 -1660
+sltu x0 a3 t0
+srli s4 s2 26
+jal s6 16
+ori s1 t4 -941
+ori ra a7 -1662
+and a2 s6 s5
+mul a0 s1 s11
+bge s10 a0 28
+slt s7 s0 s11
+mulhu t4 s0 s1
+mulh a0 s8 a7
+ori a4 a7 -975
+sltu ra t2 a1
+andi s10 a3 -930
+div t2 a6 a0
+mulhsu t5 x0 s7
+sw s10 1616(gp)
+xori s7 s6 631
+or a3 a1 a6
+srli a3 s6 31
+sw s7 -1080(gp)
+addi tp x0 4
+blt s2 t3 40
+and t2 t3 t3
+lh t0 168(gp)
+xori t5 t6 -1515
+remu t6 a7 t6
+addi tp tp -1
+bne tp x0 -24
+bltu t3 s5 12
+and a0 x0 ra
+srli t5 a0 25
+addi tp x0 7
+xor t4 t0 t2
+slti a6 s1 -103
+xori t0 s0 -503
+lb s8 80(gp)
+lbu s3 -751(gp)
+lh a4 -478(gp)
+addi s7 t3 -36
+mul a7 x0 s4
+mul a0 a0 s5
+mulhsu t3 a7 s1
+remu a0 t3 t1
+addi tp tp -1
+bne tp x0 -48
+andi s10 a7 696
+lw a4 -980(gp)
+xor s7 x0 t0
+or a6 t6 a3
+sw a6 -784(gp)
+ori s7 t0 1701
+sh ra -526(gp)
+auipc s4 0
+jalr x0 s4 68
+auipc t2 920631
+and a4 s0 s0
+rem s1 s6 a4
+div s7 a5 a1
+xor s2 a5 s4
+sh s5 1806(gp)
+lh a4 -1606(gp)
+sw s8 1176(gp)
+slt s1 a7 t0
+mulh s11 t4 s11
+srai t2 s2 23
+divu x0 a2 s8
+slt s3 t0 a1
+srai t2 a7 9
+mul x0 ra a7
+xori a2 ra -764
+auipc a3 227491
+mulhu s4 s0 a7
+sltiu s6 s4 -1715
+sll s2 s6 s2
+sh ra 1880(gp)
+lh t1 -2(gp)
+mulhsu s2 s7 a2
+srai t6 t3 10
+blt s0 s2 4
+addi tp x0 2
+mulhsu t1 t6 a0
+remu s5 t0 s11
+addi tp tp -1
+bne tp x0 -12
+sw a4 1864(gp)
+and a7 a4 t3
+addi s9 s4 -296
+srli t4 s7 26
+or t6 t0 x0
+sw t4 1540(gp)
+sub ra s7 s3
+slti a4 a6 -84
+sub a6 a1 t1
+rem x0 s11 a1
+bne s4 s3 52
+addi tp x0 2
+andi s6 a4 -1547
+mul x0 x0 a2
+mul s8 s11 a4
+lui a5 1012879
+mulhu t3 a4 a1
+addi tp tp -1
+bne tp x0 -24
+sb a3 1302(gp)
+beq s7 s11 44
+lb a7 -630(gp)
+andi a5 s4 -474
+sb a2 -380(gp)
+sb s7 -846(gp)
+lbu a7 -991(gp)
+sb t6 -348(gp)
+divu s0 s7 s5
+lw a7 -748(gp)
+rem a6 a5 t6
+lui s7 118129
+mulhu s7 t2 t0
+srli t0 a4 24
+or s10 s7 s3
+rem t4 t6 s11
+addi tp x0 7
+lui s0 93567
+and a6 s0 s6
+lh t6 1910(gp)
+mul t5 s0 ra
+lbu s2 1817(gp)
+divu x0 s7 a0
+blt s10 t0 44
+mulhsu a2 s0 t2
+and s2 s5 t1
+sh s1 -1154(gp)
+addi tp tp -1
+bne tp x0 -44
+andi s5 s4 -1525
+lhu ra -1216(gp)
+sub a6 s9 t0
+srl ra t1 s8
+srli s5 s4 11
+addi t0 a1 -249
+lh s7 1434(gp)
+lw x0 -1340(gp)
+srai t2 a6 6
+add ra s2 s7
+rem a0 a3 s6
+addi tp x0 7
+blt t2 s0 48
+slt x0 s11 t5
+lhu t6 1644(gp)
+sltu t1 a1 t6
+lhu ra -254(gp)
+and ra a7 t2
+auipc a3 528384
+lh x0 682(gp)
+sltu s8 t5 s2
+remu s5 t0 s8
+sb t5 -1758(gp)
+lhu t2 -1306(gp)
+sltiu s3 t5 -1774
+sltiu t0 t3 -1457
+sh s6 -626(gp)
+mul a7 a5 t3
+addi tp tp -1
+bne tp x0 -68
+slt s11 a3 t4
+andi s1 s5 -435
+lb a5 1392(gp)
+bne a7 s0 24
+andi s11 t5 -413
+bge s1 t1 24
+sra t5 t0 a2
+sb s11 1130(gp)
+lui t4 464203
+slli a7 s7 30
+blt t4 a3 56
+auipc s1 92520
+lh a3 258(gp)
+or s2 s2 s4
+beq s4 s8 40
+sltu ra x0 a7
+sltu a5 s3 a3
+lw a4 -560(gp)
+lhu s5 -1264(gp)
+blt s3 s9 20
+mulhsu s6 s5 t5
+and s7 s4 s10
+srai t6 t1 15
+slt s5 t5 a1
+addi tp x0 7
+ori s6 s11 -1561
+sll a7 a2 s10
+add a1 t4 s3
+divu a1 s3 s11
+lw a3 496(gp)
+andi s9 s9 -180
+lui ra 87432
+remu a3 a3 ra
+lbu t5 -109(gp)
+sw s6 812(gp)
+sra t4 ra t2
+mulhsu s1 a0 a7
+lb s4 -1027(gp)
+slli s9 t0 27
+addi tp tp -1
+bne tp x0 -60
+add a0 s1 t0
+sw s8 1296(gp)
+sb s4 1149(gp)
+sra t4 s0 a4
+andi t0 s11 -1244
+sub t5 a0 ra
+bgeu t6 t2 64
+xor ra ra s8
+sw s6 -812(gp)
+srl t2 s11 t0
+and s0 a3 s10
+slt a5 s9 s1
+bne t0 t4 56
+srli s1 s9 16
+mulh s10 s1 t0
+lw s4 -552(gp)
+srai a1 s1 1
+xor s6 s2 t4
+sltu ra s2 a1
+lh a7 -706(gp)
+ori a0 t2 -569
+slti t3 s0 778
+lh t6 -144(gp)
+or a1 s5 s6
+lw s0 -1436(gp)
+remu s2 s10 t3
+addi tp x0 4
+srli s8 s4 7
+sh s10 390(gp)
+slt t3 s3 s7
+remu t6 a5 x0
+sltu a6 s4 s11
+srai s10 a2 3
+sra a2 s10 a5
+srli t5 s1 23
+bgeu s3 t0 8
+sll a4 a6 x0
+auipc a4 0
+jalr a5 a4 56
+srl t5 a6 t6
+addi s7 s4 -1680
+add s6 ra s9
+sll s11 t5 s9
+addi tp tp -1
+bne tp x0 -68
+srli s6 t4 1
+add a5 t0 a3
+and s9 t2 s2
+sw s7 -1540(gp)
+sb s11 1050(gp)
+xori s7 t5 -711
+sltu ra ra t4
+srl t1 s8 s3
+blt a3 a3 8
+lw t0 -156(gp)
+sll a5 s7 a3
+addi x0 t2 777
+lw t6 1516(gp)
+mulhsu s5 a3 s3
+sltiu a0 t2 424
+srai a4 a6 10
+lh a7 498(gp)
+slli s10 s1 17
+div t2 t1 a2
+sb t4 -618(gp)
+addi tp x0 8
+sb t4 -875(gp)
+divu s11 s9 s6
+lbu t0 465(gp)
+andi a1 a7 -517
+sh t6 -1060(gp)
+srai s10 ra 1
+bgeu s5 s6 64
+rem s3 a5 a1
+lw s3 716(gp)
+sra a0 t3 a2
+mul a6 a2 a6
+blt s8 s3 60
+bltu t1 s5 44
+divu a5 s8 s6
+addi tp tp -1
+bne tp x0 -60
+srai t3 a4 23
+lw s5 -768(gp)
+sb s10 1260(gp)
+rem a3 s4 ra
+and t5 t5 s7
+sb ra 1472(gp)
+bgeu a4 s0 44
+mulhsu a5 s3 t4
+sra s1 a3 ra
+lbu t4 -1658(gp)
+lw s7 1336(gp)
+beq ra a2 32
+lb s6 -715(gp)
+auipc a0 993773
+slli s1 t3 1
+divu ra t1 t0
+sltiu s3 s2 -1937
+lb s11 332(gp)
+lh a5 1494(gp)
+add s2 s1 s3
+lh s5 1690(gp)
+addi tp x0 8
+xori t5 s2 550
+ori a6 s1 -419
+lhu a4 1188(gp)
+slli t4 t3 23
+sb t2 1107(gp)
+sltiu a7 a6 -94
+lh ra 1168(gp)
+add s5 s11 s3
+sw a0 -344(gp)
+lh a3 432(gp)
+ori s8 s9 -1844
+lb a5 -444(gp)
+srl a6 a6 s0
+xori a3 a1 -1394
+addi tp tp -1
+bne tp x0 -60
+slt s1 t5 s0
+sltiu s5 a3 -1533
+slli s2 s8 13
+auipc a1 0
+jalr t0 a1 60
+lhu x0 -772(gp)
+jal t2 8
+lhu a5 1032(gp)
+addi tp x0 3
+lbu t2 871(gp)
+mulh t4 s1 s9
+sb s8 -777(gp)
+xori s5 s0 110
+sltu a5 a1 s4
+slti t5 x0 -1592
+addi tp tp -1
+bne tp x0 -28
+mulh a3 a4 t4
+sub t2 s4 t0
+mulh s8 a1 t1
+lhu s4 -1006(gp)
+xor s3 a5 s8
+blt t1 t3 40
+srli t2 t3 20
+mul a5 s1 s10
+addi t5 s5 -268
+sw a2 1596(gp)
+remu t4 s5 s6
+slti s9 t5 110
+lui t3 275288
+mulhsu s9 a2 a2
+lui a4 1030457
+lh a6 -1648(gp)
+slt a2 ra s11
+lui a1 848905
+lh s6 40(gp)
+and s1 a3 a3
+bne a2 s8 20
+beq s4 s1 28
+slti x0 s11 19
+blt s11 s5 52
+rem x0 s0 s11
+lui t1 859650
+slti a4 a3 1879
+lbu t0 -1241(gp)
+slti a4 a6 -310
+sh t1 -1186(gp)
+sh s6 1390(gp)
+mul t0 s3 s2
+lhu ra -1234(gp)
+slli s0 s6 31
+slti a3 a2 -1982
+sw t1 -1492(gp)
+sw t3 -984(gp)
+sltiu a4 s4 -174
+lh s8 2020(gp)
+sb t4 -1779(gp)
+lh s9 -1738(gp)
+div x0 s5 s7
+sb a2 861(gp)
+slti s11 t5 -94
+slt s4 t4 s10
+slti s7 s5 -202
+sw s5 480(gp)
+bge s10 s3 40
+sra t2 a3 s0
+divu s7 t6 s7
+sw s1 -40(gp)
+auipc s5 709249
+slli s1 s5 29
+sra s6 s3 t6
+srai a2 s11 14
+lw s0 1408(gp)
+or s10 s6 a7
+sltu s11 s0 x0
+addi tp x0 1
+sh t1 922(gp)
+srai t1 s1 30
+ori s3 s2 -516
+srai a1 a3 21
+div a6 a0 t0
+sh s10 28(gp)
+lb a3 -829(gp)
+add s0 t4 a0
+bltu s8 s8 56
+lbu t4 38(gp)
+slt ra s11 s9
+bge x0 s3 32
+lhu x0 1324(gp)
+srai t6 a1 7
+addi tp tp -1
+bne tp x0 -60
+sw s0 -1400(gp)
+sh x0 356(gp)
+mul a3 s6 t6
+lh s1 -2002(gp)
+mulh s7 s1 s3
+slli s11 a5 29
+slti s1 t4 -529
+slt t6 s4 s5
+div s8 s4 s0
+mulh t4 t6 a7
+lb a7 -316(gp)
+auipc s5 199896
+xori a1 s10 2017
+sb s1 -1305(gp)
+srli a3 s0 2
+andi a2 t3 -781
+sra s0 s1 s4
+slt s11 a7 s4
+lbu s7 -1508(gp)
+mulh t0 t3 s7
+mul t1 t2 a0
+lh s8 -912(gp)
+addi tp x0 3
+and a1 a6 t2
+jal a4 16
+slt x0 s10 s10
+srai s10 s7 20
+sb s7 1695(gp)
+lhu a5 -1126(gp)
+sll s11 a7 s7
+lhu s2 60(gp)
+mulhsu t2 a5 s10
+remu t6 t4 a4
+auipc s11 583047
+mulhu t1 t5 x0
+lw t6 -532(gp)
+jal a1 44
+rem s10 s11 a4
+div s9 ra s2
+addi tp tp -1
+bne tp x0 -68
+lhu ra 1488(gp)
+lb t0 1015(gp)
+lw s4 -972(gp)
+srl s1 t0 a5
+srli s11 s4 0
+sh t0 -1408(gp)
+sw t2 816(gp)
+beq a3 s6 48
+div s11 t2 s9
+lb t3 1611(gp)
+mul s6 t4 t5
+remu s9 a4 a1
+remu t6 a3 s5
+add t3 t3 s1
+sb a4 242(gp)
+addi s6 a1 1508
+sub t1 s8 t2
+divu s3 t0 s11
+sll t2 s10 x0
+lui t2 896628
+andi a5 s9 1771
+mulhu t2 a5 s4
+lbu a5 -317(gp)
+sra a7 a3 s4
+srl s9 t6 t4
+sb s11 -65(gp)
+mul s4 s0 s8
+lb t4 1141(gp)
+lbu t5 -1659(gp)
+beq s6 t4 36
+bne s11 x0 60
+xori a7 a4 1575
+sw a2 1072(gp)
+auipc s7 231587
+slti s2 x0 -859
+sh s10 1060(gp)
+rem s7 t1 s5
+sw a7 380(gp)
+mulhu s11 a7 a5
+lhu s0 -278(gp)
+lhu a2 -372(gp)
+xori s8 s10 -642
+sw s11 764(gp)
+lhu t5 -1040(gp)
+add a0 s9 x0
+sub t2 s4 a1
+sra s2 s7 t3
+mulhsu s5 s6 x0
+and x0 t1 a3
+lb s4 1129(gp)
+lh t2 -1034(gp)
+remu x0 t2 t1
+mulh a1 t3 s4
+xori t6 s2 -2002
+ori a1 a4 -970
+add t1 a7 t4
+sra t0 a4 s10
+div t3 s7 s7
+sltu a3 a5 t2
+sw s1 132(gp)
+lbu s1 1948(gp)
+jal a7 40
+lui s8 31358
+or s4 s8 a3
+and a0 s11 t5
+srli a6 ra 29
+sll s4 a4 a7
+rem a7 s4 t5
+rem s11 s2 t0
+andi s0 a6 -895
+bgeu s7 a7 48
+sltiu a2 t4 -17
+lw ra -936(gp)
+lb t4 1945(gp)
+rem ra s9 s5
+sw a5 1420(gp)
+auipc a7 434041
+bne a1 a5 20
+xor s2 ra t1
+bltu t0 t3 12
+xori a0 t3 481
+lhu a4 -894(gp)
+addi tp x0 7
+slli s5 t5 28
+srli a5 t1 20
+add s0 s1 x0
+slt t2 s1 s10
+lui s3 341913
+bgeu t4 x0 20
+div a4 t0 s1
+lh s5 1356(gp)
+div a7 t3 s4
+sw a1 1008(gp)
+lbu a6 -786(gp)
+mulhsu s6 a0 s1
+slt s8 ra a0
+mulh s3 ra s7
+addi tp tp -1
+bne tp x0 -60
+sltu a6 t4 s0
+mulhsu s2 a3 s2
+addi tp x0 8
+remu s9 t2 t5
+lhu s7 56(gp)
+addi tp tp -1
+bne tp x0 -12
+sw a2 832(gp)
+lw a0 1208(gp)
+addi x0 s10 -1956
+divu s4 s6 t4
+ori s9 a2 1437
+mulhsu s10 t5 s10
+lh a3 112(gp)
+sra t2 s9 t1
+mulh s5 a7 s10
+divu s2 a4 a5
+addi tp x0 1
+andi s10 s11 -999
+bgeu a0 t2 32
+sb a1 -1760(gp)
+divu s7 s6 s0
+andi t0 s4 2016
+lui a3 264480
+remu s0 a3 s11
+addi tp tp -1
+bne tp x0 -32
+slti x0 t6 -1583
+rem s0 a2 s4
+sra t4 t3 t3
+mulh s0 t2 s1
+sub t6 t2 t4
+addi a7 t1 -886
+lb t4 820(gp)
+mulhu t6 t6 t0
+lui t4 10371
+jal s9 56
+mulhu s7 t5 a7
+lb t4 -1461(gp)
+slt s7 t4 a1
+xor a0 t2 a6
+or s7 s9 s10
+sb s9 -1961(gp)
+srai a0 ra 12
+sltu t2 a5 t2
+sltu a2 s5 a0
+lhu x0 1872(gp)
+lbu a4 -995(gp)
+sltiu t6 s2 -84
+bne x0 s0 36
+div s8 s2 t1
+sb t3 -1054(gp)
+lb s3 -606(gp)
+or t4 s7 t0
+mul t5 s0 s1
+mulh a3 a3 a7
+addi t5 s6 1676
+lb x0 -1456(gp)
+sll s11 ra s3
+sb s2 -1979(gp)
+lw s0 808(gp)
+sltu a4 t5 s3
+div s5 t3 t6
+slli s8 t3 0
+sh t0 -1032(gp)
+addi t3 a4 -277
+slti x0 s10 -381
+auipc s6 841581
+sh t4 218(gp)
+mulh a0 t0 a0
+lb a7 -872(gp)
+slti a4 s2 1311
+addi a2 s1 -461
+slli t4 a4 1
+auipc t1 0
+jalr t5 t1 44
+andi t3 t2 -1672
+sltiu s9 t2 1719
+slli s9 a0 20
+remu a5 a7 t5
+lh s9 118(gp)
+sw a6 1724(gp)
+blt s8 s9 12
+divu t1 t4 a1
+xor t0 a4 a1
+addi tp x0 1
+mulhsu a5 t2 t4
+sb s8 -1158(gp)
+sw s6 860(gp)
+lw ra -1692(gp)
+sltiu s7 s8 -1385
+sw a3 -1748(gp)
+sll s8 a2 s2
+slt t1 t2 t5
+sll a4 s4 a4
+remu a5 t3 a3
+addi tp tp -1
+bne tp x0 -44
+mulhu s5 t5 s9
+slt t1 a7 s3
+andi a0 a1 19
+lhu a6 38(gp)
+xor a0 s5 a0
+or t0 s2 ra
+sra t2 a5 s1
+divu a1 a7 s6
+mulhu a1 a6 t5
+bltu a3 t2 32
+slli a1 a5 18
+jal a0 20
+slti a7 a1 -1123
+bge t4 s1 48
+slli s11 x0 20
+rem t6 s1 s4
+rem a4 t3 s10
+lbu a2 -561(gp)
+lui ra 117396
+lh a0 838(gp)
+slli s10 a4 19
+mul s7 s10 a0
+andi s7 a3 1122
+lh s9 188(gp)
+add a2 s6 s7
+lb a0 1518(gp)
+sltiu s11 s10 -1893
+lui a6 651996
+xori t1 s10 523
+add s3 s8 t4
+lhu a7 1314(gp)
+lbu a1 1004(gp)
+lbu t1 -1544(gp)
+and a5 a7 a5
+blt a0 s7 40
+rem t6 t5 t4
+srai a0 a0 29
+beq a0 a4 40
+srli t2 t4 19
+sw a1 720(gp)
+lh s0 476(gp)
+sltiu s0 s9 -332
+div a5 s0 t6
+beq t1 t3 56
+addi ra t6 983
+mulhsu x0 s11 t4
+mulhsu s4 t0 s6
+bne t4 a0 32
+and ra t0 a6
+sltu s0 s2 s11
+rem s7 s0 s5
+auipc a6 748914
+lw s9 344(gp)
+sll a6 s8 a3
+add a1 a7 a3
+or t4 ra s7
+sub s3 s10 a5
+addi tp x0 2
+sra a2 s0 s11
+lhu s5 1594(gp)
+slti s6 a2 331
+and a6 s7 s2
+lhu t3 1166(gp)
+andi s1 t6 -1536
+jal a4 40
+lbu s9 292(gp)
+add a3 s6 s9
+or t1 t1 ra
+lui a6 160547
+lb a4 -617(gp)
+lhu s0 -848(gp)
+addi tp tp -1
+bne tp x0 -56
+sll a1 a0 s9
+addi tp x0 8
+srl t5 a3 a0
+mulhsu s7 t1 s4
+sub x0 a2 t1
+bge a2 a1 12
+addi tp tp -1
+bne tp x0 -20
+sltu t4 s10 s6
+remu t2 a7 a2
+xor t5 t1 x0
+sltu a5 s3 t5
+srl a4 s7 a2
+slt a5 s6 t4
+sub s9 a4 t4
+srl t0 t3 x0
+mulhsu s3 t5 t6
+addi tp x0 3
+mulh t4 a2 s5
+sw s11 -136(gp)
+sltiu s7 t4 1208
+mulhu a1 t3 s3
+xori ra t4 -847
+addi s10 a4 -1883
+auipc a6 716031
+bltu s8 s9 20
+bge s3 s11 16
+lhu t6 -436(gp)
+addi tp tp -1
+bne tp x0 -44
+addi tp x0 3
+add a6 t3 s2
+addi s9 a3 -1300
+addi t2 x0 -1755
+auipc a6 3164
+bgeu s1 s2 44
+mul a4 t3 t1
+lb t3 -1232(gp)
+sw a3 -72(gp)
+sltiu s1 s8 -344
+divu a4 s7 s2
+bne t1 t1 28
+divu a6 s6 s3
+addi tp tp -1
+bne tp x0 -52
+add t6 s4 s5
+mulhu s0 t6 t3
+jal s2 48
+blt s9 ra 20
+sh s2 1360(gp)
+auipc s9 0
+jalr s10 s9 40
+add s7 a6 s5
+add s10 s1 t4
+sb s7 -102(gp)
+sltiu s2 a6 -555
+sw ra -1772(gp)
+lui s6 342581
+sb a5 -171(gp)
+lbu s4 839(gp)
+sb s0 -606(gp)
+bltu a2 a1 44
+bgeu x0 t2 48
+mulh a6 x0 s2
+sltiu s1 s9 428
+sra a6 a4 s0
+xor t0 a6 t6
+srli s5 x0 28
+lui a2 944123
+bgeu s10 s10 32
+div s5 t5 a5
+andi t0 s1 -208
+or t2 t5 a3
+sh a3 1336(gp)
+auipc s2 0
+jalr s5 s2 48
+bltu t4 ra 36
+sll a1 a0 s1
+addi t4 s4 -316
+sb ra 1647(gp)
+auipc s7 0
+jalr x0 s7 40
+andi s0 t0 -20
+lh s11 -1734(gp)
+slt x0 t0 t3
+div s4 a4 s7
+addi tp x0 4
+lh t4 832(gp)
+addi tp tp -1
+bne tp x0 -8
+sub a6 t1 t1
+slt t0 s0 a3
+sb a5 -304(gp)
+sltiu t3 a1 -1739
+sra s11 a5 s6
+add s1 a2 s5
+bne s8 a0 24
+slt t1 a2 s3
+xori t0 s0 -1534
+mulhu s6 s4 s0
+sra s10 s11 a0
+sb s3 696(gp)
+addi tp x0 5
+sltu t1 a7 s6
+add s10 s7 t3
+sll ra s8 a2
+lb a1 907(gp)
+lbu ra -429(gp)
+lh x0 -1420(gp)
+lw a3 1024(gp)
+mulh s9 x0 s1
+slli s7 a0 13
+lbu t1 -577(gp)
+addi tp tp -1
+bne tp x0 -44
+or t0 t5 a5
+sb s1 -52(gp)
+ori a5 ra 1849
+xori a0 a4 -1291
+xori a1 t0 -84
+sw a0 -148(gp)
+sw t6 -956(gp)
+xor s2 s1 t3
+sll a6 s6 s5
+lbu s10 -647(gp)
+divu s7 s7 s1
+andi s2 s8 -1775
+bgeu a6 t3 40
+or s10 a7 s5
+lbu s10 -1859(gp)
+beq t2 a7 44
+lw t3 -1552(gp)
+lh s10 -1122(gp)
+xori x0 a6 880
+sw t0 -2012(gp)
+or t4 s9 a4
+andi a3 t6 -1433
+andi a5 s3 -174
+mulhu a6 s2 a2
+add a4 s4 t2
+and t0 s7 s10
+lw s2 396(gp)
+slli a6 s1 25
+srli a1 t1 1
+auipc s6 0
+jalr ra s6 40
+bltu a7 s11 32
+sw s1 204(gp)
+and s3 t0 s5
+srl a0 x0 s8
+sw t1 -1264(gp)
+and s7 s10 t4
+xor t2 s6 a3
+lh t5 -354(gp)
+addi tp x0 2
+sw s3 1736(gp)
+lh t5 1374(gp)
+remu t1 s0 s4
+divu x0 s9 s1
+xor t0 s10 s0
+sra t0 s1 s4
+mulhsu a4 t0 ra
+mulh s9 s0 a2
+addi t0 x0 -40
+addi tp tp -1
+bne tp x0 -40
+xor s2 a0 a2
+mulh t3 s0 a1
+sh t6 2018(gp)
+auipc s8 698954
+sll t1 t1 s10
+ori a1 t6 1569
+sra t3 s4 t1
+addi tp x0 2
+slli t6 s10 28
+blt ra s1 56
+lhu ra 1360(gp)
+sltu a1 s3 a2
+div s2 a6 s10
+sh s1 316(gp)
+ori t4 t5 -700
+bltu s5 t5 56
+sw t3 376(gp)
+slti s11 s10 816
+sra a0 a3 s11
+sh s2 1880(gp)
+blt s11 s0 20
+addi tp tp -1
+bne tp x0 -56
+lui s7 263217
+mulhu s1 a3 a2
+lw s7 1692(gp)
+add s2 t0 s8
+lbu a6 -1930(gp)
+addi a4 s1 -565
+lbu s6 -651(gp)
+xori s6 s2 1083
+slt x0 a0 s7
+lui s11 575887
+mul s0 s1 a4
+rem a5 s3 s4
+bne s10 t0 4
+addi tp x0 1
+and t1 s6 s1
+sll s6 a3 s6
+xor s3 t2 a3
+lb s8 1893(gp)
+mulhsu s7 x0 t6
+sltiu s5 s8 -1682
+jal s8 32
+bge s0 s8 32
+lw a0 1668(gp)
+lui t5 244684
+sw s6 -948(gp)
+addi tp tp -1
+bne tp x0 -48
+beq a4 s11 60
+mul t3 s11 s5
+addi tp x0 2
+sra t1 a2 x0
+lhu a0 -138(gp)
+xori a5 s10 -132
+ori s2 a7 1496
+lui s2 800813
+sltu t6 s2 t5
+mul a5 a0 s0
+bltu a5 s4 32
+lbu a7 231(gp)
+addi tp tp -1
+bne tp x0 -40
+div a5 x0 a0
+sltiu x0 t1 -772
+or ra s5 t6
+mulhu s9 a3 a4
+lui s8 490395
+xor s2 s6 s6
+or a1 t4 s1
+slli a4 t2 15
+addi a5 x0 382
+lhu t6 -290(gp)
+srli a5 s8 28
+sltu s3 t5 a7
+sra s8 s7 ra
+sltu s11 t0 t6
+bltu s6 s2 12
+sw t2 -1096(gp)
+sll s7 a2 s8
+sra a0 t1 s0
+lhu s8 -1878(gp)
+sra a2 a5 s5
+srai a6 a7 18
+remu t4 a0 s11
+bgeu s8 s2 16
+slti s11 t5 1413
+bge t1 ra 8
+sll s5 t3 t1
+addi tp x0 7
+sra t6 t6 s3
+or s8 s6 s1
+slli s11 s5 23
+rem s9 a1 a3
+sh x0 -1296(gp)
+lhu t0 1072(gp)
+mulhu s1 t2 t2
+sra t5 s11 s2
+sw t2 1004(gp)
+slli a0 s11 3
+addi tp tp -1
+bne tp x0 -44
+lh s3 1312(gp)
+srai s3 a3 28
+bge a2 s6 36
+lh s9 -72(gp)
+bltu s8 s4 56
+lhu t1 1464(gp)
+remu s1 a1 a2
+ori s8 s5 -607
+bgeu s2 t3 28
+sll s1 a6 t3
+sll t0 t1 s1
+lw s2 -1044(gp)
+slti a3 t0 360
+divu a7 t4 t2
+slli a0 t0 8
+or s5 a1 s7
+sw a7 -1316(gp)
+lhu s4 -1476(gp)
+addi tp x0 5
+slli t3 s11 31
+sltiu s2 s3 950
+slt t6 s2 a6
+sb t5 1212(gp)
+remu s9 s10 s2
+div t4 s6 t6
+mulhu a3 t5 a4
+srli s0 s0 0
+remu a4 s8 a3
+ori s10 s5 -234
+sh a1 806(gp)
+addi tp tp -1
+bne tp x0 -48
+sub a5 s0 s9
+sra a7 s6 a0
+mulhu t3 s5 t6
+addi t1 s5 -290
+slli t1 s7 22
+and s3 t0 s7
+sh s5 1468(gp)
+slti a0 a5 1021
+jal t6 8
+mulh s2 a0 t3
+xori x0 a0 -849
+ori s8 x0 -233
+sll ra t4 a2
+sra a1 a1 t0
+sra s8 s2 t3
+mulhsu x0 s11 t1
+srli s7 s5 23
+addi s11 s2 -254
+lh ra -1834(gp)
+lw a4 620(gp)
+and s1 a4 t1
+remu s1 t5 a0
+sw s5 580(gp)
+mulhsu s0 s6 a0
+sb s3 -1043(gp)
+sll a0 s10 t1
+divu t1 s10 t6
+mulhu s2 s2 s5
+rem t3 s9 a2
+lbu x0 -516(gp)
+lb s8 532(gp)
+xor t1 s3 s11
+xor s4 a3 s1
+lb t3 -762(gp)
+andi t5 s1 -1821
+lb s1 2022(gp)
+remu s10 t3 a5
+bne s7 a7 8
+mul s5 a6 a7
+addi tp x0 3
+lb s9 1037(gp)
+mulhsu t6 s4 s6
+srli s0 s3 24
+sra a1 s8 s9
+or a5 a3 x0
+rem a4 s3 s2
+auipc a1 932988
+sub s7 s9 s11
+sra s8 t5 a1
+lbu a1 1143(gp)
+rem t4 a6 x0
+lb s3 1290(gp)
+addi tp tp -1
+bne tp x0 -52
+lbu t2 -1967(gp)
+srai a7 a7 11
+lb s6 -1050(gp)
+remu s6 s8 s2
+lbu s8 -1501(gp)
+sltu a0 a0 s10
+or s4 s11 a3
+sub s11 s7 s10
+sltu s5 s2 s3
+mulh s0 s1 t1
+sb a0 1915(gp)
+lw x0 -32(gp)
+auipc s10 461581
+mulhu s0 s3 s3
+lh s4 -204(gp)
+lhu t5 70(gp)
+sltu ra ra a1
+and a5 a7 s3
+lb a2 1013(gp)
+slli t4 a7 12
+sw s1 332(gp)
+sw s3 324(gp)
+lhu s11 -1514(gp)
+beq a0 a1 40
+slt a6 a5 a2
+mulhsu a3 s0 s10
+xori t4 s4 -1167
+remu s7 s5 a2
+add s1 t2 a7
+srai s5 s9 13
+bne s1 s8 12
+sb a0 -1622(gp)
+sb s6 -1415(gp)
+addi tp x0 1
+jal t6 28
+lhu t6 -1334(gp)
+sll s6 s4 s5
+auipc t5 692694
+bge s7 ra 16
+mulh s7 ra t6
+xori t4 a1 -1522
+sw s1 -1204(gp)
+sra s5 s3 t3
+mulhsu s4 s5 ra
+sra a5 a3 s4
+mul ra a3 a6
+lui a1 198384
+add s0 a7 s2
+lbu a4 694(gp)
+sb t1 455(gp)
+addi tp tp -1
+bne tp x0 -68
+add s0 a2 a2
+add s2 s8 s8
+sb s5 1098(gp)
+srai a5 s8 8
+sub t0 t2 a5
+addi tp x0 1
+slt t4 t5 a2
+addi a0 s1 -1357
+srai s6 a2 21
+or x0 a5 s9
+blt x0 a3 12
+sltu a1 s3 t1
+lui a1 883493
+sltiu a4 t4 -1245
+add s7 s10 s7
+slti t2 a6 1168
+sw t4 -264(gp)
+srai t1 s11 12
+addi tp tp -1
+bne tp x0 -52
+lhu s6 -1996(gp)
+or a7 s11 t0
+srl t6 t6 a2
+srli t1 a6 2
+div a5 s10 x0
+bgeu a3 t5 24
+add s1 a7 t0
+sw s10 -600(gp)
+ori a5 s9 581
+or s6 s3 s6
+mulh t2 s5 s8
+addi tp x0 2
+bne s3 s5 4
+slt t2 a3 s2
+sltiu a5 s5 -378
+lbu s6 953(gp)
+rem x0 t3 t6
+lw s10 1364(gp)
+srai s5 a2 22
+rem t4 s3 a2
+lb s2 1491(gp)
+sh s9 134(gp)
+sll s3 s8 a3
+addi tp tp -1
+bne tp x0 -48
+xori s6 s4 -1831
+div s7 t2 a3
+xori s4 s11 -939
+andi s9 s0 723
+sltiu t2 s6 -1263
+remu s9 t3 t5
+xor s4 t1 s3
+lbu a2 255(gp)
+blt t1 a0 20
+remu t3 s1 s2
+ori t6 s9 -1718
+lh s9 1506(gp)
+sltu s11 a1 s3
+add t4 t4 a5
+xori s9 a2 -613
+bge a5 t5 64
+lui s3 952148
+addi tp x0 5
+bltu a3 ra 52
+auipc t5 585125
+addi a3 s2 -1468
+lh t2 -936(gp)
+sw x0 360(gp)
+divu t6 s0 a3
+addi tp tp -1
+bne tp x0 -28
+auipc s1 715342
+sw s11 1332(gp)
+lb a4 1268(gp)
+ori a0 s4 165
+addi a3 t5 -1795
+mulhsu a6 a3 a2
+bne s4 t0 60
+bge s2 s8 16
+blt s0 t0 60
+sll s11 s1 t2
+lh ra 84(gp)
+addi tp x0 5
+bgeu s1 s4 24
+ori t5 t0 -739
+addi tp tp -1
+bne tp x0 -12
+lhu t3 -588(gp)
+slli t4 a7 8
+lh a3 452(gp)
+divu t0 s6 s0
+bge ra s0 20
+srai s3 s6 13
+sh s9 -1946(gp)
+sra s2 x0 a6
+lh a4 648(gp)
+sltu a2 s9 t1
+lhu a3 1110(gp)
+mulh s1 t5 t0
+xor t4 s9 s1
+sra a7 ra a0
+add a5 s2 t6
+mulhsu a3 t6 s3
+divu t1 t5 t2
+lbu a3 -1152(gp)
+xori s11 s10 -680
+or t1 s7 s0
+sh s9 1644(gp)
+lh s10 1108(gp)
+lb t2 -777(gp)
+slt s5 t4 a1
+bltu s6 s8 60
+slt s3 s0 a3
+xor ra ra s2
+jal s5 36
+slti a6 a1 -504
+srai s5 s7 12
+bge a2 a4 56
+andi a2 s4 -1785
+remu s11 a3 a1
+slli a4 t1 13
+sll t0 a4 s1
+div a0 s11 t2
+lw x0 1300(gp)
+lhu a5 -1136(gp)
+ori a2 a5 1507
+ori a5 s9 -360
+mulh s11 s5 t0
+sb a0 410(gp)
+beq a7 t3 48
+sw a5 652(gp)
+slt s8 t1 t6
+mulhsu a2 s8 a3
+or a4 t1 t6
+auipc t2 495049
+add s2 a0 a2
+blt a3 a6 40
+lhu s11 -1422(gp)
+sb t5 -111(gp)
+sw a6 44(gp)
+andi s7 a4 -1787
+rem a6 x0 t4
+andi s6 t3 1065
+sb t5 -336(gp)
+lw s8 812(gp)
+div t4 ra t4
+slli s2 a7 17
+addi tp x0 7
+mulh a5 t5 s7
+lhu a2 -2018(gp)
+bltu s6 a6 64
+lw t6 -528(gp)
+divu s10 s7 t1
+lhu s7 278(gp)
+lb s9 51(gp)
+lui s9 177840
+slli a0 a6 17
+remu s9 a4 t2
+sub t2 a7 s5
+lw t1 1112(gp)
+slt s5 s3 t6
+blt s3 ra 36
+addi tp tp -1
+bne tp x0 -60
+sw s9 1224(gp)
+sb s10 -277(gp)
+srl a1 a1 s7
+sltu s2 s3 s5
+div s10 t0 s4
+sw t2 -1816(gp)
+addi tp x0 5
+mulhu s10 a7 s3
+lw a1 1356(gp)
+sra x0 s2 t5
+srai t4 s10 13
+mulhsu s5 t6 t5
+sra s1 t0 s1
+addi tp tp -1
+bne tp x0 -28
+lh s1 -1698(gp)
+div t4 ra a6
+addi tp x0 5
+slt s7 t0 ra
+slt s9 s6 a2
+sltiu s3 s2 -1583
+sh s4 -1570(gp)
+div s7 s1 t4
+srli x0 s7 9
+addi tp tp -1
+bne tp x0 -28
+lbu s7 1220(gp)
+bltu a3 x0 8
+lw s9 -352(gp)
+addi tp x0 2
+lb t1 344(gp)
+xori a0 a3 -1663
+divu x0 x0 s6
+slti a3 s8 196
+slti s7 a2 -735
+sub a3 s0 a5
+addi tp tp -1
+bne tp x0 -28
+sltu a5 a6 a3
+sb x0 -1451(gp)
+add t4 t6 s4
+add a7 t5 s4
+sb a2 -428(gp)
+sh a7 940(gp)
+sh t1 -1078(gp)
+lui t4 63585
+add s2 s11 t5
+slli s9 t1 15
+div t4 a1 ra
+ori s0 t5 1454
+lw t4 -1332(gp)
+div t1 ra x0
+lui s4 399046
+srai s2 s11 25
+sltu x0 s1 s9
+slti t4 s0 1546
+lh s6 -1814(gp)
+sh x0 -860(gp)
+sw a1 1564(gp)
+lhu s7 -424(gp)
+lw ra 1668(gp)
+rem s3 s10 a1
+auipc s10 806994
+sw s6 1736(gp)
+xori a5 a5 309
+sltu s9 x0 s8
+xori s8 a0 -143
+or s7 a3 x0
+mulhu s11 s5 s6
+auipc t0 947162
+sw a5 -1708(gp)
+srai a2 a0 20
+sw s11 -1148(gp)
+sub a1 s3 t3
+add t6 a0 s1
+div a1 ra a0
+ori a5 t4 -1146
+add a7 s7 a3
+slli s11 t2 10
+andi s3 t5 -555
+sw t4 1240(gp)
+sw a6 408(gp)
+sltiu x0 t1 -933
+sw s1 -836(gp)
+lb s1 -36(gp)
+slt a1 s8 t1
+addi a5 t6 1183
+sw a1 220(gp)
+sb s1 -1386(gp)
+sltiu s4 t0 -1482
+sll t4 a3 a4
+slli a0 a7 3
+bge s11 a5 4
+auipc s3 319687
+mulh s10 a4 t0
+lw a6 -1652(gp)
+xor t5 a6 s1
+add s8 a6 s0
+lb ra 867(gp)
+addi s5 a0 2002
+andi s4 s2 -911
+bltu a2 s1 44
+andi a5 s4 -1946
+divu s1 t3 t6
+and x0 t2 t2
+add ra s4 t3
+mulh s8 a2 t4
+slli t0 a6 7
+divu s3 a1 s9
+auipc s11 1027046
+remu a0 t6 s4
+lw s11 1584(gp)
+addi tp x0 1
+sh a7 1658(gp)
+sltiu s11 a2 -608
+sub t3 a6 s9
+addi tp tp -1
+bne tp x0 -16
+mul t0 s2 s5
+sltu s1 a1 a5
+srl s2 x0 t0
+auipc t6 419164
+sltu x0 a6 s1
+sll t6 s4 s1
+lb s5 -673(gp)
+sll s10 s1 a6
+lh t4 -1486(gp)
+remu t2 s8 s7
+sra a1 t0 s10
+lbu a4 1859(gp)
+bgeu a7 s1 20
+srl s1 s5 t0
+ori t2 t3 1646
+bne t5 ra 56
+xori a7 a2 -1429
+addi tp x0 8
+sh x0 -754(gp)
+slt s2 s3 s11
+auipc s1 470052
+divu x0 s5 t1
+addi tp tp -1
+bne tp x0 -20
+bge x0 a2 52
+sh a7 -800(gp)
+mulhsu a7 t0 t1
+sra t2 s4 a4
+slli a6 s10 17
+blt t5 s2 36
+xori s5 s8 -1786
+andi s7 a5 -1842
+lhu s3 -1682(gp)
+addi s3 t2 -1773
+lbu a4 1110(gp)
+srai s1 a7 6
+mul ra a0 a5
+blt s0 t3 36
+sb t6 430(gp)
+ori s3 t1 -1507
+sw s1 -912(gp)
+xori a0 a2 -111
+mul t2 a4 s7
+lui t4 467816
+lhu t2 -1178(gp)
+lw s9 1272(gp)
+sh s6 -1022(gp)
+add s4 s9 s5
+lbu s1 -2024(gp)
+sra ra s8 s7
+slti t4 x0 -1241
+srai t3 s8 20
+remu s6 s0 s11
+lb s10 1494(gp)
+sh s7 -1204(gp)
+srl s9 s10 a5
+sw t4 -1260(gp)
+slli t2 a1 19
+slt t2 a6 t0
+ori s2 a4 931
+lbu s4 -1618(gp)
+sb s5 1644(gp)
+mulhsu ra t3 s4
+addi a2 a6 -1663
+xor t1 t3 s0
+mulhsu a0 s6 a4
+ori a4 a3 -136
+addi s5 s8 -1187
+slli ra s8 2
+remu a2 t5 t2
+lbu a2 391(gp)
+bltu ra a3 40
+or a0 s11 s11
+lbu s5 -63(gp)
+sb s10 -1345(gp)
+mulhu s2 s5 x0
+sra t3 a2 s1
+divu a7 s1 s6
+bltu s10 s2 4
+auipc a3 429904
+blt a2 x0 36
+mul s9 a7 s4
+and t4 t1 s4
+lbu s0 -586(gp)
+mulhsu a1 t1 s11
+lb s4 1000(gp)
+lb s3 -13(gp)
+sw t3 444(gp)
+xor a6 s6 s4
+lh a7 1622(gp)
+lui s8 752441
+srli s3 s0 0
+srli s6 s11 6
+lhu s10 -1440(gp)
+mulhsu s3 s8 s6
+sltiu t4 x0 -533
+bltu x0 ra 20
+bne s7 s10 24
+sub s8 t0 a3
+lh x0 -932(gp)
+rem t1 a3 t4
+sltu a0 a4 s1
+div s3 t1 a5
+bgeu t1 s11 24
+sb t4 1068(gp)
+blt a1 a2 4
+lui s10 471933
+xori a5 s6 -1252
+mulhu a4 a7 s11
+addi tp x0 7
+sw s6 148(gp)
+bltu a6 s11 4
+srl a1 t1 s8
+ori s2 a4 -717
+sh a0 752(gp)
+andi s1 x0 -238
+blt x0 s11 20
+addi tp tp -1
+bne tp x0 -32
+sll t3 a4 s0
+mul a2 t1 t4
+sra a1 s5 s9
+sltiu s3 a2 -1228
+divu s4 s4 a7
+div t6 a6 s0
+bgeu s5 t1 48
+srl s11 t6 t1
+addi tp x0 6
+sb ra -555(gp)
+divu a0 a0 a7
+srai a4 s10 20
+slt s6 s8 t2
+lw t2 936(gp)
+addi tp tp -1
+bne tp x0 -24
+lh t3 -1236(gp)
+lhu t4 -414(gp)
+lbu s5 -995(gp)
+slti s9 s5 1339
+divu s2 a7 s8
+jal t6 40
+remu s11 a3 t2
+auipc s2 0
+jalr s9 s2 56
+slt s1 s10 a4
+addi s2 s5 -338
+xori a2 x0 -1792
+srl s1 t1 t2
+sb s3 1876(gp)
+sra s1 t4 s10
+bne a6 s7 52
+div x0 s9 s5
+sltu a1 ra s11
+lbu a7 589(gp)
+lhu s11 -818(gp)
+xor s1 s10 t4
+slt s2 s5 s10
+slli a1 t1 6
+sub t6 ra t5
+sltiu s4 t6 -134
+lhu t0 1362(gp)
+sub s11 t4 s4
+remu a5 t5 s3
+mulhsu t1 s0 s6
+divu s4 t4 t6
+lhu s5 1764(gp)
+lbu t5 1385(gp)
+andi a7 a7 -341
+slti s9 ra -470
+add a1 a7 a6
+sh s3 530(gp)
+sb s10 -1958(gp)
+lhu s8 -716(gp)
+mul x0 a5 t0
+or t5 a7 s3
+sub a2 t4 a7
+mul s7 ra a0
+sra t1 s5 a3
+srai t1 t6 12
+mul s9 s2 t1
+sra a5 a6 t2
+lhu a2 1004(gp)
+mulhsu s4 s0 a3
+sltu s11 s8 s6
+slt s4 s7 t6
+xor s4 s2 x0
+sll a3 t1 a0
+lh t6 -1428(gp)
+sh s6 754(gp)
+addi tp x0 4
+bne s3 a1 60
+sltu t3 s9 s11
+mulhsu t6 a6 x0
+lw a7 -644(gp)
+lbu ra -1458(gp)
+rem a5 ra s4
+lhu a0 498(gp)
+mulh s1 s0 a4
+div s1 a5 t2
+lhu s3 -540(gp)
+div s1 s6 s1
+addi tp tp -1
+bne tp x0 -48
+sh t6 608(gp)
+addi s5 a4 190
+addi tp x0 3
+sh a0 -1696(gp)
+add t1 s3 a5
+sw t6 1004(gp)
+slli s5 s6 5
+mulhsu a6 a5 s2
+sltiu s4 a1 -1719
+sw s9 1996(gp)
+sw s8 -1068(gp)
+srli s3 a4 27
+xor a2 t1 s5
+remu s11 t3 a3
+sw t2 -1380(gp)
+slti t3 a1 -1571
+lhu s9 -1064(gp)
+addi tp tp -1
+bne tp x0 -60
+mulhsu t0 a6 a5
+ori s1 s6 -1335
+bne s4 a2 40
+lh s6 -1496(gp)
+sb a0 -1461(gp)
+jal a1 28
+div t5 a2 t0
+lbu a1 241(gp)
+mulhu s9 s6 a0
+mul t4 t2 s4
+mul s1 s1 t1
+addi s9 a1 792
+addi tp x0 1
+lb s9 1813(gp)
+lh a2 1662(gp)
+sw s0 664(gp)
+srl a5 t1 s2
+xori a7 a7 -1712
+slt a4 t0 a6
+andi t6 x0 -913
+addi t6 ra 807
+remu s6 s10 t3
+lh s5 -1820(gp)
+srli s7 t2 0
+addi tp tp -1
+bne tp x0 -48
+bgeu a5 s5 4
+andi a3 ra 143
+lui s1 653491
+bge a6 a4 28
+sw s9 -1840(gp)
+mul a2 a5 a4
+mulhsu ra s1 s4
+srai t1 s5 11
+lb a4 -355(gp)
+lhu t0 1776(gp)
+addi tp x0 6
+sra s6 a4 a1
+lhu x0 1212(gp)
+addi s8 a1 -1136
+or a2 s7 t5
+xor s5 t3 s0
+mulhu s8 ra t5
+sb s1 401(gp)
+srl s10 a5 s7
+bne t1 s5 44
+auipc a4 0
+jalr a7 a4 56
+bgeu t0 a5 36
+addi tp tp -1
+bne tp x0 -52
+lb s5 -1669(gp)
+auipc t1 0
+jalr t0 t1 56
+blt a7 s9 4
+bgeu s10 a0 8
+xor a5 x0 a0
+slt ra a1 s10
+auipc s3 0
+jalr a3 s3 36
+sh s7 206(gp)
+sw t1 260(gp)
+sb s5 -2027(gp)
+andi t0 a2 -341
+divu t0 a0 a6
+xori s7 s2 1444
+auipc s1 793273
+slt t6 a3 s8
+xori s5 s7 -3
+blt a5 s6 16
+sltiu a0 s9 -1563
+mulhu a7 s0 s8
+mulhu t1 x0 a6
+divu a4 t3 a3
+lhu s9 -508(gp)
+div s11 s2 t2
+auipc s10 0
+jalr a5 s10 68
+sh a6 -684(gp)
+mulhu t4 a2 s11
+mulh a5 s11 t2
+lh t5 -70(gp)
+add ra t0 t5
+add a3 t1 t4
+mulh s8 a5 t0
+lbu t6 -673(gp)
+add a6 ra t5
+sh ra 2036(gp)
+sra a2 s5 s7
+mulhu a3 s9 s11
+lui a4 322727
+srli s2 s2 0
+lui t2 552939
+add ra s10 t5
+bge s0 a5 60
+bltu a4 ra 24
+lb t6 1425(gp)
+mulh s6 t0 s10
+mulhu s6 t6 a0
+sltiu t4 t6 -883
+sltiu t2 s5 -483
+mulhu a3 s11 s6
+mul x0 a6 a2
+sra s3 t4 x0
+bge s6 s3 64
+div s8 s7 x0
+lb s5 929(gp)
+lbu s0 -1453(gp)
+beq s11 t0 32
+lb t0 -1659(gp)
+addi s6 s4 1898
+slti a6 s4 -1095
+sra a5 s9 a1
+div a3 s2 t1
+rem s1 a5 t5
+bne ra t0 28
+sub s10 a3 a6
+sb a4 195(gp)
+ori a6 s5 -1231
+remu x0 s6 s7
+and s7 t5 t4
+xori t6 s6 -1382
+sltiu a3 s11 406
+auipc t1 0
+jalr s4 t1 12
+mulhu s4 t2 s11
+bltu s11 s9 4
+addi tp x0 2
+addi t2 s6 -1331
+slli t5 t6 26
+slt s10 x0 ra
+sra t2 a2 a1
+sb s5 -664(gp)
+xori t5 s0 -678
+lbu a1 516(gp)
+bne a7 s6 36
+sb a7 -1490(gp)
+lh s5 -352(gp)
+mulhsu t3 s4 s3
+lui t5 817244
+add s0 t3 s0
+sub s11 a4 s3
+addi tp tp -1
+bne tp x0 -60
+lhu t3 -1730(gp)
+addi tp x0 8
+sll t4 s6 s4
+sb t0 1855(gp)
+addi tp tp -1
+bne tp x0 -12
+xori s2 t0 -897
+lw a5 -808(gp)
+sw t1 2036(gp)
+auipc t2 876696
+rem t6 t1 a3
+rem t3 s3 s1
+lh x0 526(gp)
+xor s5 a4 a7
+bgeu t2 s10 20
+lui a7 742393
+srl t2 s5 s0
+bgeu s9 s2 32
+slt a6 s0 a0
+addi s3 t0 1849
+lh a5 202(gp)
+mul a5 s9 s9
+lw t2 1432(gp)
+srai s11 t0 0
+or s2 a3 ra
+addi tp x0 1
+divu t1 s10 t4
+mul a7 s2 a6
+ori a5 t3 -77
+lhu t5 808(gp)
+sw s10 1932(gp)
+mulhsu a0 s4 s10
+mulhsu a5 s7 s5
+remu t0 t3 s7
+sb a5 687(gp)
+add s3 s5 s11
+lbu s0 1677(gp)
+sh t5 920(gp)
+addi tp tp -1
+bne tp x0 -52
+addi tp x0 3
+sh a6 -656(gp)
+sb t6 -584(gp)
+div t1 s8 s11
+bge s9 s5 24
+xor a2 s3 t3
+sll t4 s5 a1
+addi tp tp -1
+bne tp x0 -28
+mulh s0 a4 t3
+sll a3 s2 a5
+srai t5 s0 0
+srli s3 t0 21
+sltu a1 a3 a2
+mul s7 t3 s7
+bne s11 s4 8
+lui t6 158847
+addi tp x0 1
+lw s4 -372(gp)
+srai t4 s5 11
+remu a7 ra s10
+jal s10 32
+lhu a5 -4(gp)
+divu a7 s9 a7
+addi tp tp -1
+bne tp x0 -28
+rem s9 t6 s4
+sh t6 -1984(gp)
+lhu t3 -1670(gp)
+slli t2 a6 27
+div x0 t4 s10
+srai a3 a1 18
+lw s8 1024(gp)
+mulhsu t5 x0 s3
+auipc s9 0
+jalr t1 s9 48
+srli s9 t4 11
+sw t4 1728(gp)
+lui s9 400319
+slti s7 a0 -1772
+sw a7 -1060(gp)
+bltu t3 s7 60
+lh s6 324(gp)
+sra t3 ra a3
+jal s5 28
+slti t4 t0 63
+srai t1 a2 10
+mulhu t0 t1 s7
+lb t0 1841(gp)
+lb s6 -1320(gp)
+lw t4 -1956(gp)
+bge s6 a1 28
+lb a4 203(gp)
+sh a5 -1910(gp)
+auipc s6 201185
+srl t6 s11 s10
+srl t4 t5 a3
+rem s2 s11 ra
+sw x0 -1588(gp)
+slti a3 t1 -1811
+lbu s0 -1969(gp)
+blt s4 t6 64
+lhu a7 -324(gp)
+slt s7 s10 a4
+mul a2 s2 s9
+srl a5 t5 ra
+divu t2 s9 t0
+bge s8 s1 48
+lui s4 475723
+xori s8 a5 -944
+xori s3 a2 -1172
+sra t4 s9 t0
+bltu t1 t2 28
+sb s5 -967(gp)
+div x0 a3 a5
+srl t4 s7 a0
+bltu a7 a3 4
+auipc s4 618866
+lh s4 -572(gp)
+addi tp x0 1
+add a3 a0 t1
+add s8 t3 a2
+rem s6 s7 ra
+sub a0 t1 s10
+or s10 t4 s3
+beq s7 s8 24
+sb a4 -1722(gp)
+beq t4 t3 64
+srli a1 s11 17
+auipc s3 395144
+remu t2 s10 a6
+sll t5 a3 t3
+addi tp tp -1
+bne tp x0 -52
+slti s10 s1 216
+slt s0 a5 s4
+or s9 s6 a2
+remu t3 s8 s4
+slli t0 t3 13
+sw t3 432(gp)
+sh t0 514(gp)
+srli s11 a7 18
+srl s0 s8 s8
+sh s6 1588(gp)
+lw s5 148(gp)
+sltu s2 s11 s2
+xori s11 s6 -12
+addi tp x0 1
+slli t2 a5 11
+and s9 x0 s6
+divu x0 s11 a6
+xor a1 a5 ra
+ori s5 s3 828
+ori s10 s1 1841
+addi tp tp -1
+bne tp x0 -28
+rem a3 a7 a5
+mulhu s7 s4 a1
+srl t2 t4 s1
+srl t4 a4 s6
+lbu a2 -1995(gp)
+addi a1 s1 -1212
+ori t3 a4 -780
+divu t0 s0 ra
+lbu a5 1106(gp)
+sltiu a5 ra -1043
+sw s10 -468(gp)
+sh a2 912(gp)
+sra t6 a7 t0
+xori s0 a3 -333
+xor s9 t1 a6
+auipc t1 0
+jalr a3 t1 32
+bge a3 a3 40
+lbu s3 -241(gp)
+mulhsu a1 a3 x0
+lui s11 258920
+sub a0 a3 s3
+lw s8 500(gp)
+sub s6 s5 s5
+srl s3 s11 ra
+sh a2 -1080(gp)
+xor s10 a1 a4
+mulhsu s10 x0 s11
+sh a1 1938(gp)
+mulh s3 s0 s7
+sltiu a6 s4 -1964
+addi tp x0 2
+sub s10 t3 s5
+ori s8 a5 227
+ori s8 ra -640
+jal s11 36
+sw a0 -176(gp)
+slt t3 t4 a5
+sra x0 s11 s10
+lh a6 -230(gp)
+lw s8 -1280(gp)
+and s8 a3 a5
+sh t2 -1910(gp)
+jal t5 4
+bne s6 s5 36
+addi tp tp -1
+bne tp x0 -56
+mul s7 s11 s11
+div t6 ra ra
+mul a0 s9 s0
+lb a6 -1158(gp)
+lbu s7 -338(gp)
+bge s5 s5 4
+addi tp x0 6
+or ra s1 s2
+lb a6 322(gp)
+sltiu t4 a3 -17
+lb s7 3(gp)
+lw a1 96(gp)
+remu s7 a2 s5
+sll t5 a5 x0
+mul a3 s1 s9
+rem t1 a3 s2
+sltu a3 s11 ra
+auipc s4 95611
+mul a2 t5 ra
+sw s10 468(gp)
+bltu x0 a5 64
+auipc a4 709430
+addi tp tp -1
+bne tp x0 -64
+and t1 s9 s9
+xori s11 a3 -512
+xor t0 t3 s8
+div t1 s11 x0
+ori a1 t2 -1265
+srl a3 a3 s0
+bge t6 a2 32
+mulhu a1 t6 s1
+srai t2 a1 2
+sltiu ra a7 -1291
+bltu t5 a1 40
+slt t5 s2 s0
+beq a6 ra 44
+xori s10 s1 -1711
+lh s2 -1222(gp)
+ori a1 s6 -121
+sh a6 -874(gp)
+xori s6 s8 -2002
+slti s1 a7 -514
+remu a6 t5 s4
+remu s8 s4 s3
+auipc a7 574792
+lb t0 355(gp)
+slli a2 s2 22
+srai a7 s3 0
+remu s8 a6 a7
+bge t2 t1 24
+lb s11 1598(gp)
+add t0 a2 s9
+div a2 t2 x0
+lbu a0 -871(gp)
+bltu a2 t6 8
+srli a4 a5 29
+ori s3 s9 1968
+sltiu a0 ra 1616
+bgeu s3 s8 16
+auipc t6 914223
+bltu s0 t2 64
+bne s5 s9 4
+addi tp x0 7
+lbu s7 -1810(gp)
+addi tp tp -1
+bne tp x0 -8
+srl a6 t2 t4
+srli s6 a1 31
+srli t1 t2 19
+auipc ra 0
+jalr s0 ra 60
+addi a6 t0 577
+or s10 t3 a4
+andi t5 s3 -894
+mul a1 a7 s6
+sh t1 1582(gp)
+mulhu t6 a4 s11
+slti a7 t2 -474
+mulhu t2 s8 s4
+sh s8 -1578(gp)
+jal s5 4
+srai a5 a5 31
+xori s4 t0 340
+slti a6 t1 -1490
+bltu a3 t5 4
+divu s2 t1 s9
+sw s7 1776(gp)
+sra s1 s6 t4
+mulhsu t6 t2 s10
+sll t4 s0 s5
+mulh s9 t5 s5
+rem a0 t6 a2
+lw a4 -1136(gp)
+mul s2 s2 a7
+lui s10 154264
+addi tp x0 3
+lhu s11 -1146(gp)
+addi t3 a0 557
+sw s11 -1672(gp)
+rem a2 s9 s6
+sub a1 s1 t1
+sltiu t6 x0 1816
+srai ra t5 5
+auipc s5 294078
+srl a6 s6 t3
+xori s3 a1 -1523
+sub a6 ra x0
+slt t2 a0 s6
+divu t2 a2 t6
+addi tp tp -1
+bne tp x0 -56
+addi a2 t0 1451
+srli a5 t2 18
+sw s10 720(gp)
+and s3 a2 t3
+auipc t1 260223
+srai t0 a6 15
+auipc s11 0
+jalr s8 s11 20
+lbu a7 -964(gp)
+slti s7 s5 -1498
+slt s7 s8 s9
+sra x0 a3 a5
+srl s4 t1 s7
+lbu s10 461(gp)
+lw ra 244(gp)
+remu s11 s5 t5
+div a6 a1 t4
+sh t0 1658(gp)
+xori t4 s4 -137
+rem t5 a2 s6
+addi tp x0 5
+sltu a4 t0 a3
+addi tp tp -1
+bne tp x0 -8
+or t1 s11 t0
+andi t4 a6 -1148
+addi tp x0 8
+sltu s2 a0 a1
+addi tp tp -1
+bne tp x0 -8
+addi tp x0 6
+sh s5 1118(gp)
+divu a3 x0 t6
+addi tp tp -1
+bne tp x0 -12
+sw s7 -1808(gp)
+slt t6 t4 s6
+srli s6 t3 27
+and s8 s1 t0
+addi tp x0 7
+lhu t0 1366(gp)
+addi a2 t6 -1010
+lbu a2 1635(gp)
+addi tp tp -1
+bne tp x0 -16
+bne s5 t0 60
+lw s4 232(gp)
+lui s7 1027635
+lb s1 -434(gp)
+lw a5 -1540(gp)
+ori t4 a7 1219
+andi s7 s5 -488
+srli s1 s6 11
+rem s1 x0 a7
+mulhu s11 t5 s3
+lh s6 -100(gp)
+sub a4 s0 s11
+divu a2 s7 s4
+lbu s3 -762(gp)
+mulhsu a6 t3 t3
+lb s3 966(gp)
+slti s3 t3 -1205
+xori s9 s4 -820
+lw a3 -908(gp)
+lui a4 832460
+remu t6 s0 a7
+xor s3 s9 a2
+lb s7 -1628(gp)
+sra s1 s0 a5
+srli s7 t4 3
+ori t0 a4 328
+mulhsu s0 a5 a3
+sh a5 -102(gp)
+sltu ra s11 a3
+lui s1 735326
+sub s6 a7 s9
+divu s5 a3 t5
+andi t2 s5 -369
+lh s11 722(gp)
+rem t2 s7 s11
+or s11 a3 s9
+divu ra s3 s0
+srai s2 t0 21
+bgeu a3 t5 4
+lb a0 -1362(gp)
+xori s1 s10 1194
+lb s1 -1620(gp)
+add x0 t2 s5
+divu s10 a3 a4
+or x0 t4 a4
+or s7 a7 s2
+bltu s1 a2 44
+addi s11 a4 -2034
+sh s1 -1410(gp)
+lb t1 -1151(gp)
+slti t3 s4 526
+addi t5 s8 959
+andi a6 s11 1472
+lui s10 977263
+jal t2 8
+add x0 a3 t1
+add t2 t6 s7
+addi tp x0 3
+auipc t6 0
+jalr s7 t6 60
+xori t0 a5 -1000
+lb t6 1597(gp)
+sh t0 934(gp)
+addi tp tp -1
+bne tp x0 -24
+lw t4 -140(gp)
+sltu s6 t6 a3
+mul s4 t4 t1
+lui s10 660069
+remu s0 a4 s3
+jal s8 44
+auipc t0 531832
+beq t3 a3 36
+and s4 a7 a5
+lh t1 372(gp)
+sb a1 740(gp)
+andi s2 t2 -256
+ori s5 a4 1713
+lhu s6 -1930(gp)
+sh t6 -1000(gp)
+div s1 s11 s6
+addi tp x0 3
+slli a6 a2 18
+and s7 s6 a6
+bne a1 x0 20
+remu a6 s7 t0
+srl a3 s7 s6
+xori t6 s11 1774
+lh s10 -1188(gp)
+sra s8 a6 s3
+sltu ra a6 x0
+addi tp tp -1
+bne tp x0 -40
+slli s2 s4 14
+rem t0 s4 a0
+slli s6 s1 11
+beq t1 t0 8
+andi a6 t3 351
+srli s4 s11 31
+slt s1 t4 s7
+lb s6 1927(gp)
+lw a5 -732(gp)
+sltu t6 s4 s3
+lui t3 431309
+slt a0 ra t1
+sltiu x0 s10 -1045
+and ra a3 s8
+sw ra -1132(gp)
+blt x0 a0 12
+and t0 t1 s8
+sb s5 -998(gp)
+addi tp x0 4
+bne t4 s1 44
+sh a7 -1072(gp)
+xori a4 s3 903
+auipc t4 0
+jalr s6 t4 8
+ori a5 s1 1794
+lw t1 -576(gp)
+bne s10 s0 20
+srl t2 x0 s4
+addi tp tp -1
+bne tp x0 -40
+div a0 s5 a3
+addi tp x0 8
+sb s11 1412(gp)
+addi tp tp -1
+bne tp x0 -8
+auipc s10 525002
+divu x0 s9 s0
+mulhu x0 s5 s1
+div s9 ra a0
+lbu a7 25(gp)
+lhu s2 -1258(gp)
+lb a2 417(gp)
+mulh a4 a0 s10
+addi tp x0 7
+slti a2 s10 -1442
+divu t1 t5 s7
+lhu s5 812(gp)
+sll s1 t4 t6
+bltu t2 t2 4
+addi tp tp -1
+bne tp x0 -24
+or s4 s6 a0
+lb t1 -381(gp)
+lhu s2 1638(gp)
+sb s7 429(gp)
+ori t1 a2 -181
+addi tp x0 2
+sltiu x0 x0 -364
+sltu t3 t6 s5
+blt s10 t0 60
+mulhu s4 a6 s6
+mul s2 t6 s1
+addi tp tp -1
+bne tp x0 -24
+slt s1 t0 ra
+andi t6 t1 147
+sltu t6 s5 t3
+addi tp x0 4
+auipc a6 0
+jalr t6 a6 68
+addi tp tp -1
+bne tp x0 -12
+srai s11 a1 0
+sw a3 396(gp)
+bne s11 a0 52
+bne s1 t6 52
+xor s0 s4 s5
+srl s5 s10 a2
+bne a1 ra 56
+blt s1 s7 60
+lb t1 -1660(gp)
+sh a2 1678(gp)
+lui ra 73125
+add s7 t6 a3
+mul s8 a6 ra
+lb t5 879(gp)
+lhu s2 26(gp)
+sltiu s9 ra -503
+srli a4 s2 28
+slti t3 t2 -911
+slti s1 a5 701
+blt a0 s1 12
+auipc s5 0
+jalr a4 s5 8
+addi tp x0 1
+sub s10 s2 t0
+xori a6 t3 837
+lhu a2 -490(gp)
+rem s9 a0 s3
+bgeu s9 a2 8
+sltu s3 a3 s5
+addi tp tp -1
+bne tp x0 -28
+srl s10 t2 t5
+sra s9 a4 x0
+sw s9 1460(gp)
+addi a0 a7 -1922
+lui t5 765675
+mulh t1 s9 a0
+lh x0 1172(gp)
+lbu t6 1189(gp)
+blt s9 ra 20
+sb a0 -983(gp)
+xor a1 s10 t5
+sb s7 -1542(gp)
+mulh s10 s6 s6
+srai s7 a4 15
+lhu s5 -52(gp)
+sub t2 s6 a4
+xor a0 s8 t3
+lw a3 732(gp)
+rem a6 t1 t4
+mulhu a3 a7 t1
+sh s10 1404(gp)
+addi t2 a1 -1083
+lhu s3 164(gp)
+srl a2 a5 s3
+sh s10 -546(gp)
+sltu a4 ra a4
+beq a0 s2 40
+remu s9 a4 t2
+lh s11 1438(gp)
+lbu a4 -1763(gp)
+sra s9 a1 a7
+sra s2 t3 a4
+mulh s2 s6 s10
+add a1 x0 a4
+sw t0 -888(gp)
+or s5 s2 a5
+srai t2 t4 29
+lui t2 936370
+sw s0 -956(gp)
+sltu x0 a7 t4
+lbu t4 -608(gp)
+slt s9 t5 ra
+ori t5 s10 -613
+sw t3 40(gp)
+sh s3 -1440(gp)
+bltu a1 t0 20
+sll a1 a7 s11
+bgeu s2 a1 12
+sw t4 -1532(gp)
+ori x0 t6 -755
+addi tp x0 7
+xori s7 t5 -282
+slt t3 s3 a7
+andi a6 t0 -1121
+sra s0 ra s3
+lw s4 1476(gp)
+bgeu s10 t1 20
+xori t3 s2 -1432
+andi s11 a5 1748
+xori t5 a0 -1417
+bltu t2 a7 36
+sltu a4 a6 a4
+addi tp tp -1
+bne tp x0 -48
+sra s0 s11 a1
+sw t2 1788(gp)
+slti x0 s1 -1694
+lhu s0 1222(gp)
+jal a5 36
+and a3 t4 t2
+rem s5 a6 t0
+sh s0 482(gp)
+and a7 a4 s0
+beq t2 a1 16
+addi s7 s3 -926
+andi s8 a1 -1729
+bgeu t2 t3 4
+addi tp x0 8
+lui s1 229978
+divu t4 s1 s2
+ori s6 a0 -1189
+beq t0 s3 24
+xori s5 a3 -787
+remu s11 a6 t4
+div a1 s1 s11
+or a4 ra s8
+bltu s10 s11 8
+sltu a5 s11 a3
+ori s8 s3 -711
+addi s7 s10 -911
+lh a6 712(gp)
+lui t6 360651
+lhu s5 1510(gp)
+addi tp tp -1
+bne tp x0 -64
+mulhsu a2 t1 s5
+slli s7 s3 6
+lhu t0 -784(gp)
+auipc a0 0
+jalr s3 a0 8
+auipc a6 0
+jalr s11 a6 20
+or a5 s8 s6
+lh a1 -1702(gp)
+sll s6 ra s3
+div s9 t3 t2
+slli s2 a6 5
+addi tp x0 8
+add s3 t4 s5
+addi tp tp -1
+bne tp x0 -8
+sb ra 716(gp)
+sw s2 -1216(gp)
+addi tp x0 5
+or s5 t5 a3
+srai s2 s4 5
+slti a0 t6 -270
+xor t5 s11 ra
+bltu a5 a2 48
+lh t2 -1140(gp)
+and s6 s6 a2
+slti ra t4 -1695
+srl s4 s7 s6
+mulh t2 x0 s3
+sw s1 640(gp)
+sltu a0 s1 a7
+or a7 a0 a2
+addi tp tp -1
+bne tp x0 -56
+sh s10 1602(gp)
+sltiu s4 t3 1084
+lhu a4 1976(gp)
+add a6 s7 s1
+bne s2 s10 40
+slti s11 s0 -248
+and s10 t0 s3
+sub t5 a0 a3
+mulh t5 a5 a0
+srl s1 ra s11
+sltu s10 a3 t4
+sltu s0 a5 a5
+lui s8 264970
+auipc a0 870702
+lhu x0 446(gp)
+blt s6 s7 40
+sb t6 2019(gp)
+sltu s1 a3 t1
+sb s5 -1098(gp)
+mulhsu s8 ra ra
+addi t3 s4 -1045
+lhu t4 1892(gp)
+mulhsu t3 s2 t5
+slt s5 t2 t2
+sw s3 1380(gp)
+slli s3 a3 0
+lui t2 469943
+auipc t5 835691
+bne s8 t5 24
+sll s4 s11 t4
+jal s9 12
+lh t6 -4(gp)
+lb t2 214(gp)
+bgeu x0 ra 32
+sh t3 -1344(gp)
+lw s10 -824(gp)
+srl s4 s10 s7
+sra a7 s6 s9
+or s0 a3 t2
+jal a4 4
+addi t2 t4 1880
+lui t6 545680
+lh a6 -140(gp)
+xori a3 a6 444
+sb s1 1315(gp)
+lb t0 754(gp)
+sub a3 t3 s1
+divu s4 s6 s3
+sra a2 t5 a7
+addi t4 a1 1901
+sw t2 1832(gp)
+sltiu s11 a3 173
+srli t1 a0 26
+or a4 t6 a5
+addi tp x0 3
+slli a2 t2 29
+lh s3 570(gp)
+slti a3 a7 -562
+sltu a6 a6 t2
+sra s11 a2 ra
+lw s4 1096(gp)
+srai a5 a5 27
+addi tp tp -1
+bne tp x0 -32
+xor t0 a0 t5
+add s4 s10 a1
+lh t3 -118(gp)
+mulh a3 s0 s11
+auipc t1 675463
+slt x0 a0 s6
+sra s10 s7 t2
+remu s2 s11 a5
+srli x0 s11 3
+lb t0 1445(gp)
+sltu t3 s0 s4
+sll ra s2 t1
+rem s8 s9 s8
+beq s9 t2 4
+addi tp x0 4
+sw a6 320(gp)
+mulhsu a3 s11 s10
+and a7 s6 a0
+sh s3 1616(gp)
+sra x0 t0 a2
+andi s3 s6 -1083
+bge t5 a5 60
+slt ra s5 s10
+lui s1 111418
+xori t4 s0 -151
+slti a2 a3 -965
+auipc t4 101543
+addi tp tp -1
+bne tp x0 -52
+slli s2 a7 11
+slti s11 t3 -129
+div a2 s8 ra
+xor s9 a0 a2
+slt a7 t1 a1
+beq a1 x0 12
+divu s1 s2 s5
+srli s3 t3 14
+addi s1 x0 -1584
+lw t4 1288(gp)
+addi t1 s5 703
+sra s10 t5 s7
+andi s10 s11 -287
+lh t1 -890(gp)
+mul s6 s11 s3
+sltu s6 a4 a6
+slt s10 a4 s8
+bne s6 s5 64
+lbu t2 -932(gp)
+bgeu a4 t2 8
+beq s0 t5 60
+addi tp x0 5
+sub t5 x0 s6
+slti t1 x0 595
+bltu t1 s9 44
+ori s7 x0 -134
+lbu t5 717(gp)
+and s7 t5 a3
+auipc t0 905198
+addi tp tp -1
+bne tp x0 -32
+lhu s2 -512(gp)
+div a2 s1 t0
+sub a7 a0 s4
+lw a2 1676(gp)
+addi tp x0 6
+blt s6 s0 16
+mulh a4 s6 a6
+lui s11 18418
+lbu s3 -1252(gp)
+sb a0 476(gp)
+addi s5 x0 -992
+mulh s11 a2 ra
+div x0 s2 a2
+ori s6 t1 -868
+lh t3 1208(gp)
+addi tp tp -1
+bne tp x0 -44
+sltu a0 s9 s0
+slli s9 t0 10
+srai t5 t1 20
+bge s7 t6 44
+lb s5 -141(gp)
+ori t2 ra 1286
+srai s10 s8 7
+bne t4 a1 44
+sltu t4 t5 t2
+xori x0 t3 1266
+xor a7 s4 x0
+rem s1 a3 t2
+sw t0 1140(gp)
+sltiu s7 t2 -63
+sh a1 -348(gp)
+sra x0 t6 x0
+sltiu a7 s0 -489
+bltu a1 a0 32
+sltiu t5 s8 742
+lb s0 -106(gp)
+rem x0 ra s7
+slti s9 a7 50
+remu x0 s7 a3
+bne s2 t4 36
+srli s10 a5 1
+sb a1 1463(gp)
+srl t5 s9 s0
+slli s8 t5 10
+jal s7 52
+or t3 t3 x0
+lh s2 1942(gp)
+slti t0 s4 -1440
+lui s0 318556
+xori s9 s6 -597
+mulhsu s8 s1 a6
+div a7 s6 s6
+lh t1 690(gp)
+andi x0 ra 1149
+lui a1 239667
+remu t4 s2 s2
+lui a1 974188
+lui t4 975941
+xor s7 s3 a5
+xor s4 a1 s9
+rem s7 s10 x0
+sra s4 t0 s8
+bne s2 s9 4
+addi tp x0 5
+divu s8 s5 a2
+slt t5 a1 t3
+bne s1 s5 16
+xor s2 s11 s1
+srl s10 s9 s1
+lh x0 1104(gp)
+bltu s6 s8 24
+mulhu t5 t6 s8
+sltu s9 s7 t2
+blt t4 s7 48
+blt a2 t3 20
+beq a1 s5 56
+sra t1 ra x0
+sra t2 a1 x0
+addi t2 s9 -445
+lw s7 1944(gp)
+addi tp tp -1
+bne tp x0 -68
+lb a0 428(gp)
+lhu t3 -424(gp)
+sw x0 1524(gp)
+lui t3 615566
+beq a2 s10 56
+blt a6 a5 56
+mulhu t3 x0 a1
+mulhu s3 s3 a3
+sw s0 -1396(gp)
+lhu a2 1348(gp)
+jal a5 24
+sw a2 1936(gp)
+lb s4 425(gp)
+slt a1 t0 t2
+sltiu t2 s9 553
+srli ra s7 14
+sra a5 t5 a7
+addi t0 a5 -1844
+andi a4 a7 1709
+lhu a7 -1692(gp)
+sw s10 120(gp)
+slli s8 a1 19
+add a1 t0 a0
+slt s9 t0 s6
+bge a4 s0 24
+lb t0 1749(gp)
+and s0 s9 s11
+sltu s1 s0 a7
+bltu t2 s9 8
+slli t1 a7 22
+addi tp x0 4
+bge s7 t3 32
+slti t5 s6 -610
+sltu s11 s4 s10
+divu a0 ra a7
+bltu a1 s9 40
+sb ra -164(gp)
+lbu s9 1981(gp)
+jal t2 64
+srl s5 s4 a6
+or s7 s10 ra
+lh a0 242(gp)
+addi tp tp -1
+bne tp x0 -48
+xor t3 s11 s1
+beq s3 t1 4
+blt t0 ra 36
+sll s9 s0 t0
+xori s9 t1 -1058
+auipc s11 486024
+xori s7 s8 1560
+lui a7 358213
+or s0 a1 s0
+xor s1 s5 a2
+sub t4 s1 a3
+slli t0 s0 29
+addi tp x0 4
+lh s3 -892(gp)
+lw a3 1112(gp)
+xor t1 a6 s8
+remu s5 t2 s2
+ori a7 s0 -1659
+mulhsu ra a0 t5
+sw s2 1888(gp)
+lui a7 537948
+ori s2 s1 -842
+lui t1 406474
+divu s9 a5 s4
+sh s4 1580(gp)
+lbu t0 -366(gp)
+sb s0 -872(gp)
+mulhsu s6 s3 a6
+sub s1 s1 s0
+addi tp tp -1
+bne tp x0 -68
+xor t0 a3 s6
+sra a6 t1 a4
+bgeu a5 s1 64
+slti s4 a7 -1101
+auipc a0 303541
+mulh t1 s5 s11
+sltu s0 s5 a5
+auipc a6 986888
+add t6 s2 s3
+addi tp x0 2
+xori s4 s4 -1369
+sltu t6 a5 s4
+sb x0 777(gp)
+sb s6 -543(gp)
+addi tp tp -1
+bne tp x0 -20
+div s6 t3 a0
+srl t2 a0 t0
+auipc a3 181563
+and s2 t6 s6
+lbu s4 650(gp)
+sb s1 254(gp)
+lhu s9 854(gp)
+sltu t2 x0 t6
+beq t0 s9 36
+lhu s4 -806(gp)
+rem s2 s5 s0
+lb s2 1442(gp)
+srli s2 s10 1
+andi s7 t0 -1611
+blt t3 a2 32
+sltiu a3 a0 -1042
+sb a5 -1946(gp)
+sb a5 -913(gp)
+sh t3 770(gp)
+lhu s0 -174(gp)
+mul a6 t2 s7
+xor t3 s4 s9
+or s4 a5 a0
+lhu a5 1868(gp)
+sub a5 a3 t2
+sltiu a5 s4 -446
+slt t3 t3 a1
+sw s0 748(gp)
+lb a2 -761(gp)
+sh t3 -92(gp)
+lbu t2 1769(gp)
+divu a2 a5 a5
+divu s7 a3 a4
+sw t0 -1332(gp)
+sra s1 s7 s11
+bge a0 a5 52
+sll a4 t1 s11
+divu s7 t3 a0
+sb a7 969(gp)
+auipc t6 505134
+sh t2 528(gp)
+sw a3 -648(gp)
+slli s0 s10 2
+lbu s6 -1944(gp)
+lhu s3 1742(gp)
+divu a4 a0 a7
+ori t6 s4 -1997
+jal t0 4
+addi tp x0 4
+sltu a3 s1 s11
+sra a4 s6 s6
+lhu s7 660(gp)
+lw a0 -292(gp)
+divu t4 s8 t6
+slti s8 s1 -981
+add a4 t5 x0
+sw a7 1636(gp)
+slti s7 s3 1254
+sb s3 -924(gp)
+mulhsu a2 s11 ra
+andi s6 s11 -370
+and t6 ra t0
+addi tp tp -1
+bne tp x0 -56
+mulhu s1 t0 t0
+remu s5 t6 s1
+slti a5 t3 -1437
+remu a7 s1 a4
+add x0 s8 t6
+div t5 t4 s11
+blt a1 a7 48
+lbu s6 -1091(gp)
+blt s3 a5 40
+sb s0 -263(gp)
+slti a1 s9 1262
+and ra s0 t5
+srai s6 a4 10
+lh s11 -448(gp)
+srli a4 a6 16
+div a6 s4 s9
+srli s5 s9 0
+sb t0 -321(gp)
+addi tp x0 4
+srl t1 t4 s0
+lb a6 1793(gp)
+lb x0 -1283(gp)
+sb a7 310(gp)
+lhu a7 -104(gp)
+sll a5 s0 t3
+rem s6 a0 t4
+rem t2 t5 s3
+lui a2 863529
+slt a1 t2 a0
+remu a4 s4 a6
+slti a6 s4 -1702
+bgeu a2 s3 48
+addi tp tp -1
+bne tp x0 -56
+lh s10 -624(gp)
+sra t1 x0 x0
+ori s2 t0 -1183
+sw t0 1284(gp)
+sltu s2 a1 a0
+jal a3 48
+mulh s7 ra s2
+bge a6 a0 44
+sltu a6 t1 s11
+and t0 s4 a4
+addi a5 s10 -406
+sh s10 -1302(gp)
+mul s11 t2 a0
+sra s5 s3 t1
+sh s8 828(gp)
+bltu t1 a7 60
+lui a7 303978
+sltiu s7 s4 292
+lw t0 412(gp)
+add s11 s6 s11
+sra s10 s5 a6
+remu s2 t1 t4
+sub a6 s1 a2
+mulhsu a0 s2 a4
+auipc a1 372480
+sltiu s11 s3 1939
+lh s5 -584(gp)
+sub s6 a3 ra
+lbu s0 -1191(gp)
+or a7 a5 a5
+ori s1 t4 -1008
+xori a3 t1 1966
+auipc a2 717960
+mulh x0 x0 a7
+or a1 s7 s11
+mulh t2 t5 s3
+bltu s5 t1 12
+sw s10 -928(gp)
+sw s7 -848(gp)
+ori s11 ra -80
+addi tp x0 1
+lbu t0 508(gp)
+jal s7 40
+lh s0 1654(gp)
+sltiu s1 s4 -2046
+sra s6 a1 t5
+auipc a3 259214
+lw a6 1556(gp)
+remu s2 s5 t2
+lbu s6 1719(gp)
+div s10 x0 s8
+remu t0 t2 t6
+lb s0 -1025(gp)
+addi tp tp -1
+bne tp x0 -52
+or s2 t4 t5
+blt s0 t3 52
+slli t0 s8 24
+auipc s2 692139
+sb a4 -472(gp)
+lui a7 676525
+lbu s5 1932(gp)
+remu t0 s0 ra
+sub s2 s6 a7
+mulh t6 a3 s4
+lbu a1 286(gp)
+lh s8 528(gp)
+sub a6 s3 s10
+sub s6 a1 a2
+xor a0 s2 s11
+andi a1 t2 -1718
+mulh s9 s11 a2
+sltu a3 t6 t6
+bne s1 t3 32
+lh s0 -1476(gp)
+lh t3 -1054(gp)
+sb a3 -571(gp)
+bne s3 s9 28
+rem a4 a6 t0
+sw s2 -1796(gp)
+sw s10 416(gp)
+remu t4 a0 ra
+sw s10 1696(gp)
+beq a0 a5 52
+sra a7 a7 s8
+xor s0 t5 a1
+addi tp x0 1
+srli a0 s5 9
+lw s10 580(gp)
+addi tp tp -1
+bne tp x0 -12
+bgeu s4 t2 24
+sh x0 1938(gp)
+mulhsu t2 s7 a6
+slt s4 a6 s1
+auipc a4 211187
+slt s10 a2 t4
+srai x0 a5 26
+mul s3 s1 a7
+beq a3 a6 48
+sw s7 -568(gp)
+srli s6 t4 17
+auipc a0 0
+jalr t2 a0 32
+lh t6 -1192(gp)
+sh s9 -146(gp)
+add s8 s10 s2
+lbu s6 1403(gp)
+srl a3 s10 s11
+lb t3 1084(gp)
+sltu t5 t0 s9
+addi tp x0 2
+xor a6 s7 s6
+sh t2 198(gp)
+sltu t0 a3 a7
+sb t2 -973(gp)
+mulh s4 t6 s9
+sra s4 t0 s7
+sh s2 1908(gp)
+srl s10 s4 a1
+sub t1 s9 s3
+lw s10 -1048(gp)
+sltiu a0 a4 -705
+sra s10 s1 s7
+divu s4 s5 t1
+slt t6 a5 s9
+addi tp tp -1
+bne tp x0 -60
+andi s10 s4 -1271
+jal t6 20
+addi s11 s7 -162
+auipc s8 230153
+remu ra a5 a4
+sw s9 -608(gp)
+remu a3 s4 x0
+slt t2 a1 a0
+slli x0 t5 16
+xori s2 a7 -1953
+bge s10 a5 24
+remu s6 s0 a6
+addi a7 a2 -1097
+sh t5 974(gp)
+sh t0 -1628(gp)
+sw s10 -304(gp)
+sh a4 -1704(gp)
+slti s4 t5 -1263
+blt t5 x0 32
+sra t3 s7 x0
+lb a0 -1280(gp)
+div s0 s3 a3
+sw a1 1208(gp)
+srli s2 s9 19
+bgeu t5 s11 36
+lui t3 719995
+auipc a6 0
+jalr s8 a6 16
+slli a1 t5 23
+xor a3 s0 a7
+lb a4 -174(gp)
+sub t2 a7 s5
+sh a3 -1914(gp)
+addi tp x0 3
+div a5 t2 a3
+mul s9 t0 t0
+sub a4 s6 s6
+add a0 s8 a6
+mul s8 s7 s5
+auipc s9 0
+jalr t4 s9 36
+xori s0 t5 -265
+remu a4 a0 s3
+remu t1 t4 ra
+addi tp tp -1
+bne tp x0 -44
+andi a1 a7 1288
+beq s5 t2 24
+or a2 t5 a2
+mulhu s4 a3 t2
+sltu a2 a1 a7
+mulhsu s1 s10 t6
+lb t3 -2042(gp)
+xor s8 a1 ra
+sh a7 -572(gp)
+srli s0 s2 24
+bne s8 a1 64
+sltiu t4 s8 1501
+rem s8 s0 a3
+jal a6 56
+div s8 t3 ra
+xori ra s1 -1797
+jal a2 12
+add t1 s5 a6
+rem t4 s0 a7
+auipc s8 0
+jalr a6 s8 44
+srai t2 s5 4
+and s11 s10 t0
+and t4 s5 a4
+lw x0 96(gp)
+lhu t4 -470(gp)
+lb a0 -834(gp)
+sub a1 s10 ra
+mul s1 s1 s1
+divu t0 s10 a6
+sb t6 -1669(gp)
+andi s6 a3 -197
+slli t5 t5 8
+ori a3 t0 -1866
+andi t1 s1 -513
+sltiu s2 a5 -74
+sub a2 s10 t2
+add t6 t2 s0
+sb s4 -1570(gp)
+xor a1 s8 t0
+sltiu t6 t0 -207
+addi tp x0 3
+sw a1 268(gp)
+lb s8 1221(gp)
+lbu s2 -1079(gp)
+add s7 s9 s2
+divu s9 s11 a0
+sh s7 -1818(gp)
+lh t2 -164(gp)
+sh s1 -1154(gp)
+rem s11 s0 s7
+addi tp tp -1
+bne tp x0 -40
+lb a2 60(gp)
+sub a4 x0 s6
+rem t2 a0 a0
+sltu a1 s6 a2
+sb x0 -2019(gp)
+lw t0 -744(gp)
+mulhu s7 a1 s0
+jal s11 48
+mulhu t4 a4 a4
+addi s7 s2 -609
+sltu s0 ra s8
+or a2 ra a1
+remu a2 a3 s2
+sh t5 870(gp)
+slt s11 t4 t3
+xori a6 t3 266
+lb s4 -904(gp)
+sra s0 x0 t6
+mulhsu ra t0 t5
+addi a7 a2 -1868
+lb a3 -1906(gp)
+lb t3 1687(gp)
+auipc t0 0
+jalr t4 t0 20
+mulh t3 t0 s6
+mul t6 a2 s0
+srai s7 t4 0
+addi tp x0 2
+lh s0 482(gp)
+sll t6 t4 t6
+sub s5 s2 ra
+mulhu s0 a2 s6
+andi t0 ra 1417
+srli x0 x0 2
+remu a1 s2 a2
+sh s2 -1252(gp)
+beq s6 s9 16
+mulh s7 t1 s3
+lh a0 -732(gp)
+sw s6 -1344(gp)
+sw t6 -180(gp)
+srli s2 t5 18
+xor s8 a6 s7
+xor s7 a7 a1
+addi tp tp -1
+bne tp x0 -68
+mulhsu t0 s3 t6
+mulhsu s6 s9 s11
+lbu a7 215(gp)
+sb a2 -1059(gp)
+addi tp x0 3
+srai s1 s6 13
+xor s10 t4 a3
+mulhsu a5 a6 t5
+slli s2 a2 6
+auipc s6 0
+jalr x0 s6 64
+lw t6 24(gp)
+addi s3 a7 1977
+add a3 a2 s11
+xor s4 t3 s5
+sltu s1 s0 s5
+rem s8 s4 a2
+sh s1 146(gp)
+auipc x0 1009332
+sb t3 -1459(gp)
+addi tp tp -1
+bne tp x0 -64
+bltu x0 a0 32
+mulh s2 a0 t6
+mulhsu s11 s1 s7
+bltu s7 s4 60
+lbu s10 1522(gp)
+sra t0 t5 s8
+auipc s3 476315
+div t6 s0 a6
+bltu s2 t5 40
+lw a0 -84(gp)
+slt a7 s0 x0
+addi s5 s0 -1868
+addi a3 t1 -1487
+mulh ra a7 a6
+lbu t5 -1810(gp)
+auipc t2 161683
+div t4 a5 x0
+andi ra t5 -1499
+sh x0 -1916(gp)
+or a1 t1 s9
+bltu ra s5 64
+xori s4 s0 -542
+lw t3 -324(gp)
+bgeu s0 t1 20
+srai a5 s0 29
+bgeu s2 t0 56
+sltu t2 s3 a5
+sub s6 x0 s7
+rem t2 t5 a7
+auipc a7 880351
+div t3 s7 s3
+remu t6 s0 s7
+bltu ra t2 44
+sub t1 a2 s11
+remu s5 t1 s3
+sub s8 t6 a3
+slti s0 s4 -1604
+blt s2 t4 12
+sra x0 s10 t2
+lhu s10 1526(gp)
+slli s2 s11 9
+sb s2 -2016(gp)
+bge s6 t4 4
+addi tp x0 1
+mulhsu t4 s7 a4
+srai s10 t0 8
+jal a4 64
+addi t4 s5 -1910
+add a3 a0 s5
+lh s2 -1072(gp)
+lhu t5 656(gp)
+addi tp tp -1
+bne tp x0 -32
+add s1 a4 s0
+lbu s10 1380(gp)
+slli s7 s1 8
+srli s11 s4 4
+blt a7 a6 36
+mulhsu s3 t4 s7
+slti t6 s0 -541
+xor t3 s5 s2
+slt s3 t0 t2
+sh t1 -346(gp)
+ori s11 s3 -1478
+sub s3 s3 s5
+slt t1 a3 a5
+divu t1 s6 a7
+slli t4 a7 12
+mulh t3 ra a6
+sub a0 s7 s4
+lbu a5 1704(gp)
+bge a0 ra 40
+auipc a1 679555
+sll t1 a0 a5
+lb s8 1453(gp)
+sltiu s0 a2 -401
+bge t6 a0 48
+lw a6 -1152(gp)
+lb t6 -1309(gp)
+bltu x0 s10 8
+sra ra s2 a4
+mul ra a3 t1
+lh a1 -1434(gp)
+mulhu s3 s10 t5
+mulhsu a3 a3 t1
+lb s1 -1222(gp)
+auipc s8 0
+jalr s10 s8 44
+divu a2 t4 s0
+lh x0 -466(gp)
+lh a3 -1242(gp)
+andi a2 t0 301
+add s1 t1 s1
+mulhu t6 a5 t6
+mulhsu s10 s3 ra
+lhu t1 -1272(gp)
+add t3 a4 t1
+remu s5 s7 t1
+mul s9 s1 s0
+lhu t6 -1760(gp)
+divu a5 t2 s7
+lui s4 986370
+rem t4 t2 a7
+xor a4 ra s6
+blt a3 t1 24
+lw s11 -268(gp)
+sll s4 s3 ra
+remu a2 a2 s1
+add t0 a2 a1
+lui t1 362559
+sltiu s3 t6 -922
+xori s7 s11 118
+sh a1 -1924(gp)
+auipc s11 95225
+srl s1 a4 s9
+srli t4 x0 0
+and a1 x0 a4
+xor s8 t0 t1
+bltu s1 t2 60
+mulh t0 s8 t0
+lb s11 -1617(gp)
+bge t6 a1 16
+addi t1 a4 -1094
+mulhsu s3 s5 x0
+sra a5 s1 a5
+srai x0 a7 15
+slt a3 a3 s10
+and s1 a2 s8
+mulhu t4 s4 a3
+sub a1 t2 s2
+sh a0 178(gp)
+sh ra 806(gp)
+slti x0 a7 -1205
+lbu a3 -1785(gp)
+auipc t1 0
+jalr s3 t1 44
+lhu t4 1394(gp)
+and s0 s7 a1
+sw t6 -1392(gp)
+bltu s8 s2 24
+lw s6 424(gp)
+lui s6 650415
+srl t3 a1 a3
+sub x0 s7 a2
+slli t3 s7 4
+addi tp x0 3
+blt t2 s7 16
+sb s8 1405(gp)
+slli s4 a2 28
+slti s7 a2 -73
+addi tp tp -1
+bne tp x0 -20
+sub t4 t6 s1
+add a3 s0 t3
+or s7 ra s7
+lhu s10 36(gp)
+ori s6 a6 455
+sw s5 572(gp)
+bge t3 s9 20
+srai a7 a7 16
+sltu a0 s6 t5
+bltu t4 s9 28
+bltu s4 s7 4
+addi tp x0 6
+sltiu t6 s3 -1501
+mulh a5 t0 ra
+addi tp tp -1
+bne tp x0 -12
+srl s2 s3 t6
+srai s10 a0 12
+xori s9 a4 123
+lhu t5 -542(gp)
+slli s1 t2 28
+beq s11 s9 60
+sub s0 s11 t4
+sw s3 -1440(gp)
+lb ra 54(gp)
+xori a0 t2 -1736
+or a7 s1 a1
+sb t0 231(gp)
+addi tp x0 4
+add a1 s5 t3
+lh a3 -610(gp)
+xor ra s2 a1
+sll t5 s9 s0
+addi t1 a5 -1267
+addi tp tp -1
+bne tp x0 -24
+sw s11 408(gp)
+and a5 s7 a4
+xor s3 a7 s8
+jal t3 28
+lb a2 695(gp)
+lui s10 937191
+divu s4 s4 t1
+srl s10 s0 t1
+bltu a0 x0 60
+lh s11 1984(gp)
+addi tp x0 3
+mulhsu t5 s9 s1
+mulhu t6 t6 a4
+mulh a5 s2 s8
+sw t5 1616(gp)
+addi tp tp -1
+bne tp x0 -20
+sltu t0 a3 a0
+lbu a1 1873(gp)
+bge a0 a6 16
+srli a6 s5 5
+lb s9 103(gp)
+mul t6 a4 t4
+addi tp x0 1
+slti t4 a7 -1613
+lw s5 -1192(gp)
+lbu a6 -1300(gp)
+lb t4 -359(gp)
+sub s3 t2 a0
+addi tp tp -1
+bne tp x0 -24
+lbu s5 -33(gp)
+mulhu s1 s1 t4
+sw s9 1896(gp)
+addi tp x0 1
+addi s9 a7 1667
+srl s3 t1 a6
+lhu s7 776(gp)
+beq a5 t0 8
+lhu s7 -1362(gp)
+sub t4 s10 a3
+sh a3 1002(gp)
+jal a2 40
+rem s0 s9 ra
+mulhu s3 t2 t0
+lw s7 -940(gp)
+addi tp tp -1
+bne tp x0 -48
+div t4 t0 s7
+slti ra s3 1988
+lhu a5 2002(gp)
+div s7 t5 s4
+blt a4 t5 52
+lbu t0 -1313(gp)
+lh a1 96(gp)
+sb a6 1025(gp)
+slt t5 s7 a5
+bgeu a5 a4 16
+blt t6 a5 44
+sb s8 884(gp)
+sh t4 -1066(gp)
+xor t0 a0 s1
+lhu t5 -426(gp)
+bltu s0 s5 4
+slli s11 s2 4
+xori a0 s1 -447
+sltu t6 s7 t3
+and s11 t3 ra
+sb t1 -190(gp)
+addi tp x0 2
+bgeu t4 a7 64
+mulh ra t6 s2
+beq x0 a6 52
+or ra s8 s3
+xor x0 a4 x0
+mul a0 s11 s0
+lhu s5 -850(gp)
+lw a1 -2020(gp)
+mulh a5 t4 t6
+slt s3 a2 s4
+sltu a2 a7 t1
+and a7 s5 a5
+addi tp tp -1
+bne tp x0 -52
+sb s5 1377(gp)
+sb t4 -1794(gp)
+lbu t4 -1375(gp)
+sw s0 -1496(gp)
+mulhu a0 s1 s3
+addi tp x0 6
+sb s9 -743(gp)
+sub a5 t2 s5
+sh s8 -1186(gp)
+sh t5 -620(gp)
+auipc t1 0
+jalr t2 t1 48
+ori s11 t5 -1515
+andi s5 s6 229
+slli t3 t5 27
+ori s3 t3 -1688
+mul s8 s0 s7
+srl s1 s5 s5
+sltiu t1 t5 -307
+addi tp tp -1
+bne tp x0 -56
+slli s1 a2 28
+xor s0 s6 t4
+mul a4 t0 a1
+lw t1 1012(gp)
+rem t5 ra t6
+bge t4 s9 16
+mulhu t2 a5 s9
+mul t6 a0 a5
+sra t5 a0 t5
+addi tp x0 2
+auipc a2 146725
+sltiu a6 t2 -1170
+bltu s2 t6 4
+bge s10 a4 48
+divu a4 t4 a4
+remu t6 s10 s1
+mul a1 a1 a3
+lw t4 820(gp)
+ori s2 s3 -269
+bgeu a1 t2 8
+lui t0 818244
+lui t0 447271
+bltu s11 s4 52
+lw a6 1488(gp)
+sh ra -1586(gp)
+or a5 s4 t5
+addi tp tp -1
+bne tp x0 -68
+mul t5 a0 x0
+srl a4 s9 s9
+lbu t0 1015(gp)
+slt a3 s2 s9
+lhu s2 454(gp)
+and t3 a6 s6
+sll s9 t1 t6
+addi tp x0 5
+remu x0 s3 s4
+sh a5 966(gp)
+add t4 s3 a0
+srl t6 t0 t5
+addi tp tp -1
+bne tp x0 -20
+bgeu s11 s7 40
+lh t3 -1428(gp)
+sra s1 t2 a4
+lh t5 274(gp)
+bgeu a7 t5 28
+lh a4 -770(gp)
+mulhu s2 t5 a1
+sw ra -1156(gp)
+srli s8 s7 4
+slti s4 ra -1070
+mulh x0 s5 s9
+rem a1 s3 s6
+lb s4 1988(gp)
+jal t6 52
+sw a6 260(gp)
+bne a4 t4 64
+sh s5 1590(gp)
+lbu t4 578(gp)
+lb s4 707(gp)
+sra t2 s9 s4
+slli s0 t6 12
+mulhu a3 s0 t0
+add t4 a5 ra
+lhu s7 1902(gp)
+sh s10 1080(gp)
+and a4 a3 a5
+lui a1 26653
+mul s3 t0 s0
+remu s4 s4 s5
+xor s1 s10 a4
+jal s11 16
+lbu s6 -277(gp)
+xori a4 a6 1740
+or s4 a5 s8
+sll s2 a0 x0
+add a7 s4 a1
+lb s8 61(gp)
+srl t2 s5 t0
+mulhu t6 a6 s3
+lhu t0 240(gp)
+srl s9 s6 s10
+jal s0 20
+sub s8 s10 s0
+lhu t3 1000(gp)
+lh t4 -1010(gp)
+bltu ra x0 60
+sb t1 -1395(gp)
+lh s9 -1880(gp)
+lbu s3 -1277(gp)
+addi tp x0 3
+rem s9 t3 a7
+remu s7 a6 s6
+slt a5 t2 a7
+addi tp tp -1
+bne tp x0 -16
+lui s8 586963
+lbu a0 -1122(gp)
+sll s3 t1 s9
+slt a1 s6 a0
+ori ra s4 -808
+bltu a4 a5 48
+sub s6 s3 s6
+lhu s6 -862(gp)
+or a7 a1 t5
+lui s7 176004
+slti s5 s10 -651
+xor x0 t0 s4
+auipc s6 940090
+bgeu s11 t6 56
+sll a4 s7 a7
+sh s4 -1362(gp)
+sh s7 1608(gp)
+sw s4 424(gp)
+lw a5 1020(gp)
+lh a3 70(gp)
+divu t1 a4 a5
+sb a7 1206(gp)
+lb a2 452(gp)
+remu s7 a6 t4
+lhu s11 2008(gp)
+mul a5 t1 a6
+divu t2 s9 t2
+xor s1 a6 a6
+addi a0 t4 1626
+sw a5 -700(gp)
+sb a6 -623(gp)
+srai a2 x0 0
+sltu a3 t0 x0
+lhu t2 94(gp)
+addi tp x0 5
+lh a0 922(gp)
+slt s5 a0 s5
+lbu t6 -2031(gp)
+slt s6 x0 t6
+rem t1 a4 s1
+addi tp tp -1
+bne tp x0 -24
+beq t1 a0 36
+rem s4 s3 s5
+rem t3 s7 s8
+sh ra 1726(gp)
+auipc t1 164237
+auipc s7 591112
+slti s4 a6 1318
+srli t6 a3 9
+lhu s10 -1462(gp)
+divu a4 t1 s9
+addi s10 t3 -1255
+lw s10 884(gp)
+bne a4 t6 40
+addi tp x0 5
+auipc t3 519385
+addi tp tp -1
+bne tp x0 -8
+xori x0 s10 -1705
+sb a4 1019(gp)
+slt a2 s0 a7
+beq s8 a5 20
+lbu a4 -360(gp)
+xor a3 a4 t3
+rem s4 s3 s5
+slti s3 t2 1715
+addi tp x0 5
+lh s5 1344(gp)
+auipc a6 150589
+lhu ra 1032(gp)
+srl a0 s9 a4
+and ra a1 s10
+sb a3 1414(gp)
+srli s10 s1 26
+beq a0 s9 12
+add t2 t3 a1
+srai s10 a4 17
+mulhsu t0 s0 s10
+lh s3 830(gp)
+slli s1 ra 4
+lbu ra -65(gp)
+addi tp tp -1
+bne tp x0 -60
+sh s4 -444(gp)
+add a2 a1 s3
+ori a6 s5 -708
+sll t1 x0 a5
+auipc s3 0
+jalr s8 s3 52
+mulh t4 ra a3
+addi a1 s8 190
+srli a0 a3 21
+addi s1 a5 -1507
+lw s6 1424(gp)
+add t2 s5 s9
+bgeu a0 a1 48
+sw s9 1940(gp)
+andi t0 a2 1718
+slt s7 s0 s10
+sll s7 x0 s3
+sh x0 -1112(gp)
+sll t5 t1 t3
+slti a6 t5 -3
+sw s8 -424(gp)
+slti a0 s7 933
+bge t0 t2 44
+lb a3 -59(gp)
+bgeu s2 s1 32
+bne a3 a3 20
+slt a3 t2 s8
+sw a2 -780(gp)
+mulhsu t5 s3 s0
+sw a6 568(gp)
+lh s9 4(gp)
+sub s4 a2 t1
+slli a2 a0 1
+sltu s2 t3 s3
+mulhsu t6 t6 a2
+sub s8 a1 s7
+rem s5 t5 t5
+srl a0 s1 s6
+lb s0 130(gp)
+mulh s2 s9 t4
+lui a3 108334
+srli s3 s11 18
+lhu s10 1170(gp)
+lh a0 1462(gp)
+sb s0 248(gp)
+lhu s7 -86(gp)
+mul t5 s6 t3
+mulh s6 s5 ra
+lb s2 1725(gp)
+sh t0 -1570(gp)
+lh ra 134(gp)
+lh t2 -658(gp)
+bgeu a5 t4 24
+add t0 a2 a3
+lhu s3 -266(gp)
+slti s0 a0 1134
+slti s2 t5 -934
+lhu s3 696(gp)
+addi tp x0 6
+lh t4 -628(gp)
+mulh t0 s4 t3
+sra t6 a6 a3
+divu a5 a6 a1
+and s0 s3 a1
+addi tp tp -1
+bne tp x0 -24
+lh s0 1840(gp)
+ori s10 t5 -294
+lb s10 1826(gp)
+ori a7 s0 -984
+lb s8 1312(gp)
+lbu a1 140(gp)
+slt t5 s10 x0
+slt s4 t6 a6
+sltu a6 a7 a7
+bge s5 t2 40
+slti s7 t1 -1841
+andi a5 s11 758
+sub s9 s2 t5
+srl t4 t6 a5
+srai s8 a2 4
+rem a3 a5 s8
+lw a5 36(gp)
+sltiu s3 a2 -1804
+xor s0 t2 a2
+addi tp x0 8
+sll a4 t3 t3
+and s0 a2 s8
+sw ra 596(gp)
+sra s7 t1 s2
+lui t2 821774
+sw s3 -1680(gp)
+addi tp tp -1
+bne tp x0 -28
+div s3 a1 a1
+bltu s1 a3 4
+sw t5 1548(gp)
+sw a5 -1820(gp)
+mul s10 a2 s8
+srli x0 a1 7
+mulh s4 s1 s5
+lb a2 551(gp)
+bgeu s7 t2 36
+mul t2 t6 t1
+addi tp x0 8
+srl a7 x0 a5
+addi tp tp -1
+bne tp x0 -8
+jal t3 56
+mul s8 s8 a6
+auipc s10 963905
+addi tp x0 8
+auipc a6 347076
+sb s4 1331(gp)
+sb s0 -1169(gp)
+sra a2 t1 s4
+addi tp tp -1
+bne tp x0 -20
+sll ra s0 x0
+lbu t0 -569(gp)
+auipc s11 0
+jalr a6 s11 12
+bge t4 s3 60
+sw s0 -432(gp)
+sltu t0 s7 a3
+lw t6 -1656(gp)
+bgeu a6 s8 64
+divu s2 s6 s0
+sra a4 a0 s6
+andi s0 s6 -1426
+sh t5 -686(gp)
+blt a4 s9 20
+sw x0 -1380(gp)
+div x0 s8 t2
+sll a1 a5 s8
+sw x0 20(gp)
+and t5 ra t1
+and ra s5 s8
+srl s3 a7 s4
+lh t2 -438(gp)
+lb s2 811(gp)
+sltu t5 t0 a1
+bge s1 t0 36
+beq a0 s2 28
+sll t6 a3 s11
+or a0 a3 s1
+sll t6 s0 a3
+sb t3 418(gp)
+lh x0 332(gp)
+xori t3 a3 1544
+sb a7 1543(gp)
+addi tp x0 7
+bne a6 t3 56
+srl t3 s6 s11
+jal s6 12
+remu s1 s0 a0
+lbu t1 -268(gp)
+srli s8 s5 9
+addi a5 a3 -411
+sh x0 54(gp)
+srli a0 t1 6
+lb a4 1865(gp)
+mul a7 a4 t6
+sw s11 -156(gp)
+bge a5 t2 16
+and s8 s9 s6
+addi tp tp -1
+bne tp x0 -60
+addi tp x0 4
+auipc s0 830625
+div s11 s1 s4
+sb a0 655(gp)
+sltu t2 s0 s9
+slti a2 s8 -1093
+mulhsu s8 s10 s6
+or s6 s3 t4
+sb a5 -948(gp)
+lb s10 -1054(gp)
+auipc s5 611155
+sb t3 -1034(gp)
+srai x0 t3 3
+and t3 a7 s4
+lbu s6 1192(gp)
+andi s10 s0 -1009
+addi tp tp -1
+bne tp x0 -64
+andi a5 a0 -43
+lw s9 384(gp)
+lbu s9 1107(gp)
+slti t6 s1 1485
+lbu s11 -1580(gp)
+addi tp x0 1
+sra s10 s1 t6
+and t0 a2 a4
+lw t4 -1808(gp)
+bge s7 s10 32
+addi tp tp -1
+bne tp x0 -20
+mulhsu x0 s5 s1
+srai a6 s0 21
+srl t4 a0 s11
+lhu a3 -432(gp)
+slti t3 ra -1875
+blt a1 a1 40
+blt s0 s5 36
+ori s6 s6 -1961
+divu t5 s9 s1
+slti a5 t2 46
+auipc a6 0
+jalr s9 a6 20
+lbu t5 -322(gp)
+addi s7 t5 -1535
+mulhsu t5 t1 s1
+addi tp x0 1
+bgeu a3 x0 52
+auipc ra 433579
+addi tp tp -1
+bne tp x0 -12
+rem s11 a2 t2
+bltu t6 a5 36
+andi a2 s5 644
+div a3 s2 a0
+lw t3 184(gp)
+bgeu t5 t2 60
+xor s1 a2 a2
+div t4 a6 t1
+sltiu t5 t2 -249
+sh a3 1726(gp)
+or s2 t4 a4
+lh a7 -182(gp)
+add t6 s4 a1
+divu s5 s3 a6
+sltu s10 t3 s8
+div s1 t3 s0
+srai a6 s5 23
+addi s4 s9 -622
+lhu t6 1046(gp)
+xor a0 s0 s7
+blt a2 a5 32
+mulhsu s4 t4 s5
+lb a1 -733(gp)
+lhu a5 -1408(gp)
+sh t5 -872(gp)
+beq a5 s7 24
+mulhsu a3 a6 s3
+xori a6 ra -1472
+auipc s9 86418
+remu a3 s7 t1
+slti s8 s1 -1043
+sb t2 -1200(gp)
+sltu a6 a5 s1
+add ra a4 t5
+lhu a4 638(gp)
+beq t6 a3 20
+sltiu t5 a5 1774
+lh a4 -1958(gp)
+lh a2 -1920(gp)
+lh s11 620(gp)
+bgeu s9 s0 4
+sltiu a5 s9 -183
+sub x0 a6 a2
+addi tp x0 2
+ori a1 a4 -1594
+mulhu s8 a3 s0
+ori a1 a6 -1836
+mulh t3 a6 x0
+sltu t2 a1 t1
+xori s11 t0 1505
+and s0 t5 t0
+andi s10 a5 345
+mulhsu t4 s3 s8
+rem s0 t1 s10
+sw a0 704(gp)
+xori s2 a7 1805
+and t4 s11 s7
+addi tp tp -1
+bne tp x0 -56
+sh a4 1626(gp)
+add a6 s2 t6
+mul s11 ra a1
+mulh a3 t5 s2
+and t5 s6 t5
+andi a6 t6 1884
+addi tp x0 5
+divu s0 a2 s6
+lh t0 1696(gp)
+remu s0 t0 s8
+mul s10 a4 a7
+auipc s7 269426
+addi tp tp -1
+bne tp x0 -24
+addi tp x0 6
+mulhsu a0 s6 s9
+sltu s6 s9 a0
+addi tp tp -1
+bne tp x0 -12
+sll a5 a5 t0
+blt t1 a5 60
+auipc s8 157637
+lhu t6 -592(gp)
+sh s6 1916(gp)
+lhu s1 -992(gp)
+or s4 s2 a7
+srli a0 s2 28
+sll s6 s11 a3
+jal a6 20
+slti a7 a1 -842
+lw a4 1124(gp)
+addi t1 a6 -1746
+sub s1 ra t1
+slt t6 a1 ra
+ori t1 s0 -1618
+lh s11 1232(gp)
+ori a2 a1 1764
+sw s6 -1400(gp)
+remu x0 a7 s2
+lhu a3 -1072(gp)
+mulh a7 s0 a6
+sb t0 -23(gp)
+rem a4 a5 t4
+blt s6 s1 28
+andi ra s7 -1124
+addi s0 a0 -233
+lb s0 -1080(gp)
+lb a1 -124(gp)
+or a1 s4 t5
+srai s8 t0 16
+bgeu t2 s0 20
+mulhsu s6 s0 t3
+lbu s11 -417(gp)
+srli s6 s5 27
+lh a5 1310(gp)
+srl s8 s0 s7
+sh s7 96(gp)
+sw s2 -4(gp)
+srli a5 s0 29
+lhu t5 1822(gp)
+add t5 s2 a2
+ori t1 s6 -815
+mul s7 x0 s6
+bne s2 t2 32
+auipc a5 635950
+divu a1 s5 a4
+divu s11 a6 t0
+bne s5 s0 16
+jal a6 12
+divu a0 s1 t0
+sw s0 672(gp)
+addi tp x0 5
+bgeu a6 a2 16
+sltiu s11 s5 775
+addi t4 t5 933
+srli a3 a6 1
+sltu a3 s0 t0
+xor t5 s7 a0
+lbu a5 -113(gp)
+sw t6 -976(gp)
+addi tp tp -1
+bne tp x0 -36
+rem s6 s10 t0
+blt s5 s2 24
+beq s4 t3 12
+blt ra t4 40
+xori t0 a1 -680
+andi s4 a4 -1010
+lb t6 -388(gp)
+bge s1 s9 24
+add a0 a6 x0
+div a5 s6 t1
+sub s5 t3 a4
+sltu t0 t4 a2
+sw t2 1936(gp)
+addi tp x0 6
+or x0 a5 x0
+mulhsu s5 x0 x0
+lui s10 354154
+addi tp tp -1
+bne tp x0 -16
+mulh t0 s11 s11
+lw t2 -516(gp)
+addi tp x0 5
+bne s5 t3 20
+auipc a2 776942
+addi tp tp -1
+bne tp x0 -12
+blt t0 x0 16
+sh t5 1148(gp)
+lb ra 1294(gp)
+sb t3 -622(gp)
+addi tp x0 1
+andi t3 a2 -977
+srai t2 a7 13
+sh a2 358(gp)
+addi tp tp -1
+bne tp x0 -16
+sw s4 728(gp)
+sll t1 a6 x0
+sb s4 1267(gp)
+lb s3 -1331(gp)
+lbu t1 630(gp)
+sh s6 -1314(gp)
+sh t3 -1260(gp)
+auipc a2 887939
+lbu a6 1381(gp)
+lb t5 -1148(gp)
+xor s10 s11 s4
+sll s2 t4 a3
+xor t4 t5 ra
+lb a6 -1393(gp)
+sb s6 249(gp)
+lui s1 1029381
+blt a0 s0 64
+slt a1 a3 x0
+srl t2 s10 s5
+bne t1 s6 32
+sw a7 1796(gp)
+lw a0 252(gp)
+lw t4 488(gp)
+sh t5 46(gp)
+auipc s2 0
+jalr s9 s2 36
+lhu a1 1218(gp)
+lhu a2 130(gp)
+lbu s1 -1967(gp)
+lb s0 -935(gp)
+sll a5 s11 t1
+xor s5 a7 ra
+lbu s8 776(gp)
+lui t1 471655
+lhu a4 602(gp)
+sh s8 962(gp)
+sltiu t0 s10 -481
+sh t3 1540(gp)
+slti t2 t0 943
+mulhu a1 a0 a1
+rem s2 s6 t1
+beq a5 a3 4
+addi tp x0 7
+addi s2 a7 632
+andi t3 a3 -218
+xori s7 s0 1968
+andi t1 a0 -699
+lw t3 1148(gp)
+ori a1 t1 930
+andi s8 a5 1617
+auipc s8 881244
+auipc a2 0
+jalr x0 a2 32
+add a7 s9 a6
+sltiu a4 s3 -858
+addi tp tp -1
+bne tp x0 -52
+andi s11 a0 1802
+auipc s0 240857
+srl t3 a4 a5
+mulhu s0 t0 s4
+bge s11 a0 24
+bltu s1 a6 40
+and a1 t2 s2
+auipc a7 171738
+slt s10 s3 t3
+sb s1 -530(gp)
+sw t1 -1316(gp)
+andi t4 s5 -745
+sh s9 1626(gp)
+addi a3 t2 806
+and s10 a7 s7
+lhu a3 178(gp)
+slt s3 s3 s5
+srl a6 a7 s3
+blt x0 t6 20
+lui s2 103008
+lhu s10 28(gp)
+sb a2 1371(gp)
+lui t2 1036294
+rem x0 t5 s11
+srl x0 s0 s4
+slti s1 t3 -1206
+slti s11 ra -1944
+mulhu a5 s2 ra
+bge a0 a7 64
+lhu s7 1892(gp)
+and s3 a2 a4
+sb s7 1181(gp)
+add s4 s11 s1
+lhu a3 1902(gp)
+div t2 x0 s10
+sltiu a7 a7 1736
+auipc s10 233641
+sh a5 -44(gp)
+srl t6 s5 ra
+auipc s11 403100
+and s11 s7 a6
+and a7 s9 t0
+lhu t3 -714(gp)
+mulh s0 s11 ra
+add ra ra s9
+divu t5 a1 a1
+sw a3 532(gp)
+lhu t3 -1590(gp)
+bge t3 a2 40
+auipc t0 617922
+srl a6 s0 a6
+srli s10 s7 20
+andi t0 s1 260
+sb t1 -1674(gp)
+add a4 t2 a4
+srai t3 s0 8
+lhu a7 -1942(gp)
+sw a1 1296(gp)
+mul s3 a7 s6
+sh t0 -1060(gp)
+sub t3 s1 a0
+addi tp x0 6
+srli t6 s3 17
+lbu s9 1957(gp)
+lh a1 782(gp)
+lw s1 -780(gp)
+sb t0 920(gp)
+slti a7 x0 -629
+sltiu t6 s4 -1900
+lw ra -1112(gp)
+mulh a7 a5 a3
+jal t6 4
+mulh a0 a6 s10
+srli s5 a0 19
+mul s4 a3 s5
+addi tp tp -1
+bne tp x0 -56
+xor s3 t4 t0
+srl a2 s0 s3
+mulh ra s7 s9
+lui s2 171976
+addi a2 s0 -808
+srl s9 t0 a0
+sb s4 -993(gp)
+addi ra a2 -893
+or s10 a1 a1
+sra a0 t3 s3
+srl s6 s9 a4
+sltiu t2 s10 -1909
+lbu s11 1342(gp)
+lb t3 270(gp)
+lhu s10 906(gp)
+slli t2 s3 12
+lh a0 1232(gp)
+lhu t0 1000(gp)
+rem ra s4 s6
+remu a4 s10 t1
+lb a2 947(gp)
+sltiu a1 t1 -1171
+mulhsu s7 s3 t2
+addi tp x0 7
+bgeu s3 ra 40
+lb ra -1956(gp)
+and t6 t5 t4
+lw a2 -1316(gp)
+blt a6 t1 52
+beq s10 a6 24
+and t3 t5 s2
+auipc t5 142044
+lh s4 128(gp)
+andi s0 s5 -719
+lw s5 -1764(gp)
+sh s3 334(gp)
+mulhu t3 t5 s11
+addi tp tp -1
+bne tp x0 -56
+auipc t1 224237
+srli x0 t4 15
+addi a7 t0 -1278
+sll t2 a1 t2
+lw a3 -320(gp)
+mulh s8 t1 a2
+mulhu a7 s10 s4
+mulhu s8 t0 s0
+beq a3 t6 8
+sll a2 a5 t4
+addi tp x0 6
+slli s7 a2 28
+divu t6 ra a4
+slli s7 s1 3
+auipc s8 784076
+sb t5 -552(gp)
+ori t0 t0 -1437
+lui s9 200248
+auipc s9 668966
+srai s0 t2 28
+addi tp tp -1
+bne tp x0 -40
+lhu t1 1672(gp)
+add s2 a7 t4
+bne s1 t0 40
+slti a2 a3 -473
+sltu a5 t2 a0
+lw a5 1336(gp)
+lhu a2 -684(gp)
+sltu t0 a5 s11
+lbu ra -333(gp)
+div a6 a0 t1
+srli s7 a6 4
+sll s6 s10 t6
+div ra t0 s11
+xor s9 t0 t4
+bge s1 t3 44
+xori a0 a2 -1610
+or a7 t6 s9
+lbu s6 1240(gp)
+rem t4 t6 s7
+mulhsu s7 a1 a7
+slti t1 s9 -271
+slt ra s11 t6
+addi s0 s0 1533
+divu s11 ra a2
+divu s6 s8 s1
+mulhu s6 a0 t5
+sltiu t4 a4 -784
+srl s3 a5 a5
+mul t6 a5 t6
+sb a6 -1244(gp)
+lw s3 1800(gp)
+ori a3 a4 -669
+addi tp x0 5
+lui t2 393997
+xor s1 s3 t3
+srai t5 s3 23
+lw s6 916(gp)
+rem s1 x0 ra
+sltiu t2 ra 1403
+sh s1 -1330(gp)
+addi tp tp -1
+bne tp x0 -32
+sh x0 -1158(gp)
+rem s4 a4 s3
+sw s3 -516(gp)
+sltu t2 t4 a3
+addi tp x0 5
+sub s4 s6 x0
+xori s9 s1 -1857
+lb s7 1145(gp)
+slti s11 t3 553
+div s5 a1 x0
+addi tp tp -1
+bne tp x0 -24
+mulhsu a6 s11 s9
+bltu s3 t6 24
+slti a5 a1 1150
+lw t1 1068(gp)
+sll s0 t2 s6
+xor t4 a4 s2
+lb s3 714(gp)
+addi tp x0 1
+slli s0 a5 14
+remu s6 t6 ra
+xor s8 s4 s4
+slti a2 t4 114
+andi s9 s8 -1142
+sh s8 -380(gp)
+srl s9 a0 a6
+addi tp tp -1
+bne tp x0 -32
+addi tp x0 2
+lw ra 1204(gp)
+bge x0 a7 12
+lh s2 -1610(gp)
+remu s4 ra a5
+lui t0 650463
+mulhsu a0 t3 t4
+remu t5 s2 s2
+div a7 s9 s4
+sub s7 s2 a7
+mul t6 x0 s1
+ori s1 t5 -1873
+addi tp tp -1
+bne tp x0 -48
+div t4 s3 s2
+mulhsu s3 a0 a6
+srl ra s4 a3
+andi a1 s6 -1387
+lui a6 753074
+divu a2 t6 s9
+sh s9 -834(gp)
+sh t0 -1464(gp)
+sltu x0 s2 s1
+srl s5 s1 s0
+lw a7 -1336(gp)
+lw s10 -728(gp)
+sb s4 -1794(gp)
+rem t0 t0 s8
+mulhu s0 s9 a1
+ori a6 s10 1729
+lui t0 815681
+divu a7 t3 a3
+sub t5 a5 s8
+divu a5 s5 s3
+lhu a2 1718(gp)
+and t3 a1 a3
+or s10 t0 s7
+srai t1 t0 24
+lw a7 -296(gp)
+sub s6 s10 a6
+add a3 s3 s10
+xor t4 s3 t1
+srai s10 s5 18
+auipc a3 0
+jalr s7 a3 44
+remu s3 s1 a4
+lui s0 923196
+andi t3 s11 -1964
+add a5 t5 t1
+lh a2 -214(gp)
+xori x0 s9 -894
+sh a5 -2(gp)
+auipc a0 877391
+sb t3 275(gp)
+lui t3 441556
+sra t3 s8 x0
+sh s7 -898(gp)
+lui a2 887555
+sh t3 -2042(gp)
+divu s4 t3 x0
+andi a5 a5 -2042
+xor s6 s6 t3
+slt s7 t1 s11
+xor s7 x0 x0
+lbu s9 178(gp)
+sw a5 492(gp)
+sll a3 a7 s0
+lh ra -1614(gp)
+slli s4 s0 17
+lui s3 15696
+sltu t0 s2 s4
+ori s9 s6 -1596
+srai s7 a0 25
+mulh x0 s6 t5
+mulh s1 t2 a6
+and s5 t1 s6
+and t2 x0 s9
+sub s8 s4 s6
+lhu s7 946(gp)
+slli s9 x0 10
+addi tp x0 7
+lw t6 -104(gp)
+addi s6 s10 358
+sltiu a2 a2 -612
+slt a0 a6 a1
+andi s11 s5 -1623
+lhu a7 1774(gp)
+addi tp tp -1
+bne tp x0 -28
+auipc t0 821210
+sub a6 t6 a5
+sltu t1 a5 t1
+sw a5 -632(gp)
+srai s6 a2 14
+and s6 s11 a0
+blt s7 ra 12
+sll ra s7 a0
+ori s4 t3 446
+addi tp x0 2
+bge s8 s9 60
+bgeu t5 t1 56
+and a7 s0 s7
+sw a1 1876(gp)
+or a0 s3 a5
+srli a1 t0 28
+sra t4 a3 t1
+sb t2 -204(gp)
+auipc s1 10432
+srli a0 t2 23
+slli x0 s11 6
+srai s3 a1 7
+bltu s2 s2 12
+xor t6 a6 t3
+auipc t3 424681
+addi tp tp -1
+bne tp x0 -64
+div s2 a7 s10
+remu t0 s7 a4
+add s3 t6 s10
+lbu s8 -276(gp)
+add s3 a3 a4
+slli a5 a4 15
+sw a3 132(gp)
+mulhsu x0 t5 s10
+rem t2 a6 a0
+slti s3 a5 883
+or s1 t4 s0
+sb s4 -489(gp)
+sb s6 -1990(gp)
+auipc t3 141405
+addi tp x0 4
+lbu t5 -1355(gp)
+jal t5 8
+slt s9 s5 s4
+lw t0 1124(gp)
+mul s4 s6 a4
+blt s8 a3 36
+xori a5 a5 -256
+srli t0 s5 12
+srli s5 s1 16
+sh ra -480(gp)
+xor s10 s4 s7
+srai t4 a3 1
+sb s1 -1212(gp)
+xori a5 t2 1000
+addi tp tp -1
+bne tp x0 -60
+or s7 s11 s8
+sltiu x0 s3 -916
+remu a4 t0 s5
+sub t4 s5 s3
+sll s3 s2 a1
+sb s8 383(gp)
+addi tp x0 3
+srai s0 t1 30
+mul s2 s3 t2
+andi s10 t4 -436
+lb t6 -1026(gp)
+bne s4 t4 32
+lh a3 -1824(gp)
+xor a3 t1 t3
+sub t4 s4 s10
+lb a1 -980(gp)
+ori s11 a1 1341
+ori t2 t3 -953
+slti ra a4 1985
+lh s10 -1866(gp)
+mulhsu s10 a5 t6
+sh s3 128(gp)
+addi tp tp -1
+bne tp x0 -64
+rem a7 x0 s10
+add s11 t3 s9
+lui s11 136141
+add t0 s4 s1
+sltiu a2 x0 -276
+addi tp x0 8
+bge ra s5 52
+srli t6 s4 18
+bltu t0 a1 28
+divu t6 t6 s0
+lhu t3 678(gp)
+sb s5 1368(gp)
+srli s6 a6 13
+sll t6 a4 a6
+slti s6 s5 660
+addi tp tp -1
+bne tp x0 -40
+sltu s9 ra s3
+lw a5 60(gp)
+slt ra a6 s3
+blt a0 s4 4
+addi tp x0 6
+andi a0 s11 -900
+sh s1 874(gp)
+div t3 a6 a4
+sw a0 368(gp)
+xori s6 a6 1660
+addi tp tp -1
+bne tp x0 -24
+div t2 s8 t1
+or s11 s7 a0
+div s11 s10 a2
+mulh t4 s1 t3
+lw a3 -1412(gp)
+mulh a1 s5 s4
+and t0 s2 s8
+auipc t6 0
+jalr t2 t6 24
+lbu s11 1511(gp)
+slt s4 t5 s5
+mul a7 s4 s11
+slt s8 a2 a7
+auipc t6 441874
+sltiu s3 s10 -505
+and s2 a2 s4
+srli s0 t0 7
+remu s9 a4 t0
+divu s6 ra t3
+sub s7 a5 x0
+bltu s10 s8 12
+bltu a7 a1 16
+lui t2 113057
+lbu x0 -775(gp)
+sll x0 s3 s2
+lh s9 922(gp)
+mul s1 s0 a4
+srli a6 a4 30
+ori t4 s2 -49
+lh s8 -1380(gp)
+rem a5 s9 ra
+and x0 s5 s5
+lhu t6 1298(gp)
+blt t1 s11 40
+sltiu t4 s2 1536
+lhu a6 -984(gp)
+rem a3 t2 s4
+sub s1 s6 ra
+slti a5 a5 -1348
+or s4 a3 t4
+divu ra s11 a4
+srai a7 s3 14
+slti s8 t0 -1157
+addi tp x0 3
+lhu a2 -1162(gp)
+add a7 s9 a4
+slli a6 t0 4
+addi tp tp -1
+bne tp x0 -16
+sw s7 -1120(gp)
+sb s8 -428(gp)
+sll s3 x0 t1
+and s2 a5 s11
+slli a3 a1 21
+lbu t2 -1228(gp)
+addi tp x0 3
+srai a6 t6 5
+sra t0 s0 ra
+bgeu s1 s2 56
+sw s2 -928(gp)
+srai t5 s10 21
+rem s4 s5 a0
+divu a0 a5 t5
+srl s4 s3 t6
+divu a2 s2 t4
+slt t4 s11 s9
+lb t3 758(gp)
+lw t3 -1976(gp)
+lhu s10 -1758(gp)
+sw s7 -544(gp)
+divu s10 x0 s4
+srli s0 s3 11
+addi tp tp -1
+bne tp x0 -68
+add s7 s0 s8
+sub t4 s5 s11
+mulh s7 s8 s3
+srai a4 t1 18
+slt s4 a1 t4
+lb a4 1045(gp)
+div s6 s0 t2
+xori s6 s11 590
+andi s10 a0 -1237
+blt a0 a6 52
+sll s10 s6 t2
+sh t5 496(gp)
+blt s2 s4 36
+sltiu s8 a6 1895
+srli s3 t4 0
+and t5 t6 t5
+slli s1 s7 8
+bge a1 s1 20
+blt x0 s11 16
+ori a6 a1 370
+add s6 a7 s5
+addi t1 t4 1417
+addi tp x0 7
+sltiu a7 a6 -89
+srli a5 a2 11
+sll t1 ra t2
+lbu s8 -1918(gp)
+sra s9 a0 t3
+srli s7 s4 13
+remu a2 s5 a3
+andi a2 s9 1977
+sh t2 -902(gp)
+addi a5 s10 -1024
+bne s10 s9 40
+sb a6 1764(gp)
+lui s1 781600
+bne a3 s11 4
+addi tp tp -1
+bne tp x0 -60
+mulh s5 a0 t0
+ori x0 t4 -1199
+lw s10 1040(gp)
+sltiu a6 t4 -1174
+sltiu s11 t0 -831
+sh s9 1408(gp)
+jal s0 44
+ori a3 a1 1337
+mulhu a4 a5 t3
+mul a0 t4 s11
+slt s6 t2 s3
+auipc s1 116586
+remu a6 a7 a7
+divu a4 s10 x0
+mulhsu a2 t1 s0
+beq a4 t3 8
+bltu a6 t2 4
+addi tp x0 8
+add a2 s9 s4
+slli s7 a0 5
+bne s6 a5 40
+auipc s3 0
+jalr t2 s3 68
+addi tp tp -1
+bne tp x0 -24
+sh a2 1710(gp)
+lw t5 -44(gp)
+sltiu t6 s7 -1362
+xori t0 s4 988
+lhu s7 326(gp)
+mulhu s7 a1 t1
+beq s1 a1 44
+slti s10 s10 -1874
+ori a0 s7 -2045
+sb s7 -1211(gp)
+or s2 a3 t0
+mulh s6 s4 s5
+slti s6 a2 -1252
+slt t5 s1 a3
+srl t6 s2 s7
+blt a7 s2 16
+sh x0 -1644(gp)
+bne s3 s6 28
+mulhsu s11 t0 ra
+lbu s3 -1025(gp)
+mulhu t5 s2 s4
+sltu a2 s11 a4
+mul s7 s2 s5
+slli x0 a5 15
+sltiu t0 a0 1978
+auipc a1 886591
+div s11 t6 t4
+sh s1 2034(gp)
+bne t4 a5 8
+beq a6 t2 4
+addi tp x0 2
+sub t3 ra s11
+xor a4 a7 t0
+sw s9 -724(gp)
+srli a3 s0 8
+bne a5 a0 40
+and t6 s11 s8
+mulhu a7 t4 t1
+srli a7 t5 18
+srai t3 t0 4
+lh a2 26(gp)
+slti t4 s1 -1099
+mulhsu a1 s11 s2
+sw a6 -88(gp)
+sw t5 -56(gp)
+sll s5 s2 a4
+sll t0 s10 s7
+addi tp tp -1
+bne tp x0 -68
+xori s11 a7 -1329
+addi tp x0 1
+lhu t2 1740(gp)
+sb t1 -415(gp)
+xori a3 a2 1195
+lhu s3 -1158(gp)
+slli a1 x0 1
+addi tp tp -1
+bne tp x0 -24
+mul s3 s5 s9
+lui s3 249819
+mulh a6 a0 s7
+lb a2 -45(gp)
+sh a2 154(gp)
+sw s4 -1764(gp)
+addi tp x0 6
+bge a1 s11 32
+addi tp tp -1
+bne tp x0 -8
+srai a5 t2 30
+srai t3 t2 5
+mulhu s7 s6 s3
+divu s3 x0 a2
+ori s2 s9 715
+lbu s3 665(gp)
+sltu t0 x0 a2
+lh t3 328(gp)
+rem ra a5 s4
+or t5 s8 s1
+sb t5 631(gp)
+slt s5 a6 t1
+blt s8 t0 40
+mul t5 t2 a3
+lb s10 1442(gp)
+andi a2 s4 617
+sh s9 -1790(gp)
+auipc a2 433332
+divu t6 t1 s3
+sub a5 s11 t4
+remu s7 s0 s7
+mulh x0 s6 x0
+slti s8 s9 -511
+lbu s3 526(gp)
+srl s2 s8 s11
+lhu ra -840(gp)
+sub t5 s9 s0
+andi a6 t0 -1239
+slt s5 s10 s2
+bgeu t0 t1 12
+sltiu s11 s1 -1397
+mulhsu s2 t0 t4
+lbu a6 -1035(gp)
+bge ra t4 44
+lui a1 604439
+sw t2 -1324(gp)
+divu s1 t6 s7
+lhu t1 320(gp)
+sub a6 t1 s9
+sltu s5 a2 t1
+addi a6 x0 527
+andi a0 a0 1193
+lb a3 691(gp)
+sw t6 2004(gp)
+rem a3 x0 a7
+rem t6 a2 a6
+or t4 s1 s1
+sub t1 s5 s9
+xori s3 a3 -1147
+divu t6 t5 t0
+andi a2 s4 -2042
+jal s7 4
+sll t0 s0 a1
+mulhu a2 s6 t3
+remu s6 t5 ra
+slli a1 x0 9
+addi tp x0 5
+xori s7 a0 -1306
+mul s3 t4 s4
+xor a0 a2 t6
+andi a1 ra 1560
+lhu t1 1420(gp)
+auipc s8 814797
+add a2 t0 ra
+sll a4 a1 s11
+srai a7 s1 30
+addi tp tp -1
+bne tp x0 -40
+sh s6 1230(gp)
+divu t4 t2 a0
+ori x0 s2 -1319
+lb a3 -856(gp)
+sltu s11 t0 t3
+bge a4 s9 16
+slli s1 a4 9
+srl s11 t3 t2
+sra t0 a5 s11
+lbu s11 -1871(gp)
+lbu a5 -1763(gp)
+bne s8 t1 36
+xor t3 s8 t2
+ori t2 s8 90
+beq t4 a7 24
+sh a0 2038(gp)
+auipc a4 1028958
+xori s10 s0 -860
+sltu a2 s5 s10
+srl t0 s7 a7
+addi tp x0 7
+beq s4 t1 36
+sw s7 -1608(gp)
+xor s11 a2 s5
+rem s2 s3 s9
+auipc a6 34220
+blt a4 s4 44
+lh a5 -1730(gp)
+remu a3 s8 a5
+srl s4 a2 t6
+lhu s2 -1902(gp)
+lw x0 208(gp)
+bgeu a0 a0 20
+sltiu t6 s2 1982
+lb s0 -1211(gp)
+and s1 s1 x0
+lb a3 1133(gp)
+addi tp tp -1
+bne tp x0 -68
+or s6 a4 s8
+sb t6 755(gp)
+lb a3 1338(gp)
+sb t2 1585(gp)
+andi t1 a4 -633
+lb t5 -1382(gp)
+sub s11 a7 a7
+sra a1 a2 t1
+sb s8 671(gp)
+rem t5 s8 s1
+lhu s0 -8(gp)
+bltu s5 s10 20
+lbu s6 -73(gp)
+ori s8 s9 -2035
+andi t1 a5 148
+slti a7 a2 2026
+srl t1 a6 s0
+beq x0 s3 40
+srai t1 t4 22
+add s7 s8 t5
+lbu x0 -1285(gp)
+sltiu t1 s6 1934
+blt t0 a2 12
+sub s11 s6 t6
+sra t0 s3 t6
+slti ra a1 -1513
+bge s9 a3 60
+addi tp x0 1
+mulhsu s1 a6 t3
+lb t6 -1309(gp)
+sub s8 s0 s2
+sw a5 424(gp)
+ori a0 s3 -462
+sll a4 t3 s5
+or a7 s2 a5
+sw a1 -664(gp)
+addi tp tp -1
+bne tp x0 -36
+sh t1 -1864(gp)
+sb a2 -2046(gp)
+mulhu t5 a7 s2
+add s3 a5 s5
+srli t1 a5 8
+sll t2 s8 s6
+bge s5 s5 28
+sltiu s3 s11 773
+srli t3 a0 9
+blt s3 ra 12
+div t4 ra s5
+mulh t3 a7 t3
+lw a7 -1928(gp)
+addi tp x0 5
+bge s1 s10 40
+addi s3 s6 -181
+lb t2 1829(gp)
+and s5 s8 s6
+sb t4 210(gp)
+rem t3 t5 a7
+xor a5 t3 a4
+rem s7 a1 t5
+lui s4 617893
+srli t1 a5 7
+lbu t6 -1783(gp)
+xor a3 a2 t3
+bne a6 s9 4
+addi tp tp -1
+bne tp x0 -56
+sh x0 -1050(gp)
+srai s5 s10 1
+addi tp x0 5
+andi s10 s10 -1018
+mul t2 a4 s10
+sb t1 -1930(gp)
+srli a2 t6 1
+andi t5 s2 -697
+bne a1 a2 40
+divu s6 a6 t4
+lh t5 1788(gp)
+lhu t6 -872(gp)
+remu a6 t5 s7
+slli a7 a0 20
+srli a1 s2 26
+lw s4 624(gp)
+addi tp tp -1
+bne tp x0 -56
+sb a3 -686(gp)
+lbu s8 -1287(gp)
+lw s2 -1780(gp)
+sw s11 1160(gp)
+auipc a5 800443
+bgeu s10 s0 16
+rem s6 s0 t3
+lhu a2 98(gp)
+or s2 t4 a7
+addi tp x0 2
+bge ra t1 32
+sub a2 a4 t6
+mulh t4 t4 t4
+mulh s1 a5 s2
+remu ra a1 t6
+sb s4 1537(gp)
+lbu a5 -1004(gp)
+beq s8 a2 12
+ori a6 a1 -1356
+sltiu a7 t3 1857
+slli a3 x0 21
+lw t2 -1856(gp)
+lw t0 -2000(gp)
+sh s2 -66(gp)
+sb x0 1988(gp)
+sltiu s7 s0 -1746
+addi tp tp -1
+bne tp x0 -68
+beq a0 x0 32
+rem s8 ra s5
+mulhsu a1 a5 t0
+slt s9 t6 s11
+xor t2 s7 a1
+auipc s1 1007016
+lb t0 1334(gp)
+sltu a5 t4 s8
+lh a2 -1876(gp)
+lh t4 1146(gp)
+sra t0 s0 s8
+blt t5 s10 24
+lw ra 2004(gp)
+lh s9 76(gp)
+sll s9 ra s1
+lb s8 1557(gp)
+sll s9 s11 s0
+sra t3 a3 s8
+rem a5 t1 t5
+slti a5 t3 829
+slli t0 t2 13
+ori t6 s11 -1477
+lhu t3 -202(gp)
+sh a6 1018(gp)
+xor s2 s11 t0
+ori s0 t1 -1869
+bge s7 x0 4
+bltu s9 a5 16
+bge t6 a4 12
+lb s8 776(gp)
+beq t5 s8 4
+addi tp x0 3
+or s9 a7 a1
+remu s2 s2 t4
+lb s7 1266(gp)
+sub a5 s3 s0
+sw s9 332(gp)
+sh t1 -1682(gp)
+srl x0 s11 t5
+srl a2 a4 t1
+addi tp tp -1
+bne tp x0 -36
+blt a3 t1 60
+auipc ra 452597
+sw s5 844(gp)
+mulhsu a0 t4 a6
+srai x0 a1 0
+lui a2 700713
+lh s2 -726(gp)
+mulh s7 a0 a0
+sh s0 218(gp)
+sb a0 1877(gp)
+sb a3 -1928(gp)
+sll s7 ra a4
+remu x0 s9 a5
+bge x0 s2 16
+or t4 t0 t2
+sb t0 -2010(gp)
+sh s11 1908(gp)
+sw s1 1880(gp)
+mulhsu a2 a7 a4
+lw a2 668(gp)
+ori s6 s3 -1848
+mulhsu s11 a6 a3
+addi tp x0 2
+addi s3 t6 -550
+blt a4 s1 28
+addi t5 t2 154
+addi s0 t2 1663
+lui s3 688275
+sb a6 -50(gp)
+sll t3 a4 s5
+lw a0 224(gp)
+sw t0 180(gp)
+addi tp tp -1
+bne tp x0 -40
+sb t6 1995(gp)
+mulhsu s6 a4 t4
+sb s10 1817(gp)
+divu a1 s5 s5
+srli t2 ra 18
+and a3 t5 a2
+lbu t6 1331(gp)
+addi tp x0 4
+sltiu t4 t3 1845
+sh t0 1840(gp)
+auipc a5 471289
+or s3 a5 s4
+ori s0 s3 -716
+or t6 s7 a4
+lbu a4 834(gp)
+sll s7 s3 a4
+mul s9 s3 s8
+lw t3 -308(gp)
+xor a3 a1 x0
+remu s3 t6 t2
+auipc t5 704349
+lw a1 1056(gp)
+addi tp tp -1
+bne tp x0 -60
+sb s7 -1904(gp)
+xori t3 a3 -25
+lb t6 -1383(gp)
+srli s5 a4 19
+auipc a2 319685
+lbu a4 330(gp)
+lb t6 -1180(gp)
+lb s9 -1161(gp)
+slt t2 t5 s6
+sh s10 1290(gp)
+blt s10 a4 36
+sb s3 -1181(gp)
+bne a4 t0 28
+and a4 s9 a3
+sw s6 -1344(gp)
+lbu s2 2006(gp)
+srl x0 t0 s7
+mulh a4 s2 s8
+lb s2 1035(gp)
+addi tp x0 8
+srli s7 s8 8
+lh s4 1330(gp)
+addi tp tp -1
+bne tp x0 -12
+addi tp x0 2
+lbu s9 1900(gp)
+auipc a0 1026331
+and s2 t3 s0
+mulh a7 s0 s7
+sltu t2 s10 s4
+blt a1 ra 56
+lhu t5 -1756(gp)
+bltu a6 t6 48
+bne s8 a0 16
+sll t2 s3 a5
+lb ra -1296(gp)
+bge t1 x0 28
+lhu a0 -432(gp)
+lh s4 -876(gp)
+lbu a5 1327(gp)
+addi tp tp -1
+bne tp x0 -64
+slli a7 a7 28
+lbu s3 -1690(gp)
+andi t2 t3 -71
+lhu a1 -1692(gp)
+xori s4 a2 -285
+lh s3 1136(gp)
+sll s8 a4 s5
+sw x0 -760(gp)
+remu t5 s9 s2
+and s5 t4 s3
+sh s6 1142(gp)
+sltu s8 t5 ra
+sw s3 -1452(gp)
+srli s10 s0 25
+srai t4 s1 8
+lh a2 -1524(gp)
+div t4 a6 ra
+and t6 t6 t4
+or s10 a5 s4
+lw s4 1020(gp)
+sll a2 t2 s5
+mulhsu s5 s11 a3
+remu a4 a4 ra
+slli s2 s0 8
+andi t4 s3 -1261
+bltu ra s8 8
+sb s4 501(gp)
+lhu s6 -130(gp)
+lb s9 1513(gp)
+xor s10 a0 t4
+addi tp x0 2
+sltu a2 a3 t3
+srai s8 a5 9
+and a6 s3 a4
+bge t3 t1 60
+sh a4 -1520(gp)
+add s1 t5 t4
+mulhsu a4 t2 s2
+auipc s0 0
+jalr a3 s0 28
+bge s0 t1 20
+rem s0 s5 s3
+divu a5 s0 s11
+mulh s6 s6 s4
+srai s11 s3 2
+bge t1 s11 28
+addi tp tp -1
+bne tp x0 -64
+ori ra s6 1807
+mul a0 a3 s5
+sw a0 -1340(gp)
+mulh a0 s7 s11
+jal a7 24
+slli s7 s0 31
+beq t1 a4 44
+rem t3 t1 t2
+lh s8 -848(gp)
+sra t1 a6 s4
+addi tp x0 7
+divu a7 ra a6
+bltu s4 t6 40
+addi tp tp -1
+bne tp x0 -12
+beq a2 s3 8
+slli s10 t6 8
+divu a2 x0 a3
+lbu t4 515(gp)
+divu a5 t6 t1
+lh s0 522(gp)
+mulhu s9 s11 s6
+sw a5 1928(gp)
+lw a0 1180(gp)
+lbu t2 -2019(gp)
+jal s11 44
+lbu a5 -1569(gp)
+bltu a6 t0 12
+xori t6 s1 -1685
+rem a6 a2 s9
+srai t3 t4 3
+sb t6 1965(gp)
+divu s4 s5 a1
+sw a6 1336(gp)
+xori t5 s1 -572
+slt s4 a7 s11
+sb t0 -1715(gp)
+ori a4 a1 -1996
+mulh s4 s5 s10
+addi s1 s8 619
+slli t4 t4 8
+auipc x0 454151
+lh t5 -1776(gp)
+or a4 s2 s3
+or x0 s10 s4
+sh a7 1328(gp)
+and t6 a5 t5
+rem s5 a1 a3
+bne s6 s11 44
+lhu s4 -434(gp)
+sb s3 -476(gp)
+bge a2 s6 48
+mulh ra a0 s9
+lb s1 640(gp)
+lb s10 939(gp)
+sra s0 t1 a4
+xor a2 s2 s7
+mulhsu a3 s9 x0
+slti t0 s1 -1775
+xori t2 t4 395
+mulhsu t1 t2 a6
+remu a2 ra a3
+sra s2 t0 a7
+addi tp x0 7
+auipc a3 260942
+srli s8 a5 4
+srli t1 a1 14
+sub t3 a6 s5
+ori t5 t3 -2024
+bltu a3 s6 44
+mulhsu t0 s0 s4
+lbu s0 2046(gp)
+srl a5 t6 s8
+mulhu s2 s11 x0
+lbu a5 -104(gp)
+ori t3 s9 -1618
+sltiu x0 a5 530
+addi ra s7 -1840
+sb s0 1866(gp)
+ori s5 a3 543
+addi tp tp -1
+bne tp x0 -68
+sltiu s6 s8 -1563
+sra s11 s7 s9
+xori a2 s6 -1704
+mulh ra a4 s9
+ori s3 a0 -1176
+beq a3 t5 4
+sb s3 -886(gp)
+sltiu a5 s7 -1615
+addi t1 a1 1497
+div t2 s7 s3
+and a1 a7 t0
+lw a4 -468(gp)
+sh s1 -1068(gp)
+sb a0 106(gp)
+lhu t4 -1766(gp)
+sll s1 a3 ra
+divu s4 a7 t4
+lbu ra -1628(gp)
+addi tp x0 8
+slti t1 t0 -980
+slti a7 t4 1238
+sltiu t6 a3 -1577
+sb s10 1783(gp)
+addi tp tp -1
+bne tp x0 -20
+lhu a5 1396(gp)
+sra t2 s1 s8
+div s8 t3 t0
+sh a1 -1440(gp)
+sll t6 t1 t4
+xor t3 s9 t1
+srli s5 a2 5
+xor a3 x0 a3
+lw s10 1300(gp)
+addi s4 s1 -279
+srai s11 x0 14
+slli s10 s6 21
+sll t1 x0 a3
+and a1 s2 x0
+slli a2 t4 3
+and a3 t1 s7
+ori s8 s3 -1108
+srai s5 t1 22
+srai s2 a0 1
+sb s11 -905(gp)
+mulhu a6 t1 ra
+sltiu s4 s9 1456
+bltu t4 a4 20
+lbu s5 -1701(gp)
+slt ra a2 t3
+sltiu s6 a3 -1252
+jal a0 32
+sb s3 -1611(gp)
+divu a2 s11 s10
+lw t0 1276(gp)
+sh t2 1798(gp)
+xori s9 s5 268
+mul a6 a4 t1
+sb t1 1076(gp)
+bne a0 x0 20
+rem t6 a0 s8
+andi t5 a7 1379
+srl s2 s0 a7
+blt s8 s9 4
+auipc a2 0
+jalr s6 a2 68
+addi tp x0 7
+remu s2 a5 s9
+beq s4 t6 24
+addi tp tp -1
+bne tp x0 -12
+lh s3 -50(gp)
+lw ra -1404(gp)
+mulhu t0 s3 s7
+sub s11 t1 ra
+mulh t3 s4 s10
+bge t5 s9 4
+sll s2 s10 t2
+mul a1 a1 x0
+lb ra -7(gp)
+sw s3 240(gp)
+sb s1 1641(gp)
+lb s7 1342(gp)
+andi s4 x0 -1529
+lbu a5 -124(gp)
+sltiu s7 s10 -501
+sb s10 -1689(gp)
+add t0 s1 t6
+add ra a3 t4
+auipc s5 0
+jalr t5 s5 12
+sltu t0 t4 t1
+divu s10 t5 t2
+lb a2 909(gp)
+mul t0 s3 a3
+rem s4 t1 a3
+lbu t1 -93(gp)
+mulhu s4 s2 t4
+and s5 x0 t0
+add t5 t2 s6
+addi tp x0 6
+lui t6 958562
+mul a3 a0 a2
+lh t6 -1978(gp)
+lhu a4 716(gp)
+bltu s7 s3 12
+lw s6 1416(gp)
+sw a7 -1328(gp)
+addi tp tp -1
+bne tp x0 -32
+lbu t1 -201(gp)
+mulhsu s2 t1 s10
+srli s8 t2 23
+and a7 t3 t2
+add t5 t6 ra
+lb t5 -1091(gp)
+lhu a7 -948(gp)
+sub a2 s2 a4
+bgeu s10 ra 24
+divu s8 t3 x0
+lb s11 1354(gp)
+sub s11 a2 t0
+sub a6 s0 t3
+lw a0 992(gp)
+addi tp x0 6
+andi a4 t3 1744
+and s0 s6 s5
+lw s3 -1152(gp)
+mulhsu x0 s5 a4
+sb t5 96(gp)
+divu s0 t1 t1
+andi t2 t6 -500
+srl t0 s9 s5
+rem s0 x0 t6
+srai s5 a5 30
+addi tp tp -1
+bne tp x0 -44
+bge s1 s0 52
+sub a0 a5 s3
+sw t2 2004(gp)
+beq t4 a3 64
+auipc s1 0
+jalr t4 s1 20
+add t4 s10 s6
+addi a6 s0 113
+lhu a1 -390(gp)
+lui t6 462075
+sub x0 s8 s9
+or a7 s9 s8
+slt s9 s0 s4
+slli a6 s6 0
+srli a0 t0 29
+srli s9 t6 26
+div a7 s3 a2
+srl a3 a2 s1
+sw a1 704(gp)
+mul a7 s0 t3
+xori t0 s0 473
+mulh x0 s9 a0
+mulhsu a2 t4 ra
+slt s5 t1 s11
+rem a2 t0 a6
+bltu t6 t6 4
+sb a4 -1426(gp)
+rem a4 s0 a4
+sltiu t3 s11 1783
+mulhsu t2 t4 s10
+lb t3 -523(gp)
+addi tp x0 3
+lh s3 2020(gp)
+add a6 s0 s11
+addi tp tp -1
+bne tp x0 -12
+lbu a4 -1466(gp)
+div s11 s4 t3
+ori s3 a3 -1169
+sltu s0 t4 a4
+auipc x0 76881
+remu s3 s1 a4
+lw a4 -60(gp)
+mulhu s1 t0 s7
+lui s9 101632
+slli a3 t1 18
+lui s11 531705
+add t2 s11 s2
+mul a1 t6 x0
+sll s2 a3 a7
+srli a7 s4 15
+srl t6 t2 s10
+slli a4 s5 8
+slli t4 t6 5
+sb s3 -1726(gp)
+srli t3 a3 29
+xor t0 x0 a2
+blt x0 s6 8
+srli s8 t5 10
+srai t4 x0 18
+addi a1 s6 -1375
+sw a0 1144(gp)
+xor s6 a0 t4
+jal a3 52
+lb a1 1516(gp)
+slt s10 a4 t5
+sh s0 -1394(gp)
+remu a3 s1 t4
+div s11 s7 t2
+bge s10 t0 24
+div s10 ra a7
+sll a2 s3 a0
+sb t1 -379(gp)
+rem s9 t1 s3
+mulhu s9 a2 t6
+bne s5 s7 40
+xor s0 t3 s11
+sra s8 ra a5
+bgeu t5 s9 12
+mul a6 t2 s7
+beq a7 s0 48
+add t3 t3 a3
+div s8 t1 s4
+sb a3 -171(gp)
+lbu a6 1700(gp)
+lhu x0 1412(gp)
+jal t3 64
+xori t4 s5 -1533
+lb a2 -901(gp)
+and a2 a3 t2
+lui s10 445062
+sub a3 s5 ra
+lb t5 8(gp)
+mulhsu s3 s4 s1
+lh s4 1996(gp)
+lh s6 -682(gp)
+lh s0 -758(gp)
+remu s8 a2 t6
+bge s9 a0 56
+remu s7 t0 t4
+auipc x0 140581
+lh s5 -16(gp)
+add s9 ra t1
+lhu s9 -1452(gp)
+lbu t3 2042(gp)
+lb x0 -1597(gp)
+sltiu s9 t6 689
+mulhu s2 a4 t5
+lhu s9 350(gp)
+srl s3 t1 a4
+mulh t6 s2 a1
+lw a3 -392(gp)
+sw s1 -884(gp)
+lb s9 614(gp)
+slt x0 a1 t5
+lhu s9 -1520(gp)
+lh t0 -870(gp)
+xori a0 a3 -368
+bgeu s2 s6 24
+lbu a5 -691(gp)
+srl s2 t5 t1
+and t2 s7 s11
+mulhsu ra a1 s6
+slli a2 t0 10
+addi tp x0 3
+divu t1 s4 s11
+mulhsu s0 s0 a4
+sltiu s11 t6 706
+jal t0 56
+add s3 s2 s1
+xori t3 t2 -164
+ori a1 s3 -424
+sw t1 -460(gp)
+srl a6 t1 t6
+xor a4 a4 s10
+addi tp tp -1
+bne tp x0 -44
+sw s0 -188(gp)
+bne s8 a3 44
+and t5 ra x0
+add a7 t0 x0
+addi s11 a2 -1208
+rem s1 s3 s2
+beq s8 a0 24
+sll s0 s0 a2
+sltu t6 a4 t6
+sub x0 x0 s0
+srai s10 s8 22
+lbu a1 -1367(gp)
+addi tp x0 2
+lb a2 -1508(gp)
+sb a3 -341(gp)
+auipc a0 0
+jalr a6 a0 68
+sub s4 s3 a1
+lh t0 -1066(gp)
+bne s3 t5 60
+sltu s0 s3 a5
+lbu a2 -1440(gp)
+sh s1 1388(gp)
+beq a2 t1 60
+ori a7 a1 -363
+addi tp tp -1
+bne tp x0 -52
+slt s7 s8 a5
+sb s3 -423(gp)
+and a3 t3 t3
+bgeu s2 s9 16
+addi s9 s1 -1411
+or ra s10 s3
+bltu t5 s7 52
+sltu x0 a4 a1
+and a1 a4 x0
+sw t2 -1552(gp)
+sll a1 a0 s9
+auipc s2 377770
+and s2 s0 t3
+lb s9 1505(gp)
+sh s2 1566(gp)
+sub t4 s2 a3
+div s8 s3 t5
+jal s1 32
+lh s2 -1364(gp)
+sub t6 s4 s0
+sw t5 1224(gp)
+bltu t1 t1 16
+blt s1 a6 16
+sh t5 -660(gp)
+sub t3 s7 s1
+auipc s0 1002830
+mul s2 a0 t2
+srli s0 a6 28
+lb t4 -1062(gp)
+add a2 x0 s9
+mulh s8 t5 s1
+rem s0 t3 x0
+lbu s10 -495(gp)
+mul s10 ra s0
+sh a2 1912(gp)
+sll a5 s1 t1
+auipc x0 576322
+xor t5 a0 x0
+sll s2 s7 x0
+lbu s0 -1988(gp)
+bgeu s5 a4 20
+srl s5 a1 a5
+sw t3 -1636(gp)
+sra ra s0 s4
+mulh t5 a7 t0
+addi tp x0 1
+divu t4 x0 s1
+lb s10 1621(gp)
+auipc t6 749156
+sub s1 a5 s0
+srli a6 s9 30
+slli t3 s8 22
+auipc t5 369986
+remu a3 t5 t4
+srl a7 s2 a1
+mul a1 s0 s0
+sw a0 -1672(gp)
+addi tp tp -1
+bne tp x0 -48
+bltu t0 a5 36
+lui a0 36675
+lui s3 216319
+lbu s10 -1918(gp)
+slti s0 s8 178
+slt a7 a6 a3
+rem s10 s3 t5
+sltiu s5 s7 -413
+lbu ra 303(gp)
+remu s6 s10 s2
+auipc a3 513184
+sra s2 x0 s7
+sltu a1 a0 t1
+add s2 s5 t5
+sw s2 1632(gp)
+sll a0 ra t4
+srl s8 s11 t1
+divu s2 s1 a3
+and s4 s11 s6
+auipc a2 982162
+lb t6 -251(gp)
+sw s7 1032(gp)
+rem ra t1 s2
+slt t6 s1 t1
+sw t0 -1904(gp)
+sll s9 a1 t4
+rem ra t6 s2
+and s7 a7 a7
+xor ra ra t3
+sltiu a4 t2 1492
+xori s3 s10 801
+lui s11 559467
+lhu a3 -1798(gp)
+bgeu s6 ra 64
+lh t4 -1200(gp)
+remu s0 a7 t6
+lbu a4 -1143(gp)
+sub ra a1 s7
+slli s11 a1 15
+mulh t4 s8 t2
+srl t5 s9 t5
+blt a3 a2 28
+lw t2 1668(gp)
+sra t2 ra s7
+jal s0 28
+sra t5 s5 s7
+slti a2 s9 1726
+and s8 a6 t1
+slli a1 t4 3
+sltiu s11 t0 -805
+or t1 a3 t5
+sb t5 -1555(gp)
+srl s2 s7 s11
+sub s3 s4 t5
+mulhu a7 s10 t3
+sh a1 -1902(gp)
+srli s4 a1 3
+sll a4 s4 s0
+sll ra s6 s9
+mulhu a6 ra s7
+rem x0 t4 a4
+xor t6 t5 s5
+mulhsu s2 a5 s10
+addi tp x0 7
+sh s10 -1676(gp)
+sra t4 t6 t4
+lh t1 -152(gp)
+lw s7 1092(gp)
+addi a1 s4 -1420
+sltiu s5 a1 -717
+addi tp tp -1
+bne tp x0 -28
+or t6 t3 s5
+divu s11 s1 x0
+sll a3 s5 ra
+sh t1 1422(gp)
+jal a1 24
+auipc s2 657953
+mulhu s9 a0 s0
+sltiu t2 s3 -1769
+remu s1 a4 x0
+or s5 ra a5
+addi tp x0 8
+ori s2 t0 -1864
+lw t3 -244(gp)
+auipc t1 0
+jalr s8 t1 16
+lh a7 1034(gp)
+sb s6 -1047(gp)
+xori a1 t4 1752
+mul t4 s9 s6
+bne s8 t4 24
+rem s7 s4 s9
+auipc t0 522527
+slt t0 a5 t5
+addi tp tp -1
+bne tp x0 -52
+lhu t0 554(gp)
+lw x0 -644(gp)
+addi ra s0 -1758
+and s3 a1 s5
+addi tp x0 4
+lhu t0 1120(gp)
+sub a5 a1 a6
+srli a4 s11 0
+sra s9 s9 a6
+srl s8 s6 a4
+bge a4 t1 52
+sh a1 1278(gp)
+sb s0 356(gp)
+mulh s11 t6 t1
+xori s4 t2 -402
+slti s6 s11 552
+beq s11 t0 4
+sb t4 972(gp)
+lbu t2 1670(gp)
+addi tp tp -1
+bne tp x0 -60
+beq s8 t5 56
+add t2 s3 a4
+sra t5 s9 s5
+lbu a7 898(gp)
+beq a6 a0 24
+lbu a4 1737(gp)
+xor s9 s9 t6
+sh s6 -1824(gp)
+lb a5 681(gp)
+bgeu s4 a0 48
+divu s4 s7 t5
+sh t4 -672(gp)
+rem s0 a4 a3
+bge t4 x0 60
+addi tp x0 3
+lh s9 -1266(gp)
+addi tp tp -1
+bne tp x0 -8
+sw x0 -1312(gp)
+lbu x0 -639(gp)
+bgeu s2 a2 28
+lbu a3 -1313(gp)
+lb s2 -1333(gp)
+mulhu s11 a4 t3
+sw s6 -80(gp)
+blt s0 ra 56
+slti a5 s1 -774
+sh a6 -1400(gp)
+jal s3 4
+addi tp x0 8
+auipc s10 0
+jalr s10 s10 28
+lh a7 1772(gp)
+addi tp tp -1
+bne tp x0 -16
+lb s11 -1501(gp)
+lhu a7 1496(gp)
+and a3 t6 s1
+slt s11 a2 t4
+mulhsu a4 t4 s9
+bne s3 s3 52
+beq t0 a5 28
+andi s0 s1 -449
+sltu s8 s4 t4
+sll t1 s9 t6
+sb s0 1994(gp)
+lh s10 -1920(gp)
+mulhsu a1 s1 s11
+slti t0 s2 1529
+rem s0 s2 s10
+slli t6 x0 9
+xori t3 s9 -1898
+mulhu s5 t5 s7
+srai a3 s6 16
+div a6 t0 a5
+lhu t3 658(gp)
+sb t4 -1817(gp)
+and t5 s7 s1
+lhu t4 1766(gp)
+sltiu a0 s6 -982
+bne s10 s8 4
+div t3 s0 t3
+srli s6 s11 5
+addi s11 s2 -358
+sub s11 t6 s3
+lhu s5 968(gp)
+lh a0 -1936(gp)
+lb s10 -1142(gp)
+lw s11 -1844(gp)
+beq s0 s7 8
+srai a3 s11 3
+mulhu t3 s5 a5
+sh a1 -1106(gp)
+sra x0 s5 s6
+sb t0 1798(gp)
+lhu t4 -172(gp)
+auipc t1 0
+jalr s11 t1 36
+sh s2 1290(gp)
+sub s7 a1 t6
+mulhsu t3 a1 a6
+auipc ra 743973
+lhu s5 1034(gp)
+bne a6 s1 32
+bge t3 s8 52
+lb x0 1222(gp)
+auipc t2 0
+jalr s3 t2 36
+lh t4 1026(gp)
+sll s8 t3 a2
+mul t5 s6 x0
+bltu a7 s9 24
+remu a3 t1 s0
+sltiu s2 s10 -1892
+auipc t4 376303
+bne s3 s10 8
+sltu a5 s7 s6
+addi tp x0 4
+sw a7 1580(gp)
+beq a3 s3 28
+mulhsu a0 a3 s3
+sb s9 -1977(gp)
+lui t4 893266
+bgeu s0 s8 40
+mulhsu t2 x0 a5
+mulhu a5 t2 s6
+sb a4 1522(gp)
+addi tp tp -1
+bne tp x0 -40
+auipc a2 0
+jalr t2 a2 64
+remu s2 t1 s10
+divu ra s3 s2
+slt s3 t6 t3
+div t6 s8 t3
+slt t3 t1 a2
+lhu s6 -1716(gp)
+lhu t2 -544(gp)
+rem t3 a4 a5
+lb s8 260(gp)
+rem s10 s3 t6
+sw t2 -356(gp)
+lw t4 -52(gp)
+srli a4 a7 5
+mulhsu t3 t2 s10
+srl t6 s3 t4
+mul a4 a4 t6
+remu a2 s1 s9
+sh s1 -1820(gp)
+rem a5 a6 a6
+sb a4 1602(gp)
+sb a5 345(gp)
+lb s2 -1496(gp)
+and a2 s7 s6
+div t1 s4 ra
+sb t2 176(gp)
+sub s11 t4 t0
+xor a5 s2 a7
+bne a6 s9 64
+bge a7 ra 64
+beq s5 t0 4
+addi tp x0 3
+srli a6 s7 23
+sh s7 1350(gp)
+sh s11 1200(gp)
+sw ra 528(gp)
+divu s7 a7 t4
+divu t2 s4 s1
+div s6 s4 ra
+or a6 s8 s10
+sh a2 -1694(gp)
+add s4 a1 s9
+addi tp tp -1
+bne tp x0 -44
+sltu t3 t2 s1
+blt s8 s10 44
+slt t4 t0 a7
+beq a0 s1 60
+slt s8 s5 s11
+slli s6 s11 18
+mulhsu s1 t5 t5
+srli s2 s5 24
+srli s0 x0 15
+lw s2 -580(gp)
+mulh t5 ra s7
+rem a3 s9 ra
+slt s6 s6 t5
+mulhu a1 s5 s7
+lhu a7 422(gp)
+beq a7 a2 20
+lbu s4 -224(gp)
+srai s5 s5 4
+lw s5 1600(gp)
+bge s0 s4 32
+mulh s9 a1 t4
+sw t1 -744(gp)
+lh t4 322(gp)
+xor s11 t0 a4
+and t2 a4 t5
+bltu a5 a4 32
+slti ra s7 1802
+lhu t2 -84(gp)
+lbu t1 608(gp)
+andi s4 t2 727
+div t1 ra s2
+sra t5 s9 a0
+divu ra s3 t2
+sb s2 1519(gp)
+sra t3 s2 a1
+bgeu a4 s6 40
+sh a3 -958(gp)
+divu s9 s11 s1
+and s7 t4 t6
+slli s5 s9 25
+rem s11 t4 s8
+srli a5 t1 10
+lh t2 -438(gp)
+bltu a4 t6 44
+sub t3 a4 t0
+addi tp x0 8
+mulhsu s9 s7 s10
+ori s9 t0 1083
+bne s10 s8 20
+addi tp tp -1
+bne tp x0 -16
+sb s11 -1902(gp)
+mulhu t1 t5 a2
+sb ra 246(gp)
+srli a2 a3 2
+sb a6 985(gp)
+div s4 t5 s8
+addi tp x0 7
+mulh ra s7 s2
+and s7 t6 a6
+addi t4 s7 24
+xor t2 t4 a4
+sltu ra a0 a7
+beq a7 s10 16
+mul a6 a5 x0
+and t1 s2 s1
+addi s9 s2 896
+sra a0 s3 s9
+srl x0 s3 s10
+sll x0 s0 t5
+auipc s1 623704
+sll a0 t3 t6
+andi t5 s7 -67
+addi tp tp -1
+bne tp x0 -64
+sub s1 s10 s3
+ori a3 a7 956
+and s3 a2 s2
+mulhsu a3 s6 t4
+beq s6 a6 32
+xor s11 s4 a4
+lui t4 303703
+bgeu s2 s4 20
+sh t5 150(gp)
+jal t0 44
+bltu s4 t4 48
+lb t3 1125(gp)
+lbu t3 567(gp)
+bgeu a2 s0 48
+xori t6 a7 1739
+lh s10 -1332(gp)
+andi ra s10 290
+sb a5 1155(gp)
+add s5 s9 s6
+sw s8 -836(gp)
+slt s7 t2 x0
+mul ra s7 s2
+lw a7 492(gp)
+xori s5 a6 1340
+xori s0 a6 -1554
+beq a4 t0 12
+lhu t2 -346(gp)
+mulhu s10 t6 x0
+addi s8 s8 -1476
+addi tp x0 1
+lhu s5 490(gp)
+sh s8 -1384(gp)
+lb a5 -690(gp)
+bge s11 a7 32
+lui s4 932196
+addi tp tp -1
+bne tp x0 -24
+add s9 a4 s2
+ori t0 a4 -1606
+or a4 a1 a7
+srai s9 s6 27
+mul s6 s11 a2
+auipc a4 1020541
+lw x0 -116(gp)
+rem t5 x0 ra
+slli a4 a6 26
+lh a2 872(gp)
+sltiu s7 t6 295
+addi tp x0 2
+srai s1 s2 17
+slt a7 s6 ra
+lbu t2 1164(gp)
+lui s1 283223
+jal t1 16
+lui a2 336610
+lh a5 1232(gp)
+mulhsu t5 a5 t4
+lui s9 360358
+xori t4 t2 -1784
+rem a3 t5 s1
+sra s5 t4 t6
+blt t0 t6 56
+div a6 s5 t3
+sltiu t3 s1 72
+addi tp tp -1
+bne tp x0 -64
+addi tp x0 2
+bgeu t4 s10 44
+lui t5 415994
+remu a7 a5 a4
+srai t2 a7 10
+or a6 s11 s9
+srai s4 a0 20
+addi tp tp -1
+bne tp x0 -28
+sb a7 1536(gp)
+sll a5 s0 t0
+srl s0 t1 s6
+slti s2 a1 -587
+srli s8 a4 13
+slti t3 s2 -707
+or s3 t5 t5
+sb a5 -418(gp)
+sw t5 624(gp)
+xor s9 s8 a5
+andi s2 s4 284
+addi tp x0 5
+sb a6 101(gp)
+lui s7 849217
+bge t5 s2 24
+rem a1 s3 s2
+jal a5 8
+slt s0 a6 s10
+lw s8 -1116(gp)
+add t5 a0 s6
+and s2 s5 s5
+mul a4 ra t4
+slti a5 t0 -55
+blt s4 s10 60
+addi tp tp -1
+bne tp x0 -52
+slti a1 s5 692
+addi tp x0 2
+sh t6 -1938(gp)
+ori a0 a0 -150
+and s2 a3 a5
+sltu a0 s5 a7
+divu s1 a2 s11
+srai s0 x0 10
+lh s10 1168(gp)
+addi tp tp -1
+bne tp x0 -32
+sltu a7 s4 t0
+mulh s1 a4 t2
+sra a5 s2 s8
+mulhsu t1 s3 s10
+addi s11 s7 -181
+beq a3 a3 12
+sb t5 107(gp)
+xori s3 s0 -1242
+addi tp x0 7
+rem t0 a5 t0
+bltu a3 x0 48
+sh s7 -240(gp)
+sll s0 t4 t2
+andi s4 ra 523
+addi s10 a0 -735
+xori a3 t4 -930
+div t2 s0 a6
+sltiu t0 x0 -1007
+bne s6 t1 24
+ori a4 s9 -1680
+mul s10 a2 s1
+srli a4 t0 10
+auipc t0 560337
+lh t5 1438(gp)
+add s8 a3 a5
+addi tp tp -1
+bne tp x0 -68
+xor s7 s10 a5
+lw s10 608(gp)
+srl a3 x0 t3
+mul s7 a4 t6
+srai s1 ra 1
+and s9 a5 a0
+sub s8 a0 s6
+andi s1 s2 -1224
+sub s11 a6 s7
+srai t1 t5 2
+mulhsu a4 s4 s10
+lui s4 937223
+beq s10 t0 20
+xor a4 t3 s6
+div s4 a5 s7
+srai t1 s2 7
+xor a6 s2 s11
+bne a1 s11 40
+lui s3 406328
+beq s2 s11 48
+srli s5 a0 14
+lui a7 820488
+lh t4 -1370(gp)
+divu t0 a0 s6
+divu s0 t3 s2
+divu s7 ra t1
+lw s7 -312(gp)
+ori t4 s11 35
+bgeu s4 s1 60
+slt s3 s9 a5
+slli t6 x0 11
+slli s0 s5 13
+srai t4 s7 26
+slt ra s4 s1
+xor s2 s6 a3
+ori a3 a2 1319
+sra t0 a5 s6
+remu s9 a7 a1
+sltu t4 s6 s5
+lhu a7 -702(gp)
+divu a0 s8 a3
+bge t0 a0 48
+bne t6 s1 8
+bltu s9 s11 4
+addi tp x0 6
+xor t0 x0 s10
+slt s11 ra s4
+andi a6 x0 -898
+lb ra -537(gp)
+or s4 s5 t5
+slti a3 t0 -1459
+addi tp tp -1
+bne tp x0 -28
+lbu s2 1497(gp)
+lhu s9 522(gp)
+div ra t4 t1
+addi tp x0 8
+slt a4 s8 a7
+srli t2 t1 24
+lbu ra 58(gp)
+bge a5 s0 48
+remu s6 a1 t0
+sb t1 -1582(gp)
+andi t3 t0 -940
+sltu t2 x0 t3
+bne s1 s5 40
+mulhu s6 t5 a7
+divu x0 s9 x0
+slti t1 a2 -587
+div t2 a1 t0
+sw s4 892(gp)
+mulhu a4 ra x0
+addi tp tp -1
+bne tp x0 -64
+bltu s5 s9 48
+slli s3 s8 18
+sll ra a2 ra
+add t3 t0 s11
+srli t2 s9 18
+slti s6 a7 600
+sh s5 104(gp)
+divu s9 t6 a2
+and s3 s9 s11
+mul t5 s1 s5
+lh x0 -1542(gp)
+lhu t5 -1210(gp)
+sb t1 1193(gp)
+bne x0 s7 36
+mulhu s1 t1 a5
+slti s10 t6 -480
+or t6 t4 a5
+jal s2 20
+sb a1 -1714(gp)
+and a4 a6 s2
+mul s1 s3 s9
+slt t4 s8 t5
+divu x0 t3 s4
+auipc a0 770716
+xori s0 t1 -987
+sltu t0 s9 t4
+sw a6 1012(gp)
+lb a0 345(gp)
+or s5 s1 a2
+and s4 s9 s10
+sltiu s8 t3 -100
+sb s4 -962(gp)
+sll s5 t5 a7
+andi s5 s10 -2028
+srli s9 s10 31
+sll a3 t1 a4
+and s9 s8 t3
+addi tp x0 6
+sb s5 1337(gp)
+sw a1 1548(gp)
+auipc a7 54273
+slt t1 a2 x0
+auipc s3 759236
+mulhu s11 s11 a7
+rem a2 s10 s5
+sw a0 -1692(gp)
+remu a6 s6 ra
+slli a2 a0 15
+sub s10 s3 a0
+lbu a7 1228(gp)
+blt a1 s2 28
+addi tp tp -1
+bne tp x0 -56
+jal a1 24
+sh t4 1708(gp)
+sw a4 92(gp)
+sw t4 1604(gp)
+slti t2 t1 1320
+jal s10 40
+addi tp x0 8
+xori s6 s10 -566
+mulhu s1 s0 s3
+srl t2 t0 x0
+addi tp tp -1
+bne tp x0 -16
+sh ra -1594(gp)
+sh s3 -214(gp)
+add a3 s10 a3
+mul a7 x0 a4
+sh a1 1042(gp)
+sh s1 1314(gp)
+divu s6 t1 s6
+blt t0 t0 48
+lhu a6 -1254(gp)
+rem t3 s1 a3
+xor ra s0 a5
+srli a6 a2 11
+srai s10 a3 6
+xori ra a7 -86
+lb s6 983(gp)
+rem s3 s2 a5
+sb t2 1870(gp)
+sb a3 1933(gp)
+slti s10 s2 1781
+addi tp x0 1
+slti s5 s11 -351
+bgeu s2 s10 4
+slt a2 t3 t3
+sw t6 -1420(gp)
+lw s2 -1060(gp)
+addi a7 s2 332
+remu s8 t3 s7
+or t6 ra s4
+bltu s8 s0 4
+add a1 a3 s3
+div s1 a5 t0
+slli a0 t0 9
+add s7 x0 a7
+sw t1 1316(gp)
+addi tp tp -1
+bne tp x0 -60
+add t2 a7 s7
+rem s1 a2 t5
+mulhu t3 ra s9
+sh s6 18(gp)
+srli s3 s7 17
+lw s11 1796(gp)
+slt t6 a4 t4
+sb s6 1422(gp)
+sra s3 s7 t0
+beq s2 x0 20
+andi x0 t4 -1608
+slli t2 s11 29
+lw s0 140(gp)
+lhu s9 1668(gp)
+auipc s2 232832
+sh a1 -1444(gp)
+sltiu s7 t4 -470
+mul a7 ra t3
+srl s9 t4 a1
+lbu s0 -1711(gp)
+rem a1 t6 s1
+srli t2 s5 23
+remu a6 t3 s2
+mul s11 a5 a0
+sh s1 -986(gp)
+srl s1 ra s10
+divu t1 s9 t3
+sw a1 -400(gp)
+lb a4 316(gp)
+addi tp x0 7
+beq a7 x0 32
+lhu t5 1542(gp)
+mulh t1 s6 s2
+slt t2 s10 s9
+lui s9 862138
+sra s8 s3 t0
+bne s3 t2 52
+slli t4 t2 24
+xori a5 a4 -829
+sltu a7 a5 t5
+addi tp tp -1
+bne tp x0 -44
+srl s5 s4 a5
+lh s8 1518(gp)
+sltu t1 a4 t4
+auipc a3 70093
+lw x0 212(gp)
+lbu t1 -1758(gp)
+xori s7 s3 -1783
+ori s0 a0 -1400
+and s3 s2 t1
+beq a7 s11 36
+lbu s6 -1871(gp)
+sb a6 -1876(gp)
+sra s5 s6 a0
+sh s8 592(gp)
+divu t2 ra a0
+mulhsu t5 t5 a3
+mul a6 a3 s4
+srai ra a3 20
+addi tp x0 7
+lhu t4 520(gp)
+lh ra 382(gp)
+slli a6 s7 26
+addi tp tp -1
+bne tp x0 -16
+auipc t6 466440
+mulhsu a6 s7 s5
+sh t4 868(gp)
+xor t0 s6 t4
+srli s7 t2 16
+srl s8 s9 s2
+srl a6 a6 t1
+addi tp x0 5
+sh s9 24(gp)
+bne t1 x0 64
+slli a7 t4 0
+sltu t2 t2 t6
+rem s0 s5 s9
+sh s8 1346(gp)
+addi tp tp -1
+bne tp x0 -28
+or t1 s1 s8
+lhu t6 -576(gp)
+mulhu t1 t5 s11
+xor s0 t2 a6
+slt s2 t5 ra
+addi a0 a0 -285
+sb t0 256(gp)
+sub s1 a7 s4
+mulhsu a7 t2 t0
+addi tp x0 3
+div t3 t3 t3
+bltu t4 s2 32
+lhu a7 -330(gp)
+sw a7 -792(gp)
+lh s2 1400(gp)
+lw s9 -1252(gp)
+sh s2 1824(gp)
+sw t3 908(gp)
+and s2 s0 s2
+addi tp tp -1
+bne tp x0 -40
+sw a3 -1660(gp)
+auipc a4 683901
+xori t5 a2 -1840
+sw t4 -696(gp)
+slli t5 t0 24
+sltu a2 s7 s4
+div s3 a7 a5
+lh s4 1828(gp)
+xori s10 s11 1098
+addi tp x0 6
+rem s3 x0 s0
+mulhu s0 x0 a0
+srl a3 a0 s2
+lhu a6 -382(gp)
+lh t6 580(gp)
+sb s3 1524(gp)
+lhu t0 1586(gp)
+addi s2 a3 -954
+slti a4 a6 844
+xor t4 s3 a0
+lhu s1 990(gp)
+ori s7 s2 -1093
+sll s1 s8 a0
+mulh s1 a6 a2
+sub a6 s10 s11
+addi tp tp -1
+bne tp x0 -64
+lhu t2 -1822(gp)
+addi a0 a6 -342
+bgeu s11 a1 52
+andi s3 s2 -473
+lh ra 1992(gp)
+slt s8 s5 s1
+lhu t3 -1632(gp)
+sw a0 1312(gp)
+and a1 a3 s9
+slt s6 s4 x0
+bne ra x0 28
+sb s6 1224(gp)
+jal s7 4
+auipc ra 0
+jalr s3 ra 32
+mulhsu s4 a3 a7
+andi a1 a6 -331
+sub x0 a2 s5
+and t4 t1 t3
+sub t0 t3 t2
+bgeu s11 s8 24
+andi s10 s8 -43
+xor a0 t0 s1
+rem t3 ra s0
+slti s6 a1 943
+mulhsu s5 s10 t4
+sw s1 1576(gp)
+or s1 s9 a2
+lw s4 448(gp)
+bne t2 s3 8
+div a4 s3 t2
+add t4 a3 ra
+ori ra ra -786
+addi tp x0 6
+sltu s2 a2 t5
+addi tp tp -1
+bne tp x0 -8
+sb s9 -635(gp)
+srai a5 t4 13
+bgeu a5 t4 32
+auipc s1 0
+jalr t5 s1 64
+auipc a3 0
+jalr s11 a3 48
+addi t4 ra 265
+rem s4 s5 t4
+srai s11 s6 27
+addi tp x0 3
+add s8 t1 a4
+beq a5 a5 48
+and s5 t0 t1
+auipc a7 695482
+addi tp tp -1
+bne tp x0 -20
+sb t3 1242(gp)
+sh a2 1574(gp)
+sra a7 s2 t4
+srli s1 t4 17
+bgeu a2 a3 24
+srai s2 s3 10
+div t5 ra t3
+lb ra -1544(gp)
+andi t0 a7 -1172
+slti t5 s8 -893
+srai t4 t4 14
+sw s8 1032(gp)
+andi ra a0 -339
+sub s10 t0 s11
+lb t3 1870(gp)
+sw s8 1028(gp)
+div t1 s7 s9
+addi tp x0 8
+and s8 s8 t3
+divu ra s11 s0
+add s9 s5 x0
+lh s2 -1918(gp)
+sw a2 -1552(gp)
+mul t2 a7 a0
+lb s1 -1793(gp)
+remu t2 t0 s10
+lh a1 1594(gp)
+bge s10 a7 24
+srli s6 s7 28
+slli s11 t3 18
+addi tp tp -1
+bne tp x0 -52
+div s2 s6 a0
+mulhu s11 t6 s6
+sh s10 -1836(gp)
+and t6 t2 t6
+auipc a1 534923
+xori s6 a3 1879
+addi tp x0 8
+mulhsu s8 a0 s5
+sw s3 -828(gp)
+or t5 ra s10
+ori a4 s7 923
+beq a6 a4 32
+mulh a5 t2 s1
+auipc s9 391085
+sh s10 600(gp)
+jal ra 16
+ori t6 s4 1801
+sltu t1 a6 t1
+slli ra s0 28
+addi s2 s0 1125
+sll a2 t1 x0
+addi tp tp -1
+bne tp x0 -60
+sra a6 s3 s3
+addi tp x0 1
+div s8 t0 t5
+srli t0 t1 3
+slti ra t1 572
+sltiu a7 t2 -1402
+and s11 t2 s4
+lw t1 -32(gp)
+xor s9 t2 s10
+lh a1 -186(gp)
+ori t5 s4 858
+mulhsu a0 t3 t1
+lw s0 -748(gp)
+ori t3 s11 1423
+srl s10 s6 t5
+lb t5 1447(gp)
+addi tp tp -1
+bne tp x0 -60
+bgeu s6 t3 24
+bne a0 a2 44
+and s9 s0 s2
+ori a4 t3 2040
+beq a6 t1 32
+xor t2 s0 a4
+blt a3 s6 24
+lh s10 -414(gp)
+bne a4 a6 16
+addi t0 s6 148
+lhu a0 1120(gp)
+addi t3 t2 -2033
+addi tp x0 5
+slt s0 a7 t0
+rem s5 s0 a3
+lw s11 720(gp)
+add t5 s10 t3
+lw s2 -1864(gp)
+add a7 s10 x0
+lb s1 -288(gp)
+sltiu a7 s9 -281
+xor s11 s6 t1
+sltiu t2 s11 1243
+slti a7 s11 1864
+andi s9 a4 -1741
+div ra a1 s10
+sub s5 s10 t4
+blt a3 a2 48
+sb s11 983(gp)
+addi tp tp -1
+bne tp x0 -68
+slti s2 s6 950
+sw a3 -720(gp)
+sltiu t3 s1 1640
+mul a7 s1 ra
+auipc s8 1014467
+bltu s0 a5 28
+sb t1 441(gp)
+xor a1 a1 a2
+sw s3 -1604(gp)
+auipc s11 721733
+sra t6 t1 a4
+sra a0 s8 x0
+addi tp x0 1
+rem a3 s6 a4
+andi s4 s11 -1680
+lw t2 -1448(gp)
+or t6 a1 ra
+mulhsu a5 a7 s0
+addi tp tp -1
+bne tp x0 -24
+lbu s11 364(gp)
+lw t5 892(gp)
+xor a4 s1 t5
+srai s9 t6 9
+remu s7 s7 s8
+lhu s11 122(gp)
+div s8 t4 s11
+lw s7 -200(gp)
+and s3 s3 s9
+auipc a7 193322
+addi t4 x0 -413
+slti t5 t2 -1851
+addi tp x0 5
+sll t4 s3 ra
+sltiu s8 a0 -689
+srai s10 t1 19
+rem a2 ra a7
+auipc s3 501655
+or a2 s11 s7
+sw s6 -1424(gp)
+rem a3 t3 t6
+beq s1 t1 44
+sltu s1 s11 t5
+srl t2 s1 t3
+ori s6 s10 702
+sw ra 672(gp)
+lui s10 430523
+addi tp tp -1
+bne tp x0 -60
+lw t1 -536(gp)
+mulhsu a7 s4 a5
+or s6 s1 s6
+addi tp x0 8
+xori t3 s11 -1361
+sra t1 s5 a3
+lhu a0 966(gp)
+and s2 s3 s11
+addi tp tp -1
+bne tp x0 -20
+mulhsu t6 a2 t2
+lb a5 1494(gp)
+or a4 t2 a4
+ori a2 s4 -788
+lw a2 1836(gp)
+slt a4 a1 a7
+srli a1 s0 8
+lb ra -1249(gp)
+sra x0 t2 s2
+add s4 t0 t0
+mulhsu ra a4 t4
+lbu a7 1024(gp)
+lui a7 841278
+addi tp x0 1
+blt t5 x0 24
+addi tp tp -1
+bne tp x0 -8
+sub a5 s2 a0
+lhu a1 -1582(gp)
+mulh a3 t1 a5
+slt ra a0 s5
+mulh a5 s10 s6
+sra s9 t1 s10
+blt ra a3 4
+addi tp x0 6
+ori a1 s1 25
+lh t1 -1012(gp)
+srai a3 t3 5
+srl t0 s3 a4
+blt t3 s4 28
+div a5 s1 t5
+lh a7 -1798(gp)
+slti a4 t4 -956
+lw t4 -348(gp)
+sb s2 799(gp)
+slli t5 s6 24
+sw s11 -928(gp)
+sltu s9 a5 a7
+addi tp tp -1
+bne tp x0 -56
+ori s10 a3 -995
+auipc s5 0
+jalr a3 s5 28
+rem s7 s10 a6
+add t2 a0 t4
+bge a5 s7 12
+sh s0 -1258(gp)
+or s7 a2 ra
+addi tp x0 6
+lbu a5 -1949(gp)
+lui t2 659066
+remu ra t1 x0
+remu a2 x0 a6
+srai a6 t4 31
+ori t4 s6 -844
+addi tp tp -1
+bne tp x0 -28
+slt a1 a7 x0
+or s10 a5 s8
+beq t4 a2 64
+srli a3 s7 12
+mulhu x0 s1 s0
+addi s5 t5 -1228
+srai s8 a1 19
+divu s2 s4 a0
+lbu a0 868(gp)
+slli s4 t2 7
+or s8 s8 s6
+bne a3 s10 36
+srl t0 a0 t6
+slti t5 t0 -588
+lui t4 175928
+and t0 t6 s4
+or s1 t2 t2
+srli s1 s9 29
+sub t4 s2 a3
+remu s5 a6 t3
+auipc t5 700126
+or s7 a1 s0
+bltu s8 s8 24
+sra s0 a2 a4
+slt s2 s5 s0
+or t5 a7 ra
+ori a6 s9 781
+addi t5 a1 1113
+addi tp x0 5
+and a3 s1 t5
+lui s9 813064
+rem s11 s0 s11
+sw a5 -1092(gp)
+xor a5 a0 t2
+remu s4 s5 s8
+lh ra 1992(gp)
+sb t0 787(gp)
+lb s0 1822(gp)
+addi tp tp -1
+bne tp x0 -40
+jal s3 40
+jal a6 52
+auipc x0 861335
+lbu ra 752(gp)
+bgeu s7 t4 24
+mul a4 s10 t0
+lhu t5 898(gp)
+sw a3 756(gp)
+add s9 s6 a4
+lb t3 -1893(gp)
+lhu a0 302(gp)
+slt s4 s1 a0
+mul s6 x0 s10
+lbu s8 331(gp)
+addi tp x0 4
+sb t4 -951(gp)
+lb a1 1546(gp)
+mulhu t3 t5 t2
+sub s1 t1 a1
+lb s2 1153(gp)
+sb s8 -1632(gp)
+bge a6 s9 12
+sh s0 -652(gp)
+sb t0 -832(gp)
+lui s10 805331
+slli a4 a2 17
+lui s4 815952
+mulhu s11 s5 t5
+addi t2 a6 -1548
+addi tp tp -1
+bne tp x0 -60
+sra ra a0 a6
+slt s8 s1 a5
+mul a5 s5 s6
+srli s9 a1 1
+sltiu t3 a3 -957
+sltiu s4 s4 1802
+sltiu a0 s2 198
+lh s10 -478(gp)
+lui s3 320843
+slt s9 x0 s8
+sltiu s2 s6 -40
+mulhu a4 t0 a6
+sb s11 1248(gp)
+sltiu a6 a6 1073
+sh s7 1660(gp)
+blt s2 t6 4
+ori t0 t0 -769
+lbu s11 -132(gp)
+mul t2 s3 s3
+sb a7 -915(gp)
+sll t5 t0 a1
+beq t3 a4 48
+sb a5 4(gp)
+remu s11 s2 s5
+remu a0 a2 s3
+sra s10 a7 t5
+bltu t0 s5 48
+sll s9 a3 s7
+sltu a6 ra s7
+sh t0 1934(gp)
+slt a4 s2 s5
+sh s2 1648(gp)
+mul s11 a6 a5
+ori s3 s2 -498
+sb t6 188(gp)
+sltu a6 a4 a5
+mulhu s5 a4 s7
+or s7 t4 t0
+lh s10 -2012(gp)
+slli a7 s5 7
+sub t2 s1 a4
+slti a1 a4 -1916
+sltu s7 s6 s3
+sltiu t5 t3 -1837
+sw s3 -1764(gp)
+beq t5 s9 44
+sub s0 s10 t3
+sub ra a1 t6
+or s5 a5 s4
+sra t2 t3 t3
+bne ra a6 24
+lbu t0 1952(gp)
+blt ra s10 20
+sub s1 s11 s3
+addi t2 a1 1308
+sltiu s7 t6 -1133
+sb a1 -744(gp)
+addi tp x0 6
+bltu t4 t3 28
+srli s10 s9 2
+auipc s2 1011857
+bgeu s10 s0 64
+lhu a3 1726(gp)
+sub a2 s4 a4
+srai t0 a5 2
+xor s6 s7 a2
+div t0 s10 t4
+andi t3 t5 -735
+slli s4 s9 13
+mul t2 s3 a2
+sub s6 s6 t5
+lhu s0 -1462(gp)
+or t2 a5 s9
+addi tp tp -1
+bne tp x0 -64
+xori a4 s1 -169
+sub t5 t4 s1
+slli t2 t3 31
+lh s8 -522(gp)
+sb t5 -1881(gp)
+slt t5 s10 s5
+sra a6 s1 a7
+mulhu t6 a2 t4
+sh t6 1866(gp)
+slt s6 s8 s0
+xor s4 s8 s5
+ori a7 t6 613
+rem a7 s11 a6
+mul t5 s11 s11
+xor s4 s8 s9
+srai x0 s6 18
+lb s0 2031(gp)
+bne t1 a2 52
+mulhu a2 a0 a7
+sb t1 1786(gp)
+sltu t1 t0 x0
+bgeu s10 s6 4
+bne t4 s10 32
+mulhsu t2 a3 ra
+srli s5 s0 23
+bne s4 s1 20
+sra t6 s9 t3
+srai a0 s8 12
+sltiu s10 a0 -1836
+mulhu s9 s3 t3
+addi tp x0 7
+lh s4 1108(gp)
+srl s5 s6 a2
+addi tp tp -1
+bne tp x0 -12
+sub a6 s9 s11
+auipc t2 111650
+sltiu s10 t2 -1286
+rem s9 a5 s0
+lb s1 -648(gp)
+xori s6 a1 343
+and a4 s11 a7
+lw a5 948(gp)
+slli s4 t0 22
+addi tp x0 7
+remu a1 ra a5
+div a6 s10 s4
+sh ra -890(gp)
+bltu a1 s10 60
+srai a7 a5 6
+and a4 s7 a0
+slti s5 t4 1122
+xor a2 s4 a5
+bge ra s7 4
+bge s6 t2 8
+sll a6 t6 s8
+sw s8 -844(gp)
+sb s1 -1766(gp)
+mulhsu t0 t1 a7
+sll s4 s2 x0
+addi tp tp -1
+bne tp x0 -64
+sh t2 1568(gp)
+sra t2 s6 s11
+auipc x0 836791
+sb a7 1991(gp)
+divu a6 a1 s9
+or a7 a3 t5
+sub ra s1 t1
+bne a6 a7 48
+lui ra 219489
+addi tp x0 7
+sra t3 t5 a2
+lui s3 1015981
+addi tp tp -1
+bne tp x0 -12
+lhu t6 -890(gp)
+bgeu a1 t6 4
+xor t2 x0 a0
+srai s6 s6 20
+slt t2 s3 x0
+andi s3 s10 -1567
+srl s5 s5 t1
+sll a2 s5 s11
+lbu s9 1787(gp)
+srai s8 t3 31
+lui a6 321359
+xori a3 x0 -101
+srli a1 a3 9
+or s3 x0 a0
+andi s0 a0 -1273
+xori t6 s3 -834
+sll s1 s1 s11
+lui t6 778268
+xori a6 s7 -1295
+slli t1 a1 28
+sh a4 -1734(gp)
+mulhu t2 t3 t6
+add t6 s5 s5
+divu a7 s4 s5
+div s10 s0 t1
+slti s9 t3 -2041
+slt s3 a0 ra
+slti s0 t1 -346
+sub s4 a0 t0
+bgeu t5 s2 36
+xor t5 t2 s8
+lui t4 655761
+sra s11 s3 a1
+jal a5 20
+srli t3 a6 16
+remu a0 a6 a4
+sltiu t0 t2 1971
+lui a7 657066
+sltiu ra a7 -1610
+lw s6 -1364(gp)
+lhu a5 -1588(gp)
+mulh a0 s8 s5
+sltiu a5 s3 -1928
+blt t3 a1 16
+mulhsu t3 a0 t4
+xor s10 a5 s11
+sll a5 a3 s2
+slti t6 ra -436
+auipc s3 1026217
+add s0 s4 a4
+bge s1 x0 12
+sh x0 -1046(gp)
+slti a4 s3 -649
+addi tp x0 2
+sh s10 104(gp)
+lb a7 -841(gp)
+slt t1 s8 a2
+andi s8 x0 -1101
+slti t5 x0 1387
+slti s10 s9 -208
+srl s2 s4 ra
+bltu x0 t0 40
+slti a4 t3 391
+ori t4 s2 343
+addi tp tp -1
+bne tp x0 -44
+ori a6 t2 -1976
+add s0 a4 t6
+mul a7 a6 s5
+xori ra s3 1133
+divu s8 s6 t6
+beq a6 s2 60
+lh s6 -916(gp)
+mulhu t1 s2 a0
+lw s3 1120(gp)
+mulhu t1 t2 s2
+bge ra ra 48
+xori t1 a4 -1013
+rem s8 s7 s6
+addi tp x0 8
+mulhu t0 s4 s6
+sra s1 s3 s1
+slt s5 t2 t0
+addi tp tp -1
+bne tp x0 -16
+bne s7 a4 64
+bge s2 s3 64
+lw s2 -216(gp)
+slti a0 t3 2045
+lb a2 902(gp)
+ori t4 a7 -1501
+sra a1 s8 s1
+lb s8 -624(gp)
+sltu s9 t5 s4
+remu s7 s5 s4
+sh s8 1246(gp)
+sltu s0 a0 s5
+mulhsu a3 t3 ra
+bge s7 t3 16
+and s8 t2 a0
+sltiu t2 a0 -1143
+lhu s9 1482(gp)
+addi tp x0 7
+or t5 t6 s9
+sll a7 a7 s1
+beq t5 s11 28
+lb a3 -1893(gp)
+bgeu t1 s5 20
+addi t2 s11 -1897
+bgeu s6 s0 20
+srai x0 t2 9
+bge t3 a1 64
+blt s10 s5 32
+lb s11 -1981(gp)
+andi ra t6 1995
+lh t5 -666(gp)
+addi tp tp -1
+bne tp x0 -56
+mulhsu t5 s4 s10
+lbu a6 -1143(gp)
+xori t2 a7 -1983
+srai a5 t5 7
+lui t5 847836
+sw x0 -136(gp)
+sltu x0 a3 a4
+sb t1 400(gp)
+div s6 s10 a3
+add a2 a0 x0
+sb ra 1782(gp)
+slt a4 t1 a4
+lui a7 161590
+addi s0 t3 -1356
+lb x0 1693(gp)
+div t0 s11 s8
+mulhu a5 x0 s3
+lb a4 -1860(gp)
+mulh t5 s9 s0
+lh s3 1162(gp)
+sb a2 -89(gp)
+sub t5 s2 s1
+lhu t1 -1156(gp)
+mulhu t1 t6 t3
+mulh s11 s1 t5
+sh s8 -1920(gp)
+mulhu s8 a7 s6
+and t6 s9 s7
+rem x0 s11 t1
+beq x0 a7 20
+xor s5 a5 s11
+sb s10 868(gp)
+auipc s9 0
+jalr a0 s9 16
+lb s9 483(gp)
+bltu s4 x0 28
+sw t3 -776(gp)
+slli s1 t0 25
+sltu s5 s9 s2
+add s10 ra a7
+rem s2 a1 a6
+sb s6 -238(gp)
+addi tp x0 4
+addi a1 a0 -625
+slti a0 s7 -924
+sltiu s1 s3 -1158
+srl a3 t4 a6
+addi tp tp -1
+bne tp x0 -20
+or s4 s5 x0
+sra ra s0 s5
+bne a1 t1 12
+srai s7 a4 14
+sb s9 -1007(gp)
+lw s11 -360(gp)
+mulh s4 a1 a6
+remu a0 t3 s4
+bne x0 a1 4
+slli s9 a2 26
+addi s2 s1 -658
+addi s4 a6 798
+and a7 t3 s8
+sll s0 t4 s4
+beq s4 s6 4
+bltu x0 s5 28
+lw s11 -1872(gp)
+xori t1 a5 -1751
+sra a0 s8 t6
+sb s4 -774(gp)
+srai s7 x0 16
+srli t1 s7 5
+addi s10 ra -1063
+lh a5 -384(gp)
+ori s3 a2 -195
+mulh ra s10 t5
+mulhsu a3 a0 a3
+addi s11 s6 313
+blt t6 s10 36
+jal a7 56
+lhu a6 912(gp)
+sub t1 a1 s11
+sw t5 1324(gp)
+add a1 a4 s2
+sw a0 1480(gp)
+auipc a7 0
+jalr s8 a7 8
+sltu s3 s5 s7
+lw s2 -752(gp)
+sw s0 572(gp)
+sh a4 592(gp)
+sb s6 229(gp)
+sh t0 -1292(gp)
+addi tp x0 3
+bge s11 s6 56
+mul t1 s2 a6
+and s5 s0 t3
+ori ra s8 -1828
+lbu s0 190(gp)
+lb s0 -1102(gp)
+addi t5 s2 -677
+addi tp tp -1
+bne tp x0 -32
+mulh t0 a4 t4
+jal ra 12
+srl t5 s3 s2
+lw s3 24(gp)
+addi a4 a7 -1641
+addi tp x0 1
+rem s8 t5 t1
+addi x0 s5 -1933
+auipc s0 690737
+lbu a5 228(gp)
+srl s2 s0 s0
+sh s9 1424(gp)
+slli t6 s1 11
+auipc s0 397172
+lhu s11 -6(gp)
+ori t6 s3 1620
+remu a7 t3 a6
+lw a2 -1348(gp)
+divu t0 a2 a1
+srli a4 x0 5
+addi tp tp -1
+bne tp x0 -60
+sb s11 1395(gp)
+andi a2 t4 -291
+divu a6 t2 t5
+addi tp x0 4
+sw s6 1588(gp)
+or s2 s10 a2
+add x0 a4 s6
+slt a5 t3 a5
+lbu s6 1854(gp)
+rem a0 a7 a6
+rem s4 s8 a7
+andi s0 s8 1656
+andi a5 t6 -1258
+lui s10 585469
+lbu s9 930(gp)
+or s6 s11 s0
+sra s11 s2 t3
+andi s2 a6 -923
+slt a1 s11 a6
+addi tp tp -1
+bne tp x0 -64
+srl s2 a7 a4
+sw a2 -2044(gp)
+sub t2 s11 s5
+lw t2 -1696(gp)
+xori t1 a4 -1061
+and s4 s1 t3
+add a5 s5 ra
+lhu t5 652(gp)
+div s8 a0 s8
+sra t5 a0 s7
+beq s4 a3 4
+addi tp x0 8
+lh s11 -1016(gp)
+and t4 a5 s1
+sh t0 -1234(gp)
+sra s4 t6 s0
+slti t3 s4 -1867
+sub a3 a0 a4
+srli t6 s3 12
+slti s5 s4 -441
+divu a6 t0 a2
+addi tp tp -1
+bne tp x0 -40
+bgeu a3 s7 24
+srai t1 a3 15
+lbu s1 -626(gp)
+bltu t5 ra 48
+rem x0 s1 a5
+sub t4 s6 x0
+sb t5 1353(gp)
+slti a1 s6 -1251
+blt s5 s3 28
+sw s1 372(gp)
+slli s4 s6 12
+sll s5 s6 a0
+lb s0 -1840(gp)
+xori s3 a3 294
+lhu t4 1568(gp)
+mulhsu s9 ra a3
+addi tp x0 1
+add s0 a7 t6
+sb a6 -167(gp)
+div a4 s0 a6
+xor s6 a5 s3
+lbu a2 938(gp)
+ori s2 ra -1935
+jal s0 16
+lb a6 -1748(gp)
+slli ra x0 14
+divu ra s1 t3
+xori s6 s5 -560
+sb t4 665(gp)
+andi s11 s5 -1872
+sh a4 -714(gp)
+mulhu s2 s5 s10
+sw a7 1452(gp)
+addi tp tp -1
+bne tp x0 -68
+auipc t4 797972
+sb t1 -935(gp)
+sltu s4 a6 s0
+mulhu s5 a1 s9
+sltu a1 a1 s10
+sll s11 a6 t1
+lh s2 -1944(gp)
+lui s11 237383
+addi tp x0 4
+sra s11 a0 a2
+addi tp tp -1
+bne tp x0 -8
+slt a4 a2 s7
+sll s4 s7 s4
+auipc t1 34010
+lw s11 -868(gp)
+lb s2 41(gp)
+sw s5 68(gp)
+sh a7 1378(gp)
+sh a4 -1314(gp)
+slli t2 t3 0
+bge s5 s0 56
+srl t1 a3 a0
+srl t2 x0 a3
+bne s5 t5 4
+sltiu t2 s4 -1152
+sltiu s10 s6 0
+mulhu a1 t4 a4
+mulhsu t5 t5 a1
+mulh t2 t1 x0
+divu a4 t4 s1
+lw s8 -1412(gp)
+slti a6 a0 1546
+and a4 t3 a2
+beq s4 t1 36
+lbu s2 -1107(gp)
+lhu a6 1484(gp)
+bltu s1 s3 4
+xor a5 a7 t6
+srai a6 s8 21
+lh s1 -554(gp)
+slli a1 a3 4
+remu s11 s4 a3
+sltu ra t6 a6
+addi tp x0 7
+remu a4 s2 s8
+sb a2 306(gp)
+bge t6 s3 20
+sltu s3 x0 t1
+sb s3 -76(gp)
+lw t3 -720(gp)
+srli a5 t2 30
+sltu a0 t2 s7
+andi t0 a1 -1520
+or a6 s9 t5
+sub s9 s2 s3
+mulh t2 s6 a3
+div t4 s3 t3
+add t0 s10 s7
+slt a7 t2 t1
+addi tp tp -1
+bne tp x0 -64
+lb s6 337(gp)
+lui s0 931898
+lw t5 544(gp)
+srli s11 a4 31
+mulh a1 s11 s4
+mulh s8 s7 t5
+srl t5 s11 s11
+sb t1 -272(gp)
+lui t1 303718
+lbu a1 -237(gp)
+bne t5 s4 36
+auipc x0 996444
+bne s2 t0 52
+sb s2 1602(gp)
+lh a6 -140(gp)
+sw s0 1564(gp)
+srl s3 a6 t3
+slt a1 x0 x0
+sb a5 50(gp)
+srl a7 ra s3
+xor t1 a3 t4
+srli s2 s0 23
+sltu t6 s4 t4
+addi s0 s2 -1699
+sh t5 1906(gp)
+bltu s4 x0 24
+lb s9 -717(gp)
+srai a3 s4 25
+bne s4 s2 32
+lhu t4 -502(gp)
+lh s5 1214(gp)
+srai t6 t6 18
+jal t6 40
+sltiu t5 s8 -984
+sll s9 t5 s6
+lh s6 1234(gp)
+slt a6 a1 s9
+and a1 a2 s4
+remu a7 a4 a2
+ori s6 a4 -1914
+lh a3 1570(gp)
+sll s5 t6 s6
+lbu s7 218(gp)
+div t3 s2 a7
+slt t2 s2 s1
+divu s5 t4 a2
+lhu s9 1948(gp)
+sh a2 -1042(gp)
+sltu x0 s10 x0
+lb s6 721(gp)
+addi tp x0 3
+bgeu a3 a0 28
+sltu s10 a7 a7
+mulh x0 s2 a1
+div t0 s1 a6
+lbu t0 -1974(gp)
+bne t5 t1 16
+lbu s9 598(gp)
+addi tp tp -1
+bne tp x0 -32
+addi tp x0 6
+lh s6 -1796(gp)
+srl s9 s0 ra
+sltu s7 s6 s10
+sltiu s1 s7 -2041
+ori s6 s4 -931
+auipc t5 89477
+sh s2 674(gp)
+or s9 t1 a5
+xori s4 x0 1029
+blt s1 t2 52
+lw s7 -1976(gp)
+sh s5 1802(gp)
+xor t5 s10 a4
+slli a5 t1 20
+srli a5 s3 29
+addi tp tp -1
+bne tp x0 -64
+lbu s1 263(gp)
+ori s0 s3 -733
+sltiu s11 a1 -70
+add a7 s7 s3
+slti s5 s2 -331
+srai ra s5 14
+addi tp x0 8
+sltu a6 a2 a7
+or s10 a1 a0
+sltu s9 s1 a7
+lbu s3 303(gp)
+remu s1 ra s3
+lui s4 932011
+bge s0 s11 64
+sw s11 164(gp)
+sh s9 -434(gp)
+lw s11 736(gp)
+or t3 t4 s8
+slti a3 s2 -553
+slli s8 a4 5
+addi tp tp -1
+bne tp x0 -56
+lb s2 -223(gp)
+bne a5 s0 48
+sb t4 764(gp)
+slti s10 a4 1207
+sra a7 s7 t4
+sltu t5 s2 s8
+mul s10 s10 a4
+addi tp x0 7
+bge s0 t1 32
+sra s10 a5 s11
+auipc t0 641324
+addi tp tp -1
+bne tp x0 -16
+add s4 s3 s0
+sb s3 -1013(gp)
+lh a0 -1772(gp)
+lui s10 69314
+slt a0 t2 s5
+andi s6 s10 443
+sltiu a3 t5 -1582
+rem s0 s4 ra
+remu s11 a6 s11
+auipc a1 673478
+bge t4 t1 4
+sltu t4 t4 a7
+sltiu a3 t1 -649
+sll s10 t6 s0
+lb x0 1740(gp)
+lui ra 814663
+and s0 s4 t3
+lw s3 -332(gp)
+slt x0 a6 a0
+addi s3 t6 -96
+div s5 a6 s10
+lb a7 1028(gp)
+mulh t6 s1 ra
+sb a4 -52(gp)
+lhu t4 1680(gp)
+addi tp x0 3
+bge s1 t2 36
+ori s1 t6 -1413
+lh s4 -1102(gp)
+auipc x0 715228
+sub t1 a6 s1
+sb a1 1605(gp)
+add t5 t3 t1
+sltiu s7 s6 -1107
+lbu a4 678(gp)
+srl s0 s3 a6
+sb s1 68(gp)
+srli s2 s1 30
+div s8 t1 s11
+addi tp tp -1
+bne tp x0 -56
+lbu s11 687(gp)
+sll s7 s2 s0
+sll t0 ra x0
+mulh t0 s10 t2
+or s9 s5 s9
+sltiu s7 t1 281
+sh s10 -864(gp)
+div s1 s5 t5
+addi tp x0 6
+srai s10 s7 29
+lw x0 -16(gp)
+and a4 s10 s6
+mulhu a3 a3 s4
+or x0 a7 s2
+srai s10 x0 25
+sltu t3 ra t6
+sb s4 917(gp)
+auipc a6 768422
+srli s0 s1 2
+sh a1 136(gp)
+and s11 t3 s2
+addi t0 a5 -1257
+and a5 a0 a7
+addi tp tp -1
+bne tp x0 -60
+lbu s3 -1406(gp)
+auipc a6 1024233
+remu a0 s9 a2
+lb x0 1448(gp)
+mulh t0 s0 s6
+sb s7 660(gp)
+sh a6 -464(gp)
+sh x0 -1206(gp)
+or a4 a4 a7
+sw a4 -1564(gp)
+sub a4 s0 t5
+sb t3 -813(gp)
+or a2 t6 t6
+mulhsu t0 s5 s1
+blt a1 ra 20
+addi t6 ra -449
+sb a5 1555(gp)
+rem s9 t4 t1
+sb s6 -578(gp)
+addi tp x0 6
+srai s10 s11 17
+sra s0 s7 s8
+sb a0 1658(gp)
+slti a1 s3 -2043
+lb s7 -432(gp)
+sra t6 a6 a2
+slt s0 a1 s2
+lhu s9 -1596(gp)
+bltu a3 a3 32
+sh ra -1076(gp)
+addi tp tp -1
+bne tp x0 -44
+lb ra -1517(gp)
+slti a7 t0 93
+sra s7 t4 t1
+rem a4 a2 s6
+bgeu ra s8 20
+lbu s9 778(gp)
+sll s8 s9 x0
+auipc s11 991486
+sll a2 s10 s9
+addi tp x0 1
+addi a7 t1 -1024
+sra t2 a1 s2
+and t4 s2 s0
+and s0 t2 t5
+and a2 a3 s8
+bge t3 a7 16
+mulhu a6 s6 s11
+bge a7 s0 20
+lw a0 -1856(gp)
+bltu a3 t5 40
+or x0 a7 t1
+auipc ra 338900
+sub s1 s10 s7
+div s6 s6 s10
+sltiu s9 s1 339
+mulh s9 s10 s4
+addi tp tp -1
+bne tp x0 -68
+xori a6 s0 -1831
+addi tp x0 3
+jal t5 36
+sub t3 s1 a5
+slli t3 s8 6
+lw a5 -1264(gp)
+xor a5 ra x0
+bge s9 t3 52
+xor a2 x0 s10
+sltu t3 t2 a7
+ori s3 a6 -909
+mulhu a7 s4 s3
+bne s10 s9 44
+ori t1 t3 -183
+auipc ra 513901
+divu s9 s0 a7
+addi x0 x0 -1854
+addi tp tp -1
+bne tp x0 -64
+slli a7 s8 24
+xor a5 t6 a6
+srli s4 s3 26
+sb a4 72(gp)
+xori s10 t6 -418
+srl s0 s9 a0
+sb t1 -1752(gp)
+mul a7 a3 a0
+divu s0 a4 a4
+sh t6 -1696(gp)
+slti s8 t5 -1335
+mulhsu x0 a4 a4
+lb s11 -22(gp)
+ori t0 s11 -1268
+lhu ra -1286(gp)
+lh a5 1322(gp)
+divu ra s8 a4
+addi tp x0 3
+sltiu t3 s0 -713
+sltu a4 s11 t3
+lb s6 -433(gp)
+slt s7 t5 t5
+sub a1 a7 s4
+and s3 t6 a3
+srli s7 t1 20
+srl s5 a5 ra
+xori a6 s5 -1547
+sltiu s11 a4 -1363
+lui s5 359598
+srai a3 s3 16
+bne s10 a2 4
+mulhsu a3 a7 a7
+rem t0 s9 s8
+addi tp tp -1
+bne tp x0 -64
+sb s11 -64(gp)
+srl a4 a5 s2
+lh t1 -248(gp)
+srli a0 a0 17
+lh s5 -1526(gp)
+sw t1 -1596(gp)
+rem t4 t4 s5
+mul s9 s2 s5
+lhu a7 48(gp)
+sub x0 s8 s9
+slti s6 ra 964
+mul s8 s2 a0
+lw x0 816(gp)
+lhu t4 260(gp)
+lhu a6 -774(gp)
+sltu ra a0 s4
+sltiu t5 t6 -1238
+addi tp x0 6
+auipc s10 0
+jalr t1 s10 44
+sw s6 1100(gp)
+auipc t2 486486
+lw a1 -2028(gp)
+lb s3 906(gp)
+mul s8 s1 s3
+andi a0 s2 274
+lb x0 -1549(gp)
+mulhu t1 s11 a4
+slt s1 a6 t4
+sh s9 116(gp)
+lbu a4 -1092(gp)
+xori a1 a4 1805
+div a1 s6 a6
+addi tp tp -1
+bne tp x0 -64
+srai s8 t1 13
+jal s0 12
+xori t5 s6 -1568
+sub t2 ra x0
+addi t0 a7 -615
+and t6 a2 a5
+lhu ra 1540(gp)
+lui ra 403405
+sltu a7 a6 a3
+xori x0 s9 -1331
+sb a1 -1743(gp)
+add a0 a3 s6
+lb s10 -12(gp)
+addi a4 s7 417
+lw s7 176(gp)
+srai t1 t5 24
+blt s7 a4 40
+sw a5 -32(gp)
+addi tp x0 1
+auipc s10 155635
+auipc t4 60772
+lbu s8 1629(gp)
+or t3 a5 t5
+addi tp tp -1
+bne tp x0 -20
+lhu s8 -678(gp)
+slli s0 s10 25
+jal x0 24
+sh s9 1920(gp)
+sw s2 444(gp)
+blt s2 t1 56
+and a1 s10 t1
+addi a7 a6 -1237
+bne a2 t4 44
+xor ra a0 a5
+lw s1 -228(gp)
+srl s0 s4 s0
+and a0 s0 a1
+srai a0 s10 4
+andi t2 s5 -969
+rem s4 t2 s9
+lh s11 -1624(gp)
+slt s0 ra t6
+sb s7 -1667(gp)
+addi tp x0 3
+sb t3 -1623(gp)
+mulhsu s2 t3 t2
+addi tp tp -1
+bne tp x0 -12
+rem s7 t0 s6
+sh a3 -108(gp)
+lw s8 228(gp)
+addi tp x0 5
+xori s1 t5 -1009
+xor s5 t2 s0
+beq t6 t2 64
+lui t1 836761
+andi s7 ra -1260
+sltu s11 s8 t2
+ori s1 a2 -1857
+lh t1 1652(gp)
+and x0 s4 t2
+mulhu s4 a5 t2
+addi tp tp -1
+bne tp x0 -44
+addi tp x0 7
+xori t1 s2 1199
+addi tp tp -1
+bne tp x0 -8
+sub t3 s9 a0
+sb t1 -340(gp)
+lw t5 20(gp)
+slli a3 s9 17
+blt a2 a4 44
+bltu ra a7 48
+addi tp x0 1
+or s4 a0 t6
+mulhsu a3 s0 a5
+bne t0 a1 48
+addi tp tp -1
+bne tp x0 -16
+lb s10 187(gp)
+slti t6 s0 -389
+div s1 s10 a3
+andi a6 s0 -1338
+sh t6 1312(gp)
+div s8 s3 s7
+lui t0 891678
+lw s5 1172(gp)
+mulh ra a5 s3
+add t1 a6 s9
+sh a3 414(gp)
+bne t6 t5 16
+ori t5 a4 -286
+rem s11 a6 x0
+sll s5 a0 a2
+addi tp x0 3
+mulh t4 x0 s0
+div a5 a7 s6
+add s7 s3 t0
+mul s6 a2 x0
+xor s1 a5 a2
+mulh a6 t3 x0
+sll t4 a7 s0
+lhu t2 -704(gp)
+lw s1 -796(gp)
+sub t3 s3 t6
+sra t2 s3 a5
+blt ra a0 36
+xor a7 s7 a2
+remu t4 t0 t5
+divu a1 a5 a4
+sw a0 1576(gp)
+addi tp tp -1
+bne tp x0 -68
+lhu a4 -1210(gp)
+sub ra t6 s3
+srli t3 s5 30
+srai s6 a0 26
+lb t6 1821(gp)
+addi a3 s2 -906
+blt s9 ra 24
+sw t3 -316(gp)
+sub s5 a0 ra
+bge t4 s1 48
+sra t5 a6 s10
+rem s11 a1 a0
+addi tp x0 1
+bltu t2 t2 24
+addi tp tp -1
+bne tp x0 -8
+remu s9 t2 t0
+lh t5 -530(gp)
+slli t2 s10 16
+div a2 a0 t1
+ori t6 t6 795
+lw s8 -356(gp)
+mulh s7 a3 a7
+srl s0 s6 s2
+slli a5 s3 15
+srl t2 s3 t3
+auipc s5 0
+jalr s11 s5 8
+sw a5 -1952(gp)
+sh t2 -1122(gp)
+sb s4 592(gp)
+xor x0 ra t0
+slli s5 t2 1
+jal a1 48
+mulh s5 s11 a4
+lbu s11 1288(gp)
+sll s6 a6 s9
+mulhu t0 s5 s5
+sra s10 t3 a2
+lw t6 184(gp)
+remu t6 t3 x0
+lb a1 -1715(gp)
+slli t0 s0 18
+lh a0 -1412(gp)
+sltiu a4 t6 1138
+mulh s9 s11 a7
+srli t5 a3 23
+lhu a3 890(gp)
+addi tp x0 5
+lui t1 330786
+xori a2 s6 -441
+sra a2 s3 a7
+xor t0 a3 a6
+lh s9 1572(gp)
+addi s0 x0 -1697
+divu s4 a3 a7
+andi s5 s9 -65
+slli s5 s1 21
+addi tp tp -1
+bne tp x0 -40
+sra t6 a0 a1
+add t1 s6 s2
+sltu s6 t2 a2
+lhu s8 1150(gp)
+mul x0 x0 s3
+sra s4 s3 s9
+lh a7 1846(gp)
+sll t4 s7 t2
+auipc a2 825271
+mulh s11 x0 s0
+sll s7 s9 x0
+sltiu a7 a3 -681
+addi s11 t5 -222
+lhu s9 964(gp)
+or t4 s6 a7
+addi tp x0 3
+ori a7 s7 1926
+add t6 s3 s0
+bgeu s3 t5 36
+addi tp tp -1
+bne tp x0 -16
+lbu t0 -1512(gp)
+beq s1 t1 20
+sub a4 s10 s9
+lb a3 29(gp)
+sra t1 s9 a0
+divu s5 x0 t6
+addi tp x0 6
+sub t0 s8 s1
+bge s5 t3 48
+lw a5 -760(gp)
+sltu a4 t0 t4
+xor a4 a0 s1
+mulh t4 s9 s10
+srai a2 s4 31
+xor a7 t5 s5
+rem t4 s7 s8
+sh a6 1670(gp)
+addi tp tp -1
+bne tp x0 -44
+slti a0 a6 -1784
+slti a3 s4 -535
+mulhu s7 t4 s6
+sltiu a4 a5 850
+sll s6 t1 s2
+slti s7 x0 1385
+divu t6 ra a2
+rem s5 t1 s1
+mulh s8 s9 a5
+or t4 a0 s3
+sh a1 1314(gp)
+bge a7 a4 12
+lh a0 -1498(gp)
+mulhu a6 a2 s4
+xori s11 ra 1676
+addi tp x0 7
+blt a0 a3 52
+lw a2 1496(gp)
+mul t1 s3 x0
+mul s3 a4 t2
+sub s2 s5 t3
+sw s9 1844(gp)
+bne a2 s6 4
+add a2 t1 s2
+sw s9 -1180(gp)
+or a1 t4 s10
+lh a0 1588(gp)
+lbu a4 -120(gp)
+andi s10 a6 74
+lh t6 400(gp)
+sb s2 1734(gp)
+addi tp tp -1
+bne tp x0 -64
+lhu s7 1898(gp)
+sra t0 t1 s0
+slti s10 s4 532
+bgeu a5 a7 16
+srai s9 s3 4
+mulhu t6 s11 t3
+mulhsu a6 t5 s8
+sltu t4 a0 t4
+mulh s2 s10 a6
+sh t3 1200(gp)
+sra s2 s6 t5
+lhu a4 -316(gp)
+sh a0 -586(gp)
+mulhu a3 ra a4
+xori t5 s9 -339
+addi tp x0 8
+mulh s7 t3 t3
+lbu a4 577(gp)
+addi a4 s11 847
+beq t2 s9 36
+mul s8 a0 a1
+auipc s5 993854
+addi tp tp -1
+bne tp x0 -28
+sh s11 1954(gp)
+lh s0 512(gp)
+mul a0 s0 t1
+mulhsu s5 s7 a6
+addi tp x0 6
+bge s3 a1 40
+mul t3 s6 s10
+sh s3 -148(gp)
+xori s3 t0 -758
+sltiu t6 s8 1390
+and s2 a4 a6
+lhu t0 520(gp)
+remu t2 s8 t3
+bgeu s9 a7 24
+xor t1 s3 s10
+rem x0 ra t5
+rem s11 a6 a7
+addi tp tp -1
+bne tp x0 -52
+mul t2 s0 t5
+sh s2 -1682(gp)
+srli a0 x0 22
+mul s5 t2 s0
+sra a5 t1 s3
+lui ra 661829
+srl s8 a0 t6
+lw s0 -1580(gp)
+slti s4 a5 -1153
+or s9 a4 t5
+addi tp x0 3
+lui s6 1041847
+lui ra 248666
+lh t4 2030(gp)
+xori s7 s3 -437
+sltu s5 t2 t4
+addi tp tp -1
+bne tp x0 -24
+xori a1 t6 390
+sll s6 a7 a4
+mulhsu t5 ra s10
+sll s7 s3 t3
+xor x0 t2 a0
+sltiu t0 t5 -424
+lh a3 432(gp)
+addi tp x0 3
+lbu s8 -468(gp)
+sra s11 a2 s8
+add a3 t6 s6
+sltiu a5 t4 -1599
+xor s3 s8 t1
+sh s5 626(gp)
+sub s0 s8 s8
+mul t1 s2 s9
+lbu s7 -1516(gp)
+addi tp tp -1
+bne tp x0 -40
+bltu t0 s9 60
+slli t1 s5 31
+ori a5 s6 607
+mulhu ra a7 a6
+mulhsu t5 t5 s1
+sh t6 568(gp)
+srai s11 s9 4
+lhu t3 -314(gp)
+and t4 a6 a7
+mulhu t3 s6 s6
+lbu s6 438(gp)
+sb s1 -795(gp)
+lb s10 1107(gp)
+rem s4 t1 a7
+sra s5 t3 s5
+slli x0 a2 25
+bge s1 a3 12
+addi a1 t2 -535
+lui s6 466232
+addi tp x0 7
+bge a0 s3 16
+lbu t2 -590(gp)
+slli a0 a3 8
+add t6 t3 s3
+lw a4 676(gp)
+slt a2 s8 s6
+lh a6 1556(gp)
+sltiu s6 ra 1018
+andi a1 s2 -1693
+bne a5 s11 44
+sltu t0 s6 s8
+sw t1 -1256(gp)
+srai s4 t4 28
+addi tp tp -1
+bne tp x0 -56
+beq s9 t0 28
+mulh s5 t4 s2
+lhu t6 -1320(gp)
+ori s10 s0 1072
+remu t0 t0 a7
+xori s5 s0 973
+srli a0 a5 17
+sltu s11 s11 t6
+auipc s6 52110
+and a2 a6 x0
+bne s8 s0 40
+sltiu t2 t5 -1461
+add s5 s6 s5
+remu s3 t4 t1
+bge s5 ra 40
+auipc t6 273920
+rem a5 a6 x0
+add s2 t0 a1
+add t0 t1 a3
+slli s10 t3 21
+lh s8 -1508(gp)
+andi t6 s0 -1572
+sw s3 -1924(gp)
+lb t3 -1593(gp)
+lb t3 883(gp)
+sb s10 -217(gp)
+jal s7 40
+addi tp x0 5
+lb s4 -1875(gp)
+blt t1 t5 24
+lh s7 -878(gp)
+addi tp tp -1
+bne tp x0 -16
+auipc t2 876154
+mul t2 a6 a4
+sb a0 -1589(gp)
+divu a2 s4 t6
+sb s7 -231(gp)
+lh a3 810(gp)
+slli t0 a2 31
+divu s7 t5 t1
+lui s7 527235
+srai a0 s4 17
+add s1 a4 ra
+slti s2 a6 -655
+sll t0 a3 t0
+bltu a6 x0 8
+xor a7 t1 a5
+addi tp x0 1
+sll s7 s11 s1
+sub s7 t2 a4
+add x0 a6 t1
+slt a7 s1 a7
+lw a4 -1824(gp)
+mulhsu s7 a2 a5
+sll t6 t4 s8
+srli a1 t1 23
+sb a2 -633(gp)
+mul a6 s0 a0
+div ra s5 ra
+jal s6 4
+auipc a6 376087
+sltiu s9 t6 -548
+addi tp tp -1
+bne tp x0 -60
+srl a3 s9 t3
+bge s9 a7 20
+jal s3 16
+jal s7 12
+andi a1 a5 -534
+bltu a5 a7 4
+addi tp x0 3
+sb s10 1622(gp)
+xor s9 s2 s4
+blt t2 a5 24
+or a2 s6 s3
+slli s10 s3 5
+ori a4 s6 -369
+or s4 a1 t5
+mulh t3 t0 ra
+ori a5 t6 -1116
+srl s11 t2 a7
+mulhu a2 s3 x0
+and t4 s10 s6
+addi tp tp -1
+bne tp x0 -52
+mulh a2 s2 ra
+mulhsu a0 s10 s0
+sw a4 -168(gp)
+xor t6 t0 s0
+sh t4 -1974(gp)
+srli s3 s0 27
+sltu s2 s5 a5
+sw a5 1180(gp)
+srai s5 s4 25
+mulh t5 a3 a0
+lui s11 772807
+or a0 a6 t6
+or a0 t6 a1
+slti a4 x0 -1662
+lh t0 592(gp)
+mulhu s11 s10 t1
+auipc s9 451431
+auipc a6 97165
+bltu s10 a4 16
+sra t3 s6 ra
+mul s2 s10 s10
+lb s4 -1529(gp)
+srli s6 s5 2
+lw s10 -1948(gp)
+sh a1 -1592(gp)
+slti s7 a1 -965
+lhu s7 -1882(gp)
+srai a2 s9 29
+sll ra s4 a2
+or s8 a6 s9
+bne s4 x0 12
+lh a3 1246(gp)
+divu a1 t4 a1
+div a1 s4 s1
+ori s10 s4 789
+mulh a0 x0 ra
+mulh t6 s11 x0
+sll s10 s6 s10
+sw t2 -1976(gp)
+lb t6 371(gp)
+xori a1 a7 -1683
+slt t4 s8 s7
+slli s2 s0 3
+blt a7 s10 20
+lb s6 -136(gp)
+or ra s0 s4
+lh s5 1534(gp)
+srl s6 s6 a3
+addi tp x0 8
+lh a0 1246(gp)
+lbu s1 847(gp)
+srl a0 a2 a5
+sub s0 s11 s1
+bltu s1 a1 36
+mul a0 t4 s6
+sra a6 t5 s5
+srl t6 s9 s6
+auipc t0 739414
+mulhsu t0 a6 a2
+addi tp tp -1
+bne tp x0 -44
+div t6 ra s2
+lw t3 -472(gp)
+addi a0 x0 10
+ecall
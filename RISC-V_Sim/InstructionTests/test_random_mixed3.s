@@ -0,0 +1,1036 @@
+addi x0 x0 0
+addi ra x0 1
+addi sp x0 2
+addi gp x0 3
+addi tp x0 4
+addi t0 x0 5
+addi t1 x0 6
+addi t2 x0 7
+addi s0 x0 8
+addi s1 x0 9
+addi a0 x0 10
+addi a1 x0 11
+addi a2 x0 12
+addi a3 x0 13
+addi a4 x0 14
+addi a5 x0 15
+addi a6 x0 16
+addi a7 x0 17
+addi s2 x0 18
+addi s3 x0 19
+addi s4 x0 20
+addi s5 x0 21
+addi s6 x0 22
+addi s7 x0 23
+addi s8 x0 24
+addi s9 x0 25
+addi s10 x0 26
+addi s11 x0 27
+addi t3 x0 28
+addi t4 x0 29
+addi t5 x0 30
+addi t6 x0 31
+lui gp 1
+addi gp gp -2048
+lw s1 -1460(gp)
+mulhu s1 t6 s9
+lh a7 -496(gp)
+sw s9 956(gp)
+sh a6 -972(gp)
+remu a1 s2 t2
+addi tp x0 1
+lhu s6 260(gp)
+rem s0 t5 s9
+bgeu a7 s0 52
+sltu t5 t0 a1
+slli s7 t0 16
+sb a3 -1403(gp)
+and s3 s4 s11
+lui a0 616828
+addi tp tp -1
+bne tp x0 -36
+lh s10 -56(gp)
+or a5 s7 a3
+sltu t6 s1 t6
+sh a0 -1406(gp)
+sb s5 1111(gp)
+addi s8 t2 -1237
+sub t2 a6 a4
+ori s11 s0 -874
+bgeu t2 s10 60
+sw s2 1312(gp)
+sll s5 s4 s1
+sh s10 1792(gp)
+sw s11 -376(gp)
+lbu s0 -996(gp)
+sb t4 -901(gp)
+addi tp x0 8
+and t3 s3 a7
+sll t2 s8 a0
+lh t0 -1244(gp)
+bge t1 s4 16
+addi tp tp -1
+bne tp x0 -20
+lw s9 -1088(gp)
+auipc s4 86897
+sb t2 1156(gp)
+sw a6 -168(gp)
+sb s1 216(gp)
+lh s4 1500(gp)
+addi a0 a3 -1136
+sh a7 1002(gp)
+slt a0 s5 s3
+sltu a7 t6 x0
+mulhsu t3 s4 a2
+and a7 a5 x0
+div a6 t4 ra
+sw s2 -1344(gp)
+lbu a3 1905(gp)
+srl t6 s5 a7
+lw t4 600(gp)
+xor s7 a6 t6
+remu s4 a6 t2
+remu t4 s4 t1
+sw s0 -260(gp)
+add t4 s4 s5
+mulhsu s1 x0 a6
+lh x0 1416(gp)
+sh x0 1284(gp)
+sw s3 188(gp)
+mulh s11 s7 t2
+lb x0 -1744(gp)
+sh s1 870(gp)
+lbu s5 -1655(gp)
+bne s8 s11 4
+sh s9 122(gp)
+sb t0 1330(gp)
+sltu s4 t3 s8
+mulh s9 s1 s4
+lb x0 -303(gp)
+sltiu t4 t5 -271
+sw a5 -1768(gp)
+lw s2 -560(gp)
+sub s3 a7 a3
+srl s2 t5 s4
+sh a0 -874(gp)
+mul s3 s1 t0
+lbu a2 678(gp)
+sltu t3 s1 s4
+sh s3 -826(gp)
+sw s11 -1736(gp)
+srai a2 a6 22
+and s0 t5 s1
+srai a7 a0 10
+lhu s5 1650(gp)
+sw a5 -592(gp)
+sh s4 -1148(gp)
+lhu t5 -78(gp)
+sw s11 1764(gp)
+srli t4 s0 26
+slti t1 s4 -1984
+lb s5 122(gp)
+slli a0 t4 9
+xor s8 a7 t1
+lw a7 1412(gp)
+lhu t5 2038(gp)
+sub a2 x0 a4
+sh s3 102(gp)
+add s9 a5 t3
+bltu t2 a2 24
+lb a1 233(gp)
+lb a4 1128(gp)
+sra a1 s3 t3
+slti s6 a2 -1839
+blt a2 a0 32
+sb s9 -163(gp)
+sb t2 -732(gp)
+sw t1 -420(gp)
+lb s7 -1322(gp)
+sltu x0 t5 a3
+mulh s11 a2 s2
+bgeu s5 a1 32
+sh s10 1098(gp)
+add t0 t6 t2
+lh a2 636(gp)
+or a6 s4 t2
+addi s8 s5 -717
+xori s11 t0 305
+lui a0 580821
+sw a0 1324(gp)
+mulhsu t4 s11 t6
+sltu s2 s0 s0
+lh t4 934(gp)
+sw a2 -1428(gp)
+remu s8 s0 s6
+or a1 s1 a3
+sw a3 1508(gp)
+mulhu x0 s6 a4
+sh s8 1792(gp)
+sll t1 a5 t6
+sw s9 -1568(gp)
+lb s6 258(gp)
+lb a4 57(gp)
+and s2 t0 s8
+lh s10 240(gp)
+sb t0 456(gp)
+sll x0 a1 t2
+lb a3 199(gp)
+rem a1 t3 a6
+mulhsu a6 x0 s10
+mul s1 s0 a4
+sh a4 14(gp)
+sltu s11 a3 s5
+mulhu s8 s1 a0
+sltiu t1 a4 -277
+remu a4 a6 s5
+div t4 a7 t2
+sb s11 -1393(gp)
+sb t2 -1019(gp)
+srli t4 s0 20
+sb t4 -915(gp)
+sh t3 346(gp)
+mulhu s5 t0 s10
+lw s11 1420(gp)
+lhu a0 -1898(gp)
+slli s1 t3 9
+sltu s2 s6 s0
+lw s0 -732(gp)
+lh s2 -1354(gp)
+jal s9 32
+slt t3 s0 t5
+jal a1 24
+sw s7 -1340(gp)
+sb s10 1159(gp)
+sh s4 -944(gp)
+mulhsu s11 x0 s4
+lhu a6 -716(gp)
+lw a2 -680(gp)
+lh a1 -968(gp)
+and a2 x0 t6
+bgeu t1 s1 40
+rem s9 t6 s0
+sb s2 730(gp)
+lh x0 1116(gp)
+lh s0 1324(gp)
+lhu s10 960(gp)
+bne a5 s2 36
+lh ra -522(gp)
+sh s4 64(gp)
+addi ra a2 1316
+jal t1 48
+sll a2 a3 x0
+lw s9 1356(gp)
+slti a1 s1 280
+add a5 s1 a1
+sw a1 300(gp)
+lui s11 137272
+lhu a7 -1034(gp)
+mulh t2 t6 t6
+lh s4 -1526(gp)
+lb s10 -1785(gp)
+andi a1 a6 2038
+lb s2 227(gp)
+div s4 s7 ra
+sw s1 36(gp)
+sw a3 -152(gp)
+sb s1 -2038(gp)
+srl a1 s3 t2
+sra t5 a7 s0
+sh s5 176(gp)
+sb a4 -1878(gp)
+mul a0 a7 s7
+bltu x0 t3 44
+sb s1 1822(gp)
+sltiu a4 s4 -1686
+sh t6 -484(gp)
+sh t6 -1614(gp)
+lh a2 -1484(gp)
+andi a7 t3 1938
+ori a3 x0 741
+lb a1 -442(gp)
+bge t2 t4 28
+sb ra -333(gp)
+bgeu a5 x0 20
+lb s0 471(gp)
+lh s0 376(gp)
+sltiu a3 t2 -94
+rem t2 t3 s4
+addi tp x0 8
+div a6 s3 a1
+bge a4 s9 32
+and a5 a7 t5
+lhu s0 -1754(gp)
+sub a0 t4 a4
+and a5 s9 s6
+divu a4 t0 s7
+lw a3 868(gp)
+sll t3 a5 s3
+and t6 s4 s8
+sw s3 -200(gp)
+addi tp tp -1
+bne tp x0 -48
+sw s6 160(gp)
+sb a3 1901(gp)
+sw t3 332(gp)
+lbu s3 715(gp)
+slli s3 s5 4
+lb s0 1295(gp)
+lbu s7 -1924(gp)
+slti s7 a1 -56
+lw a7 436(gp)
+add s2 a5 a5
+sw s8 620(gp)
+srai a3 a7 1
+sb s10 648(gp)
+lw s7 -376(gp)
+sb s9 384(gp)
+lw t2 1896(gp)
+lw s11 1212(gp)
+ori a0 a5 -1052
+auipc s1 0
+jalr s3 s1 24
+slt s5 t6 a2
+lb a0 1626(gp)
+sw s4 -60(gp)
+remu s6 t3 a4
+sb s3 -1065(gp)
+bne t0 s8 24
+divu t6 a3 s1
+sb t6 1978(gp)
+lw s9 -1048(gp)
+sb a3 558(gp)
+lb ra 1823(gp)
+auipc s2 193600
+slti t5 s6 1732
+sw a3 -924(gp)
+mulh s11 s0 a7
+lhu a4 1582(gp)
+sw s0 1204(gp)
+or a0 a7 s2
+sra s7 s2 a6
+sh ra 782(gp)
+sw a2 -1360(gp)
+sb s5 1447(gp)
+sw s5 -1376(gp)
+srai x0 x0 16
+lb s0 -92(gp)
+bge a5 s1 8
+or s8 s4 s6
+sw s2 2020(gp)
+sh a3 94(gp)
+lw a4 856(gp)
+beq t5 x0 8
+slli t2 t1 4
+mulhsu a6 s3 t2
+add t2 a5 x0
+lh s0 -1564(gp)
+slli a6 s2 22
+sltiu a3 s6 728
+lw t4 -128(gp)
+divu s9 t2 s1
+sh s4 -292(gp)
+sltu a5 a2 t3
+lbu s7 1813(gp)
+remu ra t4 s0
+blt a5 s7 44
+slli s9 s10 23
+addi tp x0 1
+blt s3 s0 36
+sh s2 -1146(gp)
+slli s7 s7 7
+xori s6 s5 26
+sh a2 1632(gp)
+sub s2 s10 s4
+addi tp tp -1
+bne tp x0 -28
+sb s4 -1569(gp)
+lbu s8 -756(gp)
+sw t1 1124(gp)
+sh s7 -1030(gp)
+and a5 t0 t4
+mul a7 s3 s9
+addi s9 t0 -384
+addi tp x0 7
+lw a7 -144(gp)
+sra t4 a2 s10
+lh t3 -500(gp)
+sll s9 s5 t3
+ori t6 s11 -32
+sw s1 1240(gp)
+rem s2 s8 s0
+div t4 s5 t2
+lbu s6 -1148(gp)
+bltu s5 s4 8
+sb a2 1261(gp)
+lhu s2 1496(gp)
+slti x0 a1 441
+addi tp tp -1
+bne tp x0 -56
+sb s2 780(gp)
+lb t1 421(gp)
+sb a5 -575(gp)
+sh t4 228(gp)
+bltu s1 t4 44
+sw a4 -480(gp)
+add s3 s4 s5
+lh a2 1254(gp)
+div t1 s4 s11
+remu a7 s10 s8
+lhu t6 -1094(gp)
+add a4 t3 a2
+sh s3 -1288(gp)
+sb s9 -1668(gp)
+sb ra -1533(gp)
+divu t2 t4 a7
+lui s5 285978
+sh a2 -1428(gp)
+slti s10 s9 557
+sb s10 1171(gp)
+sw t1 -260(gp)
+div s1 a4 a2
+sh t1 120(gp)
+sra s11 s4 s11
+sb t4 761(gp)
+sh t4 -834(gp)
+addi tp x0 7
+srai a5 a2 22
+divu s4 a1 a1
+lw a7 1412(gp)
+lw a5 1288(gp)
+lb t5 -1910(gp)
+ori a3 s8 67
+bgeu s2 a1 28
+addi tp tp -1
+bne tp x0 -32
+lw t5 -1756(gp)
+and t3 ra a0
+sw t1 880(gp)
+rem s1 t0 s7
+sh ra -488(gp)
+lw t4 -344(gp)
+slt t5 t6 a2
+sltiu s10 t1 -1294
+addi tp x0 6
+andi t4 a1 -1169
+sw s6 400(gp)
+lhu a3 -676(gp)
+srl a4 s7 s9
+divu a0 s3 s10
+remu s0 a4 s0
+mulhu s3 x0 a1
+lb s11 -1673(gp)
+auipc s9 950752
+sh ra 534(gp)
+mulh a1 s1 s4
+lbu s11 770(gp)
+bne s11 x0 64
+sw a2 -1280(gp)
+beq s2 s1 8
+sw s7 -92(gp)
+addi tp tp -1
+bne tp x0 -68
+lh t4 -852(gp)
+addi tp x0 3
+lbu t4 281(gp)
+srli a1 s8 19
+sltiu s10 ra -806
+remu s8 ra t6
+xori s2 a1 677
+addi tp tp -1
+bne tp x0 -24
+mul s2 s7 ra
+lw a5 -804(gp)
+lbu s11 -1272(gp)
+sb a4 1998(gp)
+sltiu t5 a5 -896
+bgeu a1 a2 12
+lw s6 1616(gp)
+lb t5 -729(gp)
+sra s2 a5 t5
+lh t5 -820(gp)
+sub s10 t3 a7
+addi tp x0 3
+lhu s11 1788(gp)
+remu t4 a5 t5
+lbu a7 813(gp)
+add s0 s2 a6
+sh s9 -1088(gp)
+lhu t6 -162(gp)
+rem a7 s2 s3
+sw s5 -1152(gp)
+lbu s8 -1998(gp)
+sh a4 -468(gp)
+addi tp tp -1
+bne tp x0 -44
+jal s2 48
+lb s10 -1019(gp)
+lw a0 860(gp)
+sh s2 -142(gp)
+sra a2 s6 t6
+sw s8 1528(gp)
+lbu a6 -1522(gp)
+mulhsu s3 s10 a3
+sb s9 2023(gp)
+sw s6 -44(gp)
+lw a3 -200(gp)
+divu s9 t6 s0
+sw s10 -100(gp)
+sh s7 -1246(gp)
+lhu s0 -408(gp)
+lb s5 49(gp)
+sw s8 -44(gp)
+sb t4 -975(gp)
+and a3 s4 s2
+lhu a1 2016(gp)
+mul s10 t1 a4
+sb t3 -706(gp)
+lb s5 -1520(gp)
+lh s0 610(gp)
+sh t1 54(gp)
+blt a3 a3 16
+bltu x0 s1 20
+sb t0 -927(gp)
+sw a0 -2024(gp)
+sh s8 1288(gp)
+auipc t3 643860
+divu t1 a2 a6
+srl t2 ra s1
+sb s11 -628(gp)
+sb a2 1416(gp)
+sh s10 1374(gp)
+sh a0 -1258(gp)
+slli s6 a1 2
+slli s4 s8 28
+sll s11 t5 t0
+lh a7 -1970(gp)
+lbu a1 149(gp)
+srli a4 t1 14
+lhu s4 558(gp)
+srli a7 a3 18
+sh s0 -1098(gp)
+ori s0 a3 -1847
+bge s2 t5 32
+sh s9 -1106(gp)
+lbu a6 1124(gp)
+xori s7 s11 -1188
+lbu x0 1982(gp)
+lw a0 -340(gp)
+sh a5 -1462(gp)
+ori a7 t0 -1096
+addi tp x0 2
+sb s2 1530(gp)
+sll s10 s10 a1
+sb t6 -1423(gp)
+lw a6 -420(gp)
+mulhu s2 s1 s5
+or s9 a6 s10
+addi tp tp -1
+bne tp x0 -28
+or s6 a0 s8
+mulhsu s6 s7 t1
+sh t2 -1938(gp)
+sw a2 1104(gp)
+lh t2 -474(gp)
+sb t2 -1569(gp)
+ori s1 a5 216
+sh a0 1012(gp)
+sb s6 381(gp)
+sra s1 s2 x0
+lb a3 -1735(gp)
+bgeu s6 t5 28
+lb s10 -739(gp)
+lbu s9 -829(gp)
+sw s11 -608(gp)
+sltu a7 s1 t5
+sh s5 1634(gp)
+lw a7 1196(gp)
+lhu s5 -646(gp)
+lui s1 287205
+slti t4 s1 1537
+lh s7 -1958(gp)
+sh t3 1366(gp)
+lb t4 -1281(gp)
+sb a2 1203(gp)
+lbu ra 1631(gp)
+addi tp x0 2
+lhu x0 -1740(gp)
+sw t0 -1256(gp)
+sw x0 -944(gp)
+sw a4 -728(gp)
+sh t4 220(gp)
+lb s4 -1528(gp)
+ori s0 a2 308
+sb s9 -1183(gp)
+xor a6 x0 t6
+lw s3 1152(gp)
+lui t5 798153
+sll s3 s0 t3
+bgeu s4 a4 12
+lhu ra -1008(gp)
+divu s2 s0 a4
+addi tp tp -1
+bne tp x0 -64
+rem t2 s8 s11
+srai s3 s0 3
+lhu a6 1946(gp)
+addi tp x0 8
+lhu x0 -706(gp)
+slti s7 t6 234
+srai s6 t6 5
+addi tp tp -1
+bne tp x0 -16
+ori s5 t5 -1902
+add a4 a5 a7
+sb s9 1277(gp)
+lb s9 1998(gp)
+sll s8 s10 a7
+sb s6 869(gp)
+lbu s9 -764(gp)
+auipc t5 0
+jalr a1 t5 8
+sw s4 1480(gp)
+auipc s0 556976
+lhu a6 652(gp)
+lbu s5 1885(gp)
+sw a2 -1648(gp)
+addi s3 a5 -676
+sh a0 -1948(gp)
+sub s4 t2 a6
+and s9 s8 a6
+sh t4 -690(gp)
+mulhu s2 s6 a5
+lhu t3 1678(gp)
+lui s8 925822
+mulh a0 s7 a6
+srai s5 a4 8
+lw s2 -1620(gp)
+andi t4 t1 -1423
+sw s5 -36(gp)
+beq s7 s3 36
+auipc t1 696532
+slt a1 s11 s1
+sw s4 -232(gp)
+div s10 s8 a6
+lw s8 -860(gp)
+lhu s8 -1902(gp)
+sw s5 1852(gp)
+bne s0 a6 32
+lb a6 -1929(gp)
+addi a3 s10 -112
+lbu a4 -150(gp)
+rem t2 x0 t1
+lb s9 -1887(gp)
+sb a2 -1508(gp)
+sub s8 x0 s8
+addi tp x0 5
+sh s1 -1148(gp)
+slti t4 s4 901
+lw s9 532(gp)
+sltu s10 x0 t6
+divu s11 a7 a7
+add s2 s1 a3
+sltiu t6 a1 604
+lw x0 -508(gp)
+sh t5 -1068(gp)
+xor s10 a2 s10
+sw a0 1752(gp)
+sh x0 -1628(gp)
+sw a7 1956(gp)
+addi tp tp -1
+bne tp x0 -56
+lw s10 796(gp)
+sra t6 t5 a2
+sb t6 -985(gp)
+slt s7 t1 s3
+lb s11 1494(gp)
+sb s8 147(gp)
+lw s11 -68(gp)
+and t2 s3 s7
+sw a4 -492(gp)
+srli s2 x0 26
+lb a5 -691(gp)
+sh t1 -1498(gp)
+sltiu a7 s4 716
+sb s4 1372(gp)
+lh t3 -1458(gp)
+div a3 t1 s3
+sh s7 80(gp)
+sh ra 474(gp)
+andi t5 a2 -1852
+sw s11 -36(gp)
+sw s7 292(gp)
+and t5 a0 s9
+addi s10 t3 -195
+sb t2 -38(gp)
+sb a0 -1334(gp)
+lw a0 1036(gp)
+lhu x0 1042(gp)
+lb s10 1588(gp)
+sh a3 -1180(gp)
+lw a3 1480(gp)
+lh t2 864(gp)
+sw a7 1280(gp)
+srli s1 s10 21
+div a6 a2 a3
+bltu x0 a6 40
+lbu t5 1560(gp)
+sw a7 -1280(gp)
+mulhsu a3 t5 s7
+sw a1 380(gp)
+slli s11 t1 13
+sb s10 -920(gp)
+srai s0 a0 14
+sw a6 440(gp)
+lh x0 -476(gp)
+sb s9 -1053(gp)
+ori s5 t1 -679
+lui s3 591381
+sb t3 -1632(gp)
+sw s7 -1796(gp)
+bge s0 t2 16
+lb t5 -193(gp)
+remu t0 s0 s9
+xori s9 s10 -1354
+lw s8 1204(gp)
+remu a7 a3 a3
+ori s1 a5 -242
+xor t6 s11 a1
+lw s6 -684(gp)
+lb ra 646(gp)
+sb a2 112(gp)
+lbu a3 1074(gp)
+lbu s5 1757(gp)
+sb t6 572(gp)
+lhu a0 -1092(gp)
+auipc a0 555913
+sb t4 847(gp)
+sh s10 116(gp)
+sw t4 -392(gp)
+sw s3 -780(gp)
+divu s2 a6 a5
+ori t4 t4 -1826
+and s4 t2 a0
+mulh a5 a6 s5
+jal s3 24
+sw a5 1700(gp)
+lhu a5 -1556(gp)
+lb s10 1048(gp)
+lw a3 876(gp)
+addi a4 a2 -454
+lhu s3 1818(gp)
+sltiu s6 s6 -1092
+addi tp x0 5
+xor t2 a5 t6
+beq s2 s6 24
+divu a3 t5 a3
+sh s8 -1778(gp)
+sra s9 t0 s9
+or x0 s10 t6
+blt a2 s11 56
+lhu s11 -724(gp)
+xor x0 s10 s9
+sw ra 784(gp)
+lh s1 -710(gp)
+sh a3 -1756(gp)
+sb t4 -642(gp)
+auipc t5 819285
+addi tp tp -1
+bne tp x0 -60
+sll s5 t4 s6
+slli t2 t2 29
+sb s9 624(gp)
+sb s8 322(gp)
+addi tp x0 7
+lb s10 -921(gp)
+bne a1 t6 32
+sw a7 4(gp)
+lb ra 563(gp)
+lh s0 -428(gp)
+sh t0 -1334(gp)
+sh s2 -1212(gp)
+sw t5 272(gp)
+lhu t4 -384(gp)
+and s3 s4 t5
+divu a7 s2 s0
+sb s1 1357(gp)
+lw a4 -1688(gp)
+mulh t1 s10 t6
+lbu s11 -722(gp)
+addi tp tp -1
+bne tp x0 -64
+slt t2 s0 a0
+divu ra a0 a5
+sh t1 1850(gp)
+lbu t6 -1056(gp)
+rem s5 s8 a7
+sh t4 2032(gp)
+slli a3 a2 6
+srai a2 s3 16
+xori a4 t0 1458
+lhu s8 -1276(gp)
+sw a4 1412(gp)
+addi tp x0 6
+lhu x0 -534(gp)
+lb a1 -2030(gp)
+lbu s8 -1993(gp)
+sb s5 765(gp)
+xori s10 t6 -161
+addi tp tp -1
+bne tp x0 -24
+lb a6 -1394(gp)
+addi tp x0 5
+mulhu a6 s3 t1
+lhu a2 620(gp)
+lui s1 489482
+addi tp tp -1
+bne tp x0 -16
+lb t4 -845(gp)
+sh a1 -428(gp)
+sw t2 152(gp)
+blt t6 s6 44
+sb t0 -1064(gp)
+lhu s10 530(gp)
+sb s7 1167(gp)
+lbu s1 1694(gp)
+sh a4 -14(gp)
+sb s7 1999(gp)
+lw a0 -1848(gp)
+slt x0 t1 s10
+lbu t4 -494(gp)
+bgeu s3 s5 56
+sll a1 x0 s0
+sh s7 1906(gp)
+xor ra s3 s8
+sw t1 1484(gp)
+lhu ra 1456(gp)
+lh s5 -1068(gp)
+lhu t6 -576(gp)
+addi a4 s2 -1296
+sh t5 1228(gp)
+sw t1 -456(gp)
+sb a1 -611(gp)
+ori t0 s0 1448
+sh t2 -160(gp)
+lbu s11 -1874(gp)
+auipc s9 0
+jalr a5 s9 68
+addi tp x0 8
+sh a1 136(gp)
+sh s6 460(gp)
+lh t2 -204(gp)
+lh t4 -70(gp)
+lhu t4 -936(gp)
+addi tp tp -1
+bne tp x0 -24
+slti ra a0 -1491
+lh s5 1798(gp)
+sra a2 a4 s8
+mulh s3 a6 t1
+sw a2 264(gp)
+sb s4 1735(gp)
+ori s3 a4 -1667
+sh x0 -1920(gp)
+lh a5 1158(gp)
+addi tp x0 7
+remu t2 a3 s4
+sb a5 785(gp)
+lb s10 -1251(gp)
+lhu t2 -1946(gp)
+srli a5 t0 15
+sh s8 -1526(gp)
+blt t5 s2 36
+lw a3 -80(gp)
+lb t5 1051(gp)
+sh t0 1556(gp)
+lh s3 1752(gp)
+xori s0 s0 1377
+addi tp tp -1
+bne tp x0 -52
+lb t6 -1485(gp)
+addi tp x0 6
+lb t5 -516(gp)
+add s5 t5 t3
+lbu s0 -1046(gp)
+mulhu s7 t4 s8
+sb t5 866(gp)
+sltu s8 s6 s5
+blt s9 a2 56
+sh a4 1856(gp)
+lh t4 638(gp)
+addi tp tp -1
+bne tp x0 -40
+sw a0 252(gp)
+sw s7 2000(gp)
+ori s1 s10 1472
+divu s5 t0 x0
+lui s6 1019568
+lb s2 -649(gp)
+lhu s1 -728(gp)
+mul s10 s4 a5
+lbu s6 998(gp)
+xor a0 a2 s0
+sb x0 399(gp)
+lh s4 780(gp)
+sb t5 1779(gp)
+addi tp x0 3
+lb s2 -1134(gp)
+addi tp tp -1
+bne tp x0 -8
+sb x0 -825(gp)
+sw s5 1356(gp)
+sh s2 -1696(gp)
+sub a1 a5 t0
+sra a7 s5 a2
+rem s2 t4 t0
+sltu ra t3 t3
+bge t2 s4 20
+bne t2 t2 20
+blt t1 t3 16
+sltu s3 a1 t5
+sh s1 1538(gp)
+or s8 s1 s4
+addi tp x0 5
+addi t6 t0 -883
+bltu s4 s10 36
+sltiu t5 x0 1207
+sw s1 -936(gp)
+addi tp tp -1
+bne tp x0 -20
+addi s8 ra -1236
+mul s2 a3 ra
+srai a7 s1 18
+mulhsu s5 x0 ra
+sh a5 -866(gp)
+mul a0 t4 s11
+add s4 s3 t2
+mulh x0 a0 s3
+addi tp x0 1
+bne ra a6 44
+sltu a3 a2 s10
+lb a2 -671(gp)
+sltiu s1 ra -1295
+slti t2 s11 -1986
+and t3 a3 s9
+lui ra 44765
+div t5 a1 s10
+remu a7 s6 a4
+xor a7 a3 s11
+sh t4 -652(gp)
+addi tp tp -1
+bne tp x0 -48
+beq s1 t0 4
+addi tp x0 4
+lbu a0 -1261(gp)
+addi t4 a7 -1031
+sll t3 t3 t4
+mul s2 s7 a6
+srli t5 s8 11
+lbu t3 1065(gp)
+lb s5 -1017(gp)
+lhu ra -1684(gp)
+sub s11 t2 s9
+xor t0 t4 ra
+addi tp tp -1
+bne tp x0 -44
+andi a0 a0 -1546
+sh t0 -844(gp)
+addi tp x0 5
+sb t5 -1607(gp)
+slti a1 x0 1534
+lw s10 1908(gp)
+sw a0 1688(gp)
+lw s2 -1800(gp)
+sh s10 -120(gp)
+mul a7 s5 a7
+lhu a0 -182(gp)
+lb t6 -1096(gp)
+lw t3 1680(gp)
+srli t5 s5 11
+sub s6 ra s5
+lh s11 682(gp)
+sh s3 -576(gp)
+sb t5 1581(gp)
+sh s8 264(gp)
+addi tp tp -1
+bne tp x0 -68
+lbu ra 40(gp)
+sb a4 222(gp)
+add x0 s8 t5
+sh a2 1692(gp)
+lb s6 233(gp)
+lhu a2 882(gp)
+bge s10 t1 48
+lb t5 -1024(gp)
+sw a6 -952(gp)
+sltu s7 a1 a0
+mulh t0 ra x0
+lbu t1 1751(gp)
+and s6 s5 s4
+lui a3 193871
+lh a6 62(gp)
+lh t6 20(gp)
+auipc a4 175434
+xori t6 s3 -1845
+sw t1 -1720(gp)
+xori ra s7 1286
+beq t6 t0 40
+sh t1 270(gp)
+srli s8 s8 3
+slti t4 s7 1059
+lw s3 -1228(gp)
+lhu s6 -516(gp)
+sb a7 1371(gp)
+and a4 t0 t2
+lb t2 258(gp)
+lb a6 -323(gp)
+sltu t2 s5 t0
+bne t0 t2 44
+lb s11 -730(gp)
+slti s11 s7 101
+sw t3 304(gp)
+or t1 s5 ra
+lhu a1 82(gp)
+sw t6 1548(gp)
+sltiu t0 t3 1149
+mul s4 t1 a2
+lhu s8 -108(gp)
+jal s7 56
+addi s3 s10 -1571
+sb s3 -628(gp)
+slli ra s7 1
+addi a3 t1 1051
+lw s6 1628(gp)
+sb t1 1622(gp)
+sb a3 -1818(gp)
+xori a5 a0 -458
+slli s7 a3 0
+bgeu s10 x0 44
+xor s3 t3 a7
+lb a5 1169(gp)
+lbu t1 100(gp)
+rem s0 t2 a3
+mulhu a5 s2 t1
+ori a3 s2 -385
+sub s3 a4 t0
+sb a7 1(gp)
+lw a3 1712(gp)
+slti t4 s7 620
+sb s2 63(gp)
+slt a7 s8 s1
+sltu s5 t0 s2
+jal t4 16
+lh s9 -758(gp)
+div t5 s1 t0
+xori s8 a0 -202
+slli ra a6 5
+sw s0 1724(gp)
+xor s2 a4 a1
+lw s6 1520(gp)
+lui ra 314456
+div ra s4 a3
+sh t1 1874(gp)
+lbu a4 -379(gp)
+lui s3 929190
+lhu s10 -246(gp)
+addi a0 x0 10
+ecall
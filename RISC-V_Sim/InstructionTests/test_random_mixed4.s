@@ -0,0 +1,1036 @@
+addi x0 x0 0
+addi ra x0 1
+addi sp x0 2
+addi gp x0 3
+addi tp x0 4
+addi t0 x0 5
+addi t1 x0 6
+addi t2 x0 7
+addi s0 x0 8
+addi s1 x0 9
+addi a0 x0 10
+addi a1 x0 11
+addi a2 x0 12
+addi a3 x0 13
+addi a4 x0 14
+addi a5 x0 15
+addi a6 x0 16
+addi a7 x0 17
+addi s2 x0 18
+addi s3 x0 19
+addi s4 x0 20
+addi s5 x0 21
+addi s6 x0 22
+addi s7 x0 23
+addi s8 x0 24
+addi s9 x0 25
+addi s10 x0 26
+addi s11 x0 27
+addi t3 x0 28
+addi t4 x0 29
+addi t5 x0 30
+addi t6 x0 31
+lui gp 1
+addi gp gp -2048
+addi tp x0 97
+divu a6 s10 t5
+slti t5 t5 1465
+sb a6 -1844(gp)
+sll a2 t1 s4
+and s9 s4 a6
+bne a6 a3 4
+sub s7 a2 s0
+sb s5 187(gp)
+addi tp tp -1
+bne tp x0 -36
+or x0 t2 t2
+mulhsu s3 s0 s6
+blt s5 s9 4
+addi tp x0 77
+addi t1 t6 -510
+slti s7 s0 -1831
+sll a0 s8 s1
+bne a5 t1 32
+auipc a0 0
+jalr a6 a0 64
+addi tp tp -1
+bne tp x0 -28
+mulhsu a1 s7 s10
+bgeu t3 t6 12
+bne a6 x0 56
+sh t3 1000(gp)
+addi tp x0 75
+sll t0 a7 a3
+addi tp tp -1
+bne tp x0 -8
+sub s6 ra a6
+bge s1 a3 28
+blt s7 s10 32
+blt s0 s10 8
+srl t6 s8 s6
+mulhsu t3 s3 s1
+lhu t3 -932(gp)
+srai a5 s6 18
+beq s10 s2 12
+jal x0 8
+jal a3 28
+addi tp x0 26
+bge a1 t5 20
+lh s11 268(gp)
+xori a7 a5 -994
+addi tp tp -1
+bne tp x0 -16
+addi tp x0 40
+slti a0 a2 -955
+bltu s5 s9 4
+blt a2 a4 56
+xor s6 s0 a0
+bne t5 x0 44
+srli t4 a6 13
+rem a3 a5 s7
+mulh x0 s0 ra
+lbu s1 1787(gp)
+ori a2 s9 -833
+bge a4 s8 24
+addi tp tp -1
+bne tp x0 -48
+auipc s11 0
+jalr s10 s11 68
+slti t2 s11 -101
+addi tp x0 96
+bgeu s1 a3 28
+bne x0 ra 52
+sub s8 t4 s6
+lbu a7 1174(gp)
+lb t5 616(gp)
+lui s6 847317
+bne s6 a3 32
+bgeu s10 s7 28
+addi tp tp -1
+bne tp x0 -36
+sb s1 365(gp)
+bge s11 s3 12
+beq s11 s11 4
+bne t5 s4 60
+addi tp x0 56
+bne ra ra 64
+rem s8 s2 t6
+sltu s3 t1 a1
+lhu s3 1920(gp)
+auipc s10 0
+jalr s2 s10 68
+srai a5 ra 12
+bge t6 a3 24
+bge ra t0 52
+sw a3 -1664(gp)
+addi tp tp -1
+bne tp x0 -44
+bltu ra t4 32
+jal s8 40
+bne t1 s10 44
+beq s3 t1 24
+mul a5 t2 t3
+bltu a7 s11 60
+bltu a1 t3 8
+jal s9 52
+bgeu a3 a0 16
+blt t4 s8 36
+div t6 t6 a0
+lb t0 -1992(gp)
+beq t3 a1 32
+bge a5 a6 24
+auipc s6 0
+jalr t6 s6 12
+beq s3 s5 12
+lbu t6 1482(gp)
+and s10 a4 a2
+slli x0 s0 1
+addi tp x0 3
+bltu ra t5 12
+addi tp tp -1
+bne tp x0 -8
+addi tp x0 35
+sra a0 s1 t2
+lhu a1 -840(gp)
+bltu a1 s3 64
+sh s2 744(gp)
+remu a4 a6 s0
+jal t5 48
+auipc t4 0
+jalr t5 t4 16
+lh a1 1148(gp)
+bge a3 a6 40
+bge a5 s4 52
+addi s11 s2 -299
+addi tp tp -1
+bne tp x0 -52
+bgeu s7 s9 52
+sb ra -1931(gp)
+mulh s4 s10 a1
+sltu a0 t5 t5
+rem a5 a6 a2
+auipc s1 0
+jalr s4 s1 36
+auipc s8 0
+jalr s9 s8 60
+addi tp x0 67
+bge s3 x0 4
+addi tp tp -1
+bne tp x0 -8
+bne a0 s3 64
+addi a5 s4 -980
+div s8 s6 t1
+bltu s10 t6 32
+auipc t3 0
+jalr a6 t3 32
+srl t6 s8 a3
+srl s6 s10 s9
+bltu a1 t5 64
+slli a6 t0 11
+sh t1 -1884(gp)
+sltu a3 a0 a5
+bltu t6 s8 48
+bgeu a5 t6 36
+rem t6 ra a7
+rem s3 s0 t4
+slti s8 t4 842
+lbu a3 355(gp)
+bge a0 a5 36
+andi t5 t4 -143
+jal t0 20
+slt t2 s9 a7
+lb t2 631(gp)
+sll s3 a6 t0
+mulh s3 s10 a0
+lh t3 -1332(gp)
+jal t2 4
+addi tp x0 36
+beq t6 t0 32
+jal s2 8
+addi s6 a7 -74
+or t5 t1 t1
+slt s0 a1 s1
+lw s0 1132(gp)
+sw t5 1600(gp)
+sw t1 -564(gp)
+bne s7 t5 12
+mulhu s8 t2 s7
+beq t4 s10 28
+addi tp tp -1
+bne tp x0 -48
+xori s1 s3 160
+beq s8 t0 12
+sb t4 -1879(gp)
+or s10 s9 s4
+blt s4 s5 32
+rem x0 s0 a3
+jal s11 40
+mulhu a6 a7 s10
+rem a6 a3 ra
+beq t2 t0 28
+jal ra 20
+lui s10 17043
+bltu t3 s6 56
+sb t4 264(gp)
+blt a1 s8 36
+bgeu t3 a2 4
+auipc t4 0
+jalr s3 t4 44
+mulhsu t3 a0 s6
+sltu t3 s1 a3
+sb a0 -1632(gp)
+auipc t3 0
+jalr s2 t3 20
+auipc s7 0
+jalr s8 s7 36
+bltu s2 t1 40
+divu s6 s1 s8
+beq s6 s2 12
+bne a6 s0 40
+jal t2 16
+auipc a0 966474
+bne s9 a5 8
+div a6 s2 s5
+mul a1 s11 x0
+sltu a3 ra t5
+bge s5 s8 32
+sra a7 t5 t2
+lbu t4 -757(gp)
+bgeu a7 s3 20
+jal s0 8
+bne s8 s9 12
+sll s4 a3 s1
+slt s6 a5 t3
+addi tp x0 39
+beq t1 t3 28
+bgeu s8 s6 52
+mulhu s0 s0 t5
+beq a5 x0 8
+bltu t1 t1 60
+srai s3 ra 18
+sh s10 72(gp)
+blt s3 a4 20
+xori a1 a1 -1117
+remu s0 s7 s0
+mulhsu s10 s5 s2
+bgeu t1 t3 44
+lhu t0 -864(gp)
+bltu s11 s1 12
+addi tp tp -1
+bne tp x0 -60
+srl s7 a6 a0
+sltu t1 s6 a4
+blt t0 a3 8
+bgeu s0 t5 48
+bge s5 a7 56
+bgeu s5 t1 28
+bne s0 a7 4
+addi tp x0 83
+bltu t2 t5 12
+addi tp tp -1
+bne tp x0 -8
+blt s9 t5 40
+sh t3 988(gp)
+bgeu t4 a1 20
+bne a6 t4 16
+xor t6 s5 t0
+bne s5 s11 20
+ori a6 t6 -210
+auipc s2 0
+jalr t6 s2 12
+lui t4 1026334
+addi tp x0 62
+auipc t6 0
+jalr t6 t6 32
+ori s10 t2 -1976
+bge ra a5 32
+bge t1 s6 52
+srli s0 s0 14
+sltiu s1 a7 1107
+sb a6 -946(gp)
+bge t1 s0 60
+auipc t3 0
+jalr a3 t3 24
+addi tp tp -1
+bne tp x0 -48
+sltiu a1 s6 -479
+srli a4 x0 27
+and t6 a3 a1
+slt s5 s6 t0
+add a5 a4 s9
+beq s6 t5 48
+bne s9 ra 48
+bge x0 s1 12
+lhu s6 -494(gp)
+bne a3 s0 4
+addi tp x0 35
+xor t0 t3 s8
+bge a5 a4 8
+lh t1 -1248(gp)
+sw s0 -852(gp)
+addi tp tp -1
+bne tp x0 -20
+ori t0 ra -1955
+bgeu a1 t5 40
+divu s10 s1 a1
+bltu t3 s10 12
+mulh a3 t1 a7
+lhu a7 -926(gp)
+beq t0 s10 60
+xori s3 s5 -752
+bgeu t6 s10 8
+add x0 s1 s0
+slt s10 s4 s9
+auipc t5 0
+jalr a4 t5 40
+jal s8 32
+beq a4 s9 28
+bge a3 a2 20
+slti s0 s2 1645
+bltu s6 s5 16
+andi s9 a7 2039
+andi s3 s2 -1026
+xor t5 s5 a3
+addi tp x0 6
+sub t3 x0 t5
+jal s9 56
+addi s0 s4 -475
+sub a1 t4 s6
+bgeu t6 a3 52
+lhu s8 204(gp)
+sw x0 1944(gp)
+addi tp tp -1
+bne tp x0 -32
+sltu a4 a2 s9
+blt a6 s2 60
+andi t4 t6 -220
+bltu t4 s0 56
+jal t0 48
+beq t4 a3 20
+srli a6 a6 29
+jal s5 24
+jal s9 40
+bgeu s0 a0 32
+and a7 a2 a1
+sltu a4 a5 t5
+lw a4 460(gp)
+auipc a6 787808
+sh s11 -1312(gp)
+blt s2 a2 12
+bne a2 t2 52
+sh s0 1506(gp)
+addi tp x0 93
+slli s1 a4 16
+mul s0 s5 s6
+srai ra a7 17
+srl s8 s2 s0
+blt s3 t1 12
+sra x0 t3 x0
+jal a5 16
+sw s11 -584(gp)
+addi tp tp -1
+bne tp x0 -36
+addi tp x0 60
+sw a7 968(gp)
+sltu s11 a3 t2
+beq s11 a1 60
+bge a3 t4 36
+bltu a2 a2 32
+ori a7 a7 -1060
+add t5 s7 a4
+bge a7 s5 32
+lhu t2 910(gp)
+bne t1 s2 44
+bltu s2 a2 4
+lbu t6 -1325(gp)
+addi tp tp -1
+bne tp x0 -52
+bge s0 t4 8
+jal t2 20
+blt t3 s10 12
+auipc s1 0
+jalr s3 s1 12
+xor s8 s4 ra
+addi tp x0 82
+sh a5 -1088(gp)
+sw a2 628(gp)
+bne ra t2 12
+addi tp tp -1
+bne tp x0 -16
+addi tp x0 55
+sltiu t4 t6 231
+bgeu a0 t5 28
+jal s9 56
+sra a2 a6 t0
+bltu s7 a7 32
+jal s7 28
+bne a5 t2 40
+bge t5 s11 36
+jal s6 12
+div a1 a3 s7
+lbu a4 997(gp)
+srli t3 t4 26
+addi tp tp -1
+bne tp x0 -52
+sb s0 -472(gp)
+lbu s5 1094(gp)
+addi tp x0 93
+bltu t6 a1 8
+lhu t6 1452(gp)
+sh a4 994(gp)
+lh s1 692(gp)
+sra s8 t1 s0
+beq s5 ra 60
+and s6 t1 a7
+bge t6 s11 40
+sra t5 s9 s9
+bne s3 s5 44
+addi tp tp -1
+bne tp x0 -44
+remu t1 s7 a0
+mulhu s7 t4 t2
+andi t4 a4 -954
+bgeu t1 s0 16
+srl t1 a3 a0
+srli a1 a0 6
+jal x0 44
+bne t1 t6 20
+lb a2 -297(gp)
+bge a6 a3 32
+auipc s6 0
+jalr s11 s6 12
+sb s7 303(gp)
+mulhu x0 t2 t1
+mulhu s5 x0 a5
+div t2 s4 s3
+bne t2 ra 64
+bge t2 s5 24
+blt t5 s9 24
+mulhsu a7 t4 a7
+lbu s11 724(gp)
+bltu a5 t1 32
+bne s6 a7 44
+blt a3 s10 4
+auipc t0 0
+jalr a6 t0 36
+slt s7 s7 s6
+auipc t4 0
+jalr a6 t4 24
+slli t3 s7 6
+bgeu s5 a7 12
+lbu a5 1930(gp)
+slli s0 t0 27
+addi tp x0 49
+blt ra t4 12
+sw s8 72(gp)
+remu x0 a3 a1
+and a2 s3 s0
+srl s1 x0 s6
+beq t4 a3 48
+lbu t2 -1433(gp)
+lb t5 249(gp)
+addi tp tp -1
+bne tp x0 -36
+bne s0 t0 60
+divu a1 t3 s1
+sub ra a0 s7
+bltu s4 t1 56
+lb s5 711(gp)
+bgeu s9 t6 52
+slli a3 a4 30
+srli a0 t1 12
+bgeu s11 a6 32
+remu a4 t2 a0
+bge s1 ra 12
+blt s3 s5 4
+sb ra 825(gp)
+lui t0 59312
+sltiu s9 t1 -10
+srl s0 t4 s11
+sw s7 -1952(gp)
+auipc t1 264254
+lhu a6 -36(gp)
+bne a4 a1 16
+lw s1 960(gp)
+bge s8 s1 16
+lw ra -884(gp)
+auipc s6 0
+jalr a3 s6 56
+addi tp x0 32
+bgeu s4 s2 44
+beq s9 s2 20
+bne s7 s10 16
+addi tp tp -1
+bne tp x0 -16
+blt a0 a3 24
+addi tp x0 70
+lh s11 858(gp)
+bgeu t6 s3 52
+addi tp tp -1
+bne tp x0 -12
+addi tp x0 19
+sw t0 508(gp)
+bltu a7 a3 32
+lhu t1 1294(gp)
+jal t5 24
+bne a7 a2 20
+bne s8 a0 16
+bltu s0 a0 12
+addi tp tp -1
+bne tp x0 -32
+addi tp x0 18
+beq s3 a1 28
+bltu a3 x0 16
+srl ra s11 s0
+andi s7 t6 -1772
+sh a6 166(gp)
+bne t1 a3 28
+xor a3 a4 t2
+sb t5 -1266(gp)
+bge a3 a5 52
+slti s8 t0 1832
+bgeu a7 t6 56
+lui a4 284236
+addi tp tp -1
+bne tp x0 -52
+div a2 a3 s9
+sb s5 14(gp)
+bgeu t0 s9 8
+bltu a2 a5 8
+lhu s7 634(gp)
+lw s7 1200(gp)
+mulh ra s8 a2
+sltu t6 t1 s8
+lhu t2 1998(gp)
+lbu s9 1843(gp)
+srl s6 s11 t0
+mul s11 s1 t2
+rem t5 s3 a5
+bne a2 a5 12
+sra t3 a7 t3
+lbu a6 1996(gp)
+addi tp x0 75
+sll a3 s10 a4
+auipc a6 0
+jalr s1 a6 64
+slt s1 t4 a4
+bltu t3 t6 4
+bltu s8 s10 4
+auipc t6 0
+jalr s6 t6 32
+sh s10 -214(gp)
+beq s10 a7 56
+bne a7 t3 16
+add a7 s2 s4
+bltu a4 a3 36
+andi s6 s10 1424
+addi tp tp -1
+bne tp x0 -60
+bgeu t1 s6 32
+beq s8 s4 28
+remu a5 s1 a2
+sh a0 -754(gp)
+bge ra x0 16
+auipc s7 0
+jalr s0 s7 12
+bge a3 a1 4
+addi tp x0 2
+jal s7 44
+lh s6 1990(gp)
+andi t2 s7 1082
+bne s9 a1 32
+mul a1 t1 a0
+addi tp tp -1
+bne tp x0 -24
+add a4 t0 t1
+beq a5 x0 12
+or s6 s8 a2
+sb a6 1886(gp)
+addi tp x0 36
+auipc s5 709542
+lb s5 1033(gp)
+lbu s4 -1017(gp)
+lhu a3 -1732(gp)
+lh t5 -1648(gp)
+remu ra s6 s0
+addi s5 s2 761
+beq t6 a6 24
+auipc ra 0
+jalr s7 ra 8
+bge t3 a1 8
+xor a2 a7 a2
+xori s5 s2 -1225
+addi tp tp -1
+bne tp x0 -56
+sll a2 t4 s11
+remu s7 x0 t1
+sltu a1 a1 t4
+auipc a1 0
+jalr s8 a1 16
+auipc a2 0
+jalr s11 a2 28
+jal s10 20
+bltu a4 a2 44
+jal s1 40
+sw a3 -780(gp)
+sb a5 660(gp)
+addi tp x0 100
+auipc t4 0
+jalr a5 t4 32
+add t3 a5 a3
+srli x0 s0 16
+addi tp tp -1
+bne tp x0 -20
+xori s8 a6 -115
+bgeu a7 a2 4
+addi tp x0 26
+beq s3 s8 52
+auipc a4 0
+jalr s3 a4 32
+ori t0 t6 1637
+sltiu t0 a2 780
+bltu s8 t6 40
+mulhsu t6 s1 a4
+addi tp tp -1
+bne tp x0 -32
+and x0 s8 s7
+lw t6 280(gp)
+bgeu s10 a5 16
+beq s4 a5 16
+auipc t2 0
+jalr t5 t2 68
+jal s5 52
+lb a2 -327(gp)
+sltiu a4 ra -1285
+bltu a6 t6 48
+lb s0 -586(gp)
+blt t5 s3 40
+sltu s6 t2 x0
+blt t3 t2 32
+blt a6 s10 16
+srl s2 ra a6
+or t3 a5 s0
+bne a0 a4 44
+bgeu s3 s7 12
+bltu t6 s10 56
+bgeu a7 a0 36
+addi tp x0 64
+jal t3 36
+auipc s7 0
+jalr s1 s7 52
+addi tp tp -1
+bne tp x0 -16
+blt t1 s9 52
+bne a1 s9 12
+auipc s0 0
+jalr s10 s0 16
+jal s8 56
+div a7 x0 s1
+auipc s8 0
+jalr a4 s8 28
+lhu s1 1124(gp)
+bgeu s3 a6 36
+jal t5 32
+sb s1 174(gp)
+slt t5 a0 ra
+auipc t5 0
+jalr s1 t5 20
+lui t6 402470
+sh s3 30(gp)
+jal a3 64
+addi tp x0 17
+sb t5 -1016(gp)
+sltiu s6 t1 -399
+slt s11 a0 s4
+bge a3 s1 44
+mulhsu s10 t5 s8
+jal s2 16
+add s6 t1 x0
+bne s5 s1 12
+bltu s7 t0 24
+sltiu s8 a2 -507
+blt a4 s1 12
+addi tp tp -1
+bne tp x0 -48
+sll a5 a2 a0
+addi tp x0 9
+beq s5 s7 60
+lh s0 -1676(gp)
+blt a4 s9 12
+bltu s6 s7 40
+mul ra s6 s11
+remu a1 s9 s0
+lbu s10 -626(gp)
+addi tp tp -1
+bne tp x0 -32
+bltu s6 s11 60
+auipc t3 40852
+bgeu t5 s11 52
+beq a1 a1 8
+sw t0 -1176(gp)
+sw t5 -1916(gp)
+bge ra a0 64
+auipc s2 123632
+srl a5 a6 s9
+bltu s0 t1 56
+jal t0 52
+sltiu s2 s1 841
+sltiu a2 a7 1849
+lbu a1 1429(gp)
+bltu a4 t2 36
+addi tp x0 46
+bgeu a0 t2 28
+ori a4 x0 -954
+auipc t3 0
+jalr s7 t3 16
+addi tp tp -1
+bne tp x0 -20
+lui s5 1009741
+addi tp x0 30
+sll t2 s3 t1
+lhu t3 -1240(gp)
+bne t4 t2 16
+div a6 s3 a7
+sltiu a1 a5 -1906
+sltu s0 x0 s9
+addi tp tp -1
+bne tp x0 -28
+bltu a1 t0 64
+addi tp x0 65
+lhu t5 584(gp)
+lw ra -1320(gp)
+sb t0 -380(gp)
+sltu s8 a7 s8
+sltu s10 t4 t6
+jal s0 36
+bltu t3 s5 32
+bne s10 x0 28
+lw a1 216(gp)
+lui t2 581117
+addi tp tp -1
+bne tp x0 -44
+sw t0 1012(gp)
+mul s0 s8 s1
+addi tp x0 53
+bge a3 s8 40
+remu s6 t0 s6
+srai s3 a5 7
+beq a2 a0 32
+sltu s10 a6 t1
+div s10 a7 s5
+slti s6 t1 1924
+lh a1 -318(gp)
+addi tp tp -1
+bne tp x0 -36
+blt s5 s1 4
+addi tp x0 61
+andi x0 s7 412
+auipc a3 0
+jalr s9 a3 32
+auipc s4 21743
+bltu x0 t2 64
+sb a7 881(gp)
+bge t6 a2 36
+lb t3 -350(gp)
+divu s9 a2 s6
+remu s1 t2 ra
+addi tp tp -1
+bne tp x0 -44
+auipc a2 0
+jalr a7 a2 16
+blt s2 t0 20
+bltu a4 s11 4
+sh s7 524(gp)
+div s0 a5 t0
+lhu t4 582(gp)
+sb s0 1401(gp)
+bltu t2 s2 24
+lb x0 1897(gp)
+slti s11 t2 -1307
+ori a6 a7 -1872
+xori s1 s0 -1917
+srli s3 s9 10
+addi tp x0 67
+bge s10 t3 44
+sw t6 -924(gp)
+auipc t0 0
+jalr t4 t0 32
+auipc s8 0
+jalr a1 s8 64
+addi tp tp -1
+bne tp x0 -28
+xor t0 s2 t2
+divu s10 s3 a0
+xori s10 s0 -1594
+mul s0 s11 s2
+bgeu s5 s5 24
+sra t6 a4 t3
+bgeu a4 t5 4
+bne a6 a4 12
+slti s0 s11 -1546
+sh t1 1476(gp)
+lbu s6 -647(gp)
+bgeu x0 s4 56
+addi tp x0 57
+bne a4 s10 60
+lbu s6 1597(gp)
+srai s2 t6 25
+addi tp tp -1
+bne tp x0 -16
+srli a3 a0 17
+auipc s0 0
+jalr s1 s0 40
+sw s5 1800(gp)
+beq s4 a1 56
+ori s2 s8 1347
+ori s10 t2 -1146
+auipc t5 0
+jalr s0 t5 32
+remu a3 a7 s8
+beq a2 a6 12
+lhu t6 1290(gp)
+sb t3 -1227(gp)
+bltu s7 s9 20
+ori t5 s10 -160
+auipc a2 0
+jalr t0 a2 12
+srai s0 s10 27
+addi tp x0 31
+blt s4 s2 56
+mulhu t6 t3 t1
+srl t2 t0 s0
+beq a0 a5 4
+sw s0 1432(gp)
+jal t6 48
+bltu s6 s1 4
+bge a0 s11 40
+or s7 s4 s11
+bltu s1 s2 32
+lw a1 -520(gp)
+beq t0 t0 52
+addi tp tp -1
+bne tp x0 -52
+xori t3 s4 181
+andi s0 s1 -1383
+auipc a6 531142
+auipc t3 0
+jalr s6 t3 16
+jal a5 12
+bltu s11 s9 56
+lhu t3 -60(gp)
+auipc s8 0
+jalr s0 s8 28
+sh s11 -1548(gp)
+lh s3 176(gp)
+lb t5 1923(gp)
+auipc a2 0
+jalr s11 a2 8
+addi tp x0 61
+sltiu s0 a4 -94
+srai t3 s11 6
+addi tp tp -1
+bne tp x0 -12
+lbu s11 3(gp)
+lhu s7 -1676(gp)
+slti s2 s3 -603
+sh t0 1198(gp)
+sll a4 x0 s10
+slti t6 s11 1798
+or s2 s1 t1
+addi tp x0 83
+beq a2 s8 20
+sh a5 -454(gp)
+bgeu s6 t0 40
+mulhsu s11 t2 s8
+beq s0 ra 28
+sll s2 s5 t6
+auipc a0 0
+jalr t5 a0 36
+lbu s9 -1166(gp)
+blt t5 t3 40
+bge a4 t2 64
+lui a0 848075
+beq t3 s2 28
+auipc a2 0
+jalr a1 a2 20
+addi tp tp -1
+bne tp x0 -64
+ori t1 t1 -368
+div t5 a5 s9
+auipc s10 0
+jalr s2 s10 32
+srai a1 t1 4
+slli a4 t5 0
+mulhu s11 s6 a0
+divu a1 t2 t2
+or a7 s11 a6
+beq a5 t3 16
+blt s6 t2 40
+rem a0 t4 a5
+sh s2 -508(gp)
+lhu ra -1340(gp)
+mulhu a4 a4 s3
+sw a4 668(gp)
+auipc s9 0
+jalr x0 s9 60
+or t4 s2 s5
+lbu a1 1274(gp)
+divu s4 a1 t6
+lbu s8 -718(gp)
+auipc a1 0
+jalr a3 a1 44
+jal ra 40
+blt s2 a6 36
+slti s3 s8 1731
+sltu s9 t6 t0
+beq s8 s8 24
+jal a1 20
+lhu s11 -176(gp)
+slt s7 a6 t4
+jal x0 8
+sb a7 550(gp)
+addi tp x0 12
+beq s3 a5 4
+bne a3 s11 16
+mulhu t6 a3 s2
+auipc s1 0
+jalr s6 s1 28
+blt s11 a1 20
+mul s3 s10 t5
+blt a7 t6 12
+addi tp tp -1
+bne tp x0 -36
+addi tp x0 68
+remu t3 s1 s9
+slt a1 a0 t3
+and s4 a4 s3
+bgeu a4 s6 28
+sltiu a7 a4 -635
+add a7 a1 a5
+lw s8 100(gp)
+add s4 s3 t5
+addi tp tp -1
+bne tp x0 -36
+bgeu t4 s3 8
+srai t5 s9 3
+slt t5 s2 s3
+bgeu t3 a0 20
+sltu s9 a3 x0
+srl a1 t4 s3
+srli a7 a7 24
+mul s7 s4 a0
+sh s3 476(gp)
+bne a5 s7 32
+divu a1 s0 ra
+div a3 a5 a6
+mulh t6 s3 s1
+sltu a7 s11 s11
+sub s11 t6 a3
+divu s7 s1 ra
+jal t1 16
+auipc t1 0
+jalr s10 t1 12
+lh s0 286(gp)
+addi tp x0 78
+xor s3 a2 s11
+bne s8 a4 32
+srli a4 s1 31
+sh s11 -706(gp)
+slli s7 s1 11
+auipc t1 104842
+sltiu s11 s4 1576
+jal t2 36
+sb t0 -1257(gp)
+add ra a2 s2
+addi tp tp -1
+bne tp x0 -44
+beq t0 t4 36
+auipc t6 0
+jalr s11 t6 12
+blt s7 a2 24
+addi tp x0 96
+jal t5 16
+sh t3 -1544(gp)
+addi tp tp -1
+bne tp x0 -12
+addi tp x0 60
+lh ra -1342(gp)
+lbu s2 -1392(gp)
+slt s2 s11 t0
+blt t1 a1 12
+and s4 a3 s3
+slli t0 t4 3
+sb a3 947(gp)
+auipc t5 0
+jalr t1 t5 44
+or x0 s0 a0
+bltu a3 a5 32
+addi tp tp -1
+bne tp x0 -48
+addi tp x0 92
+remu ra a0 s11
+addi tp tp -1
+bne tp x0 -8
+andi t3 s11 -1082
+addi a0 x0 10
+ecall
@@ -0,0 +1,14 @@
+addi s0 x0 200
+addi s1 x0 5
+addi s2 x0 6
+addi s3 x0 7
+sw s1 0(s0)
+sc.w t0 s2 (s0)
+lw t1 0(s0)
+lr.w t2 (s0)
+sc.w t3 s2 (s0)
+lw t4 0(s0)
+sc.w t5 s3 (s0)
+lw t6 0(s0)
+addi a0 x0 10
+ecall
@@ -4,5 +4,7 @@ addi s0 x0 4
 sll t1 t0 s0
 addi s0 x0 16
 sll t2 t0 s0
+addi s0 x0 36
+sll t3 t0 s0
 addi a0 x0 10
 ecall
@@ -10,5 +10,9 @@ addi a0 x0 4
 sra t3 t0 a0
 addi a0 x0 12
 sra t4 t0 a0
+lui t0 987120
+addi t0 t0 240
+addi a0 x0 36
+sra t5 t0 a0
 addi a0 x0 10
 ecall
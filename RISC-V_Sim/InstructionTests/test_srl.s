@@ -4,5 +4,7 @@ addi a0 x0 4
 srl t1 t0 a0
 addi a0 x0 12
 srl t2 t0 a0
+addi a0 x0 44
+srl t3 t0 a0
 addi a0 x0 10
 ecall
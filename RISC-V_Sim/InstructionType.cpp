@@ -14,4 +14,80 @@ uint32_t InstructionTypeFunct3(const InstructionType type)
 uint32_t InstructionTypeFunct7(const InstructionType type)
 {
 	return static_cast<uint32_t>(type) >> 10;
+}
+
+bool IsInstructionType(const InstructionType type)
+{
+	switch (type)
+	{
+		case InstructionType::lb:
+		case InstructionType::lh:
+		case InstructionType::lw:
+		case InstructionType::lbu:
+		case InstructionType::lhu:
+		case InstructionType::fence:
+		case InstructionType::fence_i:
+		case InstructionType::addi:
+		case InstructionType::slli:
+		case InstructionType::slti:
+		case InstructionType::sltiu:
+		case InstructionType::xori:
+		case InstructionType::srli:
+		case InstructionType::srai:
+		case InstructionType::ori:
+		case InstructionType::andi:
+		case InstructionType::auipc:
+		case InstructionType::sb:
+		case InstructionType::sh:
+		case InstructionType::sw:
+		case InstructionType::add:
+		case InstructionType::sub:
+		case InstructionType::sll:
+		case InstructionType::slt:
+		case InstructionType::sltu:
+		case InstructionType::xor_:
+		case InstructionType::srl:
+		case InstructionType::sra:
+		case InstructionType::or_:
+		case InstructionType::and_:
+		case InstructionType::lui:
+		case InstructionType::beq:
+		case InstructionType::bne:
+		case InstructionType::blt:
+		case InstructionType::bge:
+		case InstructionType::bltu:
+		case InstructionType::bgeu:
+		case InstructionType::jalr:
+		case InstructionType::jal:
+		case InstructionType::ecall:
+		case InstructionType::ebreak:
+		case InstructionType::csrrw:
+		case InstructionType::csrrs:
+		case InstructionType::csrrc:
+		case InstructionType::csrrwi:
+		case InstructionType::csrrsi:
+		case InstructionType::csrrci:
+		case InstructionType::mul:
+		case InstructionType::mulh:
+		case InstructionType::mulhsu:
+		case InstructionType::mulhu:
+		case InstructionType::div:
+		case InstructionType::divu:
+		case InstructionType::rem:
+		case InstructionType::remu:
+		case InstructionType::lr_w:
+		case InstructionType::sc_w:
+		case InstructionType::amoswap_w:
+		case InstructionType::amoadd_w:
+		case InstructionType::amoxor_w:
+		case InstructionType::amoand_w:
+		case InstructionType::amoor_w:
+		case InstructionType::amomin_w:
+		case InstructionType::amomax_w:
+		case InstructionType::amominu_w:
+		case InstructionType::amomaxu_w:
+			return true;
+		default:
+			return false;
+	}
 }
\ No newline at end of file
@@ -59,9 +59,26 @@ enum class InstructionType : uint16_t
 	div	    = 0b000001'100'0110011,
 	divu	= 0b000001'101'0110011,
 	rem		= 0b000001'110'0110011,
-	remu	= 0b000001'111'0110011
+	remu	= 0b000001'111'0110011,
+
+	//the atomic instructions only use funct5 to identify the
+	//instruction, the last two bits of funct7 are the aq and rl bits
+	lr_w		= 0b000010'010'0101111,
+	sc_w		= 0b000011'010'0101111,
+	amoswap_w	= 0b000001'010'0101111,
+	amoadd_w	= 0b000000'010'0101111,
+	amoxor_w	= 0b000100'010'0101111,
+	amoand_w	= 0b001100'010'0101111,
+	amoor_w		= 0b001000'010'0101111,
+	amomin_w	= 0b010000'010'0101111,
+	amomax_w	= 0b010100'010'0101111,
+	amominu_w	= 0b011000'010'0101111,
+	amomaxu_w	= 0b011100'010'0101111
 };
 
 uint32_t InstructionTypeGetOpCode(const InstructionType type);
 uint32_t InstructionTypeFunct3(const InstructionType type);
-uint32_t InstructionTypeFunct7(const InstructionType type);
\ No newline at end of file
+uint32_t InstructionTypeFunct7(const InstructionType type);
+//the decoder creates a type from the opcode and funct fields without
+//checking that they are an instruction, this checks that they are
+bool IsInstructionType(const InstructionType type);
\ No newline at end of file
@@ -0,0 +1,377 @@
+#include "MultiHartSystem.h"
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include "Register.h"
+
+MultiHartSystem::MultiHartSystem(const std::shared_ptr<const DecodedProgram>& program, const uint32_t hartCount, const uint32_t* initialRegisters, const int32_t memorySize)
+{
+	if (hartCount == 0)
+	{
+		throw std::runtime_error("There has to be at least one hart.");
+	}
+	if (static_cast<int64_t>(hartCount) * HART_STACK_SIZE > memorySize)
+	{
+		throw std::runtime_error("Not enough memory for the stacks of " + std::to_string(hartCount) + " harts.");
+	}
+
+	//the harts write to the memory from different threads so
+	//it can't keep track of what has been written to
+	memory = std::make_shared<GuestMemory>(memorySize);
+	memory->MarkAllDirty();
+
+	for (uint32_t i = 0; i < hartCount; i++)
+	{
+		GuestContext context;
+		context.hart = Processor::CreateHartState(initialRegisters, memorySize);
+		context.hart.hartId = i;
+		context.hart.registers[static_cast<uint32_t>(Regs::sp)].word -= static_cast<int32_t>(i) * HART_STACK_SIZE;
+		context.program = program;
+		context.memory = memory;
+		context.status = GuestStatus::Runnable;
+		harts.push_back(std::move(context));
+	}
+}
+
+static void RunHart(GuestContext& context, const RunLimits& limits)
+{
+	Processor processor;
+	try
+	{
+		switch (processor.Continue(context, limits))
+		{
+			case RunStatus::Exited:
+				context.status = GuestStatus::Exited;
+				break;
+			case RunStatus::InstructionLimit:
+				context.status = GuestStatus::InstructionLimit;
+				break;
+			case RunStatus::Timeout:
+				context.status = GuestStatus::Timeout;
+				break;
+			case RunStatus::AtomicPending:
+				throw std::runtime_error("Hart stopped before an atomic instruction without being asked to.");
+			case RunStatus::BreakpointReached:
+			case RunStatus::WatchpointReached:
+				throw std::runtime_error("Hart stopped at a breakpoint without being asked to.");
+		}
+	}
+	catch (std::runtime_error& e)
+	{
+		context.status = GuestStatus::Error;
+		context.error = e.what();
+	}
+}
+
+void MultiHartSystem::Run(const RunLimits& limits)
+{
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < harts.size(); i++)
+	{
+		threads.emplace_back(RunHart, std::ref(harts[i]), std::cref(limits));
+	}
+	//no reason to have the calling thread wait
+	//for the others while it could run a hart
+	RunHart(harts[0], limits);
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
+
+//Threads that live for a whole deterministic run. A quantum is only a few thousand
+//instructions, so starting new threads for every quantum would take longer than running it.
+//The calling thread is used as the first worker
+class QuantumWorkers
+{
+private:
+	std::vector<std::thread> threads;
+	std::mutex lock;
+	std::condition_variable workReady;
+	std::condition_variable workDone;
+	const std::function<void(size_t, size_t)>* task = nullptr;
+	size_t taskCount = 0;
+	std::atomic<size_t> nextIndex;
+	uint64_t generation = 0;
+	size_t busyWorkers = 0;
+	bool stopping = false;
+	std::exception_ptr firstError;
+
+	void RunTask(const size_t workerIndex)
+	{
+		try
+		{
+			for (size_t index = nextIndex++; index < taskCount; index = nextIndex++)
+			{
+				(*task)(index, workerIndex);
+			}
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			if (!firstError)
+			{
+				firstError = std::current_exception();
+			}
+		}
+	}
+
+	void WorkerLoop(const size_t workerIndex)
+	{
+		uint64_t doneGeneration = 0;
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> guard(lock);
+				workReady.wait(guard, [&]() { return stopping || generation != doneGeneration; });
+				if (stopping)
+				{
+					return;
+				}
+				doneGeneration = generation;
+			}
+			RunTask(workerIndex);
+			std::lock_guard<std::mutex> guard(lock);
+			if (--busyWorkers == 0)
+			{
+				workDone.notify_one();
+			}
+		}
+	}
+
+public:
+	QuantumWorkers(const size_t threadCount) : nextIndex(0)
+	{
+		for (size_t i = 1; i < threadCount; i++)
+		{
+			threads.emplace_back(&QuantumWorkers::WorkerLoop, this, i);
+		}
+	}
+	QuantumWorkers(const QuantumWorkers&) = delete;
+	QuantumWorkers& operator=(const QuantumWorkers&) = delete;
+	~QuantumWorkers()
+	{
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			stopping = true;
+		}
+		workReady.notify_all();
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+	}
+
+	size_t GetThreadCount() const
+	{
+		return threads.size() + 1;
+	}
+
+	//calls work(index, workerIndex) for every index in [0, count) and waits for all of them
+	void ParallelFor(const size_t count, const std::function<void(size_t, size_t)>& work)
+	{
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			task = &work;
+			taskCount = count;
+			nextIndex = 0;
+			busyWorkers = threads.size();
+			generation++;
+		}
+		workReady.notify_all();
+		RunTask(0);
+
+		std::unique_lock<std::mutex> guard(lock);
+		workDone.wait(guard, [&]() { return busyWorkers == 0; });
+		if (firstError)
+		{
+			const std::exception_ptr error = firstError;
+			firstError = nullptr;
+			std::rethrow_exception(error);
+		}
+	}
+};
+
+//what a hart needs during a deterministic run. Every hart has its
+//own, so the workers never write to the same variable
+struct DeterministicHart
+{
+	//the copy of the memory the hart runs on, and the stores it did
+	//in the last quantum so they can be copied to the other harts
+	std::shared_ptr<GuestMemory> memory;
+	std::vector<GuestStore> stores;
+	bool atomicPending = false;
+};
+
+void MultiHartSystem::RunDeterministic(const uint64_t quantum, const RunLimits& limits, const size_t threadCount)
+{
+	if (quantum == 0)
+	{
+		throw std::runtime_error("The instruction quantum has to be larger than 0.");
+	}
+
+	const size_t hartCount = harts.size();
+	std::vector<DeterministicHart> states(hartCount);
+	for (size_t i = 0; i < hartCount; i++)
+	{
+		states[i].memory = std::make_shared<GuestMemory>(memory->GetSize());
+		states[i].memory->CopyFrom(*memory);
+		harts[i].memory = states[i].memory;
+	}
+
+	//more threads than harts would only wait
+	const size_t hostThreads = threadCount == 0 ? std::max<size_t>(1, std::thread::hardware_concurrency()) : threadCount;
+	QuantumWorkers pool(std::min(hostThreads, hartCount));
+	std::vector<std::unique_ptr<Processor>> processors(pool.GetThreadCount());
+	for (std::unique_ptr<Processor>& processor : processors)
+	{
+		processor = std::make_unique<Processor>();
+	}
+
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(limits.timeoutMilliseconds);
+	const auto isRunnable = [&](const size_t index)
+	{
+		return harts[index].status == GuestStatus::Runnable;
+	};
+
+	while (std::any_of(harts.begin(), harts.end(), [](const GuestContext& hart) { return hart.status == GuestStatus::Runnable; }))
+	{
+		if (limits.timeoutMilliseconds != 0 && std::chrono::steady_clock::now() >= deadline)
+		{
+			for (GuestContext& hart : harts)
+			{
+				if (hart.status == GuestStatus::Runnable)
+				{
+					hart.status = GuestStatus::Timeout;
+				}
+			}
+			break;
+		}
+
+		//run a quantum on every hart that isn't waiting to run an atomic instruction
+		pool.ParallelFor(hartCount, [&](const size_t index, const size_t worker)
+		{
+			GuestContext& hart = harts[index];
+			if (!isRunnable(index) || states[index].atomicPending)
+			{
+				return;
+			}
+
+			RunLimits quantumLimits;
+			quantumLimits.maxInstructions = std::min(quantum, limits.maxInstructions - hart.hart.retiredInstructions);
+			quantumLimits.stopBeforeAtomics = true;
+			states[index].memory->SetStoreLog(&states[index].stores);
+			try
+			{
+				const RunStatus status = processors[worker]->Continue(hart, quantumLimits);
+				if (status == RunStatus::Exited)
+				{
+					hart.status = GuestStatus::Exited;
+				}
+				else if (status == RunStatus::AtomicPending)
+				{
+					states[index].atomicPending = true;
+				}
+				else if (hart.hart.retiredInstructions >= limits.maxInstructions)
+				{
+					hart.status = GuestStatus::InstructionLimit;
+				}
+			}
+			catch (std::runtime_error& e)
+			{
+				hart.status = GuestStatus::Error;
+				hart.error = e.what();
+			}
+			states[index].memory->SetStoreLog(nullptr);
+		});
+
+		//make the stores visible in hart order. Every hart replays all
+		//the stores, also its own, so the memory of every hart ends up
+		//the same as if the stores were done one hart after the other
+		for (size_t i = 0; i < hartCount; i++)
+		{
+			memory->ApplyStores(states[i].stores);
+		}
+		pool.ParallelFor(hartCount, [&](const size_t index, const size_t)
+		{
+			for (size_t i = 0; i < hartCount; i++)
+			{
+				states[index].memory->ApplyStores(states[i].stores);
+			}
+		});
+		for (DeterministicHart& state : states)
+		{
+			state.stores.clear();
+		}
+
+		//atomic instructions are run one at a time, and the word they
+		//used is copied to all the other harts right after
+		for (size_t i = 0; i < hartCount; i++)
+		{
+			if (!states[i].atomicPending)
+			{
+				continue;
+			}
+			states[i].atomicPending = false;
+			if (!isRunnable(i))
+			{
+				continue;
+			}
+
+			GuestContext& hart = harts[i];
+			const Instruction& instruction = hart.program->GetInstructions()[hart.hart.pc / 4];
+			const int32_t address = hart.hart.registers[instruction.rs1].word;
+			RunLimits atomicLimits;
+			atomicLimits.maxInstructions = 1;
+			try
+			{
+				processors[0]->Continue(hart, atomicLimits);
+				if (hart.hart.retiredInstructions >= limits.maxInstructions)
+				{
+					hart.status = GuestStatus::InstructionLimit;
+				}
+
+				uint8_t word[4];
+				states[i].memory->CopyTo(address, sizeof(word), word);
+				memory->CopyFrom(address, sizeof(word), word);
+				for (size_t j = 0; j < hartCount; j++)
+				{
+					states[j].memory->CopyFrom(address, sizeof(word), word);
+				}
+			}
+			catch (std::runtime_error& e)
+			{
+				hart.status = GuestStatus::Error;
+				hart.error = e.what();
+			}
+		}
+	}
+
+	for (GuestContext& hart : harts)
+	{
+		hart.memory = memory;
+	}
+}
+
+uint32_t MultiHartSystem::GetHartCount() const
+{
+	return static_cast<uint32_t>(harts.size());
+}
+
+const GuestContext& MultiHartSystem::GetHart(const uint32_t hartId) const
+{
+	return harts.at(hartId);
+}
+
+GuestMemory& MultiHartSystem::GetMemory()
+{
+	return *memory;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Processor.h"
+#include "GuestContext.h"
+#include "GuestMemory.h"
+#include "DecodedProgram.h"
+
+//Several harts that run the same program and share one memory.
+//Each hart runs on its own host thread and can tell itself apart
+//from the others with the mhartid csr. Every hart gets its own
+//stack at the top of memory, hart 0 gets the same stack pointer
+//as a program running on a single hart.
+class MultiHartSystem
+{
+private:
+	std::shared_ptr<GuestMemory> memory;
+	std::vector<GuestContext> harts;
+
+public:
+	const static int32_t HART_STACK_SIZE = 2048;
+
+	MultiHartSystem(const std::shared_ptr<const DecodedProgram>& program, const uint32_t hartCount, const uint32_t* initialRegisters = nullptr, const int32_t memorySize = Processor::GetMemorySize());
+	MultiHartSystem(const MultiHartSystem&) = delete;
+	MultiHartSystem& operator=(const MultiHartSystem&) = delete;
+
+	//runs all harts until they have all stopped. The limits apply to each hart
+	void Run(const RunLimits& limits = RunLimits());
+	//Same as Run but the result only depends on the program and the quantum,
+	//not on the number of threads or how the host schedules them.
+	//The harts run quantum instructions at a time, in parallel on threadCount
+	//threads. Each hart only sees its own stores until all harts have finished
+	//their quantum, then the stores are made visible in hart order. Atomic
+	//instructions are run one hart at a time in hart order between quanta.
+	//The timeout is only checked between quanta.
+	void RunDeterministic(const uint64_t quantum, const RunLimits& limits = RunLimits(), const size_t threadCount = 0);
+	uint32_t GetHartCount() const;
+	const GuestContext& GetHart(const uint32_t hartId) const;
+	GuestMemory& GetMemory();
+};
@@ -5,39 +5,429 @@
 #include <algorithm>
 #include <memory>
 #include <vector>
+#include <cstring>
+#include <chrono>
+#include <atomic>
 #include "InstructionDecode.h"
 #include "Register.h"
+#include "TraceWindows.h"
 
 
 Processor::Processor()
 {
-	memory = new uint8_t[Processor::MEMORY_SIZE];
+	memory = std::make_shared<GuestMemory>(GetMemorySize());
 	Reset();
 }
 
 void Processor::Run(const uint32_t* rawInstructions, const size_t instructionCount)
+{
+	//comparing the raw instructions is a lot cheaper than decoding
+	//them again, so only decode if the program has changed
+	if (!program || !program->IsSameProgram(rawInstructions, instructionCount))
+	{
+		program = DecodeProgram(rawInstructions, instructionCount);
+	}
+
+	Run(program);
+}
+
+RunStatus Processor::Run(const std::shared_ptr<const DecodedProgram>& decodedProgram, const uint32_t* initialRegisters, const RunLimits& limits)
+{
+	Load(decodedProgram, initialRegisters);
+	return Continue(limits);
+}
+
+void Processor::Load(const std::shared_ptr<const DecodedProgram>& decodedProgram, const uint32_t* initialRegisters)
 {
 	Reset();
-	const std::unique_ptr<std::vector<Instruction>> instructions = DecodeInstructions(rawInstructions, instructionCount);
+	program = decodedProgram;
+	hart = CreateHartState(initialRegisters, memory->GetSize());
+	if (profiler)
+	{
+		profiler->StartProgram(hart.pc);
+	}
+	if (callGraph)
+	{
+		callGraph->StartProgram(hart.pc);
+	}
+	if (windows)
+	{
+		windows->Reset();
+	}
+}
+
+HartState Processor::CreateHartState(const uint32_t* initialRegisters, const int32_t memorySize)
+{
+	HartState state = {};
+	state.reservationAddress = -1;
+	if (initialRegisters)
+	{
+		for (uint32_t i = 1; i < 32; i++)
+		{
+			state.registers[i].uword = initialRegisters[i];
+		}
+	}
+	//set stack pointer unless a stack pointer was given
+	if (state.registers[static_cast<uint32_t>(Regs::sp)].word == 0)
+	{
+		state.registers[static_cast<uint32_t>(Regs::sp)].word = memorySize;
+	}
+	return state;
+}
+
+RunStatus Processor::Continue(const uint64_t maxInstructions)
+{
+	RunLimits limits;
+	limits.maxInstructions = maxInstructions;
+	return Continue(limits);
+}
+
+RunStatus Processor::Continue(const RunLimits& limits)
+{
+	if (!program)
+	{
+		throw std::runtime_error("No program has been loaded.");
+	}
+
+	//printing or waiting after each instruction is so slow
+	//that it doesn't matter that each instruction is checked
+	if (printExecutedInstruction || debugEnabled)
+	{
+		return ContinueDebug(limits);
+	}
+	//the stats, profilers and the trace are run in a separate version
+	//of the run loop so running without them doesn't check for them
+	if (stats || profiler || callGraph || tracer)
+	{
+		if (stats)
+		{
+			stats->StartProgram(program);
+		}
+		if (callGraph)
+		{
+			callGraph->UseProgram(program);
+		}
+		if (windows)
+		{
+			return ContinueWindows(limits);
+		}
+		return ContinueBlocks(limits, true);
+	}
+	return ContinueBlocks(limits, false);
+}
+
+RunStatus Processor::Continue(GuestContext& context, const RunLimits& limits)
+{
+	//swapping means that the processor gets its own state back
+	//afterwards, and that no reference counts have to be changed
+	const auto swapContext = [&]()
+	{
+		std::swap(hart, context.hart);
+		std::swap(program, context.program);
+		std::swap(memory, context.memory);
+	};
+
+	swapContext();
+	try
+	{
+		const RunStatus status = Continue(limits);
+		swapContext();
+		return status;
+	}
+	catch (...)
+	{
+		swapContext();
+		throw;
+	}
+}
+
+static uint64_t GetRetiredLimit(const uint64_t retiredInstructions, const uint64_t maxInstructions)
+{
+	return (maxInstructions > UINT64_MAX - retiredInstructions) ? UINT64_MAX : retiredInstructions + maxInstructions;
+}
+
+RunStatus Processor::ContinueBlocks(const RunLimits& limits, const bool instrumented)
+{
+	const bool watchMemory = limits.stopBeforeAccessLow < limits.stopBeforeAccessHigh;
+	if (engine == ExecutionEngine::Threaded)
+	{
+		if (instrumented)
+		{
+			return watchMemory ? ContinueBlocks<true, true, true>(limits) : ContinueBlocks<true, true, false>(limits);
+		}
+		return watchMemory ? ContinueBlocks<true, false, true>(limits) : ContinueBlocks<true, false, false>(limits);
+	}
+	if (instrumented)
+	{
+		return watchMemory ? ContinueBlocks<false, true, true>(limits) : ContinueBlocks<false, true, false>(limits);
+	}
+	return watchMemory ? ContinueBlocks<false, false, true>(limits) : ContinueBlocks<false, false, false>(limits);
+}
 
-	//set stack pointer
-	registers[static_cast<uint32_t>(Regs::sp)].word = Processor::MEMORY_SIZE;
+RunStatus Processor::ContinueWindows(const RunLimits& limits)
+{
+	if (limits.stopAtPc != RunLimits::NO_STOP_PC || limits.stopBeforeAccessLow < limits.stopBeforeAccessHigh)
+	{
+		throw std::runtime_error("Trace windows can't be used together with a breakpoint or watchpoint.");
+	}
 
+	const uint64_t retiredLimit = GetRetiredLimit(hart.retiredInstructions, limits.maxInstructions);
+	const bool hasTimeout = limits.timeoutMilliseconds != 0;
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(limits.timeoutMilliseconds);
+
+	//every window is its own run of the instrumented run loop, and the time between them
+	//is a run of the fast one that stops where the next window has to start
 	while (true)
 	{
-		const uint32_t instructionIndex = pc / 4;
+		if (hart.retiredInstructions >= retiredLimit)
+		{
+			return RunStatus::InstructionLimit;
+		}
+
+		RunLimits windowLimits = limits;
+		windowLimits.maxInstructions = retiredLimit - hart.retiredInstructions;
+		if (hasTimeout)
+		{
+			const int64_t remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+			if (remaining <= 0)
+			{
+				return RunStatus::Timeout;
+			}
+			windowLimits.timeoutMilliseconds = static_cast<uint64_t>(remaining);
+		}
+
+		const bool open = windows->Update(hart);
+		windows->SetLimits(hart, windowLimits);
+		const uint64_t retiredBefore = hart.retiredInstructions;
+		const RunStatus status = ContinueBlocks(windowLimits, open);
+		windows->FinishRun(hart, hart.retiredInstructions - retiredBefore, status);
+		if (status != RunStatus::InstructionLimit && status != RunStatus::BreakpointReached && status != RunStatus::WatchpointReached)
+		{
+			return status;
+		}
+	}
+}
+
+template<bool THREADED, bool INSTRUMENTED, bool WATCH_MEMORY>
+RunStatus Processor::ContinueBlocks(const RunLimits& limits)
+{
+	const Instruction* instructions = program->GetInstructions();
+	const ThreadedInstruction* threadedInstructions = program->GetThreadedInstructions();
+	const uint32_t* rawInstructions = program->GetRawInstructions();
+	const size_t instructionCount = program->GetInstructionCount();
+	const uint64_t retiredLimit = GetRetiredLimit(hart.retiredInstructions, limits.maxInstructions);
+	const uint64_t retiredAtStart = hart.retiredInstructions;
+	const uint32_t stopIndex = limits.stopAtPc / 4;
+	const uint32_t accessRangeSize = limits.stopBeforeAccessHigh - limits.stopBeforeAccessLow;
+	//between trace windows the profilers still have to know which function the program is in
+	const bool followCalls = !INSTRUMENTED && windows && (profiler || callGraph);
+
+	//reading the clock is slow compared to running a block
+	//so it's only checked once in a while
+	const uint32_t BLOCKS_PER_CLOCK_CHECK = 1024;
+	const bool hasTimeout = limits.timeoutMilliseconds != 0;
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(limits.timeoutMilliseconds);
+	uint32_t blocksUntilClockCheck = BLOCKS_PER_CLOCK_CHECK;
+
+	//the limits are only checked before each basic block.
+	//Inside a block the instructions can't jump anywhere
+	//so they are run without any checks
+	while (true)
+	{
+		const uint64_t remainingInstructions = retiredLimit - hart.retiredInstructions;
+		if (remainingInstructions == 0)
+		{
+			return RunStatus::InstructionLimit;
+		}
+		if (hasTimeout && --blocksUntilClockCheck == 0)
+		{
+			blocksUntilClockCheck = BLOCKS_PER_CLOCK_CHECK;
+			if (std::chrono::steady_clock::now() >= deadline)
+			{
+				return RunStatus::Timeout;
+			}
+		}
+
+		const uint32_t instructionIndex = hart.pc / 4;
 		if (instructionIndex >= instructionCount)
 		{
 			throw std::runtime_error("Index out of bounds.\nTried to access instruction: " + std::to_string(instructionIndex));
 		}
+		if (limits.stopBeforeAtomics && IsAtomicInstruction(instructions[instructionIndex].type))
+		{
+			return RunStatus::AtomicPending;
+		}
 
-		const Instruction& instruction = instructions->at(instructionIndex);
-		const bool stopProgram = RunInstruction(instruction);
+		if (blockLog)
+		{
+			blockLog->push_back(instructionIndex);
+		}
+
+		//don't run the whole block if that would exceed the instruction limit
+		uint32_t blockLength = static_cast<uint32_t>(std::min<uint64_t>(program->GetBlockLength(instructionIndex), remainingInstructions));
+		//or run past the pc to stop at. Without one this never
+		//matches since the index is checked to be in range above
+		const uint32_t instructionsUntilStop = stopIndex - instructionIndex;
+		if (instructionsUntilStop < blockLength)
+		{
+			if (instructionsUntilStop != 0)
+			{
+				blockLength = instructionsUntilStop;
+			}
+			else if (hart.retiredInstructions != retiredAtStart)
+			{
+				return RunStatus::BreakpointReached;
+			}
+		}
+
+		const Instruction* block = instructions + instructionIndex;
+		const ThreadedInstruction* threadedBlock = threadedInstructions + instructionIndex;
+		uint32_t i = 0;
+		try
+		{
+			for (; i < blockLength; i++)
+			{
+				if (WATCH_MEMORY && IsMemoryAccess(block[i].type) &&
+					TraceWriter::GetMemoryAddress(hart, block[i]) - limits.stopBeforeAccessLow < accessRangeSize &&
+					(i != 0 || hart.retiredInstructions != retiredAtStart))
+				{
+					if (INSTRUMENTED && i != 0)
+					{
+						CountBlock(block, instructionIndex, i);
+					}
+					hart.retiredInstructions += i;
+					return RunStatus::WatchpointReached;
+				}
+				//read before the instruction is run since it can change the registers
+				const uint32_t tracePc = hart.pc;
+				const uint32_t traceAddress = (INSTRUMENTED && tracer) ? TraceWriter::GetMemoryAddress(hart, block[i]) : 0;
+				if (THREADED && threadedBlock[i].handler)
+				{
+					threadedBlock[i].handler(hart, *memory, threadedBlock[i]);
+				}
+				else if (RunInstruction(block[i]))
+				{
+					if (INSTRUMENTED)
+					{
+						if (tracer)
+						{
+							tracer->Record(tracePc, rawInstructions[instructionIndex + i], block[i], hart, traceAddress);
+						}
+						CountBlock(block, instructionIndex, i + 1);
+					}
+					hart.retiredInstructions += i + 1;
+					return RunStatus::Exited;
+				}
+				if (INSTRUMENTED && tracer)
+				{
+					tracer->Record(tracePc, rawInstructions[instructionIndex + i], block[i], hart, traceAddress);
+				}
+			}
+		}
+		catch (...)
+		{
+			//the instructions before the one that threw have changed the
+			//registers and memory, so they have to be counted as retired
+			if (INSTRUMENTED && i != 0)
+			{
+				CountBlock(block, instructionIndex, i);
+			}
+			hart.retiredInstructions += i;
+			throw;
+		}
+		if (INSTRUMENTED)
+		{
+			CountBlock(block, instructionIndex, blockLength);
+		}
+		else if (followCalls)
+		{
+			FollowCalls(block[blockLength - 1]);
+		}
+		hart.retiredInstructions += blockLength;
+	}
+}
+
+void Processor::CountBlock(const Instruction* block, const uint32_t instructionIndex, const uint32_t length)
+{
+	if (stats)
+	{
+		stats->CountInstructions(instructionIndex, length);
+		//a branch can only be the last instruction of a block.
+		//A branch to the next instruction counts as not taken
+		const InstructionType lastType = block[length - 1].type;
+		if (InstructionTypeGetOpCode(lastType) == 0b1100011)
+		{
+			stats->CountBranch(hart.pc != (instructionIndex + length) * 4);
+		}
+	}
+	if (profiler)
+	{
+		profiler->ProfileBlock(block, instructionIndex, length, hart.pc);
+	}
+	if (callGraph)
+	{
+		callGraph->ProfileBlock(block, instructionIndex, length, hart.pc);
+	}
+}
 
-		if (printExecutedInstruction || debugEnabled)
+void Processor::FollowCalls(const Instruction& instruction)
+{
+	if (profiler)
+	{
+		profiler->FollowJump(instruction, hart.pc);
+	}
+	if (callGraph)
+	{
+		callGraph->FollowJump(instruction, hart.pc);
+	}
+}
+
+RunStatus Processor::ContinueDebug(const RunLimits& limits)
+{
+	const Instruction* instructions = program->GetInstructions();
+	const size_t instructionCount = program->GetInstructionCount();
+	const uint64_t retiredLimit = GetRetiredLimit(hart.retiredInstructions, limits.maxInstructions);
+	const uint64_t retiredAtStart = hart.retiredInstructions;
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(limits.timeoutMilliseconds);
+
+	while (true)
+	{
+		if (hart.retiredInstructions >= retiredLimit)
+		{
+			return RunStatus::InstructionLimit;
+		}
+		if (limits.timeoutMilliseconds != 0 && std::chrono::steady_clock::now() >= deadline)
 		{
-			std::cout << std::to_string(instructionIndex) << ": " << InstructionAsString(instruction) << std::endl;
+			return RunStatus::Timeout;
 		}
+
+		const uint32_t instructionIndex = hart.pc / 4;
+		if (instructionIndex >= instructionCount)
+		{
+			throw std::runtime_error("Index out of bounds.\nTried to access instruction: " + std::to_string(instructionIndex));
+		}
+		if (limits.stopBeforeAtomics && IsAtomicInstruction(instructions[instructionIndex].type))
+		{
+			return RunStatus::AtomicPending;
+		}
+
+		const Instruction& instruction = instructions[instructionIndex];
+		if (hart.retiredInstructions != retiredAtStart)
+		{
+			if (hart.pc == limits.stopAtPc)
+			{
+				return RunStatus::BreakpointReached;
+			}
+			if (IsMemoryAccess(instruction.type) &&
+				TraceWriter::GetMemoryAddress(hart, instruction) - limits.stopBeforeAccessLow < limits.stopBeforeAccessHigh - limits.stopBeforeAccessLow)
+			{
+				return RunStatus::WatchpointReached;
+			}
+		}
+		const bool stopProgram = RunInstruction(instruction);
+		hart.retiredInstructions++;
+
+		std::cout << std::to_string(instructionIndex) << ": " << InstructionAsString(instruction) << std::endl;
 		if (debugEnabled)
 		{
 			PrintRegisters();
@@ -46,11 +436,23 @@ void Processor::Run(const uint32_t* rawInstructions, const size_t instructionCou
 
 		if (stopProgram)
 		{
-			break;
+			return RunStatus::Exited;
 		}
 	}
 }
 
+//for the atomic instructions that the host
+//doesn't have a single atomic operation for
+template<typename Operation>
+static uint32_t AtomicFetchAndApply(std::atomic<uint32_t>& word, const Operation& operation)
+{
+	uint32_t expected = word.load();
+	while (!word.compare_exchange_weak(expected, operation(expected)))
+	{
+	}
+	return expected;
+}
+
 bool Processor::RunInstruction(const Instruction& instruction)
 {
 	bool stopProgram = false;
@@ -58,158 +460,170 @@ bool Processor::RunInstruction(const Instruction& instruction)
 	switch (instruction.type)
 	{
 		case InstructionType::lb:
-			registers[instruction.rd].word = static_cast<int32_t>(static_cast<int8_t>(GetByteFromMemory(registers[instruction.rs1].word + instruction.immediate)));
-			pc += 4;
+			hart.registers[instruction.rd].word = static_cast<int32_t>(static_cast<int8_t>(memory->GetByte(hart.registers[instruction.rs1].word + instruction.immediate)));
+			hart.pc += 4;
 			break;
 		case InstructionType::lh:
-			registers[instruction.rd].word = static_cast<int32_t>(static_cast<int16_t>(GetHalfWordFromMemory(registers[instruction.rs1].word + instruction.immediate)));
-			pc += 4;
+			hart.registers[instruction.rd].word = static_cast<int32_t>(static_cast<int16_t>(memory->GetHalfWord(hart.registers[instruction.rs1].word + instruction.immediate)));
+			hart.pc += 4;
 			break;
 		case InstructionType::lw: // no need to sign extend so don't cast
-			registers[instruction.rd].uword = GetWordFromMemory(registers[instruction.rs1].word + instruction.immediate);
-			pc += 4;
+			hart.registers[instruction.rd].uword = memory->GetWord(hart.registers[instruction.rs1].word + instruction.immediate);
+			hart.pc += 4;
 			break;
 		case InstructionType::lbu:
-			registers[instruction.rd].uword = static_cast<uint32_t>(GetByteFromMemory(registers[instruction.rs1].word + instruction.immediate));
-			pc += 4;
+			hart.registers[instruction.rd].uword = static_cast<uint32_t>(memory->GetByte(hart.registers[instruction.rs1].word + instruction.immediate));
+			hart.pc += 4;
 			break;
 		case InstructionType::lhu:
-			registers[instruction.rd].uword = static_cast<uint32_t>(GetHalfWordFromMemory(registers[instruction.rs1].word + instruction.immediate));
-			pc += 4;
+			hart.registers[instruction.rd].uword = static_cast<uint32_t>(memory->GetHalfWord(hart.registers[instruction.rs1].word + instruction.immediate));
+			hart.pc += 4;
+			break;
+		case InstructionType::fence: // all fences are treated as the strongest one
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			hart.pc += 4;
 			break;
-		case InstructionType::fence:
 		case InstructionType::fence_i:
 			throw std::runtime_error("Instruction not implemented yet.");
 		case InstructionType::addi:
-			registers[instruction.rd].word = registers[instruction.rs1].word + instruction.immediate;
-			pc += 4;
+			hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word + instruction.immediate;
+			hart.pc += 4;
 			break;
 		case InstructionType::slli:
-			registers[instruction.rd].word = registers[instruction.rs1].word << instruction.immediate;
-			pc += 4;
+			hart.registers[instruction.rd].uword = hart.registers[instruction.rs1].uword << instruction.immediate;
+			hart.pc += 4;
 			break;
 		case InstructionType::slti:
-			registers[instruction.rd].word = (registers[instruction.rs1].word < instruction.immediate) ? 1 : 0;
-			pc += 4;
+			hart.registers[instruction.rd].word = (hart.registers[instruction.rs1].word < instruction.immediate) ? 1 : 0;
+			hart.pc += 4;
 			break;
 		case InstructionType::sltiu: // special immediate cast
-			registers[instruction.rd].word = (registers[instruction.rs1].uword < static_cast<uint32_t>(instruction.immediate)) ? 1 : 0;
-			pc += 4;
+			hart.registers[instruction.rd].word = (hart.registers[instruction.rs1].uword < static_cast<uint32_t>(instruction.immediate)) ? 1 : 0;
+			hart.pc += 4;
 			break;
 		case InstructionType::xori:
-			registers[instruction.rd].word = registers[instruction.rs1].word ^ instruction.immediate;
-			pc += 4;
+			hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word ^ instruction.immediate;
+			hart.pc += 4;
 			break;
 		case InstructionType::srli: // special immediate cast
-			registers[instruction.rd].uword = registers[instruction.rs1].uword >> static_cast<uint32_t>(instruction.immediate);
-			pc += 4;
+			hart.registers[instruction.rd].uword = hart.registers[instruction.rs1].uword >> static_cast<uint32_t>(instruction.immediate);
+			hart.pc += 4;
 			break;
 		case InstructionType::srai:
-			registers[instruction.rd].word = registers[instruction.rs1].word >> instruction.immediate;
-			pc += 4;
+			hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word >> instruction.immediate;
+			hart.pc += 4;
 			break;
 		case InstructionType::ori:
-			registers[instruction.rd].word = registers[instruction.rs1].word | instruction.immediate;
-			pc += 4;
+			hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word | instruction.immediate;
+			hart.pc += 4;
 			break;
 		case InstructionType::andi:
-			registers[instruction.rd].word = registers[instruction.rs1].word & instruction.immediate;
-			pc += 4;
+			hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word & instruction.immediate;
+			hart.pc += 4;
 			break;
 		case InstructionType::auipc: // cast not needed but it helps to clarify that the immediate is unsigned for u type instructions
-			registers[instruction.rd].uword = pc + static_cast<uint32_t>(instruction.immediate);
-			pc += 4;
+			hart.registers[instruction.rd].uword = hart.pc + static_cast<uint32_t>(instruction.immediate);
+			hart.pc += 4;
 			break;
 		case InstructionType::sb:
-			StoreByteInMemory(registers[instruction.rs1].word + instruction.immediate, registers[instruction.rs2].byte);
-			pc += 4;
+			memory->StoreByte(hart.registers[instruction.rs1].word + instruction.immediate, hart.registers[instruction.rs2].byte);
+			hart.pc += 4;
 			break;
 		case InstructionType::sh:
-			StoreHalfWordInMemory(registers[instruction.rs1].word + instruction.immediate, registers[instruction.rs2].half);
-			pc += 4;
+			memory->StoreHalfWord(hart.registers[instruction.rs1].word + instruction.immediate, hart.registers[instruction.rs2].half);
+			hart.pc += 4;
 			break;
 		case InstructionType::sw:
-			StoreWordInMemory(registers[instruction.rs1].word + instruction.immediate, registers[instruction.rs2].word);
-			pc += 4;
+			memory->StoreWord(hart.registers[instruction.rs1].word + instruction.immediate, hart.registers[instruction.rs2].word);
+			hart.pc += 4;
 			break;
 		case InstructionType::add:
-			registers[instruction.rd].word = registers[instruction.rs1].word + registers[instruction.rs2].word;
-			pc += 4;
+			hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word + hart.registers[instruction.rs2].word;
+			hart.pc += 4;
 			break;
 		case InstructionType::sub:
-			registers[instruction.rd].word = registers[instruction.rs1].word - registers[instruction.rs2].word;
-			pc += 4;
+			hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word - hart.registers[instruction.rs2].word;
+			hart.pc += 4;
 			break;
 		case InstructionType::sll:
-			registers[instruction.rd].word = registers[instruction.rs1].word << registers[instruction.rs2].word;
-			pc += 4;
+			hart.registers[instruction.rd].uword = hart.registers[instruction.rs1].uword << (hart.registers[instruction.rs2].uword & 31);
+			hart.pc += 4;
 			break;
 		case InstructionType::slt:
-			registers[instruction.rd].word = (registers[instruction.rs1].word < registers[instruction.rs2].word) ? 1 : 0;
-			pc += 4;
+			hart.registers[instruction.rd].word = (hart.registers[instruction.rs1].word < hart.registers[instruction.rs2].word) ? 1 : 0;
+			hart.pc += 4;
 			break;
 		case InstructionType::sltu:
-			registers[instruction.rd].word = (registers[instruction.rs1].uword < registers[instruction.rs2].uword) ? 1 : 0;
-			pc += 4;
+			hart.registers[instruction.rd].word = (hart.registers[instruction.rs1].uword < hart.registers[instruction.rs2].uword) ? 1 : 0;
+			hart.pc += 4;
 			break;
 		case InstructionType::xor_:
-			registers[instruction.rd].word = registers[instruction.rs1].word ^ registers[instruction.rs2].word;
-			pc += 4;
+			hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word ^ hart.registers[instruction.rs2].word;
+			hart.pc += 4;
 			break;
 		case InstructionType::srl:
-			registers[instruction.rd].uword = registers[instruction.rs1].uword >> registers[instruction.rs2].uword;
-			pc += 4;
+			hart.registers[instruction.rd].uword = hart.registers[instruction.rs1].uword >> (hart.registers[instruction.rs2].uword & 31);
+			hart.pc += 4;
 			break;
 		case InstructionType::sra:
-			registers[instruction.rd].word = registers[instruction.rs1].word >> registers[instruction.rs2].word;
-			pc += 4;
+			hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word >> (hart.registers[instruction.rs2].uword & 31);
+			hart.pc += 4;
 			break;
 		case InstructionType::or_:
-			registers[instruction.rd].word = registers[instruction.rs1].word | registers[instruction.rs2].word;
-			pc += 4;
+			hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word | hart.registers[instruction.rs2].word;
+			hart.pc += 4;
 			break;
 		case InstructionType::and_:
-			registers[instruction.rd].word = registers[instruction.rs1].word & registers[instruction.rs2].word;
-			pc += 4;
+			hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word & hart.registers[instruction.rs2].word;
+			hart.pc += 4;
 			break;
 		case InstructionType::lui:
-			registers[instruction.rd].word = instruction.immediate;
-			pc += 4;
+			hart.registers[instruction.rd].word = instruction.immediate;
+			hart.pc += 4;
 			break;
 		case InstructionType::beq:
-			pc = (registers[instruction.rs1].word ==  registers[instruction.rs2].word)  ? pc + instruction.immediate : pc + 4;
+			hart.pc = (hart.registers[instruction.rs1].word ==  hart.registers[instruction.rs2].word)  ? hart.pc + instruction.immediate : hart.pc + 4;
 			break;
 		case InstructionType::bne:
-			pc = (registers[instruction.rs1].word !=  registers[instruction.rs2].word)  ? pc + instruction.immediate : pc + 4;
+			hart.pc = (hart.registers[instruction.rs1].word !=  hart.registers[instruction.rs2].word)  ? hart.pc + instruction.immediate : hart.pc + 4;
 			break;
 		case InstructionType::blt:
-			pc = (registers[instruction.rs1].word <   registers[instruction.rs2].word)  ? pc + instruction.immediate : pc + 4;
+			hart.pc = (hart.registers[instruction.rs1].word <   hart.registers[instruction.rs2].word)  ? hart.pc + instruction.immediate : hart.pc + 4;
 			break;
 		case InstructionType::bge:
-			pc = (registers[instruction.rs1].word >=  registers[instruction.rs2].word)  ? pc + instruction.immediate : pc + 4;
+			hart.pc = (hart.registers[instruction.rs1].word >=  hart.registers[instruction.rs2].word)  ? hart.pc + instruction.immediate : hart.pc + 4;
 			break;
 		case InstructionType::bltu:
-			pc = (registers[instruction.rs1].uword <  registers[instruction.rs2].uword) ? pc + instruction.immediate : pc + 4;
+			hart.pc = (hart.registers[instruction.rs1].uword <  hart.registers[instruction.rs2].uword) ? hart.pc + instruction.immediate : hart.pc + 4;
 			break;
 		case InstructionType::bgeu:
-			pc = (registers[instruction.rs1].uword >= registers[instruction.rs2].uword) ? pc + instruction.immediate : pc + 4;
+			hart.pc = (hart.registers[instruction.rs1].uword >= hart.registers[instruction.rs2].uword) ? hart.pc + instruction.immediate : hart.pc + 4;
 			break;
 		case InstructionType::jalr:
-			registers[instruction.rd].uword = pc + 4;
-			pc = registers[instruction.rs1].word + instruction.immediate;
+		{
+			//rd and rs1 can be the same register so the target has to be read first
+			//and the lowest bit of the target is always cleared
+			const uint32_t target = (hart.registers[instruction.rs1].word + instruction.immediate) & ~1u;
+			hart.registers[instruction.rd].uword = hart.pc + 4;
+			hart.pc = target;
 			break;
+		}
 		case InstructionType::jal:
-			registers[instruction.rd].uword = pc + 4;
-			pc = pc + instruction.immediate;
+			hart.registers[instruction.rd].uword = hart.pc + 4;
+			hart.pc = hart.pc + instruction.immediate;
 			break;
 		case InstructionType::ecall:
 			EnvironmentCall(&stopProgram);
-			pc += 4;
+			hart.pc += 4;
 			break;
 		case InstructionType::ebreak:
+			if (!interactiveBreakpoints && !debugEnabled)
+			{
+				throw std::runtime_error("The program stopped at an ebreak.\nebreak at pc " + std::to_string(hart.pc));
+			}
 			PrintRegisters();
 			std::cin.get();
-			pc += 4;
+			hart.pc += 4;
 			break;
 		case InstructionType::csrrw:
 		case InstructionType::csrrs:
@@ -217,82 +631,156 @@ bool Processor::RunInstruction(const Instruction& instruction)
 		case InstructionType::csrrwi:
 		case InstructionType::csrrsi:
 		case InstructionType::csrrci:
-			throw std::runtime_error("Instruction not implemented yet.");
+			hart.registers[instruction.rd].uword = AccessCSR(instruction);
+			hart.pc += 4;
+			break;
 		case InstructionType::mul:
-			registers[instruction.rd].word = registers[instruction.rs1].word * registers[instruction.rs2].word;
-			pc += 4;
+			hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word * hart.registers[instruction.rs2].word;
+			hart.pc += 4;
 			break;
 		case InstructionType::mulh:
-			registers[instruction.rd].word = static_cast<int32_t>((static_cast<int64_t>(registers[instruction.rs1].word) * static_cast<int64_t>(registers[instruction.rs2].word)) >> 32);
-			pc += 4;
+			hart.registers[instruction.rd].word = static_cast<int32_t>((static_cast<int64_t>(hart.registers[instruction.rs1].word) * static_cast<int64_t>(hart.registers[instruction.rs2].word)) >> 32);
+			hart.pc += 4;
 			break;
 		case InstructionType::mulhsu:
-			registers[instruction.rd].word = (static_cast<int64_t>(registers[instruction.rs1].word) * static_cast<uint64_t>(registers[instruction.rs2].uword)) >> 32;
-			pc += 4;
+			hart.registers[instruction.rd].word = (static_cast<int64_t>(hart.registers[instruction.rs1].word) * static_cast<uint64_t>(hart.registers[instruction.rs2].uword)) >> 32;
+			hart.pc += 4;
 			break;
 		case InstructionType::mulhu:
-			registers[instruction.rd].uword = static_cast<uint32_t>((static_cast<uint64_t>(registers[instruction.rs1].uword) * static_cast<uint64_t>(registers[instruction.rs2].uword)) >> 32);
-			pc += 4;
+			hart.registers[instruction.rd].uword = static_cast<uint32_t>((static_cast<uint64_t>(hart.registers[instruction.rs1].uword) * static_cast<uint64_t>(hart.registers[instruction.rs2].uword)) >> 32);
+			hart.pc += 4;
 			break;
 		case InstructionType::div:
-			if (registers[instruction.rs2].word == 0)
+			if (hart.registers[instruction.rs2].word == 0)
 			{
-				registers[instruction.rd].word = -1;
+				hart.registers[instruction.rd].word = -1;
 			}
-			else if (registers[instruction.rs1].word == INT32_MIN && registers[instruction.rs2].word == -1)
+			else if (hart.registers[instruction.rs1].word == INT32_MIN && hart.registers[instruction.rs2].word == -1)
 			{
-				registers[instruction.rd].word = registers[instruction.rs1].word;
+				hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word;
 			}
 			else
 			{
-				registers[instruction.rd].word = registers[instruction.rs1].word / registers[instruction.rs2].word;
+				hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word / hart.registers[instruction.rs2].word;
 			}
-			pc += 4;
+			hart.pc += 4;
 			break;
 		case InstructionType::divu:
-			if (registers[instruction.rs2].word == 0)
+			//dividing by zero sets all bits, the same as for div
+			if (hart.registers[instruction.rs2].word == 0)
 			{
-				registers[instruction.rd].uword = registers[instruction.rs1].uword;
+				hart.registers[instruction.rd].uword = UINT32_MAX;
 			}
 			else
 			{
-				registers[instruction.rd].uword = registers[instruction.rs1].uword / registers[instruction.rs2].uword;
+				hart.registers[instruction.rd].uword = hart.registers[instruction.rs1].uword / hart.registers[instruction.rs2].uword;
 			}
-			pc += 4;
+			hart.pc += 4;
 			break;
 		case InstructionType::rem:
-			if (registers[instruction.rs2].word == 0)
+			if (hart.registers[instruction.rs2].word == 0)
 			{
-				registers[instruction.rd].word = registers[instruction.rs1].word;
+				hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word;
 			}
-			else if (registers[instruction.rs1].word == INT32_MIN && registers[instruction.rs2].word == -1)
+			else if (hart.registers[instruction.rs1].word == INT32_MIN && hart.registers[instruction.rs2].word == -1)
 			{
-				registers[instruction.rd].word = 0;
+				hart.registers[instruction.rd].word = 0;
 			}
 			else
 			{
-				registers[instruction.rd].word = registers[instruction.rs1].word % registers[instruction.rs2].word;
+				hart.registers[instruction.rd].word = hart.registers[instruction.rs1].word % hart.registers[instruction.rs2].word;
 			}
-			pc += 4;
+			hart.pc += 4;
 			break;
 		case InstructionType::remu:
-			if (registers[instruction.rs2].uword == 0)
+			if (hart.registers[instruction.rs2].uword == 0)
 			{
-				registers[instruction.rd].uword = registers[instruction.rs1].uword;
+				hart.registers[instruction.rd].uword = hart.registers[instruction.rs1].uword;
 			}
 			else
 			{
-				registers[instruction.rd].uword = registers[instruction.rs1].uword % registers[instruction.rs2].uword;
+				hart.registers[instruction.rd].uword = hart.registers[instruction.rs1].uword % hart.registers[instruction.rs2].uword;
 			}
-			pc += 4;
+			hart.pc += 4;
+			break;
+		case InstructionType::lr_w:
+		{
+			const int32_t address = hart.registers[instruction.rs1].word;
+			hart.reservationValue = memory->GetAtomicWord(address).load();
+			hart.reservationAddress = address;
+			hart.registers[instruction.rd].uword = hart.reservationValue;
+			hart.pc += 4;
+			break;
+		}
+		case InstructionType::sc_w:
+		{
+			//the reservation is checked by comparing with the value lr.w loaded,
+			//so it doesn't need a lock. Like most emulators it doesn't notice
+			//if another hart changed the value and then changed it back again
+			const int32_t address = hart.registers[instruction.rs1].word;
+			std::atomic<uint32_t>& word = memory->GetAtomicWord(address);
+			uint32_t expected = hart.reservationValue;
+			const bool stored = hart.reservationAddress == address && word.compare_exchange_strong(expected, hart.registers[instruction.rs2].uword);
+			hart.reservationAddress = -1;
+			hart.registers[instruction.rd].uword = stored ? 0 : 1;
+			hart.pc += 4;
+			break;
+		}
+		case InstructionType::amoswap_w:
+			hart.registers[instruction.rd].uword = memory->GetAtomicWord(hart.registers[instruction.rs1].word).exchange(hart.registers[instruction.rs2].uword);
+			hart.pc += 4;
 			break;
+		case InstructionType::amoadd_w:
+			hart.registers[instruction.rd].uword = memory->GetAtomicWord(hart.registers[instruction.rs1].word).fetch_add(hart.registers[instruction.rs2].uword);
+			hart.pc += 4;
+			break;
+		case InstructionType::amoxor_w:
+			hart.registers[instruction.rd].uword = memory->GetAtomicWord(hart.registers[instruction.rs1].word).fetch_xor(hart.registers[instruction.rs2].uword);
+			hart.pc += 4;
+			break;
+		case InstructionType::amoand_w:
+			hart.registers[instruction.rd].uword = memory->GetAtomicWord(hart.registers[instruction.rs1].word).fetch_and(hart.registers[instruction.rs2].uword);
+			hart.pc += 4;
+			break;
+		case InstructionType::amoor_w:
+			hart.registers[instruction.rd].uword = memory->GetAtomicWord(hart.registers[instruction.rs1].word).fetch_or(hart.registers[instruction.rs2].uword);
+			hart.pc += 4;
+			break;
+		case InstructionType::amomin_w:
+		{
+			const int32_t value = hart.registers[instruction.rs2].word;
+			hart.registers[instruction.rd].uword = AtomicFetchAndApply(memory->GetAtomicWord(hart.registers[instruction.rs1].word), [value](const uint32_t old) { return static_cast<uint32_t>(std::min(static_cast<int32_t>(old), value)); });
+			hart.pc += 4;
+			break;
+		}
+		case InstructionType::amomax_w:
+		{
+			const int32_t value = hart.registers[instruction.rs2].word;
+			hart.registers[instruction.rd].uword = AtomicFetchAndApply(memory->GetAtomicWord(hart.registers[instruction.rs1].word), [value](const uint32_t old) { return static_cast<uint32_t>(std::max(static_cast<int32_t>(old), value)); });
+			hart.pc += 4;
+			break;
+		}
+		case InstructionType::amominu_w:
+		{
+			const uint32_t value = hart.registers[instruction.rs2].uword;
+			hart.registers[instruction.rd].uword = AtomicFetchAndApply(memory->GetAtomicWord(hart.registers[instruction.rs1].word), [value](const uint32_t old) { return std::min(old, value); });
+			hart.pc += 4;
+			break;
+		}
+		case InstructionType::amomaxu_w:
+		{
+			const uint32_t value = hart.registers[instruction.rs2].uword;
+			hart.registers[instruction.rd].uword = AtomicFetchAndApply(memory->GetAtomicWord(hart.registers[instruction.rs1].word), [value](const uint32_t old) { return std::max(old, value); });
+			hart.pc += 4;
+			break;
+		}
 		default:
 			throw std::runtime_error("instruction identifier not recognized. iid: " + NumberToBits(static_cast<uint32_t>(instruction.type)));
 			break;
 	}
 	//the 0'th register can only be 0
 	//so set it back to 0 in case it was changed
-	registers[static_cast<uint32_t>(Regs::x0)].word = 0;
+	hart.registers[static_cast<uint32_t>(Regs::x0)].word = 0;
 
 	return stopProgram;
 }
@@ -309,12 +797,34 @@ void Processor::PrintInstructions(const uint32_t* rawInstructions, const uint32_
 
 void Processor::EnvironmentCall(bool* stopProgram)
 {
-	if (registers[static_cast<uint32_t>(Regs::a0)].word == 10)
+	if (hart.registers[static_cast<uint32_t>(Regs::a0)].word == 10)
 	{
 		*stopProgram = true;
 	}
 }
 
+uint32_t Processor::AccessCSR(const Instruction& instruction)
+{
+	const uint32_t CSR_MHARTID = 0xf14;
+
+	//csrrs and csrrc with x0 or 0 only read the csr
+	const uint32_t csr = static_cast<uint32_t>(instruction.immediate) & 0xfff;
+	const bool writesCSR = instruction.type == InstructionType::csrrw ||
+						   instruction.type == InstructionType::csrrwi ||
+						   instruction.rs1 != 0;
+	switch (csr)
+	{
+		case CSR_MHARTID:
+			if (writesCSR)
+			{
+				throw std::runtime_error("Can't write to the read only csr mhartid.");
+			}
+			return hart.hartId;
+		default:
+			throw std::runtime_error("csr not implemented. csr: " + std::to_string(csr));
+	}
+}
+
 void Processor::CopyRegistersTo(uint32_t* copyTo)
 {
 	for (uint32_t i = 0; i < 32; i++)
@@ -322,7 +832,7 @@ void Processor::CopyRegistersTo(uint32_t* copyTo)
 		//don't copy stack pointer because the correct is wrong
 		if (i != static_cast<uint32_t>(Regs::sp))
 		{
-			copyTo[i] = registers[i].uword;
+			copyTo[i] = hart.registers[i].uword;
 		}
 		else 
 		{
@@ -331,106 +841,121 @@ void Processor::CopyRegistersTo(uint32_t* copyTo)
 	}
 }
 
-void Processor::SetDebugMode(const bool useDebugMode)
+void Processor::CopyMemoryTo(const int32_t address, const int32_t size, uint8_t* copyTo)
 {
-	debugEnabled = useDebugMode;
+	memory->CopyTo(address, size, copyTo);
 }
-void Processor::SetPrintExecutedInstruction(const bool value)
+
+void Processor::CopyMemoryFrom(const int32_t address, const int32_t size, const uint8_t* copyFrom)
 {
-	printExecutedInstruction = value;
+	memory->CopyFrom(address, size, copyFrom);
 }
 
-void Processor::PrintRegisters()
+void Processor::SetRegister(const uint32_t index, const uint32_t value)
 {
-	std::cout << "Registers:" << std::endl;
-	uint32_t index = 0;
-	for(Register x : registers)
+	if (index >= 32)
 	{
-		std::cout << std::setw(3) << RegisterName(index) << "  ";
-		std::cout << std::setw(10) << std::to_string(x.word) << "  ";
-		std::cout << NumberToBits(x.uword) << "   ";
-		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 0) << ": " << std::setw(10) << GetWordFromMemory(index * 4 + 32 * 4 * 0) << "  ";
-		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 1) << ": " << std::setw(10) << GetWordFromMemory(index * 4 + 32 * 4 * 1) << "  ";
-		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 2) << ": " << std::setw(10) << GetWordFromMemory(index * 4 + 32 * 4 * 2) << "  ";
-		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 3) << ": " << std::setw(10) << GetWordFromMemory(index * 4 + 32 * 4 * 3) << std::endl;
-		index++;
+		throw std::runtime_error("Invalid register index: " + std::to_string(index));
 	}
-	std::cout << std::endl;
-}
-
-void Processor::VerifyMemorySpace(const int32_t index, const int32_t size)
-{
-	if (index < 0 || index + size > Processor::MEMORY_SIZE)
+	//the 0'th register can only be 0
+	if (index != static_cast<uint32_t>(Regs::x0))
 	{
-		throw std::runtime_error("Memory access out of range.\nTried to access memory address " + std::to_string(index));
+		hart.registers[index].uword = value;
 	}
 }
 
-uint8_t Processor::GetByteFromMemory(const int32_t index)
+void Processor::SetPC(const uint32_t value)
 {
-	VerifyMemorySpace(index, 1);
-
-	return memory[index];
+	hart.pc = value;
 }
-uint16_t Processor::GetHalfWordFromMemory(const int32_t index)
+
+int32_t Processor::GetMemorySize()
 {
-	VerifyMemorySpace(index, 2);
+	return Processor::MEMORY_SIZE;
+}
 
-	const uint16_t t1 = static_cast<uint16_t>(memory[index + 0]);
-	const uint16_t t2 = static_cast<uint16_t>(memory[index + 1]);
+const HartState& Processor::GetHartState() const
+{
+	return hart;
+}
 
-	return (t1 << 0) |
-		   (t2 << 8);
+void Processor::SetDebugMode(const bool useDebugMode)
+{
+	debugEnabled = useDebugMode;
 }
-uint32_t Processor::GetWordFromMemory(const int32_t index)
+void Processor::SetInteractiveBreakpoints(const bool value)
 {
-	VerifyMemorySpace(index, 4);
-
-	const uint32_t t1 = static_cast<uint32_t>(memory[index + 0]);
-	const uint32_t t2 = static_cast<uint32_t>(memory[index + 1]);
-	const uint32_t t3 = static_cast<uint32_t>(memory[index + 2]);
-	const uint32_t t4 = static_cast<uint32_t>(memory[index + 3]);
-
-	return (t1 <<  0) |
-		   (t2 <<  8) |
-		   (t3 << 16) |
-		   (t4 << 24);
+	interactiveBreakpoints = value;
+}
+void Processor::SetPrintExecutedInstruction(const bool value)
+{
+	printExecutedInstruction = value;
+}
+void Processor::SetEngine(const ExecutionEngine value)
+{
+	engine = value;
+}
+ExecutionEngine Processor::GetEngine() const
+{
+	return engine;
+}
+void Processor::SetBlockLog(std::vector<uint32_t>* log)
+{
+	blockLog = log;
 }
 
-void Processor::StoreByteInMemory(const int32_t index, const int8_t byte)
+void Processor::SetExecutionStats(ExecutionStats* value)
 {
-	VerifyMemorySpace(index, 1);
+	stats = value;
+}
 
-	memory[index] = static_cast<uint8_t>(byte);
+void Processor::SetProfiler(GuestProfiler* value)
+{
+	profiler = value;
 }
-void Processor::StoreHalfWordInMemory(const int32_t index, const int16_t halfWord)
+
+void Processor::SetCallGraphProfiler(CallGraphProfiler* value)
 {
-	VerifyMemorySpace(index, 2);
+	callGraph = value;
+}
 
-	memory[index + 0] = static_cast<uint8_t>(static_cast<uint16_t>(halfWord) >> 0);
-	memory[index + 1] = static_cast<uint8_t>(static_cast<uint16_t>(halfWord) >> 8);
+void Processor::SetTraceWriter(TraceWriter* value)
+{
+	tracer = value;
 }
-void Processor::StoreWordInMemory(const int32_t index, const int32_t word)
+
+void Processor::SetTraceWindows(TraceWindows* value)
 {
-	VerifyMemorySpace(index, 4);
+	windows = value;
+}
 
-	memory[index + 0] = static_cast<uint8_t>(static_cast<uint32_t>(word) >>  0);
-	memory[index + 1] = static_cast<uint8_t>(static_cast<uint32_t>(word) >>  8);
-	memory[index + 2] = static_cast<uint8_t>(static_cast<uint32_t>(word) >> 16);
-	memory[index + 3] = static_cast<uint8_t>(static_cast<uint32_t>(word) >> 24);
+void Processor::PrintRegisters()
+{
+	std::cout << "Registers:" << std::endl;
+	uint32_t index = 0;
+	for(Register x : hart.registers)
+	{
+		std::cout << std::setw(3) << RegisterName(index) << "  ";
+		std::cout << std::setw(10) << std::to_string(x.word) << "  ";
+		std::cout << NumberToBits(x.uword) << "   ";
+		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 0) << ": " << std::setw(10) << memory->GetWord(index * 4 + 32 * 4 * 0) << "  ";
+		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 1) << ": " << std::setw(10) << memory->GetWord(index * 4 + 32 * 4 * 1) << "  ";
+		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 2) << ": " << std::setw(10) << memory->GetWord(index * 4 + 32 * 4 * 2) << "  ";
+		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 3) << ": " << std::setw(10) << memory->GetWord(index * 4 + 32 * 4 * 3) << std::endl;
+		index++;
+	}
+	std::cout << std::endl;
 }
 
 void Processor::Reset()
 {
-	std::fill(memory, memory + Processor::MEMORY_SIZE, 0);
+	memory->Clear();
 	for(uint32_t i = 0; i < 32; i++)
 	{
-		registers[i].word = 0;
+		hart.registers[i].word = 0;
 	}
-	pc = 0;
+	hart.pc = 0;
+	hart.retiredInstructions = 0;
+	hart.reservationAddress = -1;
 }
 
-Processor::~Processor()
-{
-	delete[] memory;
-}
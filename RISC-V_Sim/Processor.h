@@ -1,40 +1,139 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 #include "Instruction.h"
 #include "Register.h"
+#include "HartState.h"
+#include "DecodedProgram.h"
+#include "GuestMemory.h"
+#include "GuestContext.h"
+#include "ExecutionStats.h"
+#include "GuestProfiler.h"
+#include "CallGraphProfiler.h"
+#include "BinaryTrace.h"
+
+class TraceWindows;
+
+enum class RunStatus
+{
+	//the program stopped itself with an exit ecall
+	Exited,
+	//the program used all the instructions it was allowed to run
+	InstructionLimit,
+	//the program ran for longer than it was allowed to
+	Timeout,
+	//stopped right before an atomic instruction because
+	//the limits said to stop before atomic instructions
+	AtomicPending,
+	//stopped right before the instruction at the pc the limits said to stop at
+	BreakpointReached,
+	//stopped right before a memory access in the address range the limits said to stop at
+	WatchpointReached
+};
+
+enum class ExecutionEngine
+{
+	//runs every instruction with Processor::RunInstruction
+	Reference,
+	//calls a handler made for each instruction, see ThreadedEngine.h.
+	//Falls back to RunInstruction for the instructions it doesn't have a handler for
+	Threaded
+};
+
+struct RunLimits
+{
+	//no instruction can be at an odd address
+	static constexpr uint32_t NO_STOP_PC = UINT32_MAX;
+
+	uint64_t maxInstructions = UINT64_MAX;
+	//0 means that there is no time limit
+	uint64_t timeoutMilliseconds = 0;
+	//used to run atomic instructions while no other hart is running
+	bool stopBeforeAtomics = false;
+	//stop right before the instruction at this pc is run. It's only checked before each
+	//basic block, which is split at the pc, so running without it costs almost nothing.
+	//The first instruction that is run is never stopped at, so a run can continue from it
+	uint32_t stopAtPc = NO_STOP_PC;
+	//stop right before a load, store or atomic instruction with an address in [low, high).
+	//Every memory access has to be checked, so that's done in a separate version of the run loop
+	uint32_t stopBeforeAccessLow = 0;
+	uint32_t stopBeforeAccessHigh = 0;
+};
 
 class Processor
 {
 private:
 	const static int32_t MEMORY_SIZE = 0x00'00'7f'ff;
 
-	uint32_t pc = 0;
-	Register registers[32];
-	uint8_t* memory;
+	HartState hart;
+	std::shared_ptr<GuestMemory> memory;
+	//the last program that was run, so running the same
+	//program again doesn't require it to be decoded again
+	std::shared_ptr<const DecodedProgram> program;
 	bool debugEnabled = false;
+	//ebreak prints the registers and waits for a key press. Only the command line has someone
+	//to wait for, so everywhere else ebreak stops the program with an error
+	bool interactiveBreakpoints = false;
 	bool printExecutedInstruction = false;
+	ExecutionEngine engine = ExecutionEngine::Reference;
+	//when set the index of the first instruction of every block that is run is added to it.
+	//Only the block engines add to it, not the one that prints the instructions
+	std::vector<uint32_t>* blockLog = nullptr;
+	//when set the block engines count what they run in it
+	ExecutionStats* stats = nullptr;
+	//when set the block engines sample the pc with it
+	GuestProfiler* profiler = nullptr;
+	//when set the block engines count the instructions of every function in it
+	CallGraphProfiler* callGraph = nullptr;
+	//when set the block engines write every instruction they run to it
+	TraceWriter* tracer = nullptr;
+	//when set the stats, profilers and trace only see the instructions inside these windows
+	TraceWindows* windows = nullptr;
 
-	void VerifyMemorySpace(const int32_t index, const int32_t size);
-	uint8_t  GetByteFromMemory    (const int32_t index);
-	uint16_t GetHalfWordFromMemory(const int32_t index);
-	uint32_t GetWordFromMemory    (const int32_t index);
-	void StoreByteInMemory    (const int32_t index, const int8_t  byte    );
-	void StoreHalfWordInMemory(const int32_t index, const int16_t halfWord);
-	void StoreWordInMemory    (const int32_t index, const int32_t word    );
 	void EnvironmentCall(bool* stopProgram);
+	uint32_t AccessCSR(const Instruction& instruction);
+	RunStatus ContinueBlocks(const RunLimits& limits, const bool instrumented);
+	template<bool THREADED, bool INSTRUMENTED, bool WATCH_MEMORY>
+	RunStatus ContinueBlocks(const RunLimits& limits);
+	RunStatus ContinueWindows(const RunLimits& limits);
+	void CountBlock(const Instruction* block, const uint32_t instructionIndex, const uint32_t length);
+	void FollowCalls(const Instruction& instruction);
+	RunStatus ContinueDebug(const RunLimits& limits);
 
 public:
 	Processor();
+	Processor(const Processor&) = delete;
+	Processor& operator=(const Processor&) = delete;
 	void Run(const uint32_t* instructions, const size_t instructionCount);
+	RunStatus Run(const std::shared_ptr<const DecodedProgram>& decodedProgram, const uint32_t* initialRegisters = nullptr, const RunLimits& limits = RunLimits());
+	void Load(const std::shared_ptr<const DecodedProgram>& decodedProgram, const uint32_t* initialRegisters = nullptr);
+	RunStatus Continue(const uint64_t maxInstructions);
+	RunStatus Continue(const RunLimits& limits);
+	RunStatus Continue(GuestContext& context, const RunLimits& limits);
 	bool RunInstruction(const Instruction& instruction);
 	void PrintInstructions(const uint32_t* rawInstructions, const uint32_t instructionCount);
 	void PrintRegisters();
 	void SetDebugMode(const bool useDebugMode);
+	void SetInteractiveBreakpoints(const bool value);
 	void SetPrintExecutedInstruction(const bool value);
+	void SetEngine(const ExecutionEngine value);
+	ExecutionEngine GetEngine() const;
+	void SetBlockLog(std::vector<uint32_t>* log);
+	void SetExecutionStats(ExecutionStats* value);
+	void SetProfiler(GuestProfiler* value);
+	void SetCallGraphProfiler(CallGraphProfiler* value);
+	void SetTraceWriter(TraceWriter* value);
+	void SetTraceWindows(TraceWindows* value);
 	void CopyRegistersTo(uint32_t* copyTo);
+	void CopyMemoryTo(const int32_t address, const int32_t size, uint8_t* copyTo);
+	void CopyMemoryFrom(const int32_t address, const int32_t size, const uint8_t* copyFrom);
+	void SetRegister(const uint32_t index, const uint32_t value);
+	void SetPC(const uint32_t value);
+	const HartState& GetHartState() const;
+	static int32_t GetMemorySize();
+	static HartState CreateHartState(const uint32_t* initialRegisters, const int32_t memorySize);
 	void Reset();
-
-	~Processor();
 };
 
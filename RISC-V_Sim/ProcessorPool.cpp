@@ -0,0 +1,75 @@
+#include "ProcessorPool.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Processor.h"
+
+ProcessorPool::Lease::Lease(ProcessorPool* owner, std::unique_ptr<Processor> leased) : pool(owner), processor(std::move(leased))
+{ }
+
+ProcessorPool::Lease::Lease(Lease&& other) : pool(other.pool), processor(std::move(other.processor))
+{
+	other.pool = nullptr;
+}
+
+ProcessorPool::Lease::~Lease()
+{
+	if (pool && processor)
+	{
+		pool->Release(std::move(processor));
+	}
+}
+
+Processor& ProcessorPool::Lease::operator*() const
+{
+	return *processor;
+}
+
+Processor* ProcessorPool::Lease::operator->() const
+{
+	return processor.get();
+}
+
+ProcessorPool::ProcessorPool()
+{ }
+
+ProcessorPool::Lease ProcessorPool::Acquire()
+{
+	std::unique_ptr<Processor> processor;
+	{
+		std::lock_guard<std::mutex> guard(poolLock);
+		if (!idleProcessors.empty())
+		{
+			processor = std::move(idleProcessors.back());
+			idleProcessors.pop_back();
+		}
+	}
+
+	//only allocate a new processor when all the
+	//warm ones are in use
+	if (!processor)
+	{
+		processor = std::make_unique<Processor>();
+	}
+
+	return Lease(this, std::move(processor));
+}
+
+void ProcessorPool::Release(std::unique_ptr<Processor> processor)
+{
+	std::lock_guard<std::mutex> guard(poolLock);
+	idleProcessors.push_back(std::move(processor));
+}
+
+size_t ProcessorPool::IdleCount()
+{
+	std::lock_guard<std::mutex> guard(poolLock);
+	return idleProcessors.size();
+}
+
+ProcessorPool& ProcessorPool::Shared()
+{
+	static ProcessorPool sharedPool;
+	return sharedPool;
+}
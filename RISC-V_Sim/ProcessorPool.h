@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Processor.h"
+
+class ProcessorPool
+{
+private:
+	std::mutex poolLock;
+	std::vector<std::unique_ptr<Processor>> idleProcessors;
+
+	void Release(std::unique_ptr<Processor> processor);
+
+public:
+	//gives exclusive access to a processor from the pool
+	//and hands it back to the pool when it goes out of scope
+	class Lease
+	{
+	private:
+		ProcessorPool* pool;
+		std::unique_ptr<Processor> processor;
+
+	public:
+		Lease(ProcessorPool* owner, std::unique_ptr<Processor> leased);
+		Lease(Lease&& other);
+		Lease(const Lease&) = delete;
+		Lease& operator=(const Lease&) = delete;
+		~Lease();
+
+		Processor& operator*() const;
+		Processor* operator->() const;
+	};
+
+	ProcessorPool();
+	ProcessorPool(const ProcessorPool&) = delete;
+	ProcessorPool& operator=(const ProcessorPool&) = delete;
+
+	Lease Acquire();
+	size_t IdleCount();
+
+	static ProcessorPool& Shared();
+};
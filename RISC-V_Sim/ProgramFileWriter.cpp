@@ -0,0 +1,125 @@
+#include "ProgramFileWriter.h"
+#include <stdexcept>
+#include "Instruction.h"
+#include "InstructionDecode.h"
+
+//big enough that each write to the disk is worth it
+static const size_t BINARY_BUFFER_INSTRUCTIONS = 256 * 1024;
+static const size_t ASSEMBLY_BUFFER_BYTES = 4 * 1024 * 1024;
+
+ProgramFileWriter::ProgramFileWriter(const std::string& filepath, const bool writeAssemblyFile)
+{
+	binaryPath = filepath + ".bin";
+	assemblyPath = filepath + ".s";
+	instructionCount = 0;
+	writeAssembly = writeAssemblyFile;
+
+	binaryFile.open(binaryPath, std::ios::binary);
+	if (!binaryFile)
+	{
+		throw std::runtime_error("Failed to create file: " + binaryPath);
+	}
+	binaryBuffer.reserve(BINARY_BUFFER_INSTRUCTIONS);
+
+	if (writeAssembly)
+	{
+		assemblyFile.open(assemblyPath, std::ios::binary);
+		if (!assemblyFile)
+		{
+			throw std::runtime_error("Failed to create file: " + assemblyPath);
+		}
+		assemblyBuffer.reserve(ASSEMBLY_BUFFER_BYTES + 64);
+	}
+}
+
+void ProgramFileWriter::FlushBinary()
+{
+	binaryFile.write(reinterpret_cast<const char*>(binaryBuffer.data()), sizeof(uint32_t) * binaryBuffer.size());
+	binaryBuffer.clear();
+}
+
+void ProgramFileWriter::FlushAssembly()
+{
+	assemblyFile.write(assemblyBuffer.data(), assemblyBuffer.size());
+	assemblyBuffer.clear();
+}
+
+void ProgramFileWriter::AddInstruction(const uint32_t rawInstruction)
+{
+	binaryBuffer.push_back(rawInstruction);
+	if (binaryBuffer.size() == BINARY_BUFFER_INSTRUCTIONS)
+	{
+		FlushBinary();
+	}
+
+	if (writeAssembly)
+	{
+		assemblyBuffer += InstructionAsString(DecodeInstruction(rawInstruction));
+		assemblyBuffer += '\n';
+		if (assemblyBuffer.size() >= ASSEMBLY_BUFFER_BYTES)
+		{
+			FlushAssembly();
+		}
+	}
+	instructionCount++;
+}
+
+void ProgramFileWriter::AddInstruction(const MultiInstruction mInstruction)
+{
+	//same as RISCV_Program, 0 means the instruction isn't used
+	if (mInstruction.instruction1 != 0)
+	{
+		AddInstruction(mInstruction.instruction1);
+	}
+	if (mInstruction.instruction2 != 0)
+	{
+		AddInstruction(mInstruction.instruction2);
+	}
+}
+
+void ProgramFileWriter::AddInstructions(const uint32_t* rawInstructions, const size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		AddInstruction(rawInstructions[i]);
+	}
+}
+
+uint64_t ProgramFileWriter::GetInstructionCount() const
+{
+	return instructionCount;
+}
+
+void ProgramFileWriter::Close()
+{
+	if (binaryFile.is_open())
+	{
+		FlushBinary();
+		binaryFile.close();
+		if (!binaryFile)
+		{
+			throw std::runtime_error("Failed to write file: " + binaryPath);
+		}
+	}
+	if (assemblyFile.is_open())
+	{
+		FlushAssembly();
+		assemblyFile.close();
+		if (!assemblyFile)
+		{
+			throw std::runtime_error("Failed to write file: " + assemblyPath);
+		}
+	}
+}
+
+ProgramFileWriter::~ProgramFileWriter()
+{
+	//errors can only be reported by calling Close
+	try
+	{
+		Close();
+	}
+	catch (const std::exception&)
+	{
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "InstructionEncode.h"
+
+//Writes a program to a .bin file, and optionally a .s file, while it's
+//being created. Only a fixed size buffer is kept in memory so programs
+//can be much larger than the memory of the host.
+class ProgramFileWriter
+{
+private:
+	std::string binaryPath;
+	std::string assemblyPath;
+	std::ofstream binaryFile;
+	std::ofstream assemblyFile;
+	std::vector<uint32_t> binaryBuffer;
+	std::string assemblyBuffer;
+	uint64_t instructionCount;
+	bool writeAssembly;
+
+	void FlushBinary();
+	void FlushAssembly();
+
+public:
+	//filepath is without the file extension, like for RISCV_Program::Save
+	ProgramFileWriter(const std::string& filepath, const bool writeAssemblyFile);
+	ProgramFileWriter(const ProgramFileWriter&) = delete;
+	ProgramFileWriter& operator=(const ProgramFileWriter&) = delete;
+
+	void AddInstruction(const uint32_t rawInstruction);
+	void AddInstruction(const MultiInstruction mInstruction);
+	void AddInstructions(const uint32_t* rawInstructions, const size_t count);
+	uint64_t GetInstructionCount() const;
+	//writes what is left in the buffers and throws if any write failed
+	void Close();
+
+	~ProgramFileWriter();
+};
@@ -0,0 +1,89 @@
+#include "ProgramMinimizer.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "WorkStealingPool.h"
+
+//the instructions without chunk, or only chunk if keepOnlyChunk is set
+static std::vector<uint32_t> CreateCandidate(const std::vector<uint32_t>& instructions, const size_t chunkCount, const size_t chunk, const bool keepOnlyChunk)
+{
+	const size_t chunkStart = (instructions.size() * chunk) / chunkCount;
+	const size_t chunkEnd = (instructions.size() * (chunk + 1)) / chunkCount;
+
+	if (keepOnlyChunk)
+	{
+		return std::vector<uint32_t>(instructions.begin() + chunkStart, instructions.begin() + chunkEnd);
+	}
+
+	std::vector<uint32_t> candidate;
+	candidate.reserve(instructions.size() - (chunkEnd - chunkStart));
+	candidate.insert(candidate.end(), instructions.begin(), instructions.begin() + chunkStart);
+	candidate.insert(candidate.end(), instructions.begin() + chunkEnd, instructions.end());
+	return candidate;
+}
+
+MinimizeResult MinimizeProgram(const std::vector<uint32_t>& instructions, const FailureCheck& stillFails, const size_t threadCount)
+{
+	const WorkStealingPool pool(threadCount);
+	MinimizeResult result;
+	result.instructions = instructions;
+	result.checks = 0;
+
+	size_t chunkCount = 2;
+	while (result.instructions.size() >= 2)
+	{
+		chunkCount = std::min(chunkCount, result.instructions.size());
+
+		//first keeping only one chunk, which shrinks the program the most,
+		//then removing one chunk. With two chunks they are the same candidates
+		const size_t subsetCount = chunkCount > 2 ? chunkCount : 0;
+		const size_t candidateCount = subsetCount + chunkCount;
+		std::atomic<size_t> firstFailing(std::numeric_limits<size_t>::max());
+		std::atomic<uint64_t> checks(0);
+		pool.ParallelFor(candidateCount, [&](const size_t candidateIndex, const size_t)
+		{
+			//a later candidate can't be picked anymore
+			if (candidateIndex > firstFailing)
+			{
+				return;
+			}
+
+			const bool keepOnlyChunk = candidateIndex < subsetCount;
+			const size_t chunk = keepOnlyChunk ? candidateIndex : candidateIndex - subsetCount;
+			checks++;
+			if (stillFails(CreateCandidate(result.instructions, chunkCount, chunk, keepOnlyChunk)))
+			{
+				size_t current = firstFailing;
+				while (candidateIndex < current && !firstFailing.compare_exchange_weak(current, candidateIndex))
+				{
+				}
+			}
+		});
+		result.checks += checks;
+
+		const size_t failing = firstFailing;
+		if (failing < subsetCount)
+		{
+			result.instructions = CreateCandidate(result.instructions, chunkCount, failing, true);
+			chunkCount = 2;
+		}
+		else if (failing < candidateCount)
+		{
+			result.instructions = CreateCandidate(result.instructions, chunkCount, failing - subsetCount, false);
+			chunkCount = std::max<size_t>(chunkCount - 1, 2);
+		}
+		//every single instruction has been tried
+		else if (chunkCount == result.instructions.size())
+		{
+			break;
+		}
+		else
+		{
+			chunkCount *= 2;
+		}
+	}
+
+	return result;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+//returns true if the instructions still show the failure that is being minimized.
+//It's called from several threads at the same time
+using FailureCheck = std::function<bool(const std::vector<uint32_t>& instructions)>;
+
+struct MinimizeResult
+{
+	std::vector<uint32_t> instructions;
+	uint64_t checks;
+};
+
+//Shrinks a failing program with delta debugging. Chunks of instructions are
+//removed as long as the failure is still there, and the chunks are made smaller
+//until no single instruction can be removed. All the candidates of a step are
+//checked in parallel. The first candidate in order that still fails is kept,
+//so the result doesn't depend on the number of threads.
+MinimizeResult MinimizeProgram(const std::vector<uint32_t>& instructions, const FailureCheck& stillFails, const size_t threadCount = 0);
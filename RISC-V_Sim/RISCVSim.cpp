@@ -3,38 +3,75 @@
 #include <fstream>
 #include <string>
 #include <memory>
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+#include <chrono>
 #include "Processor.h"
 #include "TestEncodeDecode.h"
 #include "TestInstructions.h"
 #include "ReadProgram.h"
 #include "RISCV_Program.h"
 #include "TestRandomInstructions.h"
+#include "TestCApi.h"
+#include "TestSimulationServer.h"
+#include "TestGuestScheduler.h"
+#include "TestMultiHart.h"
+#include "TestProgramMinimizer.h"
+#include "TestCrossCheck.h"
+#include "TestCoverageFuzzer.h"
+#include "TestExecutionStats.h"
+#include "TestGuestProfiler.h"
+#include "TestBinaryTrace.h"
+#include "TestTraceWindows.h"
+#include "BatchRunner.h"
+#include "TestRegressions.h"
+#include "SimulationServer.h"
+#include "MultiHartSystem.h"
+#include "GuestContext.h"
+#include "FuzzCampaign.h"
+#include "CrossCheck.h"
+#include "DecodeVerifier.h"
+#include "CoverageFuzzer.h"
+#include "ExecutionStats.h"
+#include "GuestProfiler.h"
+#include "CallGraphProfiler.h"
+#include "BinaryTrace.h"
+#include "TraceWindows.h"
+#include "ElfSymbols.h"
+#include "RandomProgram.h"
+#include "ProgramFileWriter.h"
+#include "TSrandom.h"
 
-void testFile(std::string filePath)
-{
-	const std::unique_ptr<RISCV_Program> test = LoadProgram(filePath);
-	test->Test();
-
-	std::cout << "SUCCESS" << std::endl;
-}
+static const std::vector<std::string> regressionTestDirectories = { "tests", "InstructionTests" };
 
 int runAllTests()
 {
 	TestAllEncodeDecode();
 	TestAllInstructions();
 	TestRandomArithmeticInstructions();
+	TestFuzzCampaign();
+	TestStreamedRandomProgram();
+	TestAllProgramMinimizer();
+	TestAllCrossCheck();
+	TestAllCoverageFuzzer();
+	TestAllExecutionStats();
+	TestAllGuestProfiler();
+	TestAllBinaryTrace();
+	TestAllTraceWindows();
+	TestAllCApi();
+	TestAllSimulationServer();
+	TestAllGuestScheduler();
+	TestAllMultiHart();
 	try
 	{
-
-		testFile("tests/task1/addlarge");
-		testFile("tests/task1/addneg");
-		testFile("tests/task1/addpos");
-		testFile("tests/task1/shift");
-
-		testFile("tests/task2/branchcnt");
-		testFile("tests/task2/branchmany");
-
-		//testFile("tests/task3/loop");
+		//runs every program that has an expected result in the test folders.
+		//This includes the ones that were just created by the tests above
+		if (!TestAllRegressions(regressionTestDirectories, 0, "test_summary.json"))
+		{
+			std::cin.get();
+			return -1;
+		}
 	}
 	catch (std::runtime_error& e)
 	{
@@ -46,6 +83,996 @@ int runAllTests()
 	return 0;
 }
 
+int runRegressions(int argc, char* argv[])
+{
+	std::vector<std::string> directories;
+	std::string summaryPath = "test_summary.json";
+	size_t threadCount = 0;
+
+	try
+	{
+		for (int i = 2; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if ("-j" == argument && i + 1 < argc)
+			{
+				threadCount = std::stoul(argv[++i]);
+			}
+			else if ("-o" == argument && i + 1 < argc)
+			{
+				summaryPath = argv[++i];
+			}
+			else
+			{
+				directories.push_back(argument);
+			}
+		}
+
+		if (directories.empty())
+		{
+			directories = regressionTestDirectories;
+		}
+
+		return TestAllRegressions(directories, threadCount, summaryPath) ? 0 : 1;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+int runBatch(int argc, char* argv[])
+{
+	std::vector<std::string> programs;
+	std::string outputDirectory = "results";
+	size_t threadCount = 0;
+	RunLimits limits;
+
+	try
+	{
+		for (int i = 2; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if ("-j" == argument && i + 1 < argc)
+			{
+				threadCount = std::stoul(argv[++i]);
+			}
+			else if ("-o" == argument && i + 1 < argc)
+			{
+				outputDirectory = argv[++i];
+			}
+			else if ("--max-instructions" == argument && i + 1 < argc)
+			{
+				limits.maxInstructions = std::stoull(argv[++i]);
+			}
+			else if ("--timeout" == argument && i + 1 < argc)
+			{
+				limits.timeoutMilliseconds = std::stoull(argv[++i]);
+			}
+			else
+			{
+				const std::vector<std::string> found = FindBatchPrograms(argument);
+				programs.insert(programs.end(), found.begin(), found.end());
+			}
+		}
+
+		//the same program can be found through more than one of its files
+		std::sort(programs.begin(), programs.end());
+		programs.erase(std::unique(programs.begin(), programs.end()), programs.end());
+
+		if (programs.empty())
+		{
+			std::cout << "No programs to run" << std::endl;
+			return -1;
+		}
+
+		const std::vector<BatchResult> results = RunBatch(programs, outputDirectory, threadCount, limits);
+		std::filesystem::create_directories(outputDirectory);
+		SaveBatchSummary(results, outputDirectory + "/summary.csv");
+		PrintBatchSummary(results);
+
+		for (const BatchResult& result : results)
+		{
+			if (IsBatchFailure(result.status))
+			{
+				return 1;
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+
+	return 0;
+}
+
+static const char* GuestStatusName(const GuestStatus status)
+{
+	switch (status)
+	{
+		case GuestStatus::Runnable:
+			return "runnable";
+		case GuestStatus::Exited:
+			return "exited";
+		case GuestStatus::InstructionLimit:
+			return "instruction_limit";
+		case GuestStatus::Timeout:
+			return "timeout";
+		case GuestStatus::Error:
+			return "error";
+		default:
+			return "unknown";
+	}
+}
+
+int runServe(int argc, char* argv[])
+{
+	std::string socketPath;
+	//a program that never stops would otherwise hold its connection, or the
+	//whole server on stdin, forever. --timeout 0 turns the limit off
+	RunLimits limits;
+	limits.timeoutMilliseconds = 10000;
+	try
+	{
+		for (int i = 2; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if ("--max-instructions" == argument && i + 1 < argc)
+			{
+				limits.maxInstructions = std::stoull(argv[++i]);
+			}
+			else if ("--timeout" == argument && i + 1 < argc)
+			{
+				limits.timeoutMilliseconds = std::stoull(argv[++i]);
+			}
+			else if (socketPath.empty() && argument.rfind("--", 0) != 0)
+			{
+				socketPath = argument;
+			}
+			else
+			{
+				std::cout << "Usage: --serve [socket path] [--max-instructions N] [--timeout ms]" << std::endl;
+				return -1;
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+
+	if (!socketPath.empty())
+	{
+		return ServeUnixSocket(socketPath, limits);
+	}
+	return ServeStandardStreams(limits);
+}
+
+int runHarts(int argc, char* argv[])
+{
+	if (argc < 4)
+	{
+		std::cout << "Usage: --runHarts <program> <harts> [--max-instructions N] [--timeout ms] [--deterministic quantum] [-j threads]" << std::endl;
+		return -1;
+	}
+
+	try
+	{
+		const uint32_t hartCount = std::stoul(argv[3]);
+		RunLimits limits;
+		uint64_t deterministicQuantum = 0;
+		size_t threadCount = 0;
+		for (int i = 4; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if ("--deterministic" == argument && i + 1 < argc)
+			{
+				deterministicQuantum = std::stoull(argv[++i]);
+			}
+			else if ("-j" == argument && i + 1 < argc)
+			{
+				threadCount = std::stoul(argv[++i]);
+			}
+			else if ("--max-instructions" == argument && i + 1 < argc)
+			{
+				limits.maxInstructions = std::stoull(argv[++i]);
+			}
+			else if ("--timeout" == argument && i + 1 < argc)
+			{
+				limits.timeoutMilliseconds = std::stoull(argv[++i]);
+			}
+			else
+			{
+				std::cout << "Unknown argument: " << argument << std::endl;
+				return -1;
+			}
+		}
+
+		std::unique_ptr<RISCV_Program> program = LoadProgram(argv[2], false);
+		MultiHartSystem system(program->GetDecodedProgram(), hartCount);
+
+		const auto startTime = std::chrono::steady_clock::now();
+		if (deterministicQuantum != 0)
+		{
+			system.RunDeterministic(deterministicQuantum, limits, threadCount);
+		}
+		else
+		{
+			system.Run(limits);
+		}
+		const auto endTime = std::chrono::steady_clock::now();
+		const double milliseconds = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+		uint64_t totalInstructions = 0;
+		bool allExited = true;
+		for (uint32_t i = 0; i < system.GetHartCount(); i++)
+		{
+			const GuestContext& hart = system.GetHart(i);
+			totalInstructions += hart.hart.retiredInstructions;
+			allExited &= hart.status == GuestStatus::Exited;
+
+			std::cout << "hart " << i << ": " << GuestStatusName(hart.status) << ", " << hart.hart.retiredInstructions << " instructions";
+			if (hart.status == GuestStatus::Error)
+			{
+				std::cout << "\n" << hart.error;
+			}
+			std::cout << "\n";
+		}
+		std::cout << "time: " << milliseconds << " ms, " << (totalInstructions / 1000.0) / milliseconds << " MIPS" << std::endl;
+
+		return allExited ? 0 : 1;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+int runFuzz(int argc, char* argv[])
+{
+	FuzzOptions options;
+
+	try
+	{
+		for (int i = 2; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if ("--programs" == argument && i + 1 < argc)
+			{
+				options.programCount = std::stoull(argv[++i]);
+			}
+			else if ("--seconds" == argument && i + 1 < argc)
+			{
+				options.seconds = std::stod(argv[++i]);
+			}
+			else if ("--seed" == argument && i + 1 < argc)
+			{
+				options.seed = std::stoull(argv[++i]);
+			}
+			else if ("--size" == argument && i + 1 < argc)
+			{
+				options.programSize = std::stoull(argv[++i]);
+			}
+			else if ("--mix" == argument && i + 1 < argc)
+			{
+				options.mix = ParseInstructionMix(argv[++i]);
+			}
+			else if ("-j" == argument && i + 1 < argc)
+			{
+				options.threadCount = std::stoul(argv[++i]);
+			}
+			else if ("-o" == argument && i + 1 < argc)
+			{
+				options.failureDirectory = argv[++i];
+			}
+			else
+			{
+				std::cout << "Usage: --fuzz [--programs N] [--seconds S] [--seed N] [--size N] [--mix mix] [-j threads] [-o failure directory]" << std::endl;
+				return -1;
+			}
+		}
+
+		//don't run forever by accident
+		if (options.programCount == 0 && options.seconds == 0)
+		{
+			options.programCount = 100'000;
+		}
+
+		const FuzzReport report = RunFuzzCampaign(options);
+		PrintFuzzReport(report);
+		return report.failures == 0 ? 0 : 1;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+int runCoverageFuzz(int argc, char* argv[])
+{
+	CoverageFuzzOptions options;
+
+	try
+	{
+		for (int i = 2; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if ("--executions" == argument && i + 1 < argc)
+			{
+				options.executions = std::stoull(argv[++i]);
+			}
+			else if ("--seconds" == argument && i + 1 < argc)
+			{
+				options.seconds = std::stod(argv[++i]);
+			}
+			else if ("--seed" == argument && i + 1 < argc)
+			{
+				options.seed = std::stoull(argv[++i]);
+			}
+			else if ("--max-words" == argument && i + 1 < argc)
+			{
+				options.maxInputWords = std::stoull(argv[++i]);
+			}
+			else if ("--max-instructions" == argument && i + 1 < argc)
+			{
+				options.maxInstructions = std::stoull(argv[++i]);
+			}
+			else if ("--corpus" == argument && i + 1 < argc)
+			{
+				options.corpusDirectory = argv[++i];
+			}
+			else if ("-j" == argument && i + 1 < argc)
+			{
+				options.threadCount = std::stoul(argv[++i]);
+			}
+			else if ("-o" == argument && i + 1 < argc)
+			{
+				options.findingsDirectory = argv[++i];
+			}
+			else
+			{
+				std::cout << "Usage: --coverage-fuzz [--executions N] [--seconds S] [--seed N] [--max-words N] [--max-instructions N] [--corpus directory] [-j threads] [-o findings directory]" << std::endl;
+				return -1;
+			}
+		}
+
+		//don't run forever by accident
+		if (options.executions == 0 && options.seconds == 0)
+		{
+			options.seconds = 60;
+		}
+
+		const CoverageFuzzReport report = RunCoverageFuzzer(options);
+		PrintCoverageFuzzReport(report);
+		return report.findings == 0 ? 0 : 1;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+int runGenerate(int argc, char* argv[])
+{
+	if (argc < 4)
+	{
+		std::cout << "Usage: --generate <output path> <size> [--seed N] [--mix mix] [--stream [--assembly]]" << std::endl;
+		return -1;
+	}
+
+	try
+	{
+		const uint64_t size = std::stoull(argv[3]);
+		uint64_t seed = 1;
+		InstructionMix mix;
+		bool stream = false;
+		bool writeAssembly = false;
+		for (int i = 4; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if ("--seed" == argument && i + 1 < argc)
+			{
+				seed = std::stoull(argv[++i]);
+			}
+			else if ("--stream" == argument)
+			{
+				stream = true;
+			}
+			else if ("--assembly" == argument)
+			{
+				writeAssembly = true;
+			}
+			else if ("--mix" == argument && i + 1 < argc)
+			{
+				mix = ParseInstructionMix(argv[++i]);
+			}
+			else
+			{
+				std::cout << "Unknown argument: " << argument << std::endl;
+				return -1;
+			}
+		}
+
+		FRandom::TCRandom random = FRandom::CreateTCRandom(seed);
+		//programs that are too big for the memory are written while they
+		//are generated, they aren't run so there is no expected result
+		if (stream)
+		{
+			const auto startTime = std::chrono::steady_clock::now();
+			ProgramFileWriter writer(argv[2], writeAssembly);
+			WriteRandomProgram(mix, size, random, writer);
+			writer.Close();
+			const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+			const double megabytes = (writer.GetInstructionCount() * sizeof(uint32_t)) / (1024.0 * 1024.0);
+			std::cout << "Wrote " << writer.GetInstructionCount() << " instructions in " << seconds << " s, " << megabytes / seconds << " MiB/s" << std::endl;
+			return 0;
+		}
+
+		std::unique_ptr<RISCV_Program> program = CreateRandomProgram(mix, size, random);
+		program->Run();
+		program->ActualToExpectedRegisters();
+		program->Save(argv[2]);
+		std::cout << "Generated " << program->GetRetiredInstructions() << " executed instructions" << std::endl;
+		return 0;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+int runMinimize(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: --minimize <program> [-o output path] [-j threads] [--max-instructions N]" << std::endl;
+		return -1;
+	}
+
+	try
+	{
+		std::string outputPath = std::string(argv[2]) + "_min";
+		size_t threadCount = 0;
+		RunLimits limits;
+		limits.maxInstructions = 1'000'000;
+		for (int i = 3; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if ("-o" == argument && i + 1 < argc)
+			{
+				outputPath = argv[++i];
+			}
+			else if ("-j" == argument && i + 1 < argc)
+			{
+				threadCount = std::stoul(argv[++i]);
+			}
+			else if ("--max-instructions" == argument && i + 1 < argc)
+			{
+				limits.maxInstructions = std::stoull(argv[++i]);
+			}
+			else
+			{
+				std::cout << "Unknown argument: " << argument << std::endl;
+				return -1;
+			}
+		}
+
+		std::unique_ptr<RISCV_Program> program = LoadProgram(argv[2], false);
+		const auto startTime = std::chrono::steady_clock::now();
+		const MinimizeResult result = MinimizeFuzzFailure(program->GetInstructions(), limits, threadCount);
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+		RISCV_Program minimized(outputPath);
+		for (const uint32_t instruction : result.instructions)
+		{
+			minimized.AddInstruction(instruction);
+		}
+		minimized.Run(limits);
+		minimized.ActualToExpectedRegisters();
+		minimized.Save(outputPath);
+
+		std::cout << "Minimized " << program->GetInstructions().size() << " instructions to " << result.instructions.size() << " with " << result.checks << " checks in " << seconds << " s" << std::endl;
+		std::cout << "Saved to " << outputPath << std::endl;
+		return 0;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+int runCrossCheck(int argc, char* argv[])
+{
+	std::vector<std::string> programs;
+	CrossCheckOptions options;
+	size_t threadCount = 0;
+
+	try
+	{
+		for (int i = 2; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if ("-j" == argument && i + 1 < argc)
+			{
+				threadCount = std::stoul(argv[++i]);
+			}
+			else if ("--interval" == argument && i + 1 < argc)
+			{
+				options.interval = std::stoull(argv[++i]);
+			}
+			else if ("--max-instructions" == argument && i + 1 < argc)
+			{
+				options.maxInstructions = std::stoull(argv[++i]);
+			}
+			else if ("--compare-memory" == argument)
+			{
+				options.compareMemory = true;
+			}
+			else
+			{
+				const std::vector<std::string> found = FindBatchPrograms(argument);
+				programs.insert(programs.end(), found.begin(), found.end());
+			}
+		}
+
+		std::sort(programs.begin(), programs.end());
+		programs.erase(std::unique(programs.begin(), programs.end()), programs.end());
+		if (programs.empty())
+		{
+			std::cout << "Usage: --cross-check <programs, folders or patterns> [-j threads] [--interval N] [--max-instructions N] [--compare-memory]" << std::endl;
+			return -1;
+		}
+
+		const auto startTime = std::chrono::steady_clock::now();
+		const std::vector<CrossCheckResult> results = CrossCheckPrograms(programs, options, threadCount);
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+		uint64_t divergent = 0;
+		uint64_t loadFailures = 0;
+		uint64_t instructions = 0;
+		for (const CrossCheckResult& result : results)
+		{
+			if (!result.loadError.empty())
+			{
+				PrintCrossCheckResult(result);
+				loadFailures++;
+			}
+			else if (result.diverged)
+			{
+				PrintCrossCheckResult(result);
+				divergent++;
+			}
+			instructions += result.retiredInstructions;
+		}
+		std::cout << "Cross checked " << results.size() << " programs, " << divergent << " diverged, " << loadFailures << " failed to load, " <<
+			instructions << " instructions in " << seconds << " s" << std::endl;
+
+		return divergent == 0 && loadFailures == 0 ? 0 : 1;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+int runVerifyDecode(int argc, char* argv[])
+{
+	uint64_t firstWord = 0;
+	uint64_t wordCount = uint64_t(1) << 32;
+	size_t threadCount = 0;
+
+	try
+	{
+		for (int i = 2; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if ("--first" == argument && i + 1 < argc)
+			{
+				firstWord = std::stoull(argv[++i], nullptr, 0);
+			}
+			else if ("--count" == argument && i + 1 < argc)
+			{
+				wordCount = std::stoull(argv[++i], nullptr, 0);
+			}
+			else if ("-j" == argument && i + 1 < argc)
+			{
+				threadCount = std::stoul(argv[++i]);
+			}
+			else
+			{
+				std::cout << "Usage: --verify-decode [--first word] [--count words] [-j threads]" << std::endl;
+				return -1;
+			}
+		}
+
+		const DecodeVerifyReport report = VerifyEncodeDecode(firstWord, wordCount, threadCount);
+		PrintDecodeVerifyReport(report);
+		return report.verdicts[static_cast<uint32_t>(DecodeVerdict::Mismatch)] == 0 ? 0 : 1;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+int runStats(int argc, char* argv[])
+{
+	std::vector<std::string> programs;
+	RunLimits limits;
+	std::string jsonPath;
+	bool threaded = false;
+
+	try
+	{
+		for (int i = 2; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if ("--json" == argument && i + 1 < argc)
+			{
+				jsonPath = argv[++i];
+			}
+			else if ("--max-instructions" == argument && i + 1 < argc)
+			{
+				limits.maxInstructions = std::stoull(argv[++i]);
+			}
+			else if ("--threaded" == argument)
+			{
+				threaded = true;
+			}
+			else
+			{
+				const std::vector<std::string> found = FindBatchPrograms(argument);
+				programs.insert(programs.end(), found.begin(), found.end());
+			}
+		}
+
+		std::sort(programs.begin(), programs.end());
+		programs.erase(std::unique(programs.begin(), programs.end()), programs.end());
+		if (programs.empty())
+		{
+			std::cout << "Usage: --stats <programs, folders or patterns> [--threaded] [--max-instructions N] [--json path]" << std::endl;
+			return -1;
+		}
+
+		Processor processor;
+		ExecutionStats stats;
+		processor.SetEngine(threaded ? ExecutionEngine::Threaded : ExecutionEngine::Reference);
+		processor.SetExecutionStats(&stats);
+		uint64_t failed = 0;
+		for (const std::string& path : programs)
+		{
+			//a program that fails still counts the blocks it finished before the error
+			try
+			{
+				LoadProgram(path, false)->Run(processor, limits);
+			}
+			catch (const std::exception& e)
+			{
+				std::cout << path << ": " << e.what() << std::endl;
+				failed++;
+			}
+		}
+
+		const ExecutionStatsReport report = stats.GetReport();
+		std::cout << "Ran " << programs.size() << " programs, " << failed << " failed" << std::endl;
+		PrintExecutionStats(report);
+		if (!jsonPath.empty())
+		{
+			SaveExecutionStatsJson(report, jsonPath);
+		}
+		return failed == 0 ? 0 : 1;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+//reads the arguments that limit --profile and --trace to windows of the run.
+//Returns false if the argument isn't one of them
+static bool ParseTraceWindowArgument(const int argc, char* argv[], int& i, TraceWindowOptions& options, bool& useWindows)
+{
+	const std::string argument = argv[i];
+	if ("--start-pc" == argument && i + 1 < argc)
+	{
+		options.startPc = std::stoul(argv[++i], nullptr, 0);
+	}
+	else if ("--stop-pc" == argument && i + 1 < argc)
+	{
+		options.stopPc = std::stoul(argv[++i], nullptr, 0);
+	}
+	else if ("--start-after" == argument && i + 1 < argc)
+	{
+		options.startInstruction = std::stoull(argv[++i]);
+	}
+	else if ("--start-on-access" == argument && i + 2 < argc)
+	{
+		options.startAccessLow = std::stoul(argv[++i], nullptr, 0);
+		options.startAccessHigh = std::stoul(argv[++i], nullptr, 0);
+	}
+	else if ("--window-length" == argument && i + 1 < argc)
+	{
+		options.windowLength = std::stoull(argv[++i]);
+	}
+	else
+	{
+		return false;
+	}
+	useWindows = true;
+	return true;
+}
+
+int runProfile(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: --profile <program> [--interval N] [--exact [--paths N]] [--symbols elf file] [--symbol-base address] [--threaded] [--max-instructions N] [-o output]" << std::endl;
+		std::cout << "       [--start-pc pc] [--stop-pc pc] [--start-after N] [--start-on-access low high] [--window-length N]" << std::endl;
+		return -1;
+	}
+
+	try
+	{
+		const std::string programPath = argv[2];
+		uint64_t interval = 100;
+		//the symbols of program.elf are used if it's there
+		std::string symbolsPath = programPath + ".elf";
+		uint32_t symbolBase = 0;
+		std::string outputPath = "profile.folded";
+		RunLimits limits;
+		bool threaded = false;
+		bool exact = false;
+		size_t pathCount = 10;
+		TraceWindowOptions windowOptions;
+		bool useWindows = false;
+		for (int i = 3; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if (ParseTraceWindowArgument(argc, argv, i, windowOptions, useWindows))
+			{
+				continue;
+			}
+			if ("--interval" == argument && i + 1 < argc)
+			{
+				interval = std::stoull(argv[++i]);
+			}
+			else if ("--exact" == argument)
+			{
+				exact = true;
+			}
+			else if ("--paths" == argument && i + 1 < argc)
+			{
+				pathCount = std::stoull(argv[++i]);
+			}
+			else if ("--symbols" == argument && i + 1 < argc)
+			{
+				symbolsPath = argv[++i];
+			}
+			else if ("--symbol-base" == argument && i + 1 < argc)
+			{
+				symbolBase = std::stoul(argv[++i], nullptr, 0);
+			}
+			else if ("--threaded" == argument)
+			{
+				threaded = true;
+			}
+			else if ("--max-instructions" == argument && i + 1 < argc)
+			{
+				limits.maxInstructions = std::stoull(argv[++i]);
+			}
+			else if ("-o" == argument && i + 1 < argc)
+			{
+				outputPath = argv[++i];
+			}
+			else
+			{
+				std::cout << "Unknown argument: " << argument << std::endl;
+				return -1;
+			}
+		}
+
+		SymbolTable symbols;
+		if (std::filesystem::exists(symbolsPath))
+		{
+			symbols = ReadElfSymbols(symbolsPath, symbolBase);
+			std::cout << "Read " << symbols.GetSymbolCount() << " symbols from " << symbolsPath << std::endl;
+		}
+
+		Processor processor;
+		GuestProfiler profiler(interval);
+		CallGraphProfiler callGraph;
+		TraceWindows windows(windowOptions);
+		processor.SetEngine(threaded ? ExecutionEngine::Threaded : ExecutionEngine::Reference);
+		if (useWindows)
+		{
+			processor.SetTraceWindows(&windows);
+		}
+		//the exact profiler counts every instruction so it doesn't need the samples
+		if (exact)
+		{
+			processor.SetCallGraphProfiler(&callGraph);
+		}
+		else
+		{
+			processor.SetProfiler(&profiler);
+		}
+		std::unique_ptr<RISCV_Program> program = LoadProgram(programPath, false);
+		//the samples up to an error are still worth looking at
+		try
+		{
+			program->Run(processor, limits);
+		}
+		catch (const std::exception& e)
+		{
+			std::cout << e.what() << std::endl;
+		}
+
+		std::ofstream output(outputPath);
+		if (!output)
+		{
+			throw std::runtime_error("Failed to create file: " + outputPath);
+		}
+		if (exact)
+		{
+			callGraph.WriteFoldedStacks(output, symbols);
+			PrintCallGraphReport(callGraph.GetReport(symbols, pathCount));
+		}
+		else
+		{
+			profiler.WriteFoldedStacks(output, symbols);
+			std::cout << profiler.GetSampleCount() << " samples of " << processor.GetHartState().retiredInstructions << " instructions" << std::endl;
+			const std::vector<std::pair<std::string, uint64_t>> hottest = profiler.GetHottestFunctions(symbols);
+			for (size_t i = 0; i < std::min<size_t>(hottest.size(), 10); i++)
+			{
+				std::cout << "  " << hottest[i].first << ": " << hottest[i].second << std::endl;
+			}
+		}
+		if (useWindows)
+		{
+			std::cout << "Profiled " << windows.GetWindowInstructions() << " of " << processor.GetHartState().retiredInstructions << " instructions in " << windows.GetWindowCount() << " windows" << std::endl;
+		}
+		std::cout << "Saved folded stacks to " << outputPath << std::endl;
+		return 0;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+int runTrace(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: --trace <program> [-o output] [--threaded] [--sync] [--max-instructions N]" << std::endl;
+		std::cout << "       [--start-pc pc] [--stop-pc pc] [--start-after N] [--start-on-access low high] [--window-length N]" << std::endl;
+		return -1;
+	}
+
+	try
+	{
+		const std::string programPath = argv[2];
+		std::string outputPath = programPath + ".rvtrace";
+		RunLimits limits;
+		bool threaded = false;
+		//the trace is encoded and written on another thread unless it's sync
+		size_t ringSize = 1 << 16;
+		TraceWindowOptions windowOptions;
+		bool useWindows = false;
+		for (int i = 3; i < argc; i++)
+		{
+			const std::string argument = argv[i];
+			if (ParseTraceWindowArgument(argc, argv, i, windowOptions, useWindows))
+			{
+				continue;
+			}
+			if ("-o" == argument && i + 1 < argc)
+			{
+				outputPath = argv[++i];
+			}
+			else if ("--threaded" == argument)
+			{
+				threaded = true;
+			}
+			else if ("--sync" == argument)
+			{
+				ringSize = 0;
+			}
+			else if ("--max-instructions" == argument && i + 1 < argc)
+			{
+				limits.maxInstructions = std::stoull(argv[++i]);
+			}
+			else
+			{
+				std::cout << "Unknown argument: " << argument << std::endl;
+				return -1;
+			}
+		}
+
+		std::unique_ptr<RISCV_Program> program = LoadProgram(programPath, false);
+		Processor processor;
+		TraceWriter trace(outputPath, 1 << 20, ringSize);
+		TraceWindows windows(windowOptions);
+		processor.SetEngine(threaded ? ExecutionEngine::Threaded : ExecutionEngine::Reference);
+		if (useWindows)
+		{
+			processor.SetTraceWindows(&windows);
+		}
+		processor.SetTraceWriter(&trace);
+		const auto startTime = std::chrono::steady_clock::now();
+		//the trace up to an error is what is needed to find it
+		try
+		{
+			program->Run(processor, limits);
+		}
+		catch (const std::exception& e)
+		{
+			std::cout << e.what() << std::endl;
+		}
+		trace.Close();
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+		std::cout << "Traced " << trace.GetRecordCount() << " instructions to " << outputPath << " in " << seconds << " s, " <<
+			(trace.GetRecordCount() == 0 ? 0.0 : static_cast<double>(trace.GetByteCount()) / trace.GetRecordCount()) << " bytes per instruction" << std::endl;
+		if (useWindows)
+		{
+			std::cout << "Traced " << windows.GetWindowInstructions() << " of " << processor.GetHartState().retiredInstructions << " instructions in " << windows.GetWindowCount() << " windows" << std::endl;
+		}
+		return 0;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+int runTraceToText(int argc, char* argv[])
+{
+	if (argc != 3 && !(argc == 5 && "-o" == std::string(argv[3])))
+	{
+		std::cout << "Usage: --trace-to-text <trace> [-o output]" << std::endl;
+		return -1;
+	}
+
+	try
+	{
+		if (argc == 5)
+		{
+			std::ofstream output(argv[4]);
+			if (!output)
+			{
+				throw std::runtime_error("Failed to create file: " + std::string(argv[4]));
+			}
+			ConvertTraceToText(argv[2], output);
+		}
+		else
+		{
+			ConvertTraceToText(argv[2], std::cout);
+		}
+		return 0;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
 int main(int argc, char* argv[])
 {	
 	//if no arguments then run all tests
@@ -58,6 +1085,77 @@ int main(int argc, char* argv[])
 	{
 		return runAllTests();
 	}
+	//only run the test programs in the test folders
+	else if ("--testRegressions" == std::string(argv[1]))
+	{
+		return runRegressions(argc, argv);
+	}
+	//keep running and simulate the programs that are sent to
+	//the simulator, either through a socket or stdin and stdout
+	else if ("--serve" == std::string(argv[1]))
+	{
+		return runServe(argc, argv);
+	}
+	//run many programs in parallel without waiting for input
+	else if ("--batch" == std::string(argv[1]))
+	{
+		return runBatch(argc, argv);
+	}
+	//run one program on several harts that share memory
+	else if ("--runHarts" == std::string(argv[1]))
+	{
+		return runHarts(argc, argv);
+	}
+	//check lots of random programs in memory to find simulator bugs
+	else if ("--fuzz" == std::string(argv[1]))
+	{
+		return runFuzz(argc, argv);
+	}
+	//mutate instruction words and keep the ones that reach new coverage
+	else if ("--coverage-fuzz" == std::string(argv[1]))
+	{
+		return runCoverageFuzz(argc, argv);
+	}
+	//shrink a program that fails the fuzz checks
+	else if ("--minimize" == std::string(argv[1]))
+	{
+		return runMinimize(argc, argv);
+	}
+	//run programs on the reference and threaded engine and compare them
+	else if ("--cross-check" == std::string(argv[1]))
+	{
+		return runCrossCheck(argc, argv);
+	}
+	//check that every instruction word decodes and encodes back the same
+	else if ("--verify-decode" == std::string(argv[1]))
+	{
+		return runVerifyDecode(argc, argv);
+	}
+	//count the instructions, branches and memory accesses that programs run
+	else if ("--stats" == std::string(argv[1]))
+	{
+		return runStats(argc, argv);
+	}
+	//sample where a program spends its time
+	else if ("--profile" == std::string(argv[1]))
+	{
+		return runProfile(argc, argv);
+	}
+	//write every instruction a program runs to a compact binary trace
+	else if ("--trace" == std::string(argv[1]))
+	{
+		return runTrace(argc, argv);
+	}
+	//print a binary trace as text
+	else if ("--trace-to-text" == std::string(argv[1]))
+	{
+		return runTraceToText(argc, argv);
+	}
+	//write a random program with a chosen instruction mix
+	else if ("--generate" == std::string(argv[1]))
+	{
+		return runGenerate(argc, argv);
+	}
 	
 	//for this next part atleast two arguments
 	//are rquired
@@ -93,7 +1191,10 @@ int main(int argc, char* argv[])
 	try
 	{
 		std::unique_ptr<RISCV_Program> program = LoadProgram(input);
-		program->Run();
+		//someone is at the terminal to continue after an ebreak
+		Processor processor;
+		processor.SetInteractiveBreakpoints(true);
+		program->Run(processor);
 		program->PrintResult();
 		program->SaveProgramResult(output);
 		std::cout << "Program ran sucessfully" << std::endl;
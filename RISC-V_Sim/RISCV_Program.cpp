@@ -7,12 +7,15 @@
 #include "InstructionEncode.h"
 #include "InstructionDecode.h"
 #include "Processor.h"
+#include "ProcessorPool.h"
 #include "ReadProgram.h"
+#include "ProgramFileWriter.h"
 
 
 RISCV_Program::RISCV_Program(const std::string name)
 {
 	ProgramName = name;
+	RetiredInstructions = 0;
     for(uint32_t i = 0; i < 32; i++)
     {
         ExpectedRegisters[i] = 0;
@@ -34,6 +37,7 @@ void RISCV_Program::ExpectRegisterValue(Regs reg, uint32_t expected)
 void RISCV_Program::AddInstruction(uint32_t rawInstruction)
 {
     Instructions.push_back(rawInstruction);
+    Decoded.reset();
 }
 void RISCV_Program::AddInstruction(MultiInstruction mInstruction)
 {
@@ -50,6 +54,7 @@ void RISCV_Program::AddInstruction(MultiInstruction mInstruction)
 void RISCV_Program::RemoveLatestsInstruction()
 {
 	Instructions.pop_back();
+	Decoded.reset();
 }
 
 void RISCV_Program::EndProgram()
@@ -107,11 +112,34 @@ bool RISCV_Program::CheckProgramResult()
 	return CompareRegisters(ExpectedRegisters, ActualRegisters);
 }
 
-void RISCV_Program::Run()
+const std::vector<uint32_t>& RISCV_Program::GetInstructions() const
 {
-	Processor processor;
-	processor.Run(&Instructions[0], Instructions.size());
+	return Instructions;
+}
+std::shared_ptr<const DecodedProgram> RISCV_Program::GetDecodedProgram()
+{
+	if (!Decoded)
+	{
+		Decoded = DecodeProgram(&Instructions[0], Instructions.size());
+	}
+	return Decoded;
+}
+
+RunStatus RISCV_Program::Run(const RunLimits& limits)
+{
+	//reuse a warm processor instead of allocating
+	//and zeroing a new one for every run
+	ProcessorPool::Lease processor = ProcessorPool::Shared().Acquire();
+	return Run(*processor, limits);
+}
+
+RunStatus RISCV_Program::Run(Processor& processor, const RunLimits& limits)
+{
+	const RunStatus status = processor.Run(GetDecodedProgram(), nullptr, limits);
 	processor.CopyRegistersTo(ActualRegisters);
+	RetiredInstructions = processor.GetHartState().retiredInstructions;
+
+	return status;
 }
 
 void RISCV_Program::Test()
@@ -137,15 +165,14 @@ static void WriteFile(const std::string& filepath, const char* toWrite, const si
 
 void RISCV_Program::Save(const std::string& filepath) const
 {
-	const std::string binFile      = filepath + ".bin";
 	const std::string registerFile = filepath + ".res";
-	const std::string assemblyFile = filepath + ".s";
 
-	WriteFile(binFile     , reinterpret_cast<const char*>(&Instructions[0]) , sizeof(uint32_t) * Instructions.size());
-	WriteFile(registerFile, reinterpret_cast<const char*>(ExpectedRegisters), sizeof(uint32_t) * 32);
+	//the assembly is written in chunks instead of being made into one string first
+	ProgramFileWriter writer(filepath, true);
+	writer.AddInstructions(Instructions.data(), Instructions.size());
+	writer.Close();
 
-	const std::string programAsText = GetProgramAsString(&Instructions[0], Instructions.size());
-	WriteFile(assemblyFile, programAsText.c_str(), programAsText.length());
+	WriteFile(registerFile, reinterpret_cast<const char*>(ExpectedRegisters), sizeof(uint32_t) * 32);
 }
 
 void RISCV_Program::SaveProgramResult(const std::string& filepath) const
@@ -164,6 +191,11 @@ const uint32_t* RISCV_Program::GetProgramResult() const
 	return ActualRegisters;
 }
 
+uint64_t RISCV_Program::GetRetiredInstructions() const
+{
+	return RetiredInstructions;
+}
+
 void RISCV_Program::ActualToExpectedRegisters()
 {
 	for(uint32_t i = 0; i < 32; i++)
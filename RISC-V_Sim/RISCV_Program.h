@@ -7,17 +7,20 @@
 #include "InstructionEncode.h"
 #include "Register.h"
 #include "Processor.h"
+#include "DecodedProgram.h"
 
 class RISCV_Program
 {
 private:
 	std::string ProgramName;
 	std::vector<uint32_t> Instructions;
+	//decoded lazily and thrown away when the instructions change
+	std::shared_ptr<const DecodedProgram> Decoded;
 	uint32_t ExpectedRegisters[32];
 	uint32_t ActualRegisters[32];
+	uint64_t RetiredInstructions;
 
 	std::string GetRegisterComparison();
-	bool CheckProgramResult();
 
 public:
 	RISCV_Program(const std::string name);
@@ -29,12 +32,17 @@ public:
 	void RemoveLatestsInstruction();
 	void EndProgram();
 
-	void Run();
+	const std::vector<uint32_t>& GetInstructions() const;
+	std::shared_ptr<const DecodedProgram> GetDecodedProgram();
+	RunStatus Run(const RunLimits& limits = RunLimits());
+	RunStatus Run(Processor& processor, const RunLimits& limits = RunLimits());
 	void Test();
+	bool CheckProgramResult();
 	void Save(const std::string& filepath) const;
 	void SaveProgramResult(const std::string& filepath) const;
 	std::string GetProgramName() const;
 	const uint32_t* GetProgramResult() const;
+	uint64_t GetRetiredInstructions() const;
 	void ActualToExpectedRegisters();
 	void PrintResult();
 };
@@ -0,0 +1,644 @@
+#include "RandomProgram.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+#include <vector>
+#include "InstructionType.h"
+#include "Register.h"
+#include "TSrandom.h"
+#include "InstructionEncode.h"
+#include "RISCV_Program.h"
+#include "ProgramFileWriter.h"
+
+static const std::vector<InstructionType> ArithmeticInstructions =
+{
+	InstructionType::addi,
+	InstructionType::slli,
+	InstructionType::slti,
+	InstructionType::sltiu,
+	InstructionType::xori,
+	InstructionType::srli,
+	InstructionType::srai,
+	InstructionType::ori,
+	InstructionType::andi,
+	InstructionType::auipc,
+	InstructionType::add,
+	InstructionType::sub,
+	InstructionType::sll,
+	InstructionType::slt,
+	InstructionType::sltu,
+	InstructionType::xor_,
+	InstructionType::srl,
+	InstructionType::sra,
+	InstructionType::or_,
+	InstructionType::and_,
+	InstructionType::lui,
+	InstructionType::mul,
+	InstructionType::mulh,
+	InstructionType::mulhsu,
+	InstructionType::mulhu,
+	InstructionType::div,
+	InstructionType::divu,
+	InstructionType::rem,
+	InstructionType::remu
+};
+
+//loads and stores in mixed programs are relative to gp which points here,
+//so every 12 bit offset is a valid address
+static const int32_t DATA_ADDRESS = 2048;
+//streamed programs are generated this many instructions at a time
+static const uint64_t STREAM_CHUNK_SIZE = 64 * 1024;
+//registers that random instructions never use
+static const uint32_t ARITHMETIC_RESERVED_REGISTERS = 1u << static_cast<uint32_t>(Regs::sp);
+//gp holds the data address and tp the loop counter
+static const uint32_t MIXED_RESERVED_REGISTERS = ARITHMETIC_RESERVED_REGISTERS |
+												 1u << static_cast<uint32_t>(Regs::gp) |
+												 1u << static_cast<uint32_t>(Regs::tp);
+
+static Regs GetRandomRegister(FRandom::TCRandom& random, const uint32_t reservedRegisters)
+{
+	int32_t randomNumber;
+	do
+	{
+		randomNumber = FRandom::RandomRange(random, 0, 31);
+	} while ((reservedRegisters >> randomNumber) & 1);
+
+	return static_cast<Regs>(randomNumber);
+}
+
+static uint32_t RandomizeInstruction(const InstructionType type, FRandom::TCRandom& random, const uint32_t reservedRegisters)
+{
+	const Regs rs1 = GetRandomRegister(random, reservedRegisters);
+	const Regs rs2 = GetRandomRegister(random, reservedRegisters);
+	const Regs rs3 = GetRandomRegister(random, reservedRegisters);
+	const uint32_t immediate5Bits  = FRandom::RandomRange(random, 0, 31);
+	const uint32_t immediate12Bits = FRandom::RandomRange(random, -2048, 4095);
+	const uint32_t immediate20Bits = FRandom::RandomRange(random, 0, 1048575);
+
+	switch (type)
+	{
+		case InstructionType::lb:
+			return Create_lb(rs1, rs2, immediate12Bits);
+		case InstructionType::lh:
+			return Create_lh(rs1, rs2, immediate12Bits);
+		case InstructionType::lw:
+			return Create_lw(rs1, rs2, immediate12Bits);
+		case InstructionType::lbu:
+			return Create_lbu(rs1, rs2, immediate12Bits);
+		case InstructionType::lhu:
+			return Create_lhu(rs1, rs2, immediate12Bits);
+		case InstructionType::fence:
+			return Create_fence();
+		case InstructionType::fence_i:
+			return Create_fence_i();
+		case InstructionType::addi:
+			return Create_addi(rs1, rs2, immediate12Bits);
+		case InstructionType::slli:
+			return Create_slli(rs1, rs2, immediate5Bits);
+		case InstructionType::slti:
+			return Create_slti(rs1, rs2, immediate12Bits);
+		case InstructionType::sltiu:
+			return Create_sltiu(rs1, rs2, immediate12Bits);
+		case InstructionType::xori:
+			return Create_xori(rs1, rs2, immediate12Bits);
+		case InstructionType::srli:
+			return Create_srli(rs1, rs2, immediate5Bits);
+		case InstructionType::srai:
+			return Create_srai(rs1, rs2, immediate5Bits);
+		case InstructionType::ori:
+			return Create_ori(rs1, rs2, immediate12Bits);
+		case InstructionType::andi:
+			return Create_andi(rs1, rs2, immediate12Bits);
+		case InstructionType::auipc:
+			return Create_auipc(rs1, immediate20Bits);
+		case InstructionType::sb:
+			return Create_sb(rs1, rs2, immediate12Bits);
+		case InstructionType::sh:
+			return Create_sh(rs1, rs2, immediate12Bits);
+		case InstructionType::sw:
+			return Create_sw(rs1, rs2, immediate12Bits);
+		case InstructionType::add:
+			return Create_add(rs1, rs2, rs3);
+		case InstructionType::sub:
+			return Create_sub(rs1, rs2, rs3);
+		case InstructionType::sll:
+			return Create_sll(rs1, rs2, rs3);
+		case InstructionType::slt:
+			return Create_slt(rs1, rs2, rs3);
+		case InstructionType::sltu:
+			return Create_sltu(rs1, rs2, rs3);
+		case InstructionType::xor_:
+			return Create_xor(rs1, rs2, rs3);
+		case InstructionType::srl:
+			return Create_srl(rs1, rs2, rs3);
+		case InstructionType::sra:
+			return Create_sra(rs1, rs2, rs3);
+		case InstructionType::or_:
+			return Create_or(rs1, rs2, rs3);
+		case InstructionType::and_:
+			return Create_and(rs1, rs2, rs3);
+		case InstructionType::lui:
+			return Create_lui(rs1, immediate20Bits);
+		case InstructionType::beq:
+			return Create_beq(rs1, rs2, immediate12Bits);
+		case InstructionType::bne:
+			return Create_bne(rs1, rs2, immediate12Bits);
+		case InstructionType::blt:
+			return Create_blt(rs1, rs2, immediate12Bits);
+		case InstructionType::bge:
+			return Create_bge(rs1, rs2, immediate12Bits);
+		case InstructionType::bltu:
+			return Create_bltu(rs1, rs2, immediate12Bits);
+		case InstructionType::bgeu:
+			return Create_bgeu(rs1, rs2, immediate12Bits);
+		case InstructionType::jalr:
+			return Create_jalr(rs1, rs2, immediate12Bits);
+		case InstructionType::jal:
+			return Create_jal(rs1, immediate20Bits);
+		case InstructionType::ecall:
+			return Create_ecall();
+		case InstructionType::ebreak:
+			return Create_ebreak();
+		case InstructionType::csrrw:
+			return Create_csrrw(rs1, rs2, static_cast<uint32_t>(immediate12Bits) & 0xfff);
+		case InstructionType::csrrs:
+			return Create_csrrs(rs1, rs2, static_cast<uint32_t>(immediate12Bits) & 0xfff);
+		case InstructionType::csrrc:
+			return Create_csrrc(rs1, rs2, static_cast<uint32_t>(immediate12Bits) & 0xfff);
+		case InstructionType::csrrwi:
+			return Create_csrrwi(rs1, static_cast<uint32_t>(rs2), static_cast<uint32_t>(immediate12Bits) & 0xfff);
+		case InstructionType::csrrsi:
+			return Create_csrrsi(rs1, static_cast<uint32_t>(rs2), static_cast<uint32_t>(immediate12Bits) & 0xfff);
+		case InstructionType::csrrci:
+			return Create_csrrci(rs1, static_cast<uint32_t>(rs2), static_cast<uint32_t>(immediate12Bits) & 0xfff);
+		case InstructionType::mul:
+			return Create_mul(rs1, rs2, rs3);
+		case InstructionType::mulh:
+			return Create_mulh(rs1, rs2, rs3);
+		case InstructionType::mulhsu:
+			return Create_mulhsu(rs1, rs2, rs3);
+		case InstructionType::mulhu:
+			return Create_mulhu(rs1, rs2, rs3);
+		case InstructionType::div:
+			return Create_div(rs1, rs2, rs3);
+		case InstructionType::divu:
+			return Create_divu(rs1, rs2, rs3);
+		case InstructionType::rem:
+			return Create_rem(rs1, rs2, rs3);
+		case InstructionType::remu:
+			return Create_remu(rs1, rs2, rs3);
+		default:
+			throw std::runtime_error("Invalid instruction type");
+	}
+}
+
+uint32_t RandomizeInstruction(const InstructionType type, FRandom::TCRandom& random)
+{
+	return RandomizeInstruction(type, random, ARITHMETIC_RESERVED_REGISTERS);
+}
+
+const std::vector<InstructionType>& GetArithmeticInstructionTypes()
+{
+	return ArithmeticInstructions;
+}
+
+std::unique_ptr<RISCV_Program> CreateRandomProgram(const std::vector<InstructionType>& instructionTypes, const size_t size, FRandom::TCRandom& random)
+{
+	auto program = std::make_unique<RISCV_Program>("Program size: " + std::to_string(size));
+
+	for (uint32_t i = 0; i < 32; i++)
+	{
+		program->SetRegister(static_cast<Regs>(i), i);
+	}
+
+	for (size_t i = 0; i < size; i++)
+	{
+		const uint32_t index = FRandom::RandomRange(random, 0, static_cast<uint32_t>(instructionTypes.size()) - 1);
+		const InstructionType type = instructionTypes[index];
+		const uint32_t rawInstruction = RandomizeInstruction(type, random);
+
+		program->AddInstruction(rawInstruction);
+	}
+	program->EndProgram();
+
+	return program;
+}
+
+enum class InstructionKind
+{
+	Arithmetic,
+	Load,
+	Store,
+	Branch,
+	Jump,
+	Loop
+};
+
+//a branch or jump whose offset is only known when the whole program has been generated
+struct RandomJump
+{
+	size_t index;
+	size_t target;
+	InstructionType type;
+	Regs rd;
+	Regs rs1;
+	Regs rs2;
+};
+
+//instructions [first, last] of a loop. The counter is set by first,
+//decremented by the one before last and last branches back, so nothing
+//outside may jump into the middle of it and nothing inside may skip the decrement
+struct RandomLoop
+{
+	size_t first;
+	size_t last;
+};
+
+class MixedProgramGenerator
+{
+private:
+	const InstructionMix& mix;
+	FRandom::TCRandom& random;
+	const size_t size;
+	std::vector<uint32_t> instructions;
+	std::vector<RandomJump> jumps;
+	std::vector<RandomLoop> loops;
+	//jalr instructions that depend on the auipc right before them
+	std::vector<size_t> jalrIndices;
+
+	InstructionKind GetRandomKind(const bool allowLoops, const size_t remaining)
+	{
+		const uint32_t loopWeight = allowLoops && remaining >= 4 ? mix.loops : 0;
+		const uint32_t weights[] = { mix.arithmetic, mix.loads, mix.stores, mix.branches, remaining >= 2 ? mix.jumps : 0, loopWeight };
+		uint32_t totalWeight = 0;
+		for (const uint32_t weight : weights)
+		{
+			totalWeight += weight;
+		}
+		//when only the kinds that need more room are left
+		if (totalWeight == 0)
+		{
+			return InstructionKind::Arithmetic;
+		}
+
+		uint32_t choice = FRandom::RandomRange(random, 0, totalWeight - 1);
+		for (uint32_t i = 0; i < sizeof(weights) / sizeof(weights[0]); i++)
+		{
+			if (choice < weights[i])
+			{
+				return static_cast<InstructionKind>(i);
+			}
+			choice -= weights[i];
+		}
+		return InstructionKind::Arithmetic;
+	}
+
+	template<typename T>
+	const T& GetRandomElement(const std::vector<T>& elements)
+	{
+		return elements[FRandom::RandomRange(random, 0, static_cast<int32_t>(elements.size()) - 1)];
+	}
+
+	Regs GetRandomRegister()
+	{
+		return ::GetRandomRegister(random, MIXED_RESERVED_REGISTERS);
+	}
+
+	size_t GetForwardTarget()
+	{
+		return std::min(instructions.size() + FRandom::RandomRange(random, 1, mix.maxForwardDistance), size);
+	}
+
+	void AddJump(const InstructionType type, const Regs rd, const Regs rs1, const Regs rs2)
+	{
+		jumps.push_back({ instructions.size(), GetForwardTarget(), type, rd, rs1, rs2 });
+		//placeholder until the offset is known
+		instructions.push_back(0);
+	}
+
+	//adds one instruction, or a few if the kind needs more, without going past end
+	void AddRandomInstructions(const size_t end)
+	{
+		static const std::vector<InstructionType> loadTypes = { InstructionType::lb, InstructionType::lh, InstructionType::lw, InstructionType::lbu, InstructionType::lhu };
+		static const std::vector<InstructionType> storeTypes = { InstructionType::sb, InstructionType::sh, InstructionType::sw };
+		static const std::vector<InstructionType> branchTypes = { InstructionType::beq, InstructionType::bne, InstructionType::blt, InstructionType::bge, InstructionType::bltu, InstructionType::bgeu };
+
+		//loops can't be nested, so only the top level can add them
+		switch (GetRandomKind(end == size, end - instructions.size()))
+		{
+			case InstructionKind::Arithmetic:
+				instructions.push_back(RandomizeInstruction(GetRandomElement(ArithmeticInstructions), random, MIXED_RESERVED_REGISTERS));
+				break;
+			case InstructionKind::Load:
+			{
+				const InstructionType type = GetRandomElement(loadTypes);
+				const uint32_t offset = AlignOffset(FRandom::RandomRange(random, -2048, 2047), type);
+				const Regs rd = GetRandomRegister();
+				switch (type)
+				{
+					case InstructionType::lb:
+						instructions.push_back(Create_lb(rd, Regs::gp, offset));
+						break;
+					case InstructionType::lh:
+						instructions.push_back(Create_lh(rd, Regs::gp, offset));
+						break;
+					case InstructionType::lbu:
+						instructions.push_back(Create_lbu(rd, Regs::gp, offset));
+						break;
+					case InstructionType::lhu:
+						instructions.push_back(Create_lhu(rd, Regs::gp, offset));
+						break;
+					default:
+						instructions.push_back(Create_lw(rd, Regs::gp, offset));
+						break;
+				}
+				break;
+			}
+			case InstructionKind::Store:
+			{
+				const InstructionType type = GetRandomElement(storeTypes);
+				const uint32_t offset = AlignOffset(FRandom::RandomRange(random, -2048, 2047), type);
+				const Regs value = GetRandomRegister();
+				switch (type)
+				{
+					case InstructionType::sb:
+						instructions.push_back(Create_sb(Regs::gp, value, offset));
+						break;
+					case InstructionType::sh:
+						instructions.push_back(Create_sh(Regs::gp, value, offset));
+						break;
+					default:
+						instructions.push_back(Create_sw(Regs::gp, value, offset));
+						break;
+				}
+				break;
+			}
+			case InstructionKind::Branch:
+			{
+				const Regs rs1 = GetRandomRegister();
+				const Regs rs2 = GetRandomRegister();
+				AddJump(GetRandomElement(branchTypes), Regs::x0, rs1, rs2);
+				break;
+			}
+			case InstructionKind::Jump:
+			{
+				const Regs rd = GetRandomRegister();
+				if (FRandom::RandomBool(random))
+				{
+					AddJump(InstructionType::jal, rd, Regs::x0, Regs::x0);
+				}
+				else
+				{
+					//jalr needs the address of the code in a register first
+					Regs address;
+					do
+					{
+						address = GetRandomRegister();
+					} while (address == Regs::x0);
+					instructions.push_back(Create_auipc(address, 0));
+					jalrIndices.push_back(instructions.size());
+					AddJump(InstructionType::jalr, rd, address, Regs::x0);
+				}
+				break;
+			}
+			case InstructionKind::Loop:
+				AddLoop();
+				break;
+		}
+	}
+
+	void AddLoop()
+	{
+		const size_t maxBodySize = std::min<size_t>(mix.maxLoopSize, size - instructions.size() - 3);
+		const size_t bodySize = FRandom::RandomRange(random, 1, static_cast<int32_t>(maxBodySize));
+		const int32_t iterations = FRandom::RandomRange(random, 1, mix.maxLoopIterations);
+
+		const size_t first = instructions.size();
+		instructions.push_back(Create_addi(Regs::tp, Regs::x0, iterations));
+		const size_t bodyEnd = instructions.size() + bodySize;
+		while (instructions.size() < bodyEnd)
+		{
+			AddRandomInstructions(bodyEnd);
+		}
+		instructions.push_back(Create_addi(Regs::tp, Regs::tp, -1));
+		const int32_t offset = -static_cast<int32_t>(instructions.size() - first - 1) * 4;
+		instructions.push_back(Create_bne(Regs::tp, Regs::x0, offset));
+		loops.push_back({ first, instructions.size() - 1 });
+	}
+
+	static uint32_t AlignOffset(const int32_t offset, const InstructionType type)
+	{
+		switch (type)
+		{
+			case InstructionType::lh:
+			case InstructionType::lhu:
+			case InstructionType::sh:
+				return static_cast<uint32_t>(offset & ~1) & 0xfff;
+			case InstructionType::lw:
+			case InstructionType::sw:
+				return static_cast<uint32_t>(offset & ~3) & 0xfff;
+			default:
+				return static_cast<uint32_t>(offset) & 0xfff;
+		}
+	}
+
+	//the loop that index is in, not counting the instruction that sets the counter
+	const RandomLoop* FindLoop(const size_t index) const
+	{
+		//loops can't be nested so they are sorted and don't overlap
+		const auto nextLoop = std::upper_bound(loops.begin(), loops.end(), index, [](const size_t i, const RandomLoop& loop)
+		{
+			return i <= loop.first;
+		});
+		if (nextLoop == loops.begin())
+		{
+			return nullptr;
+		}
+		const RandomLoop& loop = *(nextLoop - 1);
+		return index <= loop.last ? &loop : nullptr;
+	}
+
+	//moves the target of a jump so it can't skip the setup of a loop or a jalr
+	size_t GetValidTarget(const RandomJump& jump) const
+	{
+		size_t target = jump.target;
+		if (std::binary_search(jalrIndices.begin(), jalrIndices.end(), target))
+		{
+			target--;
+		}
+		const RandomLoop* targetLoop = FindLoop(target);
+		if (targetLoop && targetLoop != FindLoop(jump.index))
+		{
+			target = targetLoop->first;
+		}
+		//the counter still has to be decremented
+		else if (targetLoop && target == targetLoop->last)
+		{
+			target = targetLoop->last - 1;
+		}
+		return target;
+	}
+
+	uint32_t EncodeJump(const RandomJump& jump) const
+	{
+		const uint32_t offset = static_cast<uint32_t>(GetValidTarget(jump) - jump.index) * 4;
+		switch (jump.type)
+		{
+			case InstructionType::beq:
+				return Create_beq(jump.rs1, jump.rs2, offset);
+			case InstructionType::bne:
+				return Create_bne(jump.rs1, jump.rs2, offset);
+			case InstructionType::blt:
+				return Create_blt(jump.rs1, jump.rs2, offset);
+			case InstructionType::bge:
+				return Create_bge(jump.rs1, jump.rs2, offset);
+			case InstructionType::bltu:
+				return Create_bltu(jump.rs1, jump.rs2, offset);
+			case InstructionType::bgeu:
+				return Create_bgeu(jump.rs1, jump.rs2, offset);
+			case InstructionType::jal:
+				return Create_jal(jump.rd, offset);
+			case InstructionType::jalr:
+				//relative to the auipc before it
+				return Create_jalr(jump.rd, jump.rs1, offset + 4);
+			default:
+				throw std::runtime_error("Invalid jump type");
+		}
+	}
+
+public:
+	MixedProgramGenerator(const InstructionMix& instructionMix, const size_t programSize, FRandom::TCRandom& randomGenerator) :
+		mix(instructionMix), random(randomGenerator), size(programSize)
+	{
+		if (mix.maxForwardDistance < 1 || mix.maxForwardDistance > 500)
+		{
+			throw std::runtime_error("The forward distance of an instruction mix has to be between 1 and 500");
+		}
+		if (mix.maxLoopSize < 1 || mix.maxLoopSize > 1000 || mix.maxLoopIterations < 1)
+		{
+			throw std::runtime_error("Loops of an instruction mix have to have at least one instruction, at most 1000 and run at least once");
+		}
+	}
+
+	std::vector<uint32_t> Generate()
+	{
+		while (instructions.size() < size)
+		{
+			AddRandomInstructions(size);
+		}
+		for (const RandomJump& jump : jumps)
+		{
+			instructions[jump.index] = EncodeJump(jump);
+		}
+		return instructions;
+	}
+};
+
+std::unique_ptr<RISCV_Program> CreateRandomProgram(const InstructionMix& mix, const size_t size, FRandom::TCRandom& random)
+{
+	auto program = std::make_unique<RISCV_Program>("Mixed program size: " + std::to_string(size));
+
+	for (uint32_t i = 0; i < 32; i++)
+	{
+		program->SetRegister(static_cast<Regs>(i), i);
+	}
+	program->SetRegister(Regs::gp, DATA_ADDRESS);
+
+	for (const uint32_t rawInstruction : MixedProgramGenerator(mix, size, random).Generate())
+	{
+		program->AddInstruction(rawInstruction);
+	}
+	program->EndProgram();
+
+	return program;
+}
+
+void WriteRandomProgram(const InstructionMix& mix, const uint64_t size, FRandom::TCRandom& random, ProgramFileWriter& writer)
+{
+	//the same setup as CreateRandomProgram
+	for (uint32_t i = 0; i < 32; i++)
+	{
+		writer.AddInstruction(Create_li(static_cast<Regs>(i), i));
+	}
+	writer.AddInstruction(Create_li(Regs::gp, DATA_ADDRESS));
+
+	for (uint64_t written = 0; written < size; written += STREAM_CHUNK_SIZE)
+	{
+		const size_t chunkSize = static_cast<size_t>(std::min<uint64_t>(STREAM_CHUNK_SIZE, size - written));
+		const std::vector<uint32_t> chunk = MixedProgramGenerator(mix, chunkSize, random).Generate();
+		writer.AddInstructions(chunk.data(), chunk.size());
+	}
+
+	writer.AddInstruction(Create_li(Regs::a0, 10));
+	writer.AddInstruction(Create_ecall());
+}
+
+uint64_t GetMaxExecutedInstructions(const InstructionMix& mix, const uint64_t size)
+{
+	//only loops jump backwards and they can't be nested,
+	//so no instruction can run more often than a loop iterates.
+	//The 100 is for setting the registers and exiting
+	return size * mix.maxLoopIterations + 100;
+}
+
+InstructionMix ParseInstructionMix(const std::string& text)
+{
+	InstructionMix mix;
+	std::stringstream stream(text);
+	std::string entry;
+	while (std::getline(stream, entry, ','))
+	{
+		const size_t split = entry.find('=');
+		if (split == std::string::npos)
+		{
+			throw std::runtime_error("Invalid instruction mix entry: " + entry);
+		}
+		const std::string name = entry.substr(0, split);
+		const uint32_t value = std::stoul(entry.substr(split + 1));
+
+		if (name == "arithmetic")
+		{
+			mix.arithmetic = value;
+		}
+		else if (name == "loads")
+		{
+			mix.loads = value;
+		}
+		else if (name == "stores")
+		{
+			mix.stores = value;
+		}
+		else if (name == "branches")
+		{
+			mix.branches = value;
+		}
+		else if (name == "jumps")
+		{
+			mix.jumps = value;
+		}
+		else if (name == "loops")
+		{
+			mix.loops = value;
+		}
+		else if (name == "distance")
+		{
+			mix.maxForwardDistance = value;
+		}
+		else if (name == "loopSize")
+		{
+			mix.maxLoopSize = value;
+		}
+		else if (name == "iterations")
+		{
+			mix.maxLoopIterations = value;
+		}
+		else
+		{
+			throw std::runtime_error("Unknown instruction mix entry: " + name);
+		}
+	}
+	return mix;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "InstructionType.h"
+#include "TSrandom.h"
+#include "RISCV_Program.h"
+#include "ProgramFileWriter.h"
+
+const std::vector<InstructionType>& GetArithmeticInstructionTypes();
+//an instruction of the given type with random registers and immediates
+uint32_t RandomizeInstruction(const InstructionType type, FRandom::TCRandom& random);
+//a program that sets every register, runs size random instructions
+//of the given types and then exits
+std::unique_ptr<RISCV_Program> CreateRandomProgram(const std::vector<InstructionType>& instructionTypes, const size_t size, FRandom::TCRandom& random);
+
+//How often each kind of instruction is used in a mixed program,
+//relative to the other kinds. 0 means the kind isn't used
+struct InstructionMix
+{
+	uint32_t arithmetic = 60;
+	//loads and stores only use addresses in the data area around gp
+	uint32_t loads = 15;
+	uint32_t stores = 10;
+	//branches and jumps only go forward so the program always ends
+	uint32_t branches = 8;
+	uint32_t jumps = 2;
+	//loops that count tp down, the only code that runs more than once
+	uint32_t loops = 5;
+	//in instructions
+	uint32_t maxForwardDistance = 16;
+	uint32_t maxLoopSize = 16;
+	uint32_t maxLoopIterations = 8;
+};
+
+//a program that sets every register, runs size random instructions
+//picked by the mix and then exits. gp and tp are never written by
+//the random instructions
+std::unique_ptr<RISCV_Program> CreateRandomProgram(const InstructionMix& mix, const size_t size, FRandom::TCRandom& random);
+//Writes a random program of any size to the writer without keeping it in memory.
+//It's generated in chunks that branches don't cross, so it isn't
+//the same program CreateRandomProgram would make
+void WriteRandomProgram(const InstructionMix& mix, const uint64_t size, FRandom::TCRandom& random, ProgramFileWriter& writer);
+//the most instructions a program made with CreateRandomProgram or WriteRandomProgram can run
+uint64_t GetMaxExecutedInstructions(const InstructionMix& mix, const uint64_t size);
+//parses a mix like "loads=30,stores=30,loops=0", the rest keeps the defaults
+InstructionMix ParseInstructionMix(const std::string& text);
@@ -95,7 +95,7 @@ static void AddInstructionsToProgram(std::unique_ptr<RISCV_Program>& program, co
 	}
 	delete[] rawInstructions;
 }
-static void AddRegistersToProgram(std::unique_ptr<RISCV_Program>& program, const std::string& filePath)
+static void AddRegistersToProgram(std::unique_ptr<RISCV_Program>& program, const std::string& filePath, const bool warnIfNoRegisterFile)
 {
 	try
 	{
@@ -112,15 +112,18 @@ static void AddRegistersToProgram(std::unique_ptr<RISCV_Program>& program, const
 	{
 		//it's not exactly an error that there isn't a register file
 		//but atleast notify the user about it
-		std::cout << "Warning: No register file found" << std::endl;
+		if (warnIfNoRegisterFile)
+		{
+			std::cout << "Warning: No register file found" << std::endl;
+		}
 	}
 }
 
-std::unique_ptr<RISCV_Program> LoadProgram(const std::string& filePath)
+std::unique_ptr<RISCV_Program> LoadProgram(const std::string& filePath, const bool warnIfNoRegisterFile)
 {
 	std::unique_ptr<RISCV_Program> program = std::make_unique<RISCV_Program>(filePath);
 	AddInstructionsToProgram(program, filePath);
-	AddRegistersToProgram(program, filePath);
+	AddRegistersToProgram(program, filePath, warnIfNoRegisterFile);
 
 	return program;
 }
\ No newline at end of file
@@ -5,4 +5,4 @@
 #include <memory>
 #include "RISCV_Program.h"
 
-std::unique_ptr<RISCV_Program> LoadProgram(const std::string& filePath);
\ No newline at end of file
+std::unique_ptr<RISCV_Program> LoadProgram(const std::string& filePath, const bool warnIfNoRegisterFile = true);
\ No newline at end of file
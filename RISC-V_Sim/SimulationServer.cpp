@@ -0,0 +1,275 @@
+#include "SimulationServer.h"
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "DecodedProgramCache.h"
+#include "Processor.h"
+#include "ProcessorPool.h"
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+//largest program a request may contain, 256 MB of instructions
+static const uint32_t MAX_REQUEST_INSTRUCTIONS = 64 * 1024 * 1024;
+static const uint32_t MAX_REQUEST_MEMORY_RANGES = 1024;
+
+struct MemoryRange
+{
+	uint32_t address;
+	uint32_t size;
+};
+
+static bool ReadWords(FILE* input, uint32_t* words, const size_t count)
+{
+	uint8_t buffer[4096];
+	size_t index = 0;
+	while (index < count)
+	{
+		const size_t wordsToRead = std::min(count - index, sizeof(buffer) / 4);
+		if (std::fread(buffer, 4, wordsToRead, input) != wordsToRead)
+		{
+			return false;
+		}
+		for (size_t i = 0; i < wordsToRead; i++)
+		{
+			words[index + i] = (static_cast<uint32_t>(buffer[i * 4 + 0]) <<  0) |
+							   (static_cast<uint32_t>(buffer[i * 4 + 1]) <<  8) |
+							   (static_cast<uint32_t>(buffer[i * 4 + 2]) << 16) |
+							   (static_cast<uint32_t>(buffer[i * 4 + 3]) << 24);
+		}
+		index += wordsToRead;
+	}
+	return true;
+}
+
+static bool ReadWord(FILE* input, uint32_t* word)
+{
+	return ReadWords(input, word, 1);
+}
+
+static void WriteWord(std::vector<uint8_t>& response, const uint32_t word)
+{
+	response.push_back(static_cast<uint8_t>(word >>  0));
+	response.push_back(static_cast<uint8_t>(word >>  8));
+	response.push_back(static_cast<uint8_t>(word >> 16));
+	response.push_back(static_cast<uint8_t>(word >> 24));
+}
+
+static std::vector<uint8_t> CreateErrorResponse(const std::string& message)
+{
+	std::vector<uint8_t> response;
+	WriteWord(response, SERVER_RESPONSE_MAGIC);
+	WriteWord(response, SERVER_STATUS_ERROR);
+	WriteWord(response, static_cast<uint32_t>(message.size()));
+	response.insert(response.end(), message.begin(), message.end());
+
+	return response;
+}
+
+static std::vector<uint8_t> RunRequest(SimulationServerContext& context, const std::vector<uint32_t>& instructions, const uint32_t* initialRegisters, const std::vector<MemoryRange>& memoryRanges)
+{
+	for (const MemoryRange& range : memoryRanges)
+	{
+		if (range.address > static_cast<uint32_t>(Processor::GetMemorySize()) ||
+			range.size > static_cast<uint32_t>(Processor::GetMemorySize()) - range.address)
+		{
+			throw std::runtime_error("Memory range out of range. Address: " + std::to_string(range.address) + " Size: " + std::to_string(range.size));
+		}
+	}
+
+	const std::shared_ptr<const DecodedProgram> program = context.programCache.GetOrDecode(instructions.data(), instructions.size());
+	ProcessorPool::Lease processor = context.processors.Acquire();
+	const RunStatus status = processor->Run(program, initialRegisters, context.limits);
+
+	std::vector<uint8_t> response;
+	WriteWord(response, SERVER_RESPONSE_MAGIC);
+	switch (status)
+	{
+		case RunStatus::Exited:
+			WriteWord(response, SERVER_STATUS_SUCCESS);
+			break;
+		case RunStatus::InstructionLimit:
+			WriteWord(response, SERVER_STATUS_INSTRUCTION_LIMIT);
+			break;
+		case RunStatus::Timeout:
+			WriteWord(response, SERVER_STATUS_TIMEOUT);
+			break;
+		default:
+			throw std::runtime_error("The program stopped without being asked to.");
+	}
+	const HartState& hart = processor->GetHartState();
+	for (uint32_t i = 0; i < 32; i++)
+	{
+		WriteWord(response, hart.registers[i].uword);
+	}
+	for (const MemoryRange& range : memoryRanges)
+	{
+		const size_t offset = response.size();
+		response.resize(offset + range.size);
+		processor->CopyMemoryTo(static_cast<int32_t>(range.address), static_cast<int32_t>(range.size), response.data() + offset);
+	}
+
+	return response;
+}
+
+bool ServeStream(FILE* input, FILE* output, SimulationServerContext& context)
+{
+	std::vector<uint32_t> instructions;
+	std::vector<MemoryRange> memoryRanges;
+	uint32_t initialRegisters[32];
+
+	while (true)
+	{
+		uint32_t magic;
+		if (!ReadWord(input, &magic))
+		{
+			//input closed between requests
+			return true;
+		}
+
+		uint32_t instructionCount;
+		if (magic != SERVER_REQUEST_MAGIC || !ReadWord(input, &instructionCount) || instructionCount == 0 || instructionCount > MAX_REQUEST_INSTRUCTIONS)
+		{
+			return false;
+		}
+		instructions.resize(instructionCount);
+		if (!ReadWords(input, instructions.data(), instructionCount))
+		{
+			return false;
+		}
+
+		uint32_t registerCount;
+		if (!ReadWord(input, &registerCount) || (registerCount != 0 && registerCount != 32))
+		{
+			return false;
+		}
+		if (registerCount == 32 && !ReadWords(input, initialRegisters, 32))
+		{
+			return false;
+		}
+
+		uint32_t memoryRangeCount;
+		if (!ReadWord(input, &memoryRangeCount) || memoryRangeCount > MAX_REQUEST_MEMORY_RANGES)
+		{
+			return false;
+		}
+		memoryRanges.resize(memoryRangeCount);
+		for (MemoryRange& range : memoryRanges)
+		{
+			if (!ReadWord(input, &range.address) || !ReadWord(input, &range.size))
+			{
+				return false;
+			}
+		}
+
+		std::vector<uint8_t> response;
+		try
+		{
+			response = RunRequest(context, instructions, registerCount == 32 ? initialRegisters : nullptr, memoryRanges);
+		}
+		catch (const std::exception& e)
+		{
+			response = CreateErrorResponse(e.what());
+		}
+
+		if (std::fwrite(response.data(), 1, response.size(), output) != response.size() || std::fflush(output) != 0)
+		{
+			return false;
+		}
+	}
+}
+
+int ServeStandardStreams(const RunLimits& limits)
+{
+#ifdef _WIN32
+	_setmode(_fileno(stdin), _O_BINARY);
+	_setmode(_fileno(stdout), _O_BINARY);
+#endif
+	SimulationServerContext context;
+	context.limits = limits;
+	return ServeStream(stdin, stdout, context) ? 0 : -1;
+}
+
+#ifdef _WIN32
+int ServeUnixSocket(const std::string& socketPath, const RunLimits& limits)
+{
+	std::cout << "Unix sockets are not supported on this platform. Use --serve without a socket path instead." << std::endl;
+	return -1;
+}
+#else
+static void ServeConnection(const int connection, SimulationServerContext* context)
+{
+	//use separate streams for reading and writing
+	//so the buffering of one doesn't affect the other
+	FILE* input = fdopen(connection, "rb");
+	FILE* output = fdopen(dup(connection), "wb");
+	if (input && output)
+	{
+		ServeStream(input, output, *context);
+	}
+
+	if (input)
+	{
+		std::fclose(input);
+	}
+	else
+	{
+		close(connection);
+	}
+	if (output)
+	{
+		std::fclose(output);
+	}
+}
+
+int ServeUnixSocket(const std::string& socketPath, const RunLimits& limits)
+{
+	sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+	if (socketPath.size() >= sizeof(address.sun_path))
+	{
+		std::cout << "Socket path is too long: " << socketPath << std::endl;
+		return -1;
+	}
+	socketPath.copy(address.sun_path, socketPath.size());
+
+	const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (listener < 0)
+	{
+		std::cout << "Failed to create socket" << std::endl;
+		return -1;
+	}
+
+	unlink(socketPath.c_str());
+	if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listener, 64) != 0)
+	{
+		std::cout << "Failed to listen on socket: " << socketPath << std::endl;
+		close(listener);
+		return -1;
+	}
+	std::cout << "Listening on " << socketPath << std::endl;
+
+	//the context lives as long as the server so decoded
+	//programs and warm processors are kept between connections
+	static SimulationServerContext context;
+	context.limits = limits;
+	while (true)
+	{
+		const int connection = accept(listener, nullptr, nullptr);
+		if (connection < 0)
+		{
+			continue;
+		}
+		std::thread(ServeConnection, connection, &context).detach();
+	}
+}
+#endif
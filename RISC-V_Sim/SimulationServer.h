@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "DecodedProgramCache.h"
+#include "Processor.h"
+#include "ProcessorPool.h"
+
+//Binary protocol, all values are little endian uint32_t.
+//
+//Request:
+//  magic 'RVSQ', instruction count, instructions,
+//  register count (0 or 32), initial registers,
+//  memory range count, address and size of each memory range to return
+//
+//Response:
+//  magic 'RVSR', status and then either 32 registers followed by
+//  the bytes of each requested memory range, or for an error
+//  the length of an error message followed by the message.
+//  A program that reached the instruction limit or timed out
+//  returns the registers and memory it had when it was stopped.
+const uint32_t SERVER_REQUEST_MAGIC  = 0x51'53'56'52; // "RVSQ"
+const uint32_t SERVER_RESPONSE_MAGIC = 0x52'53'56'52; // "RVSR"
+const uint32_t SERVER_STATUS_SUCCESS = 0;
+const uint32_t SERVER_STATUS_ERROR = 1;
+const uint32_t SERVER_STATUS_INSTRUCTION_LIMIT = 2;
+const uint32_t SERVER_STATUS_TIMEOUT = 3;
+
+struct SimulationServerContext
+{
+	DecodedProgramCache programCache;
+	ProcessorPool processors;
+	//every request is run with these limits
+	RunLimits limits;
+};
+
+//handles requests until the input is closed.
+//Returns false if the input contained an invalid request.
+bool ServeStream(FILE* input, FILE* output, SimulationServerContext& context);
+int ServeStandardStreams(const RunLimits& limits);
+int ServeUnixSocket(const std::string& socketPath, const RunLimits& limits);
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+//A ring buffer that one thread pushes to and one other thread pops from, without locks.
+//Each index is only written by one of the threads, and each thread keeps its own copy
+//of the other index so it only has to read the shared one when the copy says the
+//ring is full or empty. Everything a thread writes is on its own cache line,
+//so the two threads don't keep taking the cache line from each other
+template<typename T>
+class SpscRing
+{
+private:
+	static constexpr size_t CACHE_LINE_SIZE = 64;
+
+	std::unique_ptr<T[]> slots;
+	size_t capacity;
+	size_t mask;
+	//the next slot to pop, and the pushing thread's copy of it
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> head;
+	alignas(CACHE_LINE_SIZE) size_t cachedHead;
+	//the next slot to push to, and the popping thread's copy of it
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail;
+	alignas(CACHE_LINE_SIZE) size_t cachedTail;
+
+public:
+	//the capacity is rounded up to a power of two
+	SpscRing(const size_t minimumCapacity)
+	{
+		if (minimumCapacity == 0)
+		{
+			throw std::runtime_error("A ring buffer needs room for at least one value.");
+		}
+		capacity = 1;
+		while (capacity < minimumCapacity)
+		{
+			capacity *= 2;
+		}
+		mask = capacity - 1;
+		slots = std::make_unique<T[]>(capacity);
+		head.store(0, std::memory_order_relaxed);
+		tail.store(0, std::memory_order_relaxed);
+		cachedHead = 0;
+		cachedTail = 0;
+	}
+	SpscRing(const SpscRing&) = delete;
+	SpscRing& operator=(const SpscRing&) = delete;
+
+	//only called by the pushing thread. Returns false if the ring is full
+	bool TryPush(const T& value)
+	{
+		const size_t currentTail = tail.load(std::memory_order_relaxed);
+		if (currentTail - cachedHead == capacity)
+		{
+			cachedHead = head.load(std::memory_order_acquire);
+			if (currentTail - cachedHead == capacity)
+			{
+				return false;
+			}
+		}
+		slots[currentTail & mask] = value;
+		tail.store(currentTail + 1, std::memory_order_release);
+		return true;
+	}
+	//waits for room if the ring is full
+	void Push(const T& value)
+	{
+		while (!TryPush(value))
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	//only called by the popping thread. Pops up to maxCount
+	//values into popTo and returns how many there were
+	size_t TryPop(T* popTo, const size_t maxCount)
+	{
+		const size_t currentHead = head.load(std::memory_order_relaxed);
+		if (cachedTail == currentHead)
+		{
+			cachedTail = tail.load(std::memory_order_acquire);
+		}
+		size_t count = cachedTail - currentHead;
+		count = count < maxCount ? count : maxCount;
+		for (size_t i = 0; i < count; i++)
+		{
+			popTo[i] = slots[(currentHead + i) & mask];
+		}
+		head.store(currentHead + count, std::memory_order_release);
+		return count;
+	}
+
+	size_t GetCapacity() const
+	{
+		return capacity;
+	}
+};
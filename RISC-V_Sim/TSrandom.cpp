@@ -1,55 +1,82 @@
-#include <mutex> 
+#include <atomic>
 #include <cstdint>
 #include "TSrandom.h"
 
 namespace FRandom {
-	static std::mutex initRandomLock;
+	static std::atomic<uint64_t> baseSeed(236432356);
+	static std::atomic<uint64_t> nextStream(0);
 
-	static uint64_t init_x = 236432356;
-	static uint64_t init_y = 395824682;
-	static uint64_t init_z = 443425897;
+	static uint64_t SplitMix64(uint64_t& state)
+	{
+		state += 0x9e3779b97f4a7c15;
+		uint64_t z = state;
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+		return z ^ (z >> 31);
+	}
 
-	TCRandom GetTCRandom()
+	TCRandom CreateTCRandom(const uint64_t seed, const uint64_t stream)
 	{
-		initRandomLock.lock();
-		const TCRandom newRandom =
-		{
-			init_x,
-			init_y,
-			init_z
-		};
+		//the stream index picks a seed from the splitmix sequence of the
+		//seed, and that seed starts a new splitmix sequence for the state
+		uint64_t streamState = seed + stream * 0x9e3779b97f4a7c15;
+		uint64_t state = SplitMix64(streamState);
 
-		init_x++;
-		init_y++;
-		init_z++;
-		initRandomLock.unlock();
+		TCRandom newRandom;
+		newRandom.s0 = SplitMix64(state);
+		newRandom.s1 = SplitMix64(state);
+		if (newRandom.s0 == 0 && newRandom.s1 == 0)
+		{
+			newRandom.s1 = 1;
+		}
 
 		return newRandom;
 	}
 
+	TCRandom GetTCRandom()
+	{
+		return CreateTCRandom(baseSeed.load(std::memory_order_relaxed), nextStream.fetch_add(1, std::memory_order_relaxed));
+	}
+
+	void SetSeed(const uint64_t seed)
+	{
+		baseSeed.store(seed, std::memory_order_relaxed);
+		nextStream.store(0, std::memory_order_relaxed);
+	}
+
+	TCRandom& ThreadRandom()
+	{
+		thread_local TCRandom random = GetTCRandom();
+		return random;
+	}
+
 	static inline uint64_t FastRandom(TCRandom& random)
 	{
-		random.x ^= random.x << 16;
-		random.x ^= random.x >> 5;
-		random.x ^= random.x << 1;
+		uint64_t x = random.s0;
+		const uint64_t y = random.s1;
+		random.s0 = y;
+		x ^= x << 23;
+		random.s1 = x ^ y ^ (x >> 17) ^ (y >> 26);
 
-		const uint64_t t = random.x;
-		random.x = random.y;
-		random.y = random.z;
-		random.z = t ^ random.x ^ random.y;
+		return random.s1 + y;
+	}
 
-		return random.z;
+	uint64_t NextRandom(TCRandom& random)
+	{
+		return FastRandom(random);
 	}
 
 	int32_t RandomRange(TCRandom& random, const int32_t min, const int32_t max)
 	{
-		const uint64_t z = FastRandom(random);
+		//the high bits are the most random ones
+		const uint64_t z = FastRandom(random) >> 16;
+		const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
 
-		return min + (z % (max - min + 1));
+		return static_cast<int32_t>(min + static_cast<int64_t>(z % range));
 	}
 
 	bool RandomBool(TCRandom& random)
 	{
-		return FastRandom(random) & 1;
+		return (FastRandom(random) >> 63) != 0;
 	}
 }
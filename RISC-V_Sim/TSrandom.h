@@ -4,14 +4,25 @@
 
 namespace FRandom {
 
+	//xorshift128+ state. Has to be seeded so it isn't all zeros
 	struct TCRandom
 	{
-		uint64_t x;
-		uint64_t y;
-		uint64_t z;
+		uint64_t s0;
+		uint64_t s1;
 	};
 
+	//Every call returns a new stream without taking a lock. The streams
+	//are seeded with splitmix64 so they aren't correlated with each other
 	TCRandom GetTCRandom();
+	//the same seed and stream always give the same random numbers, so
+	//a stream can be recreated no matter which thread created it first
+	TCRandom CreateTCRandom(const uint64_t seed, const uint64_t stream = 0);
+	//changes the seed used by GetTCRandom and starts over from the first stream
+	void SetSeed(const uint64_t seed);
+	//a stream that belongs to the calling thread
+	TCRandom& ThreadRandom();
+
+	uint64_t NextRandom(TCRandom& random);
 	int32_t RandomRange(TCRandom& random, const int32_t min, const int32_t max);
 	bool RandomBool(TCRandom& random);
-}
\ No newline at end of file
+}
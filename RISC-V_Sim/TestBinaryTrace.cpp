@@ -0,0 +1,204 @@
+#include "TestBinaryTrace.h"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "BinaryTrace.h"
+#include "DecodedProgram.h"
+#include "FuzzCampaign.h"
+#include "InstructionEncode.h"
+#include "Processor.h"
+#include "RandomProgram.h"
+#include "RISCV_Program.h"
+#include "Register.h"
+#include "TestHelpers.h"
+
+static std::string GetTracePath()
+{
+	return (std::filesystem::temp_directory_path() / "rvsim_test.rvtrace").string();
+}
+
+//runs the program one instruction at a time on another processor
+//and checks every record against what that instruction did
+static void CompareTraceWithSteps(const std::shared_ptr<const DecodedProgram>& program, const std::string& tracePath, const uint64_t retiredInstructions)
+{
+	Processor reference;
+	reference.Load(program);
+	TraceReader reader(tracePath);
+	TraceRecord record;
+	uint64_t recordCount = 0;
+	while (reader.Next(record))
+	{
+		const std::string where = "record " + std::to_string(recordCount);
+		const HartState before = reference.GetHartState();
+		const Instruction& instruction = program->GetInstructions()[before.pc / 4];
+		Expect(record.pc == before.pc, "wrong pc in " + where);
+		Expect(record.rawInstruction == program->GetRawInstructions()[before.pc / 4], "wrong instruction in " + where);
+		Expect(record.hasMemoryAddress == IsMemoryAccess(instruction.type), "wrong memory flag in " + where);
+		if (record.hasMemoryAddress)
+		{
+			Expect(record.memoryAddress == TraceWriter::GetMemoryAddress(before, instruction), "wrong memory address in " + where);
+		}
+
+		reference.Continue(1);
+		if (record.hasRegisterValue)
+		{
+			Expect(record.rd == instruction.rd, "wrong rd in " + where);
+			Expect(record.registerValue == reference.GetHartState().registers[record.rd].uword, "wrong register value in " + where);
+		}
+		recordCount++;
+	}
+	Expect(recordCount == retiredInstructions, "every retired instruction should be in the trace");
+}
+
+static void TestTraceMatchesExecution()
+{
+	const std::string tracePath = GetTracePath();
+	InstructionMix mix;
+	for (uint64_t i = 0; i < 20; i++)
+	{
+		std::unique_ptr<RISCV_Program> program = CreateFuzzProgram(7, i, 200, mix);
+		for (const ExecutionEngine engine : { ExecutionEngine::Reference, ExecutionEngine::Threaded })
+		{
+			Processor processor;
+			//a small buffer so it has to be written many times
+			TraceWriter trace(tracePath, i % 2 == 0 ? 64 : 1 << 20);
+			processor.SetEngine(engine);
+			processor.SetTraceWriter(&trace);
+			Expect(program->Run(processor) == RunStatus::Exited, "the random program should exit");
+			trace.Close();
+			Expect(trace.GetRecordCount() == program->GetRetiredInstructions(), "the writer should count every instruction");
+
+			CompareTraceWithSteps(program->GetDecodedProgram(), tracePath, program->GetRetiredInstructions());
+		}
+	}
+	std::filesystem::remove(tracePath);
+
+	Success("binary trace matches execution");
+}
+
+static void TestTraceIsCompactAndReadable()
+{
+	//a loop is traced with two bytes per instruction
+	std::vector<uint32_t> loop;
+	loop.push_back(Create_addi(Regs::t1, Regs::x0, 1000));
+	loop.push_back(Create_addi(Regs::t1, Regs::t1, -1));
+	loop.push_back(Create_bne(Regs::t1, Regs::x0, -4));
+	loop.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	loop.push_back(Create_ecall());
+
+	const std::string tracePath = GetTracePath();
+	{
+		Processor processor;
+		TraceWriter trace(tracePath);
+		processor.SetTraceWriter(&trace);
+		processor.Run(DecodeProgram(loop.data(), loop.size()));
+		trace.Close();
+		Expect(trace.GetRecordCount() == 2003, "the loop should run 2003 instructions");
+		Expect(trace.GetByteCount() < 2003 * 2, "a loop should take less than two bytes per instruction");
+		Expect(std::filesystem::file_size(tracePath) == trace.GetByteCount(), "the whole trace should be written");
+	}
+
+	std::stringstream text;
+	Expect(ConvertTraceToText(tracePath, text) == 2003, "every record should be converted");
+	std::string firstLine;
+	std::getline(text, firstLine);
+	Expect(firstLine == "00000000: 3e800313 addi t1 x0 1000  t1=0x000003e8", "wrong text for the first record: " + firstLine);
+
+	//a trace that was cut off in the middle of a record
+	std::filesystem::resize_file(tracePath, std::filesystem::file_size(tracePath) - 1);
+	bool threw = false;
+	try
+	{
+		std::stringstream ignored;
+		ConvertTraceToText(tracePath, ignored);
+	}
+	catch (const std::runtime_error&)
+	{
+		threw = true;
+	}
+	std::filesystem::remove(tracePath);
+	Expect(threw, "a truncated trace should be an error");
+
+	Success("binary trace is compact and readable");
+}
+
+static std::vector<char> ReadTraceFile(const std::string& tracePath)
+{
+	std::ifstream file(tracePath, std::ios::binary);
+	return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void TestAsyncTraceMatchesSync()
+{
+	const std::string tracePath = GetTracePath();
+	InstructionMix mix;
+	for (uint64_t i = 0; i < 10; i++)
+	{
+		std::unique_ptr<RISCV_Program> program = CreateFuzzProgram(11, i, 500, mix);
+		std::vector<char> syncTrace;
+		//a ring of one record makes the run loop wait for the writer on every instruction
+		for (const size_t ringSize : { size_t(0), size_t(1), size_t(1) << 16 })
+		{
+			{
+				Processor processor;
+				TraceWriter trace(tracePath, i % 2 == 0 ? 64 : 1 << 20, ringSize);
+				processor.SetEngine(ExecutionEngine::Threaded);
+				processor.SetTraceWriter(&trace);
+				Expect(program->Run(processor) == RunStatus::Exited, "the random program should exit");
+				if (ringSize != 0)
+				{
+					bool threw = false;
+					try
+					{
+						trace.GetByteCount();
+					}
+					catch (const std::runtime_error&)
+					{
+						threw = true;
+					}
+					Expect(threw, "the byte count of a ring trace shouldn't be read before Close");
+				}
+				trace.Close();
+				Expect(trace.GetRecordCount() == program->GetRetiredInstructions(), "the writer should count every instruction");
+				Expect(std::filesystem::file_size(tracePath) == trace.GetByteCount(), "the whole trace should be written");
+			}
+
+			if (ringSize == 0)
+			{
+				syncTrace = ReadTraceFile(tracePath);
+			}
+			else
+			{
+				Expect(ReadTraceFile(tracePath) == syncTrace, "a trace written through a ring of " + std::to_string(ringSize) + " should be the same as one written directly");
+			}
+		}
+	}
+	std::filesystem::remove(tracePath);
+
+	Success("async binary trace matches sync trace");
+}
+
+void TestAllBinaryTrace()
+{
+	try
+	{
+		TestTraceMatchesExecution();
+		TestTraceIsCompactAndReadable();
+		TestAsyncTraceMatchesSync();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all binary trace tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all binary trace tests\n" << std::endl;
+}
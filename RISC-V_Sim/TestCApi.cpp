@@ -0,0 +1,112 @@
+#include "TestCApi.h"
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "rvsim.h"
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "TestHelpers.h"
+
+static void Test_rvsim_run()
+{
+	//t0 = a1 + a2 and store it in memory
+	std::vector<uint32_t> program;
+	program.push_back(Create_add(Regs::t0, Regs::a1, Regs::a2));
+	program.push_back(Create_sw(Regs::x0, Regs::t0, 64));
+	program.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	program.push_back(Create_ecall());
+
+	rvsim_processor* processor = rvsim_create();
+	Expect(processor != nullptr, "rvsim_create");
+	Expect(rvsim_load_program(processor, program.data(), program.size()) == RVSIM_OK, "rvsim_load_program");
+	Expect(rvsim_set_register(processor, static_cast<unsigned>(Regs::a1), 1200) == RVSIM_OK, "rvsim_set_register");
+	Expect(rvsim_set_register(processor, static_cast<unsigned>(Regs::a2), 34) == RVSIM_OK, "rvsim_set_register");
+	Expect(rvsim_run(processor, UINT64_MAX) == RVSIM_OK, rvsim_last_error(processor));
+	Expect(rvsim_get_register(processor, static_cast<unsigned>(Regs::t0)) == 1234, "t0 should be 1234");
+	Expect(rvsim_retired_instructions(processor) == 4, "should retire 4 instructions");
+
+	uint32_t stored = 0;
+	Expect(rvsim_read_memory(processor, 64, &stored, sizeof(stored)) == RVSIM_OK, "rvsim_read_memory");
+	Expect(stored == 1234, "memory should contain 1234");
+	Expect(rvsim_read_memory(processor, rvsim_memory_size() - 2, &stored, sizeof(stored)) == RVSIM_ERROR, "reading outside memory should fail");
+
+	//reset keeps the program but clears the state
+	Expect(rvsim_reset(processor) == RVSIM_OK, "rvsim_reset");
+	Expect(rvsim_read_memory(processor, 64, &stored, sizeof(stored)) == RVSIM_OK && stored == 0, "memory should be cleared by reset");
+	Expect(rvsim_get_register(processor, static_cast<unsigned>(Regs::t0)) == 0, "registers should be cleared by reset");
+
+	rvsim_destroy(processor);
+	Success("rvsim_run");
+}
+
+static void Test_rvsim_ebreak()
+{
+	std::vector<uint32_t> program;
+	program.push_back(Create_addi(Regs::t0, Regs::x0, 1));
+	program.push_back(Create_addi(Regs::t0, Regs::t0, 1));
+	program.push_back(Create_addi(Regs::t0, Regs::t0, 1));
+	program.push_back(Create_ebreak());
+	program.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	program.push_back(Create_ecall());
+
+	//an ebreak can't wait for input in a library
+	rvsim_processor* processor = rvsim_create();
+	Expect(rvsim_load_program(processor, program.data(), program.size()) == RVSIM_OK, rvsim_last_error(processor));
+	Expect(rvsim_run(processor, UINT64_MAX) == RVSIM_ERROR, "an ebreak should stop the program with an error");
+	Expect(std::string(rvsim_last_error(processor)).find("ebreak") != std::string::npos, "the error should say that it was an ebreak");
+	Expect(rvsim_get_register(processor, static_cast<unsigned>(Regs::t0)) == 3, "the instructions before the ebreak should have run");
+	Expect(rvsim_retired_instructions(processor) == 3, "the instructions before the ebreak should be retired");
+	rvsim_destroy(processor);
+	Success("rvsim ebreak");
+}
+
+static void Test_rvsim_instruction_limit()
+{
+	//loops forever unless a0 is already 10
+	std::vector<uint32_t> program;
+	program.push_back(Create_addi(Regs::t0, Regs::t0, 1));
+	program.push_back(Create_bne(Regs::a0, Regs::a1, -4));
+	program.push_back(Create_ecall());
+
+	rvsim_processor* processor = rvsim_create();
+	Expect(rvsim_load_program_bytes(processor, program.data(), program.size() * sizeof(uint32_t)) == RVSIM_OK, rvsim_last_error(processor));
+	rvsim_set_register(processor, static_cast<unsigned>(Regs::a1), 10);
+	Expect(rvsim_run(processor, 1000) == RVSIM_INSTRUCTION_LIMIT, "run should stop at the instruction limit");
+	Expect(rvsim_retired_instructions(processor) == 1000, "should retire exactly 1000 instructions");
+	Expect(rvsim_get_register(processor, static_cast<unsigned>(Regs::t0)) == 500, "t0 should be 500");
+
+	//continue from where it stopped and let it exit
+	rvsim_set_register(processor, static_cast<unsigned>(Regs::a0), 10);
+	Expect(rvsim_run(processor, 1000) == RVSIM_OK, rvsim_last_error(processor));
+	Expect(rvsim_get_register(processor, static_cast<unsigned>(Regs::t0)) == 501, "t0 should be 501");
+
+	//a0 no longer matches so it loops until the timeout
+	rvsim_reset(processor);
+	rvsim_set_register(processor, static_cast<unsigned>(Regs::a1), 10);
+	Expect(rvsim_run_for(processor, UINT64_MAX, 20) == RVSIM_TIMEOUT, "run should stop at the timeout");
+
+	Expect(rvsim_load_program_bytes(processor, program.data(), 3) == RVSIM_ERROR, "program size has to be a multiple of 4");
+
+	rvsim_destroy(processor);
+	Success("rvsim_instruction_limit");
+}
+
+void TestAllCApi()
+{
+	try
+	{
+		Test_rvsim_run();
+		Test_rvsim_instruction_limit();
+		Test_rvsim_ebreak();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all C API tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all C API tests\n" << std::endl;
+}
@@ -0,0 +1,105 @@
+#include "TestCoverageFuzzer.h"
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "CoverageFuzzer.h"
+#include "InstructionEncode.h"
+#include "ProgramFileWriter.h"
+#include "TestHelpers.h"
+
+static void TestCoverageFuzzerFindsCoverage()
+{
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "rvsim_coverage_fuzz";
+	std::filesystem::remove_all(directory);
+
+	CoverageFuzzOptions options;
+	options.seed = 7;
+	options.executions = 20000;
+	options.threadCount = 1;
+	options.corpusDirectory = (directory / "corpus").string();
+	options.findingsDirectory = (directory / "findings").string();
+	options.printProgress = false;
+	const CoverageFuzzReport report = RunCoverageFuzzer(options);
+
+	//the seed input alone reaches a single pc, so the corpus has to grow
+	const bool foundCoverage = report.corpusSize > 1 && report.pcs > 1 && report.executedTypes > 2;
+	if (report.findings != 0 || !foundCoverage)
+	{
+		PrintCoverageFuzzReport(report);
+	}
+	Expect(report.findings == 0, "the engines disagreed, see " + options.findingsDirectory);
+	Expect(foundCoverage, "the fuzzer didn't find new coverage");
+	Expect(std::distance(std::filesystem::directory_iterator(options.corpusDirectory), std::filesystem::directory_iterator()) != 0, "the corpus wasn't saved");
+
+	//a second run starts from the saved corpus
+	options.executions = 1000;
+	const CoverageFuzzReport resumed = RunCoverageFuzzer(options);
+	const bool loadedCorpus = resumed.corpusSize >= report.corpusSize && resumed.findings == 0;
+	if (!loadedCorpus)
+	{
+		PrintCoverageFuzzReport(resumed);
+	}
+	Expect(loadedCorpus, "the saved corpus wasn't loaded");
+
+	std::filesystem::remove_all(directory);
+	Success("coverage fuzzer finds coverage");
+}
+
+static void TestCoverageFuzzerReplacesEbreakInSeeds()
+{
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "rvsim_coverage_fuzz_ebreak";
+	std::filesystem::remove_all(directory);
+	std::filesystem::create_directories(directory / "corpus");
+
+	//a seed that starts with an ebreak and then jumps through a few blocks
+	std::vector<uint32_t> seed = { Create_ebreak() };
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		seed.push_back(Create_jal(Regs::x0, 4));
+	}
+	ProgramFileWriter writer((directory / "corpus" / "ebreak_seed").string(), false);
+	writer.AddInstructions(seed.data(), seed.size());
+	writer.Close();
+
+	CoverageFuzzOptions options;
+	options.seed = 7;
+	options.executions = 1;
+	//the mutated input is cut to nothing, so only the seeds can reach new pcs
+	options.maxInputWords = 0;
+	options.threadCount = 1;
+	options.corpusDirectory = (directory / "corpus").string();
+	options.findingsDirectory = (directory / "findings").string();
+	options.printProgress = false;
+	const CoverageFuzzReport report = RunCoverageFuzzer(options);
+
+	//every run exits, and the seed gets past the ebreak to the blocks after it
+	const bool ranSeed = report.findings == 0 && report.outcomes == 1 && report.pcs >= 5;
+	if (!ranSeed)
+	{
+		PrintCoverageFuzzReport(report);
+	}
+	Expect(ranSeed, "the ebreak in the seed wasn't replaced");
+
+	std::filesystem::remove_all(directory);
+	Success("coverage fuzzer replaces ebreak in seeds");
+}
+
+void TestAllCoverageFuzzer()
+{
+	try
+	{
+		TestCoverageFuzzerFindsCoverage();
+		TestCoverageFuzzerReplacesEbreakInSeeds();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all coverage fuzzer tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all coverage fuzzer tests\n" << std::endl;
+}
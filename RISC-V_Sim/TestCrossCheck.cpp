@@ -0,0 +1,87 @@
+#include "TestCrossCheck.h"
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "BatchRunner.h"
+#include "CrossCheck.h"
+#include "FuzzCampaign.h"
+#include "Processor.h"
+#include "RandomProgram.h"
+#include "RISCV_Program.h"
+#include "TestHelpers.h"
+
+static void ExpectNoDivergence(const CrossCheckResult& result)
+{
+	if (result.diverged)
+	{
+		PrintCrossCheckResult(result);
+	}
+	Expect(!result.diverged, "the threaded engine diverged in " + result.programPath);
+}
+
+static void TestCrossCheckTestPrograms()
+{
+	//every instruction is in these, including the ones the threaded engine leaves to the processor
+	std::vector<std::string> programs = FindBatchPrograms("InstructionTests");
+	const std::vector<std::string> otherPrograms = FindBatchPrograms("tests");
+	programs.insert(programs.end(), otherPrograms.begin(), otherPrograms.end());
+
+	CrossCheckOptions options;
+	options.compareMemory = true;
+	for (const CrossCheckResult& result : CrossCheckPrograms(programs, options))
+	{
+		ExpectNoDivergence(result);
+	}
+
+	Success("cross check test programs");
+}
+
+static void TestCrossCheckRandomPrograms()
+{
+	Processor reference;
+	Processor threaded;
+	InstructionMix mix;
+	CrossCheckOptions options;
+	options.maxInstructions = GetMaxExecutedInstructions(mix, 200);
+	for (uint64_t i = 0; i < 200; i++)
+	{
+		std::unique_ptr<RISCV_Program> program = CreateFuzzProgram(42, i, 200, mix);
+		//an interval that doesn't line up with the blocks
+		options.interval = i % 2 == 0 ? 0 : 7;
+		CrossCheckResult result = CrossCheckProgram(program->GetDecodedProgram(), options, reference, threaded);
+		result.programPath = program->GetProgramName();
+		ExpectNoDivergence(result);
+		Expect(result.status == RunStatus::Exited && result.error.empty(), "random program " + std::to_string(i) + " didn't exit");
+	}
+
+	Success("cross check random programs");
+}
+
+static void TestCrossCheckMissingProgram()
+{
+	const std::vector<CrossCheckResult> results = CrossCheckPrograms({ "does_not_exist" }, CrossCheckOptions());
+	Expect(results.size() == 1 && !results[0].loadError.empty(), "a program that can't be loaded should have a load error");
+
+	Success("cross check missing program");
+}
+
+void TestAllCrossCheck()
+{
+	try
+	{
+		TestCrossCheckTestPrograms();
+		TestCrossCheckRandomPrograms();
+		TestCrossCheckMissingProgram();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all cross check tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all cross check tests\n" << std::endl;
+}
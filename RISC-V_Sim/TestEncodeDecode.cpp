@@ -6,6 +6,7 @@
 #include "InstructionDecode.h"
 #include "InstructionEncode.h"
 #include "Register.h"
+#include "DecodeVerifier.h"
 
 static void TestEncodeDecodeInstruction(const uint32_t encoded, const std::string& expectedDecoded)
 {
@@ -55,11 +56,11 @@ static void Test_lhu()
 }
 static void Test_fence()
 {
-
+	TestEncodeDecodeInstruction(Create_fence(), "fence x0 x0 255");
 }
 static void Test_fence_i()
 {
-
+	TestEncodeDecodeInstruction(Create_fence_i(), "fence_i x0 x0 0");
 }
 static void Test_addi()
 {
@@ -210,6 +211,8 @@ static void Test_beq()
 	TestEncodeDecodeInstruction(Create_beq(Regs::a5, Regs::a1,  -4), "beq a5 a1 -4");
 	TestEncodeDecodeInstruction(Create_beq(Regs::s2, Regs::t4, 132), "beq s2 t4 132");
 	TestEncodeDecodeInstruction(Create_beq(Regs::t6, Regs::sp,  20), "beq t6 sp 20");
+	TestEncodeDecodeInstruction(Create_beq(Regs::a0, Regs::a1, -4096), "beq a0 a1 -4096");
+	TestEncodeDecodeInstruction(Create_beq(Regs::a0, Regs::a1,  4094), "beq a0 a1 4094");
 }
 static void Test_bne()
 {
@@ -252,6 +255,8 @@ static void Test_jal()
 	TestEncodeDecodeInstruction(Create_jal(Regs::s11,-54222), "jal s11 -54222");
 	TestEncodeDecodeInstruction(Create_jal(Regs::s6, 12322), "jal s6 12322");
 	TestEncodeDecodeInstruction(Create_jal(Regs::t0,    122), "jal t0 122");
+	TestEncodeDecodeInstruction(Create_jal(Regs::ra, -1048576), "jal ra -1048576");
+	TestEncodeDecodeInstruction(Create_jal(Regs::ra,  1048574), "jal ra 1048574");
 }
 static void Test_ecall()
 {
@@ -263,27 +268,33 @@ static void Test_ebreak()
 }
 static void Test_csrrw()
 {
-
+	TestEncodeDecodeInstruction(Create_csrrw(Regs::a0, Regs::a1, 0x340), "csrrw a0 832 a1");
+	TestEncodeDecodeInstruction(Create_csrrw(Regs::t1, Regs::s3, 0xf14), "csrrw t1 3860 s3");
 }
 static void Test_csrrs()
 {
-
+	TestEncodeDecodeInstruction(Create_csrrs(Regs::a0, Regs::a1, 0x340), "csrrs a0 832 a1");
+	TestEncodeDecodeInstruction(Create_csrrs(Regs::t1, Regs::s3, 0xf14), "csrrs t1 3860 s3");
 }
 static void Test_csrrc()
 {
-
+	TestEncodeDecodeInstruction(Create_csrrc(Regs::a0, Regs::a1, 0x340), "csrrc a0 832 a1");
+	TestEncodeDecodeInstruction(Create_csrrc(Regs::t1, Regs::s3, 0xf14), "csrrc t1 3860 s3");
 }
 static void Test_csrrwi()
 {
-
+	TestEncodeDecodeInstruction(Create_csrrwi(Regs::a0, 17, 0x340), "csrrwi a0 832 17");
+	TestEncodeDecodeInstruction(Create_csrrwi(Regs::t1, 31, 0xf14), "csrrwi t1 3860 31");
 }
 static void Test_csrrsi()
 {
-
+	TestEncodeDecodeInstruction(Create_csrrsi(Regs::a0, 17, 0x340), "csrrsi a0 832 17");
+	TestEncodeDecodeInstruction(Create_csrrsi(Regs::t1, 31, 0xf14), "csrrsi t1 3860 31");
 }
 static void Test_csrrci()
 {
-
+	TestEncodeDecodeInstruction(Create_csrrci(Regs::a0, 17, 0x340), "csrrci a0 832 17");
+	TestEncodeDecodeInstruction(Create_csrrci(Regs::t1, 31, 0xf14), "csrrci t1 3860 31");
 }
 static void Test_mul()
 {
@@ -333,6 +344,118 @@ static void Test_remu()
 	TestEncodeDecodeInstruction(Create_remu(Regs::s2, Regs::t4, Regs::s11), "remu s2 t4 s11");
 	TestEncodeDecodeInstruction(Create_remu(Regs::t5, Regs::s10, Regs::t1), "remu t5 s10 t1");
 }
+static void Test_lr_w()
+{
+	TestEncodeDecodeInstruction(Create_lr_w(Regs::a0, Regs::s5), "lr.w a0 (s5)");
+	TestEncodeDecodeInstruction(Create_lr_w(Regs::t5, Regs::s10, true, false), "lr.w.aq t5 (s10)");
+}
+static void Test_sc_w()
+{
+	TestEncodeDecodeInstruction(Create_sc_w(Regs::a0, Regs::s5, Regs::s10), "sc.w a0 s10 (s5)");
+	TestEncodeDecodeInstruction(Create_sc_w(Regs::s2, Regs::t4, Regs::s11, true, true), "sc.w.aq.rl s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_sc_w(Regs::t5, Regs::s10, Regs::t1, false, true), "sc.w.rl t5 t1 (s10)");
+}
+static void Test_amoswap_w()
+{
+	TestEncodeDecodeInstruction(Create_amoswap_w(Regs::a0, Regs::s5, Regs::s10), "amoswap.w a0 s10 (s5)");
+	TestEncodeDecodeInstruction(Create_amoswap_w(Regs::s2, Regs::t4, Regs::s11, true, true), "amoswap.w.aq.rl s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amoswap_w(Regs::t5, Regs::s10, Regs::t1, false, true), "amoswap.w.rl t5 t1 (s10)");
+}
+static void Test_amoadd_w()
+{
+	TestEncodeDecodeInstruction(Create_amoadd_w(Regs::a0, Regs::s5, Regs::s10), "amoadd.w a0 s10 (s5)");
+	TestEncodeDecodeInstruction(Create_amoadd_w(Regs::s2, Regs::t4, Regs::s11, true, true), "amoadd.w.aq.rl s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amoadd_w(Regs::t5, Regs::s10, Regs::t1, false, true), "amoadd.w.rl t5 t1 (s10)");
+}
+static void Test_amoxor_w()
+{
+	TestEncodeDecodeInstruction(Create_amoxor_w(Regs::a0, Regs::s5, Regs::s10), "amoxor.w a0 s10 (s5)");
+	TestEncodeDecodeInstruction(Create_amoxor_w(Regs::s2, Regs::t4, Regs::s11, true, true), "amoxor.w.aq.rl s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amoxor_w(Regs::t5, Regs::s10, Regs::t1, false, true), "amoxor.w.rl t5 t1 (s10)");
+}
+static void Test_amoand_w()
+{
+	TestEncodeDecodeInstruction(Create_amoand_w(Regs::a0, Regs::s5, Regs::s10), "amoand.w a0 s10 (s5)");
+	TestEncodeDecodeInstruction(Create_amoand_w(Regs::s2, Regs::t4, Regs::s11, true, true), "amoand.w.aq.rl s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amoand_w(Regs::t5, Regs::s10, Regs::t1, false, true), "amoand.w.rl t5 t1 (s10)");
+}
+static void Test_amoor_w()
+{
+	TestEncodeDecodeInstruction(Create_amoor_w(Regs::a0, Regs::s5, Regs::s10), "amoor.w a0 s10 (s5)");
+	TestEncodeDecodeInstruction(Create_amoor_w(Regs::s2, Regs::t4, Regs::s11, true, true), "amoor.w.aq.rl s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amoor_w(Regs::t5, Regs::s10, Regs::t1, false, true), "amoor.w.rl t5 t1 (s10)");
+}
+static void Test_amomin_w()
+{
+	TestEncodeDecodeInstruction(Create_amomin_w(Regs::a0, Regs::s5, Regs::s10), "amomin.w a0 s10 (s5)");
+	TestEncodeDecodeInstruction(Create_amomin_w(Regs::s2, Regs::t4, Regs::s11, true, true), "amomin.w.aq.rl s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amomin_w(Regs::t5, Regs::s10, Regs::t1, false, true), "amomin.w.rl t5 t1 (s10)");
+}
+static void Test_amomax_w()
+{
+	TestEncodeDecodeInstruction(Create_amomax_w(Regs::a0, Regs::s5, Regs::s10), "amomax.w a0 s10 (s5)");
+	TestEncodeDecodeInstruction(Create_amomax_w(Regs::s2, Regs::t4, Regs::s11, true, true), "amomax.w.aq.rl s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amomax_w(Regs::t5, Regs::s10, Regs::t1, false, true), "amomax.w.rl t5 t1 (s10)");
+}
+static void Test_amominu_w()
+{
+	TestEncodeDecodeInstruction(Create_amominu_w(Regs::a0, Regs::s5, Regs::s10), "amominu.w a0 s10 (s5)");
+	TestEncodeDecodeInstruction(Create_amominu_w(Regs::s2, Regs::t4, Regs::s11, true, true), "amominu.w.aq.rl s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amominu_w(Regs::t5, Regs::s10, Regs::t1, false, true), "amominu.w.rl t5 t1 (s10)");
+}
+static void Test_amomaxu_w()
+{
+	TestEncodeDecodeInstruction(Create_amomaxu_w(Regs::a0, Regs::s5, Regs::s10), "amomaxu.w a0 s10 (s5)");
+	TestEncodeDecodeInstruction(Create_amomaxu_w(Regs::s2, Regs::t4, Regs::s11, true, true), "amomaxu.w.aq.rl s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amomaxu_w(Regs::t5, Regs::s10, Regs::t1, false, true), "amomaxu.w.rl t5 t1 (s10)");
+}
+
+static void TestSpecificationEncoding(const uint32_t encoded, const uint32_t expected, const std::string& name)
+{
+	if (encoded != expected)
+	{
+		throw std::runtime_error("\n" + name + " isn't encoded like the specification says.\nExpected: " + NumberToBits(expected) +
+			"\nActual:   " + NumberToBits(encoded) + "\n");
+	}
+	std::cout << "Test Success: " << name << " encoding" << std::endl;
+}
+
+//a round trip only shows that the encoder and decoder agree with each other,
+//these words are from the specification
+static void Test_SpecificationEncodings()
+{
+	TestSpecificationEncoding(Create_ecall(), 0x00000073, "ecall");
+	TestSpecificationEncoding(Create_ebreak(), 0x00100073, "ebreak");
+	TestSpecificationEncoding(Create_fence_i(), 0x0000100f, "fence.i");
+	TestSpecificationEncoding(Create_add(Regs::a0, Regs::a1, Regs::a2), 0x00c58533, "add a0, a1, a2");
+	TestSpecificationEncoding(Create_srai(Regs::a0, Regs::a0, 3), 0x40355513, "srai a0, a0, 3");
+	TestSpecificationEncoding(Create_beq(Regs::x0, Regs::x0, -4096), 0x80000063, "beq x0, x0, -4096");
+	TestSpecificationEncoding(Create_jal(Regs::x0, -1048576), 0x8000006f, "jal x0, -1048576");
+}
+
+static void Test_DecodeRoundTrip()
+{
+	//the whole instruction space takes too long for the tests, so check slices of it.
+	//The opcode and funct3 are in the low bits, so every slice has all instructions
+	const uint64_t SLICE_SIZE = 1 << 20;
+	for (const uint64_t first : { 0x00000000ull, 0x40000000ull, 0x80000000ull, 0xfff00000ull })
+	{
+		const DecodeVerifyReport report = VerifyEncodeDecode(first, SLICE_SIZE);
+		const uint64_t mismatches = report.verdicts[static_cast<uint32_t>(DecodeVerdict::Mismatch)];
+		const uint64_t notEncodable = report.verdicts[static_cast<uint32_t>(DecodeVerdict::NotEncodable)];
+		if (mismatches != 0 || notEncodable != 0)
+		{
+			PrintDecodeVerifyReport(report);
+			throw std::runtime_error("\nDecoded instructions don't encode back to the same instruction.\n");
+		}
+		if (report.verdicts[static_cast<uint32_t>(DecodeVerdict::RoundTrip)] == 0)
+		{
+			throw std::runtime_error("\nNo decoded instruction encoded back to the same word.\n");
+		}
+	}
+
+	std::cout << "Test Success: decode round trip" << std::endl;
+}
 
 void TestAllEncodeDecode()
 {
@@ -393,6 +516,19 @@ void TestAllEncodeDecode()
 		Test_divu();
 		Test_rem();
 		Test_remu();
+		Test_lr_w();
+		Test_sc_w();
+		Test_amoswap_w();
+		Test_amoadd_w();
+		Test_amoxor_w();
+		Test_amoand_w();
+		Test_amoor_w();
+		Test_amomin_w();
+		Test_amomax_w();
+		Test_amominu_w();
+		Test_amomaxu_w();
+		Test_SpecificationEncodings();
+		Test_DecodeRoundTrip();
 	}
 	catch (std::runtime_error& e)
 	{
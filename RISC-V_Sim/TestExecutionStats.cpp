@@ -0,0 +1,165 @@
+#include "TestExecutionStats.h"
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "BatchRunner.h"
+#include "DecodedProgram.h"
+#include "ExecutionStats.h"
+#include "InstructionEncode.h"
+#include "Processor.h"
+#include "ReadProgram.h"
+#include "RISCV_Program.h"
+#include "Register.h"
+#include "TestHelpers.h"
+
+static uint64_t GetTypeCount(const ExecutionStatsReport& report, const InstructionType type)
+{
+	for (const auto& typeCount : report.typeCounts)
+	{
+		if (typeCount.first == type)
+		{
+			return typeCount.second;
+		}
+	}
+	return 0;
+}
+
+static void TestCountsOfLoop(const ExecutionEngine engine, const uint64_t chunkSize)
+{
+	//a loop that runs 10 times with a load and store of each kind
+	std::vector<uint32_t> loop;
+	loop.push_back(Create_addi(Regs::a1, Regs::x0, 10));
+	loop.push_back(Create_sb(Regs::x0, Regs::t0, 100));
+	loop.push_back(Create_sh(Regs::x0, Regs::t0, 104));
+	loop.push_back(Create_lw(Regs::t1, Regs::x0, 104));
+	loop.push_back(Create_lbu(Regs::t2, Regs::x0, 100));
+	loop.push_back(Create_addi(Regs::a1, Regs::a1, -1));
+	loop.push_back(Create_bne(Regs::a1, Regs::x0, -20));
+	loop.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	loop.push_back(Create_ecall());
+	const std::shared_ptr<const DecodedProgram> program = DecodeProgram(loop.data(), loop.size());
+
+	Processor processor;
+	ExecutionStats stats;
+	processor.SetEngine(engine);
+	processor.SetExecutionStats(&stats);
+	//run it in small steps so blocks are cut by the instruction limit
+	processor.Load(program);
+	while (processor.Continue(chunkSize) != RunStatus::Exited)
+	{
+	}
+	Expect(processor.GetHartState().retiredInstructions == 63, "the loop should run 63 instructions");
+
+	const ExecutionStatsReport report = stats.GetReport();
+	Expect(report.retiredInstructions == 63, "wrong number of retired instructions");
+	Expect(GetTypeCount(report, InstructionType::addi) == 12, "wrong addi count");
+	Expect(GetTypeCount(report, InstructionType::bne) == 10, "wrong bne count");
+	Expect(GetTypeCount(report, InstructionType::ecall) == 1, "wrong ecall count");
+	Expect(report.typeCounts.front().first == InstructionType::addi, "the most run instruction should be first");
+	Expect(report.takenBranches == 9 && report.notTakenBranches == 1, "wrong branch counts");
+	Expect(report.loads[0] == 10 && report.loads[1] == 0 && report.loads[2] == 10, "wrong load counts");
+	Expect(report.stores[0] == 10 && report.stores[1] == 10 && report.stores[2] == 0, "wrong store counts");
+
+	//the counts of another program are added to the same stats
+	std::vector<uint32_t> exit;
+	exit.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	exit.push_back(Create_ecall());
+	processor.Run(DecodeProgram(exit.data(), exit.size()));
+	const ExecutionStatsReport combined = stats.GetReport();
+	Expect(combined.retiredInstructions == 65, "the counts of both programs should be added");
+	Expect(GetTypeCount(combined, InstructionType::ecall) == 2, "the ecalls of both programs should be counted");
+
+	stats.Clear();
+	Expect(stats.GetReport().retiredInstructions == 0, "clearing the stats should remove all counts");
+}
+
+static void TestCountsMatchRetiredInstructions()
+{
+	for (const ExecutionEngine engine : { ExecutionEngine::Reference, ExecutionEngine::Threaded })
+	{
+		Processor processor;
+		ExecutionStats stats;
+		processor.SetEngine(engine);
+		processor.SetExecutionStats(&stats);
+		uint64_t retired = 0;
+		for (const std::string& path : FindBatchPrograms("InstructionTests"))
+		{
+			std::unique_ptr<RISCV_Program> program = LoadProgram(path, false);
+			program->Run(processor);
+			retired += program->GetRetiredInstructions();
+		}
+		Expect(stats.GetReport().retiredInstructions == retired, "the stats should count every retired instruction");
+	}
+
+	Success("execution stats count every retired instruction");
+}
+
+static void TestCountsOfFaultInsideBlock()
+{
+	//a load outside of the memory and an ebreak both throw in the middle of a block
+	for (const uint32_t fault : { Create_lw(Regs::t1, Regs::x0, -4), Create_ebreak() })
+	{
+		std::vector<uint32_t> faulting;
+		faulting.push_back(Create_addi(Regs::t0, Regs::t0, 1));
+		faulting.push_back(Create_addi(Regs::t0, Regs::t0, 1));
+		faulting.push_back(Create_addi(Regs::t0, Regs::t0, 1));
+		faulting.push_back(fault);
+		faulting.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+		faulting.push_back(Create_ecall());
+		const std::shared_ptr<const DecodedProgram> program = DecodeProgram(faulting.data(), faulting.size());
+
+		for (const ExecutionEngine engine : { ExecutionEngine::Reference, ExecutionEngine::Threaded })
+		{
+			for (const bool withStats : { false, true })
+			{
+				Processor processor;
+				ExecutionStats stats;
+				processor.SetEngine(engine);
+				if (withStats)
+				{
+					processor.SetExecutionStats(&stats);
+				}
+				bool threw = false;
+				try
+				{
+					processor.Run(program);
+				}
+				catch (const std::runtime_error&)
+				{
+					threw = true;
+				}
+				Expect(threw, "the program should stop with an error");
+				Expect(processor.GetHartState().registers[static_cast<uint32_t>(Regs::t0)].uword == 3, "the instructions before the fault should have run");
+				Expect(processor.GetHartState().retiredInstructions == 3, "the instructions before the fault should be retired");
+				Expect(!withStats || stats.GetReport().retiredInstructions == 3, "the stats should count the instructions before the fault");
+			}
+		}
+	}
+
+	Success("execution stats count the instructions before a fault");
+}
+
+void TestAllExecutionStats()
+{
+	try
+	{
+		TestCountsOfLoop(ExecutionEngine::Reference, UINT64_MAX);
+		TestCountsOfLoop(ExecutionEngine::Threaded, UINT64_MAX);
+		TestCountsOfLoop(ExecutionEngine::Reference, 4);
+		TestCountsOfLoop(ExecutionEngine::Threaded, 3);
+		Success("execution stats of a loop");
+		TestCountsMatchRetiredInstructions();
+		TestCountsOfFaultInsideBlock();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all execution stats tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all execution stats tests\n" << std::endl;
+}
@@ -0,0 +1,222 @@
+#include "TestGuestProfiler.h"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "CallGraphProfiler.h"
+#include "DecodedProgram.h"
+#include "ElfSymbols.h"
+#include "GuestProfiler.h"
+#include "InstructionEncode.h"
+#include "Processor.h"
+#include "Register.h"
+#include "TestHelpers.h"
+
+//main calls f twice and f loops 50 times before it returns
+static std::shared_ptr<const DecodedProgram> CreateCallingProgram()
+{
+	std::vector<uint32_t> program;
+	program.push_back(Create_jal(Regs::ra, 16));
+	program.push_back(Create_jal(Regs::ra, 12));
+	program.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	program.push_back(Create_ecall());
+	program.push_back(Create_addi(Regs::t1, Regs::x0, 50));
+	program.push_back(Create_addi(Regs::t1, Regs::t1, -1));
+	program.push_back(Create_bne(Regs::t1, Regs::x0, -4));
+	program.push_back(Create_jalr(Regs::x0, Regs::ra, 0));
+	return DecodeProgram(program.data(), program.size());
+}
+
+static std::string ProfileCallingProgram(const ExecutionEngine engine, const uint64_t interval, const SymbolTable& symbols, uint64_t* sampleCount)
+{
+	Processor processor;
+	GuestProfiler profiler(interval);
+	processor.SetEngine(engine);
+	processor.SetProfiler(&profiler);
+	Expect(processor.Run(CreateCallingProgram()) == RunStatus::Exited, "the program should exit");
+	Expect(processor.GetHartState().retiredInstructions == 208, "the program should run 208 instructions");
+
+	*sampleCount = profiler.GetSampleCount();
+	std::stringstream folded;
+	profiler.WriteFoldedStacks(folded, symbols);
+	return folded.str();
+}
+
+static void TestFoldedStacks()
+{
+	for (const ExecutionEngine engine : { ExecutionEngine::Reference, ExecutionEngine::Threaded })
+	{
+		uint64_t sampleCount = 0;
+		const std::string folded = ProfileCallingProgram(engine, 1, SymbolTable(), &sampleCount);
+		Expect(sampleCount == 208, "every instruction should be sampled");
+		Expect(folded == "0x0 4\n0x0;0x10 204\n", "wrong folded stacks:\n" + folded);
+
+		ProfileCallingProgram(engine, 10, SymbolTable(), &sampleCount);
+		Expect(sampleCount == 20, "every tenth instruction should be sampled");
+	}
+
+	Success("profiler folded stacks");
+}
+
+static void AddLittleEndian(std::vector<uint8_t>& bytes, const uint32_t value, const uint32_t size)
+{
+	for (uint32_t i = 0; i < size; i++)
+	{
+		bytes.push_back(static_cast<uint8_t>(value >> (i * 8)));
+	}
+}
+
+static void AddSectionHeader(std::vector<uint8_t>& bytes, const uint32_t type, const uint32_t offset, const uint32_t size, const uint32_t link)
+{
+	AddLittleEndian(bytes, 0, 4);
+	AddLittleEndian(bytes, type, 4);
+	AddLittleEndian(bytes, 0, 4);
+	AddLittleEndian(bytes, 0, 4);
+	AddLittleEndian(bytes, offset, 4);
+	AddLittleEndian(bytes, size, 4);
+	AddLittleEndian(bytes, link, 4);
+	AddLittleEndian(bytes, 0, 4);
+	AddLittleEndian(bytes, 0, 4);
+	AddLittleEndian(bytes, type == 2 ? 16 : 0, 4);
+}
+
+static void AddSymbol(std::vector<uint8_t>& bytes, const uint32_t name, const uint32_t address, const uint32_t size, const uint32_t type)
+{
+	AddLittleEndian(bytes, name, 4);
+	AddLittleEndian(bytes, address, 4);
+	AddLittleEndian(bytes, size, 4);
+	AddLittleEndian(bytes, type, 1);
+	AddLittleEndian(bytes, 0, 1);
+	AddLittleEndian(bytes, type == 0 ? 0 : 1, 2);
+}
+
+//an ELF file with only a symbol table, for the calling program linked at 0x10000
+static std::string WriteElfWithSymbols()
+{
+	const std::string strings = std::string("\0main\0f\0", 8);
+	const uint32_t HEADER_SIZE = 52;
+	const uint32_t stringsOffset = HEADER_SIZE;
+	const uint32_t symbolsOffset = stringsOffset + static_cast<uint32_t>(strings.size());
+	const uint32_t symbolsSize = 3 * 16;
+	const uint32_t sectionsOffset = symbolsOffset + symbolsSize;
+
+	std::vector<uint8_t> bytes = { 0x7f, 'E', 'L', 'F', 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	AddLittleEndian(bytes, 2, 2);
+	AddLittleEndian(bytes, 0xf3, 2);
+	AddLittleEndian(bytes, 1, 4);
+	AddLittleEndian(bytes, 0x10000, 4);
+	AddLittleEndian(bytes, 0, 4);
+	AddLittleEndian(bytes, sectionsOffset, 4);
+	AddLittleEndian(bytes, 0, 4);
+	AddLittleEndian(bytes, HEADER_SIZE, 2);
+	AddLittleEndian(bytes, 0, 2);
+	AddLittleEndian(bytes, 0, 2);
+	AddLittleEndian(bytes, 40, 2);
+	AddLittleEndian(bytes, 3, 2);
+	AddLittleEndian(bytes, 0, 2);
+
+	bytes.insert(bytes.end(), strings.begin(), strings.end());
+	AddSymbol(bytes, 0, 0, 0, 0);
+	AddSymbol(bytes, 1, 0x10000, 16, 2);
+	AddSymbol(bytes, 6, 0x10010, 16, 2);
+
+	AddSectionHeader(bytes, 0, 0, 0, 0);
+	AddSectionHeader(bytes, 2, symbolsOffset, symbolsSize, 2);
+	AddSectionHeader(bytes, 3, stringsOffset, static_cast<uint32_t>(strings.size()), 0);
+
+	const std::string filepath = (std::filesystem::temp_directory_path() / "rvsim_profiler_symbols.elf").string();
+	std::ofstream file(filepath, std::ios::binary);
+	file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+	return filepath;
+}
+
+static void TestElfSymbols()
+{
+	const std::string filepath = WriteElfWithSymbols();
+	const SymbolTable symbols = ReadElfSymbols(filepath, 0x10000);
+	std::filesystem::remove(filepath);
+	Expect(symbols.GetSymbolCount() == 2, "both functions should be read");
+	Expect(symbols.Find(4) && symbols.Find(4)->name == "main", "address 4 should be in main");
+	Expect(symbols.Find(28) && symbols.Find(28)->name == "f", "address 28 should be in f");
+	Expect(!symbols.Find(32), "address 32 is past the end of f");
+
+	uint64_t sampleCount = 0;
+	const std::string folded = ProfileCallingProgram(ExecutionEngine::Threaded, 1, symbols, &sampleCount);
+	Expect(folded == "main 4\nmain;f 204\n", "wrong folded stacks with symbols:\n" + folded);
+
+	Success("profiler elf symbols");
+}
+
+//main calls g which calls itself until t1 is 3, saving ra on the stack
+static std::shared_ptr<const DecodedProgram> CreateRecursiveProgram()
+{
+	std::vector<uint32_t> program;
+	program.push_back(Create_addi(Regs::t2, Regs::x0, 3));
+	program.push_back(Create_jal(Regs::ra, 12));
+	program.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	program.push_back(Create_ecall());
+	program.push_back(Create_addi(Regs::sp, Regs::sp, -4));
+	program.push_back(Create_sw(Regs::sp, Regs::ra, 0));
+	program.push_back(Create_addi(Regs::t1, Regs::t1, 1));
+	program.push_back(Create_bge(Regs::t1, Regs::t2, 8));
+	program.push_back(Create_jal(Regs::ra, -16));
+	program.push_back(Create_lw(Regs::ra, Regs::sp, 0));
+	program.push_back(Create_addi(Regs::sp, Regs::sp, 4));
+	program.push_back(Create_jalr(Regs::x0, Regs::ra, 0));
+	return DecodeProgram(program.data(), program.size());
+}
+
+static void TestCallGraph()
+{
+	for (const ExecutionEngine engine : { ExecutionEngine::Reference, ExecutionEngine::Threaded })
+	{
+		Processor processor;
+		CallGraphProfiler callGraph;
+		processor.SetEngine(engine);
+		processor.SetCallGraphProfiler(&callGraph);
+		Expect(processor.Run(CreateRecursiveProgram()) == RunStatus::Exited, "the recursive program should exit");
+		Expect(processor.GetHartState().retiredInstructions == 27, "the recursive program should run 27 instructions");
+
+		const CallGraphReport report = callGraph.GetReport(SymbolTable(), 2);
+		Expect(report.retiredInstructions == 27 && report.memoryAccesses == 6, "every instruction and memory access should be counted");
+		Expect(report.functions.size() == 2, "there should be two functions");
+		const CallGraphFunction& main = report.functions[0];
+		const CallGraphFunction& g = report.functions[1];
+		Expect(main.name == "0x0" && main.calls == 1, "main should be called once");
+		Expect(main.inclusiveInstructions == 27 && main.exclusiveInstructions == 4, "wrong instruction counts for main");
+		Expect(main.inclusiveMemoryAccesses == 6 && main.exclusiveMemoryAccesses == 0, "wrong memory access counts for main");
+		Expect(g.name == "0x10" && g.calls == 3, "g should be called three times");
+		Expect(g.inclusiveInstructions == 23 && g.exclusiveInstructions == 23, "recursive calls should only be included once");
+		Expect(g.inclusiveMemoryAccesses == 6 && g.exclusiveMemoryAccesses == 6, "wrong memory access counts for g");
+		Expect(report.paths.size() == 2 && report.paths[0].frames.size() == 2 && report.paths[0].exclusiveInstructions == 8, "wrong hottest path");
+
+		std::stringstream folded;
+		callGraph.WriteFoldedStacks(folded, SymbolTable());
+		Expect(folded.str() == "0x0 4\n0x0;0x10 8\n0x0;0x10;0x10 8\n0x0;0x10;0x10;0x10 7\n", "wrong exact folded stacks:\n" + folded.str());
+	}
+
+	Success("call graph profiler");
+}
+
+void TestAllGuestProfiler()
+{
+	try
+	{
+		TestFoldedStacks();
+		TestElfSymbols();
+		TestCallGraph();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all profiler tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all profiler tests\n" << std::endl;
+}
@@ -0,0 +1,79 @@
+#include "TestGuestScheduler.h"
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "GuestScheduler.h"
+#include "DecodedProgram.h"
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "TestHelpers.h"
+
+static void TestInterleavedPrograms()
+{
+	//t0 = a1 + (a1 - 1) + ... + 1 and store it in memory
+	std::vector<uint32_t> sumProgram;
+	sumProgram.push_back(Create_add(Regs::t0, Regs::t0, Regs::a1));
+	sumProgram.push_back(Create_addi(Regs::a1, Regs::a1, -1));
+	sumProgram.push_back(Create_bne(Regs::a1, Regs::x0, -8));
+	sumProgram.push_back(Create_sw(Regs::x0, Regs::t0, 64));
+	sumProgram.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	sumProgram.push_back(Create_ecall());
+
+	//jumps past the end of the program
+	std::vector<uint32_t> crashingProgram;
+	crashingProgram.push_back(Create_jal(Regs::x0, 400));
+
+	std::vector<uint32_t> endlessProgram;
+	endlessProgram.push_back(Create_jal(Regs::x0, 0));
+
+	//a small quantum so the programs are switched many times
+	GuestScheduler scheduler(5);
+	const std::shared_ptr<const DecodedProgram> decodedSum = DecodeTestProgram(sumProgram);
+	const uint32_t PROGRAM_COUNT = 300;
+	for (uint32_t i = 1; i <= PROGRAM_COUNT; i++)
+	{
+		uint32_t registers[32] = { 0 };
+		registers[static_cast<uint32_t>(Regs::a1)] = i;
+		scheduler.AddProgram(decodedSum, registers);
+	}
+	const size_t crashing = scheduler.AddProgram(DecodeTestProgram(crashingProgram));
+	const size_t endless = scheduler.AddProgram(DecodeTestProgram(endlessProgram));
+
+	scheduler.RunAll(100'000);
+
+	for (uint32_t i = 1; i <= PROGRAM_COUNT; i++)
+	{
+		const GuestContext& context = scheduler.GetContext(i - 1);
+		const uint32_t expected = i * (i + 1) / 2;
+		uint32_t stored = 0;
+		context.memory->CopyTo(64, sizeof(stored), reinterpret_cast<uint8_t*>(&stored));
+
+		Expect(context.status == GuestStatus::Exited, "program " + std::to_string(i) + " should have exited");
+		Expect(context.hart.registers[static_cast<uint32_t>(Regs::t0)].uword == expected, "wrong sum in program " + std::to_string(i));
+		Expect(stored == expected, "each program should have its own memory");
+		Expect(context.hart.retiredInstructions == i * 3 + 3, "wrong instruction count in program " + std::to_string(i));
+	}
+	Expect(scheduler.GetContext(crashing).status == GuestStatus::Error, "a failing program should be stopped");
+	Expect(scheduler.GetContext(endless).status == GuestStatus::InstructionLimit, "an endless program should be stopped");
+	Expect(scheduler.GetContext(endless).hart.retiredInstructions == 100'000, "an endless program should run all its instructions");
+
+	Success("scheduler interleaved programs");
+}
+
+void TestAllGuestScheduler()
+{
+	try
+	{
+		TestInterleavedPrograms();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all scheduler tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all scheduler tests\n" << std::endl;
+}
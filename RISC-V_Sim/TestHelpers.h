@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "DecodedProgram.h"
+
+//Helpers shared by the test files. Each TestAllX function catches the
+//exception from Expect and says which group of tests it came from
+
+inline void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+inline void Expect(const bool condition, const std::string& message)
+{
+	if (!condition)
+	{
+		throw std::runtime_error("Test failed: " + message);
+	}
+}
+
+inline std::shared_ptr<const DecodedProgram> DecodeTestProgram(const std::vector<uint32_t>& program)
+{
+	return DecodeProgram(program.data(), program.size());
+}
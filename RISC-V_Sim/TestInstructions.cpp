@@ -10,11 +10,7 @@
 #include "Instruction.h"
 #include "ReadProgram.h"
 #include "RISCV_Program.h"
-
-static void Success(const std::string& testName)
-{
-    std::cout << "Test Success: " << testName << std::endl;
-}
+#include "TestHelpers.h"
 
 static void TestProgram(RISCV_Program& program, const std::string& filepath)
 {
@@ -159,7 +155,19 @@ static void Test_lhu()
 }
 static void Test_fence()
 {
+	RISCV_Program program("Test_fence");
+
+	//a single hart doesn't notice the fence
+	program.SetRegister(Regs::s0, 77);
+	program.AddInstruction(Create_sw(Regs::x0, Regs::s0, 100));
+	program.AddInstruction(Create_fence());
+	program.AddInstruction(Create_lw(Regs::t0, Regs::x0, 100));
+	program.ExpectRegisterValue(Regs::t0, 77);
 
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_fence");
+
+	Success("test_fence");
 }
 static void Test_fence_i()
 {
@@ -496,6 +504,11 @@ static void Test_sll()
 	program.AddInstruction(Create_sll(Regs::t2, Regs::t0, Regs::s0));
 	program.ExpectRegisterValue(Regs::t2, 0xff'00'00'00);
 
+	// only the low 5 bits of the shift amount are used
+	program.SetRegister(Regs::s0, 36);
+	program.AddInstruction(Create_sll(Regs::t3, Regs::t0, Regs::s0));
+	program.ExpectRegisterValue(Regs::t3, 0xf0'0f'f0'00);
+
 	program.EndProgram();
 	TestProgram(program, "InstructionTests/test_sll");
 
@@ -606,6 +619,11 @@ static void Test_srl()
 	program.AddInstruction(Create_srl(Regs::t2, Regs::t0, Regs::a0));
 	program.ExpectRegisterValue(Regs::t2, 0x00'0f'0f'f0);
 
+	// only the low 5 bits of the shift amount are used
+	program.SetRegister(Regs::a0, 44);
+	program.AddInstruction(Create_srl(Regs::t3, Regs::t0, Regs::a0));
+	program.ExpectRegisterValue(Regs::t3, 0x00'0f'0f'f0);
+
 	program.EndProgram();
 	TestProgram(program, "InstructionTests/test_srl");
 
@@ -633,6 +651,12 @@ static void Test_sra()
 	program.AddInstruction(Create_sra(Regs::t4, Regs::t0, Regs::a0));
 	program.ExpectRegisterValue(Regs::t4, 0x00'00'0f'0f);
 
+	// only the low 5 bits of the shift amount are used
+	program.SetRegister(Regs::t0, 0xf0'ff'00'f0);
+	program.SetRegister(Regs::a0, 36);
+	program.AddInstruction(Create_sra(Regs::t5, Regs::t0, Regs::a0));
+	program.ExpectRegisterValue(Regs::t5, 0xff'0f'f0'0f);
+
 	program.EndProgram();
 	TestProgram(program, "InstructionTests/test_sra");
 
@@ -968,6 +992,14 @@ static void Test_jalr()
 	program.SetRegister(Regs::s1, 1);
 	program.ExpectRegisterValue(Regs::s1, 1);
 
+	//the target uses the value of rs1 from before rd is written
+	program.SetRegister(Regs::a1, 32);
+	program.AddInstruction(Create_jalr(Regs::a1, Regs::a1, 8));
+	program.ExpectRegisterValue(Regs::a1, 36);
+	program.AddInstruction(Create_li(Regs::s0, -1));
+	program.SetRegister(Regs::s2, 1);
+	program.ExpectRegisterValue(Regs::s2, 1);
+
 	program.EndProgram();
 	TestProgram(program, "InstructionTests/test_jalr");
 
@@ -1326,7 +1358,7 @@ static void Test_divu()
 
 	program.SetRegister(Regs::a0, 10);
 	program.SetRegister(Regs::a1, 0);
-	program.ExpectRegisterValue(Regs::s10, 10);
+	program.ExpectRegisterValue(Regs::s10, UINT32_MAX);
 	program.ExpectRegisterValue(Regs::s11, 0);
 	program.AddInstruction(Create_divu(Regs::s10, Regs::a0, Regs::a1));
 	program.AddInstruction(Create_divu(Regs::s11, Regs::a1, Regs::a0));
@@ -1445,6 +1477,218 @@ static void Test_remu()
 
 	Success("test_remu");
 }
+static void Test_lr_w()
+{
+	RISCV_Program program("Test_lr_w");
+
+	program.SetRegister(Regs::s0, 200);
+	program.SetRegister(Regs::s1, 0x80'00'12'34);
+	program.AddInstruction(Create_sw(Regs::s0, Regs::s1, 0));
+	program.AddInstruction(Create_lr_w(Regs::t0, Regs::s0));
+	program.ExpectRegisterValue(Regs::t0, 0x80'00'12'34);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_lr_w");
+
+	Success("test_lr_w");
+}
+static void Test_sc_w()
+{
+	RISCV_Program program("Test_sc_w");
+
+	program.SetRegister(Regs::s0, 200);
+	program.SetRegister(Regs::s1, 5);
+	program.SetRegister(Regs::s2, 6);
+	program.SetRegister(Regs::s3, 7);
+	program.AddInstruction(Create_sw(Regs::s0, Regs::s1, 0));
+
+	//without a reservation sc.w fails and doesn't store anything
+	program.AddInstruction(Create_sc_w(Regs::t0, Regs::s0, Regs::s2));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::s0, 0));
+	program.ExpectRegisterValue(Regs::t0, 1);
+	program.ExpectRegisterValue(Regs::t1, 5);
+
+	//with a reservation it succeeds
+	program.AddInstruction(Create_lr_w(Regs::t2, Regs::s0));
+	program.AddInstruction(Create_sc_w(Regs::t3, Regs::s0, Regs::s2));
+	program.AddInstruction(Create_lw(Regs::t4, Regs::s0, 0));
+	program.ExpectRegisterValue(Regs::t2, 5);
+	program.ExpectRegisterValue(Regs::t3, 0);
+	program.ExpectRegisterValue(Regs::t4, 6);
+
+	//the reservation is used up by the first sc.w
+	program.AddInstruction(Create_sc_w(Regs::t5, Regs::s0, Regs::s3));
+	program.AddInstruction(Create_lw(Regs::t6, Regs::s0, 0));
+	program.ExpectRegisterValue(Regs::t5, 1);
+	program.ExpectRegisterValue(Regs::t6, 6);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_sc_w");
+
+	Success("test_sc_w");
+}
+static void Test_amoswap_w()
+{
+	RISCV_Program program("Test_amoswap_w");
+
+	program.SetRegister(Regs::s0, 200);
+	program.SetRegister(Regs::s1, 1234);
+	program.SetRegister(Regs::s2, 4321);
+	program.AddInstruction(Create_sw(Regs::s0, Regs::s1, 0));
+	program.AddInstruction(Create_amoswap_w(Regs::t0, Regs::s0, Regs::s2));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::s0, 0));
+	program.ExpectRegisterValue(Regs::t0, 1234);
+	program.ExpectRegisterValue(Regs::t1, 4321);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amoswap_w");
+
+	Success("test_amoswap_w");
+}
+static void Test_amoadd_w()
+{
+	RISCV_Program program("Test_amoadd_w");
+
+	program.SetRegister(Regs::s0, 200);
+	program.SetRegister(Regs::s1, 1000);
+	program.SetRegister(Regs::s2, -1);
+	program.AddInstruction(Create_sw(Regs::s0, Regs::s1, 0));
+	program.AddInstruction(Create_amoadd_w(Regs::t0, Regs::s0, Regs::s2));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::s0, 0));
+	program.ExpectRegisterValue(Regs::t0, 1000);
+	program.ExpectRegisterValue(Regs::t1, 999);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amoadd_w");
+
+	Success("test_amoadd_w");
+}
+static void Test_amoxor_w()
+{
+	RISCV_Program program("Test_amoxor_w");
+
+	program.SetRegister(Regs::s0, 200);
+	program.SetRegister(Regs::s1, 0b1100);
+	program.SetRegister(Regs::s2, 0b1010);
+	program.AddInstruction(Create_sw(Regs::s0, Regs::s1, 0));
+	program.AddInstruction(Create_amoxor_w(Regs::t0, Regs::s0, Regs::s2));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::s0, 0));
+	program.ExpectRegisterValue(Regs::t0, 0b1100);
+	program.ExpectRegisterValue(Regs::t1, 0b0110);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amoxor_w");
+
+	Success("test_amoxor_w");
+}
+static void Test_amoand_w()
+{
+	RISCV_Program program("Test_amoand_w");
+
+	program.SetRegister(Regs::s0, 200);
+	program.SetRegister(Regs::s1, 0b1100);
+	program.SetRegister(Regs::s2, 0b1010);
+	program.AddInstruction(Create_sw(Regs::s0, Regs::s1, 0));
+	program.AddInstruction(Create_amoand_w(Regs::t0, Regs::s0, Regs::s2));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::s0, 0));
+	program.ExpectRegisterValue(Regs::t0, 0b1100);
+	program.ExpectRegisterValue(Regs::t1, 0b1000);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amoand_w");
+
+	Success("test_amoand_w");
+}
+static void Test_amoor_w()
+{
+	RISCV_Program program("Test_amoor_w");
+
+	program.SetRegister(Regs::s0, 200);
+	program.SetRegister(Regs::s1, 0b1100);
+	program.SetRegister(Regs::s2, 0b1010);
+	program.AddInstruction(Create_sw(Regs::s0, Regs::s1, 0));
+	program.AddInstruction(Create_amoor_w(Regs::t0, Regs::s0, Regs::s2));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::s0, 0));
+	program.ExpectRegisterValue(Regs::t0, 0b1100);
+	program.ExpectRegisterValue(Regs::t1, 0b1110);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amoor_w");
+
+	Success("test_amoor_w");
+}
+static void Test_amomin_w()
+{
+	RISCV_Program program("Test_amomin_w");
+
+	program.SetRegister(Regs::s0, 200);
+	program.SetRegister(Regs::s1, -5);
+	program.SetRegister(Regs::s2, 3);
+	program.AddInstruction(Create_sw(Regs::s0, Regs::s1, 0));
+	program.AddInstruction(Create_amomin_w(Regs::t0, Regs::s0, Regs::s2));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::s0, 0));
+	program.ExpectRegisterValue(Regs::t0, -5);
+	program.ExpectRegisterValue(Regs::t1, -5);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amomin_w");
+
+	Success("test_amomin_w");
+}
+static void Test_amomax_w()
+{
+	RISCV_Program program("Test_amomax_w");
+
+	program.SetRegister(Regs::s0, 200);
+	program.SetRegister(Regs::s1, -5);
+	program.SetRegister(Regs::s2, 3);
+	program.AddInstruction(Create_sw(Regs::s0, Regs::s1, 0));
+	program.AddInstruction(Create_amomax_w(Regs::t0, Regs::s0, Regs::s2));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::s0, 0));
+	program.ExpectRegisterValue(Regs::t0, -5);
+	program.ExpectRegisterValue(Regs::t1, 3);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amomax_w");
+
+	Success("test_amomax_w");
+}
+static void Test_amominu_w()
+{
+	RISCV_Program program("Test_amominu_w");
+
+	program.SetRegister(Regs::s0, 200);
+	program.SetRegister(Regs::s1, -5);
+	program.SetRegister(Regs::s2, 3);
+	program.AddInstruction(Create_sw(Regs::s0, Regs::s1, 0));
+	program.AddInstruction(Create_amominu_w(Regs::t0, Regs::s0, Regs::s2));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::s0, 0));
+	program.ExpectRegisterValue(Regs::t0, -5);
+	program.ExpectRegisterValue(Regs::t1, 3);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amominu_w");
+
+	Success("test_amominu_w");
+}
+static void Test_amomaxu_w()
+{
+	RISCV_Program program("Test_amomaxu_w");
+
+	program.SetRegister(Regs::s0, 200);
+	program.SetRegister(Regs::s1, -5);
+	program.SetRegister(Regs::s2, 3);
+	program.AddInstruction(Create_sw(Regs::s0, Regs::s1, 0));
+	program.AddInstruction(Create_amomaxu_w(Regs::t0, Regs::s0, Regs::s2));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::s0, 0));
+	program.ExpectRegisterValue(Regs::t0, -5);
+	program.ExpectRegisterValue(Regs::t1, -5);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amomaxu_w");
+
+	Success("test_amomaxu_w");
+}
 static void Test_li()
 {
 	RISCV_Program program("Test_li");
@@ -1536,6 +1780,17 @@ void TestAllInstructions()
 		Test_divu();
 		Test_rem();
 		Test_remu();
+		Test_lr_w();
+		Test_sc_w();
+		Test_amoswap_w();
+		Test_amoadd_w();
+		Test_amoxor_w();
+		Test_amoand_w();
+		Test_amoor_w();
+		Test_amomin_w();
+		Test_amomax_w();
+		Test_amominu_w();
+		Test_amomaxu_w();
 		Test_li();
 	}
 	catch (std::runtime_error& e)
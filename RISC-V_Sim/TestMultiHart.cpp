@@ -0,0 +1,189 @@
+#include "TestMultiHart.h"
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "MultiHartSystem.h"
+#include "DecodedProgram.h"
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "TestHelpers.h"
+
+static uint32_t ReadWord(GuestMemory& memory, const int32_t address)
+{
+	uint32_t word = 0;
+	memory.CopyTo(address, sizeof(word), reinterpret_cast<uint8_t*>(&word));
+	return word;
+}
+
+static std::vector<uint8_t> ReadMemory(GuestMemory& memory)
+{
+	std::vector<uint8_t> bytes(memory.GetSize());
+	memory.CopyTo(0, memory.GetSize(), bytes.data());
+	return bytes;
+}
+
+static void TestHartId()
+{
+	const uint32_t CSR_MHARTID = 0xf14;
+
+	//every hart writes its id + 100 and its stack pointer
+	//into its own slot in the shared memory
+	std::vector<uint32_t> program;
+	program.push_back(Create_csrrs(Regs::t0, Regs::x0, CSR_MHARTID));
+	program.push_back(Create_slli(Regs::t1, Regs::t0, 2));
+	program.push_back(Create_addi(Regs::t2, Regs::t0, 100));
+	program.push_back(Create_sw(Regs::t1, Regs::t2, 256));
+	program.push_back(Create_sw(Regs::t1, Regs::sp, 512));
+	program.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	program.push_back(Create_ecall());
+
+	const uint32_t HART_COUNT = 8;
+	MultiHartSystem system(DecodeTestProgram(program), HART_COUNT);
+	system.Run();
+
+	for (uint32_t i = 0; i < HART_COUNT; i++)
+	{
+		const GuestContext& hart = system.GetHart(i);
+		Expect(hart.status == GuestStatus::Exited, "hart " + std::to_string(i) + " should have exited. " + hart.error);
+		Expect(hart.hart.registers[static_cast<uint32_t>(Regs::t0)].uword == i, "mhartid should be " + std::to_string(i));
+		Expect(ReadWord(system.GetMemory(), 256 + i * 4) == i + 100, "hart " + std::to_string(i) + " should write to the shared memory");
+
+		const uint32_t expectedStack = Processor::GetMemorySize() - i * MultiHartSystem::HART_STACK_SIZE;
+		Expect(ReadWord(system.GetMemory(), 512 + i * 4) == expectedStack, "hart " + std::to_string(i) + " should have its own stack");
+	}
+
+	//mhartid is read only
+	std::vector<uint32_t> writeProgram;
+	writeProgram.push_back(Create_csrrw(Regs::t0, Regs::t1, CSR_MHARTID));
+	MultiHartSystem writeSystem(DecodeTestProgram(writeProgram), 2);
+	writeSystem.Run();
+	Expect(writeSystem.GetHart(1).status == GuestStatus::Error, "writing to mhartid should fail");
+
+	Success("multi hart mhartid");
+}
+
+//every hart increments four counters in shared memory:
+//one with amoadd.w, one protected by a spinlock made with
+//amoswap.w, one with a lr.w/sc.w loop and one without
+//any synchronization at all
+static std::vector<uint32_t> CreateCounterProgram(const uint32_t iterations)
+{
+	std::vector<uint32_t> program;
+	program.push_back(Create_addi(Regs::s0, Regs::x0, 256));
+	program.push_back(Create_addi(Regs::s1, Regs::x0, 260));
+	program.push_back(Create_addi(Regs::s2, Regs::x0, 264));
+	program.push_back(Create_addi(Regs::s3, Regs::x0, 268));
+	program.push_back(Create_addi(Regs::s4, Regs::x0, 272));
+	program.push_back(Create_addi(Regs::t0, Regs::x0, iterations));
+	program.push_back(Create_addi(Regs::t1, Regs::x0, 1));
+	//loop:
+	program.push_back(Create_amoadd_w(Regs::x0, Regs::s0, Regs::t1));
+	//take the lock
+	program.push_back(Create_amoswap_w(Regs::t2, Regs::s1, Regs::t1, true, false));
+	program.push_back(Create_bne(Regs::t2, Regs::x0, -4));
+	program.push_back(Create_lw(Regs::t3, Regs::s2, 0));
+	program.push_back(Create_addi(Regs::t3, Regs::t3, 1));
+	program.push_back(Create_sw(Regs::s2, Regs::t3, 0));
+	//release the lock
+	program.push_back(Create_amoswap_w(Regs::x0, Regs::s1, Regs::x0, false, true));
+	program.push_back(Create_lr_w(Regs::t4, Regs::s3));
+	program.push_back(Create_addi(Regs::t4, Regs::t4, 1));
+	program.push_back(Create_sc_w(Regs::t5, Regs::s3, Regs::t4));
+	program.push_back(Create_bne(Regs::t5, Regs::x0, -12));
+	program.push_back(Create_lw(Regs::t6, Regs::s4, 0));
+	program.push_back(Create_addi(Regs::t6, Regs::t6, 1));
+	program.push_back(Create_sw(Regs::s4, Regs::t6, 0));
+	program.push_back(Create_addi(Regs::t0, Regs::t0, -1));
+	program.push_back(Create_bne(Regs::t0, Regs::x0, -60));
+	program.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	program.push_back(Create_ecall());
+
+	return program;
+}
+
+static void ExpectSynchronizedCounters(MultiHartSystem& system, const uint32_t expected)
+{
+	for (uint32_t i = 0; i < system.GetHartCount(); i++)
+	{
+		Expect(system.GetHart(i).status == GuestStatus::Exited, "hart " + std::to_string(i) + " should have exited. " + system.GetHart(i).error);
+	}
+	Expect(ReadWord(system.GetMemory(), 256) == expected, "amoadd.w lost an increment");
+	Expect(ReadWord(system.GetMemory(), 264) == expected, "the spinlock didn't protect the counter");
+	Expect(ReadWord(system.GetMemory(), 268) == expected, "lr.w and sc.w lost an increment");
+}
+
+static void TestAtomics()
+{
+	const uint32_t ITERATIONS = 1000;
+	const uint32_t HART_COUNT = 4;
+	MultiHartSystem system(DecodeTestProgram(CreateCounterProgram(ITERATIONS)), HART_COUNT);
+	system.Run();
+	ExpectSynchronizedCounters(system, HART_COUNT * ITERATIONS);
+
+	Success("multi hart atomics");
+}
+
+static void TestDeterministic()
+{
+	const uint32_t ITERATIONS = 100;
+	const uint32_t HART_COUNT = 4;
+	const std::shared_ptr<const DecodedProgram> program = DecodeTestProgram(CreateCounterProgram(ITERATIONS));
+
+	//the same program has to give exactly the same
+	//result no matter how many threads are used
+	MultiHartSystem oneThread(program, HART_COUNT);
+	oneThread.RunDeterministic(7, RunLimits(), 1);
+	ExpectSynchronizedCounters(oneThread, HART_COUNT * ITERATIONS);
+
+	MultiHartSystem threeThreads(program, HART_COUNT);
+	threeThreads.RunDeterministic(7, RunLimits(), 3);
+	ExpectSynchronizedCounters(threeThreads, HART_COUNT * ITERATIONS);
+
+	Expect(ReadWord(oneThread.GetMemory(), 272) == ReadWord(threeThreads.GetMemory(), 272), "the unsynchronized counter should be the same every time");
+	for (uint32_t i = 0; i < HART_COUNT; i++)
+	{
+		const HartState& first = oneThread.GetHart(i).hart;
+		const HartState& second = threeThreads.GetHart(i).hart;
+		Expect(first.retiredInstructions == second.retiredInstructions, "hart " + std::to_string(i) + " should run the same number of instructions");
+		for (uint32_t j = 0; j < 32; j++)
+		{
+			Expect(first.registers[j].uword == second.registers[j].uword, "hart " + std::to_string(i) + " should end with the same registers");
+		}
+	}
+
+	//every thread count has to end with the same memory, also with
+	//more threads than harts. Running it a few times gives a race
+	//between the threads more chances to change the result
+	const std::vector<uint8_t> expectedMemory = ReadMemory(oneThread.GetMemory());
+	for (uint32_t run = 0; run < 5; run++)
+	{
+		for (const size_t threadCount : { size_t(2), size_t(4), size_t(8) })
+		{
+			MultiHartSystem system(program, HART_COUNT);
+			system.RunDeterministic(7, RunLimits(), threadCount);
+			Expect(ReadMemory(system.GetMemory()) == expectedMemory, "the memory should be the same with " + std::to_string(threadCount) + " threads as with one");
+		}
+	}
+
+	Success("multi hart deterministic");
+}
+
+void TestAllMultiHart()
+{
+	try
+	{
+		TestHartId();
+		TestAtomics();
+		TestDeterministic();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all multi hart tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all multi hart tests\n" << std::endl;
+}
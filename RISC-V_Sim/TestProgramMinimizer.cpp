@@ -0,0 +1,109 @@
+#include "TestProgramMinimizer.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ProgramMinimizer.h"
+#include "RandomProgram.h"
+#include "RISCV_Program.h"
+#include "InstructionEncode.h"
+#include "TSrandom.h"
+#include "Register.h"
+#include "TestHelpers.h"
+
+static std::vector<uint32_t> CreateRandomInstructions(const size_t size, const uint64_t seed)
+{
+	FRandom::TCRandom random = FRandom::CreateTCRandom(seed);
+	const std::vector<InstructionType>& types = GetArithmeticInstructionTypes();
+	std::vector<uint32_t> instructions;
+	for (size_t i = 0; i < size; i++)
+	{
+		instructions.push_back(RandomizeInstruction(types[FRandom::RandomRange(random, 0, static_cast<int32_t>(types.size()) - 1)], random));
+	}
+	return instructions;
+}
+
+static void TestFindsMinimalSequence()
+{
+	//random arithmetic instructions are never fence or ebreak
+	std::vector<uint32_t> instructions = CreateRandomInstructions(1000, 41);
+	instructions[300] = Create_fence();
+	instructions[700] = Create_ebreak();
+
+	const FailureCheck fenceBeforeEbreak = [](const std::vector<uint32_t>& candidate)
+	{
+		const auto fence = std::find(candidate.begin(), candidate.end(), Create_fence());
+		return std::find(fence, candidate.end(), Create_ebreak()) != candidate.end();
+	};
+
+	const MinimizeResult serial = MinimizeProgram(instructions, fenceBeforeEbreak, 1);
+	Expect(serial.instructions == std::vector<uint32_t>({ Create_fence(), Create_ebreak() }), "didn't find the two instructions");
+
+	const MinimizeResult parallel = MinimizeProgram(instructions, fenceBeforeEbreak, 4);
+	Expect(parallel.instructions == serial.instructions, "the result depends on the number of threads");
+
+	Success("minimizer finds minimal sequence");
+}
+
+static void TestMinimizesRunningProgram()
+{
+	//the program sets every register to its number first, so a0 is already 10
+	RISCV_Program original("minimizer");
+	for (uint32_t i = 0; i < 32; i++)
+	{
+		original.SetRegister(static_cast<Regs>(i), i);
+	}
+	for (const uint32_t instruction : CreateRandomInstructions(200, 42))
+	{
+		original.AddInstruction(instruction);
+	}
+	original.AddInstruction(Create_addi(Regs::t0, Regs::x0, 42));
+	original.EndProgram();
+	const std::vector<uint32_t>& instructions = original.GetInstructions();
+
+	//the failure is that t0 ends up as 42
+	const FailureCheck endsWith42 = [](const std::vector<uint32_t>& candidate)
+	{
+		RISCV_Program program("candidate");
+		for (const uint32_t instruction : candidate)
+		{
+			program.AddInstruction(instruction);
+		}
+		RunLimits limits;
+		limits.maxInstructions = 10'000;
+		try
+		{
+			return program.Run(limits) == RunStatus::Exited && program.GetProgramResult()[static_cast<uint32_t>(Regs::t0)] == 42;
+		}
+		catch (const std::exception&)
+		{
+			return false;
+		}
+	};
+
+	Expect(endsWith42(instructions), "the original program doesn't fail");
+	const MinimizeResult result = MinimizeProgram(instructions, endsWith42, 4);
+	Expect(result.instructions.size() == 3, "expected a0 = 10, t0 = 42 and ecall but got " + std::to_string(result.instructions.size()) + " instructions");
+	Expect(endsWith42(result.instructions), "the minimized program doesn't fail");
+
+	Success("minimizer shrinks running program");
+}
+
+void TestAllProgramMinimizer()
+{
+	try
+	{
+		TestFindsMinimalSequence();
+		TestMinimizesRunningProgram();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all minimizer tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all minimizer tests\n" << std::endl;
+}
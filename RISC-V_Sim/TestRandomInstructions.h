@@ -1,3 +1,5 @@
 #pragma once
 
-void TestRandomArithmeticInstructions();
\ No newline at end of file
+void TestRandomArithmeticInstructions();
+void TestFuzzCampaign();
+void TestStreamedRandomProgram();
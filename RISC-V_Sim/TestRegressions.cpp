@@ -0,0 +1,60 @@
+#include "TestRegressions.h"
+#include <cstdint>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BatchRunner.h"
+
+std::vector<std::string> FindRegressionTests(const std::vector<std::string>& directories)
+{
+	std::vector<std::string> tests;
+	for (const std::string& directory : directories)
+	{
+		if (!std::filesystem::is_directory(directory))
+		{
+			continue;
+		}
+
+		//a test is any program that comes with its expected result
+		for (const std::string& program : FindBatchPrograms(directory))
+		{
+			if (std::filesystem::exists(program + ".res"))
+			{
+				tests.push_back(program);
+			}
+		}
+	}
+
+	return tests;
+}
+
+bool TestAllRegressions(const std::vector<std::string>& directories, const size_t threadCount, const std::string& summaryPath)
+{
+	const std::vector<std::string> tests = FindRegressionTests(directories);
+
+	const auto startTime = std::chrono::steady_clock::now();
+	//a broken test shouldn't be able to hang the whole test suite
+	RunLimits limits;
+	limits.timeoutMilliseconds = 10'000;
+	const std::vector<BatchResult> results = RunBatch(tests, "", threadCount, limits);
+	const auto endTime = std::chrono::steady_clock::now();
+	const double wallMilliseconds = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+	SaveBatchSummaryJson(results, wallMilliseconds, summaryPath);
+	PrintBatchSummary(results);
+	std::cout << "wall time:          " << wallMilliseconds << " ms" << std::endl;
+
+	for (const BatchResult& result : results)
+	{
+		if (result.status != BatchStatus::Passed && result.status != BatchStatus::ExpectedFailure)
+		{
+			std::cout << "Failed regression tests. See " << summaryPath << "\n" << std::endl;
+			return false;
+		}
+	}
+
+	std::cout << "Successfully finished all regression tests\n" << std::endl;
+	return true;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+std::vector<std::string> FindRegressionTests(const std::vector<std::string>& directories);
+bool TestAllRegressions(const std::vector<std::string>& directories, const size_t threadCount, const std::string& summaryPath);
@@ -0,0 +1,135 @@
+#include "TestSimulationServer.h"
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "SimulationServer.h"
+#include "TestHelpers.h"
+
+struct ServerResponse
+{
+	uint32_t status;
+	std::vector<uint32_t> registers;
+	std::string error;
+};
+
+static void AddRequest(std::vector<uint32_t>& requests, const std::vector<uint32_t>& program)
+{
+	requests.push_back(SERVER_REQUEST_MAGIC);
+	requests.push_back(static_cast<uint32_t>(program.size()));
+	requests.insert(requests.end(), program.begin(), program.end());
+	//no initial registers and no memory ranges
+	requests.push_back(0);
+	requests.push_back(0);
+}
+
+static uint32_t ReadResponseWord(FILE* file)
+{
+	uint8_t bytes[4];
+	Expect(std::fread(bytes, 1, 4, file) == 4, "the response is too short");
+	return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+//sends all the requests through one stream like --serve does and reads the responses
+static std::vector<ServerResponse> Serve(const std::vector<uint32_t>& requests, const size_t responseCount, const RunLimits& limits)
+{
+	FILE* input = std::tmpfile();
+	FILE* output = std::tmpfile();
+	Expect(input && output, "failed to create temporary files");
+	for (const uint32_t word : requests)
+	{
+		const uint8_t bytes[4] = { static_cast<uint8_t>(word), static_cast<uint8_t>(word >> 8), static_cast<uint8_t>(word >> 16), static_cast<uint8_t>(word >> 24) };
+		std::fwrite(bytes, 1, 4, input);
+	}
+	std::rewind(input);
+
+	SimulationServerContext context;
+	context.limits = limits;
+	const bool served = ServeStream(input, output, context);
+	std::rewind(output);
+
+	std::vector<ServerResponse> responses(responseCount);
+	for (ServerResponse& response : responses)
+	{
+		Expect(ReadResponseWord(output) == SERVER_RESPONSE_MAGIC, "wrong response magic");
+		response.status = ReadResponseWord(output);
+		if (response.status == SERVER_STATUS_ERROR)
+		{
+			response.error.resize(ReadResponseWord(output));
+			Expect(std::fread(&response.error[0], 1, response.error.size(), output) == response.error.size(), "the error message is too short");
+			continue;
+		}
+		for (uint32_t i = 0; i < 32; i++)
+		{
+			response.registers.push_back(ReadResponseWord(output));
+		}
+	}
+	std::fclose(input);
+	std::fclose(output);
+	Expect(served, "every request should be valid");
+	return responses;
+}
+
+static void TestRunawayProgramsAreStopped()
+{
+	const std::vector<uint32_t> forever = { Create_jal(Regs::x0, 0) };
+	std::vector<uint32_t> exits;
+	exits.push_back(Create_addi(Regs::t0, Regs::x0, 42));
+	exits.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	exits.push_back(Create_ecall());
+
+	//the program after the infinite loop has to be answered too
+	std::vector<uint32_t> requests;
+	AddRequest(requests, forever);
+	AddRequest(requests, exits);
+
+	RunLimits limits;
+	limits.maxInstructions = 100000;
+	std::vector<ServerResponse> responses = Serve(requests, 2, limits);
+	Expect(responses[0].status == SERVER_STATUS_INSTRUCTION_LIMIT, "an infinite loop should reach the instruction limit");
+	Expect(responses[1].status == SERVER_STATUS_SUCCESS && responses[1].registers[static_cast<uint32_t>(Regs::t0)] == 42, "the request after the infinite loop should run");
+
+	limits = RunLimits();
+	limits.timeoutMilliseconds = 20;
+	responses = Serve(requests, 2, limits);
+	Expect(responses[0].status == SERVER_STATUS_TIMEOUT, "an infinite loop should time out");
+	Expect(responses[1].status == SERVER_STATUS_SUCCESS, "the request after the timeout should run");
+
+	Success("server stops runaway programs");
+}
+
+static void TestEbreakIsAnError()
+{
+	std::vector<uint32_t> program;
+	program.push_back(Create_ebreak());
+	program.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	program.push_back(Create_ecall());
+	std::vector<uint32_t> requests;
+	AddRequest(requests, program);
+
+	const std::vector<ServerResponse> responses = Serve(requests, 1, RunLimits());
+	Expect(responses[0].status == SERVER_STATUS_ERROR && responses[0].error.find("ebreak") != std::string::npos, "an ebreak should be an error response");
+
+	Success("server ebreak");
+}
+
+void TestAllSimulationServer()
+{
+	try
+	{
+		TestRunawayProgramsAreStopped();
+		TestEbreakIsAnError();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all simulation server tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all simulation server tests\n" << std::endl;
+}
@@ -0,0 +1,231 @@
+#include "TestTraceWindows.h"
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "BinaryTrace.h"
+#include "CallGraphProfiler.h"
+#include "DecodedProgram.h"
+#include "ElfSymbols.h"
+#include "ExecutionStats.h"
+#include "GuestProfiler.h"
+#include "InstructionEncode.h"
+#include "Processor.h"
+#include "Register.h"
+#include "TestHelpers.h"
+#include "TraceWindows.h"
+
+//stores 10 words from address 100 in a loop, and runs 44 instructions
+static std::shared_ptr<const DecodedProgram> CreateStoreLoop()
+{
+	std::vector<uint32_t> loop;
+	loop.push_back(Create_addi(Regs::t1, Regs::x0, 10));
+	loop.push_back(Create_addi(Regs::t2, Regs::x0, 100));
+	loop.push_back(Create_sw(Regs::t2, Regs::t1, 0));
+	loop.push_back(Create_addi(Regs::t2, Regs::t2, 4));
+	loop.push_back(Create_addi(Regs::t1, Regs::t1, -1));
+	loop.push_back(Create_bne(Regs::t1, Regs::x0, -12));
+	loop.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	loop.push_back(Create_ecall());
+	return DecodeProgram(loop.data(), loop.size());
+}
+
+static void TestBreakpointsAndWatchpoints()
+{
+	const std::shared_ptr<const DecodedProgram> program = CreateStoreLoop();
+	for (const ExecutionEngine engine : { ExecutionEngine::Reference, ExecutionEngine::Threaded })
+	{
+		Processor processor;
+		processor.SetEngine(engine);
+		processor.Load(program);
+
+		//the pc is in the middle of the loop block
+		RunLimits limits;
+		limits.stopAtPc = 16;
+		Expect(processor.Continue(limits) == RunStatus::BreakpointReached, "should stop at the breakpoint");
+		Expect(processor.GetHartState().pc == 16 && processor.GetHartState().retiredInstructions == 4, "should stop right before the breakpoint");
+		Expect(processor.Continue(limits) == RunStatus::BreakpointReached, "should continue from the breakpoint");
+		Expect(processor.GetHartState().retiredInstructions == 8, "should stop at the breakpoint again after one iteration");
+
+		//the fourth store is to address 112
+		limits = RunLimits();
+		limits.stopBeforeAccessLow = 112;
+		limits.stopBeforeAccessHigh = 116;
+		processor.Load(program);
+		Expect(processor.Continue(limits) == RunStatus::WatchpointReached, "should stop at the watchpoint");
+		Expect(processor.GetHartState().pc == 8 && processor.GetHartState().retiredInstructions == 14, "should stop right before the access");
+		Expect(processor.Continue(limits) == RunStatus::Exited, "should continue from the watchpoint");
+		Expect(processor.GetHartState().retiredInstructions == 44, "the loop should run 44 instructions");
+	}
+
+	Success("breakpoints and watchpoints");
+}
+
+//traces the program inside the windows and returns what was traced
+static std::vector<TraceRecord> TraceWindowsOf(const std::shared_ptr<const DecodedProgram>& program, const ExecutionEngine engine,
+											   const TraceWindowOptions& options, uint64_t& windowCount)
+{
+	const std::string tracePath = (std::filesystem::temp_directory_path() / "rvsim_windows_test.rvtrace").string();
+	Processor processor;
+	TraceWindows windows(options);
+	ExecutionStats stats;
+	processor.SetEngine(engine);
+	processor.SetTraceWindows(&windows);
+	processor.SetExecutionStats(&stats);
+	{
+		TraceWriter trace(tracePath);
+		processor.SetTraceWriter(&trace);
+		Expect(processor.Run(program) == RunStatus::Exited, "the program should exit");
+		trace.Close();
+		Expect(trace.GetRecordCount() == windows.GetWindowInstructions(), "only the instructions in the windows should be traced");
+	}
+	Expect(processor.GetHartState().retiredInstructions == 44, "the windows shouldn't change how the program runs");
+	Expect(stats.GetReport().retiredInstructions == windows.GetWindowInstructions(), "only the instructions in the windows should be counted");
+	windowCount = windows.GetWindowCount();
+
+	std::vector<TraceRecord> records;
+	TraceReader reader(tracePath);
+	TraceRecord record;
+	while (reader.Next(record))
+	{
+		records.push_back(record);
+	}
+	std::filesystem::remove(tracePath);
+	return records;
+}
+
+static void TestWindowsLimitTheTrace()
+{
+	const std::shared_ptr<const DecodedProgram> program = CreateStoreLoop();
+	for (const ExecutionEngine engine : { ExecutionEngine::Reference, ExecutionEngine::Threaded })
+	{
+		uint64_t windowCount = 0;
+
+		//every iteration opens a window for the two instructions before the branch
+		TraceWindowOptions options;
+		options.startPc = 12;
+		options.stopPc = 20;
+		std::vector<TraceRecord> records = TraceWindowsOf(program, engine, options, windowCount);
+		Expect(windowCount == 10 && records.size() == 20, "a pc window should open in every iteration");
+		for (size_t i = 0; i < records.size(); i++)
+		{
+			Expect(records[i].pc == (i % 2 == 0 ? 12u : 16u), "a pc window should only trace the instructions between its pcs");
+		}
+
+		//instructions 10 to 14 are the third iteration and the store of the fourth
+		options = TraceWindowOptions();
+		options.startInstruction = 10;
+		options.windowLength = 5;
+		records = TraceWindowsOf(program, engine, options, windowCount);
+		Expect(windowCount == 1 && records.size() == 5, "an instruction window should open once");
+		const uint32_t expectedPcs[] = { 8, 12, 16, 20, 8 };
+		for (size_t i = 0; i < records.size(); i++)
+		{
+			Expect(records[i].pc == expectedPcs[i], "an instruction window should start after the instructions before it");
+		}
+
+		//a window that opens at the fourth store and runs to the end
+		options = TraceWindowOptions();
+		options.startAccessLow = 112;
+		options.startAccessHigh = 116;
+		records = TraceWindowsOf(program, engine, options, windowCount);
+		Expect(windowCount == 1 && records.size() == 30, "an access window should open once and run to the end");
+		Expect(records[0].pc == 8 && records[0].hasMemoryAddress && records[0].memoryAddress == 112, "an access window should start with the access");
+
+		//no start condition means the window is open from the start
+		options = TraceWindowOptions();
+		options.stopPc = 8;
+		records = TraceWindowsOf(program, engine, options, windowCount);
+		Expect(windowCount == 1 && records.size() == 2, "a window without a start should be open from the start");
+	}
+
+	bool threw = false;
+	try
+	{
+		TraceWindowOptions options;
+		options.startPc = 8;
+		options.stopPc = 8;
+		TraceWindows windows(options);
+	}
+	catch (const std::runtime_error&)
+	{
+		threw = true;
+	}
+	Expect(threw, "a window that starts and stops at the same pc should be an error");
+
+	Success("trace windows limit the trace");
+}
+
+//main calls f twice and f loops 50 times before it returns, 208 instructions
+static std::shared_ptr<const DecodedProgram> CreateCallingProgram()
+{
+	std::vector<uint32_t> program;
+	program.push_back(Create_jal(Regs::ra, 16));
+	program.push_back(Create_jal(Regs::ra, 12));
+	program.push_back(Create_addi(Regs::a0, Regs::x0, 10));
+	program.push_back(Create_ecall());
+	program.push_back(Create_addi(Regs::t1, Regs::x0, 50));
+	program.push_back(Create_addi(Regs::t1, Regs::t1, -1));
+	program.push_back(Create_bne(Regs::t1, Regs::x0, -4));
+	program.push_back(Create_jalr(Regs::x0, Regs::ra, 0));
+	return DecodeProgram(program.data(), program.size());
+}
+
+static void TestWindowsKeepTheCallStack()
+{
+	for (const ExecutionEngine engine : { ExecutionEngine::Reference, ExecutionEngine::Threaded })
+	{
+		//the window opens inside the first call to f, so the rest of that call is still
+		//in f, and main only has the second call and the exit in the window
+		TraceWindowOptions options;
+		options.startInstruction = 10;
+		TraceWindows windows(options);
+		Processor processor;
+		CallGraphProfiler callGraph;
+		GuestProfiler profiler(1);
+		processor.SetEngine(engine);
+		processor.SetTraceWindows(&windows);
+		processor.SetCallGraphProfiler(&callGraph);
+		processor.SetProfiler(&profiler);
+		Expect(processor.Run(CreateCallingProgram()) == RunStatus::Exited, "the program should exit");
+		Expect(windows.GetWindowInstructions() == 198, "the window should run to the end of the program");
+
+		std::stringstream folded;
+		callGraph.WriteFoldedStacks(folded, SymbolTable());
+		Expect(folded.str() == "0x0 3\n0x0;0x10 195\n", "wrong call graph folded stacks in a window:\n" + folded.str());
+		folded.str("");
+		profiler.WriteFoldedStacks(folded, SymbolTable());
+		Expect(folded.str() == "0x0 3\n0x0;0x10 195\n", "wrong profiler folded stacks in a window:\n" + folded.str());
+
+		const CallGraphReport report = callGraph.GetReport(SymbolTable(), 2);
+		Expect(report.retiredInstructions == 198 && report.functions.size() == 2, "only the instructions in the window should be counted");
+		const CallGraphFunction& main = report.functions[0];
+		const CallGraphFunction& f = report.functions[1];
+		Expect(main.name == "0x0" && main.inclusiveInstructions == 198 && main.exclusiveInstructions == 3, "wrong instruction counts for main");
+		Expect(f.name == "0x10" && f.inclusiveInstructions == 195 && f.calls == 1, "only the call to f inside the window should be counted");
+	}
+
+	Success("trace windows keep the call stack");
+}
+
+void TestAllTraceWindows()
+{
+	try
+	{
+		TestBreakpointsAndWatchpoints();
+		TestWindowsLimitTheTrace();
+		TestWindowsKeepTheCallStack();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all trace windows tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all trace windows tests\n" << std::endl;
+}
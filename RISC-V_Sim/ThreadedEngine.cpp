@@ -0,0 +1,265 @@
+#include "ThreadedEngine.h"
+#include <cstdint>
+
+//the operations are written from the specification
+//instead of being copied from Processor::RunInstruction,
+//otherwise checking one against the other wouldn't find anything
+
+static uint32_t Add(const uint32_t a, const uint32_t b) { return a + b; }
+static uint32_t Sub(const uint32_t a, const uint32_t b) { return a - b; }
+static uint32_t ShiftLeft(const uint32_t a, const uint32_t b) { return a << (b & 31); }
+static uint32_t ShiftRight(const uint32_t a, const uint32_t b) { return a >> (b & 31); }
+static uint32_t ShiftRightArithmetic(const uint32_t a, const uint32_t b)
+{
+	//shifting in the sign bits by hand so it doesn't depend on how the host shifts negative numbers
+	const uint32_t shift = b & 31;
+	const uint32_t signBits = (a & 0x80000000u) && shift != 0 ? ~(0xffffffffu >> shift) : 0;
+	return (a >> shift) | signBits;
+}
+static uint32_t SetLessThan(const uint32_t a, const uint32_t b) { return static_cast<int32_t>(a) < static_cast<int32_t>(b) ? 1 : 0; }
+static uint32_t SetLessThanUnsigned(const uint32_t a, const uint32_t b) { return a < b ? 1 : 0; }
+static uint32_t Xor(const uint32_t a, const uint32_t b) { return a ^ b; }
+static uint32_t Or(const uint32_t a, const uint32_t b) { return a | b; }
+static uint32_t And(const uint32_t a, const uint32_t b) { return a & b; }
+
+static uint32_t Multiply(const uint32_t a, const uint32_t b) { return a * b; }
+static uint32_t MultiplyHigh(const uint32_t a, const uint32_t b)
+{
+	return static_cast<uint32_t>(static_cast<uint64_t>(static_cast<int64_t>(static_cast<int32_t>(a)) * static_cast<int64_t>(static_cast<int32_t>(b))) >> 32);
+}
+static uint32_t MultiplyHighSignedUnsigned(const uint32_t a, const uint32_t b)
+{
+	//the unsigned operand fits in an int64_t so the product can't overflow
+	return static_cast<uint32_t>(static_cast<uint64_t>(static_cast<int64_t>(static_cast<int32_t>(a)) * static_cast<int64_t>(b)) >> 32);
+}
+static uint32_t MultiplyHighUnsigned(const uint32_t a, const uint32_t b)
+{
+	return static_cast<uint32_t>((static_cast<uint64_t>(a) * static_cast<uint64_t>(b)) >> 32);
+}
+static uint32_t Divide(const uint32_t a, const uint32_t b)
+{
+	if (b == 0)
+	{
+		return 0xffffffffu;
+	}
+	//the only division that overflows, the result is the dividend
+	if (a == 0x80000000u && b == 0xffffffffu)
+	{
+		return a;
+	}
+	return static_cast<uint32_t>(static_cast<int32_t>(a) / static_cast<int32_t>(b));
+}
+static uint32_t DivideUnsigned(const uint32_t a, const uint32_t b) { return b == 0 ? 0xffffffffu : a / b; }
+static uint32_t Remainder(const uint32_t a, const uint32_t b)
+{
+	if (b == 0)
+	{
+		return a;
+	}
+	if (a == 0x80000000u && b == 0xffffffffu)
+	{
+		return 0;
+	}
+	return static_cast<uint32_t>(static_cast<int32_t>(a) % static_cast<int32_t>(b));
+}
+static uint32_t RemainderUnsigned(const uint32_t a, const uint32_t b) { return b == 0 ? a : a % b; }
+
+static bool Equal(const uint32_t a, const uint32_t b) { return a == b; }
+static bool NotEqual(const uint32_t a, const uint32_t b) { return a != b; }
+static bool LessThan(const uint32_t a, const uint32_t b) { return static_cast<int32_t>(a) < static_cast<int32_t>(b); }
+static bool GreaterOrEqual(const uint32_t a, const uint32_t b) { return static_cast<int32_t>(a) >= static_cast<int32_t>(b); }
+static bool LessThanUnsigned(const uint32_t a, const uint32_t b) { return a < b; }
+static bool GreaterOrEqualUnsigned(const uint32_t a, const uint32_t b) { return a >= b; }
+
+static uint32_t LoadByte(const GuestMemory& memory, const int32_t address) { return static_cast<uint32_t>(static_cast<int32_t>(static_cast<int8_t>(memory.GetByte(address)))); }
+static uint32_t LoadHalfWord(const GuestMemory& memory, const int32_t address) { return static_cast<uint32_t>(static_cast<int32_t>(static_cast<int16_t>(memory.GetHalfWord(address)))); }
+static uint32_t LoadWord(const GuestMemory& memory, const int32_t address) { return memory.GetWord(address); }
+static uint32_t LoadByteUnsigned(const GuestMemory& memory, const int32_t address) { return memory.GetByte(address); }
+static uint32_t LoadHalfWordUnsigned(const GuestMemory& memory, const int32_t address) { return memory.GetHalfWord(address); }
+
+static void StoreByte(GuestMemory& memory, const int32_t address, const uint32_t value) { memory.StoreByte(address, static_cast<int8_t>(value)); }
+static void StoreHalfWord(GuestMemory& memory, const int32_t address, const uint32_t value) { memory.StoreHalfWord(address, static_cast<int16_t>(value)); }
+static void StoreWord(GuestMemory& memory, const int32_t address, const uint32_t value) { memory.StoreWord(address, static_cast<int32_t>(value)); }
+
+template<uint32_t (*Operation)(uint32_t, uint32_t)>
+static void RegisterOperation(HartState& hart, GuestMemory&, const ThreadedInstruction& instruction)
+{
+	hart.registers[instruction.rd].uword = Operation(hart.registers[instruction.rs1].uword, hart.registers[instruction.rs2].uword);
+	hart.pc += 4;
+}
+
+template<uint32_t (*Operation)(uint32_t, uint32_t)>
+static void ImmediateOperation(HartState& hart, GuestMemory&, const ThreadedInstruction& instruction)
+{
+	hart.registers[instruction.rd].uword = Operation(hart.registers[instruction.rs1].uword, static_cast<uint32_t>(instruction.immediate));
+	hart.pc += 4;
+}
+
+template<bool (*Condition)(uint32_t, uint32_t)>
+static void Branch(HartState& hart, GuestMemory&, const ThreadedInstruction& instruction)
+{
+	const bool taken = Condition(hart.registers[instruction.rs1].uword, hart.registers[instruction.rs2].uword);
+	hart.pc += taken ? static_cast<uint32_t>(instruction.immediate) : 4;
+}
+
+template<uint32_t (*Load)(const GuestMemory&, int32_t)>
+static void LoadInstruction(HartState& hart, GuestMemory& memory, const ThreadedInstruction& instruction)
+{
+	hart.registers[instruction.rd].uword = Load(memory, hart.registers[instruction.rs1].word + instruction.immediate);
+	hart.pc += 4;
+}
+
+//a load to x0 still has to check the address
+template<uint32_t (*Load)(const GuestMemory&, int32_t)>
+static void DiscardedLoad(HartState& hart, GuestMemory& memory, const ThreadedInstruction& instruction)
+{
+	Load(memory, hart.registers[instruction.rs1].word + instruction.immediate);
+	hart.pc += 4;
+}
+
+template<void (*Store)(GuestMemory&, int32_t, uint32_t)>
+static void StoreInstruction(HartState& hart, GuestMemory& memory, const ThreadedInstruction& instruction)
+{
+	Store(memory, hart.registers[instruction.rs1].word + instruction.immediate, hart.registers[instruction.rs2].uword);
+	hart.pc += 4;
+}
+
+static void LoadUpperImmediate(HartState& hart, GuestMemory&, const ThreadedInstruction& instruction)
+{
+	hart.registers[instruction.rd].uword = static_cast<uint32_t>(instruction.immediate);
+	hart.pc += 4;
+}
+
+static void AddUpperImmediateToPC(HartState& hart, GuestMemory&, const ThreadedInstruction& instruction)
+{
+	hart.registers[instruction.rd].uword = hart.pc + static_cast<uint32_t>(instruction.immediate);
+	hart.pc += 4;
+}
+
+static void JumpAndLink(HartState& hart, GuestMemory&, const ThreadedInstruction& instruction)
+{
+	hart.registers[instruction.rd].uword = hart.pc + 4;
+	hart.pc += static_cast<uint32_t>(instruction.immediate);
+}
+
+static void Jump(HartState& hart, GuestMemory&, const ThreadedInstruction& instruction)
+{
+	hart.pc += static_cast<uint32_t>(instruction.immediate);
+}
+
+static void JumpAndLinkRegister(HartState& hart, GuestMemory&, const ThreadedInstruction& instruction)
+{
+	const uint32_t target = (hart.registers[instruction.rs1].uword + static_cast<uint32_t>(instruction.immediate)) & ~1u;
+	hart.registers[instruction.rd].uword = hart.pc + 4;
+	hart.pc = target;
+}
+
+static void JumpRegister(HartState& hart, GuestMemory&, const ThreadedInstruction& instruction)
+{
+	hart.pc = (hart.registers[instruction.rs1].uword + static_cast<uint32_t>(instruction.immediate)) & ~1u;
+}
+
+static void NoOperation(HartState& hart, GuestMemory&, const ThreadedInstruction&)
+{
+	hart.pc += 4;
+}
+
+//the handler for an instruction that writes rd, or nullptr if it isn't one
+static ThreadedHandler GetHandler(const InstructionType type)
+{
+	switch (type)
+	{
+		case InstructionType::addi:   return ImmediateOperation<Add>;
+		case InstructionType::slli:   return ImmediateOperation<ShiftLeft>;
+		case InstructionType::slti:   return ImmediateOperation<SetLessThan>;
+		case InstructionType::sltiu:  return ImmediateOperation<SetLessThanUnsigned>;
+		case InstructionType::xori:   return ImmediateOperation<Xor>;
+		case InstructionType::srli:   return ImmediateOperation<ShiftRight>;
+		case InstructionType::srai:   return ImmediateOperation<ShiftRightArithmetic>;
+		case InstructionType::ori:    return ImmediateOperation<Or>;
+		case InstructionType::andi:   return ImmediateOperation<And>;
+		case InstructionType::add:    return RegisterOperation<Add>;
+		case InstructionType::sub:    return RegisterOperation<Sub>;
+		case InstructionType::sll:    return RegisterOperation<ShiftLeft>;
+		case InstructionType::slt:    return RegisterOperation<SetLessThan>;
+		case InstructionType::sltu:   return RegisterOperation<SetLessThanUnsigned>;
+		case InstructionType::xor_:   return RegisterOperation<Xor>;
+		case InstructionType::srl:    return RegisterOperation<ShiftRight>;
+		case InstructionType::sra:    return RegisterOperation<ShiftRightArithmetic>;
+		case InstructionType::or_:    return RegisterOperation<Or>;
+		case InstructionType::and_:   return RegisterOperation<And>;
+		case InstructionType::mul:    return RegisterOperation<Multiply>;
+		case InstructionType::mulh:   return RegisterOperation<MultiplyHigh>;
+		case InstructionType::mulhsu: return RegisterOperation<MultiplyHighSignedUnsigned>;
+		case InstructionType::mulhu:  return RegisterOperation<MultiplyHighUnsigned>;
+		case InstructionType::div:    return RegisterOperation<Divide>;
+		case InstructionType::divu:   return RegisterOperation<DivideUnsigned>;
+		case InstructionType::rem:    return RegisterOperation<Remainder>;
+		case InstructionType::remu:   return RegisterOperation<RemainderUnsigned>;
+		case InstructionType::lui:    return LoadUpperImmediate;
+		case InstructionType::auipc:  return AddUpperImmediateToPC;
+		case InstructionType::lb:     return LoadInstruction<LoadByte>;
+		case InstructionType::lh:     return LoadInstruction<LoadHalfWord>;
+		case InstructionType::lw:     return LoadInstruction<LoadWord>;
+		case InstructionType::lbu:    return LoadInstruction<LoadByteUnsigned>;
+		case InstructionType::lhu:    return LoadInstruction<LoadHalfWordUnsigned>;
+		case InstructionType::jal:    return JumpAndLink;
+		case InstructionType::jalr:   return JumpAndLinkRegister;
+		default:                      return nullptr;
+	}
+}
+
+//the handler when rd is x0, for the instructions that write rd
+static ThreadedHandler GetHandlerWithoutWrite(const InstructionType type)
+{
+	switch (type)
+	{
+		case InstructionType::lb:     return DiscardedLoad<LoadByte>;
+		case InstructionType::lh:     return DiscardedLoad<LoadHalfWord>;
+		case InstructionType::lw:     return DiscardedLoad<LoadWord>;
+		case InstructionType::lbu:    return DiscardedLoad<LoadByteUnsigned>;
+		case InstructionType::lhu:    return DiscardedLoad<LoadHalfWordUnsigned>;
+		case InstructionType::jal:    return Jump;
+		case InstructionType::jalr:   return JumpRegister;
+		default:                      return NoOperation;
+	}
+}
+
+//the handler for an instruction that doesn't write rd, or nullptr if it isn't one
+static ThreadedHandler GetHandlerWithoutDestination(const InstructionType type)
+{
+	switch (type)
+	{
+		case InstructionType::sb:     return StoreInstruction<StoreByte>;
+		case InstructionType::sh:     return StoreInstruction<StoreHalfWord>;
+		case InstructionType::sw:     return StoreInstruction<StoreWord>;
+		case InstructionType::beq:    return Branch<Equal>;
+		case InstructionType::bne:    return Branch<NotEqual>;
+		case InstructionType::blt:    return Branch<LessThan>;
+		case InstructionType::bge:    return Branch<GreaterOrEqual>;
+		case InstructionType::bltu:   return Branch<LessThanUnsigned>;
+		case InstructionType::bgeu:   return Branch<GreaterOrEqualUnsigned>;
+		default:                      return nullptr;
+	}
+}
+
+ThreadedInstruction CreateThreadedInstruction(const Instruction& instruction)
+{
+	ThreadedInstruction threaded;
+	threaded.immediate = instruction.immediate;
+	threaded.rd = instruction.rd;
+	threaded.rs1 = instruction.rs1;
+	threaded.rs2 = instruction.rs2;
+
+	threaded.handler = GetHandlerWithoutDestination(instruction.type);
+	if (!threaded.handler)
+	{
+		threaded.handler = GetHandler(instruction.type);
+		if (threaded.handler && instruction.rd == 0)
+		{
+			threaded.handler = GetHandlerWithoutWrite(instruction.type);
+		}
+	}
+
+	return threaded;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include "Instruction.h"
+#include "HartState.h"
+#include "GuestMemory.h"
+
+struct ThreadedInstruction;
+using ThreadedHandler = void (*)(HartState& hart, GuestMemory& memory, const ThreadedInstruction& instruction);
+
+//An instruction for the threaded engine. Each instruction points to a handler
+//made only for its type, so running it is one indirect call instead of going
+//through the switch in Processor::RunInstruction. The handlers are a second
+//implementation of the instructions, so they are checked against the
+//processor with --cross-check before they can be trusted.
+struct ThreadedInstruction
+{
+	//nullptr when the processor has to run the instruction itself,
+	//like ecall and the instructions that use csrs or atomics
+	ThreadedHandler handler;
+	int32_t immediate;
+	uint8_t rd;
+	uint8_t rs1;
+	uint8_t rs2;
+};
+
+//Picks the handler for an instruction. Instructions that would only
+//write to x0 get a handler that skips the write, so the handlers
+//never have to set x0 back to 0
+ThreadedInstruction CreateThreadedInstruction(const Instruction& instruction);
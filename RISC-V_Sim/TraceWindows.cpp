@@ -0,0 +1,129 @@
+#include "TraceWindows.h"
+#include <algorithm>
+#include <stdexcept>
+
+TraceWindows::TraceWindows(const TraceWindowOptions& windowOptions) : options(windowOptions)
+{
+	if (options.startPc != RunLimits::NO_STOP_PC && options.startPc == options.stopPc)
+	{
+		throw std::runtime_error("A trace window can't start and stop at the same pc.");
+	}
+	if (options.startAccessLow > options.startAccessHigh)
+	{
+		throw std::runtime_error("The access range of a trace window ends before it starts.");
+	}
+	if (options.windowLength == 0)
+	{
+		throw std::runtime_error("A trace window has to be at least one instruction long.");
+	}
+	Reset();
+}
+
+bool TraceWindows::HasStartCondition() const
+{
+	return options.startPc != RunLimits::NO_STOP_PC || options.startInstruction != UINT64_MAX || options.startAccessLow < options.startAccessHigh;
+}
+
+bool TraceWindows::Update(const HartState& hart)
+{
+	const uint64_t retired = hart.retiredInstructions;
+	if (open)
+	{
+		const bool reachedStopPc = hart.pc == options.stopPc && retired != openedAt;
+		if (reachedStopPc || retired - openedAt >= options.windowLength)
+		{
+			open = false;
+			closedAt = retired;
+		}
+		if (open)
+		{
+			return true;
+		}
+	}
+
+	bool start = false;
+	if (!HasStartCondition())
+	{
+		start = windowCount == 0;
+	}
+	//a window doesn't open again where one just closed
+	if (hart.pc == options.startPc && (windowCount == 0 || retired != closedAt))
+	{
+		start = true;
+	}
+	if (!startedByInstruction && retired >= options.startInstruction)
+	{
+		startedByInstruction = true;
+		start = true;
+	}
+
+	if (start)
+	{
+		open = true;
+		openedAt = retired;
+		windowCount++;
+	}
+	return open;
+}
+
+void TraceWindows::SetLimits(const HartState& hart, RunLimits& limits) const
+{
+	if (open)
+	{
+		limits.maxInstructions = std::min(limits.maxInstructions, options.windowLength - (hart.retiredInstructions - openedAt));
+		limits.stopAtPc = options.stopPc;
+		return;
+	}
+
+	limits.stopAtPc = options.startPc;
+	if (!startedByInstruction && options.startInstruction != UINT64_MAX)
+	{
+		limits.maxInstructions = std::min(limits.maxInstructions, options.startInstruction - hart.retiredInstructions);
+	}
+	if (!startedByAccess)
+	{
+		limits.stopBeforeAccessLow = options.startAccessLow;
+		limits.stopBeforeAccessHigh = options.startAccessHigh;
+	}
+}
+
+void TraceWindows::FinishRun(const HartState& hart, const uint64_t instructions, const RunStatus status)
+{
+	if (open)
+	{
+		windowInstructions += instructions;
+	}
+	else if (status == RunStatus::WatchpointReached)
+	{
+		startedByAccess = true;
+		open = true;
+		openedAt = hart.retiredInstructions;
+		windowCount++;
+	}
+}
+
+void TraceWindows::Reset()
+{
+	open = false;
+	openedAt = 0;
+	closedAt = 0;
+	startedByInstruction = false;
+	startedByAccess = false;
+	windowCount = 0;
+	windowInstructions = 0;
+}
+
+bool TraceWindows::IsOpen() const
+{
+	return open;
+}
+
+uint64_t TraceWindows::GetWindowCount() const
+{
+	return windowCount;
+}
+
+uint64_t TraceWindows::GetWindowInstructions() const
+{
+	return windowInstructions;
+}
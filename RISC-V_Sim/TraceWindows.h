@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include "HartState.h"
+#include "Processor.h"
+
+struct TraceWindowOptions
+{
+	//a window opens at the first start condition that is reached.
+	//Without any start condition a window is open from the start of the program
+	//opens right before the instruction at this pc, every time it's reached
+	uint32_t startPc = RunLimits::NO_STOP_PC;
+	//opens once this many instructions have been retired, only once
+	uint64_t startInstruction = UINT64_MAX;
+	//opens right before the first load, store or atomic instruction
+	//with an address in [low, high), only once
+	uint32_t startAccessLow = 0;
+	uint32_t startAccessHigh = 0;
+	//a window closes right before the instruction at the stop pc
+	//or after it has run this many instructions, whichever is first
+	uint32_t stopPc = RunLimits::NO_STOP_PC;
+	uint64_t windowLength = UINT64_MAX;
+};
+
+//Decides which instructions the stats, profilers and trace of a processor see. It's
+//given to Processor::SetTraceWindows. Outside a window the processor runs the fast
+//version of the run loop, and each start condition becomes one of the run limits,
+//so the only checks are the ones the run loop already does before each basic block.
+//An access range is the exception, since every memory access has to be checked for it.
+//With a profiler the fast run loop still follows the calls and returns, so the call
+//stacks of a window start at the program entry and not where the window opened
+class TraceWindows
+{
+private:
+	TraceWindowOptions options;
+	bool open;
+	//the retired instructions when the last window opened and closed
+	uint64_t openedAt;
+	uint64_t closedAt;
+	bool startedByInstruction;
+	bool startedByAccess;
+	uint64_t windowCount;
+	uint64_t windowInstructions;
+
+	bool HasStartCondition() const;
+
+public:
+	TraceWindows(const TraceWindowOptions& windowOptions);
+
+	//called before a run, returns whether a window is open
+	bool Update(const HartState& hart);
+	//adds the condition for the window to open or close to the limits
+	void SetLimits(const HartState& hart, RunLimits& limits) const;
+	//called after a run that started with Update
+	void FinishRun(const HartState& hart, const uint64_t instructions, const RunStatus status);
+	//called when a program is loaded, since it starts from the beginning
+	void Reset();
+
+	bool IsOpen() const;
+	uint64_t GetWindowCount() const;
+	//the number of instructions that were run inside the windows
+	uint64_t GetWindowInstructions() const;
+};
@@ -0,0 +1,127 @@
+#include "WorkStealingPool.h"
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <exception>
+
+//keep each range on its own cache line so workers
+//don't slow each other down when taking work
+struct alignas(64) WorkRange
+{
+	std::mutex lock;
+	size_t begin = 0;
+	size_t end = 0;
+};
+
+WorkStealingPool::WorkStealingPool(const size_t threads)
+{
+	threadCount = threads;
+	if (threadCount == 0)
+	{
+		threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+	}
+}
+
+size_t WorkStealingPool::GetThreadCount() const
+{
+	return threadCount;
+}
+
+static bool TakeOwnWork(WorkRange& range, size_t* index)
+{
+	std::lock_guard<std::mutex> guard(range.lock);
+	if (range.begin < range.end)
+	{
+		*index = range.begin++;
+		return true;
+	}
+	return false;
+}
+
+static bool StealWork(std::vector<WorkRange>& ranges, const size_t thief)
+{
+	for (size_t i = 1; i < ranges.size(); i++)
+	{
+		WorkRange& victim = ranges[(thief + i) % ranges.size()];
+		size_t stolenBegin;
+		size_t stolenEnd;
+		{
+			std::lock_guard<std::mutex> guard(victim.lock);
+			const size_t remaining = victim.end - victim.begin;
+			if (remaining == 0)
+			{
+				continue;
+			}
+			//take the back half so the victim can continue
+			//where it was without any interruption
+			stolenEnd = victim.end;
+			stolenBegin = victim.end - (remaining + 1) / 2;
+			victim.end = stolenBegin;
+		}
+
+		std::lock_guard<std::mutex> guard(ranges[thief].lock);
+		ranges[thief].begin = stolenBegin;
+		ranges[thief].end = stolenEnd;
+		return true;
+	}
+	//no work is added while running so when
+	//there is nothing to steal then all work is taken
+	return false;
+}
+
+void WorkStealingPool::ParallelFor(const size_t count, const std::function<void(size_t, size_t)>& task) const
+{
+	const size_t workers = std::max<size_t>(1, std::min(threadCount, count));
+	std::vector<WorkRange> ranges(workers);
+	for (size_t i = 0; i < workers; i++)
+	{
+		ranges[i].begin = (count * i) / workers;
+		ranges[i].end = (count * (i + 1)) / workers;
+	}
+
+	std::mutex errorLock;
+	std::exception_ptr firstError;
+	auto worker = [&](const size_t workerIndex)
+	{
+		try
+		{
+			size_t index;
+			do
+			{
+				while (TakeOwnWork(ranges[workerIndex], &index))
+				{
+					task(index, workerIndex);
+				}
+			} while (StealWork(ranges, workerIndex));
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> guard(errorLock);
+			if (!firstError)
+			{
+				firstError = std::current_exception();
+			}
+		}
+	};
+
+	//the calling thread is used as the first worker
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < workers; i++)
+	{
+		threads.emplace_back(worker, i);
+	}
+	worker(0);
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	if (firstError)
+	{
+		std::rethrow_exception(firstError);
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+class WorkStealingPool
+{
+private:
+	size_t threadCount;
+
+public:
+	//0 threads means one thread per hardware thread
+	WorkStealingPool(const size_t threads = 0);
+
+	size_t GetThreadCount() const;
+	//calls task(index, workerIndex) for every index in [0, count).
+	//Each worker starts with its own equal share of the indices and
+	//steals half of the remaining indices from another worker
+	//when it runs out, so slow tasks don't leave threads idle.
+	void ParallelFor(const size_t count, const std::function<void(size_t, size_t)>& task) const;
+};
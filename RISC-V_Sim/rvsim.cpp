@@ -0,0 +1,235 @@
+#define RVSIM_BUILD
+#include "rvsim.h"
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+#include "DecodedProgram.h"
+#include "DecodedProgramCache.h"
+#include "Processor.h"
+
+struct rvsim_processor
+{
+	Processor processor;
+	std::shared_ptr<const DecodedProgram> program;
+	std::string lastError;
+};
+
+//shared by all processors so a program that is loaded
+//by many processors is only decoded once
+static DecodedProgramCache& GetProgramCache()
+{
+	static DecodedProgramCache programCache;
+	return programCache;
+}
+
+//exceptions can't cross the C boundary so every call
+//that can throw is wrapped by this
+template<typename Function>
+static rvsim_status TryCall(rvsim_processor* processor, Function function)
+{
+	if (!processor)
+	{
+		return RVSIM_ERROR;
+	}
+	try
+	{
+		return function();
+	}
+	catch (const std::exception& e)
+	{
+		processor->lastError = e.what();
+	}
+	catch (...)
+	{
+		processor->lastError = "Unknown error";
+	}
+	return RVSIM_ERROR;
+}
+
+static rvsim_status VerifyMemoryRange(rvsim_processor* processor, const uint32_t address, const size_t size)
+{
+	const uint32_t memorySize = static_cast<uint32_t>(Processor::GetMemorySize());
+	if (address > memorySize || size > memorySize - address)
+	{
+		processor->lastError = "Memory access out of range. Address: " + std::to_string(address) + " Size: " + std::to_string(size);
+		return RVSIM_ERROR;
+	}
+	return RVSIM_OK;
+}
+
+extern "C" {
+
+int rvsim_api_version(void)
+{
+	return RVSIM_API_VERSION;
+}
+
+uint32_t rvsim_memory_size(void)
+{
+	return static_cast<uint32_t>(Processor::GetMemorySize());
+}
+
+rvsim_processor* rvsim_create(void)
+{
+	try
+	{
+		return new rvsim_processor();
+	}
+	catch (...)
+	{
+		return nullptr;
+	}
+}
+
+void rvsim_destroy(rvsim_processor* processor)
+{
+	delete processor;
+}
+
+const char* rvsim_last_error(const rvsim_processor* processor)
+{
+	return processor ? processor->lastError.c_str() : "No processor";
+}
+
+rvsim_status rvsim_load_program(rvsim_processor* processor, const uint32_t* instructions, size_t instruction_count)
+{
+	return TryCall(processor, [&]()
+	{
+		processor->program = GetProgramCache().GetOrDecode(instructions, instruction_count);
+		processor->processor.Load(processor->program);
+		return RVSIM_OK;
+	});
+}
+
+rvsim_status rvsim_load_program_bytes(rvsim_processor* processor, const void* bytes, size_t byte_count)
+{
+	return TryCall(processor, [&]()
+	{
+		if (byte_count % 4 != 0)
+		{
+			processor->lastError = "Program size has to be a multiple of 4 bytes. Size: " + std::to_string(byte_count);
+			return RVSIM_ERROR;
+		}
+
+		//programs are stored as little endian words
+		const uint8_t* programBytes = static_cast<const uint8_t*>(bytes);
+		std::vector<uint32_t> instructions(byte_count / 4);
+		for (size_t i = 0; i < instructions.size(); i++)
+		{
+			instructions[i] = (static_cast<uint32_t>(programBytes[i * 4 + 0]) <<  0) |
+							  (static_cast<uint32_t>(programBytes[i * 4 + 1]) <<  8) |
+							  (static_cast<uint32_t>(programBytes[i * 4 + 2]) << 16) |
+							  (static_cast<uint32_t>(programBytes[i * 4 + 3]) << 24);
+		}
+		return rvsim_load_program(processor, instructions.data(), instructions.size());
+	});
+}
+
+rvsim_status rvsim_reset(rvsim_processor* processor)
+{
+	return TryCall(processor, [&]()
+	{
+		if (processor->program)
+		{
+			processor->processor.Load(processor->program);
+		}
+		else
+		{
+			processor->processor.Reset();
+		}
+		return RVSIM_OK;
+	});
+}
+
+rvsim_status rvsim_run(rvsim_processor* processor, uint64_t max_instructions)
+{
+	return rvsim_run_for(processor, max_instructions, 0);
+}
+
+rvsim_status rvsim_run_for(rvsim_processor* processor, uint64_t max_instructions, uint64_t timeout_milliseconds)
+{
+	return TryCall(processor, [&]()
+	{
+		RunLimits limits;
+		limits.maxInstructions = max_instructions;
+		limits.timeoutMilliseconds = timeout_milliseconds;
+		switch (processor->processor.Continue(limits))
+		{
+			case RunStatus::Exited:
+				return RVSIM_OK;
+			case RunStatus::InstructionLimit:
+				return RVSIM_INSTRUCTION_LIMIT;
+			case RunStatus::Timeout:
+				return RVSIM_TIMEOUT;
+			default:
+				processor->lastError = "Unknown run status";
+				return RVSIM_ERROR;
+		}
+	});
+}
+
+uint64_t rvsim_retired_instructions(const rvsim_processor* processor)
+{
+	return processor ? processor->processor.GetHartState().retiredInstructions : 0;
+}
+
+uint32_t rvsim_get_register(const rvsim_processor* processor, unsigned index)
+{
+	if (!processor || index >= 32)
+	{
+		return 0;
+	}
+	return processor->processor.GetHartState().registers[index].uword;
+}
+
+rvsim_status rvsim_set_register(rvsim_processor* processor, unsigned index, uint32_t value)
+{
+	return TryCall(processor, [&]()
+	{
+		processor->processor.SetRegister(index, value);
+		return RVSIM_OK;
+	});
+}
+
+uint32_t rvsim_get_pc(const rvsim_processor* processor)
+{
+	return processor ? processor->processor.GetHartState().pc : 0;
+}
+
+void rvsim_set_pc(rvsim_processor* processor, uint32_t pc)
+{
+	if (processor)
+	{
+		processor->processor.SetPC(pc);
+	}
+}
+
+rvsim_status rvsim_read_memory(rvsim_processor* processor, uint32_t address, void* destination, size_t size)
+{
+	return TryCall(processor, [&]()
+	{
+		if (VerifyMemoryRange(processor, address, size) != RVSIM_OK)
+		{
+			return RVSIM_ERROR;
+		}
+		processor->processor.CopyMemoryTo(static_cast<int32_t>(address), static_cast<int32_t>(size), static_cast<uint8_t*>(destination));
+		return RVSIM_OK;
+	});
+}
+
+rvsim_status rvsim_write_memory(rvsim_processor* processor, uint32_t address, const void* source, size_t size)
+{
+	return TryCall(processor, [&]()
+	{
+		if (VerifyMemoryRange(processor, address, size) != RVSIM_OK)
+		{
+			return RVSIM_ERROR;
+		}
+		processor->processor.CopyMemoryFrom(static_cast<int32_t>(address), static_cast<int32_t>(size), static_cast<const uint8_t*>(source));
+		return RVSIM_OK;
+	});
+}
+
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+/*
+ * C API of the simulator. Build librvsim.a or librvsim.so with
+ * "make library" and link against it to embed the simulator.
+ *
+ * All functions are safe to call from any thread as long as a
+ * processor is only used by one thread at a time.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32) && defined(RVSIM_SHARED)
+	#ifdef RVSIM_BUILD
+		#define RVSIM_API __declspec(dllexport)
+	#else
+		#define RVSIM_API __declspec(dllimport)
+	#endif
+#else
+	#define RVSIM_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RVSIM_API_VERSION 1
+
+typedef struct rvsim_processor rvsim_processor;
+
+typedef enum rvsim_status
+{
+	/* the call succeeded. For rvsim_run it means the program exited with an ecall */
+	RVSIM_OK = 0,
+	/* rvsim_run stopped because it ran the maximum number of instructions */
+	RVSIM_INSTRUCTION_LIMIT = 1,
+	/* rvsim_run_for stopped because it ran for longer than the timeout */
+	RVSIM_TIMEOUT = 2,
+	/* the call failed, rvsim_last_error returns the reason */
+	RVSIM_ERROR = -1
+} rvsim_status;
+
+RVSIM_API int rvsim_api_version(void);
+RVSIM_API uint32_t rvsim_memory_size(void);
+
+RVSIM_API rvsim_processor* rvsim_create(void);
+RVSIM_API void rvsim_destroy(rvsim_processor* processor);
+RVSIM_API const char* rvsim_last_error(const rvsim_processor* processor);
+
+/* Loading a program resets the registers, pc and memory of the processor.
+ * Decoded programs are cached so loading the same program again is cheap. */
+RVSIM_API rvsim_status rvsim_load_program(rvsim_processor* processor, const uint32_t* instructions, size_t instruction_count);
+RVSIM_API rvsim_status rvsim_load_program_bytes(rvsim_processor* processor, const void* bytes, size_t byte_count);
+/* Resets the registers, pc and memory but keeps the loaded program */
+RVSIM_API rvsim_status rvsim_reset(rvsim_processor* processor);
+
+/* Runs until the program exits or max_instructions has been run.
+ * Can be called again to continue from where it stopped.
+ * An ebreak stops the program with RVSIM_ERROR and the pc stays at the ebreak. */
+RVSIM_API rvsim_status rvsim_run(rvsim_processor* processor, uint64_t max_instructions);
+/* Same as rvsim_run but also stops after timeout_milliseconds. 0 means no timeout */
+RVSIM_API rvsim_status rvsim_run_for(rvsim_processor* processor, uint64_t max_instructions, uint64_t timeout_milliseconds);
+RVSIM_API uint64_t rvsim_retired_instructions(const rvsim_processor* processor);
+
+RVSIM_API uint32_t rvsim_get_register(const rvsim_processor* processor, unsigned index);
+RVSIM_API rvsim_status rvsim_set_register(rvsim_processor* processor, unsigned index, uint32_t value);
+RVSIM_API uint32_t rvsim_get_pc(const rvsim_processor* processor);
+RVSIM_API void rvsim_set_pc(rvsim_processor* processor, uint32_t pc);
+
+RVSIM_API rvsim_status rvsim_read_memory(rvsim_processor* processor, uint32_t address, void* destination, size_t size);
+RVSIM_API rvsim_status rvsim_write_memory(rvsim_processor* processor, uint32_t address, const void* source, size_t size);
+
+#ifdef __cplusplus
+}
+#endif